@@ -165,7 +165,6 @@ typedef struct
 void buzzer_init(gpio_num_t gpio, rmt_channel_t rmt, bool isMuted);
 void buzzer_play_bgm(const song_t* song);
 void buzzer_play_sfx(const song_t* song);
-void buzzer_check_next_note(void);
 void buzzer_stop(void);
 
 #endif
\ No newline at end of file
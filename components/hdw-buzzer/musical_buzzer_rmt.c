@@ -3,6 +3,8 @@
 //==============================================================================
 
 #include <esp_log.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "esp_timer.h"
 #include "musical_buzzer.h"
 
@@ -14,7 +16,7 @@ typedef struct
 {
     const song_t* song;
     uint32_t note_index;
-    int64_t start_time;
+    int64_t start_time; // When the current note started, in microseconds
 } buzzerTrack_t;
 
 typedef struct
@@ -23,8 +25,9 @@ typedef struct
     uint32_t counter_clk_hz;
     buzzerTrack_t bgm;
     buzzerTrack_t sfx;
-    const musicalNote_t* playNote;
-    bool stopSong;
+    noteFrequency_t playingNote;
+    esp_timer_handle_t timer;
+    SemaphoreHandle_t mutex;
     bool isMuted;
 } rmt_buzzer_t;
 
@@ -32,8 +35,10 @@ typedef struct
 // Function Prototypes
 //==============================================================================
 
-static void play_note(const musicalNote_t* notation);
-static bool buzzer_track_check_next_note(buzzerTrack_t* track, bool isActive);
+static void play_note(noteFrequency_t note);
+static bool buzzer_track_advance(buzzerTrack_t* track, int64_t now, int64_t* nextChange);
+static void buzzer_sequence(int64_t now);
+static void buzzer_timer_cb(void* arg);
 
 //==============================================================================
 // Variables
@@ -92,6 +97,26 @@ void buzzer_init(gpio_num_t gpio, rmt_channel_t rmt, bool isMuted)
     // Save the channel and clock frequency
     rmt_buzzer.channel = rmt;
     ESP_ERROR_CHECK(rmt_get_counter_clock(rmt, &rmt_buzzer.counter_clk_hz));
+    rmt_buzzer.playingNote = SILENCE;
+
+    // Note changes are scheduled with a one shot timer, so they happen on time
+    // no matter how busy the main loop is. The callback is run from the high
+    // priority esp_timer task
+    if(NULL == rmt_buzzer.mutex)
+    {
+        rmt_buzzer.mutex = xSemaphoreCreateMutex();
+    }
+    if(NULL == rmt_buzzer.timer)
+    {
+        esp_timer_create_args_t timerArgs =
+        {
+            .callback = buzzer_timer_cb,
+            .arg = NULL,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "buzzer",
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timerArgs, &rmt_buzzer.timer));
+    }
 }
 
 /**
@@ -108,14 +133,18 @@ void buzzer_play_sfx(const song_t* song)
         return;
     }
 
+    xSemaphoreTake(rmt_buzzer.mutex, portMAX_DELAY);
+
     // update notation with the new one
+    int64_t now = esp_timer_get_time();
     rmt_buzzer.sfx.song = song;
     rmt_buzzer.sfx.note_index = 0;
-    rmt_buzzer.sfx.start_time = esp_timer_get_time();
+    rmt_buzzer.sfx.start_time = now;
 
     // Always start playing SFX
-    rmt_buzzer.playNote = &(rmt_buzzer.sfx.song->notes[rmt_buzzer.sfx.note_index]);
-    rmt_buzzer.stopSong = false;
+    buzzer_sequence(now);
+
+    xSemaphoreGive(rmt_buzzer.mutex);
 }
 
 /**
@@ -132,152 +161,168 @@ void buzzer_play_bgm(const song_t* song)
         return;
     }
 
+    xSemaphoreTake(rmt_buzzer.mutex, portMAX_DELAY);
+
     // update notation with the new one
+    int64_t now = esp_timer_get_time();
     rmt_buzzer.bgm.song = song;
     rmt_buzzer.bgm.note_index = 0;
-    rmt_buzzer.bgm.start_time = esp_timer_get_time();
+    rmt_buzzer.bgm.start_time = now;
 
-    // If there is no current SFX
-    if(NULL == rmt_buzzer.sfx.song)
-    {
-        // Start playing BGM
-        rmt_buzzer.playNote = &(rmt_buzzer.bgm.song->notes[rmt_buzzer.bgm.note_index]);
-        rmt_buzzer.stopSong = false;
-    }
+    // This will only be heard if there is no current SFX
+    buzzer_sequence(now);
+
+    xSemaphoreGive(rmt_buzzer.mutex);
 }
 
 /**
- * Check a specific track for notes to be played and queue them for playing.
- * This will always advance through notes in a song, even if it's not the active
- * track
+ * Advance a track to the given time. Each note starts exactly when the last
+ * one ended, rather than whenever the change was noticed, so timing errors
+ * don't accumulate over a song
  *
  * @param track The track to advance notes in
- * @param isActive true if this is active and should set a note to be played
- *                 false to just advance notes without playing
+ * @param now The current time, in microseconds
+ * @param nextChange Lowered to when this track's next note starts, if that's
+ *                   sooner than its current value
  * @return true  if this track is playing a note
  *         false if this track is not playing a note
  */
-static bool buzzer_track_check_next_note(buzzerTrack_t* track, bool isActive)
+static bool buzzer_track_advance(buzzerTrack_t* track, int64_t now, int64_t* nextChange)
 {
+    // Songs made only of zero length notes would loop forever, so give up
+    // after going through every note without time passing
+    uint32_t zeroLenNotes = 0;
+
     // Check if there is a song and there are still notes
-    if((NULL != track->song) && (track->note_index < track->song->numNotes))
+    while((NULL != track->song) && (track->note_index < track->song->numNotes))
     {
-        // Get the current time
-        int64_t cTime = esp_timer_get_time();
+        uint32_t timeMs = track->song->notes[track->note_index].timeMs;
+        int64_t noteEnd = track->start_time + (1000 * (int64_t)timeMs);
 
-        // Check if it's time to play the next note
-        if (cTime - track->start_time >= (1000 * track->song->notes[track->note_index].timeMs))
+        // If the current note is still playing, note when it ends
+        if(now < noteEnd)
         {
-            // Move to the next note
-            track->note_index++;
-            track->start_time = cTime;
-
-            // Loop if we should
-            if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
+            if(noteEnd < *nextChange)
             {
-                track->note_index = 0;
+                *nextChange = noteEnd;
             }
+            // Track is active
+            return true;
+        }
 
-            // If there is a note
-            if(track->note_index < track->song->numNotes)
-            {
-                if(isActive)
-                {
-                    // Set the note to be played
-                    rmt_buzzer.playNote = &(track->song->notes[track->note_index]);
-                    rmt_buzzer.stopSong = false;
-                }
-            }
-            else
-            {
-                if(isActive)
-                {
-                    // Set the song to stop
-                    rmt_buzzer.playNote = NULL;
-                    rmt_buzzer.stopSong = true;
-                }
-
-                // Clear track data
-                track->start_time = 0;
-                track->note_index = 0;
-                track->song = NULL;
-                // Track isn't active
-                return false;
-            }
+        // Move to the next note
+        track->note_index++;
+        track->start_time = noteEnd;
+
+        // Loop if we should
+        if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
+        {
+            track->note_index = 0;
+        }
+
+        zeroLenNotes = (0 == timeMs) ? (zeroLenNotes + 1) : 0;
+        if(zeroLenNotes > track->song->numNotes)
+        {
+            break;
         }
-        // Track is active
-        return true;
     }
+
+    // Clear track data
+    track->start_time = 0;
+    track->note_index = 0;
+    track->song = NULL;
     // Track isn't active
     return false;
 }
 
 /**
- * @brief Check if there is a new note to play on the buzzer. This must be
- * called periodically
+ * Advance both tracks to the given time, play whichever note should be
+ * sounding now, and schedule the timer for the next note change.
+ * rmt_buzzer.mutex must be held when calling this
+ *
+ * @param now The current time, in microseconds
  */
-void buzzer_check_next_note(void)
+static void buzzer_sequence(int64_t now)
 {
-    // Don't do much if muted
-    if(rmt_buzzer.isMuted)
+    int64_t nextChange = INT64_MAX;
+
+    // SFX has priority, but BGM keeps advancing underneath it
+    bool sfxIsActive = buzzer_track_advance(&rmt_buzzer.sfx, now, &nextChange);
+    bool bgmIsActive = buzzer_track_advance(&rmt_buzzer.bgm, now, &nextChange);
+
+    if(sfxIsActive)
     {
-        return;
+        play_note(rmt_buzzer.sfx.song->notes[rmt_buzzer.sfx.note_index].note);
+    }
+    else if(bgmIsActive)
+    {
+        play_note(rmt_buzzer.bgm.song->notes[rmt_buzzer.bgm.note_index].note);
+    }
+    else
+    {
+        play_note(SILENCE);
     }
 
-    // Try playing SFX first
-    bool sfxIsActive = buzzer_track_check_next_note(&rmt_buzzer.sfx, true);
-    // Then play BGM if SFX isn't active
-    buzzer_track_check_next_note(&rmt_buzzer.bgm, !sfxIsActive);
-
-    // Check if there is a song and there are still notes
-    if((NULL != rmt_buzzer.playNote) || rmt_buzzer.stopSong)
+    // Schedule the next note change, if there is one
+    esp_timer_stop(rmt_buzzer.timer);
+    if(INT64_MAX != nextChange)
     {
-        // Make sure RMT is idle
-        if(ESP_ERR_TIMEOUT != rmt_wait_tx_done(rmt_buzzer.channel, 0))
-        {
-            // If there is a note
-            if(NULL != rmt_buzzer.playNote)
-            {
-                // Play the note
-                play_note(rmt_buzzer.playNote);
-                rmt_buzzer.playNote = NULL;
-            }
-            else if (rmt_buzzer.stopSong)
-            {
-                // Song is over
-                rmt_tx_stop(rmt_buzzer.channel);
-                rmt_buzzer.stopSong = false;
-            }
-        }
+        esp_timer_start_once(rmt_buzzer.timer, nextChange - now);
     }
 }
 
 /**
- * @brief Play the current note on the buzzer
- * Warning, this MUST only be called when RMT is idle
+ * @brief Timer callback for note changes
+ *
+ * @param arg unused
+ */
+static void buzzer_timer_cb(void* arg __attribute__((unused)))
+{
+    xSemaphoreTake(rmt_buzzer.mutex, portMAX_DELAY);
+    buzzer_sequence(esp_timer_get_time());
+    xSemaphoreGive(rmt_buzzer.mutex);
+}
+
+/**
+ * @brief Play a note on the buzzer. The looped item is written straight into
+ * RMT memory instead of going through rmt_write_items(), which would block
+ * until the transmitter finished a loop. A new note takes effect at the end of
+ * the current period. rmt_buzzer.mutex must be held when calling this
+ *
+ * @param note The note to play
  */
-static void play_note(const musicalNote_t* notation)
+static void play_note(noteFrequency_t note)
 {
-    if(SILENCE == notation->note)
+    if(note == rmt_buzzer.playingNote)
+    {
+        // Already playing this note
+        return;
+    }
+
+    if(SILENCE == note)
     {
         rmt_tx_stop(rmt_buzzer.channel);
     }
     else
     {
-        static rmt_item32_t notation_code;
-        notation_code.level0 = 1;
+        // One period of a square wave, then an end marker to loop on
+        rmt_item32_t notation_code[2] = {0};
+        notation_code[0].level0 = 1;
         // convert frequency to RMT item format
-        notation_code.duration0 = rmt_buzzer.counter_clk_hz / notation->note / 2;
-        notation_code.level1 = 0,
+        notation_code[0].duration0 = rmt_buzzer.counter_clk_hz / note / 2;
+        notation_code[0].level1 = 0;
         // Copy RMT item format
-        notation_code.duration1 = notation_code.duration0;
+        notation_code[0].duration1 = notation_code[0].duration0;
 
-        // loop until manually stopped
-        rmt_set_tx_loop_count(rmt_buzzer.channel, 1);
+        rmt_fill_tx_items(rmt_buzzer.channel, notation_code, 2, 0);
 
-        // start TX
-        rmt_write_items(rmt_buzzer.channel, &notation_code, 1, false);
+        if(SILENCE == rmt_buzzer.playingNote)
+        {
+            // start TX, it loops until manually stopped
+            rmt_tx_start(rmt_buzzer.channel, true);
+        }
     }
+    rmt_buzzer.playingNote = note;
 }
 
 /**
@@ -292,14 +337,13 @@ void buzzer_stop(void)
         return;
     }
 
-    // Spin and wait for any ongoing transmissions to finish
-    while (ESP_ERR_TIMEOUT == rmt_wait_tx_done(rmt_buzzer.channel, 0))
-    {
-        ;
-    }
+    xSemaphoreTake(rmt_buzzer.mutex, portMAX_DELAY);
+
+    // No more note changes
+    esp_timer_stop(rmt_buzzer.timer);
 
     // Stop transmitting
-    rmt_tx_stop(rmt_buzzer.channel);
+    play_note(SILENCE);
 
     // Clear internal variables
     rmt_buzzer.bgm.note_index = 0;
@@ -310,6 +354,5 @@ void buzzer_stop(void)
     rmt_buzzer.sfx.song = NULL;
     rmt_buzzer.sfx.start_time = 0;
 
-    rmt_buzzer.playNote = NULL;
-    rmt_buzzer.stopSong = false;
+    xSemaphoreGive(rmt_buzzer.mutex);
 }
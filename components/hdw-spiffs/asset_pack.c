@@ -0,0 +1,87 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <string.h>
+
+#include "asset_pack.h"
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Check that a blob is an asset pack which can be read, and that every
+ * entry in it is inside the blob
+ *
+ * @param pack The start of the pack
+ * @param size The size of the blob the pack is in
+ * @return true if the pack can be used, false otherwise
+ */
+bool assetPackCheck(const uint8_t* pack, size_t size)
+{
+    const assetPackHeader_t* hdr = (const assetPackHeader_t*)pack;
+    if(NULL == pack || size < sizeof(assetPackHeader_t) || 0 != memcmp(hdr->magic, ASSET_PACK_MAGIC, 4) ||
+            ASSET_PACK_VERSION != hdr->version || hdr->size > size ||
+            hdr->numEntries > (hdr->size - sizeof(assetPackHeader_t)) / sizeof(assetPackEntry_t))
+    {
+        return false;
+    }
+
+    const assetPackEntry_t* toc = (const assetPackEntry_t*)&pack[sizeof(assetPackHeader_t)];
+    for(uint32_t i = 0; i < hdr->numEntries; i++)
+    {
+        // Data needs room for its terminator, and names have to end in the pack
+        if(toc[i].nameOffset >= hdr->size || toc[i].dataOffset > hdr->size ||
+                toc[i].size >= hdr->size - toc[i].dataOffset ||
+                NULL == memchr(&pack[toc[i].nameOffset], 0, hdr->size - toc[i].nameOffset) ||
+                (i > 0 && toc[i].hash < toc[i - 1].hash))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Find an asset in a pack. The pack must have passed assetPackCheck()
+ *
+ * @param pack The start of the pack
+ * @param name The asset's name
+ * @param size A pointer to return the asset's size in
+ * @return A pointer to the asset in the pack, followed by a null terminator, or
+ *         NULL if it isn't in the pack
+ */
+const uint8_t* assetPackFind(const uint8_t* pack, const char* name, size_t* size)
+{
+    const assetPackHeader_t* hdr = (const assetPackHeader_t*)pack;
+    const assetPackEntry_t* toc = (const assetPackEntry_t*)&pack[sizeof(assetPackHeader_t)];
+    uint32_t hash = assetPackHash(name);
+
+    // Find the first entry with this hash
+    uint32_t lo = 0;
+    uint32_t hi = hdr->numEntries;
+    while(lo < hi)
+    {
+        uint32_t mid = lo + ((hi - lo) / 2);
+        if(toc[mid].hash < hash)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    // Then check the name of each entry with the hash
+    for(; lo < hdr->numEntries && toc[lo].hash == hash; lo++)
+    {
+        if(0 == strcmp((const char*)&pack[toc[lo].nameOffset], name))
+        {
+            *size = toc[lo].size;
+            return &pack[toc[lo].dataOffset];
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,58 @@
+#ifndef _ASSET_PACK_H_
+#define _ASSET_PACK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * An asset pack is every processed asset in one read-only blob, so it can be
+ * mapped straight out of flash. It's written by spiffs_file_preprocessor and
+ * everything in it is little endian.
+ *
+ * The header is followed by the table of contents, sorted by name hash then
+ * name, then the null terminated names, then the files. Each file starts on an
+ * eight byte boundary and is followed by a null terminator which isn't
+ * counted in its size.
+ */
+
+#define ASSET_PACK_MAGIC   "SAPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_ALIGN   8
+
+typedef struct
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t numEntries;
+    uint32_t size;        //!< The size of the whole pack
+} assetPackHeader_t;
+
+typedef struct
+{
+    uint32_t hash;        //!< assetPackHash() of the name
+    uint32_t nameOffset;  //!< From the start of the pack
+    uint32_t dataOffset;  //!< From the start of the pack
+    uint32_t size;        //!< Not counting the null terminator
+} assetPackEntry_t;
+
+/**
+ * @brief Hash an asset's name with 32 bit FNV-1a
+ *
+ * @param name The name
+ * @return The hash
+ */
+static inline uint32_t assetPackHash(const char* name)
+{
+    uint32_t hash = 2166136261u;
+    while(*name)
+    {
+        hash = (hash ^ (uint8_t)(*name++)) * 16777619u;
+    }
+    return hash;
+}
+
+bool assetPackCheck(const uint8_t* pack, size_t size);
+const uint8_t* assetPackFind(const uint8_t* pack, const char* name, size_t* size);
+
+#endif
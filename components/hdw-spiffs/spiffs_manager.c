@@ -3,15 +3,33 @@
 //==============================================================================
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "esp_err.h"
 #include "esp_spiffs.h"
 #include "esp_log.h"
+#include "esp_partition.h"
 
 #include "spiffs_manager.h"
+#include "asset_pack.h"
 #include "spiffs_config.h"
 
+//==============================================================================
+// Defines
+//==============================================================================
+
+/* The partition spiffs_file_preprocessor's asset pack is flashed to */
+#define ASSET_PARTITION_LABEL   "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void mapAssetPack(void);
+static bool inAssetPack(const uint8_t* data);
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -25,6 +43,11 @@ static const esp_vfs_spiffs_conf_t conf =
     .format_if_mount_failed = false
 };
 
+/* The asset pack, mapped out of flash */
+static const uint8_t* assetPack = NULL;
+static size_t assetPackSize = 0;
+static spi_flash_mmap_handle_t assetPackHandle;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -48,6 +71,7 @@ bool initSpiffs(void)
     ESP_ERROR_CHECK(esp_spiffs_info(NULL, &total, &used));
     ESP_LOGI("SPIFFS", "Partition size: total: %d, used: %d", total, used);
 
+    mapAssetPack();
     return true;
 }
 
@@ -58,6 +82,12 @@ bool initSpiffs(void)
  */
 bool deinitSpiffs(void)
 {
+    if(NULL != assetPack)
+    {
+        spi_flash_munmap(assetPackHandle);
+        assetPack = NULL;
+        assetPackSize = 0;
+    }
     return (ESP_OK == esp_vfs_spiffs_unregister(conf.partition_label));
 }
 
@@ -81,6 +111,19 @@ bool spiffsReadFile(const char* fname, uint8_t** output, size_t* outsize)
         return false;
     }
 
+    // Copy it out of the asset pack, if it's there
+    const uint8_t* packed = (NULL == assetPack) ? NULL : assetPackFind(assetPack, fname, outsize);
+    if(NULL != packed)
+    {
+        *output = (uint8_t*)malloc(*outsize + 1);
+        if(NULL == *output)
+        {
+            return false;
+        }
+        memcpy(*output, packed, *outsize + 1);
+        return true;
+    }
+
     // Read and display the contents of a small text file
     ESP_LOGI("SPIFFS", "Reading %s", fname);
 
@@ -112,3 +155,94 @@ bool spiffsReadFile(const char* fname, uint8_t** output, size_t* outsize)
     ESP_LOGI("SPIFFS", "Read from %s: %u bytes", fname, *outsize);
     return true;
 }
+
+/**
+ * @brief Get a read-only view of a file in SPIFFS, for callers which only
+ * parse a file and don't need to own a copy of it. The view must be released
+ * with spiffsUnmapFile(). Like spiffsReadFile(), the data is followed by a
+ * null terminator which isn't counted in the size.
+ *
+ * Files in the asset pack are viewed straight out of flash through the MMU,
+ * so nothing is copied and compressed files can be decoded from the view.
+ * SPIFFS files aren't stored contiguously in flash, so anything which isn't in
+ * the pack is read into a copy.
+ *
+ * @param fname The name of the file to view
+ * @param data  A pointer to return the view in
+ * @param size  A pointer to a size_t to return the file size in
+ * @return true if the file was found, false otherwise
+ */
+bool spiffsMapFile(const char* fname, const uint8_t** data, size_t* size)
+{
+    if(NULL != assetPack && NULL != (*data = assetPackFind(assetPack, fname, size)))
+    {
+        return true;
+    }
+
+    uint8_t* buf = NULL;
+    if(spiffsReadFile(fname, &buf, size))
+    {
+        *data = buf;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Release a view from spiffsMapFile()
+ *
+ * @param data The view to release, may be NULL
+ */
+void spiffsUnmapFile(const uint8_t* data)
+{
+    // Views into the pack are flash, copies need to be freed
+    if(!inAssetPack(data))
+    {
+        free((void*)(uintptr_t)data);
+    }
+}
+
+/**
+ * @brief Map the asset pack out of its partition, if there is one and it's
+ * valid. Only as much flash as the pack uses is mapped, to save MMU pages
+ */
+static void mapAssetPack(void)
+{
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ASSET_PARTITION_SUBTYPE,
+                                  ASSET_PARTITION_LABEL);
+    assetPackHeader_t hdr;
+    if(NULL == part || ESP_OK != esp_partition_read(part, 0, &hdr, sizeof(hdr)) ||
+            0 != memcmp(hdr.magic, ASSET_PACK_MAGIC, 4) || hdr.size > part->size)
+    {
+        ESP_LOGW("SPIFFS", "No asset pack, assets will be read from SPIFFS");
+        return;
+    }
+
+    const void* mapped = NULL;
+    if(ESP_OK != esp_partition_mmap(part, 0, hdr.size, SPI_FLASH_MMAP_DATA, &mapped, &assetPackHandle))
+    {
+        ESP_LOGE("SPIFFS", "Failed to map the asset pack");
+        return;
+    }
+    if(!assetPackCheck(mapped, hdr.size))
+    {
+        ESP_LOGE("SPIFFS", "The asset pack is corrupt");
+        spi_flash_munmap(assetPackHandle);
+        return;
+    }
+
+    assetPack = mapped;
+    assetPackSize = hdr.size;
+    ESP_LOGI("SPIFFS", "Mapped the asset pack, %u files, %u bytes", hdr.numEntries, hdr.size);
+}
+
+/**
+ * @brief Check if a pointer points into the asset pack
+ *
+ * @param data The pointer to check
+ * @return true if it points into the asset pack, false otherwise
+ */
+static bool inAssetPack(const uint8_t* data)
+{
+    return (NULL != assetPack) && (data >= assetPack) && (data < &assetPack[assetPackSize]);
+}
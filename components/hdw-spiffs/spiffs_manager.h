@@ -3,10 +3,13 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 bool initSpiffs(void);
 bool deinitSpiffs(void);
 
 bool spiffsReadFile(const char* fname, uint8_t** output, size_t* outsize);
+bool spiffsMapFile(const char* fname, const uint8_t** data, size_t* size);
+void spiffsUnmapFile(const uint8_t* data);
 
 #endif
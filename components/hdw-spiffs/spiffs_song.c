@@ -0,0 +1,76 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "esp_log.h"
+#include "spiffs_manager.h"
+#include "spiffs_song.h"
+
+/**
+ * @brief Load a compiled song from ROM to RAM. Songs written as .song text
+ * files in the assets folder are compiled to .sng files by the
+ * spiffs_file_preprocessor and automatically flashed to ROM.
+ *
+ * A .sng file is a two byte note count and a one byte flags field (bit 0 is
+ * set if the song loops), followed by each note as a two byte frequency in Hz
+ * and a two byte duration in ms. Everything is big endian.
+ *
+ * @param name The filename of the song to load
+ * @param song A pointer to return the song in. This memory is allocated with
+ *             malloc() and must be freed with freeSong()
+ * @return true if the song was loaded successfully,
+ *         false if the song load failed and should not be used
+ */
+bool loadSong(const char* name, song_t** song)
+{
+    // Get a view of the song file
+    const uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsMapFile(name, &buf, &sz))
+    {
+        ESP_LOGE("SONG", "Failed to read %s", name);
+        return false;
+    }
+
+    // Make sure the file is as long as it says it is
+    uint16_t numNotes = (sz >= 3) ? ((buf[0] << 8) | buf[1]) : 0;
+    if((sz < 3) || (sz < 3 + (4 * (size_t)numNotes)))
+    {
+        ESP_LOGE("SONG", "%s is truncated", name);
+        spiffsUnmapFile(buf);
+        return false;
+    }
+
+    // Expand the notes to the format the buzzer plays
+    *song = (song_t*)malloc(sizeof(song_t) + (numNotes * sizeof(musicalNote_t)));
+    if(NULL == *song)
+    {
+        spiffsUnmapFile(buf);
+        return false;
+    }
+    (*song)->numNotes = numNotes;
+    (*song)->shouldLoop = buf[2] & 0x01;
+
+    const uint8_t* noteData = &buf[3];
+    for(uint16_t i = 0; i < numNotes; i++)
+    {
+        (*song)->notes[i].note   = (noteData[0] << 8) | noteData[1];
+        (*song)->notes[i].timeMs = (noteData[2] << 8) | noteData[3];
+        noteData += 4;
+    }
+
+    // Done with the file
+    spiffsUnmapFile(buf);
+    return true;
+}
+
+/**
+ * @brief Free the memory for a loaded song. Make sure it isn't still playing
+ *
+ * @param song The song to free
+ */
+void freeSong(song_t* song)
+{
+    free(song);
+}
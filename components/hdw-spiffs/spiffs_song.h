@@ -0,0 +1,11 @@
+#ifndef _SPIFFS_SONG_H_
+#define _SPIFFS_SONG_H_
+
+#include <stdbool.h>
+
+#include "musical_buzzer.h"
+
+bool loadSong(const char* name, song_t** song);
+void freeSong(song_t* song);
+
+#endif
@@ -41,7 +41,7 @@ SRC_DIRS_RECURSIVE = emu/src main/display main/modes main/colorchord main/utils
 # This is a list of directories to scan for c files not recursively
 SRC_DIRS_FLAT = main
 # This is a list of files to compile directly. There's no scanning here
-SRC_FILES = components/hdw-spiffs/heatshrink_decoder.c components/hdw-spiffs/spiffs_json.c
+SRC_FILES = components/hdw-spiffs/asset_pack.c components/hdw-spiffs/heatshrink_decoder.c components/hdw-spiffs/spiffs_json.c components/hdw-spiffs/spiffs_song.c
 # This is all the source directories combined
 SRC_DIRS = $(shell $(FIND) $(SRC_DIRS_RECURSIVE) -type d) $(SRC_DIRS_FLAT)
 # This is all the source files combined
@@ -178,6 +178,22 @@ LIBRARY_FLAGS = $(patsubst %, -L%, $(LIB_DIRS)) $(patsubst %, -l%, $(LIBS)) \
 # These are the files to build
 EXECUTABLE = swadge_emulator
 
+################################################################################
+# Allocation Tracing
+################################################################################
+
+# Build with 'make -f emu.mk ALLOC_TRACE=1' to trace every allocation and write
+# alloc_report.txt. ALLOC_TRACE_HEAP_KB sets the simulated heap size
+ifeq ($(ALLOC_TRACE),1)
+    DEFINES_LIST += EMU_ALLOC_TRACE=1
+    ifneq ($(ALLOC_TRACE_HEAP_KB),)
+        DEFINES_LIST += EMU_ALLOC_TRACE_HEAP_KB=$(ALLOC_TRACE_HEAP_KB)
+    endif
+    CFLAGS += -include emu/src/emu_alloc_trace.h
+    OBJ_DIR = emu/obj_alloc_trace
+    EXECUTABLE = swadge_emulator_alloc_trace
+endif
+
 ################################################################################
 # Targets for Building
 ################################################################################
@@ -0,0 +1,825 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#if defined(EMU_ALLOC_TRACE)
+
+// Use the real allocation functions in here. The header was force-included
+// before this, so undo its macros
+#undef malloc
+#undef calloc
+#undef realloc
+#undef strdup
+#undef free
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "esp_log.h"
+
+#include "emu_alloc_trace.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// The size of the simulated heap. The default is about what's free on an
+// ESP32-S2 with WiFi running. Add SPIRAM to this to check _TEST_USE_SPIRAM_
+#ifndef EMU_ALLOC_TRACE_HEAP_KB
+    #define EMU_ALLOC_TRACE_HEAP_KB 160
+#endif
+#define SIM_HEAP_SIZE ((size_t)EMU_ALLOC_TRACE_HEAP_KB * 1024)
+
+// Simulated heap block overhead and alignment, like multi_heap
+#define SIM_HDR_SIZE   8
+#define SIM_ALIGN      4
+#define SIM_MIN_BLOCK  16
+
+#define REPORT_FILE "alloc_report.txt"
+
+// How many call sites to list per mode
+#define REPORT_TOP_SITES 12
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+// A live allocation
+typedef struct
+{
+    void* ptr;        //!< NULL if this slot is empty
+    size_t size;
+    uint32_t site;    //!< Index into sites
+    uint32_t mode;    //!< Index into modes, which mode made this allocation
+    uint64_t frame;   //!< The frame this was allocated in
+    int64_t simOff;   //!< Where this is in the simulated heap, -1 if it didn't fit
+    size_t simLen;    //!< How much of the simulated heap this uses
+} traceAlloc_t;
+
+// Where allocations are made from
+typedef struct
+{
+    const char* file;
+    int line;
+} traceSite_t;
+
+// What one call site did during one mode
+typedef struct
+{
+    uint64_t allocs;
+    uint64_t bytes;
+    uint64_t sameFrameFrees;
+    uint64_t leaked;
+    uint64_t simFailures;
+    size_t maxSize;
+} siteStats_t;
+
+// What happened during a mode, over every time it was entered
+typedef struct
+{
+    const char* name;
+    uint32_t visits;
+    uint64_t frames;
+    uint64_t allocs;
+    uint64_t frees;
+    uint64_t bytes;
+    uint64_t sameFrameFrees;
+    uint64_t freedLifetimeFrames; //!< Summed over every allocation freed
+    uint32_t maxAllocsInFrame;
+    size_t liveAtEntry;           //!< When it was last entered
+    size_t peakLive;
+    size_t peakSimUsed;
+    uint32_t worstFragPermille;
+    size_t worstFragLargest;
+    size_t worstFragFree;
+    uint64_t simFailures;
+    uint64_t leaked;
+    uint64_t leakedBytes;
+    siteStats_t* sites;
+    uint32_t sitesCap;
+} modeStats_t;
+
+// A free span of the simulated heap
+typedef struct
+{
+    size_t off;
+    size_t len;
+} simSpan_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void traceAdd(void* ptr, size_t size, const char* file, int line);
+static bool traceRemove(void* ptr, traceAlloc_t* removed);
+static uint32_t findSite(const char* file, int line);
+static siteStats_t* siteStats(modeStats_t* mode, uint32_t site);
+static uint32_t findMode(const char* name);
+static void finishMode(void);
+static void writeModeReport(FILE* f, modeStats_t* mode);
+static int64_t simAlloc(size_t len);
+static void simFree(size_t off, size_t len);
+static void simSample(modeStats_t* mode);
+static size_t ptrHash(const void* ptr);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static pthread_mutex_t traceMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Live allocations, open addressed by pointer. The capacity is a power of two
+static traceAlloc_t* allocs = NULL;
+static size_t allocsCap = 0;
+static size_t numAllocs = 0;
+static size_t liveBytes = 0;
+
+// Call sites, open addressed by file and line
+static traceSite_t* sites = NULL;
+static uint32_t* siteIndex = NULL;
+static uint32_t sitesCap = 0;
+static uint32_t numSites = 0;
+
+static modeStats_t* modes = NULL;
+static uint32_t numModes = 0;
+static uint32_t curMode = 0;
+
+static uint64_t frameNum = 0;
+static uint32_t allocsThisFrame = 0;
+
+// Free spans of the simulated heap, sorted by offset
+static simSpan_t* simFree_ = NULL;
+static uint32_t simNumFree = 0;
+static uint32_t simFreeCap = 0;
+static size_t simUsed = 0;
+
+static bool traceInitialized = false;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Set up the tracer the first time it's used. traceMutex must be held
+ */
+static void traceInit(void)
+{
+    if(traceInitialized)
+    {
+        return;
+    }
+    traceInitialized = true;
+
+    simFreeCap = 64;
+    simFree_ = malloc(simFreeCap * sizeof(simSpan_t));
+    simFree_[0].off = 0;
+    simFree_[0].len = SIM_HEAP_SIZE;
+    simNumFree = 1;
+
+    // Anything before the first mode is entered is startup
+    curMode = findMode("Startup");
+    modes[curMode].visits = 1;
+
+    // Start a fresh report
+    FILE* f = fopen(REPORT_FILE, "w");
+    if(NULL != f)
+    {
+        fprintf(f, "Allocation report, simulated heap of %u bytes, %d byte headers, %d byte alignment\n",
+                (uint32_t)SIM_HEAP_SIZE, SIM_HDR_SIZE, SIM_ALIGN);
+        fclose(f);
+    }
+}
+
+/**
+ * @brief Traced malloc()
+ */
+void* emuTraceMalloc(size_t size, const char* file, int line)
+{
+    void* ptr = malloc(size);
+    if(NULL != ptr)
+    {
+        traceAdd(ptr, size, file, line);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Traced calloc()
+ */
+void* emuTraceCalloc(size_t nmemb, size_t size, const char* file, int line)
+{
+    void* ptr = calloc(nmemb, size);
+    if(NULL != ptr)
+    {
+        traceAdd(ptr, nmemb * size, file, line);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Traced realloc(). This is counted as a free and a new allocation,
+ * which is what it usually is on a fragmented heap
+ */
+void* emuTraceRealloc(void* ptr, size_t size, const char* file, int line)
+{
+    if(NULL == ptr)
+    {
+        return emuTraceMalloc(size, file, line);
+    }
+
+    // Stop tracking the old pointer first, another thread may be handed the
+    // same address as soon as it's reallocated
+    traceAlloc_t old;
+    bool tracked = traceRemove(ptr, &old);
+
+    void* newPtr = realloc(ptr, size);
+    if(NULL != newPtr)
+    {
+        traceAdd(newPtr, size, file, line);
+    }
+    else if(tracked && 0 != size)
+    {
+        // The old allocation is still there
+        traceAdd(ptr, old.size, file, line);
+    }
+    return newPtr;
+}
+
+/**
+ * @brief Traced strdup()
+ */
+char* emuTraceStrdup(const char* str, const char* file, int line)
+{
+    char* copy = strdup(str);
+    if(NULL != copy)
+    {
+        traceAdd(copy, strlen(str) + 1, file, line);
+    }
+    return copy;
+}
+
+/**
+ * @brief Traced free(). Pointers which weren't traced, like ones from libc,
+ * are freed without being counted
+ */
+void emuTraceFree(void* ptr)
+{
+    if(NULL != ptr)
+    {
+        traceRemove(ptr, NULL);
+        free(ptr);
+    }
+}
+
+/**
+ * @brief Note that a frame was drawn. This samples the simulated heap's
+ * fragmentation and starts counting allocations for the next frame
+ */
+void emuAllocTraceFrame(void)
+{
+    pthread_mutex_lock(&traceMutex);
+    traceInit();
+
+    modeStats_t* mode = &modes[curMode];
+    mode->frames++;
+    if(allocsThisFrame > mode->maxAllocsInFrame)
+    {
+        mode->maxAllocsInFrame = allocsThisFrame;
+    }
+    allocsThisFrame = 0;
+    frameNum++;
+    simSample(mode);
+
+    pthread_mutex_unlock(&traceMutex);
+}
+
+/**
+ * @brief Note that a mode is about to be entered. The report for the mode
+ * being left is written, and following allocations count towards this mode
+ *
+ * @param modeName The name of the mode being entered
+ */
+void emuAllocTraceSetMode(const char* modeName)
+{
+    pthread_mutex_lock(&traceMutex);
+    traceInit();
+
+    finishMode();
+    curMode = findMode(modeName);
+    modes[curMode].visits++;
+    modes[curMode].liveAtEntry = liveBytes;
+    allocsThisFrame = 0;
+
+    pthread_mutex_unlock(&traceMutex);
+}
+
+/**
+ * @brief Write the report for the current mode, then a summary of every mode.
+ * Call this after the swadge task has stopped
+ */
+void emuAllocTraceDeinit(void)
+{
+    pthread_mutex_lock(&traceMutex);
+    if(traceInitialized)
+    {
+        finishMode();
+
+        FILE* f = fopen(REPORT_FILE, "a");
+        if(NULL != f)
+        {
+            fprintf(f, "\nSummary\n");
+            fprintf(f, "%-20s %10s %10s %10s %8s %8s %8s\n", "mode", "peak live", "peak heap", "allocs/fr",
+                    "max/fr", "frag %", "fail");
+            for(uint32_t i = 0; i < numModes; i++)
+            {
+                modeStats_t* m = &modes[i];
+                fprintf(f, "%-20s %10u %10u %10.1f %8u %8.1f %8" PRIu64 "\n", m->name, (uint32_t)m->peakLive,
+                        (uint32_t)m->peakSimUsed, m->frames ? (double)m->allocs / m->frames : 0.0,
+                        m->maxAllocsInFrame, m->worstFragPermille / 10.0, m->simFailures);
+            }
+            fclose(f);
+            ESP_LOGI("ALLOC", "Wrote %s", REPORT_FILE);
+        }
+    }
+    pthread_mutex_unlock(&traceMutex);
+}
+
+/**
+ * @brief Start tracking an allocation
+ *
+ * @param ptr The allocated memory
+ * @param size The size asked for
+ * @param file The file it was allocated from
+ * @param line The line it was allocated from
+ */
+static void traceAdd(void* ptr, size_t size, const char* file, int line)
+{
+    pthread_mutex_lock(&traceMutex);
+    traceInit();
+
+    // Keep the table at most half full
+    if((numAllocs + 1) * 2 > allocsCap)
+    {
+        size_t oldCap = allocsCap;
+        traceAlloc_t* old = allocs;
+        allocsCap = oldCap ? (oldCap * 2) : 4096;
+        allocs = calloc(allocsCap, sizeof(traceAlloc_t));
+        for(size_t i = 0; i < oldCap; i++)
+        {
+            if(NULL != old[i].ptr)
+            {
+                size_t slot = ptrHash(old[i].ptr) & (allocsCap - 1);
+                while(NULL != allocs[slot].ptr)
+                {
+                    slot = (slot + 1) & (allocsCap - 1);
+                }
+                allocs[slot] = old[i];
+            }
+        }
+        free(old);
+    }
+
+    modeStats_t* mode = &modes[curMode];
+    uint32_t site = findSite(file, line);
+    siteStats_t* ss = siteStats(mode, site);
+
+    size_t slot = ptrHash(ptr) & (allocsCap - 1);
+    while(NULL != allocs[slot].ptr)
+    {
+        slot = (slot + 1) & (allocsCap - 1);
+    }
+    traceAlloc_t* a = &allocs[slot];
+    a->ptr = ptr;
+    a->size = size;
+    a->site = site;
+    a->mode = curMode;
+    a->frame = frameNum;
+
+    // Place it in the simulated heap too
+    a->simLen = ((size + SIM_ALIGN - 1) & ~((size_t)SIM_ALIGN - 1)) + SIM_HDR_SIZE;
+    if(a->simLen < SIM_MIN_BLOCK)
+    {
+        a->simLen = SIM_MIN_BLOCK;
+    }
+    a->simOff = simAlloc(a->simLen);
+    if(a->simOff < 0)
+    {
+        mode->simFailures++;
+        ss->simFailures++;
+    }
+    numAllocs++;
+
+    liveBytes += size;
+    allocsThisFrame++;
+    mode->allocs++;
+    mode->bytes += size;
+    if(liveBytes > mode->peakLive)
+    {
+        mode->peakLive = liveBytes;
+    }
+    if(simUsed > mode->peakSimUsed)
+    {
+        mode->peakSimUsed = simUsed;
+    }
+    ss->allocs++;
+    ss->bytes += size;
+    if(size > ss->maxSize)
+    {
+        ss->maxSize = size;
+    }
+
+    pthread_mutex_unlock(&traceMutex);
+}
+
+/**
+ * @brief Stop tracking an allocation
+ *
+ * @param ptr The memory being freed
+ * @param removed If not NULL, the allocation is returned here
+ * @return true if the allocation was being tracked, false if it wasn't
+ */
+static bool traceRemove(void* ptr, traceAlloc_t* removed)
+{
+    pthread_mutex_lock(&traceMutex);
+    if(0 == allocsCap)
+    {
+        pthread_mutex_unlock(&traceMutex);
+        return false;
+    }
+
+    size_t mask = allocsCap - 1;
+    size_t slot = ptrHash(ptr) & mask;
+    while(NULL != allocs[slot].ptr && ptr != allocs[slot].ptr)
+    {
+        slot = (slot + 1) & mask;
+    }
+    if(NULL == allocs[slot].ptr)
+    {
+        pthread_mutex_unlock(&traceMutex);
+        return false;
+    }
+
+    traceAlloc_t a = allocs[slot];
+    if(NULL != removed)
+    {
+        *removed = a;
+    }
+
+    // Count the free against the mode it happens in, and short lived
+    // allocations against the site that made them
+    modeStats_t* mode = &modes[curMode];
+    mode->frees++;
+    mode->freedLifetimeFrames += frameNum - a.frame;
+    if(frameNum == a.frame && a.mode == curMode)
+    {
+        mode->sameFrameFrees++;
+        siteStats(mode, a.site)->sameFrameFrees++;
+    }
+    liveBytes -= a.size;
+    if(a.simOff >= 0)
+    {
+        simFree(a.simOff, a.simLen);
+    }
+
+    // Remove it, shifting back any entries which probed past this slot
+    allocs[slot].ptr = NULL;
+    numAllocs--;
+    size_t next = (slot + 1) & mask;
+    while(NULL != allocs[next].ptr)
+    {
+        size_t home = ptrHash(allocs[next].ptr) & mask;
+        // If the entry's home isn't cyclically in (slot, next], move it
+        if((slot <= next) ? ((home <= slot) || (home > next)) : ((home <= slot) && (home > next)))
+        {
+            allocs[slot] = allocs[next];
+            allocs[next].ptr = NULL;
+            slot = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    pthread_mutex_unlock(&traceMutex);
+    return true;
+}
+
+/**
+ * @brief Find a call site, adding it if it's new. traceMutex must be held
+ *
+ * @param file The file
+ * @param line The line
+ * @return The site's index
+ */
+static uint32_t findSite(const char* file, int line)
+{
+    // Keep the index at most half full
+    if((numSites + 1) * 2 > sitesCap)
+    {
+        uint32_t newCap = sitesCap ? (sitesCap * 2) : 1024;
+        sites = realloc(sites, newCap * sizeof(traceSite_t));
+        free(siteIndex);
+        siteIndex = malloc(newCap * sizeof(uint32_t));
+        memset(siteIndex, 0xFF, newCap * sizeof(uint32_t));
+        for(uint32_t i = 0; i < numSites; i++)
+        {
+            uint32_t slot = (ptrHash(sites[i].file) + sites[i].line) & (newCap - 1);
+            while(UINT32_MAX != siteIndex[slot])
+            {
+                slot = (slot + 1) & (newCap - 1);
+            }
+            siteIndex[slot] = i;
+        }
+        sitesCap = newCap;
+    }
+
+    uint32_t slot = (ptrHash(file) + line) & (sitesCap - 1);
+    while(UINT32_MAX != siteIndex[slot])
+    {
+        traceSite_t* s = &sites[siteIndex[slot]];
+        if(s->file == file && s->line == line)
+        {
+            return siteIndex[slot];
+        }
+        slot = (slot + 1) & (sitesCap - 1);
+    }
+
+    sites[numSites].file = file;
+    sites[numSites].line = line;
+    siteIndex[slot] = numSites;
+    return numSites++;
+}
+
+/**
+ * @brief Get a site's stats for a mode, growing the mode's table if needed.
+ * traceMutex must be held
+ *
+ * @param mode The mode
+ * @param site The site's index
+ * @return The site's stats for this mode
+ */
+static siteStats_t* siteStats(modeStats_t* mode, uint32_t site)
+{
+    if(site >= mode->sitesCap)
+    {
+        uint32_t newCap = mode->sitesCap ? mode->sitesCap : 256;
+        while(newCap <= site)
+        {
+            newCap *= 2;
+        }
+        mode->sites = realloc(mode->sites, newCap * sizeof(siteStats_t));
+        memset(&mode->sites[mode->sitesCap], 0, (newCap - mode->sitesCap) * sizeof(siteStats_t));
+        mode->sitesCap = newCap;
+    }
+    return &mode->sites[site];
+}
+
+/**
+ * @brief Find a mode by name, adding it if it's new. traceMutex must be held
+ *
+ * @param name The mode's name
+ * @return The mode's index
+ */
+static uint32_t findMode(const char* name)
+{
+    for(uint32_t i = 0; i < numModes; i++)
+    {
+        if(0 == strcmp(modes[i].name, name))
+        {
+            return i;
+        }
+    }
+    modes = realloc(modes, (numModes + 1) * sizeof(modeStats_t));
+    memset(&modes[numModes], 0, sizeof(modeStats_t));
+    modes[numModes].name = name;
+    modes[numModes].worstFragLargest = SIM_HEAP_SIZE;
+    modes[numModes].worstFragFree = SIM_HEAP_SIZE;
+    return numModes++;
+}
+
+/**
+ * @brief Count what the current mode left allocated, then append its report.
+ * traceMutex must be held
+ */
+static void finishMode(void)
+{
+    modeStats_t* mode = &modes[curMode];
+    if(allocsThisFrame > mode->maxAllocsInFrame)
+    {
+        mode->maxAllocsInFrame = allocsThisFrame;
+    }
+
+    // Anything this mode allocated which is still around was leaked, or
+    // handed off to something which outlives the mode
+    mode->leaked = 0;
+    mode->leakedBytes = 0;
+    for(uint32_t i = 0; i < mode->sitesCap; i++)
+    {
+        mode->sites[i].leaked = 0;
+    }
+    for(size_t i = 0; i < allocsCap; i++)
+    {
+        if(NULL != allocs[i].ptr && curMode == allocs[i].mode)
+        {
+            mode->leaked++;
+            mode->leakedBytes += allocs[i].size;
+            siteStats(mode, allocs[i].site)->leaked++;
+        }
+    }
+
+    FILE* f = fopen(REPORT_FILE, "a");
+    if(NULL != f)
+    {
+        writeModeReport(f, mode);
+        fclose(f);
+    }
+
+    ESP_LOGI("ALLOC", "%s: peak %u bytes live, %.1f allocs/frame, %.1f%% worst fragmentation, %" PRIu64
+             " would fail", mode->name, (uint32_t)mode->peakLive,
+             mode->frames ? (double)mode->allocs / mode->frames : 0.0, mode->worstFragPermille / 10.0,
+             mode->simFailures);
+}
+
+/**
+ * @brief Write one mode's report. traceMutex must be held
+ *
+ * @param f The file to write to
+ * @param mode The mode to write about
+ */
+static void writeModeReport(FILE* f, modeStats_t* mode)
+{
+    fprintf(f, "\n=== %s (visit %u, %" PRIu64 " frames in total) ===\n", mode->name, mode->visits, mode->frames);
+    fprintf(f, "Live at entry          %10u bytes\n", (uint32_t)mode->liveAtEntry);
+    fprintf(f, "Peak live              %10u bytes\n", (uint32_t)mode->peakLive);
+    fprintf(f, "Peak simulated heap    %10u bytes, %.1f%% of %u\n", (uint32_t)mode->peakSimUsed,
+            (100.0 * mode->peakSimUsed) / SIM_HEAP_SIZE, (uint32_t)SIM_HEAP_SIZE);
+    fprintf(f, "Worst fragmentation    %10.1f%%, largest free block %u of %u free bytes\n",
+            mode->worstFragPermille / 10.0, (uint32_t)mode->worstFragLargest, (uint32_t)mode->worstFragFree);
+    fprintf(f, "Would fail on device   %10" PRIu64 " allocations\n", mode->simFailures);
+    fprintf(f, "Allocations            %10" PRIu64 ", %" PRIu64 " bytes\n", mode->allocs, mode->bytes);
+    fprintf(f, "Per frame              %10.2f average, %u max\n",
+            mode->frames ? (double)mode->allocs / mode->frames : 0.0, mode->maxAllocsInFrame);
+    fprintf(f, "Freed the same frame   %10" PRIu64 "\n", mode->sameFrameFrees);
+    fprintf(f, "Average lifetime       %10.1f frames\n",
+            mode->frees ? (double)mode->freedLifetimeFrames / mode->frees : 0.0);
+    fprintf(f, "Still allocated at exit%10" PRIu64 ", %" PRIu64 " bytes\n", mode->leaked, mode->leakedBytes);
+
+    // List the busiest sites, by number of allocations
+    fprintf(f, "%10s %10s %8s %10s %8s %6s  %s\n", "allocs", "bytes", "max", "same frame", "at exit", "fail",
+            "site");
+    bool* listed = calloc(mode->sitesCap ? mode->sitesCap : 1, sizeof(bool));
+    for(uint32_t n = 0; n < REPORT_TOP_SITES; n++)
+    {
+        uint32_t best = UINT32_MAX;
+        for(uint32_t i = 0; i < mode->sitesCap && i < numSites; i++)
+        {
+            if(!listed[i] && mode->sites[i].allocs &&
+                    (UINT32_MAX == best || mode->sites[i].allocs > mode->sites[best].allocs))
+            {
+                best = i;
+            }
+        }
+        if(UINT32_MAX == best)
+        {
+            break;
+        }
+        listed[best] = true;
+        siteStats_t* ss = &mode->sites[best];
+        fprintf(f, "%10" PRIu64 " %10" PRIu64 " %8u %10" PRIu64 " %8" PRIu64 " %6" PRIu64 "  %s:%d\n", ss->allocs,
+                ss->bytes, (uint32_t)ss->maxSize, ss->sameFrameFrees, ss->leaked, ss->simFailures,
+                sites[best].file, sites[best].line);
+    }
+    free(listed);
+}
+
+/**
+ * @brief First fit allocation from the simulated heap. traceMutex must be held
+ *
+ * @param len The block size, including the header
+ * @return The block's offset, or -1 if no free span is large enough
+ */
+static int64_t simAlloc(size_t len)
+{
+    for(uint32_t i = 0; i < simNumFree; i++)
+    {
+        if(simFree_[i].len >= len)
+        {
+            size_t off = simFree_[i].off;
+            simFree_[i].off += len;
+            simFree_[i].len -= len;
+            if(0 == simFree_[i].len)
+            {
+                memmove(&simFree_[i], &simFree_[i + 1], (simNumFree - i - 1) * sizeof(simSpan_t));
+                simNumFree--;
+            }
+            simUsed += len;
+            return off;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Return a block to the simulated heap, merging it with its neighbors.
+ * traceMutex must be held
+ *
+ * @param off The block's offset
+ * @param len The block's size
+ */
+static void simFree(size_t off, size_t len)
+{
+    simUsed -= len;
+
+    // Find the first span after this block
+    uint32_t lo = 0, hi = simNumFree;
+    while(lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2;
+        if(simFree_[mid].off < off)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    bool mergePrev = (lo > 0) && (simFree_[lo - 1].off + simFree_[lo - 1].len == off);
+    bool mergeNext = (lo < simNumFree) && (off + len == simFree_[lo].off);
+    if(mergePrev && mergeNext)
+    {
+        simFree_[lo - 1].len += len + simFree_[lo].len;
+        memmove(&simFree_[lo], &simFree_[lo + 1], (simNumFree - lo - 1) * sizeof(simSpan_t));
+        simNumFree--;
+    }
+    else if(mergePrev)
+    {
+        simFree_[lo - 1].len += len;
+    }
+    else if(mergeNext)
+    {
+        simFree_[lo].off = off;
+        simFree_[lo].len += len;
+    }
+    else
+    {
+        if(simNumFree == simFreeCap)
+        {
+            simFreeCap *= 2;
+            simFree_ = realloc(simFree_, simFreeCap * sizeof(simSpan_t));
+        }
+        memmove(&simFree_[lo + 1], &simFree_[lo], (simNumFree - lo) * sizeof(simSpan_t));
+        simFree_[lo].off = off;
+        simFree_[lo].len = len;
+        simNumFree++;
+    }
+}
+
+/**
+ * @brief Measure the simulated heap's fragmentation, as how much of the free
+ * memory isn't in the largest free block. traceMutex must be held
+ *
+ * @param mode The mode to record the worst fragmentation in
+ */
+static void simSample(modeStats_t* mode)
+{
+    size_t largest = 0;
+    size_t total = 0;
+    for(uint32_t i = 0; i < simNumFree; i++)
+    {
+        total += simFree_[i].len;
+        if(simFree_[i].len > largest)
+        {
+            largest = simFree_[i].len;
+        }
+    }
+
+    uint32_t fragPermille = total ? (uint32_t)(1000 - ((1000 * (uint64_t)largest) / total)) : 0;
+    if(fragPermille > mode->worstFragPermille)
+    {
+        mode->worstFragPermille = fragPermille;
+        mode->worstFragLargest = largest;
+        mode->worstFragFree = total;
+    }
+}
+
+/**
+ * @brief Hash a pointer
+ *
+ * @param ptr The pointer
+ * @return The hash
+ */
+static size_t ptrHash(const void* ptr)
+{
+    uint64_t x = (uintptr_t)ptr;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+#endif
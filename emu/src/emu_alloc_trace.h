@@ -0,0 +1,48 @@
+#ifndef _EMU_ALLOC_TRACE_H_
+#define _EMU_ALLOC_TRACE_H_
+
+/**
+ * Allocation tracer for the emulator. Build with `make -f emu.mk ALLOC_TRACE=1`
+ * and this header is force-included in every source file, so malloc(),
+ * calloc(), realloc(), strdup() and free() go through the tracer with the
+ * file and line of each call.
+ *
+ * Every allocation is also placed in a simulated ESP32-S2 heap, so a
+ * fragmentation estimate can be made. When leaving a mode, and on exit, a
+ * report for it is appended to alloc_report.txt
+ */
+
+// This is included before anything else, so feature test macros which files
+// would set for themselves have to be set here
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+// Declare everything which will be replaced before the macros exist
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#if !defined(__APPLE__)
+    #include <malloc.h>
+#endif
+
+void* emuTraceMalloc(size_t size, const char* file, int line);
+void* emuTraceCalloc(size_t nmemb, size_t size, const char* file, int line);
+void* emuTraceRealloc(void* ptr, size_t size, const char* file, int line);
+char* emuTraceStrdup(const char* str, const char* file, int line);
+void emuTraceFree(void* ptr);
+
+void emuAllocTraceFrame(void);
+void emuAllocTraceSetMode(const char* modeName);
+void emuAllocTraceDeinit(void);
+
+// Route every allocation through the tracer. emu_alloc_trace.c undoes these
+// to use the real functions
+#undef strdup
+#define malloc(size)         emuTraceMalloc((size), __FILE__, __LINE__)
+#define calloc(nmemb, size)  emuTraceCalloc((nmemb), (size), __FILE__, __LINE__)
+#define realloc(ptr, size)   emuTraceRealloc((ptr), (size), __FILE__, __LINE__)
+#define strdup(str)          emuTraceStrdup((str), __FILE__, __LINE__)
+#define free(ptr)            emuTraceFree(ptr)
+
+#endif
@@ -0,0 +1,423 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "emu_display.h"
+#include "emu_capture.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// How many frames can wait to be encoded. The swadge task only waits for the
+// encoder if all of these are full
+#define CAP_SLOTS 16
+
+// A key frame every this many frames, so a damaged capture can recover
+#define CAP_KEY_INTERVAL 600
+
+#define CAP_MAX_LEDS 16
+
+// Runs shorter than this are cheaper as part of a literal. Literals end where
+// a run this long starts
+#define CAP_MIN_RUN 3
+
+#define CAP_NUM_PX (TFT_WIDTH * TFT_HEIGHT)
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+// A frame waiting to be encoded
+typedef struct
+{
+    paletteColor_t px[CAP_NUM_PX];
+    led_t leds[CAP_MAX_LEDS];
+    uint8_t numLeds;
+    int64_t timeUs;
+} capSlot_t;
+
+typedef struct
+{
+    FILE* file;
+    pthread_t writer;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    bool stop;
+
+    // The ring of frames waiting to be encoded
+    capSlot_t* slots;
+    uint32_t head;   // Written by the swadge task
+    uint32_t tail;   // Read by the writer thread
+
+    // The newest LED state, copied into each frame
+    led_t leds[CAP_MAX_LEDS];
+    uint8_t numLeds;
+
+    // Only used by the writer thread
+    paletteColor_t* prev;
+    uint8_t* encoded;
+    int64_t lastTimeUs;
+
+    // Stats
+    uint32_t numFrames;
+    uint32_t numStalls;
+    uint64_t numBytes;
+    uint64_t encodeNs;
+} emuCapture_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void* captureWriterTask(void* arg);
+static void writeFrame(const capSlot_t* slot);
+static uint8_t* putVarint(uint8_t* out, uint64_t val);
+static uint8_t* putOp(uint8_t* out, emuCaptureOp_t op, uint32_t count);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static emuCapture_t capture = {0};
+static bool capturing = false;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Start capturing every frame to a file. This must be called before the
+ * swadge starts
+ *
+ * @param fname The file to write the capture to
+ * @return true if the file was opened, false if it wasn't
+ */
+bool emuCaptureStart(const char* fname)
+{
+    capture.file = fopen(fname, "wb");
+    if(NULL == capture.file)
+    {
+        ESP_LOGE("EMU", "Couldn't open %s to capture to", fname);
+        return false;
+    }
+    setvbuf(capture.file, NULL, _IOFBF, 1 << 20);
+
+    // The header has everything needed to turn palette indices into colors
+    uint16_t numColors = sizeof(paletteColorsEmu) / sizeof(paletteColorsEmu[0]);
+    uint8_t hdr[11] =
+    {
+        CAP_MAGIC[0], CAP_MAGIC[1], CAP_MAGIC[2], CAP_MAGIC[3], CAP_VERSION,
+        TFT_WIDTH & 0xFF, TFT_WIDTH >> 8, TFT_HEIGHT & 0xFF, TFT_HEIGHT >> 8,
+        numColors & 0xFF, numColors >> 8
+    };
+    fwrite(hdr, 1, sizeof(hdr), capture.file);
+    for(uint16_t i = 0; i < numColors; i++)
+    {
+        // Palette colors are RGBA
+        uint8_t rgb[3] = {paletteColorsEmu[i] >> 24, paletteColorsEmu[i] >> 16, paletteColorsEmu[i] >> 8};
+        fwrite(rgb, 1, sizeof(rgb), capture.file);
+    }
+
+    capture.slots = malloc(CAP_SLOTS * sizeof(capSlot_t));
+    capture.prev = malloc(CAP_NUM_PX * sizeof(paletteColor_t));
+    // Worst case, every pixel is a literal, and each op header is a few bytes
+    capture.encoded = malloc(2 * CAP_NUM_PX + 64);
+    pthread_mutex_init(&capture.mutex, NULL);
+    pthread_cond_init(&capture.cond, NULL);
+    pthread_create(&capture.writer, NULL, captureWriterTask, NULL);
+
+    capturing = true;
+    return true;
+}
+
+/**
+ * @brief Encode every frame which is still waiting, close the capture, and
+ * print how it went. The swadge task must be stopped first
+ */
+void emuCaptureDeinit(void)
+{
+    if(!capturing)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&capture.mutex);
+    capture.stop = true;
+    pthread_cond_broadcast(&capture.cond);
+    pthread_mutex_unlock(&capture.mutex);
+    pthread_join(capture.writer, NULL);
+
+    fclose(capture.file);
+    printf("Captured %" PRIu32 " frames, %" PRIu64 " bytes, %.1f us to encode each, %" PRIu32 " waits for the encoder\n",
+           capture.numFrames, capture.numBytes,
+           capture.numFrames ? (capture.encodeNs / 1000.0) / capture.numFrames : 0.0, capture.numStalls);
+
+    pthread_mutex_destroy(&capture.mutex);
+    pthread_cond_destroy(&capture.cond);
+    free(capture.slots);
+    free(capture.prev);
+    free(capture.encoded);
+    memset(&capture, 0, sizeof(capture));
+    capturing = false;
+}
+
+/**
+ * @return true if frames are being captured, false if they aren't
+ */
+bool emuIsCapturing(void)
+{
+    return capturing;
+}
+
+/**
+ * @brief Queue a frame to be captured. This is called from the swadge task
+ * and only copies the frame, it's encoded and written on another thread
+ *
+ * @param frame The frame, TFT_WIDTH * TFT_HEIGHT palette indices
+ */
+void emuCaptureFrame(const paletteColor_t* frame)
+{
+    pthread_mutex_lock(&capture.mutex);
+
+    // Only wait if the encoder is a whole ring behind
+    if(capture.head - capture.tail == CAP_SLOTS)
+    {
+        capture.numStalls++;
+        while(capture.head - capture.tail == CAP_SLOTS)
+        {
+            pthread_cond_wait(&capture.cond, &capture.mutex);
+        }
+    }
+    capSlot_t* slot = &capture.slots[capture.head % CAP_SLOTS];
+    memcpy(slot->leds, capture.leds, sizeof(slot->leds));
+    slot->numLeds = capture.numLeds;
+    pthread_mutex_unlock(&capture.mutex);
+
+    // The writer doesn't touch this slot until head moves past it
+    memcpy(slot->px, frame, sizeof(slot->px));
+    slot->timeUs = esp_timer_get_time();
+
+    pthread_mutex_lock(&capture.mutex);
+    capture.head++;
+    pthread_cond_broadcast(&capture.cond);
+    pthread_mutex_unlock(&capture.mutex);
+}
+
+/**
+ * @brief Save the LED state, to be captured with the next frame
+ *
+ * @param leds The LEDs, as they're shown
+ * @param numLeds The number of LEDs
+ */
+void emuCaptureLeds(const led_t* leds, uint8_t numLeds)
+{
+    if(numLeds > CAP_MAX_LEDS)
+    {
+        numLeds = CAP_MAX_LEDS;
+    }
+    pthread_mutex_lock(&capture.mutex);
+    memcpy(capture.leds, leds, numLeds * sizeof(led_t));
+    capture.numLeds = numLeds;
+    pthread_mutex_unlock(&capture.mutex);
+}
+
+/**
+ * @brief Encode queued frames until told to stop and the queue is empty
+ *
+ * @param arg unused
+ * @return NULL
+ */
+static void* captureWriterTask(void* arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&capture.mutex);
+    while(true)
+    {
+        if(capture.head == capture.tail)
+        {
+            if(capture.stop)
+            {
+                break;
+            }
+            pthread_cond_wait(&capture.cond, &capture.mutex);
+            continue;
+        }
+
+        // Encode without holding the lock, the swadge task only waits if the
+        // ring is full
+        const capSlot_t* slot = &capture.slots[capture.tail % CAP_SLOTS];
+        pthread_mutex_unlock(&capture.mutex);
+        writeFrame(slot);
+        pthread_mutex_lock(&capture.mutex);
+
+        capture.tail++;
+        pthread_cond_broadcast(&capture.cond);
+    }
+    pthread_mutex_unlock(&capture.mutex);
+    return NULL;
+}
+
+/**
+ * @brief Encode one frame against the previous one and write it. Only called
+ * from the writer thread
+ *
+ * @param slot The frame to write
+ */
+static void writeFrame(const capSlot_t* slot)
+{
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    // Key frames are deltas against a blank frame
+    bool isKey = (0 == capture.numFrames % CAP_KEY_INTERVAL);
+    if(isKey)
+    {
+        memset(capture.prev, 0, CAP_NUM_PX * sizeof(paletteColor_t));
+    }
+    uint32_t encLen = emuCaptureEncode(slot->px, capture.prev, CAP_NUM_PX, capture.encoded);
+    memcpy(capture.prev, slot->px, CAP_NUM_PX * sizeof(paletteColor_t));
+
+    // Build the frame header
+    uint8_t hdr[1 + 10 + 1 + (3 * CAP_MAX_LEDS) + 10];
+    uint8_t* h = hdr;
+    *h++ = isKey ? CAP_KEY_FRAME : CAP_DELTA_FRAME;
+    int64_t dt = (0 == capture.numFrames) ? 0 : (slot->timeUs - capture.lastTimeUs);
+    h = putVarint(h, dt > 0 ? (uint64_t)dt : 0);
+    *h++ = slot->numLeds;
+    for(uint8_t i = 0; i < slot->numLeds; i++)
+    {
+        *h++ = slot->leds[i].r;
+        *h++ = slot->leds[i].g;
+        *h++ = slot->leds[i].b;
+    }
+    h = putVarint(h, encLen);
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    capture.encodeNs += (t1.tv_sec - t0.tv_sec) * 1000000000LL + (t1.tv_nsec - t0.tv_nsec);
+
+    fwrite(hdr, 1, h - hdr, capture.file);
+    fwrite(capture.encoded, 1, encLen, capture.file);
+
+    capture.lastTimeUs = slot->timeUs;
+    capture.numFrames++;
+    capture.numBytes += (h - hdr) + encLen;
+}
+
+/**
+ * @brief Encode a frame as pixel ops against the previous frame. Pixels which
+ * didn't change are skipped, runs of one color are stored once, and anything
+ * else is stored as is
+ *
+ * @param cur The frame to encode
+ * @param prev The previous frame
+ * @param numPx The number of pixels in each frame
+ * @param out Where to write the ops, at least 2 * numPx + 64 bytes
+ * @return The number of bytes written to out
+ */
+uint32_t emuCaptureEncode(const paletteColor_t* cur, const paletteColor_t* prev, uint32_t numPx, uint8_t* out)
+{
+    uint8_t* o = out;
+    uint32_t i = 0;
+    while(i < numPx)
+    {
+        uint32_t j = i;
+        if(cur[i] == prev[i])
+        {
+            // Skip unchanged pixels, eight at a time when possible
+            while(j + 8 <= numPx)
+            {
+                uint64_t a, b;
+                memcpy(&a, &cur[j], sizeof(a));
+                memcpy(&b, &prev[j], sizeof(b));
+                if(a != b)
+                {
+                    break;
+                }
+                j += 8;
+            }
+            while(j < numPx && cur[j] == prev[j])
+            {
+                j++;
+            }
+            o = putOp(o, CAP_OP_SKIP, j - i);
+        }
+        else
+        {
+            while(j < numPx && cur[j] == cur[i])
+            {
+                j++;
+            }
+
+            if(j - i >= CAP_MIN_RUN)
+            {
+                o = putOp(o, CAP_OP_RUN, j - i);
+                *o++ = cur[i];
+            }
+            else
+            {
+                // Take pixels until two unchanged ones or a run start
+                j = i + 1;
+                while(j < numPx)
+                {
+                    if(j + 1 < numPx && cur[j] == prev[j] && cur[j + 1] == prev[j + 1])
+                    {
+                        break;
+                    }
+                    if(j + 2 < numPx && cur[j] == cur[j + 1] && cur[j] == cur[j + 2])
+                    {
+                        break;
+                    }
+                    j++;
+                }
+                o = putOp(o, CAP_OP_LITERAL, j - i);
+                memcpy(o, &cur[i], j - i);
+                o += j - i;
+            }
+        }
+        i = j;
+    }
+    return o - out;
+}
+
+/**
+ * @brief Write an unsigned LEB128 varint
+ *
+ * @param out Where to write the varint
+ * @param val The value to write
+ * @return The position after the varint
+ */
+static uint8_t* putVarint(uint8_t* out, uint64_t val)
+{
+    do
+    {
+        uint8_t byte = val & 0x7F;
+        val >>= 7;
+        *out++ = byte | (val ? 0x80 : 0);
+    } while(val);
+    return out;
+}
+
+/**
+ * @brief Write a pixel op's header
+ *
+ * @param out Where to write the header
+ * @param op The op
+ * @param count How many pixels the op covers
+ * @return The position after the header
+ */
+static uint8_t* putOp(uint8_t* out, emuCaptureOp_t op, uint32_t count)
+{
+    return putVarint(out, ((uint64_t)count << 2) | op);
+}
@@ -0,0 +1,53 @@
+#ifndef _EMU_CAPTURE_H_
+#define _EMU_CAPTURE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "led_util.h"
+#include "palette.h"
+
+/**
+ * Frame captures are a stream of every frame the swadge drew. tools/capture_convert
+ * turns them into PNG sequences or GIFs.
+ *
+ * A capture starts with "SWCP", a version byte, the width and height as
+ * little endian uint16_t, the number of palette colors as a uint16_t, then
+ * each palette color as three bytes, red, green and blue.
+ *
+ * Then each frame is:
+ *   - A type byte, CAP_KEY_FRAME or CAP_DELTA_FRAME
+ *   - The time since the previous frame in microseconds, as a LEB128 varint
+ *   - The number of LEDs as one byte, then each LED as red, green and blue
+ *   - The length of the pixel ops as a varint, then the pixel ops
+ *
+ * Pixel ops are applied to the previous frame in order, starting at the top
+ * left. A key frame's previous frame is all palette index zero. Each op
+ * starts with a varint of (count << 2) | op. A CAP_OP_SKIP keeps count pixels,
+ * a CAP_OP_RUN is followed by one palette index which is repeated count
+ * times, and a CAP_OP_LITERAL is followed by count palette indices
+ */
+
+#define CAP_MAGIC   "SWCP"
+#define CAP_VERSION 1
+
+#define CAP_KEY_FRAME   'K'
+#define CAP_DELTA_FRAME 'D'
+
+typedef enum
+{
+    CAP_OP_SKIP    = 0,
+    CAP_OP_RUN     = 1,
+    CAP_OP_LITERAL = 2,
+} emuCaptureOp_t;
+
+bool emuCaptureStart(const char* fname);
+void emuCaptureDeinit(void);
+bool emuIsCapturing(void);
+
+void emuCaptureFrame(const paletteColor_t* frame);
+void emuCaptureLeds(const led_t* leds, uint8_t numLeds);
+
+uint32_t emuCaptureEncode(const paletteColor_t* cur, const paletteColor_t* prev, uint32_t numPx, uint8_t* out);
+
+#endif
@@ -5,7 +5,6 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <pthread.h>
 
 #include "gpio_types.h"
 #include "hal/spi_types.h"
@@ -15,9 +14,16 @@
 #include "emu_esp.h"
 #include "display.h"
 #include "emu_display.h"
+#include "emu_scale.h"
+#include "emu_sound.h"
 
 #include "hdw-tft.h"
 #include "ssd1306.h"
+#include "emu_capture.h"
+
+#if defined(EMU_ALLOC_TRACE)
+    #include "emu_alloc_trace.h"
+#endif
 
 //==============================================================================
 // Palette
@@ -243,21 +249,57 @@ uint32_t paletteColorsEmu[216] =
     0xFFFFFFFF,
 };
 
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * A lock free triple buffer index set. The producer fills the back slot, then
+ * swaps it with the middle one. The consumer swaps the middle slot with its
+ * front one when there is something new. Neither side ever waits.
+ */
+typedef struct
+{
+    uint8_t back;   //!< The slot the producer is filling. Only touched by the producer
+    uint8_t middle; //!< The last published slot, with TB_FRESH set if it's unseen. Swapped atomically
+    uint8_t front;  //!< The slot the consumer is reading. Only touched by the consumer
+} tripleBuffer_t;
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+#define TB_FRESH 0x04
+#define TB_IDX   0x03
+
 //==============================================================================
 // Variables
 //==============================================================================
 
-// Display memory
+// The framebuffer the swadge draws to. Only touched by the swadge task
 paletteColor_t * frameBuffer = NULL;
+
+// Finished frames, handed from the swadge task to rawdraw
+paletteColor_t frameSlots[3][TFT_WIDTH * TFT_HEIGHT];
+tripleBuffer_t frameTb = {.back = 0, .middle = 1, .front = 2};
+
+// Frame pacing counters, written by the swadge task
+uint32_t framesProduced = 0;
+uint32_t framesDropped = 0;
+// Written by rawdraw
+uint32_t framesPresented = 0;
+
+// The scaled display rawdraw draws. Only touched by rawdraw
 uint32_t * scaledBitmapDisplay = NULL; //0xRRGGBBAA
 int bitmapWidth = 0;
 int bitmapHeight = 0;
-int displayMult = 1;
-pthread_mutex_t displayMutex = PTHREAD_MUTEX_INITIALIZER;
+emuScaler_t displayScaler = {0};
+bool scaledBitmapStale = true;
 
-// LED state
+// LED state, handed from the swadge task to rawdraw the same way as frames
 uint8_t rdNumLeds = 0;
-led_t * rdLeds = NULL;
+led_t * rdLeds = NULL; // Three slots of rdNumLeds
+tripleBuffer_t ledTb = {.back = 0, .middle = 1, .front = 2};
 uint8_t ledBrightness = 0;
 
 //==============================================================================
@@ -274,50 +316,68 @@ paletteColor_t emuGetPxOled(int16_t x, int16_t y);
 void emuClearPxOled(void);
 void emuDrawDisplayOled(bool drawDiff);
 
+static bool tbPublish(tripleBuffer_t * tb);
+static bool tbAcquire(tripleBuffer_t * tb);
+
 //==============================================================================
 // Functions
 //==============================================================================
 
 /**
- * @brief Lock the mutex that guards memory used by rawdraw on the main thread
- * and the swadge on a different thread
+ * @brief Publish the producer's back slot and take a new one to fill
+ *
+ * @param tb The triple buffer
+ * @return true if the previously published slot was never seen, i.e. dropped
  */
-void lockDisplayMemoryMutex(void)
+static bool tbPublish(tripleBuffer_t * tb)
 {
-    pthread_mutex_lock(&displayMutex);
+    uint8_t old = __atomic_exchange_n(&tb->middle, tb->back | TB_FRESH, __ATOMIC_ACQ_REL);
+    tb->back = old & TB_IDX;
+    return (old & TB_FRESH);
 }
 
 /**
- * @brief Unlock the mutex that guards memory used by rawdraw on the main thread
- * and the swadge on a different thread
+ * @brief Take the newest published slot as the consumer's front slot, if
+ * there is one
+ *
+ * @param tb The triple buffer
+ * @return true if the front slot changed, false if nothing new was published
  */
-void unlockDisplayMemoryMutex(void)
+static bool tbAcquire(tripleBuffer_t * tb)
 {
-    pthread_mutex_unlock(&displayMutex);
+    if(!(__atomic_load_n(&tb->middle, __ATOMIC_ACQUIRE) & TB_FRESH))
+    {
+        return false;
+    }
+    uint8_t old = __atomic_exchange_n(&tb->middle, tb->front, __ATOMIC_ACQ_REL);
+    tb->front = old & TB_IDX;
+    return true;
 }
 
 /**
- * Set a multiplier to draw the TFT to the window at
+ * Set the size to draw the TFT to the window at. It doesn't need to be a whole
+ * multiple of the TFT size. This must only be called from the rawdraw thread
  *
- * @param multiplier The multipler for the display, no less than 1
+ * @param width The width of the scaled display, no less than 1
+ * @param height The height of the scaled display, no less than 1
  */
-void setDisplayBitmapMultiplier(uint8_t multiplier)
+void setDisplayBitmapSize(uint16_t width, uint16_t height)
 {
-    lockDisplayMemoryMutex();
-
-    displayMult = multiplier;
-
-    // Reallocate scaledBitmapDisplay
+    // Reallocate scaledBitmapDisplay and the scaler for the new size
     free(scaledBitmapDisplay);
-    scaledBitmapDisplay = calloc((multiplier * TFT_WIDTH) * (multiplier * TFT_HEIGHT),
-        sizeof(uint32_t));
-
-    unlockDisplayMemoryMutex();
+    scaledBitmapDisplay = calloc(width * height, sizeof(uint32_t));
+    emuScalerDeinit(&displayScaler);
+    emuScalerInit(&displayScaler, TFT_WIDTH, TFT_HEIGHT, width, height);
+    bitmapWidth = width;
+    bitmapHeight = height;
+
+    // Redraw the current frame at the new size
+    scaledBitmapStale = true;
 }
 
 /**
- * @brief Get a pointer to the display memory. This access must be guarded by
- * lockDisplayMemoryMutex() and unlockDisplayMemoryMutex()
+ * @brief Get the newest frame, scaled for display. This must only be called
+ * from the rawdraw thread. It never waits on the swadge task
  *
  * @param width A pointer to return the width of the display through
  * @param height A pointer to return the height of the display through
@@ -325,30 +385,68 @@ void setDisplayBitmapMultiplier(uint8_t multiplier)
  */
 uint32_t * getDisplayBitmap(uint16_t * width, uint16_t * height)
 {
-    *width = (bitmapWidth * displayMult);
-    *height = (bitmapHeight * displayMult);
+    // Pick up a new frame, if there is one
+    if(tbAcquire(&frameTb))
+    {
+        __atomic_fetch_add(&framesPresented, 1, __ATOMIC_RELAXED);
+        scaledBitmapStale = true;
+    }
+
+    // Scale and convert the frame only when something changed
+    if(scaledBitmapStale && (NULL != scaledBitmapDisplay))
+    {
+        scaledBitmapStale = false;
+        emuScaleFrame(&displayScaler, frameSlots[frameTb.front], paletteColorsEmu, scaledBitmapDisplay);
+    }
+
+    *width = bitmapWidth;
+    *height = bitmapHeight;
     return scaledBitmapDisplay;
 }
 
 /**
- * @brief Get a pointer to the LED memory. This access must be guarded by
- * lockDisplayMemoryMutex() and unlockDisplayMemoryMutex()
+ * @brief Get the frame pacing counters. Frames are produced by each
+ * drawDisplay() call, presented when rawdraw picks them up, and dropped when
+ * a newer frame replaces one rawdraw never picked up
+ *
+ * @param produced A pointer to return the number of frames produced through
+ * @param presented A pointer to return the number of frames presented through
+ * @param dropped A pointer to return the number of frames dropped through
+ */
+void getDisplayFrameCounts(uint32_t * produced, uint32_t * presented, uint32_t * dropped)
+{
+    *produced = __atomic_load_n(&framesProduced, __ATOMIC_RELAXED);
+    *presented = __atomic_load_n(&framesPresented, __ATOMIC_RELAXED);
+    *dropped = __atomic_load_n(&framesDropped, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Get a pointer to the newest LED state. This must only be called from
+ * the rawdraw thread. It never waits on the swadge task
  *
  * @param numLeds A pointer to return the number of led_t through
  * @return A pointer to the current LED state
  */
 led_t * getLedMemory(uint8_t * numLeds)
 {
+    led_t * leds = __atomic_load_n(&rdLeds, __ATOMIC_ACQUIRE);
+    if(NULL == leds)
+    {
+        *numLeds = 0;
+        return NULL;
+    }
+
+    tbAcquire(&ledTb);
     *numLeds = rdNumLeds;
-    return rdLeds;
+    return &leds[ledTb.front * rdNumLeds];
 }
 
 /**
- * @brief Free any memory allocated for the display
+ * @brief Free any memory allocated for the display. The swadge task must be
+ * stopped first
  */
 void deinitDisplayMemory(void)
 {
-	pthread_mutex_lock(&displayMutex);
 	if(NULL != frameBuffer)
 	{
 		free(frameBuffer);
@@ -357,11 +455,11 @@ void deinitDisplayMemory(void)
     {
         free(scaledBitmapDisplay);
     }
+    emuScalerDeinit(&displayScaler);
     if(NULL != rdLeds)
     {
         free(rdLeds);
     }
-	pthread_mutex_unlock(&displayMutex);
 }
 
 //==============================================================================
@@ -388,27 +486,13 @@ void initTFT(display_t * disp, spi_host_device_t spiHost UNUSED,
 {
     WARN_UNIMPLEMENTED();
 	
-	// ARGB pixels
-	pthread_mutex_lock(&displayMutex);
-
-    bitmapWidth = TFT_WIDTH;
-    bitmapHeight = TFT_HEIGHT;
-
     // Set up underlying bitmap
     if(NULL == frameBuffer)
     {
         frameBuffer = calloc(TFT_WIDTH * TFT_HEIGHT, sizeof(paletteColor_t));
     }
 
-    // This may be setup by the emulator already
-    if(NULL == scaledBitmapDisplay)
-    {
-        scaledBitmapDisplay = calloc(TFT_WIDTH * TFT_HEIGHT, sizeof(uint32_t));
-        displayMult = 1;        
-    }
-	pthread_mutex_unlock(&displayMutex);
-
-    // Rawdraw initialized in main
+    // Rawdraw initialized in main, and sets up the scaled bitmap
 
     disp->w = TFT_WIDTH;
     disp->h = TFT_HEIGHT;
@@ -451,9 +535,7 @@ void emuSetPxTft(int16_t x, int16_t y, paletteColor_t px)
 {
     if(0 <= x && x < TFT_WIDTH && 0 <= y && y < TFT_HEIGHT)
     {
-        pthread_mutex_lock(&displayMutex);
         frameBuffer[(y * TFT_WIDTH) + x] = px;
-        pthread_mutex_unlock(&displayMutex);
     }
 }
 
@@ -469,10 +551,7 @@ paletteColor_t emuGetPxTft(int16_t x, int16_t y)
 {
     if(0 <= x && x < TFT_WIDTH && 0 <= y && y < TFT_HEIGHT)
     {
-        pthread_mutex_lock(&displayMutex);
-        paletteColor_t px = frameBuffer[(y * TFT_WIDTH) + x];
-        pthread_mutex_unlock(&displayMutex);
-        return px;
+        return frameBuffer[(y * TFT_WIDTH) + x];
     }
     return c000;
 }
@@ -482,38 +561,41 @@ paletteColor_t emuGetPxTft(int16_t x, int16_t y)
  */
 void emuClearPxTft(void)
 {
-	pthread_mutex_lock(&displayMutex);
     memset(frameBuffer, c000, sizeof(paletteColor_t) * TFT_HEIGHT * TFT_WIDTH);
-	pthread_mutex_unlock(&displayMutex);
 }
 
 /**
  * @brief Called when the Swadge wants to draw a new display. Note, this is
- * called from a pthread, so it raises a flag to draw on the main thread
+ * called from a pthread, so it copies the frame to a free slot and hands it to
+ * the main thread without waiting
  *
  * @param drawDiff unused, the whole display is always drawn
  */
 void emuDrawDisplayTft(display_t * disp, bool drawDiff UNUSED, fnBackgroundDrawCallback_t fnBackgroundDrawCallback )
 {
+#if defined(EMU_ALLOC_TRACE)
+    // Count allocations per frame
+    emuAllocTraceFrame();
+#endif
+
     /* Copy the current framebuffer to memory that won't be modified by the
-    * Swadge mode. rawdraw will use this non-changing bitmap to draw
+    * Swadge mode. rawdraw will scale and draw this non-changing frame.
+    * In turbo mode, frames which won't be shown aren't copied, but the
+    * background callbacks still run so the mode behaves the same
     */
-    pthread_mutex_lock(&displayMutex);
+    bool showFrame = emuShouldShowFrame(framesProduced);
+    if(emuIsCapturing())
+    {
+        emuCaptureFrame(frameBuffer);
+    }
+    paletteColor_t * slot = frameSlots[frameTb.back];
 	int16_t y;
     for(y = 0; y < TFT_HEIGHT; y++)
     {
-        for(int16_t x = 0; x < TFT_WIDTH; x++)
+        if(showFrame)
         {
-            for(uint16_t mY = 0; mY < displayMult; mY++)
-            {
-                for(uint16_t mX = 0; mX < displayMult; mX++)
-                {
-                    int dstX = ((x * displayMult) + mX);
-                    int dstY = ((y * displayMult) + mY);
-                    scaledBitmapDisplay[(dstY * (TFT_WIDTH * displayMult)) + dstX] = paletteColorsEmu[frameBuffer[(y * TFT_WIDTH) + x]];
-                }
-            }
-        }        
+            memcpy(&slot[y * TFT_WIDTH], &frameBuffer[y * TFT_WIDTH], TFT_WIDTH * sizeof(paletteColor_t));
+        }
 
 		if( ( y & 0xf ) == 0 && fnBackgroundDrawCallback && y > 0 )
 		{
@@ -526,7 +608,12 @@ void emuDrawDisplayTft(display_t * disp, bool drawDiff UNUSED, fnBackgroundDrawC
 		fnBackgroundDrawCallback( disp, 0, y-16, TFT_WIDTH, 16, y/16, TFT_HEIGHT/16 );
 	}
 
-    pthread_mutex_unlock(&displayMutex);
+    // Hand the frame over
+    if(showFrame && tbPublish(&frameTb))
+    {
+        __atomic_fetch_add(&framesDropped, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_fetch_add(&framesProduced, 1, __ATOMIC_RELAXED);
 }
 
 //==============================================================================
@@ -617,14 +704,13 @@ void initLeds(gpio_num_t gpio, gpio_num_t gpioAlt, rmt_channel_t rmt, uint16_t n
     // If the LEDs haven't been initialized yet
     if(NULL == rdLeds)
     {
-        // Allocate some LED memory
-        pthread_mutex_lock(&displayMutex);
-        rdLeds = malloc(sizeof(led_t) * numLeds);
-        pthread_mutex_unlock(&displayMutex);
         // Save the number of LEDs
         rdNumLeds = numLeds;
         // Save the brightness
         ledBrightness = (7 - brightness);
+        // Allocate some LED memory, one for each triple buffer slot, and
+        // publish it to rawdraw last
+        __atomic_store_n(&rdLeds, calloc(3 * numLeds, sizeof(led_t)), __ATOMIC_RELEASE);
     }
 }
 
@@ -653,12 +739,25 @@ void setLedBrightness(uint8_t brightness)
  */
 void setLeds(led_t* leds, uint8_t numLeds)
 {
-	pthread_mutex_lock(&displayMutex);
-    for(int i = 0; i < numLeds; i++)
+    // Log the LEDs when the mic is being read from a file
+    emuMicFileLogLeds(leds, numLeds);
+
+    if(NULL == rdLeds)
+    {
+        return;
+    }
+
+    // Fill in the back slot, then hand it to rawdraw
+    led_t * slot = &rdLeds[ledTb.back * rdNumLeds];
+    for(int i = 0; i < numLeds && i < rdNumLeds; i++)
+    {
+        slot[i].r = leds[i].r >> ledBrightness;
+        slot[i].g = leds[i].g >> ledBrightness;
+        slot[i].b = leds[i].b >> ledBrightness;
+    }
+    if(emuIsCapturing())
     {
-        rdLeds[i].r = leds[i].r >> ledBrightness;
-        rdLeds[i].g = leds[i].g >> ledBrightness;
-        rdLeds[i].b = leds[i].b >> ledBrightness;
+        emuCaptureLeds(slot, (numLeds < rdNumLeds) ? numLeds : rdNumLeds);
     }
-	pthread_mutex_unlock(&displayMutex);
+    tbPublish(&ledTb);
 }
@@ -25,13 +25,13 @@
     #error "Please pick a screen size"
 #endif
 
-void lockDisplayMemoryMutex(void);
-void unlockDisplayMemoryMutex(void);
+extern uint32_t paletteColorsEmu[216];
 
 uint32_t * getDisplayBitmap(uint16_t * width, uint16_t * height);
 led_t * getLedMemory(uint8_t * numLeds);
+void getDisplayFrameCounts(uint32_t * produced, uint32_t * presented, uint32_t * dropped);
 
-void setDisplayBitmapMultiplier(uint8_t multiplier);
+void setDisplayBitmapSize(uint16_t width, uint16_t height);
 
 void deinitDisplayMemory(void);
 
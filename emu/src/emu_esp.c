@@ -99,12 +99,12 @@ bool tud_ready(void)
 }
 
 /**
- * @brief Yield to rawdraw
+ * @brief Yield to rawdraw. This sleeps, or steps the virtual clock in turbo
+ * mode
  */
 void taskYIELD(void)
 {
-	// Just sleep for ten ms
-	usleep(1000);
+	emuTimerYield();
 }
 
 /**
@@ -2,6 +2,7 @@
 #define _EMU_ESP_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #define UNUSED __attribute__((unused))
 
@@ -18,4 +19,14 @@
 extern volatile bool threadsShouldRun;
 void joinThreads(void);
 
+int64_t emuGetWallTimeUs(void);
+void emuSetTurbo(bool turbo);
+bool emuIsTurbo(void);
+void emuSetTurboFrameSkip(uint32_t skip);
+bool emuShouldShowFrame(uint32_t frameNum);
+void emuSetLockstepClock(void);
+void emuTimerYield(void);
+
+void emuNvsDeinit(void);
+
 #endif
\ No newline at end of file
@@ -3,11 +3,16 @@
 //==============================================================================
 
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
 #include <unistd.h>
+#include <getopt.h>
 #include <pthread.h>
 #include <math.h>
 
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "swadge_esp32.h"
 #include "btn.h"
 
@@ -18,6 +23,13 @@
 #include "emu_display.h"
 #include "emu_sound.h"
 #include "emu_sensors.h"
+#include "emu_replay.h"
+#include "emu_capture.h"
+#include "spiffs_manager.h"
+
+#if defined(EMU_ALLOC_TRACE)
+    #include "emu_alloc_trace.h"
+#endif
 
 //Make it so we don't need to include any other C files in our build.
 #define CNFG_IMPLEMENTATION
@@ -31,6 +43,11 @@
 #define MIN(x,y) ((x)<(y)?(x):(y))
 #define MIN_LED_HEIGHT 64
 
+#define WINDOW_TITLE "Swadge S2 Emulator"
+
+// Toggles turbo mode. Not one of the button keys
+#define TURBO_KEY 't'
+
 #define BG_COLOR  0x191919FF // This color isn't part of the palette
 #define DIV_COLOR 0x808080FF
 
@@ -40,6 +57,10 @@
 
 void drawBitmapPixel(uint32_t * bitmapDisplay, int w, int h, int x, int y, uint32_t col);
 void plotRoundedCorners(uint32_t * bitmapDisplay, int w, int h, int r, uint32_t col);
+static bool parseArgs(int argc, char ** argv);
+static void updateFrameStats(void);
+static void printUsage(const char * progName);
+static void getDisplaySize(int availW, int availH, uint16_t * dispW, uint16_t * dispH);
 
 //==============================================================================
 // Variables
@@ -47,6 +68,9 @@ void plotRoundedCorners(uint32_t * bitmapDisplay, int w, int h, int r, uint32_t
 
 static bool isRunning = true;
 
+// If the TFT should fill the window rather than be scaled by whole multiples
+static bool scaleToFit = false;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -62,6 +86,14 @@ static bool isRunning = true;
  */
 void HandleKey( int keycode, int bDown )
 {
+    if(TURBO_KEY == keycode)
+    {
+        if(bDown)
+        {
+            emuSetTurbo(!emuIsTurbo());
+        }
+        return;
+    }
     emuSensorHandleKey(keycode, bDown);
 }
 
@@ -101,6 +133,23 @@ void HandleDestroy()
     // Upon exit, stop all tasks
     joinThreads();
 
+#if defined(EMU_ALLOC_TRACE)
+    // Write the last allocation report
+    emuAllocTraceDeinit();
+#endif
+
+    // Finish the input journal
+    emuReplayDeinit();
+
+    // Write any captured frames which haven't been written yet
+    emuCaptureDeinit();
+
+    // Write any NVS changes which haven't been written yet
+    emuNvsDeinit();
+
+    // Free the SPIFFS image
+    deinitSpiffs();
+
     // Then free display memory
     deinitDisplayMemory();
 
@@ -164,23 +213,286 @@ void plotRoundedCorners(uint32_t * bitmapDisplay, int w, int h, int r, uint32_t
     } while (x < 0);
 }
 
+/**
+ * @brief Once a second, put the rate of frames produced by the swadge,
+ * presented by rawdraw, and dropped in between in the window title
+ */
+static void updateFrameStats(void)
+{
+    static int64_t tLastUs = 0;
+    static uint32_t lastProduced = 0;
+    static uint32_t lastPresented = 0;
+    static uint32_t lastDropped = 0;
+
+    int64_t tNowUs = esp_timer_get_time();
+    if(tNowUs - tLastUs < 1000000)
+    {
+        return;
+    }
+
+    uint32_t produced, presented, dropped;
+    getDisplayFrameCounts(&produced, &presented, &dropped);
+
+    if(0 != tLastUs)
+    {
+        char title[128];
+        int64_t tElapsedUs = tNowUs - tLastUs;
+        snprintf(title, sizeof(title), "%s%s (%" PRId64 " fps drawn, %" PRId64 " shown, %u dropped)", WINDOW_TITLE,
+            emuIsTurbo() ? " [TURBO]" : "",
+            ((int64_t)(produced - lastProduced) * 1000000) / tElapsedUs,
+            ((int64_t)(presented - lastPresented) * 1000000) / tElapsedUs,
+            dropped - lastDropped);
+        CNFGChangeWindowTitle(title);
+    }
+
+    tLastUs = tNowUs;
+    lastProduced = produced;
+    lastPresented = presented;
+    lastDropped = dropped;
+}
+
+/**
+ * @brief Figure out how big to draw the TFT in the space available. The
+ * aspect ratio is always kept. Unless scaleToFit is set, the size is a whole
+ * multiple of the TFT size, which keeps every pixel the same size
+ *
+ * @param availW The width available for the TFT
+ * @param availH The height available for the TFT
+ * @param dispW A pointer to return the width to draw the TFT at through
+ * @param dispH A pointer to return the height to draw the TFT at through
+ */
+static void getDisplaySize(int availW, int availH, uint16_t * dispW, uint16_t * dispH)
+{
+    if(scaleToFit)
+    {
+        // Fill the width, unless that would be too tall
+        int w = availW;
+        int h = (w * TFT_HEIGHT) / TFT_WIDTH;
+        if(h > availH)
+        {
+            h = availH;
+            w = (h * TFT_WIDTH) / TFT_HEIGHT;
+        }
+        *dispW = (w < 1) ? 1 : w;
+        *dispH = (h < 1) ? 1 : h;
+    }
+    else
+    {
+        // Figure out how much the TFT should be scaled by
+        int widthMult = availW / TFT_WIDTH;
+        if(0 == widthMult)
+        {
+            widthMult = 1;
+        }
+        int heightMult = availH / TFT_HEIGHT;
+        if(0 == heightMult)
+        {
+            heightMult = 1;
+        }
+        int screenMult = MIN(widthMult, heightMult);
+        *dispW = screenMult * TFT_WIDTH;
+        *dispH = screenMult * TFT_HEIGHT;
+    }
+}
+
+/**
+ * @brief Print the emulator's command line options
+ *
+ * @param progName The name the emulator was run as
+ */
+static void printUsage(const char * progName)
+{
+    printf("Usage: %s [options]\n"
+           "  --mic-file <file>  Use a WAV or raw 16 bit 8KHz PCM file as the microphone\n"
+           "  --mic-fast         Feed the mic file as fast as possible, not in real time\n"
+           "  --mic-log <file>   Log audio callback times and LEDs while the mic file plays, - for stdout\n"
+           "  --mic-exit         Exit after the whole mic file was played\n"
+           "  --scale-fit        Scale the display to fill the window, not by whole multiples\n"
+           "  --turbo            Start in turbo mode, running as fast as possible. Press '%c' to toggle\n"
+           "  --turbo-skip <n>   Only show one of every n frames in turbo mode\n"
+           "  --record <file>    Journal all inputs to a file, which can be replayed exactly\n"
+           "  --replay <file>    Replay a journal from --record instead of using live inputs\n"
+           "  --replay-exit      Exit after the whole journal was replayed\n"
+           "  --capture <file>   Capture every frame and the LEDs to a file, see tools/capture_convert\n"
+           "  --help             Print this message\n", progName, TURBO_KEY);
+}
+
+/**
+ * @brief Parse the emulator's command line options and set things up for them
+ *
+ * @param argc The number of arguments
+ * @param argv The arguments
+ * @return true if the emulator should run, false if it should exit
+ */
+static bool parseArgs(int argc, char ** argv)
+{
+    static const struct option longOpts[] =
+    {
+        {"mic-file", required_argument, NULL, 'f'},
+        {"mic-fast", no_argument,       NULL, 'F'},
+        {"mic-log",  required_argument, NULL, 'l'},
+        {"mic-exit", no_argument,       NULL, 'x'},
+        {"scale-fit", no_argument,      NULL, 's'},
+        {"turbo",    no_argument,       NULL, 't'},
+        {"turbo-skip", required_argument, NULL, 'k'},
+        {"record",   required_argument, NULL, 'r'},
+        {"replay",   required_argument, NULL, 'p'},
+        {"replay-exit", no_argument,    NULL, 'e'},
+        {"capture",  required_argument, NULL, 'c'},
+        {"help",     no_argument,       NULL, 'h'},
+        {0},
+    };
+
+    const char * micFile = NULL;
+    const char * micLog = NULL;
+    bool micFast = false;
+    bool micExit = false;
+    const char * recordFile = NULL;
+    const char * replayFile = NULL;
+    bool replayExit = false;
+
+    int opt;
+    while(-1 != (opt = getopt_long(argc, argv, "", longOpts, NULL)))
+    {
+        switch(opt)
+        {
+            case 'f':
+            {
+                micFile = optarg;
+                break;
+            }
+            case 'F':
+            {
+                micFast = true;
+                break;
+            }
+            case 'l':
+            {
+                micLog = optarg;
+                break;
+            }
+            case 'x':
+            {
+                micExit = true;
+                break;
+            }
+            case 's':
+            {
+                scaleToFit = true;
+                break;
+            }
+            case 't':
+            {
+                emuSetTurbo(true);
+                break;
+            }
+            case 'k':
+            {
+                int skip = atoi(optarg);
+                if(skip < 1)
+                {
+                    printf("--turbo-skip must be at least 1\n");
+                    return false;
+                }
+                emuSetTurboFrameSkip(skip);
+                break;
+            }
+            case 'r':
+            {
+                recordFile = optarg;
+                break;
+            }
+            case 'p':
+            {
+                replayFile = optarg;
+                break;
+            }
+            case 'e':
+            {
+                replayExit = true;
+                break;
+            }
+            case 'c':
+            {
+                if(!emuCaptureStart(optarg))
+                {
+                    return false;
+                }
+                break;
+            }
+            case 'h':
+            default:
+            {
+                printUsage(argv[0]);
+                return false;
+            }
+        }
+    }
+
+    if(NULL != micFile)
+    {
+        if(!emuSetMicFile(micFile, !micFast, micExit, micLog))
+        {
+            return false;
+        }
+    }
+    else if(micFast || micExit || (NULL != micLog))
+    {
+        printf("--mic-fast, --mic-log, and --mic-exit need --mic-file\n");
+        return false;
+    }
+
+    if((NULL != recordFile) && (NULL != replayFile))
+    {
+        printf("--record and --replay can't be used together\n");
+        return false;
+    }
+    else if(NULL != recordFile)
+    {
+        if(!emuRecordStart(recordFile))
+        {
+            return false;
+        }
+    }
+    else if(NULL != replayFile)
+    {
+        if(!emuReplayStart(replayFile, replayExit))
+        {
+            return false;
+        }
+    }
+    else if(replayExit)
+    {
+        printf("--replay-exit needs --replay\n");
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * @brief The main emulator function. This initializes rawdraw and calls
  * app_main(), then spins in a loop updating the rawdraw UI
  *
- * @param argc unused
- * @param argv unused
+ * @param argc The number of command line arguments
+ * @param argv The command line arguments
  * @return 0 on success, a nonzero value for any errors
  */
-int main(int argc UNUSED, char ** argv UNUSED)
+int main(int argc, char ** argv)
 {
+    // Handle command line options before anything starts
+    if(!parseArgs(argc, argv))
+    {
+        return 1;
+    }
+
     // First initialize rawdraw
     // Screen-specific configurations
     // Save window dimensions from the last loop
     short lastWindow_w = 0;
     short lastWindow_h = 0;
     int16_t led_h = MIN_LED_HEIGHT;
-    CNFGSetup( "Swadge S2 Emulator", (TFT_WIDTH * 2), (TFT_HEIGHT * 2) + led_h + 1);
+    CNFGSetup( WINDOW_TITLE, (TFT_WIDTH * 2), (TFT_HEIGHT * 2) + led_h + 1);
 
     // This is the 'main' that gets called when the ESP boots
     app_main();
@@ -191,6 +503,12 @@ int main(int argc UNUSED, char ** argv UNUSED)
         // Always handle inputs
         CNFGHandleInput();
 
+        // If the swadge task stopped on its own, i.e. the mic file ended, clean up
+        if(isRunning && !threadsShouldRun)
+        {
+            HandleDestroy();
+        }
+
         // If not running anymore, don't handle graphics
         // Must be checked after handling input, before graphics
         if(!isRunning)
@@ -209,34 +527,22 @@ int main(int argc UNUSED, char ** argv UNUSED)
         // If the dimensions changed
         if((lastWindow_h != window_h) || (lastWindow_w != window_w))
         {
-            // Figure out how much the TFT should be scaled by
-            uint8_t widthMult = window_w / TFT_WIDTH;
-            if(0 == widthMult)
-            {
-                widthMult = 1;
-            }
-            uint8_t heightMult = (window_h - MIN_LED_HEIGHT - 1) / TFT_HEIGHT;
-            if(0 == heightMult)
-            {
-                heightMult = 1;
-            }
-            uint8_t screenMult = MIN(widthMult, heightMult);
+            // Figure out how big the TFT should be drawn
+            uint16_t dispW, dispH;
+            getDisplaySize(window_w, window_h - MIN_LED_HEIGHT - 1, &dispW, &dispH);
 
             // LEDs take up the rest of the vertical space
-            led_h = window_h - 1 - (screenMult * TFT_HEIGHT);
+            led_h = window_h - 1 - dispH;
 
-            // Set the multiplier
-            setDisplayBitmapMultiplier(screenMult);
+            // Set the size
+            setDisplayBitmapSize(dispW, dispH);
 
             // Save for the next loop
             lastWindow_w = window_w;
             lastWindow_h = window_h;
         }
 
-        // Get a lock on the display memory mutex (LED & TFT)
-        lockDisplayMemoryMutex();
-
-        // Get the LED memory
+        // Get the LED memory. This never waits on the swadge task
         uint8_t numLeds;
         led_t * leds = getLedMemory(&numLeds);
 
@@ -269,7 +575,7 @@ int main(int argc UNUSED, char ** argv UNUSED)
         if((0 != bitmapWidth) && (0 != bitmapHeight) && (NULL != bitmapDisplay))
         {
 #if defined(CONFIG_GC9307_240x280)
-            plotRoundedCorners(bitmapDisplay, bitmapWidth, bitmapHeight, (bitmapWidth / TFT_WIDTH) * 40, BG_COLOR);
+            plotRoundedCorners(bitmapDisplay, bitmapWidth, bitmapHeight, (bitmapWidth * 40) / TFT_WIDTH, BG_COLOR);
 #endif
             // Update the display, centered
             CNFGBlitImage(bitmapDisplay,
@@ -281,7 +587,8 @@ int main(int argc UNUSED, char ** argv UNUSED)
         //Display the image and wait for time to display next frame.
         CNFGSwapBuffers();
 
-        unlockDisplayMemoryMutex();
+        // Show frame pacing in the title once a second
+        updateFrameStats();
 
         // Sleep for 1 ms
         usleep(1000);
@@ -6,19 +6,38 @@
 #include "esp_log.h"
 
 #include "emu_esp.h"
+#include "emu_replay.h"
 
 /**
- * @brief  Get one random 32-bit word from hardware RNG
+ * @brief  Get one random 32-bit word from hardware RNG. Every draw is
+ * journaled when recording, and comes from the journal when replaying.
+ *
+ * This has its own xorshift state rather than using rand(), so like the real
+ * hardware RNG, it doesn't disturb a mode's own srand()/rand() sequence
  *
  * @return Random value between 0 and UINT32_MAX
  */
 uint32_t esp_random(void)
 {
-    static bool seeded = false;
-    if (!seeded)
+    uint32_t val;
+    if (sizeof(val) == emuReplayRead(RP_RANDOM, &val, sizeof(val)))
+    {
+        return val;
+    }
+
+    static uint32_t state = 0;
+    if (0 == state)
+    {
+        state = (uint32_t)time(NULL) | 1;
+    }
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    val = state;
+
+    if (!emuIsReplaying())
     {
-        seeded = true;
-        srand(time(NULL));
+        emuRecord(RP_RANDOM, &val, sizeof(val));
     }
-    return rand();
+    return val;
 }
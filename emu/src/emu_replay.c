@@ -0,0 +1,367 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#include "emu_esp.h"
+#include "emu_replay.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// Journal files start with this, then a version byte
+#define RP_MAGIC   "SWRP"
+#define RP_VERSION 1
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * One record in a loaded journal. On disk, each record is a type byte, then
+ * the time since the previous record and the payload length as LEB128
+ * varints, then the payload
+ */
+typedef struct
+{
+    emuReplayType_t type;
+    int64_t timeUs;      // The virtual time this was recorded at
+    uint32_t offset;     // Where the payload starts in journal.data
+    uint32_t len;        // The payload length
+} emuReplayRecord_t;
+
+typedef struct
+{
+    // Recording
+    FILE* recFile;
+    int64_t lastRecUs;
+    uint32_t numRecorded;
+
+    // Replaying
+    bool replaying;
+    bool exitWhenDone;
+    bool desynced;
+    uint8_t* data;
+    emuReplayRecord_t* records;
+    uint32_t numRecords;
+    uint32_t numReplayed;
+    uint32_t* byType[RP_NUM_TYPES]; // Indices into records, one list per type
+    uint32_t typeCount[RP_NUM_TYPES];
+    uint32_t typeCursor[RP_NUM_TYPES];
+} emuReplay_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void writeVarint(FILE* f, uint64_t val);
+static bool readVarint(const uint8_t* data, uint32_t len, uint32_t* pos, uint64_t* val);
+static void finishReplay(void);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static emuReplay_t journal = {0};
+static pthread_mutex_t journalMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const char* const typeNames[RP_NUM_TYPES] =
+{
+    "button", "accel", "mic", "espnow rx", "espnow tx", "random"
+};
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Start journaling inputs to a file. This must be called before the
+ * swadge starts, since it puts the clock in lockstep mode
+ *
+ * @param fname The file to write the journal to
+ * @return true if the file was opened, false if it wasn't
+ */
+bool emuRecordStart(const char* fname)
+{
+    journal.recFile = fopen(fname, "wb");
+    if(NULL == journal.recFile)
+    {
+        ESP_LOGE("EMU", "Couldn't open %s to record to", fname);
+        return false;
+    }
+
+    fwrite(RP_MAGIC, 1, 4, journal.recFile);
+    fputc(RP_VERSION, journal.recFile);
+
+    // Time only moves when the swadge task yields, so a replay sees the same
+    // timestamps no matter how fast it runs
+    emuSetLockstepClock();
+    return true;
+}
+
+/**
+ * @brief Load a journal and start feeding it back instead of live inputs. This
+ * must be called before the swadge starts, since it puts the clock in lockstep
+ * mode
+ *
+ * @param fname The journal to replay
+ * @param exitWhenDone true to end the emulator once every record was replayed
+ * @return true if the journal was loaded, false if it wasn't
+ */
+bool emuReplayStart(const char* fname, bool exitWhenDone)
+{
+    FILE* f = fopen(fname, "rb");
+    if(NULL == f)
+    {
+        ESP_LOGE("EMU", "Couldn't open %s to replay", fname);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long fileLen = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    uint8_t* data = malloc(fileLen > 0 ? fileLen : 1);
+    bool readOk = (fileLen >= 5) && (fileLen == (long)fread(data, 1, fileLen, f));
+    fclose(f);
+    if(!readOk || (0 != memcmp(data, RP_MAGIC, 4)) || (RP_VERSION != data[4]))
+    {
+        ESP_LOGE("EMU", "%s isn't a version %d input journal", fname, RP_VERSION);
+        free(data);
+        return false;
+    }
+
+    // Count the records first, then index them
+    uint32_t len = fileLen;
+    for(int pass = 0; pass < 2; pass++)
+    {
+        uint32_t pos = 5;
+        uint32_t numRecords = 0;
+        int64_t timeUs = 0;
+        while(pos < len)
+        {
+            uint8_t type = data[pos++];
+            uint64_t dt, recLen;
+            if(type >= RP_NUM_TYPES || !readVarint(data, len, &pos, &dt) || !readVarint(data, len, &pos, &recLen) ||
+                    (recLen > len - pos))
+            {
+                ESP_LOGE("EMU", "%s is corrupt at byte %" PRIu32, fname, pos);
+                emuReplayDeinit();
+                free(data);
+                return false;
+            }
+            timeUs += dt;
+
+            if(1 == pass)
+            {
+                journal.records[numRecords].type = type;
+                journal.records[numRecords].timeUs = timeUs;
+                journal.records[numRecords].offset = pos;
+                journal.records[numRecords].len = recLen;
+                journal.byType[type][journal.typeCount[type]] = numRecords;
+            }
+            journal.typeCount[type]++;
+            numRecords++;
+            pos += recLen;
+        }
+
+        if(0 == pass)
+        {
+            journal.numRecords = numRecords;
+            journal.records = calloc(numRecords + 1, sizeof(emuReplayRecord_t));
+            for(int t = 0; t < RP_NUM_TYPES; t++)
+            {
+                journal.byType[t] = calloc(journal.typeCount[t] + 1, sizeof(uint32_t));
+                journal.typeCount[t] = 0;
+            }
+        }
+    }
+
+    journal.data = data;
+    journal.exitWhenDone = exitWhenDone;
+    journal.replaying = true;
+    printf("Replaying %" PRIu32 " records from %s\n", journal.numRecords, fname);
+    if(0 == journal.numRecords)
+    {
+        finishReplay();
+    }
+
+    emuSetLockstepClock();
+    return true;
+}
+
+/**
+ * @brief Finish writing the journal and free any loaded one. The swadge task
+ * must be stopped first
+ */
+void emuReplayDeinit(void)
+{
+    pthread_mutex_lock(&journalMutex);
+    if(NULL != journal.recFile)
+    {
+        fclose(journal.recFile);
+        printf("Recorded %" PRIu32 " records\n", journal.numRecorded);
+    }
+    free(journal.data);
+    free(journal.records);
+    for(int t = 0; t < RP_NUM_TYPES; t++)
+    {
+        free(journal.byType[t]);
+    }
+    memset(&journal, 0, sizeof(journal));
+    pthread_mutex_unlock(&journalMutex);
+}
+
+/**
+ * @return true if inputs are being journaled, false if not
+ */
+bool emuIsRecording(void)
+{
+    return NULL != journal.recFile;
+}
+
+/**
+ * @return true if inputs are coming from a journal, false if they're live
+ */
+bool emuIsReplaying(void)
+{
+    return __atomic_load_n(&journal.replaying, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Journal one input, stamped with the current virtual time. Does
+ * nothing unless recording
+ *
+ * @param type The kind of input
+ * @param data The input's bytes
+ * @param len The number of bytes
+ */
+void emuRecord(emuReplayType_t type, const void* data, uint32_t len)
+{
+    if(NULL == journal.recFile)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&journalMutex);
+    // Read the time under the lock so records are always in time order
+    int64_t nowUs = esp_timer_get_time();
+    fputc(type, journal.recFile);
+    writeVarint(journal.recFile, nowUs - journal.lastRecUs);
+    writeVarint(journal.recFile, len);
+    fwrite(data, 1, len, journal.recFile);
+    journal.lastRecUs = nowUs;
+    journal.numRecorded++;
+    pthread_mutex_unlock(&journalMutex);
+}
+
+/**
+ * @brief Get the next journaled input of a type, if it's due. Inputs which
+ * are polled are due once the virtual clock reaches the time they were
+ * recorded at. Random numbers are drawn on demand, so they're always due
+ *
+ * @param type The kind of input
+ * @param data Where to write the input's bytes
+ * @param maxLen The most bytes to write
+ * @return The length of the input, or -1 if there isn't one due
+ */
+int32_t emuReplayRead(emuReplayType_t type, void* data, uint32_t maxLen)
+{
+    if(!emuIsReplaying())
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&journalMutex);
+    int32_t len = -1;
+    if(journal.typeCursor[type] < journal.typeCount[type])
+    {
+        const emuReplayRecord_t* rec = &journal.records[journal.byType[type][journal.typeCursor[type]]];
+        int64_t nowUs = esp_timer_get_time();
+        if((rec->timeUs <= nowUs) || (RP_RANDOM == type))
+        {
+            // Anything not exactly on time means the session went differently
+            if((rec->timeUs != nowUs) && !journal.desynced)
+            {
+                journal.desynced = true;
+                ESP_LOGW("EMU", "Replay desync, %s recorded at %" PRId64 "us but read at %" PRId64 "us",
+                         typeNames[type], rec->timeUs, nowUs);
+            }
+
+            len = rec->len;
+            memcpy(data, &journal.data[rec->offset], (rec->len < maxLen) ? rec->len : maxLen);
+            journal.typeCursor[type]++;
+            journal.numReplayed++;
+        }
+    }
+    if(journal.numReplayed == journal.numRecords)
+    {
+        finishReplay();
+    }
+    pthread_mutex_unlock(&journalMutex);
+    return len;
+}
+
+/**
+ * @brief Go back to live inputs once the whole journal was replayed, and end
+ * the emulator if that was asked for
+ */
+static void finishReplay(void)
+{
+    __atomic_store_n(&journal.replaying, false, __ATOMIC_RELEASE);
+    printf("Replay finished at %" PRId64 "us, %s\n", esp_timer_get_time(),
+           journal.desynced ? "with a desync" : "in sync");
+    if(journal.exitWhenDone)
+    {
+        threadsShouldRun = false;
+    }
+}
+
+/**
+ * @brief Write an unsigned LEB128 varint
+ *
+ * @param f The file to write to
+ * @param val The value to write
+ */
+static void writeVarint(FILE* f, uint64_t val)
+{
+    do
+    {
+        uint8_t byte = val & 0x7F;
+        val >>= 7;
+        fputc(byte | (val ? 0x80 : 0), f);
+    } while(val);
+}
+
+/**
+ * @brief Read an unsigned LEB128 varint
+ *
+ * @param data The bytes to read from
+ * @param len The number of bytes in data
+ * @param pos The position to read from, moved past the varint
+ * @param val Where to write the value
+ * @return true if a varint was read, false if it ran off the end
+ */
+static bool readVarint(const uint8_t* data, uint32_t len, uint32_t* pos, uint64_t* val)
+{
+    *val = 0;
+    for(int shift = 0; (shift < 64) && (*pos < len); shift += 7)
+    {
+        uint8_t byte = data[(*pos)++];
+        *val |= (uint64_t)(byte & 0x7F) << shift;
+        if(0 == (byte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
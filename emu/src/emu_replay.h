@@ -0,0 +1,32 @@
+#ifndef _EMU_REPLAY_H_
+#define _EMU_REPLAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * The kinds of input which are journaled. Each kind is replayed in its own
+ * order, so inputs polled from different places can't get in each other's way
+ */
+typedef enum
+{
+    RP_BUTTON,      //!< A buttonEvt_t from checkButtonQueue()
+    RP_ACCEL,       //!< Three int16_t from the accelerometer
+    RP_MIC,         //!< A block of uint16_t samples from continuous_adc_read()
+    RP_ESPNOW_RX,   //!< A received packet, six byte MAC, int8_t RSSI, then data
+    RP_ESPNOW_TX,   //!< One byte, the esp_now_send_status_t of a send
+    RP_RANDOM,      //!< A uint32_t from esp_random()
+    RP_NUM_TYPES
+} emuReplayType_t;
+
+bool emuRecordStart(const char* fname);
+bool emuReplayStart(const char* fname, bool exitWhenDone);
+void emuReplayDeinit(void);
+
+bool emuIsRecording(void);
+bool emuIsReplaying(void);
+
+void emuRecord(emuReplayType_t type, const void* data, uint32_t len);
+int32_t emuReplayRead(emuReplayType_t type, void* data, uint32_t maxLen);
+
+#endif
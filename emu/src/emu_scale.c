@@ -0,0 +1,121 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "emu_scale.h"
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Set up a scaler for a given source and destination size. Sizes don't
+ * need to be whole multiples of each other
+ *
+ * @param scaler The scaler to set up
+ * @param srcW The source frame width
+ * @param srcH The source frame height
+ * @param dstW The destination bitmap width
+ * @param dstH The destination bitmap height
+ */
+void emuScalerInit(emuScaler_t* scaler, int srcW, int srcH, int dstW, int dstH)
+{
+    scaler->srcW = srcW;
+    scaler->srcH = srcH;
+    scaler->dstW = dstW;
+    scaler->dstH = dstH;
+    scaler->intMult = (0 == (dstW % srcW)) ? (dstW / srcW) : 0;
+
+    // Map each destination column to the source column it samples
+    scaler->xMap = malloc(dstW * sizeof(uint16_t));
+    for(int dx = 0; dx < dstW; dx++)
+    {
+        scaler->xMap[dx] = (dx * srcW) / dstW;
+    }
+
+    scaler->rowBuf = malloc(srcW * sizeof(uint32_t));
+}
+
+/**
+ * @brief Free memory allocated by emuScalerInit()
+ *
+ * @param scaler The scaler to free memory from
+ */
+void emuScalerDeinit(emuScaler_t* scaler)
+{
+    free(scaler->xMap);
+    free(scaler->rowBuf);
+    memset(scaler, 0, sizeof(emuScaler_t));
+}
+
+/**
+ * @brief Scale and convert a frame. Each source row which appears in the
+ * destination is converted through the palette once and expanded
+ * horizontally. Destination rows which sample the same source row as the one
+ * above are copied with memcpy()
+ *
+ * @param scaler The scaler, set up for the frame and bitmap sizes
+ * @param src The palette indexed source frame
+ * @param palette The 32 bit color for each palette index
+ * @param dst The destination bitmap
+ */
+void emuScaleFrame(const emuScaler_t* scaler, const uint8_t* src, const uint32_t* palette, uint32_t* dst)
+{
+    const int srcW = scaler->srcW;
+    const int dstW = scaler->dstW;
+    const int mult = scaler->intMult;
+    int lastSrcY = -1;
+
+    for(int dy = 0; dy < scaler->dstH; dy++)
+    {
+        uint32_t* dRow = &dst[dy * dstW];
+        int sy = (dy * scaler->srcH) / scaler->dstH;
+
+        // Repeated rows are copies of the one above
+        if(sy == lastSrcY)
+        {
+            memcpy(dRow, dRow - dstW, dstW * sizeof(uint32_t));
+            continue;
+        }
+        lastSrcY = sy;
+
+        const uint8_t* sRow = &src[sy * srcW];
+        if(1 == mult)
+        {
+            for(int sx = 0; sx < srcW; sx++)
+            {
+                dRow[sx] = palette[sRow[sx]];
+            }
+        }
+        else if(0 != mult)
+        {
+            // Whole multiple, write each converted pixel mult times
+            uint32_t* d = dRow;
+            for(int sx = 0; sx < srcW; sx++)
+            {
+                uint32_t c = palette[sRow[sx]];
+                for(int m = 0; m < mult; m++)
+                {
+                    *d++ = c;
+                }
+            }
+        }
+        else
+        {
+            // Fractional, convert the row once then sample it per column
+            uint32_t* rowBuf = scaler->rowBuf;
+            for(int sx = 0; sx < srcW; sx++)
+            {
+                rowBuf[sx] = palette[sRow[sx]];
+            }
+            const uint16_t* xMap = scaler->xMap;
+            for(int dx = 0; dx < dstW; dx++)
+            {
+                dRow[dx] = rowBuf[xMap[dx]];
+            }
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef _EMU_SCALE_H_
+#define _EMU_SCALE_H_
+
+#include <stdint.h>
+
+/**
+ * Nearest neighbor scaler from a palette indexed frame to a 32 bit bitmap.
+ * The column map is computed once per size, then each source row is converted
+ * once and repeated rows are copied
+ */
+typedef struct
+{
+    int srcW;        //!< Source frame width
+    int srcH;        //!< Source frame height
+    int dstW;        //!< Destination bitmap width
+    int dstH;        //!< Destination bitmap height
+    int intMult;     //!< The horizontal multiplier if dstW is a whole multiple of srcW, otherwise 0
+    uint16_t* xMap;  //!< The source column for each destination column
+    uint32_t* rowBuf; //!< One source row, converted through the palette
+} emuScaler_t;
+
+void emuScalerInit(emuScaler_t* scaler, int srcW, int srcH, int dstW, int dstH);
+void emuScalerDeinit(emuScaler_t* scaler);
+void emuScaleFrame(const emuScaler_t* scaler, const uint8_t* src, const uint32_t* palette, uint32_t* dst);
+
+#endif
@@ -20,6 +20,7 @@
 #include "btn.h"
 
 #include "emu_sensors.h"
+#include "emu_replay.h"
 
 //==============================================================================
 // Variables
@@ -77,6 +78,18 @@ bool checkButtonQueue(buttonEvt_t* evt)
 	list_node_t * node = list_lpop(buttonQueue);
 	pthread_mutex_unlock(&buttonQueueMutex);
 
+	// When replaying, live events are thrown away and journaled ones are used
+	if(emuIsReplaying())
+	{
+		if(NULL != node)
+		{
+			free(node->val);
+			free(node);
+		}
+		memset(evt, 0, sizeof(buttonEvt_t));
+		return (0 <= emuReplayRead(RP_BUTTON, evt, sizeof(buttonEvt_t)));
+	}
+
 	// No events
 	if(NULL == node)
 	{
@@ -90,6 +103,7 @@ bool checkButtonQueue(buttonEvt_t* evt)
 		// Free everything
 		free(node->val);
 		free(node);
+		emuRecord(RP_BUTTON, evt, sizeof(buttonEvt_t));
 		// Return that an event occurred
 		return true;
 	}
@@ -213,6 +227,42 @@ float readTemperatureSensor(void)
 // Accelerometer
 //==============================================================================
 
+/**
+ * @brief Journal an accelerometer sample, or replace it with a journaled one.
+ * It's polled every loop, so only changes are journaled
+ *
+ * @param x The X axis, which may be replaced
+ * @param y The Y axis, which may be replaced
+ * @param z The Z axis, which may be replaced
+ */
+static void journalAccel(int16_t * x, int16_t * y, int16_t * z)
+{
+	static int16_t lastXyz[3] = {0};
+	static bool lastValid = false;
+
+	int16_t xyz[3] = {*x, *y, *z};
+	if(emuIsReplaying())
+	{
+		if(sizeof(xyz) == emuReplayRead(RP_ACCEL, xyz, sizeof(xyz)))
+		{
+			memcpy(lastXyz, xyz, sizeof(xyz));
+			lastValid = true;
+		}
+		if(lastValid)
+		{
+			*x = lastXyz[0];
+			*y = lastXyz[1];
+			*z = lastXyz[2];
+		}
+	}
+	else if(emuIsRecording() && (!lastValid || 0 != memcmp(xyz, lastXyz, sizeof(xyz))))
+	{
+		emuRecord(RP_ACCEL, xyz, sizeof(xyz));
+		memcpy(lastXyz, xyz, sizeof(xyz));
+		lastValid = true;
+	}
+}
+
 /**
  * @brief Initialize the QMA6981 and start it going
  *
@@ -234,6 +284,7 @@ void QMA6981_poll(accel_t* currentAccel UNUSED)
 	currentAccel->x = 0;
 	currentAccel->y = 0;
 	currentAccel->z = 0;
+	journalAccel(&currentAccel->x, &currentAccel->y, &currentAccel->z);
     WARN_UNIMPLEMENTED();
 }
 
@@ -249,5 +300,6 @@ esp_err_t qma7981_get_acce_int(int16_t *x, int16_t *y, int16_t *z)
 	*x = 4095;
 	*y = (4095 * 2) / 3;
 	*z = 4095 / 3;
+	journalAccel(x, y, z);
 	return ESP_OK;	
 }
@@ -3,9 +3,12 @@
 //==============================================================================
 
 #include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 #include <string.h>
-#include <pthread.h>
+#include <unistd.h>
 
 #include "gpio_types.h"
 #include "driver/rmt.h"
@@ -16,6 +19,7 @@
 #include "sound.h"
 #include "musical_buzzer.h"
 #include "emu_sound.h"
+#include "emu_replay.h"
 #include "hdw-mic.h"
 
 //==============================================================================
@@ -25,6 +29,25 @@
 #define SAMPLING_RATE 8000
 #define SSBUF 8192
 
+// Band limited square wavetables, one per octave of fundamental frequency.
+// Table b holds odd harmonics up to 2^b, so it's alias free for fundamentals
+// up to (SAMPLING_RATE / 2) / 2^b
+#define WT_BITS      10
+#define WT_LEN       (1 << WT_BITS)
+#define WT_NUM_BANDS 8
+
+// Peak amplitude of each voice. Two voices are mixed
+#define VOICE_AMPLITUDE 1024
+
+// Note events from the swadge task to the audio thread. Must be a power of two
+#define BZR_QUEUE_LEN 32
+
+// How long buzzer_stop() waits for the audio thread to see the stop
+#define BZR_STOP_WAIT_US 100000
+
+// The most samples continuous_adc_read() returns at once
+#define ADC_READ_SAMPLES (BYTES_PER_READ / sizeof(adc_digi_output_data_t))
+
 //==============================================================================
 // Structs
 //==============================================================================
@@ -33,9 +56,41 @@ typedef struct
 {
 	const song_t *song;
 	uint32_t note_index;
-	int64_t start_time;
+	uint32_t samplesLeft; // Output samples left in the current note
+	uint32_t phase;       // Oscillator phase, 2^32 is one period
+	uint32_t phaseInc;    // Oscillator phase increment per sample
+	const int16_t *wave;  // Wavetable for the current note, NULL for silence
 } emu_buzzer_t;
 
+typedef enum
+{
+	BZR_EVT_PLAY_SFX,
+	BZR_EVT_PLAY_BGM,
+	BZR_EVT_STOP,
+} emuBzrEvtType_t;
+
+typedef struct
+{
+	emuBzrEvtType_t type;
+	const song_t *song;
+} emuBzrEvt_t;
+
+typedef struct
+{
+	uint16_t *samples;     // The whole file, converted to 12 bit unsigned ADC samples at SAMPLING_RATE
+	uint32_t numSamples;   // The number of samples in the file
+	uint32_t readIdx;      // The next sample to hand to continuous_adc_read()
+	bool realtime;         // true to play at SAMPLING_RATE, false to go as fast as the main loop can
+	bool exitWhenDone;     // true to end the emulator when the file runs out
+	bool blockPending;     // In fast mode, true if a block was just returned and the loop should move on
+	int64_t startTimeUs;   // When the first sample was read, for real time playback
+	FILE *log;             // Where to log callback timing and LEDs, may be NULL
+	uint32_t numBlocks;    // The number of audio callbacks made
+	int64_t totalCbUs;     // The total time spent in the audio callback
+	int64_t maxCbUs;       // The longest time spent in a single audio callback
+	bool finished;         // true once every sample was read and the summary was printed
+} emu_mic_file_t;
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -43,30 +98,48 @@ typedef struct
 // The sound driver
 struct SoundDriver *sounddriver = NULL;
 
-// Input sample circular buffer
+// Input sample circular buffer. The audio thread only writes sshead and the
+// swadge task only writes sstail, so it needs no lock
 uint16_t ssamples[SSBUF]  = {0};
 int sshead = 0;
 int sstail = 0;
 bool adcSampling = false;
-pthread_mutex_t micMutex = PTHREAD_MUTEX_INITIALIZER;
 
-// Output buzzer
-uint16_t buzzernote = SILENCE;
-pthread_mutex_t buzzerMutex = PTHREAD_MUTEX_INITIALIZER;
+// Output buzzer. The tracks are owned by the audio thread, which sequences
+// them in output samples, so note changes are exact to the sample. The
+// swadge task posts events through a single producer, single consumer queue.
+// The head and tail are free running counters
 emu_buzzer_t emuBzrBgm = {0};
 emu_buzzer_t emuBzrSfx = {0};
+emuBzrEvt_t bzrQueue[BZR_QUEUE_LEN];
+uint32_t bzrQueueHead = 0;
+uint32_t bzrQueueTail = 0;
+int64_t lastSoundCbUs = 0;
+
+// Band limited square wavetables
+int16_t squareWaves[WT_NUM_BANDS][WT_LEN];
 
 // Keep track of muted state
 bool emuMuted;
 
+// Microphone input from a file, instead of the sound driver
+emu_mic_file_t emuMicFile = {0};
+
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
-void play_note(const musicalNote_t * notation);
 void EmuSoundCb(struct SoundDriver *sd, short *in, short *out, int samplesr, int samplesp);
-bool buzzer_track_check_next_note(emu_buzzer_t * track, bool isActive);
-void buzzer_stop_dont_clear(void);
+static void initWavetables(void);
+static bool buzzer_post_event(emuBzrEvtType_t type, const song_t *song);
+static void buzzer_handle_events(void);
+static void buzzer_track_start(emu_buzzer_t * track, const song_t *song);
+static void buzzer_track_advance(emu_buzzer_t * track, uint32_t numSamples);
+static void buzzer_track_set_voice(emu_buzzer_t * track);
+static uint32_t readLiveSamples(uint16_t *outSamples);
+static uint32_t readMicFileSamples(uint16_t *outSamples);
+static void finishMicFile(void);
+static void deinitMicFile(void);
 
 //==============================================================================
 // Functions
@@ -79,6 +152,9 @@ void deinitSound(void)
 {
 	// CloseSound(sounddriver); TODO when calling this on Windows, it halts
 	CloseSound(NULL);
+
+	// Free the mic file, if there was one
+	deinitMicFile();
 }
 
 /**
@@ -93,15 +169,16 @@ void deinitSound(void)
 void EmuSoundCb(struct SoundDriver *sd UNUSED, short *in, short *out,
 				int samplesr, int samplesp)
 {
-	// If there are samples to read
-	if (adcSampling && samplesr)
+	// If there are samples to read, and the mic isn't coming from a file
+	if (adcSampling && samplesr && (NULL == emuMicFile.samples))
 	{
-		pthread_mutex_lock(&micMutex);
+		int head = sshead;
+		int tail = __atomic_load_n(&sstail, __ATOMIC_ACQUIRE);
 		// For each sample
 		for (int i = 0; i < samplesr; i++)
 		{
 			// Read the sample into the circular ssamples[] buffer
-			if (sstail != ((sshead + 1) % SSBUF))
+			if (tail != ((head + 1) % SSBUF))
 			{
 #ifndef ANDROID
 				// 12 bit sound, unsigned
@@ -133,44 +210,63 @@ void EmuSoundCb(struct SoundDriver *sd UNUSED, short *in, short *out,
 				// 	printf("Audio %d -> %d\n", vMin, vMax);
 				// }
 
-				ssamples[sshead] = v;
-				sshead = (sshead + 1) % SSBUF;
+				ssamples[head] = v;
+				head = (head + 1) % SSBUF;
 			}
 		}
-		pthread_mutex_unlock(&micMutex);
+		// Publish the new samples
+		__atomic_store_n(&sshead, head, __ATOMIC_RELEASE);
 	}
 
 	// If this is an output callback, and there are samples to write
 	if (samplesp && out)
 	{
-		// Keep track of our place in the wave
-		static float placeInWave = 0;
+		__atomic_store_n(&lastSoundCbUs, emuGetWallTimeUs(), __ATOMIC_RELAXED);
+
+		// Pick up any new songs or stops
+		buzzer_handle_events();
 
-		// If there is a note to play
-		pthread_mutex_lock(&buzzerMutex);
-		if (buzzernote)
+		int i = 0;
+		while (i < samplesp)
 		{
-			// For each sample
-			for (int i = 0; i < samplesp; i++)
+			// Write samples until the end of the buffer or the next note change
+			uint32_t run = samplesp - i;
+			if (emuBzrSfx.song && emuBzrSfx.samplesLeft < run)
 			{
-				// Write the sample
-				out[i] = 1024 * sin(placeInWave);
-				// Advance the place in the wave
-				placeInWave += ((2 * M_PI * buzzernote) / ((float)SAMPLING_RATE));
-				// Keep it bound between 0 and 2*PI
-				if (placeInWave >= (2 * M_PI))
+				run = emuBzrSfx.samplesLeft;
+			}
+			if (emuBzrBgm.song && emuBzrBgm.samplesLeft < run)
+			{
+				run = emuBzrBgm.samplesLeft;
+			}
+
+			// Mix both voices
+			memset(&out[i], 0, run * sizeof(short));
+			emu_buzzer_t *voices[] = {&emuBzrSfx, &emuBzrBgm};
+			for (uint8_t v = 0; v < 2; v++)
+			{
+				emu_buzzer_t *voice = voices[v];
+				if (NULL == voice->wave)
 				{
-					placeInWave -= (2 * M_PI);
+					continue;
 				}
+
+				const int16_t *wave = voice->wave;
+				uint32_t phase = voice->phase;
+				uint32_t phaseInc = voice->phaseInc;
+				for (uint32_t j = 0; j < run; j++)
+				{
+					out[i + j] += wave[phase >> (32 - WT_BITS)];
+					phase += phaseInc;
+				}
+				voice->phase = phase;
 			}
+			i += run;
+
+			// Move both tracks along
+			buzzer_track_advance(&emuBzrSfx, run);
+			buzzer_track_advance(&emuBzrBgm, run);
 		}
-		else
-		{
-			// No note to play
-			memset(out, 0, samplesp * 2);
-			placeInWave = 0;
-		}
-		pthread_mutex_unlock(&buzzerMutex);
 	}
 }
 
@@ -178,6 +274,43 @@ void EmuSoundCb(struct SoundDriver *sd UNUSED, short *in, short *out,
 // Buzzer
 //==============================================================================
 
+/**
+ * @brief Fill in the band limited square wavetables. This is the only place
+ * libm is used for sound, so the audio callback doesn't need it
+ */
+static void initWavetables(void)
+{
+	for (uint8_t band = 0; band < WT_NUM_BANDS; band++)
+	{
+		int16_t *wave = squareWaves[band];
+		uint32_t maxHarmonic = 1 << band;
+
+		// Sum the odd harmonics, with Lanczos sigma factors to tame the
+		// ringing at the edges. The piezo is driven with a 50% duty square wave
+		float samples[WT_LEN] = {0};
+		float peak = 0;
+		for (uint32_t i = 0; i < WT_LEN; i++)
+		{
+			float x = (2 * M_PI * i) / WT_LEN;
+			for (uint32_t k = 1; k <= maxHarmonic; k += 2)
+			{
+				float sigmaArg = (M_PI * k) / (maxHarmonic + 1);
+				float sigma = (k > 1) ? (sinf(sigmaArg) / sigmaArg) : 1;
+				samples[i] += (sigma * sinf(k * x)) / k;
+			}
+			if (fabsf(samples[i]) > peak)
+			{
+				peak = fabsf(samples[i]);
+			}
+		}
+
+		for (uint32_t i = 0; i < WT_LEN; i++)
+		{
+			wave[i] = (int16_t)lrintf((samples[i] * VOICE_AMPLITUDE) / peak);
+		}
+	}
+}
+
 /**
  * Initialize the emulated buzzer
  *
@@ -191,10 +324,74 @@ void buzzer_init(gpio_num_t gpio UNUSED, rmt_channel_t rmt UNUSED, bool isMuted)
 	buzzer_stop();
 	if (!sounddriver)
 	{
+		initWavetables();
 		sounddriver = InitSound(0, EmuSoundCb, SAMPLING_RATE, 1, 1, 256, 0, 0);
 	}
-	memset(&emuBzrBgm, 0, sizeof(emuBzrBgm));
-	memset(&emuBzrSfx, 0, sizeof(emuBzrSfx));
+}
+
+/**
+ * @brief Post a note event to the audio thread. This must only be called from
+ * the swadge task
+ *
+ * @param type The event type
+ * @param song The song for the event, if it has one
+ * @return true if the event was posted, false if the queue was full
+ */
+static bool buzzer_post_event(emuBzrEvtType_t type, const song_t *song)
+{
+	uint32_t head = bzrQueueHead;
+	if (head - __atomic_load_n(&bzrQueueTail, __ATOMIC_ACQUIRE) >= BZR_QUEUE_LEN)
+	{
+		// The audio thread isn't keeping up, or isn't running at all
+		static bool isPrinted = false;
+		if (!isPrinted)
+		{
+			isPrinted = true;
+			ESP_LOGW("EMU", "Buzzer event queue full, dropping events");
+		}
+		return false;
+	}
+
+	bzrQueue[head % BZR_QUEUE_LEN].type = type;
+	bzrQueue[head % BZR_QUEUE_LEN].song = song;
+	__atomic_store_n(&bzrQueueHead, head + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+/**
+ * @brief Handle all posted note events. This must only be called from the
+ * audio thread
+ */
+static void buzzer_handle_events(void)
+{
+	uint32_t tail = bzrQueueTail;
+	uint32_t head = __atomic_load_n(&bzrQueueHead, __ATOMIC_ACQUIRE);
+	while (tail != head)
+	{
+		emuBzrEvt_t *evt = &bzrQueue[tail % BZR_QUEUE_LEN];
+		switch (evt->type)
+		{
+			case BZR_EVT_PLAY_SFX:
+			{
+				buzzer_track_start(&emuBzrSfx, evt->song);
+				break;
+			}
+			case BZR_EVT_PLAY_BGM:
+			{
+				buzzer_track_start(&emuBzrBgm, evt->song);
+				break;
+			}
+			case BZR_EVT_STOP:
+			default:
+			{
+				memset(&emuBzrSfx, 0, sizeof(emuBzrSfx));
+				memset(&emuBzrBgm, 0, sizeof(emuBzrBgm));
+				break;
+			}
+		}
+		tail++;
+	}
+	__atomic_store_n(&bzrQueueTail, tail, __ATOMIC_RELEASE);
 }
 
 /**
@@ -209,13 +406,7 @@ void buzzer_play_sfx(const song_t *song)
 		return;
 	}
 
-	// Save the song pointer
-	emuBzrSfx.song = song;
-	emuBzrSfx.note_index = 0;
-	emuBzrSfx.start_time = esp_timer_get_time();
-
-	// Start playing the first note
-	play_note(&emuBzrSfx.song->notes[0]);
+	buzzer_post_event(BZR_EVT_PLAY_SFX, song);
 }
 
 /**
@@ -230,108 +421,108 @@ void buzzer_play_bgm(const song_t *song)
 		return;
 	}
 
-	// Save the song pointer
-	emuBzrBgm.song = song;
-	emuBzrBgm.note_index = 0;
-	emuBzrBgm.start_time = esp_timer_get_time();
+	buzzer_post_event(BZR_EVT_PLAY_BGM, song);
+}
 
-	if(NULL == emuBzrSfx.song)
+/**
+ * @brief Start a song on a track. Only called from the audio thread
+ *
+ * @param track The track to start the song on
+ * @param song The song to start
+ */
+static void buzzer_track_start(emu_buzzer_t * track, const song_t *song)
+{
+	if (0 == song->numNotes)
 	{
-		// Start playing the first note
-		play_note(&emuBzrBgm.song->notes[0]);
+		memset(track, 0, sizeof(emu_buzzer_t));
+		return;
 	}
+
+	track->song = song;
+	track->note_index = 0;
+	track->samplesLeft = (song->notes[0].timeMs * SAMPLING_RATE) / 1000;
+	buzzer_track_set_voice(track);
+	// Skip over any leading zero length notes
+	buzzer_track_advance(track, 0);
 }
 
 /**
- * @brief Advance the notes in a specific track and play them if the track is active
- * 
- * @param track The track to check notes in
- * @param isActive true to play notes, false to just advance them
- * @return true  if this track is playing a note
- *         false if it is not 
+ * @brief Advance the notes in a track by a number of output samples. Each
+ * note lasts exactly as many samples as its duration. Only called from the
+ * audio thread
+ *
+ * @param track The track to advance notes in
+ * @param numSamples The number of samples which were played. Must not be more
+ *                   than the samples left in the current note
  */
-bool buzzer_track_check_next_note(emu_buzzer_t * track, bool isActive)
+static void buzzer_track_advance(emu_buzzer_t * track, uint32_t numSamples)
 {
-	// Check if there is a song and there are still notes
-	if ((NULL != track->song) && (track->note_index < track->song->numNotes))
+	if (NULL == track->song)
 	{
-		// Get the current time
-		int64_t cTime = esp_timer_get_time();
-
-		// Check if it's time to play the next note
-		if (cTime - track->start_time >= (1000 * track->song->notes[track->note_index].timeMs))
-		{
-			// Move to the next note
-			track->note_index++;
-			track->start_time = cTime;
+		return;
+	}
+	track->samplesLeft -= numSamples;
 
-			// Loop if requested
-			if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
-			{
-				track->note_index = 0;
-			}
+	// Songs made only of zero length notes would loop forever, so give up
+	// after going through every note without time passing
+	uint32_t zeroLenNotes = 0;
+	while (0 == track->samplesLeft)
+	{
+		// Move to the next note
+		track->note_index++;
 
-			// If there is a note
-			if (track->note_index < track->song->numNotes)
-			{
-				if(isActive)
-				{
-					// Play the note
-					play_note(&track->song->notes[track->note_index]);
-				}
-			}
-			else
-			{
-				if(isActive)
-				{
-					// Song is over
-					buzzer_stop_dont_clear();
-				}
+		// Loop if requested
+		if(track->song->shouldLoop && (track->note_index == track->song->numNotes))
+		{
+			track->note_index = 0;
+		}
 
-				track->start_time = 0;
-				track->note_index = 0;
-				track->song = NULL;
-				// Track is inactive
-				return false;
-			}
+		// If the song is over, or is nothing but zero length notes
+		if ((track->note_index >= track->song->numNotes) || (++zeroLenNotes > track->song->numNotes))
+		{
+			memset(track, 0, sizeof(emu_buzzer_t));
+			return;
 		}
-		// Track is active
-		return true;
+
+		track->samplesLeft = (track->song->notes[track->note_index].timeMs * SAMPLING_RATE) / 1000;
+		buzzer_track_set_voice(track);
 	}
-	// Track is inactive
-	return false;
 }
 
 /**
- * @brief Call this periodically to check if the next note in the song should
- * be played
+ * @brief Set up a track's oscillator for its current note. This picks the
+ * wavetable with as many harmonics as fit under the Nyquist frequency. Only
+ * called from the audio thread
+ *
+ * @param track The track to set the oscillator for
  */
-void buzzer_check_next_note(void)
+static void buzzer_track_set_voice(emu_buzzer_t * track)
 {
-	if(emuMuted)
+	uint32_t freq = track->song->notes[track->note_index].note;
+
+	// Notes at or above the Nyquist frequency can't be played at all
+	if ((SILENCE == freq) || (freq >= (SAMPLING_RATE / 2)))
 	{
+		track->wave = NULL;
+		track->phase = 0;
 		return;
 	}
 
-	bool sfxIsActive = buzzer_track_check_next_note(&emuBzrSfx, true);
-	buzzer_track_check_next_note(&emuBzrBgm, !sfxIsActive);
-}
-
-/**
- * @brief Stop the buzzer without clearing the BGM or SFX data
- * 
- */
-void buzzer_stop_dont_clear(void)
-{
-	pthread_mutex_lock(&buzzerMutex);
-	buzzernote = SILENCE;
-	pthread_mutex_unlock(&buzzerMutex);
+	// Find the band with the most harmonics which won't alias
+	uint8_t band = 0;
+	while ((band < WT_NUM_BANDS - 1) && ((freq << (band + 1)) <= (SAMPLING_RATE / 2)))
+	{
+		band++;
+	}
 
-	play_note(NULL);	
+	// Keep the phase, so back to back notes don't click
+	track->wave = squareWaves[band];
+	track->phaseInc = (((uint64_t)freq) << 32) / SAMPLING_RATE;
 }
 
 /**
- * @brief Stop playing a song on the emulated buzzer
+ * @brief Stop playing a song on the emulated buzzer. Once this returns, the
+ * audio thread has dropped its song pointers, so they may be freed
  */
 void buzzer_stop(void)
 {
@@ -340,44 +531,23 @@ void buzzer_stop(void)
 		return;
 	}
 
-	emuBzrBgm.song = NULL;
-	emuBzrBgm.note_index = 0;
-	emuBzrBgm.start_time = 0;
-
-	emuBzrSfx.song = NULL;
-	emuBzrSfx.note_index = 0;
-	emuBzrSfx.start_time = 0;
-
-	pthread_mutex_lock(&buzzerMutex);
-	buzzernote = SILENCE;
-	pthread_mutex_unlock(&buzzerMutex);
-
-	play_note(NULL);
-}
+	if (!buzzer_post_event(BZR_EVT_STOP, NULL))
+	{
+		return;
+	}
 
-/**
- * @brief Play the current note on the emulated buzzer
- */
-void play_note(const musicalNote_t * notation)
-{
-	if (NULL != notation)
+	// Wait for the audio thread to handle the stop, as long as it's running.
+	// This is on the wall clock, the virtual one stands still in turbo mode
+	int64_t waitStartUs = emuGetWallTimeUs();
+	while (__atomic_load_n(&bzrQueueTail, __ATOMIC_ACQUIRE) != bzrQueueHead)
 	{
-		if (SILENCE == notation->note)
-		{
-			buzzer_stop_dont_clear();
-		}
-		else
+		int64_t nowUs = emuGetWallTimeUs();
+		if ((nowUs - waitStartUs > BZR_STOP_WAIT_US) ||
+			(nowUs - __atomic_load_n(&lastSoundCbUs, __ATOMIC_RELAXED) > BZR_STOP_WAIT_US))
 		{
-			pthread_mutex_lock(&buzzerMutex);
-			buzzernote = notation->note;
-			pthread_mutex_unlock(&buzzerMutex);
+			break;
 		}
-	}
-	else
-	{
-		pthread_mutex_lock(&buzzerMutex);
-		buzzernote = SILENCE;
-		pthread_mutex_unlock(&buzzerMutex);
+		usleep(500);
 	}
 }
 
@@ -434,16 +604,378 @@ void continuous_adc_stop(void)
  */
 uint32_t continuous_adc_read(uint16_t *outSamples)
 {
-	pthread_mutex_lock(&micMutex);
+	// When replaying, live samples are read and thrown away so they don't
+	// back up, and journaled blocks are used instead
+	if (emuIsReplaying())
+	{
+		readLiveSamples(outSamples);
+		int32_t len = emuReplayRead(RP_MIC, outSamples, ADC_READ_SAMPLES * sizeof(uint16_t));
+		return (len > 0) ? (len / sizeof(uint16_t)) : 0;
+	}
+
+	uint32_t samplesRead = readLiveSamples(outSamples);
+	if (samplesRead > 0)
+	{
+		emuRecord(RP_MIC, outSamples, samplesRead * sizeof(uint16_t));
+	}
+	return samplesRead;
+}
+
+/**
+ * @brief Read samples from the mic file if there is one, otherwise from the
+ * sound card
+ *
+ * @param outSamples Where to write the samples, at least ADC_READ_SAMPLES long
+ * @return The number of samples written
+ */
+static uint32_t readLiveSamples(uint16_t *outSamples)
+{
+	if (NULL != emuMicFile.samples)
+	{
+		return adcSampling ? readMicFileSamples(outSamples) : 0;
+	}
+
+	int head = __atomic_load_n(&sshead, __ATOMIC_ACQUIRE);
+	int tail = sstail;
 	uint32_t samplesRead = 0;
 	while (adcSampling &&
-		   (sshead != sstail) &&
-		   samplesRead < (BYTES_PER_READ / sizeof(adc_digi_output_data_t)))
+		   (head != tail) &&
+		   samplesRead < ADC_READ_SAMPLES)
 	{
-		*(outSamples++) = ssamples[sstail];
-		sstail = (sstail + 1) % SSBUF;
+		*(outSamples++) = ssamples[tail];
+		tail = (tail + 1) % SSBUF;
 		samplesRead++;
 	}
-	pthread_mutex_unlock(&micMutex);
+	// Free up the space that was read
+	__atomic_store_n(&sstail, tail, __ATOMIC_RELEASE);
 	return samplesRead;
 }
+
+//==============================================================================
+// Microphone file input
+//==============================================================================
+
+/**
+ * @brief Read a little endian integer from a byte buffer
+ *
+ * @param data The bytes to read from
+ * @param numBytes The number of bytes in the integer, 2 or 4
+ * @return The integer
+ */
+static uint32_t readLE(const uint8_t *data, uint8_t numBytes)
+{
+	uint32_t val = 0;
+	for (int8_t i = numBytes - 1; i >= 0; i--)
+	{
+		val = (val << 8) | data[i];
+	}
+	return val;
+}
+
+/**
+ * @brief Use a WAV or raw PCM file as the microphone instead of the sound
+ * driver. WAV files must be 8 or 16 bit PCM, at any sample rate, with any
+ * number of channels. They are mixed down to mono and resampled to
+ * SAMPLING_RATE. Anything without a RIFF header is treated as raw 16 bit
+ * signed little endian mono PCM at SAMPLING_RATE.
+ *
+ * Must be called before app_main()
+ *
+ * @param fname The file to read
+ * @param realtime true to feed samples at SAMPLING_RATE, false to feed one
+ *                 block per main loop iteration, as fast as the mode can take them
+ * @param exitWhenDone true to end the emulator after the whole file was read
+ * @param logFname A file to log audio callback timing and LED outputs to, "-"
+ *                 for stdout, or NULL to not log
+ * @return true if the file was loaded, false if it wasn't
+ */
+bool emuSetMicFile(const char *fname, bool realtime, bool exitWhenDone, const char *logFname)
+{
+	FILE *fp = fopen(fname, "rb");
+	if (NULL == fp)
+	{
+		ESP_LOGE("EMU", "Couldn't open mic file %s", fname);
+		return false;
+	}
+
+	// Read the whole file into memory
+	fseek(fp, 0, SEEK_END);
+	long fileLen = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	uint8_t *fileData = malloc(fileLen > 0 ? fileLen : 1);
+	size_t bytesRead = fread(fileData, 1, fileLen, fp);
+	fclose(fp);
+	if ((long)bytesRead != fileLen)
+	{
+		ESP_LOGE("EMU", "Couldn't read mic file %s", fname);
+		free(fileData);
+		return false;
+	}
+
+	// Assume raw PCM until a WAV header says otherwise
+	const uint8_t *pcm = fileData;
+	uint32_t pcmLen = fileLen;
+	uint32_t sampleRate = SAMPLING_RATE;
+	uint16_t numChannels = 1;
+	uint16_t bitsPerSample = 16;
+
+	if ((fileLen >= 12) && (0 == memcmp(fileData, "RIFF", 4)) && (0 == memcmp(&fileData[8], "WAVE", 4)))
+	{
+		bool fmtFound = false;
+		pcm = NULL;
+
+		// Walk the chunks for the format and the data
+		long offset = 12;
+		while (offset + 8 <= fileLen)
+		{
+			const uint8_t *chunk = &fileData[offset];
+			uint32_t chunkLen = readLE(&chunk[4], 4);
+			if (chunkLen > (uint32_t)(fileLen - offset - 8))
+			{
+				chunkLen = fileLen - offset - 8;
+			}
+
+			if ((0 == memcmp(chunk, "fmt ", 4)) && (chunkLen >= 16))
+			{
+				uint16_t format = readLE(&chunk[8], 2);
+				numChannels = readLE(&chunk[10], 2);
+				sampleRate = readLE(&chunk[12], 4);
+				bitsPerSample = readLE(&chunk[22], 2);
+				// 1 is PCM, 0xFFFE is WAVE_FORMAT_EXTENSIBLE, which is usually PCM too
+				fmtFound = (1 == format || 0xFFFE == format);
+			}
+			else if (0 == memcmp(chunk, "data", 4))
+			{
+				pcm = &chunk[8];
+				pcmLen = chunkLen;
+			}
+
+			// Chunks are padded to an even length
+			offset += 8 + chunkLen + (chunkLen & 1);
+		}
+
+		if (!fmtFound || NULL == pcm || 0 == numChannels || 0 == sampleRate ||
+			(8 != bitsPerSample && 16 != bitsPerSample))
+		{
+			ESP_LOGE("EMU", "%s must be an 8 or 16 bit PCM WAV", fname);
+			free(fileData);
+			return false;
+		}
+	}
+
+	uint32_t bytesPerFrame = numChannels * (bitsPerSample / 8);
+	uint32_t numFrames = pcmLen / bytesPerFrame;
+	if (0 == numFrames)
+	{
+		ESP_LOGE("EMU", "%s has no samples", fname);
+		free(fileData);
+		return false;
+	}
+
+	// Resample to SAMPLING_RATE with linear interpolation. The position in the
+	// source is 16.16 fixed point
+	uint64_t step = ((uint64_t)sampleRate << 16) / SAMPLING_RATE;
+	uint32_t numSamples = (((uint64_t)(numFrames - 1) << 16) / step) + 1;
+	uint16_t *samples = malloc(numSamples * sizeof(uint16_t));
+
+	uint64_t pos = 0;
+	for (uint32_t i = 0; i < numSamples; i++, pos += step)
+	{
+		uint32_t frameIdx = pos >> 16;
+		int32_t frac = pos & 0xFFFF;
+
+		// Mix the channels of this frame and the next one down to mono
+		int32_t mono[2] = {0};
+		for (uint8_t f = 0; f < 2; f++)
+		{
+			uint32_t idx = (frameIdx + f < numFrames) ? (frameIdx + f) : (numFrames - 1);
+			const uint8_t *frame = &pcm[idx * bytesPerFrame];
+			for (uint16_t c = 0; c < numChannels; c++)
+			{
+				if (8 == bitsPerSample)
+				{
+					// 8 bit WAVs are unsigned
+					mono[f] += (frame[c] - 128) << 8;
+				}
+				else
+				{
+					mono[f] += (int16_t)readLE(&frame[c * 2], 2);
+				}
+			}
+			mono[f] /= numChannels;
+		}
+		int32_t s = mono[0] + (((mono[1] - mono[0]) * frac) >> 16);
+
+		// Same conversion as the sound driver, 12 bit sound, unsigned
+		samples[i] = (s + INT16_MAX) >> 4;
+	}
+	free(fileData);
+
+	memset(&emuMicFile, 0, sizeof(emuMicFile));
+	emuMicFile.samples = samples;
+	emuMicFile.numSamples = numSamples;
+	emuMicFile.realtime = realtime;
+	emuMicFile.exitWhenDone = exitWhenDone;
+
+	if (NULL != logFname)
+	{
+		if (0 == strcmp(logFname, "-"))
+		{
+			emuMicFile.log = stdout;
+		}
+		else if (NULL == (emuMicFile.log = fopen(logFname, "w")))
+		{
+			ESP_LOGE("EMU", "Couldn't open mic log %s", logFname);
+		}
+	}
+
+	ESP_LOGI("EMU", "Mic input from %s, %u samples (%u.%03us) %s", fname, numSamples,
+		numSamples / SAMPLING_RATE, ((numSamples % SAMPLING_RATE) * 1000) / SAMPLING_RATE,
+		realtime ? "in real time" : "as fast as possible");
+	return true;
+}
+
+/**
+ * @brief Hand the next samples from the mic file to continuous_adc_read()
+ *
+ * In real time mode, this returns however many samples should have been
+ * recorded since the file started. In fast mode, this returns one full block,
+ * then nothing on the next call so the main loop gets to run between blocks.
+ *
+ * @param outSamples Where to write the samples, at least ADC_READ_SAMPLES long
+ * @return The number of samples written
+ */
+static uint32_t readMicFileSamples(uint16_t *outSamples)
+{
+	if (emuMicFile.readIdx >= emuMicFile.numSamples)
+	{
+		finishMicFile();
+		return 0;
+	}
+
+	uint32_t available;
+	if (emuMicFile.realtime)
+	{
+		int64_t now = esp_timer_get_time();
+		if (0 == emuMicFile.startTimeUs)
+		{
+			emuMicFile.startTimeUs = now;
+		}
+		uint64_t due = ((now - emuMicFile.startTimeUs) * SAMPLING_RATE) / 1000000;
+		available = (due > emuMicFile.readIdx) ? (due - emuMicFile.readIdx) : 0;
+	}
+	else
+	{
+		// Alternate between a block and nothing, one block per main loop
+		emuMicFile.blockPending = !emuMicFile.blockPending;
+		available = emuMicFile.blockPending ? ADC_READ_SAMPLES : 0;
+	}
+
+	uint32_t toRead = emuMicFile.numSamples - emuMicFile.readIdx;
+	if (toRead > available)
+	{
+		toRead = available;
+	}
+	if (toRead > ADC_READ_SAMPLES)
+	{
+		toRead = ADC_READ_SAMPLES;
+	}
+
+	memcpy(outSamples, &emuMicFile.samples[emuMicFile.readIdx], toRead * sizeof(uint16_t));
+	emuMicFile.readIdx += toRead;
+	return toRead;
+}
+
+/**
+ * @brief Print a summary once the whole mic file was read, then stop the
+ * emulator if requested
+ */
+static void finishMicFile(void)
+{
+	if (emuMicFile.finished)
+	{
+		return;
+	}
+	emuMicFile.finished = true;
+
+	char summary[128];
+	snprintf(summary, sizeof(summary), "done,%u,%u,%" PRId64 ",%" PRId64,
+		emuMicFile.numSamples, emuMicFile.numBlocks,
+		emuMicFile.numBlocks ? (emuMicFile.totalCbUs / emuMicFile.numBlocks) : 0,
+		emuMicFile.maxCbUs);
+
+	if (NULL != emuMicFile.log)
+	{
+		fprintf(emuMicFile.log, "%s\n", summary);
+		fflush(emuMicFile.log);
+	}
+	ESP_LOGI("EMU", "Mic file finished: samples,blocks,avgUs,maxUs %s", &summary[5]);
+
+	if (emuMicFile.exitWhenDone)
+	{
+		threadsShouldRun = false;
+	}
+}
+
+/**
+ * @brief Log how long a mode's audio callback took, for the block of samples
+ * which was just read from the mic file. Does nothing for live input
+ *
+ * @param numSamples The number of samples passed to the callback
+ * @param elapsedUs How long the callback took, in microseconds
+ */
+void emuMicFileLogAudioCb(uint32_t numSamples, int64_t elapsedUs)
+{
+	if (NULL == emuMicFile.samples)
+	{
+		return;
+	}
+
+	emuMicFile.numBlocks++;
+	emuMicFile.totalCbUs += elapsedUs;
+	if (elapsedUs > emuMicFile.maxCbUs)
+	{
+		emuMicFile.maxCbUs = elapsedUs;
+	}
+
+	if (NULL != emuMicFile.log)
+	{
+		// Timestamps are in samples, so logs match no matter how fast the file was played
+		fprintf(emuMicFile.log, "audio,%u,%u,%" PRId64 "\n", emuMicFile.readIdx, numSamples, elapsedUs);
+	}
+}
+
+/**
+ * @brief Log the LED colors a mode set, timestamped by the position in the mic
+ * file. Does nothing for live input or if there is no log
+ *
+ * @param leds The LED colors, before brightness is applied
+ * @param numLeds The number of LEDs
+ */
+void emuMicFileLogLeds(const led_t *leds, uint8_t numLeds)
+{
+	if ((NULL == emuMicFile.samples) || (NULL == emuMicFile.log))
+	{
+		return;
+	}
+
+	fprintf(emuMicFile.log, "leds,%u", emuMicFile.readIdx);
+	for (uint8_t i = 0; i < numLeds; i++)
+	{
+		fprintf(emuMicFile.log, ",%02x%02x%02x", leds[i].r, leds[i].g, leds[i].b);
+	}
+	fprintf(emuMicFile.log, "\n");
+}
+
+/**
+ * @brief Free the mic file and close its log
+ */
+static void deinitMicFile(void)
+{
+	if (NULL != emuMicFile.log && stdout != emuMicFile.log)
+	{
+		fclose(emuMicFile.log);
+	}
+	free(emuMicFile.samples);
+	memset(&emuMicFile, 0, sizeof(emuMicFile));
+}
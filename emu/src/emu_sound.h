@@ -1,6 +1,15 @@
 #ifndef _EMU_SOUND_H_
 #define _EMU_SOUND_H_
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "led_util.h"
+
 void deinitSound(void);
 
+bool emuSetMicFile(const char *fname, bool realtime, bool exitWhenDone, const char *logFname);
+void emuMicFileLogAudioCb(uint32_t numSamples, int64_t elapsedUs);
+void emuMicFileLogLeds(const led_t *leds, uint8_t numLeds);
+
 #endif
\ No newline at end of file
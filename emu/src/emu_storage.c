@@ -8,6 +8,16 @@
 #include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#if defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__MINGW32__)
+    #define USING_WINDOWS 1
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
 
 #include "esp_log.h"
 #include "cJSON.h"
@@ -15,63 +25,166 @@
 #include "emu_esp.h"
 #include "nvs_manager.h"
 #include "spiffs_manager.h"
+#include "asset_pack.h"
 
 //==============================================================================
 // Defines
 //==============================================================================
 
 #define NVS_JSON_FILE "nvs.json"
+#define NVS_TMP_FILE  "nvs.json.tmp"
+
+// Writes are coalesced for this long before the file is written
+#define NVS_FLUSH_DELAY_US 250000
+
+#define SPIFFS_DIR "./spiffs_image/"
+
+// Written by spiffs_file_preprocessor next to SPIFFS_DIR
+#define ASSET_PACK_FILE "./spiffs_image.pack"
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef enum
+{
+    NVS_INT32,
+    NVS_BLOB
+} nvsType_t;
+
+typedef struct
+{
+    char* key;
+    uint32_t hash;
+    nvsType_t type;
+    int32_t val;     //!< The value, if type is NVS_INT32
+    uint8_t* blob;   //!< The value, if type is NVS_BLOB
+    size_t blobLen;  //!< The length of blob
+} nvsEntry_t;
+
+typedef struct
+{
+    char* name;
+    size_t offset; //!< Where the file starts in spiffsImage
+    size_t size;   //!< The file size, not counting the null terminator after it
+} spiffsFile_t;
 
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
-char* blobToStr(void * value, size_t length);
+char* blobToStr(const void * value, size_t length);
 int hexCharToInt(char c);
-void strToBlob(char * str, void * outBlob, size_t blobLen);
+void strToBlob(const char * str, void * outBlob, size_t blobLen);
+
+static uint32_t nvsHash(const char* key);
+static nvsEntry_t* nvsFind(const char* key, uint32_t hash);
+static nvsEntry_t* nvsFindOrAdd(const char* key);
+static void nvsLoad(void);
+static bool nvsFlush(void);
+static void* nvsWriterThread(void* arg);
+static void nvsMarkDirty(void);
+
+static int spiffsFileCmp(const void* a, const void* b);
+static int spiffsNameCmp(const void* key, const void* file);
+static const spiffsFile_t* spiffsFind(const char* fname);
+static bool spiffsReadFromDisk(const char * fname, uint8_t ** output, size_t * outsize);
+static void spiffsFreeImage(void);
+static bool spiffsMapPack(void);
+static void spiffsUnmapPack(void);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+// Entries are kept in the order they were added, so the file stays stable
+static nvsEntry_t* nvsEntries = NULL;
+static uint32_t nvsNumEntries = 0;
+static uint32_t nvsEntriesCap = 0;
+
+// Open addressed hash table of indices into nvsEntries, -1 is empty. The
+// capacity is a power of two and is kept at least twice the number of entries
+static int32_t* nvsIndex = NULL;
+static uint32_t nvsIndexCap = 0;
+
+// Protects everything above, and the flags below
+static pthread_mutex_t nvsMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t nvsCond = PTHREAD_COND_INITIALIZER;
+
+static bool nvsLoaded = false;
+static bool nvsDirty = false;
+static bool nvsWriterShouldRun = false;
+static pthread_t nvsWriter;
+
+// Every file in SPIFFS_DIR, packed into one read-only mapping, and an index of
+// them sorted by name
+static uint8_t* spiffsImage = NULL;
+static size_t spiffsImageSize = 0;
+static spiffsFile_t* spiffsFiles = NULL;
+static uint32_t spiffsNumFiles = 0;
+
+// The asset pack, mapped read-only like the assets partition on the swadge.
+// When it's mapped, the image above isn't built
+static uint8_t* assetPack = NULL;
+static size_t assetPackSize = 0;
 
 //==============================================================================
 // NVS
 //==============================================================================
 
 /**
- * @brief Initialize NVS by making sure the file exists
+ * @brief Initialize NVS by loading the file into memory, once. Changes are
+ * written back to the file by a background thread
  *
  * @param firstTry unused
- * @return true if the file exists or was created, false otherwise
+ * @return true if NVS is ready, false otherwise
  */
 bool initNvs(bool firstTry UNUSED)
 {
-    // Check if the json file exists
-    if( access( NVS_JSON_FILE, F_OK ) != 0 )
+    pthread_mutex_lock(&nvsMutex);
+    if(!nvsLoaded)
     {
-        FILE * nvsFile = fopen(NVS_JSON_FILE, "wb");
-        if(NULL != nvsFile)
-        {
-            if(1 == fwrite("{}", sizeof("{}"), 1, nvsFile))
-            {
-                // Wrote successfully
-                fclose(nvsFile);
-                return true;
-            }
-            else
-            {
-                // Failed to write
-                fclose(nvsFile);
-                return false;
-            }
-        }
-        else
-        {
-            // Couldn't open file
-            return false;
-        }
+        nvsLoad();
+        nvsLoaded = true;
+        nvsWriterShouldRun = (0 == pthread_create(&nvsWriter, NULL, nvsWriterThread, NULL));
     }
-    else
+    pthread_mutex_unlock(&nvsMutex);
+    return true;
+}
+
+/**
+ * @brief Stop the background writer, write any changes which haven't been
+ * written yet, and free NVS memory
+ */
+void emuNvsDeinit(void)
+{
+    pthread_mutex_lock(&nvsMutex);
+    bool writerRunning = nvsWriterShouldRun;
+    nvsWriterShouldRun = false;
+    pthread_cond_signal(&nvsCond);
+    pthread_mutex_unlock(&nvsMutex);
+
+    if(writerRunning)
     {
-        // File exists
-        return true;
+        pthread_join(nvsWriter, NULL);
+    }
+    nvsFlush();
+
+    pthread_mutex_lock(&nvsMutex);
+    for(uint32_t i = 0; i < nvsNumEntries; i++)
+    {
+        free(nvsEntries[i].key);
+        free(nvsEntries[i].blob);
     }
+    free(nvsEntries);
+    free(nvsIndex);
+    nvsEntries = NULL;
+    nvsIndex = NULL;
+    nvsNumEntries = 0;
+    nvsEntriesCap = 0;
+    nvsIndexCap = 0;
+    nvsLoaded = false;
+    pthread_mutex_unlock(&nvsMutex);
 }
 
 /**
@@ -83,78 +196,21 @@ bool initNvs(bool firstTry UNUSED)
  */
 bool writeNvs32(const char* key, int32_t val)
 {
-    // Open the file
-    FILE * nvsFile = fopen(NVS_JSON_FILE, "rb");
-    if(NULL != nvsFile)
-    {
-        // Get the file size
-        fseek(nvsFile, 0L, SEEK_END);
-        size_t fsize = ftell(nvsFile);
-        fseek(nvsFile, 0L, SEEK_SET);
+    initNvs(true);
 
-        // Read the file
-        char fbuf[fsize + 1];
-        fbuf[fsize] = 0;
-        if(fsize == fread(fbuf, 1, fsize, nvsFile))
-        {
-            // Close the file
-            fclose(nvsFile);
-
-            // Parse the JSON
-            cJSON * json = cJSON_Parse(fbuf);
-
-            // Check if the key alredy exists
-            cJSON * jsonIter;
-            bool keyExists = false;
-            cJSON_ArrayForEach(jsonIter, json)
-            {
-                if(0 == strcmp(jsonIter->string, key))
-                {
-                    keyExists = true;
-                }
-            }
-
-            // Add or replace the item
-            cJSON * jsonVal = cJSON_CreateNumber(val);
-            if(keyExists)
-            {
-                cJSON_ReplaceItemInObject(json, key, jsonVal);
-            }
-            else
-            {
-                cJSON_AddItemToObject(json, key, jsonVal);
-            }
-
-            // Write the new JSON back to the file
-            FILE * nvsFileW = fopen(NVS_JSON_FILE, "wb");
-            if(NULL != nvsFileW)
-            {
-                char * jsonStr = cJSON_Print(json);
-                fprintf(nvsFileW, "%s", jsonStr);
-                fclose(nvsFileW);
-
-                free(jsonStr);
-                cJSON_Delete(json);
-
-                return true;
-            }
-            else
-            {
-                // Couldn't open file to write
-            }
-            cJSON_Delete(json);
-        }
-        else
-        {
-            // Couldn't read file
-            fclose(nvsFile);
-        }
-    }
-    else
+    pthread_mutex_lock(&nvsMutex);
+    nvsEntry_t* entry = nvsFindOrAdd(key);
+    if(NULL != entry)
     {
-        // couldn't open file to read
+        free(entry->blob);
+        entry->blob = NULL;
+        entry->blobLen = 0;
+        entry->type = NVS_INT32;
+        entry->val = val;
+        nvsMarkDirty();
     }
-    return false;
+    pthread_mutex_unlock(&nvsMutex);
+    return NULL != entry;
 }
 
 /**
@@ -166,112 +222,47 @@ bool writeNvs32(const char* key, int32_t val)
  */
 bool readNvs32(const char* key, int32_t* outVal)
 {
-    // Open the file
-    FILE * nvsFile = fopen(NVS_JSON_FILE, "rb");
-    if(NULL != nvsFile)
-    {
-        // Get the file size
-        fseek(nvsFile, 0L, SEEK_END);
-        size_t fsize = ftell(nvsFile);
-        fseek(nvsFile, 0L, SEEK_SET);
+    initNvs(true);
 
-        // Read the file
-        char fbuf[fsize + 1];
-        fbuf[fsize] = 0;
-        if(fsize == fread(fbuf, 1, fsize, nvsFile))
-        {
-            // Close the file
-            fclose(nvsFile);
-
-            // Parse the JSON
-            cJSON * json = cJSON_Parse(fbuf);
-            cJSON * jsonIter = json;
-
-            // Find the requested key
-            char *current_key = NULL;
-            cJSON_ArrayForEach(jsonIter, json)
-            {
-                current_key = jsonIter->string;
-                if (current_key != NULL)
-                {
-                    // If the key matches
-                    if(0 == strcmp(current_key, key))
-                    {
-                        // Return the value
-                        *outVal = (int32_t)cJSON_GetNumberValue(jsonIter);
-                        cJSON_Delete(json);
-                        return true;
-                    }
-                }
-            }
-            cJSON_Delete(json);
-        }
-        else
-        {
-            fclose(nvsFile);
-        }
+    bool found = false;
+    pthread_mutex_lock(&nvsMutex);
+    nvsEntry_t* entry = nvsFind(key, nvsHash(key));
+    if(NULL != entry && NVS_INT32 == entry->type)
+    {
+        *outVal = entry->val;
+        found = true;
     }
-    return false;
+    pthread_mutex_unlock(&nvsMutex);
+    return found;
 }
 
 /**
  * @brief Read a blob from NVS with a given string key
  * 
  * @param key The key for the value to read
- * @param out_value The value will be written to this memory. It must be allocated before calling readNvsBlob()
+ * @param out_value The value will be written to this memory. It must be allocated before calling readNvsBlob().
+ *                  If this is NULL, only the length is returned
  * @param length The length of the value that was read
  * @return true if the value was read, false if it was not
  */
 bool readNvsBlob(const char* key, void* out_value, size_t* length)
 {
-    // Open the file
-    FILE * nvsFile = fopen(NVS_JSON_FILE, "rb");
-    if(NULL != nvsFile)
-    {
-        // Get the file size
-        fseek(nvsFile, 0L, SEEK_END);
-        size_t fsize = ftell(nvsFile);
-        fseek(nvsFile, 0L, SEEK_SET);
-
-        // Read the file
-        char fbuf[fsize + 1];
-        fbuf[fsize] = 0;
-        if(fsize == fread(fbuf, 1, fsize, nvsFile))
-        {
-            // Close the file
-            fclose(nvsFile);
+    initNvs(true);
 
-            // Parse the JSON
-            cJSON * json = cJSON_Parse(fbuf);
-            cJSON * jsonIter = json;
-
-            // Find the requested key
-            char *current_key = NULL;
-            cJSON_ArrayForEach(jsonIter, json)
-            {
-                current_key = jsonIter->string;
-                if (current_key != NULL)
-                {
-                    // If the key matches
-                    if(0 == strcmp(current_key, key))
-                    {
-                        // Return the value
-                        char* strBlob = cJSON_GetStringValue(jsonIter);
-                        *length = strlen(strBlob) / 2;
-                        strToBlob(strBlob, out_value, *length);
-                        cJSON_Delete(json);
-                        return true;
-                    }
-                }
-            }
-            cJSON_Delete(json);
-        }
-        else
+    bool found = false;
+    pthread_mutex_lock(&nvsMutex);
+    nvsEntry_t* entry = nvsFind(key, nvsHash(key));
+    if(NULL != entry && NVS_BLOB == entry->type)
+    {
+        *length = entry->blobLen;
+        if(NULL != out_value)
         {
-            fclose(nvsFile);
+            memcpy(out_value, entry->blob, entry->blobLen);
         }
+        found = true;
     }
-    return false;
+    pthread_mutex_unlock(&nvsMutex);
+    return found;
 }
 
 /**
@@ -284,80 +275,320 @@ bool readNvsBlob(const char* key, void* out_value, size_t* length)
  */
 bool writeNvsBlob(const char* key, const void* value, size_t length)
 {
-    // Open the file
-    FILE * nvsFile = fopen(NVS_JSON_FILE, "rb");
-    if(NULL != nvsFile)
+    initNvs(true);
+
+    bool written = false;
+    pthread_mutex_lock(&nvsMutex);
+    nvsEntry_t* entry = nvsFindOrAdd(key);
+    if(NULL != entry)
     {
-        // Get the file size
-        fseek(nvsFile, 0L, SEEK_END);
-        size_t fsize = ftell(nvsFile);
-        fseek(nvsFile, 0L, SEEK_SET);
+        uint8_t* blob = malloc(length ? length : 1);
+        if(NULL != blob)
+        {
+            memcpy(blob, value, length);
+            free(entry->blob);
+            entry->blob = blob;
+            entry->blobLen = length;
+            entry->type = NVS_BLOB;
+            nvsMarkDirty();
+            written = true;
+        }
+    }
+    pthread_mutex_unlock(&nvsMutex);
+    return written;
+}
 
-        // Read the file
-        char fbuf[fsize + 1];
-        fbuf[fsize] = 0;
-        if(fsize == fread(fbuf, 1, fsize, nvsFile))
+/**
+ * @brief FNV-1a hash of a key
+ *
+ * @param key The key to hash
+ * @return The hash
+ */
+static uint32_t nvsHash(const char* key)
+{
+    uint32_t hash = 2166136261u;
+    while(*key)
+    {
+        hash = (hash ^ (uint8_t)(*key++)) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Find an entry. nvsMutex must be held
+ *
+ * @param key The key to find
+ * @param hash The key's hash, from nvsHash()
+ * @return The entry, or NULL if there isn't one for this key
+ */
+static nvsEntry_t* nvsFind(const char* key, uint32_t hash)
+{
+    if(0 == nvsIndexCap)
+    {
+        return NULL;
+    }
+
+    uint32_t mask = nvsIndexCap - 1;
+    for(uint32_t slot = hash & mask; -1 != nvsIndex[slot]; slot = (slot + 1) & mask)
+    {
+        nvsEntry_t* entry = &nvsEntries[nvsIndex[slot]];
+        if(entry->hash == hash && 0 == strcmp(entry->key, key))
         {
-            // Close the file
-            fclose(nvsFile);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Find an entry, or add an empty NVS_INT32 one if there isn't one for
+ * this key. nvsMutex must be held
+ *
+ * @param key The key to find or add
+ * @return The entry, or NULL if memory couldn't be allocated
+ */
+static nvsEntry_t* nvsFindOrAdd(const char* key)
+{
+    uint32_t hash = nvsHash(key);
+    nvsEntry_t* entry = nvsFind(key, hash);
+    if(NULL != entry)
+    {
+        return entry;
+    }
 
-            // Parse the JSON
-            cJSON * json = cJSON_Parse(fbuf);
+    // Make room for another entry
+    if(nvsNumEntries == nvsEntriesCap)
+    {
+        uint32_t newCap = nvsEntriesCap ? (nvsEntriesCap * 2) : 32;
+        nvsEntry_t* newEntries = realloc(nvsEntries, newCap * sizeof(nvsEntry_t));
+        if(NULL == newEntries)
+        {
+            return NULL;
+        }
+        nvsEntries = newEntries;
+        nvsEntriesCap = newCap;
+    }
 
-            // Check if the key alredy exists
-            cJSON * jsonIter;
-            bool keyExists = false;
-            cJSON_ArrayForEach(jsonIter, json)
+    // Keep the index at most half full, rebuilding it when it grows
+    if((nvsNumEntries + 1) * 2 > nvsIndexCap)
+    {
+        uint32_t newCap = nvsIndexCap ? (nvsIndexCap * 2) : 64;
+        int32_t* newIndex = malloc(newCap * sizeof(int32_t));
+        if(NULL == newIndex)
+        {
+            return NULL;
+        }
+        memset(newIndex, 0xFF, newCap * sizeof(int32_t));
+        for(uint32_t i = 0; i < nvsNumEntries; i++)
+        {
+            uint32_t slot = nvsEntries[i].hash & (newCap - 1);
+            while(-1 != newIndex[slot])
             {
-                if(0 == strcmp(jsonIter->string, key))
-                {
-                    keyExists = true;
-                }
+                slot = (slot + 1) & (newCap - 1);
             }
+            newIndex[slot] = i;
+        }
+        free(nvsIndex);
+        nvsIndex = newIndex;
+        nvsIndexCap = newCap;
+    }
 
-            // Add or replace the item
-            char * blobStr = blobToStr(value, length);
-            cJSON * jsonVal = cJSON_CreateString(blobStr);
-            free(blobStr);
-            if(keyExists)
+    char* keyCopy = strdup(key);
+    if(NULL == keyCopy)
+    {
+        return NULL;
+    }
+
+    // Add the entry
+    entry = &nvsEntries[nvsNumEntries];
+    memset(entry, 0, sizeof(nvsEntry_t));
+    entry->key = keyCopy;
+    entry->hash = hash;
+    entry->type = NVS_INT32;
+
+    uint32_t slot = hash & (nvsIndexCap - 1);
+    while(-1 != nvsIndex[slot])
+    {
+        slot = (slot + 1) & (nvsIndexCap - 1);
+    }
+    nvsIndex[slot] = nvsNumEntries++;
+
+    return entry;
+}
+
+/**
+ * @brief Load NVS_JSON_FILE into memory, if it exists. Numbers are 32 bit
+ * values and strings are hex encoded blobs. nvsMutex must be held
+ */
+static void nvsLoad(void)
+{
+    FILE * nvsFile = fopen(NVS_JSON_FILE, "rb");
+    if(NULL == nvsFile)
+    {
+        // Nothing saved yet
+        return;
+    }
+
+    // Get the file size
+    fseek(nvsFile, 0L, SEEK_END);
+    size_t fsize = ftell(nvsFile);
+    fseek(nvsFile, 0L, SEEK_SET);
+
+    // Read the file
+    char* fbuf = malloc(fsize + 1);
+    if(NULL != fbuf && fsize == fread(fbuf, 1, fsize, nvsFile))
+    {
+        fbuf[fsize] = 0;
+
+        // Parse the JSON and copy every item
+        cJSON * json = cJSON_Parse(fbuf);
+        cJSON * jsonIter;
+        cJSON_ArrayForEach(jsonIter, json)
+        {
+            if(NULL == jsonIter->string)
             {
-                cJSON_ReplaceItemInObject(json, key, jsonVal);
+                continue;
             }
-            else
+
+            nvsEntry_t* entry = nvsFindOrAdd(jsonIter->string);
+            if(NULL == entry)
             {
-                cJSON_AddItemToObject(json, key, jsonVal);
+                break;
             }
 
-            // Write the new JSON back to the file
-            FILE * nvsFileW = fopen(NVS_JSON_FILE, "wb");
-            if(NULL != nvsFileW)
+            if(cJSON_IsString(jsonIter))
             {
-                char * jsonStr = cJSON_Print(json);
-                fprintf(nvsFileW, "%s", jsonStr);
-                fclose(nvsFileW);
-
-                free(jsonStr);
-                cJSON_Delete(json);
-
-                return true;
+                const char* strBlob = cJSON_GetStringValue(jsonIter);
+                entry->type = NVS_BLOB;
+                entry->blobLen = strlen(strBlob) / 2;
+                entry->blob = malloc(entry->blobLen ? entry->blobLen : 1);
+                if(NULL != entry->blob)
+                {
+                    strToBlob(strBlob, entry->blob, entry->blobLen);
+                }
+                else
+                {
+                    entry->blobLen = 0;
+                }
             }
             else
             {
-                // Couldn't open file to write
+                entry->type = NVS_INT32;
+                entry->val = (int32_t)cJSON_GetNumberValue(jsonIter);
             }
-            cJSON_Delete(json);
+        }
+        cJSON_Delete(json);
+    }
+    else
+    {
+        ESP_LOGE("NVS", "Couldn't read %s", NVS_JSON_FILE);
+    }
+    free(fbuf);
+    fclose(nvsFile);
+}
+
+/**
+ * @brief Note that NVS changed and wake up the writer. nvsMutex must be held
+ */
+static void nvsMarkDirty(void)
+{
+    nvsDirty = true;
+    pthread_cond_signal(&nvsCond);
+}
+
+/**
+ * @brief Write NVS to a temporary file, then rename it over NVS_JSON_FILE, so
+ * the file is never left half written. Does nothing if NVS hasn't changed
+ *
+ * @return true if the file is up to date, false if writing failed
+ */
+static bool nvsFlush(void)
+{
+    // Build the JSON while holding the lock, then write it without
+    pthread_mutex_lock(&nvsMutex);
+    if(!nvsDirty)
+    {
+        pthread_mutex_unlock(&nvsMutex);
+        return true;
+    }
+    nvsDirty = false;
+
+    cJSON * json = cJSON_CreateObject();
+    for(uint32_t i = 0; i < nvsNumEntries; i++)
+    {
+        nvsEntry_t* entry = &nvsEntries[i];
+        if(NVS_BLOB == entry->type)
+        {
+            char * blobStr = blobToStr(entry->blob, entry->blobLen);
+            cJSON_AddItemToObject(json, entry->key, cJSON_CreateString(blobStr));
+            free(blobStr);
         }
         else
         {
-            // Couldn't read file
-            fclose(nvsFile);
+            cJSON_AddItemToObject(json, entry->key, cJSON_CreateNumber(entry->val));
         }
     }
-    else
+    pthread_mutex_unlock(&nvsMutex);
+
+    char * jsonStr = cJSON_Print(json);
+    cJSON_Delete(json);
+
+    bool written = false;
+    FILE * nvsFileW = fopen(NVS_TMP_FILE, "wb");
+    if(NULL != nvsFileW)
     {
-        // couldn't open file to read
+        size_t len = strlen(jsonStr);
+        written = (len == fwrite(jsonStr, 1, len, nvsFileW));
+        written = (0 == fclose(nvsFileW)) && written;
     }
-    return false;
+    free(jsonStr);
+
+    if(written)
+    {
+#if defined(USING_WINDOWS)
+        written = MoveFileExA(NVS_TMP_FILE, NVS_JSON_FILE, MOVEFILE_REPLACE_EXISTING);
+#else
+        written = (0 == rename(NVS_TMP_FILE, NVS_JSON_FILE));
+#endif
+    }
+
+    if(!written)
+    {
+        // The writer will try again, and so will exit
+        ESP_LOGE("NVS", "Couldn't write %s", NVS_JSON_FILE);
+        pthread_mutex_lock(&nvsMutex);
+        nvsDirty = true;
+        pthread_mutex_unlock(&nvsMutex);
+    }
+    return written;
+}
+
+/**
+ * @brief Write NVS to the file in the background. Once there is a change, wait
+ * a moment for more to arrive, then write them all at once
+ *
+ * @param arg unused
+ * @return NULL
+ */
+static void* nvsWriterThread(void* arg UNUSED)
+{
+    pthread_mutex_lock(&nvsMutex);
+    while(nvsWriterShouldRun)
+    {
+        if(!nvsDirty)
+        {
+            pthread_cond_wait(&nvsCond, &nvsMutex);
+            continue;
+        }
+        pthread_mutex_unlock(&nvsMutex);
+
+        usleep(NVS_FLUSH_DELAY_US);
+        nvsFlush();
+
+        pthread_mutex_lock(&nvsMutex);
+    }
+    pthread_mutex_unlock(&nvsMutex);
+    return NULL;
 }
 
 /**
@@ -367,14 +598,15 @@ bool writeNvsBlob(const char* key, const void* value, size_t length)
  * @param length The length of the blob
  * @return char* An allocated hex string, must be free()'d when done
  */
-char* blobToStr(void * value, size_t length)
+char* blobToStr(const void * value, size_t length)
 {
-    uint8_t * value8 = (uint8_t *)value;
+    const uint8_t * value8 = (const uint8_t *)value;
     char * blobStr = malloc((length * 2) + 1);
     for(size_t i = 0; i < length; i++)
     {
         sprintf(&blobStr[i*2], "%02X", value8[i]);
     }
+    blobStr[length * 2] = 0;
     return blobStr;
 }
 
@@ -408,7 +640,7 @@ int hexCharToInt(char c)
  * @param outBlob The blob will be written here, must already be allocated
  * @param blobLen The length of the blob to write
  */
-void strToBlob(char * str, void * outBlob, size_t blobLen)
+void strToBlob(const char * str, void * outBlob, size_t blobLen)
 {
     uint8_t * outBlob8 = (uint8_t*)outBlob;
     for(size_t i = 0; i < blobLen; i++)
@@ -424,23 +656,131 @@ void strToBlob(char * str, void * outBlob, size_t blobLen)
 //==============================================================================
 
 /**
- * @brief Do nothing, the normal file system replaces SPIFFS well
+ * @brief Map the asset pack written by spiffs_file_preprocessor, like the
+ * assets partition on the swadge. If there's no pack, pack every file in
+ * SPIFFS_DIR into one read-only memory mapping instead, and index them by name.
+ * Either way, assets are then read without touching the disk. If neither
+ * works, files are read from SPIFFS_DIR directly
  *
  * @return true
  */
 bool initSpiffs(void)
 {
+    if(NULL != spiffsImage || NULL != assetPack)
+    {
+        return true;
+    }
+
+    if(spiffsMapPack())
+    {
+        ESP_LOGI("SPIFFS", "Mapped %s, %u bytes", ASSET_PACK_FILE, (uint32_t)assetPackSize);
+        return true;
+    }
+
+    DIR* dir = opendir(SPIFFS_DIR);
+    if(NULL == dir)
+    {
+        ESP_LOGE("SPIFFS", "Failed to open %s", SPIFFS_DIR);
+        return true;
+    }
+
+    // Find every file and its size
+    uint32_t filesCap = 0;
+    struct dirent* ent;
+    while(NULL != (ent = readdir(dir)))
+    {
+        char path[sizeof(SPIFFS_DIR) + 256];
+        snprintf(path, sizeof(path), "%s%s", SPIFFS_DIR, ent->d_name);
+        struct stat st;
+        if(0 != stat(path, &st) || !S_ISREG(st.st_mode))
+        {
+            continue;
+        }
+
+        if(spiffsNumFiles == filesCap)
+        {
+            filesCap = filesCap ? (filesCap * 2) : 256;
+            spiffsFile_t* newFiles = realloc(spiffsFiles, filesCap * sizeof(spiffsFile_t));
+            if(NULL == newFiles)
+            {
+                break;
+            }
+            spiffsFiles = newFiles;
+        }
+        spiffsFiles[spiffsNumFiles].name = strdup(ent->d_name);
+        spiffsFiles[spiffsNumFiles].size = st.st_size;
+        spiffsNumFiles++;
+    }
+    closedir(dir);
+
+    // Sort by name for lookups, then lay the files out in that order. Each is
+    // followed by a null terminator and padded to eight bytes
+    qsort(spiffsFiles, spiffsNumFiles, sizeof(spiffsFile_t), spiffsFileCmp);
+    spiffsImageSize = 0;
+    for(uint32_t i = 0; i < spiffsNumFiles; i++)
+    {
+        spiffsFiles[i].offset = spiffsImageSize;
+        spiffsImageSize += (spiffsFiles[i].size + 1 + 7) & ~((size_t)7);
+    }
+
+    // Anonymous mappings start zeroed, so the terminators are already there
+#if defined(USING_WINDOWS)
+    spiffsImage = calloc(1, spiffsImageSize ? spiffsImageSize : 1);
+#else
+    spiffsImage = mmap(NULL, spiffsImageSize ? spiffsImageSize : 1, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == spiffsImage)
+    {
+        spiffsImage = NULL;
+    }
+#endif
+    if(NULL == spiffsImage)
+    {
+        ESP_LOGE("SPIFFS", "Failed to allocate a %u byte image", (uint32_t)spiffsImageSize);
+        spiffsFreeImage();
+        return true;
+    }
+
+    // Read every file in
+    for(uint32_t i = 0; i < spiffsNumFiles; i++)
+    {
+        char path[sizeof(SPIFFS_DIR) + 256];
+        snprintf(path, sizeof(path), "%s%s", SPIFFS_DIR, spiffsFiles[i].name);
+        FILE* f = fopen(path, "rb");
+        bool readOk = (NULL != f) &&
+                      (spiffsFiles[i].size == fread(&spiffsImage[spiffsFiles[i].offset], 1, spiffsFiles[i].size, f));
+        if(NULL != f)
+        {
+            fclose(f);
+        }
+        if(!readOk)
+        {
+            ESP_LOGE("SPIFFS", "Failed to read %s", path);
+            spiffsFreeImage();
+            return true;
+        }
+    }
+
+#if !defined(USING_WINDOWS)
+    // Views are read-only, so make writing to one crash instead of corrupting
+    // the asset for everyone else
+    mprotect(spiffsImage, spiffsImageSize ? spiffsImageSize : 1, PROT_READ);
+#endif
+
+    ESP_LOGI("SPIFFS", "Packed %u files, %u bytes", spiffsNumFiles, (uint32_t)spiffsImageSize);
     return true;
 }
 
 /**
- * @brief Do nothing, the normal file system replaces SPIFFS well
+ * @brief Free the SPIFFS image and index
  *
  * @return true
  */
 bool deinitSpiffs(void)
 {
-    return false;
+    spiffsUnmapPack();
+    spiffsFreeImage();
+    return true;
 }
 
 /**
@@ -463,12 +803,255 @@ bool spiffsReadFile(const char * fname, uint8_t ** output, size_t * outsize)
         return false;
     }
 
+    if(NULL != assetPack)
+    {
+        // Copy the file and its null terminator
+        const uint8_t* data = assetPackFind(assetPack, fname, outsize);
+        if(NULL == data)
+        {
+            ESP_LOGE("SPIFFS", "Failed to open %s", fname);
+            return false;
+        }
+        *output = (uint8_t*)malloc(*outsize + 1);
+        if(NULL == *output)
+        {
+            return false;
+        }
+        memcpy(*output, data, *outsize + 1);
+        return true;
+    }
+
+    if(NULL == spiffsImage)
+    {
+        return spiffsReadFromDisk(fname, output, outsize);
+    }
+
+    const spiffsFile_t* file = spiffsFind(fname);
+    if(NULL == file)
+    {
+        ESP_LOGE("SPIFFS", "Failed to open %s", fname);
+        return false;
+    }
+
+    // Copy the file and its null terminator
+    *output = (uint8_t*)malloc(file->size + 1);
+    if(NULL == *output)
+    {
+        return false;
+    }
+    memcpy(*output, &spiffsImage[file->offset], file->size + 1);
+    *outsize = file->size;
+    return true;
+}
+
+/**
+ * @brief Get a read-only view of a file in SPIFFS, for callers which only
+ * parse a file and don't need to own a copy of it. The view must be released
+ * with spiffsUnmapFile(). Like spiffsReadFile(), the data is followed by a
+ * null terminator which isn't counted in the size.
+ *
+ * The view points straight into the asset pack or SPIFFS image, so nothing is
+ * copied
+ *
+ * @param fname The name of the file to view
+ * @param data  A pointer to return the view in
+ * @param size  A pointer to a size_t to return the file size in
+ * @return true if the file was found, false otherwise
+ */
+bool spiffsMapFile(const char* fname, const uint8_t** data, size_t* size)
+{
+    if(NULL != assetPack)
+    {
+        *data = assetPackFind(assetPack, fname, size);
+        if(NULL == *data)
+        {
+            ESP_LOGE("SPIFFS", "Failed to open %s", fname);
+            return false;
+        }
+        return true;
+    }
+
+    if(NULL == spiffsImage)
+    {
+        uint8_t* buf = NULL;
+        if(spiffsReadFromDisk(fname, &buf, size))
+        {
+            *data = buf;
+            return true;
+        }
+        return false;
+    }
+
+    const spiffsFile_t* file = spiffsFind(fname);
+    if(NULL == file)
+    {
+        ESP_LOGE("SPIFFS", "Failed to open %s", fname);
+        return false;
+    }
+    *data = &spiffsImage[file->offset];
+    *size = file->size;
+    return true;
+}
+
+/**
+ * @brief Release a view from spiffsMapFile()
+ *
+ * @param data The view to release, may be NULL
+ */
+void spiffsUnmapFile(const uint8_t* data)
+{
+    // Views into the pack or image don't need releasing, copies from disk do
+    if(NULL != assetPack && data >= assetPack && data < &assetPack[assetPackSize])
+    {
+        return;
+    }
+    if(NULL == spiffsImage || data < spiffsImage || data >= &spiffsImage[spiffsImageSize])
+    {
+        free((void*)(uintptr_t)data);
+    }
+}
+
+/**
+ * @brief Compare two files by name, for qsort()
+ *
+ * @param a A spiffsFile_t
+ * @param b Another spiffsFile_t
+ * @return The order of the files' names, like strcmp()
+ */
+static int spiffsFileCmp(const void* a, const void* b)
+{
+    return strcmp(((const spiffsFile_t*)a)->name, ((const spiffsFile_t*)b)->name);
+}
+
+/**
+ * @brief Compare a name to a file's name, for bsearch()
+ *
+ * @param key The name to look for
+ * @param file A spiffsFile_t
+ * @return The order of the names, like strcmp()
+ */
+static int spiffsNameCmp(const void* key, const void* file)
+{
+    return strcmp((const char*)key, ((const spiffsFile_t*)file)->name);
+}
+
+/**
+ * @brief Look a file up in the SPIFFS image index
+ *
+ * @param fname The name of the file to find
+ * @return The file, or NULL if it isn't in the image
+ */
+static const spiffsFile_t* spiffsFind(const char* fname)
+{
+    return bsearch(fname, spiffsFiles, spiffsNumFiles, sizeof(spiffsFile_t), spiffsNameCmp);
+}
+
+/**
+ * @brief Map ASSET_PACK_FILE read-only and check it
+ *
+ * @return true if the pack is mapped and can be used, false otherwise
+ */
+static bool spiffsMapPack(void)
+{
+    FILE* f = fopen(ASSET_PACK_FILE, "rb");
+    if(NULL == f)
+    {
+        return false;
+    }
+    fseek(f, 0L, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    if(size <= 0)
+    {
+        fclose(f);
+        return false;
+    }
+    assetPackSize = size;
+
+#if defined(USING_WINDOWS)
+    assetPack = malloc(assetPackSize);
+    if(NULL != assetPack && 1 != fread(assetPack, assetPackSize, 1, f))
+    {
+        free(assetPack);
+        assetPack = NULL;
+    }
+#else
+    assetPack = mmap(NULL, assetPackSize, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if(MAP_FAILED == assetPack)
+    {
+        assetPack = NULL;
+    }
+#endif
+    fclose(f);
+
+    if(NULL != assetPack && !assetPackCheck(assetPack, assetPackSize))
+    {
+        ESP_LOGE("SPIFFS", "%s isn't a usable asset pack", ASSET_PACK_FILE);
+        spiffsUnmapPack();
+    }
+    return NULL != assetPack;
+}
+
+/**
+ * @brief Unmap the asset pack, if it's mapped
+ */
+static void spiffsUnmapPack(void)
+{
+    if(NULL != assetPack)
+    {
+#if defined(USING_WINDOWS)
+        free(assetPack);
+#else
+        munmap(assetPack, assetPackSize);
+#endif
+        assetPack = NULL;
+    }
+    assetPackSize = 0;
+}
+
+/**
+ * @brief Free the SPIFFS image and index. Files will be read from disk after
+ * this
+ */
+static void spiffsFreeImage(void)
+{
+    if(NULL != spiffsImage)
+    {
+#if defined(USING_WINDOWS)
+        free(spiffsImage);
+#else
+        munmap(spiffsImage, spiffsImageSize ? spiffsImageSize : 1);
+#endif
+        spiffsImage = NULL;
+    }
+    spiffsImageSize = 0;
+
+    for(uint32_t i = 0; i < spiffsNumFiles; i++)
+    {
+        free(spiffsFiles[i].name);
+    }
+    free(spiffsFiles);
+    spiffsFiles = NULL;
+    spiffsNumFiles = 0;
+}
+
+/**
+ * @brief Read a file from SPIFFS_DIR on disk, for when there's no image
+ *
+ * @param fname   The name of the file to load
+ * @param output  A pointer to a pointer to return the read data in. This memory
+ *                will be allocated with calloc()
+ * @param outsize A pointer to a size_t to return how much data was read
+ * @return true if the file was read successfully, false otherwise
+ */
+static bool spiffsReadFromDisk(const char * fname, uint8_t ** output, size_t * outsize)
+{
     // Read and display the contents of a small text file
     ESP_LOGD("SPIFFS", "Reading %s", fname);
 
     // Open for reading the given file
-    char fnameFull[128] = "./spiffs_image/";
-    strcat(fnameFull, fname);
+    char fnameFull[sizeof(SPIFFS_DIR) + 256];
+    snprintf(fnameFull, sizeof(fnameFull), "%s%s", SPIFFS_DIR, fname);
     FILE* f = fopen(fnameFull, "rb");
     if (f == NULL) {
         ESP_LOGE("SPIFFS", "Failed to open %s", fnameFull);
@@ -3,7 +3,9 @@
 //==============================================================================
 
 #include <stdlib.h>
+#include <stdbool.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "list.h"
 
@@ -13,6 +15,14 @@
 #include "emu_esp.h"
 #include "esp_timer.h"
 
+//==============================================================================
+// Defines
+//==============================================================================
+
+// How long each taskYIELD() takes. In turbo mode this is how far the virtual
+// clock moves instead of sleeping, so the game sees the same steps either way
+#define YIELD_US 1000
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -20,6 +30,19 @@
 list_t * timerList = NULL;
 static unsigned long boot_time_in_micros = 0;
 
+// The clock the swadge sees. Normally it's the wall clock minus an offset, but
+// in turbo or lockstep mode it's virtual and only moves when the swadge task
+// yields. Only the swadge task writes these, other threads may read them
+static bool clockIsVirtual = false;
+static int64_t virtualTimeUs = 0;
+static int64_t wallOffsetUs = 0;
+
+// Turbo mode requests, from any thread
+static bool turboRequested = false;
+// Lockstep mode is set before the swadge starts and never changes
+static bool lockstepClock = false;
+static uint32_t turboFrameSkip = 1;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -76,11 +99,12 @@ esp_err_t esp_timer_deinit(void)
 }
 
 /**
- * @brief Get the time since 'boot' in microseconds
+ * @brief Get the wall clock time since 'boot' in microseconds. This keeps
+ * moving in turbo mode, so use it for anything which waits on other threads
  *
- * @return the time since 'boot' in microseconds
+ * @return the wall clock time since 'boot' in microseconds
  */
-int64_t esp_timer_get_time(void)
+int64_t emuGetWallTimeUs(void)
 {
     struct timespec ts;
     if (0 != clock_gettime(CLOCK_MONOTONIC, &ts))
@@ -91,6 +115,112 @@ int64_t esp_timer_get_time(void)
     return ((ts.tv_sec * 1000000) + (ts.tv_nsec / 1000)) - boot_time_in_micros;
 }
 
+/**
+ * @brief Get the time since 'boot' in microseconds. In turbo mode this is the
+ * virtual clock, which only moves when the swadge task yields
+ *
+ * @return the time since 'boot' in microseconds
+ */
+int64_t esp_timer_get_time(void)
+{
+    if(__atomic_load_n(&clockIsVirtual, __ATOMIC_ACQUIRE))
+    {
+        return __atomic_load_n(&virtualTimeUs, __ATOMIC_RELAXED);
+    }
+    return emuGetWallTimeUs() - __atomic_load_n(&wallOffsetUs, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Ask for turbo mode to be turned on or off. This may be called from
+ * any thread, it takes effect the next time the swadge task yields
+ *
+ * @param turbo true to run as fast as possible, false to run in real time
+ */
+void emuSetTurbo(bool turbo)
+{
+    __atomic_store_n(&turboRequested, turbo, __ATOMIC_RELAXED);
+}
+
+/**
+ * @return true if turbo mode is on or about to be, false if not
+ */
+bool emuIsTurbo(void)
+{
+    return __atomic_load_n(&turboRequested, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Set how many frames are drawn per frame shown while in turbo mode
+ *
+ * @param skip Show one of every this many frames, at least 1
+ */
+void emuSetTurboFrameSkip(uint32_t skip)
+{
+    __atomic_store_n(&turboFrameSkip, (0 == skip) ? 1 : skip, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Check if a drawn frame should be shown
+ *
+ * @param frameNum The number of frames drawn so far
+ * @return true if the frame should be shown, false if it may be skipped
+ */
+bool emuShouldShowFrame(uint32_t frameNum)
+{
+    if(!__atomic_load_n(&turboRequested, __ATOMIC_RELAXED))
+    {
+        return true;
+    }
+    return 0 == (frameNum % __atomic_load_n(&turboFrameSkip, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Keep the clock virtual even when not in turbo mode. It's paced to
+ * real time, but the swadge sees exactly the same timestamps from run to run.
+ * This must be called before the swadge starts
+ */
+void emuSetLockstepClock(void)
+{
+    lockstepClock = true;
+    virtualTimeUs = 0;
+    clockIsVirtual = true;
+}
+
+/**
+ * @brief Yield the swadge task. In real time this sleeps, in turbo mode the
+ * virtual clock moves forward by the same amount instead. Switching between
+ * modes happens here, and the clock carries on from where it was either way.
+ * This must only be called from the swadge task
+ */
+void emuTimerYield(void)
+{
+    bool turbo = __atomic_load_n(&turboRequested, __ATOMIC_RELAXED);
+    bool isVirtual = turbo || lockstepClock;
+    if(isVirtual != clockIsVirtual)
+    {
+        if(isVirtual)
+        {
+            // Freeze the clock where it is, then step it from there
+            __atomic_store_n(&virtualTimeUs, esp_timer_get_time(), __ATOMIC_RELAXED);
+        }
+        else
+        {
+            // Pick the wall clock back up from the virtual time
+            __atomic_store_n(&wallOffsetUs, emuGetWallTimeUs() - virtualTimeUs, __ATOMIC_RELAXED);
+        }
+        __atomic_store_n(&clockIsVirtual, isVirtual, __ATOMIC_RELEASE);
+    }
+
+    if(clockIsVirtual)
+    {
+        __atomic_fetch_add(&virtualTimeUs, YIELD_US, __ATOMIC_RELAXED);
+    }
+    if(!turbo)
+    {
+        usleep(YIELD_US);
+    }
+}
+
 /**
  * @brief Create an esp_timer instance
  *
@@ -6,6 +6,9 @@
     #define USING_WINDOWS 1
 #elif defined(__linux__)
     #define USING_LINUX 1
+    #if !defined(_GNU_SOURCE)
+        #define _GNU_SOURCE // for recvmmsg()
+    #endif
 #else
     #error "OS Not Detected"
 #endif
@@ -15,13 +18,13 @@
 #elif defined(USING_LINUX)
     #include <sys/socket.h> // for socket(), connect(), sendto(), and recvfrom() 
     #include <arpa/inet.h>  // for sockaddr_in and inet_addr()
-    #include <fcntl.h>
 #endif
 
  #include <unistd.h>
  #include <string.h>
 
 #include "emu_esp.h"
+#include "emu_replay.h"
 #include "esp_log.h"
 #include "esp_wifi.h"
 #include "esp_random.h"
@@ -34,7 +37,35 @@
 //==============================================================================
 
 #define ESP_NOW_PORT 32888
-#define MAXRECVSTRING 1024  // Longest string to receive 
+
+// Identifies emulated ESP-NOW packets, and the version of the header
+#define EMU_ESP_NOW_MAGIC   "ENOW"
+#define EMU_ESP_NOW_VERSION 1
+
+// The longest packet, header and data, the emulator sends or receives
+#define MAX_PACKET_LEN (sizeof(emuEspNowHdr_t) + UINT8_MAX)
+
+// How many packets are received per system call
+#define RX_BATCH 32
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+// Sent in front of every ESP-NOW packet's data
+typedef struct __attribute__((packed))
+{
+    char magic[4];     //!< EMU_ESP_NOW_MAGIC, not NULL terminated
+    uint8_t version;   //!< EMU_ESP_NOW_VERSION
+    uint8_t srcMac[6]; //!< The sender's MAC address
+    uint8_t dataLen;   //!< The length of the data after this header
+} emuEspNowHdr_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void handleRxPacket(const uint8_t* packet, int packetLen);
 
 //==============================================================================
 // Variables
@@ -45,6 +76,23 @@ hostEspNowSendCb_t hostEspNowSendCb = NULL;
 
 int socketFd;
 
+// Where all packets are sent
+static struct sockaddr_in broadcastAddr;
+
+// This swadge's MAC, looked up once
+static uint8_t ourMac[6];
+
+// Outgoing packets are built here. The header is filled in once, only the
+// length and data change per packet
+static uint8_t txPacket[MAX_PACKET_LEN];
+
+#if defined(USING_LINUX)
+// Buffers for receiving a batch of packets at once
+static uint8_t rxPackets[RX_BATCH][MAX_PACKET_LEN];
+static struct iovec rxIovecs[RX_BATCH];
+static struct mmsghdr rxMsgs[RX_BATCH];
+#endif
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -61,6 +109,19 @@ void espNowInit(hostEspNowRecvCb_t recvCb, hostEspNowSendCb_t sendCb)
     hostEspNowRecvCb = recvCb;
     hostEspNowSendCb = sendCb;
 
+    // Construct the address to send to
+    memset(&broadcastAddr, 0, sizeof(broadcastAddr));   // Zero out structure
+    broadcastAddr.sin_family = AF_INET;                 // Internet address family
+    broadcastAddr.sin_addr.s_addr = htonl(INADDR_NONE); // Broadcast IP address  // inet_addr("255.255.255.255");
+    broadcastAddr.sin_port = htons(ESP_NOW_PORT);       // Broadcast port
+
+    // The MAC doesn't change, so fill in the outgoing header once
+    esp_wifi_get_mac(WIFI_IF_STA, ourMac);
+    emuEspNowHdr_t* hdr = (emuEspNowHdr_t*)txPacket;
+    memcpy(hdr->magic, EMU_ESP_NOW_MAGIC, sizeof(hdr->magic));
+    hdr->version = EMU_ESP_NOW_VERSION;
+    memcpy(hdr->srcMac, ourMac, sizeof(hdr->srcMac));
+
 #if defined(USING_WINDOWS)
     // Initialize Winsock
     WSADATA wsaData;
@@ -109,29 +170,35 @@ void espNowInit(hostEspNowRecvCb_t recvCb, hostEspNowSendCb_t sendCb)
         return;
     }
 #else
-    int optval_enable = 1;
-    setsockopt(socketFd, SOL_SOCKET, O_NONBLOCK, (char *)&optval_enable, sizeof(optval_enable));
+    // The socket stays blocking so a burst of sends waits for buffer space
+    // rather than failing. Receiving uses MSG_DONTWAIT instead
 #endif
 
-    // Set nonblocking timeout
-    struct timeval read_timeout;
-    read_timeout.tv_sec = 0;
-    read_timeout.tv_usec = 10;
-    setsockopt(socketFd, SOL_SOCKET, SO_RCVTIMEO, (const char *)&read_timeout, sizeof(read_timeout));
-
     // Construct bind structure
-    struct sockaddr_in broadcastAddr;                  // Broadcast Address
-    memset(&broadcastAddr, 0, sizeof(broadcastAddr));  // Zero out structure
-    broadcastAddr.sin_family = AF_INET;                // Internet address family
-    broadcastAddr.sin_addr.s_addr = htonl(INADDR_ANY); // Any incoming interface
-    broadcastAddr.sin_port = htons(ESP_NOW_PORT);      // Broadcast port
+    struct sockaddr_in bindAddr;                  // Bind Address
+    memset(&bindAddr, 0, sizeof(bindAddr));       // Zero out structure
+    bindAddr.sin_family = AF_INET;                // Internet address family
+    bindAddr.sin_addr.s_addr = htonl(INADDR_ANY); // Any incoming interface
+    bindAddr.sin_port = htons(ESP_NOW_PORT);      // Broadcast port
 
     // Bind to the broadcast port
-    if (bind(socketFd, (struct sockaddr *) &broadcastAddr, sizeof(broadcastAddr)) < 0)
+    if (bind(socketFd, (struct sockaddr *) &bindAddr, sizeof(bindAddr)) < 0)
     {
         ESP_LOGE("WIFI", "bind() failed");
         return;
     }
+
+#if defined(USING_LINUX)
+    // Point each message in the receive batch at its own buffer
+    for (int i = 0; i < RX_BATCH; i++)
+    {
+        rxIovecs[i].iov_base = rxPackets[i];
+        rxIovecs[i].iov_len = sizeof(rxPackets[i]);
+        memset(&rxMsgs[i], 0, sizeof(rxMsgs[i]));
+        rxMsgs[i].msg_hdr.msg_iov = &rxIovecs[i];
+        rxMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
 }
 
 /**
@@ -154,36 +221,32 @@ void espNowDeinit(void)
  */
 void espNowSend(const char* data, uint8_t dataLen)
 {
-    struct sockaddr_in broadcastAddr; // Broadcast address
-
-    // Construct local address structure
-    memset(&broadcastAddr, 0, sizeof(broadcastAddr));   // Zero out structure
-    broadcastAddr.sin_family = AF_INET;                 // Internet address family
-    broadcastAddr.sin_addr.s_addr = htonl(INADDR_NONE); // Broadcast IP address  // inet_addr("255.255.255.255");
-    broadcastAddr.sin_port = htons(ESP_NOW_PORT);       // Broadcast port
-
-    // Tack on ESP-NOW header and randomized MAC address
-    char espNowPacket[dataLen + 24];
-    uint8_t mac[6] = {0};
-    esp_wifi_get_mac(WIFI_IF_STA, mac);
-    sprintf(espNowPacket, "ESP_NOW-%02X%02X%02X%02X%02X%02X-", mac[0],mac[1],mac[2],mac[3],mac[4],mac[5]);
-    int hdrLen = strlen(espNowPacket);
-    memcpy(&espNowPacket[hdrLen], data, dataLen);
+    // The header is already filled in, just add the data after it
+    ((emuEspNowHdr_t*)txPacket)->dataLen = dataLen;
+    memcpy(&txPacket[sizeof(emuEspNowHdr_t)], data, dataLen);
+    int packetLen = sizeof(emuEspNowHdr_t) + dataLen;
 
     // For the callback
     uint8_t bcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
-    // Send the packet
-    int sentLen = sendto(socketFd, espNowPacket, hdrLen + dataLen, 0, (struct sockaddr *)&broadcastAddr, sizeof(broadcastAddr));
-    if (sentLen != (hdrLen + dataLen))
+    // When replaying, nothing goes out and the journaled result is used
+    uint8_t status = ESP_NOW_SEND_SUCCESS;
+    if(emuIsReplaying())
     {
-        ESP_LOGE("WIFI", "sendto() sent a different number of bytes than expected");
-        hostEspNowSendCb(bcastMac, ESP_NOW_SEND_FAIL);
+        emuReplayRead(RP_ESPNOW_TX, &status, sizeof(status));
     }
     else
     {
-        hostEspNowSendCb(bcastMac, ESP_NOW_SEND_SUCCESS);
+        // Send the packet
+        int sentLen = sendto(socketFd, (const char*)txPacket, packetLen, 0, (struct sockaddr *)&broadcastAddr, sizeof(broadcastAddr));
+        if (sentLen != packetLen)
+        {
+            ESP_LOGE("WIFI", "sendto() sent a different number of bytes than expected");
+            status = ESP_NOW_SEND_FAIL;
+        }
+        emuRecord(RP_ESPNOW_TX, &status, sizeof(status));
     }
+    hostEspNowSendCb(bcastMac, status);
 }
 
 /**
@@ -192,31 +255,73 @@ void espNowSend(const char* data, uint8_t dataLen)
  */
 void checkEspNowRxQueue(void)
 {
-    char recvString[MAXRECVSTRING+1]; // Buffer for received string
-    int recvStringLen;                // Length of received string
+#if defined(USING_LINUX)
+    // Drain the socket a batch at a time. A partial batch means it's empty
+    int numMsgs;
+    do
+    {
+        numMsgs = recvmmsg(socketFd, rxMsgs, RX_BATCH, MSG_DONTWAIT, NULL);
+        for (int i = 0; i < numMsgs; i++)
+        {
+            handleRxPacket(rxPackets[i], rxMsgs[i].msg_len);
+        }
+    } while (RX_BATCH == numMsgs);
+#else
+    uint8_t packet[MAX_PACKET_LEN];
+    int packetLen;
+    while ((packetLen = recvfrom(socketFd, (char*)packet, sizeof(packet), 0, NULL, 0)) > 0)
+    {
+        handleRxPacket(packet, packetLen);
+    }
+#endif
+
+    // When replaying, live packets were thrown away above and journaled ones
+    // are received instead
+    uint8_t record[6 + 1 + UINT8_MAX];
+    int32_t recordLen;
+    while(7 <= (recordLen = emuReplayRead(RP_ESPNOW_RX, record, sizeof(record))))
+    {
+        hostEspNowRecvCb(record, (const char*)&record[7], recordLen - 7, (int8_t)record[6]);
+    }
+}
+
+/**
+ * Check that a received packet is an emulated ESP-NOW packet from another
+ * swadge, and if it is, send its data to hostEspNowRecvCb()
+ *
+ * @param packet The received packet, header and data
+ * @param packetLen The length of the received packet
+ */
+static void handleRxPacket(const uint8_t* packet, int packetLen)
+{
+    // Make sure the header is intact and the data is all there
+    const emuEspNowHdr_t* hdr = (const emuEspNowHdr_t*)packet;
+    if ((packetLen < (int)sizeof(emuEspNowHdr_t)) ||
+        (0 != memcmp(hdr->magic, EMU_ESP_NOW_MAGIC, sizeof(hdr->magic))) ||
+        (EMU_ESP_NOW_VERSION != hdr->version) ||
+        (packetLen != (int)(sizeof(emuEspNowHdr_t) + hdr->dataLen)))
+    {
+        return;
+    }
 
-    // While we've received a packet
-    while ((recvStringLen = recvfrom(socketFd, recvString, MAXRECVSTRING, 0, NULL, 0)) > 0)
+    // Make sure the MAC differs from our own
+    if(0 != memcmp(hdr->srcMac, ourMac, sizeof(ourMac)) && !emuIsReplaying())
     {
-        // If the packet matches the ESP_NOW format
-        uint8_t recvMac[6] = {0};
-        if(6 == sscanf(recvString, "ESP_NOW-%02hhX%02hhX%02hhX%02hhX%02hhX%02hhX-",
-                       &recvMac[0],
-                       &recvMac[1],
-                       &recvMac[2],
-                       &recvMac[3],
-                       &recvMac[4],
-                       &recvMac[5]))
+        const uint8_t* data = &packet[sizeof(emuEspNowHdr_t)];
+
+        // If it does, journal it as the MAC, RSSI, then data
+        int8_t rssi = 0x7F;
+        if(emuIsRecording())
         {
-            // Make sure the MAC differs from our own
-            uint8_t ourMac[6] = {0};
-            esp_wifi_get_mac(WIFI_IF_STA, ourMac);
-            if(0 != memcmp(recvMac, ourMac, sizeof(ourMac)))
-            {
-                // If it does, send it to the application through the callback
-                hostEspNowRecvCb(recvMac, &recvString[21], recvStringLen - 21, 0x7F);
-            }
+            uint8_t record[6 + 1 + UINT8_MAX];
+            memcpy(record, hdr->srcMac, 6);
+            record[6] = rssi;
+            memcpy(&record[7], data, hdr->dataLen);
+            emuRecord(RP_ESPNOW_RX, record, 7 + hdr->dataLen);
         }
+
+        // Then send it to the application through the callback
+        hostEspNowRecvCb(hdr->srcMac, (const char*)data, hdr->dataLen, rssi);
     }
 }
 
@@ -36,7 +36,7 @@ list_destroy(list_t *self) {
 
   while (len--) {
     next = curr->next;
-    if (self->free) self->free(curr->val);
+    if (self->free) (self->free)(curr->val);
     LIST_FREE(curr);
     curr = next;
   }
@@ -195,7 +195,7 @@ list_remove(list_t *self, list_node_t *node) {
     ? (node->next->prev = node->prev)
     : (self->tail = node->prev);
 
-  if (self->free) self->free(node->val);
+  if (self->free) (self->free)(node->val);
 
   LIST_FREE(node);
   --self->len;
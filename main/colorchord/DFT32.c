@@ -191,6 +191,76 @@ void UpdateOutputBins32(dft32_data* dd)
     }
 }
 
+/**
+ * @brief Copy the running sin/cos state to the output bins and decay it. This
+ * is the special step which happens once every (1<<OCTAVES) HandleInt() calls
+ *
+ * @param dd
+ */
+static inline void DecayAllBins32( dft32_data* dd )
+{
+    int i;
+    int32_t* bins = &dd->Sdatspace32B[0];
+    int32_t* binsOut = &dd->Sdatspace32BOut[0];
+
+    for( i = 0; i < FIXBINS; i++ )
+    {
+        //First for the SIN then the COS.
+        int32_t val = *(bins);
+        *(binsOut++) = val;
+        *(bins++) -= val >> DFTIIR;
+
+        val = *(bins);
+        *(binsOut++) = val;
+        *(bins++) -= val >> DFTIIR;
+    }
+}
+
+/**
+ * @brief Advance the phase of every bin in one octave and accumulate a filtered
+ * sample into that octave's running sin/cos state
+ *
+ * @param dsA The (advances,places) for the first bin in the octave
+ * @param dsB The (isses,icses) for the first bin in the octave
+ * @param filteredsample The sample, averaged for this octave
+ */
+static inline void UpdateOctaveBins32( uint16_t* dsA, int32_t* dsB, int16_t filteredsample )
+{
+    int i;
+    uint16_t adv0, adv1;
+    uint8_t ipl0, ipl1;
+
+    //Two bins per iteration. The bins are independent, so this gives the CPU
+    //two table lookups and two multiply-accumulates to overlap
+    for( i = 0; i < FIXBPERO - 1; i += 2 )
+    {
+        adv0 = dsA[0];
+        adv1 = dsA[2];
+        ipl0 = dsA[1] >> 8;
+        ipl1 = dsA[3] >> 8;
+        dsA[1] += adv0;
+        dsA[3] += adv1;
+
+        dsB[0] += (Ssinonlytable[ipl0] * filteredsample);
+        dsB[2] += (Ssinonlytable[ipl1] * filteredsample);
+        //Get the cosine (1/4 wavelength out-of-phase with sin)
+        dsB[1] += (Ssinonlytable[(uint8_t)(ipl0 + 64)] * filteredsample);
+        dsB[3] += (Ssinonlytable[(uint8_t)(ipl1 + 64)] * filteredsample);
+
+        dsA += 4;
+        dsB += 4;
+    }
+
+#if (FIXBPERO & 1)
+    //Odd bin out
+    adv0 = dsA[0];
+    ipl0 = dsA[1] >> 8;
+    dsA[1] += adv0;
+    dsB[0] += (Ssinonlytable[ipl0] * filteredsample);
+    dsB[1] += (Ssinonlytable[(uint8_t)(ipl0 + 64)] * filteredsample);
+#endif
+}
+
 /**
  * @brief TODO
  *
@@ -200,8 +270,6 @@ void UpdateOutputBins32(dft32_data* dd)
 static void HandleInt( dft32_data* dd, int16_t sample )
 {
     int i;
-    uint16_t adv;
-    uint8_t localipl;
     int16_t filteredsample;
 
     uint8_t oct = dd->Sdo_this_octave[dd->Swhichoctaveplace];
@@ -220,41 +288,17 @@ static void HandleInt( dft32_data* dd, int16_t sample )
         // which is half as many samples
         //It handles updating part of the DFT.
         //It should happen at the very first call to HandleInit
-        int32_t* bins = &dd->Sdatspace32B[0];
-        int32_t* binsOut = &dd->Sdatspace32BOut[0];
-
-        for( i = 0; i < FIXBINS; i++ )
-        {
-            //First for the SIN then the COS.
-            int32_t val = *(bins);
-            *(binsOut++) = val;
-            *(bins++) -= val >> DFTIIR;
-
-            val = *(bins);
-            *(binsOut++) = val;
-            *(bins++) -= val >> DFTIIR;
-        }
+        DecayAllBins32( dd );
         return;
     }
 
     // process a filtered sample for one of the octaves
-    uint16_t* dsA = &dd->Sdatspace32A[oct * FIXBPERO * 2];
-    int32_t* dsB = &dd->Sdatspace32B[oct * FIXBPERO * 2];
-
     filteredsample = dd->Saccum_octavebins[oct] >> (OCTAVES - oct);
     dd->Saccum_octavebins[oct] = 0;
 
-    for( i = 0; i < FIXBPERO; i++ )
-    {
-        adv = *(dsA++);
-        localipl = *(dsA) >> 8;
-        *(dsA++) += adv;
-
-        *(dsB++) += (Ssinonlytable[localipl] * filteredsample);
-        //Get the cosine (1/4 wavelength out-of-phase with sin)
-        localipl += 64;
-        *(dsB++) += (Ssinonlytable[localipl] * filteredsample);
-    }
+    UpdateOctaveBins32( &dd->Sdatspace32A[oct * FIXBPERO * 2],
+                        &dd->Sdatspace32B[oct * FIXBPERO * 2],
+                        filteredsample );
 }
 
 /**
@@ -330,6 +374,67 @@ void PushSample32(dft32_data* dd, int16_t dat )
     HandleInt( dd, dat );
 }
 
+/**
+ * @brief Push a whole block of samples through the DFT. This produces exactly
+ * the same state as calling PushSample32() once per sample, but keeps the
+ * octave schedule and accumulators in locals for the whole block instead of
+ * reloading them from dd for every sample.
+ *
+ * @param dd
+ * @param samples The samples to push, same range restrictions as PushSample32()
+ * @param numSamples The number of samples to push
+ */
+void PushSamples32(dft32_data* dd, const int16_t* samples, uint32_t numSamples )
+{
+    int i;
+    int32_t accum[OCTAVES];
+    uint8_t place = dd->Swhichoctaveplace;
+    const uint8_t* schedule = dd->Sdo_this_octave;
+
+    for( i = 0; i < OCTAVES; i++ )
+    {
+        accum[i] = dd->Saccum_octavebins[i];
+    }
+
+    while( numSamples-- )
+    {
+        int16_t sample = *(samples++);
+        int half;
+
+        //Each sample is handled twice, same as PushSample32()
+        for( half = 0; half < 2; half++ )
+        {
+            uint8_t oct = schedule[place];
+            place = (place + 1) & (BINCYCLE - 1);
+
+            for( i = 0; i < OCTAVES; i++ )
+            {
+                accum[i] += sample;
+            }
+
+            if( oct > 128 )
+            {
+                DecayAllBins32( dd );
+            }
+            else
+            {
+                int16_t filteredsample = accum[oct] >> (OCTAVES - oct);
+                accum[oct] = 0;
+
+                UpdateOctaveBins32( &dd->Sdatspace32A[oct * FIXBPERO * 2],
+                                    &dd->Sdatspace32B[oct * FIXBPERO * 2],
+                                    filteredsample );
+            }
+        }
+    }
+
+    for( i = 0; i < OCTAVES; i++ )
+    {
+        dd->Saccum_octavebins[i] = accum[i];
+    }
+    dd->Swhichoctaveplace = place;
+}
+
 #ifndef CCEMBEDDED
 
 /**
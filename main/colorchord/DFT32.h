@@ -91,6 +91,9 @@ typedef struct
     uint16_t embeddedbins[FIXBINS];
 } dft32_data;
 
+//A table of precomputed sin() values.  Ranging -1500 to +1500
+extern const int16_t Ssinonlytable[256];
+
 //It's actually split into a few functions, which you can call on your own:
 int SetupDFTProgressive32(dft32_data* dd);   //Call at start. Returns nonzero if error.
 void UpdateBins32(dft32_data* dd, const uint16_t* frequencies );
@@ -100,6 +103,11 @@ void UpdateBins32(dft32_data* dd, const uint16_t* frequencies );
 //Any more and you will exceed the accumulators and it will cause an overflow.
 void PushSample32(dft32_data* dd, int16_t dat );
 
+//Call this to push on a whole block of sound at once, i.e. everything read
+//from the ADC in one go. This is equivalent to calling PushSample32() for each
+//sample, just faster.
+void PushSamples32(dft32_data* dd, const int16_t* samples, uint32_t numSamples );
+
 #ifndef CCEMBEDDED
     //ColorChord regular uses this to pass in floats.
     void UpdateBinsForDFT32( dft32_data* dd, const float* frequencies );   //Update the frequencies
@@ -157,6 +157,206 @@ void fillDisplayArea(display_t* disp, int16_t x1, int16_t y1, int16_t x2,
     }
 }
 
+/**
+ * @brief Allocate space for a WSG's pixels
+ *
+ * @param numPx The number of pixels
+ * @return The space, or NULL if it couldn't be allocated
+ */
+static paletteColor_t* allocWsgPx(uint32_t numPx)
+{
+#if defined( _TEST_USE_SPIRAM_ ) && !defined( EMU )
+    return (paletteColor_t*)heap_caps_malloc(sizeof(paletteColor_t) * numPx, MALLOC_CAP_SPIRAM);
+#else
+    return (paletteColor_t*)malloc(sizeof(paletteColor_t) * numPx);
+#endif
+}
+
+/**
+ * @brief Decode a WSG's heatshrink compressed pixels
+ *
+ * @param in The compressed pixels
+ * @param inLen The number of compressed bytes
+ * @param window The heatshrink window, log2
+ * @param lookahead The heatshrink lookahead, log2
+ * @param out Where to write the pixels
+ * @param outLen The number of pixels
+ * @return true if exactly outLen pixels were decoded, false otherwise
+ */
+static bool decodeWsgHeatshrink(const uint8_t* in, size_t inLen, uint8_t window, uint8_t lookahead,
+                                uint8_t* out, uint32_t outLen)
+{
+    heatshrink_decoder* hsd = heatshrink_decoder_alloc(256, window, lookahead);
+    if(NULL == hsd)
+    {
+        return false;
+    }
+
+    // Decode the file in chunks
+    size_t inputIdx = 0;
+    uint32_t outputIdx = 0;
+    bool ok = true;
+    while(ok && inputIdx < inLen)
+    {
+        // Decode some data
+        size_t copied = 0;
+        ok = (0 <= heatshrink_decoder_sink(hsd, &in[inputIdx], inLen - inputIdx, &copied));
+        inputIdx += copied;
+
+        // Save it to the output array
+        HSD_poll_res res;
+        do
+        {
+            copied = 0;
+            res = heatshrink_decoder_poll(hsd, &out[outputIdx], outLen - outputIdx, &copied);
+            outputIdx += copied;
+        } while(HSDR_POLL_MORE == res && outputIdx < outLen);
+        ok = ok && (0 <= res) && !(HSDR_POLL_MORE == res && inputIdx < inLen);
+    }
+
+    // Note that it's all done
+    ok = ok && (HSDR_FINISH_DONE == heatshrink_decoder_finish(hsd));
+    heatshrink_decoder_free(hsd);
+    return ok && (outputIdx == outLen);
+}
+
+/**
+ * @brief Decode a WSG's run length encoded pixels. 0x00-0x7F are followed by
+ * 1-128 literal pixels, and 0x80-0xFF are followed by one pixel which repeats
+ * 2-129 times
+ *
+ * @param in The encoded pixels
+ * @param inLen The number of encoded bytes
+ * @param out Where to write the pixels
+ * @param outLen The number of pixels
+ * @return true if exactly outLen pixels were decoded, false otherwise
+ */
+static bool decodeWsgRle(const uint8_t* in, size_t inLen, uint8_t* out, uint32_t outLen)
+{
+    size_t i = 0;
+    uint32_t o = 0;
+    while(i < inLen)
+    {
+        uint8_t c = in[i++];
+        uint32_t n = (c & 0x80) ? ((c & 0x7F) + 2u) : (c + 1u);
+        if(n > outLen - o)
+        {
+            return false;
+        }
+        if(c & 0x80)
+        {
+            if(i >= inLen)
+            {
+                return false;
+            }
+            memset(&out[o], in[i++], n);
+        }
+        else
+        {
+            if(n > inLen - i)
+            {
+                return false;
+            }
+            memcpy(&out[o], &in[i], n);
+            i += n;
+        }
+        o += n;
+    }
+    return o == outLen;
+}
+
+/**
+ * @brief Decode data compressed with one of the WSG codecs. Other assets, like
+ * platformer levels, use these codecs too
+ *
+ * @param codec One of the WSG_CODEC_* values
+ * @param params The heatshrink window (high nibble) and lookahead (low nibble)
+ * @param in The compressed data
+ * @param inLen The number of compressed bytes
+ * @param out Where to write the decoded data
+ * @param outLen The number of bytes to decode
+ * @return true if exactly outLen bytes were decoded, false otherwise
+ */
+bool decodeWsgData(uint8_t codec, uint8_t params, const uint8_t* in, size_t inLen, uint8_t* out, uint32_t outLen)
+{
+    switch(codec)
+    {
+        case WSG_CODEC_RAW:
+        {
+            if(inLen != outLen)
+            {
+                return false;
+            }
+            memcpy(out, in, outLen);
+            return true;
+        }
+        case WSG_CODEC_RLE:
+        {
+            return decodeWsgRle(in, inLen, out, outLen);
+        }
+        case WSG_CODEC_HEATSHRINK:
+        {
+            return decodeWsgHeatshrink(in, inLen, params >> 4, params & 0x0F, out, outLen);
+        }
+        default:
+        {
+            ESP_LOGE("WSG", "Unknown codec %d", codec);
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Decode a WSG file which is already in memory
+ *
+ * @param name The WSG's name, for errors
+ * @param buf The WSG file
+ * @param sz The size of the WSG file
+ * @param wsg A handle to load the WSG to
+ * @return true if the WSG was decoded, false if it wasn't and should not be used
+ */
+static bool decodeWsg(const char* name, const uint8_t* buf, size_t sz, wsg_t* wsg)
+{
+    bool ok = false;
+    wsg->px = NULL;
+    if(sz >= WSG_HEADER_SIZE && 0 == buf[0] && 0 == buf[1])
+    {
+        // Extended header, the pixels are decoded straight into place
+        wsg->w = (buf[4] << 8) | buf[5];
+        wsg->h = (buf[6] << 8) | buf[7];
+        uint32_t numPx = wsg->w * wsg->h;
+        wsg->px = allocWsgPx(numPx);
+        if(NULL != wsg->px)
+        {
+            ok = decodeWsgData(buf[2], buf[3], &buf[WSG_HEADER_SIZE], sz - WSG_HEADER_SIZE, (uint8_t*)wsg->px, numPx);
+        }
+    }
+    else if(sz > 2)
+    {
+        // Original header, the decompressed size then heatshrink 8/4 of the
+        // dimensions and pixels. Decode it all, then slide the pixels over the
+        // dimensions
+        uint16_t decompressedSize = (buf[0] << 8) | buf[1];
+        wsg->px = allocWsgPx(decompressedSize);
+        if(NULL != wsg->px && decompressedSize > 4 &&
+                decodeWsgHeatshrink(&buf[2], sz - 2, 8, 4, (uint8_t*)wsg->px, decompressedSize))
+        {
+            wsg->w = (wsg->px[0] << 8) | wsg->px[1];
+            wsg->h = (wsg->px[2] << 8) | wsg->px[3];
+            ok = ((wsg->w * wsg->h) == (decompressedSize - 4));
+            memmove(wsg->px, &wsg->px[4], decompressedSize - 4);
+        }
+    }
+
+    if(!ok)
+    {
+        ESP_LOGE("WSG", "Failed to decode %s", name);
+        free(wsg->px);
+        wsg->px = NULL;
+    }
+    return ok;
+}
+
 /**
  * @brief Load a WSG from ROM to RAM. WSGs placed in the spiffs_image folder
  * before compilation will be automatically flashed to ROM
@@ -166,73 +366,178 @@ void fillDisplayArea(display_t* disp, int16_t x1, int16_t y1, int16_t x2,
  * @return true if the WSG was loaded successfully,
  *         false if the WSG load failed and should not be used
  */
-bool loadWsg(char* name, wsg_t* wsg)
+bool loadWsg(const char* name, wsg_t* wsg)
 {
-    // Read WSG from file
-    uint8_t* buf = NULL;
+    // Get a view of the WSG file
+    const uint8_t* buf = NULL;
     size_t sz;
-    if(!spiffsReadFile(name, &buf, &sz))
+    if(!spiffsMapFile(name, &buf, &sz))
     {
         ESP_LOGE("WSG", "Failed to read %s", name);
         return false;
     }
 
-    // Pick out the decompresed size and create a space for it
-    uint16_t decompressedSize = (buf[0] << 8) | buf[1];
-    uint8_t decompressedBuf[decompressedSize];
+    bool ok = decodeWsg(name, buf, sz, wsg);
 
-    // Create the decoder
-    size_t copied = 0;
-    heatshrink_decoder* hsd = heatshrink_decoder_alloc(256, 8, 4);
-    heatshrink_decoder_reset(hsd);
+    // Done with the file
+    spiffsUnmapFile(buf);
+    return ok;
+}
 
-    // Decode the file in chunks
-    uint32_t inputIdx = 0;
-    uint32_t outputIdx = 0;
-    while(inputIdx < (sz - 2))
+/**
+ * @brief Load an atlas, many sprites packed into one WSG by the
+ * spiffs_file_preprocessor. The sheet is decoded once and the sprites are
+ * drawn straight out of it with drawWsgRegion() or drawWsgRegionTile()
+ *
+ * @param name The filename of the atlas to load
+ * @param atlas A handle to load the atlas to
+ * @return true if the atlas was loaded successfully,
+ *         false if the atlas load failed and should not be used
+ */
+bool loadWsgAtlas(const char* name, wsgAtlas_t* atlas)
+{
+    // Get a view of the atlas file
+    const uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsMapFile(name, &buf, &sz))
     {
-        // Decode some data
-        copied = 0;
-        heatshrink_decoder_sink(hsd, &buf[2 + inputIdx], sz - 2 - inputIdx, &copied);
-        inputIdx += copied;
+        ESP_LOGE("WSG", "Failed to read %s", name);
+        return false;
+    }
 
-        // Save it to the output array
-        copied = 0;
-        heatshrink_decoder_poll(hsd, &decompressedBuf[outputIdx], sizeof(decompressedBuf) - outputIdx, &copied);
-        outputIdx += copied;
+    // The table is parsed into one allocation, the regions then their names
+    atlas->numRegions = 0;
+    atlas->regions = NULL;
+    atlas->sheet.px = NULL;
+    uint16_t numRegions = (sz >= ATLAS_HEADER_SIZE) ? ((buf[0] << 8) | buf[1]) : 0;
+    uint16_t namesSize = (sz >= ATLAS_HEADER_SIZE) ? ((buf[2] << 8) | buf[3]) : 0;
+    size_t tableSz = ATLAS_HEADER_SIZE + (numRegions * ATLAS_REGION_SIZE) + namesSize;
+    bool ok = (0 < numRegions) && (0 < namesSize) && (tableSz < sz) && (0 == buf[tableSz - 1]);
+    if(ok)
+    {
+        atlas->regions = malloc((numRegions * sizeof(wsgRegion_t)) + namesSize);
+        ok = (NULL != atlas->regions);
+    }
+    if(ok)
+    {
+        char* names = (char*)&atlas->regions[numRegions];
+        memcpy(names, &buf[tableSz - namesSize], namesSize);
+        const uint8_t* entry = &buf[ATLAS_HEADER_SIZE];
+        for(uint16_t i = 0; ok && i < numRegions; i++, entry += ATLAS_REGION_SIZE)
+        {
+            uint16_t nameOffset = (entry[0] << 8) | entry[1];
+            wsgRegion_t* region = &atlas->regions[i];
+            region->name = &names[nameOffset];
+            region->x = (entry[2] << 8) | entry[3];
+            region->y = (entry[4] << 8) | entry[5];
+            region->w = (entry[6] << 8) | entry[7];
+            region->h = (entry[8] << 8) | entry[9];
+            ok = (nameOffset < namesSize);
+        }
+        atlas->numRegions = numRegions;
     }
 
-    // Note that it's all done
-    heatshrink_decoder_finish(hsd);
+    // Then decode the sheet and make sure every region is inside it
+    ok = ok && decodeWsg(name, &buf[tableSz], sz - tableSz, &atlas->sheet);
+    for(uint16_t i = 0; ok && i < atlas->numRegions; i++)
+    {
+        const wsgRegion_t* region = &atlas->regions[i];
+        ok = (region->x + region->w <= atlas->sheet.w) && (region->y + region->h <= atlas->sheet.h);
+    }
 
-    // Flush any final output
-    copied = 0;
-    heatshrink_decoder_poll(hsd, &decompressedBuf[outputIdx], sizeof(decompressedBuf) - outputIdx, &copied);
-    outputIdx += copied;
+    // Done with the file
+    spiffsUnmapFile(buf);
 
-    // All done decoding
-    heatshrink_decoder_finish(hsd);
-    heatshrink_decoder_free(hsd);
-    // Free the bytes read from the file
-    free(buf);
+    if(!ok)
+    {
+        ESP_LOGE("WSG", "Failed to load atlas %s", name);
+        freeWsgAtlas(atlas);
+    }
+    return ok;
+}
 
-    // Save the decompressed info to the wsg. The first four bytes are dimension
-    wsg->w = (decompressedBuf[0] << 8) | decompressedBuf[1];
-    wsg->h = (decompressedBuf[2] << 8) | decompressedBuf[3];
-    // The rest of the bytes are pixels
-#if defined( _TEST_USE_SPIRAM_ ) && !defined( EMU )
-    wsg->px = (paletteColor_t*)heap_caps_malloc(sizeof(paletteColor_t) * wsg->w * wsg->h, MALLOC_CAP_SPIRAM);
-#else
-    wsg->px = (paletteColor_t*)malloc(sizeof(paletteColor_t) * wsg->w * wsg->h);
-#endif
+/**
+ * @brief Find a sprite in an atlas
+ *
+ * @param atlas The atlas to look in
+ * @param name The sprite's name, its PNG's filename without the extension
+ * @return The sprite's region, or NULL if it isn't in the atlas
+ */
+const wsgRegion_t* getWsgRegion(const wsgAtlas_t* atlas, const char* name)
+{
+    // Regions are sorted by name
+    int32_t lo = 0;
+    int32_t hi = atlas->numRegions - 1;
+    while(lo <= hi)
+    {
+        int32_t mid = (lo + hi) / 2;
+        int cmp = strcmp(atlas->regions[mid].name, name);
+        if(0 == cmp)
+        {
+            return &atlas->regions[mid];
+        }
+        else if(cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    ESP_LOGE("WSG", "%s isn't in the atlas", name);
+    return NULL;
+}
+
+/**
+ * @brief Load one sprite out of an atlas as its own WSG, for modes which share
+ * a sprite with another mode's atlas
+ *
+ * @param atlasName The filename of the atlas
+ * @param spriteName The sprite's name, its PNG's filename without the extension
+ * @param wsg A handle to load the WSG to
+ * @return true if the WSG was loaded successfully,
+ *         false if the WSG load failed and should not be used
+ */
+bool loadWsgFromAtlas(const char* atlasName, const char* spriteName, wsg_t* wsg)
+{
+    wsgAtlas_t atlas;
+    wsg->px = NULL;
+    if(!loadWsgAtlas(atlasName, &atlas))
+    {
+        return false;
+    }
+
+    const wsgRegion_t* region = getWsgRegion(&atlas, spriteName);
+    if(NULL != region)
+    {
+        wsg->px = allocWsgPx(region->w * region->h);
+    }
     if(NULL != wsg->px)
     {
-        memcpy(wsg->px, &decompressedBuf[4], outputIdx - 4);
-        return true;
+        wsg->w = region->w;
+        wsg->h = region->h;
+        for(uint16_t y = 0; y < region->h; y++)
+        {
+            memcpy(&wsg->px[y * region->w], &atlas.sheet.px[((region->y + y) * atlas.sheet.w) + region->x], region->w);
+        }
     }
+    freeWsgAtlas(&atlas);
+    return (NULL != wsg->px);
+}
 
-    // all done
-    return false;
+/**
+ * @brief Free the memory for a loaded atlas
+ *
+ * @param atlas The atlas to free memory from
+ */
+void freeWsgAtlas(wsgAtlas_t* atlas)
+{
+    free(atlas->sheet.px);
+    atlas->sheet.px = NULL;
+    free(atlas->regions);
+    atlas->regions = NULL;
+    atlas->numRegions = 0;
 }
 
 /**
@@ -607,10 +912,119 @@ void drawWsgTile(display_t* disp, wsg_t* wsg, int32_t xOff, int32_t yOff)
 }
 
 /**
- * @brief Load a font from ROM to RAM. Fonts are bitmapped image files that have
- * a single height, all ASCII characters, and a width for each character.
- * PNGs placed in the assets folder before compilation will be automatically
- * flashed to ROM
+ * @brief Draw one sprite out of an atlas's sheet to the display. Pixels are
+ * read straight out of the sheet, nothing is unpacked
+ *
+ * @param disp The display to draw the sprite to
+ * @param wsg The atlas's sheet
+ * @param region Where the sprite is in the sheet
+ * @param xOff The x offset to draw the sprite at
+ * @param yOff The y offset to draw the sprite at
+ * @param flipLR true to flip the sprite across the Y axis
+ * @param flipUD true to flip the sprite across the X axis
+ */
+void drawWsgRegion(display_t* disp, const wsg_t* wsg, const wsgRegion_t* region, int16_t xOff, int16_t yOff,
+                   bool flipLR, bool flipUD)
+{
+    if(NULL == wsg->px || NULL == region)
+    {
+        return;
+    }
+
+    // Only draw in bounds
+    int32_t dWidth = disp->w;
+    int32_t xMin = CLAMP(xOff, 0, dWidth);
+    int32_t xMax = CLAMP(xOff + region->w, 0, dWidth);
+    int32_t yMin = CLAMP(yOff, 0, disp->h);
+    int32_t yMax = CLAMP(yOff + region->h, 0, disp->h);
+    if(xMin >= xMax || yMin >= yMax)
+    {
+        return;
+    }
+
+    // Find the first pixel to draw in the sheet, and which way to step
+    int32_t srcX = xMin - xOff;
+    int32_t xInc = 1;
+    if(flipLR)
+    {
+        srcX = region->w - 1 - srcX;
+        xInc = -1;
+    }
+    int32_t srcY = yMin - yOff;
+    int32_t yInc = wsg->w;
+    if(flipUD)
+    {
+        srcY = region->h - 1 - srcY;
+        yInc = -yInc;
+    }
+    const paletteColor_t* linein = &wsg->px[((region->y + srcY) * wsg->w) + region->x + srcX];
+    paletteColor_t* lineout = &disp->pxFb[(yMin * dWidth) + xMin];
+    int32_t numX = xMax - xMin;
+
+    // Draw each pixel
+    for(int32_t y = yMin; y < yMax; y++)
+    {
+        const paletteColor_t* in = linein;
+        for(int32_t x = 0; x < numX; x++)
+        {
+            paletteColor_t color = *in;
+            if(cTransparent != color)
+            {
+                lineout[x] = color;
+            }
+            in += xInc;
+        }
+        lineout += dWidth;
+        linein += yInc;
+    }
+}
+
+/**
+ * Quickly copy one sprite out of an atlas's sheet into the framebuffer. This
+ * ignores transparency
+ *
+ * @param disp The display to draw the sprite to
+ * @param wsg The atlas's sheet
+ * @param region Where the sprite is in the sheet
+ * @param xOff The x offset to draw the sprite at
+ * @param yOff The y offset to draw the sprite at
+ */
+void drawWsgRegionTile(display_t* disp, const wsg_t* wsg, const wsgRegion_t* region, int32_t xOff, int32_t yOff)
+{
+    if(NULL == wsg->px || NULL == region)
+    {
+        return;
+    }
+
+    // Only draw in bounds
+    int32_t dWidth = disp->w;
+    int32_t xMin = CLAMP(xOff, 0, dWidth);
+    int32_t xMax = CLAMP(xOff + region->w, 0, dWidth);
+    int32_t yMin = CLAMP(yOff, 0, disp->h);
+    int32_t yMax = CLAMP(yOff + region->h, 0, disp->h);
+    if(xMin >= xMax || yMin >= yMax)
+    {
+        return;
+    }
+
+    const paletteColor_t* linein = &wsg->px[((region->y + yMin - yOff) * wsg->w) + region->x + xMin - xOff];
+    paletteColor_t* lineout = &disp->pxFb[(yMin * dWidth) + xMin];
+
+    // Copy each row
+    for(int32_t y = yMin; y < yMax; y++)
+    {
+        memcpy(lineout, linein, xMax - xMin);
+        lineout += dWidth;
+        linein += wsg->w;
+    }
+}
+
+/**
+ * @brief Load a font. Fonts are bitmapped image files that have a single
+ * height, all ASCII characters, and a width for each character. PNGs placed in
+ * the assets folder before compilation will be automatically converted to runs
+ * of opaque pixels and flashed to ROM. Fonts in the asset pack are drawn
+ * straight out of flash, otherwise the file is read into one allocation
  *
  * @param name The name of the font to load
  * @param font A handle to load the font to
@@ -619,41 +1033,50 @@ void drawWsgTile(display_t* disp, wsg_t* wsg, int32_t xOff, int32_t yOff)
  */
 bool loadFont(const char* name, font_t* font)
 {
-    // Read font from file
-    uint8_t* buf = NULL;
-    size_t bufIdx = 0;
+    // Get a view of the font file
+    const uint8_t* buf = NULL;
     size_t sz;
-    if(!spiffsReadFile(name, &buf, &sz))
+    font->data = NULL;
+    if(!spiffsMapFile(name, &buf, &sz))
     {
         ESP_LOGE("FONT", "Failed to read %s", name);
         return false;
     }
 
-    // Read the data into a font struct
-    font->h = buf[bufIdx++];
-
-    // Read each char
-    for(char ch = ' '; ch <= '~'; ch++)
+    // Point each char at its runs, checking they're all in the file so drawing
+    // doesn't have to
+    bool ok = (sz >= FONT_HEADER_SIZE + (FONT_NUM_CHARS * 2)) && (FONT_NUM_CHARS == buf[1]);
+    font->h = ok ? buf[0] : 0;
+    for(uint8_t ch = 0; ok && ch < FONT_NUM_CHARS; ch++)
     {
-        // Get an easy refence to this character
-        font_ch_t* this = &font->chars[ch - ' '];
-
-        // Read the width
-        this->w = buf[bufIdx++];
-
-        // Figure out what size the char is
-        int pixels = font->h * this->w;
-        int bytes = (pixels / 8) + ((pixels % 8 == 0) ? 0 : 1);
-
-        // Allocate space for this char and copy it over
-        this->bitmap = (uint8_t*) malloc(sizeof(uint8_t) * bytes);
-        memcpy(this->bitmap, &buf[bufIdx], bytes);
-        bufIdx += bytes;
+        font_ch_t* this = &font->chars[ch];
+        size_t idx = (buf[FONT_HEADER_SIZE + (ch * 2)] << 8) | buf[FONT_HEADER_SIZE + (ch * 2) + 1];
+        ok = (idx + 2 <= sz);
+        if(ok)
+        {
+            this->w = buf[idx];
+            this->advance = buf[idx + 1];
+            this->rows = &buf[idx + 2];
+            idx += 2;
+        }
+        for(uint8_t y = 0; ok && y < font->h; y++)
+        {
+            uint8_t runs = (idx < sz) ? buf[idx] : 0;
+            ok = (idx + 1 + (runs * 2) <= sz);
+            for(idx++; ok && runs; runs--, idx += 2)
+            {
+                ok = (buf[idx] + buf[idx + 1] <= this->w);
+            }
+        }
     }
 
-    // Free the SPIFFS data
-    free(buf);
-
+    if(!ok)
+    {
+        ESP_LOGE("FONT", "%s isn't a font", name);
+        spiffsUnmapFile(buf);
+        return false;
+    }
+    font->data = buf;
     return true;
 }
 
@@ -664,31 +1087,30 @@ bool loadFont(const char* name, font_t* font)
  */
 void freeFont(font_t* font)
 {
-    for(char ch = ' '; ch <= '~'; ch++)
-    {
-        free(font->chars[ch - ' '].bitmap);
-    }
+    spiffsUnmapFile(font->data);
+    font->data = NULL;
 }
 
-
 /**
  * @brief Draw a single character from a font to a display
  *
  * @param disp  The display to draw a character to
  * @param color The color of the character to draw
  * @param h     The height of the character to draw
- * @param ch    The character bitmap to draw (includes the width of the char)
+ * @param ch    The character to draw (includes the width of the char)
  * @param xOff  The x offset to draw the char at
  * @param yOff  The y offset to draw the char at
  */
-void drawChar(display_t* disp, paletteColor_t color, int h, font_ch_t* ch, int16_t xOff, int16_t yOff)
+void drawChar(display_t* disp, paletteColor_t color, int h, const font_ch_t* ch, int16_t xOff, int16_t yOff)
 {
-    //  This function has been micro optimized by cnlohr on 2022-09-07, using gcc version 8.4.0 (crosstool-NG esp-2021r2-patch3)
-    paletteColor_t* pxOutput = disp->pxFb + yOff * disp->w;
+    const uint8_t* row = ch->rows;
+    int y = 0;
 
-    int bitIdx = 0;
-    uint8_t* bitmap = ch->bitmap;
-    int wch = ch->w;
+    // Skip the rows above the display
+    for(; y < -yOff && y < h; y++)
+    {
+        row += 1 + (row[0] * 2);
+    }
 
     // Don't draw off the bottom of the screen.
     if( yOff + h > disp->h )
@@ -696,64 +1118,28 @@ void drawChar(display_t* disp, paletteColor_t color, int h, font_ch_t* ch, int16
         h = disp->h - yOff;
     }
 
-    // Check Y bounds
-    if(yOff < 0)
+    // Fill each run of opaque pixels, clipped to the display
+    paletteColor_t* pxOutput = disp->pxFb + (yOff + y) * disp->w;
+    for (; y < h; y++)
     {
-        // Above the display, do wacky math with -yOff
-        bitIdx -= yOff * wch;
-        bitmap += bitIdx >> 3;
-        bitIdx &= 7;
-        h += yOff;
-        yOff = 0;
-    }
-
-    for (int y = 0; y < h; y++)
-    {
-        // Figure out where to draw
-        int truncate = 0;
-
-        int startX = xOff;
-        if( xOff < 0 )
-        {
-            // Track how many groups of pixels we are skipping over
-            // that weren't displayed on the left of the screen.
-            startX = 0;
-            bitIdx += -xOff;
-            bitmap += bitIdx >> 3;
-            bitIdx &= 7;
-        }
-        int endX = xOff + wch;
-        if( endX > disp->w )
+        uint8_t runs = *(row++);
+        for(; runs; runs--, row += 2)
         {
-            // Track how many groups of pixels we are skipping over,
-            // if the letter falls off the end of the screen.
-            truncate = endX - disp->w;
-            endX = disp->w;
-        }
-
-        uint8_t thisByte = *bitmap;
-        for (int drawX = startX; drawX < endX; drawX++)
-        {
-            // Figure out where to draw
-            // Check X bounds
-            if(thisByte & (1 << bitIdx))
+            int startX = xOff + row[0];
+            int endX = startX + row[1];
+            if(startX < 0)
             {
-                // Draw the pixel
-                pxOutput[drawX] = color;
+                startX = 0;
             }
-
-            // Iterate over the bit data
-            if( 8 == ++bitIdx )
+            if(endX > disp->w)
             {
-                bitIdx = 0;
-                thisByte = *(++bitmap);
+                endX = disp->w;
+            }
+            if(startX < endX)
+            {
+                memset(&pxOutput[startX], color, endX - startX);
             }
         }
-
-        // Handle any remaining bits if we have ended off the end of the display.
-        bitIdx += truncate;
-        bitmap += bitIdx >> 3;
-        bitIdx &= 7;
         pxOutput += disp->w;
     }
 }
@@ -782,7 +1168,7 @@ int16_t drawText(display_t* disp, font_t* font, paletteColor_t color, const char
         }
 
         // Move to the next char
-        xOff += (font->chars[(*text) - ' '].w + 1);
+        xOff += font->chars[(*text) - ' '].advance;
         text++;
 
         // If this char is offscreen, finish drawing
@@ -804,15 +1190,17 @@ int16_t drawText(display_t* disp, font_t* font, paletteColor_t color, const char
 uint16_t textWidth(font_t* font, const char* text)
 {
     uint16_t width = 0;
+    const font_ch_t* last = NULL;
     while(*text != 0)
     {
-        width += (font->chars[(*text) - ' '].w + 1);
+        last = &font->chars[(*text) - ' '];
+        width += last->advance;
         text++;
     }
     // Delete trailing space
-    if(0 < width)
+    if(NULL != last)
     {
-        width--;
+        width -= (last->advance - last->w);
     }
     return width;
 }
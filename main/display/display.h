@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include "palette.h"
 
 #if !defined(EMU)
@@ -50,6 +51,30 @@
 // Get a pixel directly from the framebuffer
 #define GET_PIXEL(d, x, y) (d)->pxFb[((y)*((d)->w))+(x)]
 
+// WSG files start with an eight byte header. The first two bytes are zero,
+// which older WSGs (a two byte decompressed size, then heatshrink 8/4) never
+// start with, then the codec, then the heatshrink window (high nibble) and
+// lookahead (low nibble), then the width and height, big endian. The pixels
+// follow. These must match spiffs_file_preprocessor/image_processor.h
+#define WSG_HEADER_SIZE      8
+#define WSG_CODEC_RAW        0
+#define WSG_CODEC_RLE        1
+#define WSG_CODEC_HEATSHRINK 2
+
+// Atlases start with the number of sprites and the size of the name table,
+// then each sprite's name offset, x, y, width and height, sorted by name, all
+// big endian. The null terminated names follow, then the sheet as a WSG. These
+// must match spiffs_file_preprocessor/atlas_processor.h
+#define ATLAS_HEADER_SIZE 4
+#define ATLAS_REGION_SIZE 10
+
+// Fonts start with the height and the number of chars, then each char's offset
+// from the start of the file, big endian. Each char is its width and advance,
+// then for each row the number of opaque runs and each run's x and length.
+// These must match spiffs_file_preprocessor/font_processor.h
+#define FONT_HEADER_SIZE 2
+#define FONT_NUM_CHARS ('~' - ' ' + 1)
+
 //==============================================================================
 // Structs
 //==============================================================================
@@ -61,6 +86,22 @@ typedef struct
     uint16_t h;
 } wsg_t;
 
+typedef struct
+{
+    const char* name;
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} wsgRegion_t;
+
+typedef struct
+{
+    wsg_t sheet;
+    wsgRegion_t* regions; // Sorted by name, the names follow the regions
+    uint16_t numRegions;
+} wsgAtlas_t;
+
 struct display;
 
 typedef void (*fnBackgroundDrawCallback_t)(struct display* disp, int16_t x, int16_t y, int16_t w, int16_t h, int16_t up,
@@ -88,13 +129,15 @@ typedef struct display display_t;
 typedef struct
 {
     uint8_t w;
-    uint8_t* bitmap;
+    uint8_t advance;     // Distance from this char to the next
+    const uint8_t* rows; // Each row's number of runs, then each run's x and length
 } font_ch_t;
 
 typedef struct
 {
     uint8_t h;
-    font_ch_t chars['~' - ' ' + 1];
+    const uint8_t* data; // The font file, which the chars point into
+    font_ch_t chars[FONT_NUM_CHARS];
 } font_t;
 
 //==============================================================================
@@ -104,15 +147,24 @@ typedef struct
 void fillDisplayArea(display_t* disp, int16_t x1, int16_t y1, int16_t x2,
                      int16_t y2, paletteColor_t c);
 
-bool loadWsg(char* name, wsg_t* wsg);
+bool loadWsg(const char* name, wsg_t* wsg);
+bool decodeWsgData(uint8_t codec, uint8_t params, const uint8_t* in, size_t inLen, uint8_t* out, uint32_t outLen);
 void drawWsg(display_t* disp, wsg_t* wsg, int16_t xOff, int16_t yOff,
              bool flipLR, bool flipUD, int16_t rotateDeg);
 void drawWsgSimpleFast(display_t* disp, wsg_t* wsg, int16_t xOff, int16_t yOff);
 void drawWsgTile(display_t* disp, wsg_t* wsg, int32_t xOff, int32_t yOff);
 void freeWsg(wsg_t* wsg);
 
+bool loadWsgAtlas(const char* name, wsgAtlas_t* atlas);
+const wsgRegion_t* getWsgRegion(const wsgAtlas_t* atlas, const char* name);
+bool loadWsgFromAtlas(const char* atlasName, const char* spriteName, wsg_t* wsg);
+void drawWsgRegion(display_t* disp, const wsg_t* wsg, const wsgRegion_t* region, int16_t xOff, int16_t yOff,
+                   bool flipLR, bool flipUD);
+void drawWsgRegionTile(display_t* disp, const wsg_t* wsg, const wsgRegion_t* region, int32_t xOff, int32_t yOff);
+void freeWsgAtlas(wsgAtlas_t* atlas);
+
 bool loadFont(const char* name, font_t* font);
-void drawChar(display_t* disp, paletteColor_t color, int h, font_ch_t* ch,
+void drawChar(display_t* disp, paletteColor_t color, int h, const font_ch_t* ch,
               int16_t xOff, int16_t yOff);
 int16_t drawText(display_t* disp, font_t* font, paletteColor_t color,
                  const char* text, int16_t xOff, int16_t yOff);
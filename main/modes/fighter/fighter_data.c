@@ -0,0 +1,376 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _TEST_USE_SPIRAM_
+    #include <esp_heap_caps.h>
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+#endif
+
+#include "esp_log.h"
+
+#include "fighter_data.h"
+#include "../../components/hdw-spiffs/spiffs_manager.h"
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    char* name;
+    wsg_t sprite;
+    uint8_t idx;
+} namedSprite_t;
+
+//==============================================================================
+// Binary Utility Functions
+//==============================================================================
+
+/**
+ * @brief Read a uint8_t and move past it
+ *
+ * @param data A pointer to the data, which is advanced
+ * @return The value
+ */
+static uint8_t readU8(const uint8_t** data)
+{
+    return *((*data)++);
+}
+
+/**
+ * @brief Read a big endian uint16_t and move past it
+ *
+ * @param data A pointer to the data, which is advanced
+ * @return The value
+ */
+static uint16_t readU16(const uint8_t** data)
+{
+    uint16_t val = ((*data)[0] << 8) | (*data)[1];
+    (*data) += 2;
+    return val;
+}
+
+/**
+ * @brief Read a big endian int32_t and move past it
+ *
+ * @param data A pointer to the data, which is advanced
+ * @return The value
+ */
+static int32_t readI32(const uint8_t** data)
+{
+    uint32_t val = ((uint32_t)(*data)[0] << 24) | ((uint32_t)(*data)[1] << 16) | ((*data)[2] << 8) | (*data)[3];
+    (*data) += 4;
+    return (int32_t)val;
+}
+
+//==============================================================================
+// Loading Functions
+//==============================================================================
+
+/**
+ * @brief Load a fighter compiled by the spiffs_file_preprocessor. The file is
+ * checked, then every attack's frames and hitboxes are copied into one
+ * allocation, and each sprite the fighter uses is loaded once
+ *
+ * @param fighter The fighter_t struct to load a fighter into
+ * @param name The compiled fighter file to load data from
+ * @param loadedSprites A list of loaded sprites. Will be filled with sprites
+ * @return true if the fighter was loaded, false if it wasn't
+ */
+bool loadFighterData(fighter_t* fighter, const char* name, list_t* loadedSprites)
+{
+    // Get a view of the fighter file
+    const uint8_t* buf = NULL;
+    size_t sz;
+    if(!spiffsMapFile(name, &buf, &sz))
+    {
+        ESP_LOGE("FTR", "Failed to read %s", name);
+        return false;
+    }
+
+    // Check the header, and that every record and all the names fit
+    const uint8_t* data = buf;
+    uint8_t numSprites = 0;
+    uint8_t numAttacks = 0;
+    uint16_t numFrames = 0;
+    uint16_t numHitboxes = 0;
+    uint16_t namesSize = 0;
+    size_t dataSz = 0;
+    bool ok = (sz >= FIGHTER_HEADER_SIZE) && (0 == memcmp(buf, "FTR", 3)) && (FIGHTER_DATA_VERSION == buf[3]);
+    if(ok)
+    {
+        data += 4;
+        numSprites = readU8(&data);
+        numAttacks = readU8(&data);
+        numFrames = readU16(&data);
+        numHitboxes = readU16(&data);
+        namesSize = readU16(&data);
+        dataSz = FIGHTER_HEADER_SIZE + FIGHTER_RECORD_SIZE + (numAttacks * FIGHTER_ATTACK_SIZE) +
+                 (numFrames * FIGHTER_FRAME_SIZE) + (numHitboxes * FIGHTER_HITBOX_SIZE) + namesSize;
+        ok = (0 == numAttacks || NUM_ATTACKS == numAttacks) && (0 < namesSize) && (dataSz <= sz) &&
+             (0 == buf[dataSz - 1]);
+    }
+
+    // Each sprite is loaded once, and the file's sprite indices are mapped to
+    // loadedSprites'. FIGHTER_NO_SPRITE maps to 0, like an unset field
+    uint8_t spriteIdxs[256] = {0};
+    const char* spriteName = (const char*)&buf[dataSz - namesSize];
+    for(uint8_t i = 0; ok && i < numSprites; i++)
+    {
+        ok = (spriteName < (const char*)&buf[dataSz]);
+        if(ok)
+        {
+            spriteIdxs[i] = loadFighterSprite(spriteName, loadedSprites);
+            spriteName += strlen(spriteName) + 1;
+        }
+    }
+
+    // The fighter's own record
+    memset(fighter->attacks, 0, sizeof(fighter->attacks));
+    fighter->attackData = NULL;
+    if(ok)
+    {
+        fighter->gravity = readI32(&data);
+        fighter->jump_velo = readI32(&data);
+        fighter->run_accel = readI32(&data);
+        fighter->run_decel = readI32(&data);
+        fighter->run_max_velo = readI32(&data);
+        fighter->size.x = readI32(&data);
+        fighter->size.y = readI32(&data);
+        fighter->originalSize = fighter->size;
+        fighter->landingLag = readU16(&data);
+        fighter->numJumps = readU8(&data);
+        fighter->idleSprite0 = spriteIdxs[readU8(&data)];
+        fighter->idleSprite1 = spriteIdxs[readU8(&data)];
+        fighter->runSprite0 = spriteIdxs[readU8(&data)];
+        fighter->runSprite1 = spriteIdxs[readU8(&data)];
+        fighter->jumpSprite = spriteIdxs[readU8(&data)];
+        fighter->duckSprite = spriteIdxs[readU8(&data)];
+        fighter->landingLagSprite = spriteIdxs[readU8(&data)];
+        fighter->hitstunGroundSprite = spriteIdxs[readU8(&data)];
+        fighter->hitstunAirSprite = spriteIdxs[readU8(&data)];
+
+        // Every frame then every hitbox, in one allocation
+        if(0 < numFrames)
+        {
+            fighter->attackData = calloc(1, (numFrames * sizeof(attackFrame_t)) + (numHitboxes * sizeof(attackHitbox_t)));
+            ok = (NULL != fighter->attackData);
+        }
+    }
+
+    // Point each attack at its frames, and each frame at its hitboxes
+    attackFrame_t* frames = fighter->attackData;
+    attackHitbox_t* hitboxes = (attackHitbox_t*)&frames[numFrames];
+    const uint8_t* frmData = &data[numAttacks * FIGHTER_ATTACK_SIZE];
+    const uint8_t* hbxData = &frmData[numFrames * FIGHTER_FRAME_SIZE];
+    uint16_t frmIdx = 0;
+    uint16_t hbxIdx = 0;
+    for(uint8_t atkIdx = 0; ok && atkIdx < numAttacks; atkIdx++)
+    {
+        attack_t* atk = &fighter->attacks[atkIdx];
+        atk->startupLagSprite = spriteIdxs[readU8(&data)];
+        atk->endLagSprite = spriteIdxs[readU8(&data)];
+        atk->startupLag = readU16(&data);
+        atk->endLag = readU16(&data);
+        atk->landingLag = readU16(&data);
+        atk->iFrames = readU16(&data);
+        atk->numAttackFrames = readU8(&data);
+        atk->onlyFirstHit = readU8(&data);
+        atk->attackFrames = &frames[frmIdx];
+        ok = (frmIdx + atk->numAttackFrames <= numFrames);
+
+        for(uint8_t i = 0; ok && i < atk->numAttackFrames; i++, frmIdx++)
+        {
+            attackFrame_t* frm = &frames[frmIdx];
+            frm->sprite = spriteIdxs[readU8(&frmData)];
+            frm->numHitboxes = readU8(&frmData);
+            frm->duration = readU16(&frmData);
+            frm->iFrames = readU16(&frmData);
+            frm->sprite_offset.x = readI32(&frmData);
+            frm->sprite_offset.y = readI32(&frmData);
+            frm->hurtbox_offset.x = readI32(&frmData);
+            frm->hurtbox_offset.y = readI32(&frmData);
+            frm->hurtbox_size.x = readI32(&frmData);
+            frm->hurtbox_size.y = readI32(&frmData);
+            frm->velocity.x = readI32(&frmData);
+            frm->velocity.y = readI32(&frmData);
+            frm->hitboxes = &hitboxes[hbxIdx];
+            ok = (hbxIdx + frm->numHitboxes <= numHitboxes);
+
+            for(uint8_t j = 0; ok && j < frm->numHitboxes; j++, hbxIdx++)
+            {
+                attackHitbox_t* hbx = &hitboxes[hbxIdx];
+                hbx->hitboxPos.x = readI32(&hbxData);
+                hbx->hitboxPos.y = readI32(&hbxData);
+                hbx->hitboxSize.x = readI32(&hbxData);
+                hbx->hitboxSize.y = readI32(&hbxData);
+                hbx->knockback.x = readI32(&hbxData);
+                hbx->knockback.y = readI32(&hbxData);
+                hbx->projVelo.x = readI32(&hbxData);
+                hbx->projVelo.y = readI32(&hbxData);
+                hbx->projAccel.x = readI32(&hbxData);
+                hbx->projAccel.y = readI32(&hbxData);
+                hbx->damage = readU16(&hbxData);
+                hbx->hitstun = readU16(&hbxData);
+                hbx->projDuration = readU16(&hbxData);
+                hbx->isProjectile = readU8(&hbxData);
+                hbx->projSprite = spriteIdxs[readU8(&hbxData)];
+            }
+        }
+    }
+    ok = ok && (frmIdx == numFrames) && (hbxIdx == numHitboxes);
+
+    // Done with the file
+    spiffsUnmapFile(buf);
+
+    if(!ok)
+    {
+        ESP_LOGE("FTR", "Failed to load fighter %s", name);
+        free(fighter->attackData);
+        fighter->attackData = NULL;
+        memset(fighter->attacks, 0, sizeof(fighter->attacks));
+    }
+    return ok;
+}
+
+/**
+ * @brief Free all the data associated with an array of fighters
+ *
+ * @param fighters A pointer to fighter data to free
+ * @param numFighters The number of fighters to free
+ */
+void freeFighterData(fighter_t* fighters, uint8_t numFighters)
+{
+    for(uint8_t ftrIdx = 0; ftrIdx < numFighters; ftrIdx++)
+    {
+        // Every attack's frames and hitboxes are in one allocation
+        free(fighters[ftrIdx].attackData);
+        fighters[ftrIdx].attackData = NULL;
+        memset(fighters[ftrIdx].attacks, 0, sizeof(fighters[ftrIdx].attacks));
+    }
+    // Fighters aren't dynamically allocated
+}
+
+/**
+ * Load a sprite, or return a pointer to that sprite if it's already loaded.
+ * When loading a sprite, add it to loadedSprites.
+ *
+ * TODO optimize sprite IDX
+ *
+ * @param name The name of the sprite to load
+ * @param loadedSprites A linked list of loaded sprites
+ * @return A sprite index
+ */
+uint8_t loadFighterSprite(const char* name, list_t* loadedSprites)
+{
+    uint32_t spriteIdx = 255;
+    // Iterate through the list of loaded sprites and look to see if this
+    // has been loaded already. If so, return it
+    node_t* currentNode = loadedSprites->first;
+    while (currentNode != NULL)
+    {
+        spriteIdx = ((namedSprite_t*)currentNode->val)->idx;
+        if(0 == strcmp(((namedSprite_t*)currentNode->val)->name, name))
+        {
+            // Name matches, so return this loaded sprite
+            // return &((namedSprite_t*)currentNode->val)->sprite;
+            return spriteIdx;
+        }
+        // Name didn't match, so iterate
+        currentNode = currentNode->next;
+    }
+
+    // Made it this far, which means it isn't loaded yet.
+    // Allocate a new sprite
+    namedSprite_t* newSprite = calloc(1, sizeof(namedSprite_t));
+
+#ifdef _MAX_LOAD_SPRITE_TEST_
+    while(1)
+#endif
+    {
+        // Load the sprite
+        if(loadWsg(name, &(newSprite->sprite)))
+        {
+            // Copy the name
+#ifdef _TEST_USE_SPIRAM_
+            newSprite->name = heap_caps_calloc(1, strlen(name) + 1, MALLOC_CAP_SPIRAM);
+#ifdef _MAX_LOAD_SPRITE_TEST_
+            ESP_LOGE("SPR", "loaded %d sprites (%d free, %d largest block)", spriteIdx, heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                     heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+#endif
+#else
+            newSprite->name = calloc(1, strlen(name) + 1);
+#ifdef _MAX_LOAD_SPRITE_TEST_
+            ESP_LOGE("SPR", "loaded %d sprites (%d free, %d largest block)", spriteIdx, heap_caps_get_free_size(MALLOC_CAP_8BIT),
+                     heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+#endif
+#endif
+            memcpy(newSprite->name, name, strlen(name) + 1);
+            // Set the IDX
+            newSprite->idx = (++spriteIdx);
+
+            // Add the loaded sprite to the list
+            push(loadedSprites, newSprite);
+
+#ifdef _MAX_LOAD_SPRITE_TEST_
+            // When looping infinitely, yield sometimes
+            taskYIELD();
+#endif
+        }
+    }
+
+    // Return the loaded sprite
+    // return &(newSprite->sprite);
+    return newSprite->idx;
+}
+
+/**
+ * Get a sprite given the sprite's index
+ *
+ * TODO optimize sprite IDX
+ *
+ * @param spriteIdx The index to get a sprite for
+ * @param loadedSprites A list of loaded sprites
+ * @return wsg_t* The sprite that corresponds to this index
+ */
+wsg_t* getFighterSprite(uint8_t spriteIdx, list_t* loadedSprites)
+{
+    // Iterate through the list of loaded sprites and look to see if this
+    // has been loaded already. If so, return it
+    node_t* currentNode = loadedSprites->first;
+    while (currentNode != NULL)
+    {
+        if (spriteIdx == ((namedSprite_t*)currentNode->val)->idx)
+        {
+            return &(((namedSprite_t*)currentNode->val)->sprite);
+        }
+        // Index didn't match, so iterate
+        currentNode = currentNode->next;
+    }
+    return NULL;
+}
+
+/**
+ * Free all loaded sprites
+ *
+ * @param loadedSprites a list of sprites to free
+ */
+void freeFighterSprites(list_t* loadedSprites)
+{
+    // Pop and free all sprites
+    namedSprite_t* toFree;
+    while (NULL != (toFree = pop(loadedSprites)))
+    {
+        // Free the fields
+        freeWsg(&(toFree->sprite));
+        free(toFree->name);
+        // Free the named sprite
+        free(toFree);
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef _FIGHTER_DATA_H_
+#define _FIGHTER_DATA_H_
+
+#include "mode_fighter.h"
+#include "linked_list.h"
+
+/*
+ * Fighters are compiled from JSON by the spiffs_file_preprocessor into a flat,
+ * big endian binary. It starts with "FTR" and a version byte, then the number
+ * of sprites and attacks (uint8_t) and the number of attack frames, hitboxes
+ * and bytes of sprite names (uint16_t). The fighter's record follows, then each
+ * attack's, each frame's and each hitbox's, then the null terminated sprite
+ * names the records index.
+ *
+ * This must match fighter_processor.h
+ */
+#define FIGHTER_DATA_VERSION 1
+#define FIGHTER_HEADER_SIZE 12
+#define FIGHTER_RECORD_SIZE 40
+#define FIGHTER_ATTACK_SIZE 12
+#define FIGHTER_FRAME_SIZE 38
+#define FIGHTER_HITBOX_SIZE 48
+#define FIGHTER_NO_SPRITE 0xFF
+
+bool loadFighterData(fighter_t* fighter, const char* name, list_t* loadedSprites);
+void freeFighterData(fighter_t* fighter, uint8_t numFighters);
+
+void freeFighterSprites(list_t* loadedSprites);
+uint8_t loadFighterSprite(const char* name, list_t* loadedSprites);
+wsg_t* getFighterSprite(uint8_t spriteIdx, list_t* loadedSprites);
+
+#endif
@@ -24,7 +24,7 @@
 #include "led_util.h"
 
 #include "mode_fighter.h"
-#include "fighter_json.h"
+#include "fighter_data.h"
 #include "fighter_menu.h"
 
 //==============================================================================
@@ -251,23 +251,23 @@ void fighterStartGame(display_t* disp, font_t* mmFont, fightingGameType_t type,
         {
             case KING_DONUT:
             {
-                loadJsonFighterData(&f->fighters[i], "kd.json", &(f->loadedSprites));
+                loadFighterData(&f->fighters[i], "kd.ftr", &(f->loadedSprites));
                 break;
             }
             case SUNNY:
             {
-                loadJsonFighterData(&f->fighters[i], "sn.json", &(f->loadedSprites));
+                loadFighterData(&f->fighters[i], "sn.ftr", &(f->loadedSprites));
                 break;
             }
             case BIG_FUNKUS:
             {
-                loadJsonFighterData(&f->fighters[i], "bf.json", &(f->loadedSprites));
+                loadFighterData(&f->fighters[i], "bf.ftr", &(f->loadedSprites));
                 break;
             }
             case SANDBAG:
             case NO_CHARACTER:
             {
-                loadJsonFighterData(&f->fighters[i], "sb.json", &(f->loadedSprites));
+                loadFighterData(&f->fighters[i], "sb.ftr", &(f->loadedSprites));
                 break;
             }
         }
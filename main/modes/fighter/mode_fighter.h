@@ -187,6 +187,8 @@ typedef struct
     int32_t run_max_velo;
     /* Attack data */
     attack_t attacks[NUM_ATTACKS];
+    /* Every attack's frames then every frame's hitboxes, in one allocation */
+    void* attackData;
     /* Sprite names */
     uint8_t idleSprite0;
     uint8_t idleSprite1;
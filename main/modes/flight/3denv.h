@@ -3,1539 +3,1874 @@
 
 #include <stdint.h>
 const uint16_t model3d[] = {
-	0x6d69, 0x6c64, 0x0116, 0x0018, 0x0008, 0x0003, 0xfb9d, 0xff93, 0xfcc5, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 
-	0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 
-	0x0006, 0x000f, 0x0015, 0xfb85, 0xfef9, 0xfcf7, 0xfb85, 0x002d, 0xfc93, 0xfb85, 0xfef9, 0xfc93, 0xfb85, 0x002d, 0xfcf7, 0xfbb4, 
-	0x002d, 0xfcf7, 0xfbb4, 0x002d, 0xfc93, 0xfbb4, 0xfef9, 0xfcf7, 0xfbb4, 0xfef9, 0xfc93, 0x0018, 0x0008, 0x0003, 0xfce6, 0xff93, 
-	0xffae, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 
-	0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0xfcf9, 0xfef9, 0xffe1, 0xfcb2, 0x002d, 
-	0xff9b, 0xfcb2, 0xfef9, 0xff9b, 0xfcf9, 0x002d, 0xffe1, 0xfd19, 0x002d, 0xffc1, 0xfcd3, 0x002d, 0xff7a, 0xfd19, 0xfef9, 0xffc1, 
-	0xfcd3, 0xfef9, 0xff7a, 0x0018, 0x0008, 0x0003, 0xfede, 0xff93, 0x00cf, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 
-	0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 
-	0x0006, 0x000f, 0x0015, 0xff08, 0xfef9, 0x00f3, 0xfea7, 0x002d, 0x00d9, 0xfea7, 0xfef9, 0x00d9, 0xff08, 0x002d, 0x00f3, 0xff14, 
-	0x002d, 0x00c6, 0xfeb3, 0x002d, 0x00ac, 0xff14, 0xfef9, 0x00c6, 0xfeb3, 0xfef9, 0x00ac, 0x0018, 0x0008, 0x0003, 0x0122, 0xff93, 
-	0x00cf, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 
-	0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x0159, 0xfef9, 0x00d9, 0x00f8, 0x002d, 
-	0x00f3, 0x00f8, 0xfef9, 0x00f3, 0x0159, 0x002d, 0x00d9, 0x014d, 0x002d, 0x00ac, 0x00ec, 0x002d, 0x00c6, 0x014d, 0xfef9, 0x00ac, 
-	0x00ec, 0xfef9, 0x00c6, 0x0018, 0x0008, 0x0003, 0xfbf2, 0xff93, 0xfe41, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 
-	0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 
-	0x0006, 0x000f, 0x0015, 0xfbf0, 0xfef9, 0xfe78, 0xfbc9, 0x002d, 0xfe1c, 0xfbc9, 0xfef9, 0xfe1c, 0xfbf0, 0x002d, 0xfe78, 0xfc1a, 
-	0x002d, 0xfe66, 0xfbf4, 0x002d, 0xfe0a, 0xfc1a, 0xfef9, 0xfe66, 0xfbf4, 0xfef9, 0xfe0a, 0x0018, 0x0008, 0x0003, 0x031a, 0xff93, 
-	0xffae, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 
-	0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x034e, 0xfef9, 0xff9b, 0x0307, 0x002d, 
-	0xffe1, 0x0307, 0xfef9, 0xffe1, 0x034e, 0x002d, 0xff9b, 0x032d, 0x002d, 0xff7a, 0x02e7, 0x002d, 0xffc1, 0x032d, 0xfef9, 0xff7a, 
-	0x02e7, 0xfef9, 0xffc1, 0x0018, 0x0008, 0x0003, 0x0463, 0xff93, 0xfcc5, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 
-	0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 
-	0x0006, 0x000f, 0x0015, 0x047b, 0xfef9, 0xfc93, 0x047b, 0x002d, 0xfcf7, 0x047b, 0xfef9, 0xfcf7, 0x047b, 0x002d, 0xfc93, 0x044c, 
-	0x002d, 0xfc93, 0x044c, 0x002d, 0xfcf7, 0x044c, 0xfef9, 0xfc93, 0x044c, 0xfef9, 0xfcf7, 0x0018, 0x0008, 0x0003, 0x040e, 0xff93, 
-	0xfe41, 0x00a3, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 
-	0x0003, 0x000f, 0x0012, 0x000c, 0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x0437, 0xfef9, 0xfe1c, 0x0410, 0x002d, 
-	0xfe78, 0x0410, 0xfef9, 0xfe78, 0x0437, 0x002d, 0xfe1c, 0x040c, 0x002d, 0xfe0a, 0x03e6, 0x002d, 0xfe66, 0x040c, 0xfef9, 0xfe0a, 
-	0x03e6, 0xfef9, 0xfe66, 0x0030, 0x0014, 0x0003, 0xfaa9, 0xff97, 0xfcc3, 0x00a7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 
-	0x000f, 0x0000, 0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0018, 0x0006, 0x0003, 0x001b, 0x0000, 0x0006, 0x001e, 0x0003, 0x0012, 
-	0x001e, 0x0000, 0x0021, 0x0015, 0x0024, 0x000c, 0x0009, 0x0027, 0x0015, 0x000c, 0x002a, 0x000f, 0x0009, 0x002a, 0x002d, 0x0018, 
-	0x001b, 0x0006, 0x001b, 0x0021, 0x0000, 0x001e, 0x0018, 0x0003, 0x001e, 0x0012, 0x0000, 0x0015, 0x0027, 0x0024, 0x0009, 0x002d, 
-	0x0027, 0x000c, 0x0024, 0x002a, 0x0009, 0x000f, 0x002a, 0xfac0, 0x0034, 0xfc91, 0xfa92, 0x0034, 0xfcf5, 0xfac0, 0x0034, 0xfcf5, 
-	0xfa92, 0x0034, 0xfc91, 0xfac0, 0x0034, 0xfcf5, 0xfac0, 0x0034, 0xfc91, 0xfa92, 0x0034, 0xfc91, 0xfa92, 0x0034, 0xfcf5, 0xfa92, 
-	0xfef9, 0xfcf5, 0xfac0, 0xfef9, 0xfcf5, 0xfa92, 0xfef9, 0xfc91, 0xfac0, 0xfef9, 0xfc91, 0xfac0, 0xfef9, 0xfcf5, 0xfa92, 0xfef9, 
-	0xfcf5, 0xfac0, 0xfef9, 0xfc91, 0xfa92, 0xfef9, 0xfc91, 0x0051, 0x0018, 0x0002, 0x0000, 0x0521, 0x0de7, 0x02e1, 0x0000, 0x000f, 
-	0x004e, 0x003f, 0x004b, 0x0027, 0x0048, 0x0045, 0x0036, 0x0042, 0x0045, 0x0033, 0x003f, 0x0039, 0x003c, 0x003c, 0x0030, 0x0036, 
-	0x0039, 0x0030, 0x0033, 0x002d, 0x002a, 0x002a, 0x001e, 0x001b, 0x0027, 0x0021, 0x0024, 0x0024, 0x0018, 0x001e, 0x0021, 0x0018, 
-	0x001b, 0x0015, 0x0006, 0x0012, 0x0015, 0x0003, 0x000f, 0x0009, 0x000c, 0x000c, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0xff7b, 
-	0x04e6, 0x0de7, 0xfef8, 0x04b6, 0x0de7, 0x0108, 0x04b6, 0x0de7, 0x0085, 0x04e6, 0x0de7, 0x0000, 0x04f6, 0x0de7, 0xfe89, 0x046d, 
-	0x0de7, 0x01d5, 0x0408, 0x0de7, 0x0177, 0x046d, 0x0de7, 0xff62, 0x0574, 0x0de7, 0xfeae, 0x0532, 0x0de7, 0x0152, 0x0532, 0x0de7, 
-	0x009e, 0x0574, 0x0de7, 0x0000, 0x0586, 0x0de7, 0xfe2c, 0x04da, 0x0de7, 0x01d4, 0x04da, 0x0de7, 0x024d, 0x045a, 0x0de7, 0xff33, 
-	0x0622, 0x0de7, 0xfe63, 0x05d6, 0x0de7, 0x019d, 0x05d6, 0x0de7, 0x00cd, 0x0622, 0x0de7, 0x0000, 0x063b, 0x0de7, 0xfdb7, 0x0565, 
-	0x0de7, 0x02dc, 0x04c8, 0x0de7, 0x0249, 0x0565, 0x0de7, 0xfdb3, 0x045a, 0x0de7, 0xfd24, 0x04c8, 0x0de7, 0xfe2b, 0x0408, 0x0de7, 
-	0x0018, 0x0008, 0x0002, 0x0000, 0x00d2, 0x0ddf, 0x03fb, 0x0000, 0x0015, 0x0003, 0x0000, 0x0012, 0x0006, 0x000f, 0x0012, 0x0015, 
-	0x000f, 0x000c, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc93, 0x02d9, 0x0ddf, 0x036d, 0x02d9, 0x0ddf, 0xff25, 0xffa7, 
-	0x0ddf, 0xff25, 0xfecb, 0x0ddf, 0x00db, 0xfecb, 0x0ddf, 0x00db, 0xffa7, 0x0ddf, 0xff25, 0xfffe, 0x0ddf, 0x00db, 0xfffe, 0x0ddf, 
-	0x0018, 0x000c, 0x0002, 0xfed0, 0xfe6a, 0x055b, 0x0078, 0x0000, 0x000c, 0x0009, 0x0015, 0x000c, 0x0015, 0x0006, 0x0015, 0x0000, 
-	0x0000, 0x0012, 0x0006, 0x0012, 0x0012, 0x000f, 0x0009, 0x000f, 0x0003, 0x000f, 0x000c, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003, 
-	0xfed7, 0xfdf2, 0x0562, 0xfec8, 0xfdf2, 0x0562, 0xfed7, 0xfee2, 0x0554, 0xfec8, 0xfee2, 0x0554, 0xfec8, 0xfdf2, 0x0554, 0xfec8, 
-	0xfee2, 0x0562, 0xfed7, 0xfee2, 0x0562, 0xfed7, 0xfdf2, 0x0554, 0x0018, 0x000c, 0x0002, 0x0130, 0xfe6a, 0x055b, 0x0078, 0x0000, 
-	0x000c, 0x0009, 0x0015, 0x000c, 0x0015, 0x0006, 0x0015, 0x0000, 0x0000, 0x0012, 0x0006, 0x0012, 0x0012, 0x000f, 0x0009, 0x000f, 
-	0x0003, 0x000f, 0x000c, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003, 0x0129, 0xfdf2, 0x0562, 0x0138, 0xfdf2, 0x0562, 0x0129, 0xfee2, 
-	0x0554, 0x0138, 0xfee2, 0x0554, 0x0138, 0xfdf2, 0x0554, 0x0138, 0xfee2, 0x0562, 0x0129, 0xfee2, 0x0562, 0x0129, 0xfdf2, 0x0554, 
-	0x0030, 0x0010, 0x0002, 0x0000, 0xfe46, 0x042d, 0x00ca, 0x0000, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 
-	0x0021, 0x0018, 0x001e, 0x0021, 0x001e, 0x001b, 0x0018, 0x001b, 0x0015, 0x000c, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 
-	0x0009, 0x0000, 0x0006, 0x0009, 0x0006, 0x0003, 0x0000, 0x0003, 0xff59, 0xfe9a, 0x042d, 0xff48, 0xfe9a, 0x042d, 0xff48, 0xfdf2, 
-	0x042d, 0xff59, 0xfdf2, 0x042d, 0xffae, 0xfdf2, 0x042d, 0xffbf, 0xfdf2, 0x042d, 0xffbf, 0xfe9a, 0x042d, 0xffae, 0xfe9a, 0x042d, 
-	0x00a7, 0xfe9a, 0x042d, 0x00b8, 0xfe9a, 0x042d, 0x00b8, 0xfdf2, 0x042d, 0x00a7, 0xfdf2, 0x042d, 0x0052, 0xfdf2, 0x042d, 0x0041, 
-	0xfdf2, 0x042d, 0x0041, 0xfe9a, 0x042d, 0x0052, 0xfe9a, 0x042d, 0x000c, 0x0002, 0x0003, 0x0000, 0xfea2, 0x043f, 0x00c0, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x00bf, 0xfebd, 0x043f, 0xff41, 0xfe87, 0x043f, 0x00bf, 0xfe87, 0x043f, 0xff41, 
-	0xfebd, 0x043f, 0x0057, 0x001c, 0x0002, 0x0000, 0xfee2, 0x04c8, 0x01de, 0x0000, 0x002a, 0x0054, 0x0054, 0x0051, 0x0051, 0x004e, 
-	0x004e, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x0042, 0x0042, 0x003f, 0x003f, 0x003c, 0x003c, 0x0039, 0x0039, 0x0036, 
-	0x0036, 0x002d, 0x0030, 0x0033, 0x002d, 0x0030, 0x002a, 0x0027, 0x0027, 0x0024, 0x0024, 0x0021, 0x0021, 0x001e, 0x001e, 0x001b, 
-	0x001b, 0x0018, 0x0018, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0xfe7f, 0xfee2, 0x0545, 0xfe50, 0xfee2, 0x0545, 0xfe4f, 0xfee2, 0x03fc, 0xfe7f, 0xfee2, 0x0496, 0xfea8, 0xfee2, 
-	0x0496, 0xfea8, 0xfee2, 0x0562, 0xfef8, 0xfee2, 0x0562, 0xfef8, 0xfee2, 0x0474, 0xff30, 0xfee2, 0x0474, 0xff30, 0xfee2, 0x0584, 
-	0xff94, 0xfee2, 0x0584, 0xff94, 0xfee2, 0x0463, 0xffd2, 0xfee2, 0x0463, 0xffd2, 0xfee2, 0x0595, 0x0000, 0xfee2, 0x0595, 0x0181, 
-	0xfee2, 0x0545, 0x01b0, 0xfee2, 0x0545, 0x01b1, 0xfee2, 0x03fc, 0x0181, 0xfee2, 0x0496, 0x0158, 0xfee2, 0x0496, 0x0158, 0xfee2, 
-	0x0562, 0x0108, 0xfee2, 0x0562, 0x0108, 0xfee2, 0x0474, 0x00d0, 0xfee2, 0x0474, 0x00d0, 0xfee2, 0x0584, 0x006c, 0xfee2, 0x0584, 
-	0x006c, 0xfee2, 0x0463, 0x002e, 0xfee2, 0x0463, 0x002e, 0xfee2, 0x0595, 0x001b, 0x0006, 0x0003, 0x01fc, 0x01ab, 0xfa9f, 0x0244, 
-	0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000c, 0x0006, 0x000f, 0x0000, 0x0012, 0x0003, 0x0009, 0x0012, 0x0000, 
-	0x000c, 0x0000, 0x0006, 0x03f9, 0x01d7, 0xfbb2, 0x029a, 0x01d7, 0xf98b, 0x029a, 0x01d7, 0xfbb2, 0x03f9, 0x017f, 0xf98b, 0x03f9, 
-	0x017f, 0xfbb2, 0x029a, 0x017f, 0xfbb2, 0x03f9, 0x01d7, 0xf98b, 0x0000, 0x017f, 0xf98b, 0x0000, 0x01d7, 0xf98b, 0x001b, 0x0008, 
-	0x0003, 0x01f3, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x0015, 0x0015, 
-	0x0006, 0x0003, 0x0000, 0x000c, 0x0003, 0x0009, 0x0015, 0x0003, 0x000f, 0x0018, 0x0012, 0x0015, 0x0012, 0x0006, 0x014d, 0x017f, 
-	0xfbff, 0x029a, 0x01d7, 0xfbff, 0x014d, 0x01d7, 0xfbff, 0x029a, 0x017f, 0xfbb2, 0x029a, 0x017f, 0xfbff, 0x029a, 0x01d7, 0xf98b, 
-	0x014d, 0x01d7, 0xfbb2, 0x029a, 0x01d7, 0xfbb2, 0x014d, 0x01d7, 0xf98b, 0x0018, 0x0006, 0x0003, 0x00a6, 0x01ab, 0xfac5, 0x0166, 
-	0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0000, 0x000f, 0x0006, 0x0003, 0x0000, 0x000c, 0x0003, 0x0009, 0x0012, 0x000c, 
-	0x000f, 0x0015, 0x0006, 0x014d, 0x01d7, 0xfbb2, 0x0000, 0x01d7, 0xfbff, 0x014d, 0x01d7, 0xfbff, 0x014d, 0x01d7, 0xf98b, 0x0000, 
-	0x01d7, 0xfbb2, 0x0000, 0x017f, 0xfbff, 0x0000, 0x01d7, 0xf98b, 0x014d, 0x017f, 0xfbff, 0x0018, 0x0006, 0x0003, 0xff5a, 0x01ab, 
-	0xfac5, 0x0166, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x0006, 0x000f, 0x0000, 0x0000, 0x0009, 0x0003, 0x0009, 
-	0x0012, 0x000c, 0x0006, 0x0015, 0x000f, 0x0000, 0x01d7, 0xfbff, 0xfeb3, 0x01d7, 0xfbb2, 0xfeb3, 0x01d7, 0xfbff, 0x0000, 0x01d7, 
-	0xfbb2, 0xfeb3, 0x01d7, 0xf98b, 0x0000, 0x017f, 0xfbff, 0x0000, 0x01d7, 0xf98b, 0xfeb3, 0x017f, 0xfbff, 0x001b, 0x0008, 0x0003, 
-	0xfe0d, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x000c, 0x000f, 0x0012, 0x0015, 0x0006, 0x0015, 
-	0x0000, 0x0000, 0x000c, 0x0003, 0x0000, 0x0015, 0x0009, 0x000f, 0x0018, 0x0012, 0x0006, 0x000f, 0x0015, 0xfd66, 0x01d7, 0xfbff, 
-	0xfeb3, 0x017f, 0xfbff, 0xfeb3, 0x01d7, 0xfbff, 0xfd66, 0x017f, 0xfbb2, 0xfd66, 0x017f, 0xfbff, 0xfeb3, 0x01d7, 0xfbb2, 0xfd66, 
-	0x01d7, 0xf98b, 0xfd66, 0x01d7, 0xfbb2, 0xfeb3, 0x01d7, 0xf98b, 0x0015, 0x0006, 0x0003, 0xfcb7, 0x01ab, 0xfa9f, 0x014a, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0003, 0x0003, 0x0012, 0x0009, 0x0006, 
-	0x0003, 0x000c, 0xfd66, 0x01d7, 0xf98b, 0xfc07, 0x01d7, 0xfbb2, 0xfd66, 0x01d7, 0xfbb2, 0xfc07, 0x017f, 0xf98b, 0xfc07, 0x017f, 
-	0xfbb2, 0xfd66, 0x017f, 0xfbb2, 0xfc07, 0x01d7, 0xf98b, 0x0018, 0x000a, 0x0003, 0x024b, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0000, 
-	0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 
-	0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015, 0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0x027b, 0x01d7, 0xfbf1, 
-	0x027b, 0x01d7, 0xfb92, 0x027b, 0x01e7, 0xfb92, 0x021c, 0x01d7, 0xfbf1, 0x027b, 0x01e7, 0xfbf1, 0x021c, 0x01e7, 0xfbf1, 0x021c, 
-	0x01e7, 0xfb92, 0x021c, 0x01d7, 0xfb92, 0x0018, 0x000a, 0x0003, 0x00c3, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0000, 0x0003, 0x0006, 
-	0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 0x0009, 0x000f, 
-	0x000c, 0x0006, 0x0006, 0x0015, 0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0x00f3, 0x01d7, 0xfbf1, 0x00f3, 0x01d7, 
-	0xfb92, 0x00f3, 0x01e7, 0xfb92, 0x0093, 0x01d7, 0xfbf1, 0x00f3, 0x01e7, 0xfbf1, 0x0093, 0x01e7, 0xfbf1, 0x0093, 0x01e7, 0xfb92, 
-	0x0093, 0x01d7, 0xfb92, 0x0018, 0x000a, 0x0003, 0xff3c, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 
-	0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 0x0009, 0x000f, 0x000c, 0x0006, 
-	0x0006, 0x0015, 0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0xff6b, 0x01d7, 0xfbf1, 0xff6b, 0x01d7, 0xfb92, 0xff6b, 
-	0x01e7, 0xfb92, 0xff0c, 0x01d7, 0xfbf1, 0xff6b, 0x01e7, 0xfbf1, 0xff0c, 0x01e7, 0xfbf1, 0xff0c, 0x01e7, 0xfb92, 0xff0c, 0x01d7, 
-	0xfb92, 0x0018, 0x000a, 0x0003, 0xfdb3, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000f, 
-	0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015, 
-	0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0xfde2, 0x01d7, 0xfbf1, 0xfde2, 0x01d7, 0xfb92, 0xfde2, 0x01e7, 0xfb92, 
-	0xfd83, 0x01d7, 0xfbf1, 0xfde2, 0x01e7, 0xfbf1, 0xfd83, 0x01e7, 0xfbf1, 0xfd83, 0x01e7, 0xfb92, 0xfd83, 0x01d7, 0xfb92, 0x0018, 
-	0x0008, 0x0002, 0xfeae, 0xfefa, 0x021f, 0x0033, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 
-	0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfe7f, 0xfefa, 0x020c, 0xfe9a, 0xfefa, 0x01f1, 0xfe7f, 0xfefa, 0x0233, 
-	0xfe9a, 0xfefa, 0x024e, 0xfec1, 0xfefa, 0x024e, 0xfedc, 0xfefa, 0x0233, 0xfedc, 0xfefa, 0x020c, 0xfec1, 0xfefa, 0x01f1, 0x0018, 
-	0x0008, 0x0002, 0xfe32, 0xfefa, 0x01a3, 0x0033, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 
-	0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfe03, 0xfefa, 0x0190, 0xfe1e, 0xfefa, 0x0175, 0xfe03, 0xfefa, 0x01b7, 
-	0xfe1e, 0xfefa, 0x01d2, 0xfe45, 0xfefa, 0x01d2, 0xfe60, 0xfefa, 0x01b7, 0xfe60, 0xfefa, 0x0190, 0xfe45, 0xfefa, 0x0175, 0x0018, 
-	0x0008, 0x0002, 0xfe32, 0xfefa, 0x029c, 0x0033, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 
-	0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfe03, 0xfefa, 0x0289, 0xfe1e, 0xfefa, 0x026d, 0xfe03, 0xfefa, 0x02af, 
-	0xfe1e, 0xfefa, 0x02cb, 0xfe45, 0xfefa, 0x02cb, 0xfe60, 0xfefa, 0x02af, 0xfe60, 0xfefa, 0x0289, 0xfe45, 0xfefa, 0x026d, 0x0018, 
-	0x0008, 0x0002, 0xfdb5, 0xfefa, 0x021f, 0x0033, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 
-	0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfd86, 0xfefa, 0x020c, 0xfda2, 0xfefa, 0x01f1, 0xfd86, 0xfefa, 0x0233, 
-	0xfda2, 0xfefa, 0x024e, 0xfdc8, 0xfefa, 0x024e, 0xfde4, 0xfefa, 0x0233, 0xfde4, 0xfefa, 0x020c, 0xfdc8, 0xfefa, 0x01f1, 0x0024, 
-	0x000c, 0x0002, 0x01cf, 0xfefa, 0x021f, 0x00c5, 0x0000, 0x0021, 0x000c, 0x000f, 0x001b, 0x0015, 0x0000, 0x0003, 0x0018, 0x0009, 
-	0x0021, 0x0012, 0x001e, 0x001b, 0x001e, 0x0018, 0x0006, 0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0x0289, 
-	0xfefa, 0x025e, 0x0289, 0xfefa, 0x01e2, 0x020d, 0xfefa, 0x0165, 0x0191, 0xfefa, 0x0165, 0x0115, 0xfefa, 0x01e2, 0x0115, 0xfefa, 
-	0x025e, 0x020d, 0xfefa, 0x02da, 0x020d, 0xfefa, 0x025e, 0x020d, 0xfefa, 0x01e2, 0x0191, 0xfefa, 0x025e, 0x0191, 0xfefa, 0x02da, 
-	0x0191, 0xfefa, 0x01e2, 0x0018, 0x0008, 0x0002, 0xffe3, 0xfefa, 0x021f, 0x0070, 0x0000, 0x0009, 0x0003, 0x0006, 0x0000, 0x0015, 
-	0x000f, 0x0012, 0x000c, 0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0x0004, 0xfefa, 0x022f, 0x0004, 0xfefa, 
-	0x0210, 0x0052, 0xfefa, 0x022f, 0x0052, 0xfefa, 0x0210, 0xffc2, 0xfefa, 0x0210, 0xffc2, 0xfefa, 0x022f, 0xff74, 0xfefa, 0x0210, 
-	0xff74, 0xfefa, 0x022f, 0x0078, 0x0034, 0x0002, 0x00a7, 0xff64, 0x00e0, 0x0085, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 
-	0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 
-	0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 
-	0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 
-	0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 
-	0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 
-	0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 
-	0x0000, 0x0000, 0x0003, 0x0057, 0xfef9, 0x00e0, 0x00a7, 0xfef9, 0x0130, 0x00a7, 0xfef9, 0x0090, 0x00f7, 0xfef9, 0x00e0, 0x0057, 
-	0xff19, 0x00e0, 0x00a7, 0xff19, 0x0130, 0x00a7, 0xff19, 0x0090, 0x00f7, 0xff19, 0x00e0, 0x00c8, 0xff21, 0x00ee, 0x00c8, 0xff21, 
-	0x00d3, 0x0086, 0xff21, 0x00ee, 0x0099, 0xff21, 0x0102, 0x0099, 0xff21, 0x00bf, 0x0086, 0xff21, 0x00d3, 0x00b5, 0xff21, 0x00bf, 
-	0x00b5, 0xff21, 0x0102, 0x00b1, 0xff29, 0x00f9, 0x00c0, 0xff29, 0x00eb, 0x008e, 0xff29, 0x00d6, 0x008e, 0xff29, 0x00eb, 0x009d, 
-	0xff29, 0x00c8, 0x00c0, 0xff29, 0x00d6, 0x00b1, 0xff29, 0x00c8, 0x009d, 0xff29, 0x00f9, 0x00b2, 0xff2e, 0x00d5, 0x009c, 0xff2e, 
-	0x00d5, 0x00b2, 0xffcf, 0x00d5, 0x009c, 0xffcf, 0x00ec, 0x00b2, 0xffcf, 0x00ec, 0x009c, 0xff2e, 0x00ec, 0x00b2, 0xff2e, 0x00ec, 
-	0x009c, 0xffcf, 0x00d5, 0x00ad, 0xff19, 0x011f, 0x00ad, 0xff19, 0x0112, 0x00a0, 0xff1f, 0x0112, 0x00a0, 0xff1f, 0x011f, 0x00ad, 
-	0xff1f, 0x011f, 0x00ad, 0xff1f, 0x0112, 0x00a0, 0xff19, 0x011f, 0x00a0, 0xff19, 0x0112, 0x0078, 0x0034, 0x0002, 0xff59, 0xff64, 
-	0x00e0, 0x0085, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 
-	0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 
-	0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 
-	0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 
-	0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 
-	0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 
-	0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xffa9, 0xfef9, 0x00e0, 0xff59, 0xfef9, 
-	0x0130, 0xff59, 0xfef9, 0x0090, 0xff09, 0xfef9, 0x00e0, 0xffa9, 0xff19, 0x00e0, 0xff59, 0xff19, 0x0130, 0xff59, 0xff19, 0x0090, 
-	0xff09, 0xff19, 0x00e0, 0xff38, 0xff21, 0x00ee, 0xff38, 0xff21, 0x00d3, 0xff7a, 0xff21, 0x00ee, 0xff67, 0xff21, 0x0102, 0xff67, 
-	0xff21, 0x00bf, 0xff7a, 0xff21, 0x00d3, 0xff4b, 0xff21, 0x00bf, 0xff4b, 0xff21, 0x0102, 0xff4f, 0xff29, 0x00f9, 0xff40, 0xff29, 
-	0x00eb, 0xff72, 0xff29, 0x00d6, 0xff72, 0xff29, 0x00eb, 0xff63, 0xff29, 0x00c8, 0xff40, 0xff29, 0x00d6, 0xff4f, 0xff29, 0x00c8, 
-	0xff63, 0xff29, 0x00f9, 0xff4e, 0xff2e, 0x00d5, 0xff64, 0xff2e, 0x00d5, 0xff4e, 0xffcf, 0x00d5, 0xff64, 0xffcf, 0x00ec, 0xff4e, 
-	0xffcf, 0x00ec, 0xff64, 0xff2e, 0x00ec, 0xff4e, 0xff2e, 0x00ec, 0xff64, 0xffcf, 0x00d5, 0xff53, 0xff19, 0x011f, 0xff53, 0xff19, 
-	0x0112, 0xff60, 0xff1f, 0x0112, 0xff60, 0xff1f, 0x011f, 0xff53, 0xff1f, 0x011f, 0xff53, 0xff1f, 0x0112, 0xff60, 0xff19, 0x011f, 
-	0xff60, 0xff19, 0x0112, 0x0078, 0x0034, 0x0002, 0xfd48, 0xff64, 0xfffa, 0x0085, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 
-	0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 
-	0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 
-	0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 
-	0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 
-	0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 
-	0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 
-	0x0000, 0x0000, 0x0003, 0xfd8d, 0xfef9, 0x0021, 0xfd20, 0xfef9, 0x003e, 0xfd70, 0xfef9, 0xffb5, 0xfd03, 0xfef9, 0xffd2, 0xfd8d, 
-	0xff19, 0x0021, 0xfd20, 0xff19, 0x003e, 0xfd70, 0xff19, 0xffb5, 0xfd03, 0xff19, 0xffd2, 0xfd25, 0xff21, 0xfff5, 0xfd32, 0xff21, 
-	0xffde, 0xfd5e, 0xff21, 0x0015, 0xfd44, 0xff21, 0x001d, 0xfd65, 0xff21, 0xffe4, 0xfd6c, 0xff21, 0xffff, 0xfd4d, 0xff21, 0xffd7, 
-	0xfd2c, 0xff21, 0x000f, 0xfd33, 0xff29, 0x0009, 0xfd2e, 0xff29, 0xfff7, 0xfd63, 0xff29, 0xfffe, 0xfd59, 0xff29, 0x000e, 0xfd5e, 
-	0xff29, 0xffea, 0xfd38, 0xff29, 0xffe5, 0xfd4c, 0xff29, 0xffdf, 0xfd45, 0xff29, 0x0014, 0xfd44, 0xff2e, 0xffeb, 0xfd58, 0xff2e, 
-	0xfff6, 0xfd44, 0xffcf, 0xffeb, 0xfd4c, 0xffcf, 0x0008, 0xfd39, 0xffcf, 0xfffe, 0xfd4c, 0xff2e, 0x0008, 0xfd39, 0xff2e, 0xfffe, 
-	0xfd58, 0xffcf, 0xfff6, 0xfd24, 0xff19, 0x002c, 0xfd2a, 0xff19, 0x0021, 0xfd35, 0xff1f, 0x0027, 0xfd2f, 0xff1f, 0x0032, 0xfd24, 
-	0xff1f, 0x002c, 0xfd2a, 0xff1f, 0x0021, 0xfd2f, 0xff19, 0x0032, 0xfd35, 0xff19, 0x0027, 0x0078, 0x0034, 0x0002, 0xfe6a, 0xff64, 
-	0x00a0, 0x0085, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 
-	0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 
-	0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 
-	0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 
-	0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 
-	0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 
-	0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfe25, 0xfef9, 0x0078, 0xfe42, 0xfef9, 
-	0x00e6, 0xfe92, 0xfef9, 0x005b, 0xfeaf, 0xfef9, 0x00c8, 0xfe25, 0xff19, 0x0078, 0xfe42, 0xff19, 0x00e6, 0xfe92, 0xff19, 0x005b, 
-	0xfeaf, 0xff19, 0x00c8, 0xfe80, 0xff21, 0x00bd, 0xfe8e, 0xff21, 0x00a5, 0xfe47, 0xff21, 0x009c, 0xfe4e, 0xff21, 0x00b6, 0xfe6f, 
-	0xff21, 0x007d, 0xfe54, 0xff21, 0x0084, 0xfe86, 0xff21, 0x008b, 0xfe65, 0xff21, 0x00c4, 0xfe67, 0xff29, 0x00bb, 0xfe7a, 0xff29, 
-	0x00b6, 0xfe5a, 0xff29, 0x008b, 0xfe4f, 0xff29, 0x009d, 0xfe6e, 0xff29, 0x0086, 0xfe85, 0xff29, 0x00a4, 0xfe7f, 0xff29, 0x0090, 
-	0xfe55, 0xff29, 0x00b1, 0xfe79, 0xff2e, 0x009c, 0xfe66, 0xff2e, 0x0091, 0xfe79, 0xffcf, 0x009c, 0xfe5b, 0xffcf, 0x00a4, 0xfe6e, 
-	0xffcf, 0x00b0, 0xfe5b, 0xff2e, 0x00a4, 0xfe6e, 0xff2e, 0x00b0, 0xfe66, 0xffcf, 0x0091, 0xfe51, 0xff19, 0x00d9, 0xfe57, 0xff19, 
-	0x00ce, 0xfe4c, 0xff1f, 0x00c8, 0xfe45, 0xff1f, 0x00d3, 0xfe51, 0xff1f, 0x00d9, 0xfe57, 0xff1f, 0x00ce, 0xfe45, 0xff19, 0x00d3, 
-	0xfe4c, 0xff19, 0x00c8, 0x0078, 0x0034, 0x0002, 0x0196, 0xff64, 0x00a0, 0x0085, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 
-	0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 
-	0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 
-	0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 
-	0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 
-	0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 
-	0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 
-	0x0000, 0x0000, 0x0003, 0x01db, 0xfef9, 0x0078, 0x01be, 0xfef9, 0x00e6, 0x016e, 0xfef9, 0x005b, 0x0151, 0xfef9, 0x00c8, 0x01db, 
-	0xff19, 0x0078, 0x01be, 0xff19, 0x00e6, 0x016e, 0xff19, 0x005b, 0x0151, 0xff19, 0x00c8, 0x0180, 0xff21, 0x00bd, 0x0172, 0xff21, 
-	0x00a5, 0x01b9, 0xff21, 0x009c, 0x01b2, 0xff21, 0x00b6, 0x0191, 0xff21, 0x007d, 0x01ac, 0xff21, 0x0084, 0x017a, 0xff21, 0x008b, 
-	0x019b, 0xff21, 0x00c4, 0x0199, 0xff29, 0x00bb, 0x0186, 0xff29, 0x00b6, 0x01a6, 0xff29, 0x008b, 0x01b1, 0xff29, 0x009d, 0x0192, 
-	0xff29, 0x0086, 0x017b, 0xff29, 0x00a4, 0x0181, 0xff29, 0x0090, 0x01ab, 0xff29, 0x00b1, 0x0187, 0xff2e, 0x009c, 0x019a, 0xff2e, 
-	0x0091, 0x0187, 0xffcf, 0x009c, 0x01a5, 0xffcf, 0x00a4, 0x0192, 0xffcf, 0x00b0, 0x01a5, 0xff2e, 0x00a4, 0x0192, 0xff2e, 0x00b0, 
-	0x019a, 0xffcf, 0x0091, 0x01af, 0xff19, 0x00d9, 0x01a9, 0xff19, 0x00ce, 0x01b4, 0xff1f, 0x00c8, 0x01bb, 0xff1f, 0x00d3, 0x01af, 
-	0xff1f, 0x00d9, 0x01a9, 0xff1f, 0x00ce, 0x01bb, 0xff19, 0x00d3, 0x01b4, 0xff19, 0x00c8, 0x0078, 0x0034, 0x0002, 0x02b8, 0xff64, 
-	0xfffa, 0x0085, 0x0000, 0x0072, 0x0066, 0x006c, 0x0060, 0x006f, 0x0063, 0x0069, 0x0075, 0x006f, 0x0075, 0x0075, 0x0072, 0x0072, 
-	0x006c, 0x006c, 0x006f, 0x0063, 0x0069, 0x0069, 0x0066, 0x0066, 0x0060, 0x0060, 0x0063, 0x0051, 0x005a, 0x005d, 0x005a, 0x004b, 
-	0x005d, 0x004e, 0x005d, 0x005a, 0x0048, 0x0057, 0x004e, 0x0054, 0x0057, 0x0036, 0x0045, 0x0045, 0x0039, 0x003c, 0x0042, 0x0051, 
-	0x0054, 0x0057, 0x004b, 0x0048, 0x0054, 0x004e, 0x0051, 0x0048, 0x004b, 0x003f, 0x0042, 0x0033, 0x0045, 0x0039, 0x003f, 0x0042, 
-	0x0030, 0x0033, 0x003f, 0x003c, 0x0036, 0x0039, 0x003c, 0x0030, 0x0036, 0x0030, 0x0033, 0x002d, 0x0018, 0x0021, 0x002d, 0x002a, 
-	0x0024, 0x0027, 0x002a, 0x001b, 0x0027, 0x0024, 0x001e, 0x001e, 0x0021, 0x0018, 0x001b, 0x0009, 0x0015, 0x0015, 0x0000, 0x0003, 
-	0x0012, 0x000f, 0x0006, 0x0012, 0x000c, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0x02db, 0xff21, 0xfff5, 0x02ce, 0xff21, 
-	0xffde, 0x02a2, 0xff21, 0x0015, 0x02bc, 0xff21, 0x001d, 0x029b, 0xff21, 0xffe4, 0x0294, 0xff21, 0xffff, 0x02b3, 0xff21, 0xffd7, 
-	0x02d4, 0xff21, 0x000f, 0x02cd, 0xff29, 0x0009, 0x02d2, 0xff29, 0xfff7, 0x029d, 0xff29, 0xfffe, 0x02a7, 0xff29, 0x000e, 0x02a2, 
-	0xff29, 0xffea, 0x02c8, 0xff29, 0xffe5, 0x02b4, 0xff29, 0xffdf, 0x02bb, 0xff29, 0x0014, 0x02bc, 0xff2e, 0xffeb, 0x02a8, 0xff2e, 
-	0xfff6, 0x02bc, 0xffcf, 0xffeb, 0x02b4, 0xffcf, 0x0008, 0x02c7, 0xffcf, 0xfffe, 0x02b4, 0xff2e, 0x0008, 0x02c7, 0xff2e, 0xfffe, 
-	0x02a8, 0xffcf, 0xfff6, 0x02dc, 0xff19, 0x002c, 0x02d6, 0xff19, 0x0021, 0x02cb, 0xff1f, 0x0027, 0x02d1, 0xff1f, 0x0032, 0x02dc, 
-	0xff1f, 0x002c, 0x02d6, 0xff1f, 0x0021, 0x02d1, 0xff19, 0x0032, 0x02cb, 0xff19, 0x0027, 0x0273, 0xfef9, 0x0021, 0x02e0, 0xfef9, 
-	0x003e, 0x0290, 0xfef9, 0xffb5, 0x02fd, 0xfef9, 0xffd2, 0x0273, 0xff19, 0x0021, 0x02e0, 0xff19, 0x003e, 0x0290, 0xff19, 0xffb5, 
-	0x02fd, 0xff19, 0xffd2, 0x0057, 0x001c, 0x0002, 0xfdd3, 0xff04, 0x0065, 0x00b0, 0x0000, 0x0054, 0x004e, 0x0051, 0x0054, 0x0033, 
-	0x0051, 0x004e, 0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x003f, 0x003f, 0x0042, 0x000f, 0x003c, 0x003c, 
-	0x0039, 0x0039, 0x0036, 0x0036, 0x0030, 0x0030, 0x0033, 0x002d, 0x0024, 0x002a, 0x002d, 0x0003, 0x002a, 0x0024, 0x0027, 0x0021, 
-	0x001e, 0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0012, 0x0012, 0x0015, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 
-	0x0000, 0x0000, 0x0003, 0xfd58, 0xff08, 0x002f, 0xfd64, 0xff08, 0x0015, 0xfd60, 0xff08, 0x004b, 0xfd78, 0xff08, 0x006a, 0xfd9b, 
-	0xff08, 0x0088, 0xfdb0, 0xff08, 0x0094, 0xfd3c, 0xff00, 0x0026, 0xfd44, 0xff00, 0xfffe, 0xfd45, 0xff00, 0x004b, 0xfd60, 0xff00, 
-	0x0074, 0xfd8b, 0xff00, 0x0099, 0xfda4, 0xff00, 0x00a8, 0xfdbf, 0xff08, 0x0054, 0xfdce, 0xff08, 0x005f, 0xfd7e, 0xff08, 0x0027, 
-	0xfd99, 0xff08, 0x003a, 0xfe34, 0xff08, 0x00ad, 0xfe44, 0xff08, 0x0096, 0xfe17, 0xff08, 0x00b4, 0xfdf0, 0xff08, 0x00b0, 0xfdc5, 
-	0xff08, 0x00a0, 0xfe49, 0xff00, 0x00c1, 0xfe69, 0xff00, 0x00a6, 0xfe24, 0xff00, 0x00cc, 0xfdf4, 0xff00, 0x00c9, 0xfdbe, 0xff00, 
-	0x00b7, 0xfde0, 0xff08, 0x0067, 0xfe27, 0xff08, 0x0088, 0xfe09, 0xff08, 0x007b, 0x0057, 0x001c, 0x0002, 0x0000, 0xff04, 0x0118, 
-	0x00af, 0x0000, 0x0054, 0x004e, 0x0051, 0x0054, 0x0033, 0x0051, 0x004e, 0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 
-	0x0045, 0x003f, 0x003f, 0x0042, 0x000f, 0x003c, 0x003c, 0x0039, 0x0039, 0x0036, 0x0036, 0x0030, 0x0030, 0x0033, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0003, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0012, 0x0012, 0x0015, 
-	0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xff82, 0xff08, 0x0107, 0xff7f, 0xff08, 0x00ea, 
-	0xff97, 0xff08, 0x011b, 0xffbb, 0xff08, 0x012b, 0xffe8, 0xff08, 0x0133, 0x0000, 0xff08, 0x0133, 0xff65, 0xff00, 0x010d, 0xff58, 
-	0xff00, 0x00e6, 0xff80, 0xff00, 0x0129, 0xffab, 0xff00, 0x013e, 0xffe3, 0xff00, 0x014a, 0x0000, 0xff00, 0x014a, 0xffee, 0xff08, 
-	0x00f4, 0x0000, 0xff08, 0x00f6, 0xff9f, 0xff08, 0x00ed, 0xffc0, 0xff08, 0x00f0, 0x007e, 0xff08, 0x0107, 0x0081, 0xff08, 0x00ea, 
-	0x0069, 0xff08, 0x011b, 0x0045, 0xff08, 0x012b, 0x0018, 0xff08, 0x0133, 0x009b, 0xff00, 0x010d, 0x00a8, 0xff00, 0x00e6, 0x0080, 
-	0xff00, 0x0129, 0x0055, 0xff00, 0x013e, 0x001d, 0xff00, 0x014a, 0x0012, 0xff08, 0x00f4, 0x0061, 0xff08, 0x00ed, 0x0040, 0xff08, 
-	0x00f0, 0x0057, 0x001c, 0x0002, 0x022d, 0xff04, 0x0065, 0x00b0, 0x0000, 0x0054, 0x004e, 0x0051, 0x0054, 0x0033, 0x0051, 0x004e, 
-	0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x003f, 0x003f, 0x0042, 0x000f, 0x003c, 0x003c, 0x0039, 0x0039, 
-	0x0036, 0x0036, 0x0030, 0x0030, 0x0033, 0x002d, 0x0024, 0x002a, 0x002d, 0x0003, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x001e, 
-	0x001b, 0x001b, 0x0018, 0x0018, 0x0012, 0x0012, 0x0015, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 
-	0x0003, 0x01cc, 0xff08, 0x00ad, 0x01bc, 0xff08, 0x0096, 0x01e9, 0xff08, 0x00b4, 0x0210, 0xff08, 0x00b0, 0x023b, 0xff08, 0x00a0, 
-	0x0250, 0xff08, 0x0094, 0x01b7, 0xff00, 0x00c1, 0x0197, 0xff00, 0x00a6, 0x01dc, 0xff00, 0x00cc, 0x020c, 0xff00, 0x00c9, 0x0242, 
-	0xff00, 0x00b7, 0x025c, 0xff00, 0x00a8, 0x0220, 0xff08, 0x0067, 0x0232, 0xff08, 0x005f, 0x01d9, 0xff08, 0x0088, 0x01f7, 0xff08, 
-	0x007b, 0x02a8, 0xff08, 0x002f, 0x029c, 0xff08, 0x0015, 0x02a0, 0xff08, 0x004b, 0x0288, 0xff08, 0x006a, 0x0265, 0xff08, 0x0088, 
-	0x02c4, 0xff00, 0x0026, 0x02bc, 0xff00, 0xfffe, 0x02bb, 0xff00, 0x004b, 0x02a0, 0xff00, 0x0074, 0x0275, 0xff00, 0x0099, 0x0241, 
-	0xff08, 0x0054, 0x0282, 0xff08, 0x0027, 0x0267, 0xff08, 0x003a, 0x000c, 0x0004, 0x0002, 0x05b4, 0x003a, 0x08da, 0x0409, 0x0000, 
-	0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0x05b4, 0x0000, 0x04d3, 0x05b4, 0x0075, 0x04d3, 0x05b4, 0x0075, 
-	0x0ce2, 0x05b4, 0x0000, 0x0ce2, 0x000c, 0x0004, 0x0002, 0xfa4c, 0x003a, 0x08da, 0x0409, 0x0000, 0x0006, 0x0003, 0x0000, 0x0009, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0xfa4c, 0x0000, 0x04d3, 0xfa4c, 0x0075, 0x04d3, 0xfa4c, 0x0075, 0x0ce2, 0xfa4c, 0x0000, 0x0ce2, 
-	0x002a, 0x000d, 0x0002, 0x0000, 0x0b6e, 0xfb91, 0x06d4, 0x0000, 0x0018, 0x0027, 0x0003, 0x0012, 0x0006, 0x0024, 0x0021, 0x0012, 
-	0x000f, 0x001e, 0x001b, 0x0015, 0x0018, 0x0015, 0x0015, 0x000f, 0x000f, 0x0012, 0x0003, 0x000c, 0x0009, 0x0000, 0x0006, 0x0000, 
-	0x0000, 0x0003, 0xfbbf, 0x0b96, 0xf98b, 0xfdcd, 0x0be8, 0xf98b, 0xf981, 0x0ad8, 0xf98b, 0xfbbf, 0x0b96, 0xfd8f, 0xfdcd, 0x0be8, 
-	0xfd94, 0x0233, 0x0be8, 0xf98b, 0x0000, 0x0c04, 0xf98b, 0x0441, 0x0b96, 0xf98b, 0x067f, 0x0ad8, 0xf98b, 0x0441, 0x0b96, 0xfd8f, 
-	0x0233, 0x0be8, 0xfd94, 0x0000, 0x0c04, 0xfd96, 0xf97f, 0x0ad9, 0xfd8b, 0x0681, 0x0ad9, 0xfd8b, 0x002a, 0x0013, 0x0002, 0x0000, 
-	0x0962, 0xff3d, 0x0735, 0x0000, 0x0000, 0x000f, 0x0009, 0x001e, 0x001b, 0x0006, 0x0018, 0x0027, 0x0015, 0x0024, 0x0024, 0x001e, 
-	0x0027, 0x0015, 0x0021, 0x0027, 0x0021, 0x0024, 0x001b, 0x0021, 0x001b, 0x001e, 0x0012, 0x0018, 0x0012, 0x0015, 0x0003, 0x000c, 
-	0x000f, 0x0009, 0x000c, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf97f, 0x0ad9, 0xfd8b, 0xf981, 0x06c1, 0x00ee, 
-	0xfdd9, 0x0832, 0x00ee, 0xfdcd, 0x0be8, 0xfd94, 0xfbd8, 0x07e1, 0x00ee, 0xfbbf, 0x0b96, 0xfd8f, 0x0681, 0x0ad9, 0xfd8b, 0x0441, 
-	0x0b96, 0xfd8f, 0x067f, 0x06c1, 0x00ee, 0x0000, 0x084d, 0x00ee, 0x0000, 0x0c04, 0xfd96, 0x0227, 0x0832, 0x00ee, 0x0233, 0x0be8, 
-	0xfd94, 0x0428, 0x07e1, 0x00ee, 0x002a, 0x000d, 0x0002, 0x0000, 0x06ed, 0x029b, 0x06d9, 0x0000, 0x0018, 0x0006, 0x001e, 0x0015, 
-	0x001e, 0x0027, 0x001b, 0x0024, 0x0018, 0x0021, 0x001b, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 0x0009, 0x0003, 0x0009, 0x000f, 
-	0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf981, 0x06c1, 0x00ee, 0xf981, 0x058e, 0x0449, 0xfddf, 0x0703, 0x0449, 0xfbe2, 
-	0x06b3, 0x0449, 0xfdd9, 0x0832, 0x00ee, 0xfbd8, 0x07e1, 0x00ee, 0x067f, 0x06c1, 0x00ee, 0x067f, 0x058e, 0x0449, 0x0000, 0x071e, 
-	0x0449, 0x0221, 0x0703, 0x0449, 0x041e, 0x06b3, 0x0449, 0x0000, 0x084d, 0x00ee, 0x0227, 0x0832, 0x00ee, 0x0428, 0x07e1, 0x00ee, 
-	0x002a, 0x000d, 0x0002, 0x0000, 0x0676, 0x05d3, 0x06bc, 0x0000, 0x0018, 0x0006, 0x0015, 0x0024, 0x0024, 0x0027, 0x001e, 0x0024, 
-	0x001e, 0x0021, 0x0018, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 0x0003, 0x000c, 0x000c, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xf981, 0x058e, 0x0449, 0xf981, 0x05cd, 0x075e, 0xfde0, 0x0743, 0x075e, 0xfddf, 0x0703, 0x0449, 0xfbe4, 0x06f3, 
-	0x075e, 0xfbe2, 0x06b3, 0x0449, 0x067f, 0x058e, 0x0449, 0x067f, 0x05cd, 0x075e, 0x0000, 0x075e, 0x075e, 0x0000, 0x071e, 0x0449, 
-	0x0220, 0x0743, 0x075e, 0x0221, 0x0703, 0x0449, 0x041c, 0x06f3, 0x075e, 0x041e, 0x06b3, 0x0449, 0x002a, 0x000d, 0x0002, 0x0000, 
-	0x06e5, 0x08c7, 0x06bc, 0x0000, 0x0018, 0x0006, 0x001e, 0x0015, 0x001e, 0x0027, 0x001b, 0x0024, 0x0018, 0x0021, 0x001b, 0x001e, 
-	0x0018, 0x001b, 0x0012, 0x0015, 0x0009, 0x0003, 0x0009, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf981, 0x05cd, 
-	0x075e, 0xf981, 0x066d, 0x0a31, 0xfde0, 0x07e2, 0x0a31, 0xfbe4, 0x0793, 0x0a31, 0xfde0, 0x0743, 0x075e, 0xfbe4, 0x06f3, 0x075e, 
-	0x067f, 0x05cd, 0x075e, 0x067f, 0x066d, 0x0a31, 0x0000, 0x07fd, 0x0a31, 0x0220, 0x07e2, 0x0a31, 0x041c, 0x0793, 0x0a31, 0x0000, 
-	0x075e, 0x075e, 0x0220, 0x0743, 0x075e, 0x041c, 0x06f3, 0x075e, 0x002a, 0x000d, 0x0002, 0x0000, 0x0693, 0x0c0c, 0x06e7, 0x0000, 
-	0x0018, 0x0006, 0x0015, 0x0024, 0x0024, 0x0027, 0x001e, 0x0024, 0x001e, 0x0021, 0x0018, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 
-	0x0003, 0x000c, 0x000c, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf981, 0x066d, 0x0a31, 0xf981, 0x0529, 0x0de8, 
-	0xfdde, 0x069d, 0x0de8, 0xfde0, 0x07e2, 0x0a31, 0xfbe0, 0x064d, 0x0de8, 0xfbe4, 0x0793, 0x0a31, 0x067f, 0x066d, 0x0a31, 0x067f, 
-	0x0529, 0x0de8, 0x0000, 0x06b8, 0x0de8, 0x0000, 0x07fd, 0x0a31, 0x0222, 0x069d, 0x0de8, 0x0220, 0x07e2, 0x0a31, 0x0420, 0x064d, 
-	0x0de8, 0x041c, 0x0793, 0x0a31, 0x0012, 0x0007, 0x0002, 0xfdb3, 0x00bf, 0xfba4, 0x00cf, 0x0000, 0x0000, 0x0006, 0x0003, 0x0006, 
-	0x0009, 0x000c, 0x000c, 0x000f, 0x0000, 0x000f, 0x0003, 0x000f, 0x0003, 0x0009, 0xfd81, 0x0000, 0xfb66, 0xfd81, 0x017f, 0xfbe2, 
-	0xfd81, 0x017f, 0xfb66, 0xfde4, 0x017f, 0xfbe2, 0xfde4, 0x0000, 0xfbe2, 0xfd81, 0x0000, 0xfbe2, 0x000c, 0x0004, 0x0002, 0xff3c, 
-	0x00bf, 0xfbe2, 0x00c6, 0x0000, 0x0003, 0x0006, 0x0006, 0x0009, 0x0000, 0x0009, 0x0000, 0x0003, 0xff0a, 0x017f, 0xfbe2, 0xff6d, 
-	0x017f, 0xfbe2, 0xff6d, 0x0000, 0xfbe2, 0xff0a, 0x0000, 0xfbe2, 0x000c, 0x0004, 0x0002, 0x00c3, 0x00bf, 0xfbe2, 0x00c6, 0x0000, 
-	0x0003, 0x0006, 0x0006, 0x0009, 0x0000, 0x0009, 0x0000, 0x0003, 0x0091, 0x017f, 0xfbe2, 0x00f5, 0x017f, 0xfbe2, 0x00f5, 0x0000, 
-	0xfbe2, 0x0091, 0x0000, 0xfbe2, 0x000c, 0x0004, 0x0002, 0x024b, 0x00bf, 0xfbe2, 0x00c6, 0x0000, 0x0003, 0x0006, 0x0006, 0x0009, 
-	0x0000, 0x0009, 0x0000, 0x0003, 0x021a, 0x017f, 0xfbe2, 0x027d, 0x017f, 0xfbe2, 0x027d, 0x0000, 0xfbe2, 0x021a, 0x0000, 0xfbe2, 
-	0x0018, 0x0006, 0x0003, 0xfc37, 0x00c4, 0xfb59, 0x00cb, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0009, 0x0012, 
-	0x0000, 0x0000, 0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0009, 0x000f, 0x0012, 0xfc0e, 0x0000, 0xfb7c, 0xfc0d, 0x0188, 0xfb34, 
-	0xfc0e, 0x0000, 0xfb34, 0xfc60, 0x0000, 0xfb7c, 0xfc60, 0x0188, 0xfb34, 0xfc60, 0x0188, 0xfb7d, 0xfc0d, 0x0188, 0xfb7d, 0xfc60, 
-	0x0000, 0xfb34, 0x0012, 0x0004, 0x0003, 0xfd64, 0x00c4, 0xfb73, 0x00c7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 
-	0x0000, 0x0009, 0x0003, 0x0009, 0x000f, 0x000c, 0xfd85, 0x0188, 0xfb7e, 0xfd42, 0x0000, 0xfb7e, 0xfd81, 0x0000, 0xfb7e, 0xfd42, 
-	0x0188, 0xfb7e, 0xfd42, 0x0000, 0xfb68, 0xfd42, 0x0188, 0xfb68, 0x0012, 0x0004, 0x0003, 0x029c, 0x00c4, 0xfb73, 0x00c7, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x0000, 0x0009, 0x0003, 0x0009, 0x000f, 0x000c, 0x027f, 0x0000, 0xfb7e, 0x02be, 
-	0x0188, 0xfb7e, 0x027b, 0x0188, 0xfb7e, 0x02be, 0x0000, 0xfb7e, 0x02be, 0x0188, 0xfb68, 0x02be, 0x0000, 0xfb68, 0x0018, 0x0006, 
-	0x0003, 0x03c9, 0x00c4, 0xfb59, 0x00cb, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0000, 
-	0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0006, 0x0015, 0x0009, 0x03f2, 0x0000, 0xfb7c, 0x03f3, 0x0188, 0xfb34, 0x03f3, 0x0188, 
-	0xfb7d, 0x03a0, 0x0000, 0xfb7c, 0x03a0, 0x0188, 0xfb34, 0x03a0, 0x0000, 0xfb34, 0x03f2, 0x0000, 0xfb34, 0x03a0, 0x0188, 0xfb7d, 
-	0x0018, 0x0010, 0x0002, 0xfa93, 0xfff9, 0x0026, 0x0103, 0x0000, 0x0003, 0x000c, 0x0009, 0x000f, 0x0006, 0x0012, 0x0000, 0x0015, 
-	0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfa75, 0xfef9, 0x0043, 0xfa75, 0xfef9, 0x000a, 0xfab0, 0xfef9, 
-	0x0043, 0xfab0, 0xfef9, 0x000a, 0xfab0, 0x00f8, 0x000a, 0xfab0, 0x00f8, 0x0043, 0xfa75, 0x00f8, 0x0043, 0xfa75, 0x00f8, 0x000a, 
-	0x0018, 0x0010, 0x0002, 0xfa93, 0xfff9, 0xfe71, 0x0103, 0x0000, 0x0003, 0x000c, 0x0009, 0x000f, 0x0006, 0x0012, 0x0000, 0x0015, 
-	0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfa75, 0xfef9, 0xfe8d, 0xfa75, 0xfef9, 0xfe54, 0xfab0, 0xfef9, 
-	0xfe8d, 0xfab0, 0xfef9, 0xfe54, 0xfab0, 0x00f8, 0xfe54, 0xfab0, 0x00f8, 0xfe8d, 0xfa75, 0x00f8, 0xfe8d, 0xfa75, 0x00f8, 0xfe54, 
-	0x0018, 0x0010, 0x0002, 0x056d, 0xfff9, 0xfe71, 0x0103, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x0012, 0x0006, 0x0015, 0x0000, 
-	0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0x058b, 0xfef9, 0xfe8d, 0x058b, 0xfef9, 0xfe54, 0x0550, 0xfef9, 
-	0xfe8d, 0x0550, 0xfef9, 0xfe54, 0x0550, 0x00f8, 0xfe54, 0x0550, 0x00f8, 0xfe8d, 0x058b, 0x00f8, 0xfe8d, 0x058b, 0x00f8, 0xfe54, 
-	0x0018, 0x0010, 0x0002, 0x056d, 0xfff9, 0x0026, 0x0103, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x0012, 0x0006, 0x0015, 0x0000, 
-	0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0x058b, 0xfef9, 0x0043, 0x058b, 0xfef9, 0x000a, 0x0550, 0xfef9, 
-	0x0043, 0x0550, 0xfef9, 0x000a, 0x0550, 0x00f8, 0x000a, 0x0550, 0x00f8, 0x0043, 0x058b, 0x00f8, 0x0043, 0x058b, 0x00f8, 0x000a, 
-	0x0018, 0x000c, 0x0002, 0x05d6, 0xff34, 0x073e, 0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 
-	0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 
-	0x0602, 0xfdf2, 0x0758, 0x05aa, 0xfdf2, 0x0758, 0x0602, 0xfdf2, 0x0725, 0x05aa, 0xfdf2, 0x0725, 0x05aa, 0x0075, 0x0725, 0x0602, 
-	0x0075, 0x0725, 0x05aa, 0x0075, 0x0758, 0x0602, 0x0075, 0x0758, 0x0018, 0x0008, 0x0003, 0x0340, 0xfe90, 0x0340, 0x00c5, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0009, 0x0006, 0x000c, 0x000f, 0x000c, 0x0006, 0x0012, 0x000f, 0x0003, 0x0000, 0x0006, 0x0009, 0x0009, 
-	0x000c, 0x0015, 0x000f, 0x0006, 0x0003, 0x0012, 0x0003, 0x0000, 0x0358, 0xfdf2, 0x03b4, 0x0358, 0xff2e, 0x03b4, 0x0329, 0xff2e, 
-	0x03b4, 0x0329, 0xfdf2, 0x03b4, 0x0329, 0xff2e, 0x02cd, 0x0358, 0xff2e, 0x02cd, 0x0358, 0xfdf2, 0x02cd, 0x0329, 0xfdf2, 0x02cd, 
-	0x0018, 0x000a, 0x0003, 0xfcc0, 0xfe90, 0x0340, 0x00c5, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x000f, 0x0003, 
-	0x000c, 0x0012, 0x0006, 0x000f, 0x0012, 0x000c, 0x0015, 0x0000, 0x0009, 0x0003, 0x0009, 0x0015, 0x000c, 0x000f, 0x0006, 0x0003, 
-	0x0012, 0x0000, 0x0006, 0x0012, 0x000f, 0x000c, 0xfca8, 0xfdf2, 0x03b4, 0xfcd7, 0xff2e, 0x03b4, 0xfca8, 0xff2e, 0x03b4, 0xfcd7, 
-	0xfdf2, 0x03b4, 0xfcd7, 0xff2e, 0x02cd, 0xfca8, 0xff2e, 0x02cd, 0xfca8, 0xfdf2, 0x02cd, 0xfcd7, 0xfdf2, 0x02cd, 0x0018, 0x000a, 
-	0x0003, 0xfbc8, 0xfe90, 0x02ff, 0x00a7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x000f, 0x0003, 0x000c, 0x0012, 
-	0x0006, 0x000f, 0x0012, 0x000c, 0x0015, 0x0000, 0x0009, 0x0003, 0x0009, 0x0015, 0x000c, 0x000f, 0x0006, 0x0003, 0x0012, 0x0000, 
-	0x0006, 0x0012, 0x000f, 0x000c, 0xfbb1, 0xfdf2, 0x0331, 0xfbdf, 0xff2e, 0x0331, 0xfbb1, 0xff2e, 0x0331, 0xfbdf, 0xfdf2, 0x0331, 
-	0xfbdf, 0xff2e, 0x02cd, 0xfbb1, 0xff2e, 0x02cd, 0xfbb1, 0xfdf2, 0x02cd, 0xfbdf, 0xfdf2, 0x02cd, 0x0018, 0x000a, 0x0003, 0x0438, 
-	0xfe90, 0x02ff, 0x00a7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0006, 0x000c, 0x000f, 0x000c, 0x0006, 0x0012, 0x000f, 0x0003, 
-	0x0012, 0x0015, 0x000c, 0x0000, 0x0006, 0x0009, 0x0009, 0x000c, 0x0015, 0x000f, 0x0006, 0x0003, 0x0012, 0x0003, 0x0000, 0x0012, 
-	0x000c, 0x000f, 0x044f, 0xfdf2, 0x0331, 0x044f, 0xff2e, 0x0331, 0x0421, 0xff2e, 0x0331, 0x0421, 0xfdf2, 0x0331, 0x0421, 0xff2e, 
-	0x02cd, 0x044f, 0xff2e, 0x02cd, 0x044f, 0xfdf2, 0x02cd, 0x0421, 0xfdf2, 0x02cd, 0x0018, 0x000c, 0x0002, 0x05d6, 0xff34, 0x0920, 
-	0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 
-	0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0x0602, 0xfdf2, 0x093a, 0x05aa, 0xfdf2, 0x093a, 
-	0x0602, 0xfdf2, 0x0906, 0x05aa, 0xfdf2, 0x0906, 0x05aa, 0x0075, 0x0906, 0x0602, 0x0075, 0x0906, 0x05aa, 0x0075, 0x093a, 0x0602, 
-	0x0075, 0x093a, 0x0018, 0x000c, 0x0002, 0x05d6, 0xff34, 0x0b01, 0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 
-	0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x0602, 0xfdf2, 0x0b1b, 0x05aa, 0xfdf2, 0x0b1b, 0x0602, 0xfdf2, 0x0ae8, 0x05aa, 0xfdf2, 0x0ae8, 0x05aa, 0x0075, 
-	0x0ae8, 0x0602, 0x0075, 0x0ae8, 0x05aa, 0x0075, 0x0b1b, 0x0602, 0x0075, 0x0b1b, 0x0018, 0x000c, 0x0002, 0x05d6, 0xff34, 0x0d06, 
-	0x0147, 0x0000, 0x0003, 0x000c, 0x0012, 0x0006, 0x000c, 0x0000, 0x0009, 0x0015, 0x000f, 0x0012, 0x0015, 0x000c, 0x0012, 0x0015, 
-	0x000c, 0x000f, 0x0003, 0x0006, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0x05aa, 0x0075, 0x0d2b, 0x0602, 0x0075, 0x0d2b, 
-	0x0602, 0x0075, 0x0ce2, 0x05aa, 0x0075, 0x0ce2, 0x05aa, 0xfdf2, 0x0d2b, 0x0602, 0xfdf2, 0x0d2b, 0x0602, 0xfdf2, 0x0ce2, 0x05aa, 
-	0xfdf2, 0x0ce2, 0x0018, 0x000c, 0x0002, 0xfa2a, 0xff34, 0x0d06, 0x0147, 0x0000, 0x0012, 0x0006, 0x000c, 0x0000, 0x0003, 0x000f, 
-	0x0009, 0x0015, 0x000f, 0x0012, 0x0015, 0x000c, 0x0012, 0x0015, 0x000c, 0x000f, 0x0003, 0x0006, 0x0009, 0x0000, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfa56, 0x0075, 0x0d2b, 0xf9fe, 0x0075, 0x0d2b, 0xf9fe, 0x0075, 0x0ce2, 0xfa56, 0x0075, 0x0ce2, 0xfa56, 0xfdf2, 
-	0x0d2b, 0xf9fe, 0xfdf2, 0x0d2b, 0xf9fe, 0xfdf2, 0x0ce2, 0xfa56, 0xfdf2, 0x0ce2, 0x0018, 0x000c, 0x0002, 0xfa2a, 0xff34, 0x0b01, 
-	0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 
-	0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xf9fe, 0xfdf2, 0x0b1b, 0xfa56, 0xfdf2, 0x0b1b, 
-	0xf9fe, 0xfdf2, 0x0ae8, 0xfa56, 0xfdf2, 0x0ae8, 0xfa56, 0x0075, 0x0ae8, 0xf9fe, 0x0075, 0x0ae8, 0xfa56, 0x0075, 0x0b1b, 0xf9fe, 
-	0x0075, 0x0b1b, 0x0018, 0x000c, 0x0002, 0xfa2a, 0xff34, 0x0920, 0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 
-	0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xf9fe, 0xfdf2, 0x093a, 0xfa56, 0xfdf2, 0x093a, 0xf9fe, 0xfdf2, 0x0906, 0xfa56, 0xfdf2, 0x0906, 0xfa56, 0x0075, 
-	0x0906, 0xf9fe, 0x0075, 0x0906, 0xfa56, 0x0075, 0x093a, 0xf9fe, 0x0075, 0x093a, 0x0018, 0x000c, 0x0002, 0xfa2a, 0xff34, 0x073e, 
-	0x0146, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 
-	0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xf9fe, 0xfdf2, 0x0758, 0xfa56, 0xfdf2, 0x0758, 
-	0xf9fe, 0xfdf2, 0x0725, 0xfa56, 0xfdf2, 0x0725, 0xfa56, 0x0075, 0x0725, 0xf9fe, 0x0075, 0x0725, 0xfa56, 0x0075, 0x0758, 0xf9fe, 
-	0x0075, 0x0758, 0x0018, 0x000c, 0x0002, 0x0620, 0xfe74, 0x04c3, 0x0088, 0x0000, 0x0000, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 
-	0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 0x000c, 0x0003, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x0604, 0xfdf2, 0x04a7, 0x0604, 0xfef6, 0x04a7, 0x063d, 0xfef6, 0x04a7, 0x063d, 0xfef6, 0x04e0, 0x0604, 0xfef6, 
-	0x04e0, 0x063d, 0xfdf2, 0x04a7, 0x063d, 0xfdf2, 0x04e0, 0x0604, 0xfdf2, 0x04e0, 0x0018, 0x000c, 0x0002, 0x0620, 0xfe74, 0x0622, 
-	0x0088, 0x0000, 0x0000, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 
-	0x000c, 0x0003, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0x0604, 0xfdf2, 0x0606, 0x0604, 0xfef6, 0x0606, 
-	0x063d, 0xfef6, 0x0606, 0x063d, 0xfef6, 0x063f, 0x0604, 0xfef6, 0x063f, 0x063d, 0xfdf2, 0x0606, 0x063d, 0xfdf2, 0x063f, 0x0604, 
-	0xfdf2, 0x063f, 0x0018, 0x000c, 0x0002, 0x0552, 0xfe76, 0x043d, 0x008a, 0x0000, 0x0000, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 
-	0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 0x000c, 0x0003, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x0536, 0xfdf2, 0x0421, 0x0536, 0xfef9, 0x0421, 0x056f, 0xfef9, 0x0421, 0x056f, 0xfef9, 0x045a, 0x0536, 0xfef9, 
-	0x045a, 0x056f, 0xfdf2, 0x0421, 0x056f, 0xfdf2, 0x045a, 0x0536, 0xfdf2, 0x045a, 0x0006, 0x0001, 0x0002, 0x067f, 0x018d, 0x0de8, 
-	0x039c, 0x0000, 0x0000, 0x0003, 0x067f, 0x0529, 0x0de8, 0x067f, 0xfdf2, 0x0de8, 0x0006, 0x0001, 0x0002, 0xf981, 0x018d, 0x0de8, 
-	0x039c, 0x0000, 0x0000, 0x0003, 0xf981, 0x0529, 0x0de8, 0xf981, 0xfdf2, 0x0de8, 0x0036, 0x0019, 0x0002, 0xfe79, 0x0067, 0xfbbb, 
-	0x009b, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021, 0x0015, 0x0033, 
-	0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012, 0x0024, 0x000f, 0x0021, 0x0003, 
-	0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009, 0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 
-	0x0000, 0x0006, 0x0000, 0x0003, 0xfe05, 0x00b9, 0xfbbb, 0xfe17, 0x00b9, 0xfbbb, 0xfe05, 0x0000, 0xfbbb, 0xfeec, 0x00b9, 0xfbbb, 
-	0xfeec, 0x00ce, 0xfbbb, 0xfe70, 0x00b9, 0xfbbb, 0xfed9, 0x00b9, 0xfbbb, 0xfe81, 0x00b9, 0xfbbb, 0xfeec, 0x0000, 0xfbbb, 0xfe05, 
-	0x00ce, 0xfbbb, 0xfe81, 0x00ce, 0xfbbb, 0xfe17, 0x00ce, 0xfbbb, 0xfe70, 0x0000, 0xfbbb, 0xfed9, 0x0000, 0xfbbb, 0xfe70, 0x00ce, 
-	0xfbbb, 0xfe17, 0x0000, 0xfbbb, 0xfed9, 0x00ce, 0xfbbb, 0xfe81, 0x0000, 0xfbbb, 0x0036, 0x0019, 0x0002, 0x0000, 0x0067, 0xfbbb, 
-	0x009a, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021, 0x0015, 0x0033, 
-	0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012, 0x0024, 0x000f, 0x0021, 0x0003, 
-	0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009, 0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 
-	0x0000, 0x0006, 0x0000, 0x0003, 0xff8d, 0x00b9, 0xfbbb, 0xffa0, 0x00b9, 0xfbbb, 0xff8d, 0x0000, 0xfbbb, 0x0073, 0x00b9, 0xfbbb, 
-	0x0073, 0x00ce, 0xfbbb, 0xfff8, 0x00b9, 0xfbbb, 0x0060, 0x00b9, 0xfbbb, 0x0008, 0x00b9, 0xfbbb, 0x0073, 0x0000, 0xfbbb, 0xff8d, 
-	0x00ce, 0xfbbb, 0x0008, 0x00ce, 0xfbbb, 0xffa0, 0x00ce, 0xfbbb, 0xfff8, 0x0000, 0xfbbb, 0x0060, 0x0000, 0xfbbb, 0xfff8, 0x00ce, 
-	0xfbbb, 0xffa0, 0x0000, 0xfbbb, 0x0060, 0x00ce, 0xfbbb, 0x0008, 0x0000, 0xfbbb, 0x0036, 0x0019, 0x0002, 0x0187, 0x0067, 0xfbbb, 
-	0x009b, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021, 0x0015, 0x0033, 
-	0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012, 0x0024, 0x000f, 0x0021, 0x0003, 
-	0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009, 0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 
-	0x0000, 0x0006, 0x0000, 0x0003, 0x0114, 0x00b9, 0xfbbb, 0x0127, 0x00b9, 0xfbbb, 0x0114, 0x0000, 0xfbbb, 0x01fb, 0x00b9, 0xfbbb, 
-	0x01fb, 0x00ce, 0xfbbb, 0x017f, 0x00b9, 0xfbbb, 0x01e9, 0x00b9, 0xfbbb, 0x0190, 0x00b9, 0xfbbb, 0x01fb, 0x0000, 0xfbbb, 0x0114, 
-	0x00ce, 0xfbbb, 0x0190, 0x00ce, 0xfbbb, 0x0127, 0x00ce, 0xfbbb, 0x017f, 0x0000, 0xfbbb, 0x01e9, 0x0000, 0xfbbb, 0x017f, 0x00ce, 
-	0xfbbb, 0x0127, 0x0000, 0xfbbb, 0x01e9, 0x00ce, 0xfbbb, 0x0190, 0x0000, 0xfbbb, 0x000c, 0x0002, 0x0003, 0x04e2, 0x0000, 0xfbe4, 
-	0x00d7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x055f, 0x0000, 0xfc93, 0x055f, 0x0000, 0xfb34, 0x0466, 0x0000, 
-	0xfb34, 0x0466, 0x0000, 0xfc93, 0x006c, 0x0012, 0x0002, 0x0000, 0xfef9, 0xff76, 0x08d6, 0x0000, 0x0066, 0x0069, 0x0060, 0x0063, 
-	0x005a, 0x005d, 0x0054, 0x0057, 0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045, 0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 
-	0x002a, 0x002d, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 
-	0xf89c, 0xfef9, 0xfcea, 0xf89c, 0xfef9, 0xfa9d, 0xf89c, 0xfef9, 0xfcea, 0xf8c0, 0xfef9, 0xfe5c, 0xf8c0, 0xfef9, 0xfe5c, 0xf92c, 
-	0xfef9, 0xffbf, 0xf92c, 0xfef9, 0xffbf, 0xf9db, 0xfef9, 0x0105, 0xf9db, 0xfef9, 0x0105, 0xfac6, 0xfef9, 0x0224, 0xfac6, 0xfef9, 
-	0x0224, 0xfbe5, 0xfef9, 0x030f, 0xfca9, 0xfef9, 0x0378, 0xfd2c, 0xfef9, 0x03be, 0xfd2c, 0xfef9, 0x03be, 0xfe8f, 0xfef9, 0x042a, 
-	0xfe8f, 0xfef9, 0x042a, 0x0000, 0xfef9, 0x044e, 0x0171, 0xfef9, 0x042a, 0x0000, 0xfef9, 0x044e, 0x02d4, 0xfef9, 0x03be, 0x0171, 
-	0xfef9, 0x042a, 0x0357, 0xfef9, 0x0378, 0x02d4, 0xfef9, 0x03be, 0x053a, 0xfef9, 0x0224, 0x041b, 0xfef9, 0x030f, 0x0625, 0xfef9, 
-	0x0105, 0x053a, 0xfef9, 0x0224, 0x06d4, 0xfef9, 0xffbf, 0x0625, 0xfef9, 0x0105, 0x0740, 0xfef9, 0xfe5c, 0x06d4, 0xfef9, 0xffbf, 
-	0x0764, 0xfef9, 0xfcea, 0x0740, 0xfef9, 0xfe5c, 0x0764, 0xfef9, 0xfcea, 0x0764, 0xfef9, 0xfa9d, 0x0045, 0x0016, 0x0002, 0x0000, 
-	0xfe0b, 0x0d2c, 0x0615, 0x0000, 0x0003, 0x0042, 0x0042, 0x003f, 0x003c, 0x0027, 0x003f, 0x0039, 0x0036, 0x003c, 0x0039, 0x0021, 
-	0x0033, 0x0036, 0x001e, 0x0033, 0x0024, 0x0030, 0x0030, 0x0015, 0x002d, 0x001b, 0x002a, 0x002d, 0x0018, 0x002a, 0x0027, 0x0000, 
-	0x0021, 0x0024, 0x001b, 0x001e, 0x0015, 0x0018, 0x0012, 0x000f, 0x000f, 0x0009, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003, 
-	0xfd25, 0xfe23, 0x0e30, 0xfd25, 0xfe23, 0x0d46, 0x0602, 0xfdf2, 0x0e21, 0x0000, 0xfdf2, 0x0e21, 0x0602, 0xfdf2, 0x0d2b, 0xf9fe, 
-	0xfdf2, 0x0e21, 0xf9fe, 0xfdf2, 0x0d2b, 0x0224, 0xfe23, 0x0c30, 0x02db, 0xfe23, 0x0d46, 0x016d, 0xfe23, 0x0e30, 0x00b6, 0xfe23, 
-	0x0e30, 0x0000, 0xfe23, 0x0cd1, 0x00b6, 0xfe23, 0x0cc3, 0xfddc, 0xfe23, 0x0e30, 0x02db, 0xfe23, 0x0e30, 0x0224, 0xfe23, 0x0e30, 
-	0x016d, 0xfe23, 0x0c88, 0x0000, 0xfe23, 0x0e30, 0xff4a, 0xfe23, 0x0e30, 0xff4a, 0xfe23, 0x0cc3, 0xfe93, 0xfe23, 0x0e30, 0xfe93, 
-	0xfe23, 0x0c88, 0xfde0, 0xfe23, 0x0c29, 0x000c, 0x0002, 0x0003, 0xf9da, 0x0000, 0xfbe4, 0x00fb, 0x0000, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0009, 0x0003, 0xfa8d, 0x0000, 0xfc93, 0xf926, 0x0000, 0xfb34, 0xf926, 0x0000, 0xfc93, 0xfa8d, 0x0000, 0xfb34, 0x000c, 
-	0x0002, 0x0003, 0xf9da, 0x0000, 0xfd8c, 0x0133, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfa8d, 0x0000, 0xfe85, 
-	0xf926, 0x0000, 0xfc93, 0xf926, 0x0000, 0xfe85, 0xfa8d, 0x0000, 0xfc93, 0x000f, 0x0003, 0x0003, 0xf9da, 0x0000, 0xff59, 0x0116, 
-	0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x000c, 0x0006, 0x0003, 0xf926, 0x0000, 0x002c, 0xfa8d, 0x0000, 0x002c, 
-	0xf926, 0x0000, 0x001e, 0xfa8d, 0x0000, 0xfe85, 0xf926, 0x0000, 0xfe85, 0x000c, 0x0002, 0x0003, 0xf9da, 0x0000, 0x0103, 0x0119, 
-	0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfa8d, 0x0000, 0x002c, 0xf926, 0x0000, 0x002c, 0xfa8d, 0x0000, 0x01db, 
-	0xf926, 0x0000, 0x01db, 0x000c, 0x0002, 0x0003, 0x05be, 0x0000, 0xfbe4, 0x00c8, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 
-	0x0006, 0x061d, 0x0000, 0xfc93, 0x061d, 0x0000, 0xfb34, 0x055f, 0x0000, 0xfc93, 0x055f, 0x0000, 0xfb34, 0x000c, 0x0002, 0x0003, 
-	0x05be, 0x0000, 0xfd3c, 0x00c1, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x055f, 0x0000, 0xfde5, 0x061d, 0x0000, 
-	0xfc93, 0x055f, 0x0000, 0xfc93, 0x061d, 0x0000, 0xfde5, 0x000c, 0x0002, 0x0003, 0x05be, 0x0000, 0xfe8e, 0x00c1, 0x0000, 0x0000, 
-	0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x055f, 0x0000, 0xff37, 0x061d, 0x0000, 0xfde5, 0x055f, 0x0000, 0xfde5, 0x061d, 0x0000, 
-	0xff37, 0x000c, 0x0002, 0x0003, 0x05be, 0x0000, 0xffe0, 0x00c1, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x055f, 
-	0x0000, 0x0089, 0x061d, 0x0000, 0xff37, 0x055f, 0x0000, 0xff37, 0x061d, 0x0000, 0x0089, 0x000c, 0x0002, 0x0003, 0x05be, 0x0000, 
-	0x0132, 0x00c1, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x055f, 0x0000, 0x01db, 0x061d, 0x0000, 0x0089, 0x055f, 
-	0x0000, 0x0089, 0x061d, 0x0000, 0x01db, 0x000c, 0x0002, 0x0003, 0xfdd8, 0x0000, 0xff00, 0x0160, 0x0000, 0x0003, 0x0009, 0x0000, 
-	0x0000, 0x0009, 0x0006, 0xfce4, 0x0000, 0xffaf, 0xfddf, 0x0000, 0x0060, 0xfdcd, 0x0000, 0xfda0, 0xfecc, 0x0000, 0xfe93, 0x000c, 
-	0x0002, 0x0003, 0xfb14, 0x0000, 0xfbe4, 0x00dd, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfa8d, 0x0000, 0xfc93, 
-	0xfb9a, 0x0000, 0xfb34, 0xfa8d, 0x0000, 0xfb34, 0xfb9a, 0x0000, 0xfc93, 0x00e4, 0x004c, 0x0002, 0x0000, 0x0457, 0x0000, 0x0308, 
-	0x0000, 0x00d5, 0x00de, 0x00cc, 0x00e1, 0x00e1, 0x00d8, 0x00db, 0x00de, 0x00d8, 0x00db, 0x00c3, 0x00d5, 0x00d2, 0x00c0, 0x00c6, 
-	0x0060, 0x0054, 0x00cf, 0x00cf, 0x00d2, 0x00c9, 0x00cc, 0x00c6, 0x00c9, 0x00c0, 0x00c3, 0x00bd, 0x00ba, 0x00b7, 0x00bd, 0x00ba, 
-	0x008d, 0x00a2, 0x0027, 0x009f, 0x00b7, 0x00a5, 0x009c, 0x0099, 0x00ae, 0x00ab, 0x0087, 0x00b4, 0x0096, 0x002a, 0x00b1, 0x00b1, 
-	0x00b4, 0x00ae, 0x00a8, 0x00a8, 0x00ab, 0x00a2, 0x00a5, 0x009c, 0x009f, 0x0096, 0x0099, 0x0093, 0x0090, 0x008a, 0x0093, 0x0090, 
-	0x005a, 0x0072, 0x008d, 0x006f, 0x008a, 0x0075, 0x006c, 0x0069, 0x007e, 0x007b, 0x0051, 0x0084, 0x0066, 0x0087, 0x0081, 0x0081, 
-	0x0084, 0x007e, 0x0078, 0x0078, 0x007b, 0x0072, 0x0075, 0x006c, 0x006f, 0x0066, 0x0069, 0x0063, 0x005d, 0x0057, 0x0063, 0x005d, 
-	0x0060, 0x003c, 0x005a, 0x0039, 0x0057, 0x003f, 0x0036, 0x0033, 0x0048, 0x0045, 0x0054, 0x004e, 0x0030, 0x0051, 0x004b, 0x004b, 
-	0x004e, 0x0048, 0x0042, 0x0042, 0x0045, 0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 0x002d, 0x0024, 0x0021, 0x002d, 0x001b, 
-	0x002a, 0x0024, 0x0027, 0x0015, 0x000f, 0x0009, 0x0021, 0x001e, 0x000c, 0x0018, 0x001e, 0x0012, 0x0006, 0x0018, 0x001b, 0x0015, 
-	0x0000, 0x0003, 0x0012, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0xfff2, 0x075f, 0x0000, 0xfff2, 0x0724, 0x0000, 0xff9a, 
-	0x0724, 0x0000, 0xff9a, 0x0707, 0x0000, 0x000e, 0x0707, 0x0000, 0x000e, 0x0724, 0x0000, 0xffb7, 0x0724, 0x0000, 0x000e, 0x075f, 
-	0x0000, 0xffb7, 0x0707, 0x0000, 0xffb7, 0x0675, 0x0000, 0xfff2, 0x0707, 0x0000, 0xff9a, 0x0675, 0x0000, 0xffb7, 0x0657, 0x0000, 
-	0x0049, 0x0657, 0x0000, 0x0049, 0x0675, 0x0000, 0xff9a, 0x0657, 0x0000, 0x0066, 0x0307, 0x0000, 0x0066, 0x02ea, 0x0000, 0xff9a, 
-	0x0307, 0x0000, 0xff9a, 0x02ea, 0x0000, 0x0049, 0x0307, 0x0000, 0xffb7, 0x0307, 0x0000, 0xffb7, 0x02ea, 0x0000, 0xffb7, 0x0257, 
-	0x0000, 0x0049, 0x02ea, 0x0000, 0x0066, 0x03b6, 0x0000, 0x0066, 0x0399, 0x0000, 0x0049, 0x03b6, 0x0000, 0x0049, 0x0257, 0x0000, 
-	0xff9a, 0x0257, 0x0000, 0x0049, 0x0399, 0x0000, 0xffb7, 0x023a, 0x0000, 0x0049, 0x023a, 0x0000, 0xff9a, 0x023a, 0x0000, 0x0066, 
-	0x0466, 0x0000, 0x0066, 0x0449, 0x0000, 0xff9a, 0x0466, 0x0000, 0xff9a, 0x0449, 0x0000, 0x0049, 0x0466, 0x0000, 0xffb7, 0x0466, 
-	0x0000, 0xffb7, 0x0449, 0x0000, 0xffb7, 0x03b6, 0x0000, 0x0049, 0x0449, 0x0000, 0x0066, 0x0516, 0x0000, 0x0066, 0x04f8, 0x0000, 
-	0x0049, 0x0516, 0x0000, 0xff9a, 0x03b6, 0x0000, 0x0049, 0x04f8, 0x0000, 0xffb7, 0x0399, 0x0000, 0xff9a, 0x0399, 0x0000, 0x0066, 
-	0x05c5, 0x0000, 0x0066, 0x05a8, 0x0000, 0xff9a, 0x05c5, 0x0000, 0xff9a, 0x05a8, 0x0000, 0x0049, 0x05c5, 0x0000, 0xffb7, 0x05c5, 
-	0x0000, 0xffb7, 0x05a8, 0x0000, 0xffb7, 0x0516, 0x0000, 0x0049, 0x05a8, 0x0000, 0x0066, 0x0675, 0x0000, 0x0066, 0x0657, 0x0000, 
-	0xff9a, 0x0516, 0x0000, 0xffb7, 0x04f8, 0x0000, 0xff9a, 0x04f8, 0x0000, 0x0066, 0x01a8, 0x0000, 0x0066, 0x018b, 0x0000, 0x0049, 
-	0x01a8, 0x0000, 0x000e, 0x01a8, 0x0000, 0xfff2, 0x01a8, 0x0000, 0x0066, 0x0257, 0x0000, 0x0066, 0x023a, 0x0000, 0x0049, 0x018b, 
-	0x0000, 0xfff2, 0x0150, 0x0000, 0x000e, 0x0150, 0x0000, 0x000e, 0x018b, 0x0000, 0xfff2, 0x018b, 0x0000, 0x0156, 0x00a1, 0x0002, 
-	0x0000, 0x00b2, 0x0000, 0x00da, 0x03e7, 0x0045, 0x003c, 0x0057, 0x0045, 0x0060, 0x0057, 0x0069, 0x0060, 0x0072, 0x0069, 0x0075, 
-	0x0072, 0x004e, 0x0075, 0x003c, 0x004e, 0x006c, 0x0075, 0x0063, 0x0072, 0x005a, 0x0069, 0x0051, 0x0060, 0x0054, 0x0057, 0x0048, 
-	0x004e, 0x0042, 0x0045, 0x0033, 0x003c, 0x0126, 0x0144, 0x0129, 0x0147, 0x013b, 0x014a, 0x0138, 0x014d, 0x0135, 0x0150, 0x013e, 
-	0x012c, 0x0141, 0x012f, 0x0132, 0x0153, 0x0141, 0x0153, 0x0153, 0x0150, 0x0150, 0x014d, 0x014d, 0x014a, 0x014a, 0x0147, 0x0147, 
-	0x0144, 0x0144, 0x013e, 0x013e, 0x0141, 0x0129, 0x013b, 0x013b, 0x0138, 0x0138, 0x0135, 0x0135, 0x0132, 0x0132, 0x012f, 0x012f, 
-	0x012c, 0x012c, 0x0126, 0x0126, 0x0129, 0x0114, 0x00ba, 0x00c3, 0x011d, 0x00b1, 0x010b, 0x011a, 0x00c0, 0x00ab, 0x0105, 0x010e, 
-	0x00b4, 0x00a5, 0x00ff, 0x00bd, 0x0117, 0x0111, 0x00b7, 0x00fc, 0x00a2, 0x0108, 0x00ae, 0x0120, 0x00c6, 0x00c9, 0x0123, 0x0102, 
-	0x00a8, 0x011a, 0x0123, 0x0120, 0x0123, 0x011d, 0x0120, 0x011a, 0x011d, 0x0114, 0x0117, 0x010e, 0x0111, 0x0108, 0x010b, 0x0102, 
-	0x0105, 0x00fc, 0x00ff, 0x00f0, 0x00cc, 0x00f6, 0x00d2, 0x00f3, 0x00cf, 0x00f9, 0x00d5, 0x00f6, 0x00f9, 0x00f0, 0x00f3, 0x00ea, 
-	0x00ed, 0x009f, 0x00e7, 0x0093, 0x00db, 0x00d8, 0x0090, 0x009c, 0x00e4, 0x0099, 0x00e1, 0x00de, 0x0096, 0x00e4, 0x00e7, 0x00e1, 
-	0x00e4, 0x00de, 0x00e1, 0x00db, 0x00de, 0x00d8, 0x00db, 0x00d2, 0x00d5, 0x00c0, 0x00c9, 0x00cc, 0x00cf, 0x00c6, 0x00c9, 0x00c3, 
-	0x00c6, 0x00c0, 0x00c3, 0x00ba, 0x00bd, 0x00b4, 0x00b7, 0x00ae, 0x00b1, 0x00a8, 0x00ab, 0x00a2, 0x00a5, 0x009c, 0x009f, 0x0099, 
-	0x009c, 0x0096, 0x0099, 0x0093, 0x0096, 0x0090, 0x0093, 0x007b, 0x002d, 0x000c, 0x0078, 0x0084, 0x0012, 0x0024, 0x007e, 0x008a, 
-	0x002a, 0x001b, 0x0087, 0x0081, 0x001e, 0x0027, 0x008d, 0x001e, 0x0027, 0x0027, 0x002a, 0x002a, 0x001b, 0x001b, 0x0012, 0x0012, 
-	0x0024, 0x002d, 0x001e, 0x0024, 0x000c, 0x000c, 0x002d, 0x0081, 0x008d, 0x008d, 0x008a, 0x008a, 0x0087, 0x0087, 0x0084, 0x0084, 
-	0x007e, 0x007b, 0x0081, 0x007e, 0x0078, 0x0078, 0x007b, 0x0075, 0x004b, 0x006f, 0x004b, 0x0048, 0x006c, 0x0072, 0x006f, 0x0066, 
-	0x006f, 0x006c, 0x0063, 0x0069, 0x0066, 0x005d, 0x0066, 0x0063, 0x005a, 0x0060, 0x005d, 0x0054, 0x005d, 0x005a, 0x0051, 0x0057, 
-	0x003f, 0x0042, 0x0054, 0x0051, 0x003f, 0x004e, 0x0036, 0x004b, 0x0036, 0x0033, 0x0048, 0x0045, 0x0030, 0x0039, 0x0042, 0x003f, 
-	0x0030, 0x003c, 0x0039, 0x0036, 0x0039, 0x0030, 0x0033, 0x000f, 0x0000, 0x0018, 0x0015, 0x0015, 0x0021, 0x002d, 0x0000, 0x0003, 
-	0x0006, 0x002a, 0x0009, 0x0006, 0x0027, 0x0021, 0x0024, 0x0021, 0x000f, 0x0009, 0x0018, 0x0003, 0x001e, 0x0018, 0x001b, 0x0012, 
-	0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0xfff5, 0x0165, 0xffe5, 0xffe5, 0x0165, 0xfff5, 0xffe5, 0x0165, 0x000b, 
-	0xfff5, 0x0165, 0x001b, 0x0015, 0x015b, 0xffcc, 0x000b, 0x0165, 0xffe5, 0x0034, 0x015b, 0x0015, 0x001b, 0x0165, 0x000b, 0x000b, 
-	0x0165, 0x001b, 0x0015, 0x015b, 0x0034, 0xffcc, 0x015b, 0xffeb, 0x001b, 0x0165, 0xfff5, 0x0034, 0x015b, 0xffeb, 0xffcc, 0x015b, 
-	0x0015, 0xffeb, 0x015b, 0x0034, 0xffeb, 0x015b, 0xffcc, 0x0015, 0x0133, 0xffcc, 0xffeb, 0x0133, 0xffcc, 0xff5d, 0x00e7, 0xffbd, 
-	0xffbd, 0x00e7, 0xff5d, 0xffd4, 0x010d, 0xff95, 0x0034, 0x0133, 0xffeb, 0x0043, 0x00e7, 0xff5d, 0x002c, 0x010d, 0xff95, 0xffcc, 
-	0x0133, 0xffeb, 0xff5d, 0x00e7, 0x0043, 0xff95, 0x010d, 0xffd4, 0x0034, 0x0133, 0x0015, 0x00a3, 0x00e7, 0xffbd, 0x006b, 0x010d, 
-	0xffd4, 0x0015, 0x0133, 0x0034, 0x00a3, 0x00e7, 0x0043, 0x006b, 0x010d, 0x002c, 0xffeb, 0x0133, 0x0034, 0x0043, 0x00e7, 0x00a3, 
-	0x002c, 0x010d, 0x006b, 0xffcc, 0x0133, 0x0015, 0xffbd, 0x00e7, 0x00a3, 0xffd4, 0x010d, 0x006b, 0xff95, 0x010d, 0x002c, 0x0015, 
-	0x0138, 0xffcc, 0xffeb, 0x0138, 0xffcc, 0x0034, 0x0138, 0xffeb, 0xffcc, 0x0138, 0xffeb, 0x0034, 0x0138, 0x0015, 0x0015, 0x0138, 
-	0x0034, 0xffeb, 0x0138, 0x0034, 0xffcc, 0x0138, 0x0015, 0xff88, 0x001d, 0xffcf, 0xff88, 0x001d, 0x0032, 0xffcf, 0x001d, 0x0078, 
-	0x0031, 0x001d, 0x0078, 0x0078, 0x001d, 0x0032, 0x0078, 0x001d, 0xffcf, 0x0079, 0x0000, 0xffdd, 0x006f, 0x0000, 0xffc4, 0x006f, 
-	0x0000, 0x003c, 0x0079, 0x0000, 0x0023, 0x0023, 0x0000, 0x0079, 0x003c, 0x0000, 0x006f, 0xffc4, 0x0000, 0x006f, 0xffdd, 0x0000, 
-	0x0079, 0xff87, 0x0000, 0x0023, 0xff91, 0x0000, 0x003c, 0xff91, 0x0000, 0xffc4, 0xff87, 0x0000, 0xffdd, 0xff93, 0x0000, 0xffe0, 
-	0xff9c, 0x0000, 0xffca, 0x003c, 0x00f7, 0xff91, 0x0023, 0x00f7, 0xff87, 0xffdd, 0x00f7, 0xff87, 0xffc4, 0x00f7, 0xff91, 0xff88, 
-	0x000e, 0xffcf, 0xff88, 0x000e, 0x0032, 0xffcf, 0x000e, 0x0078, 0x0031, 0x000e, 0x0078, 0x0078, 0x000e, 0x0032, 0x0078, 0x000e, 
-	0xffcf, 0x0023, 0x001d, 0x0079, 0xffdd, 0x001d, 0x0079, 0x003c, 0x00c8, 0xff91, 0x0023, 0x00c8, 0xff87, 0xffdd, 0x00c8, 0xff87, 
-	0xffc4, 0x00c8, 0xff91, 0x0079, 0x00f7, 0xffdd, 0x006f, 0x00f7, 0xffc4, 0x006f, 0x00f7, 0x003c, 0x0079, 0x00f7, 0x0023, 0x0023, 
-	0x00f7, 0x0079, 0x003c, 0x00f7, 0x006f, 0xffc4, 0x00f7, 0x006f, 0xffdd, 0x00f7, 0x0079, 0xff87, 0x00f7, 0x0023, 0xff91, 0x00f7, 
-	0x003c, 0xff91, 0x00f7, 0xffc4, 0xff87, 0x00f7, 0xffdd, 0xff93, 0x00f7, 0xffe0, 0xff9c, 0x00f7, 0xffca, 0xffcb, 0x00c8, 0xff80, 
-	0x0035, 0x00c8, 0xff80, 0xff80, 0x00c8, 0xffcb, 0xff80, 0x00c8, 0x0035, 0xffcb, 0x00c8, 0x0080, 0x0035, 0x00c8, 0x0080, 0x0080, 
-	0x00c8, 0x0035, 0x0080, 0x00c8, 0xffcb, 0xff80, 0x00d6, 0xffcb, 0xff80, 0x00d6, 0x0035, 0xffcb, 0x00d6, 0xff80, 0x0035, 0x00d6, 
-	0xff80, 0x0080, 0x00d6, 0xffcb, 0x0080, 0x00d6, 0x0035, 0x0035, 0x00d6, 0x0080, 0xffcb, 0x00d6, 0x0080, 0x0018, 0x0008, 0x0002, 
-	0x0000, 0x0000, 0xfc8b, 0x00e1, 0x0000, 0x0015, 0x0009, 0x0012, 0x0015, 0x0006, 0x0012, 0x000f, 0x0003, 0x000c, 0x000f, 0x0000, 
-	0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x003e, 0x0000, 0xfc22, 0x003e, 0x0000, 0xfc61, 0x003e, 0x0000, 0xfc69, 0x00c8, 0x0000, 
-	0xfcf4, 0xffc2, 0x0000, 0xfc22, 0xffc2, 0x0000, 0xfc61, 0xffc2, 0x0000, 0xfc69, 0xff38, 0x0000, 0xfcf4, 0x0063, 0x001e, 0x0002, 
-	0x0000, 0x0000, 0xfdea, 0x01a0, 0x0000, 0x0060, 0x005a, 0x005d, 0x0057, 0x005a, 0x0054, 0x0057, 0x0051, 0x0054, 0x004e, 0x0051, 
-	0x004b, 0x004e, 0x0048, 0x004b, 0x0045, 0x0048, 0x001b, 0x0045, 0x0015, 0x0042, 0x000f, 0x003f, 0x0042, 0x003c, 0x003f, 0x0039, 
-	0x003c, 0x0036, 0x0039, 0x0033, 0x002d, 0x0030, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x0024, 0x001e, 0x0021, 
-	0x0018, 0x001e, 0x0012, 0x0018, 0x001b, 0x0012, 0x0015, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 
-	0x0003, 0x011e, 0x0000, 0xfd52, 0x00f3, 0x0000, 0xfd86, 0x00bf, 0x0000, 0xfdb1, 0x0083, 0x0000, 0xfdd1, 0x0043, 0x0000, 0xfde5, 
-	0x0000, 0x0000, 0xfdeb, 0x0060, 0x0000, 0xfe78, 0x0000, 0x0000, 0xfe81, 0x0051, 0x0000, 0xfe2e, 0x0000, 0x0000, 0xfe36, 0x00bd, 
-	0x0000, 0xfe5c, 0x00a0, 0x0000, 0xfe16, 0x0112, 0x0000, 0xfe2e, 0x00e9, 0x0000, 0xfdf0, 0x015d, 0x0000, 0xfdf1, 0x0128, 0x0000, 
-	0xfdbb, 0x019b, 0x0000, 0xfda6, 0x015c, 0x0000, 0xfd7c, 0xfee2, 0x0000, 0xfd52, 0xff0d, 0x0000, 0xfd86, 0xff41, 0x0000, 0xfdb1, 
-	0xff7d, 0x0000, 0xfdd1, 0xffbd, 0x0000, 0xfde5, 0xffa0, 0x0000, 0xfe78, 0xffaf, 0x0000, 0xfe2e, 0xff43, 0x0000, 0xfe5c, 0xff60, 
-	0x0000, 0xfe16, 0xfeee, 0x0000, 0xfe2e, 0xff17, 0x0000, 0xfdf0, 0xfea3, 0x0000, 0xfdf1, 0xfed8, 0x0000, 0xfdbb, 0xfe65, 0x0000, 
-	0xfda6, 0xfea4, 0x0000, 0xfd7c, 0x0024, 0x0010, 0x0003, 0xfd94, 0x0015, 0xff00, 0x004e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 
-	0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 
-	0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 
-	0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0xfdc5, 0x002b, 0xff31, 0xfdd9, 
-	0x002b, 0xfee3, 0xfd4f, 0x002b, 0xff1c, 0xfdc5, 0x0000, 0xff31, 0xfd62, 0x002b, 0xfece, 0xfd62, 0x0000, 0xfece, 0xfd94, 0x002b, 
-	0xff46, 0xfd94, 0x0000, 0xff46, 0xfd94, 0x002b, 0xfeb9, 0xfd94, 0x0000, 0xfeb9, 0xfdd9, 0x0000, 0xfee3, 0xfd4f, 0x0000, 0xff1c, 
-	0x0024, 0x0010, 0x0003, 0xfeb1, 0x0015, 0xffbe, 0x004d, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 
-	0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 
-	0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 
-	0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0xfee2, 0x002b, 0xffef, 0xfef5, 0x002b, 0xffa1, 0xfe6c, 0x002b, 
-	0xffda, 0xfee2, 0x0000, 0xffef, 0xfe7f, 0x002b, 0xff8c, 0xfe7f, 0x0000, 0xff8c, 0xfeb1, 0x002b, 0x0003, 0xfeb1, 0x0000, 0x0003, 
-	0xfeb1, 0x002b, 0xff78, 0xfeb1, 0x0000, 0xff78, 0xfef5, 0x0000, 0xffa1, 0xfe6c, 0x0000, 0xffda, 0x0024, 0x0010, 0x0003, 0x014f, 
-	0x0015, 0xffbe, 0x004e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 
-	0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 
-	0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 
-	0x0021, 0x0003, 0x000c, 0x0006, 0x0181, 0x002b, 0xffef, 0x0194, 0x002b, 0xffa1, 0x010b, 0x002b, 0xffda, 0x0181, 0x0000, 0xffef, 
-	0x011e, 0x002b, 0xff8c, 0x011e, 0x0000, 0xff8c, 0x014f, 0x002b, 0x0003, 0x014f, 0x0000, 0x0003, 0x014f, 0x002b, 0xff78, 0x014f, 
-	0x0000, 0xff78, 0x0194, 0x0000, 0xffa1, 0x010b, 0x0000, 0xffda, 0x0024, 0x0010, 0x0003, 0x026c, 0x0015, 0xff00, 0x004e, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 
-	0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 
-	0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 
-	0x029e, 0x002b, 0xff31, 0x02b1, 0x002b, 0xfee3, 0x0227, 0x002b, 0xff1c, 0x029e, 0x0000, 0xff31, 0x023b, 0x002b, 0xfece, 0x023b, 
-	0x0000, 0xfece, 0x026c, 0x002b, 0xff46, 0x026c, 0x0000, 0xff46, 0x026c, 0x002b, 0xfeb9, 0x026c, 0x0000, 0xfeb9, 0x02b1, 0x0000, 
-	0xfee3, 0x0227, 0x0000, 0xff1c, 0x0024, 0x0010, 0x0003, 0x032a, 0x0015, 0xfde3, 0x004e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 
-	0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 
-	0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 
-	0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0x035c, 0x002b, 0xfe14, 0x036f, 
-	0x002b, 0xfdc6, 0x02e6, 0x002b, 0xfdff, 0x035c, 0x0000, 0xfe14, 0x02f9, 0x002b, 0xfdb1, 0x02f9, 0x0000, 0xfdb1, 0x032b, 0x002b, 
-	0xfe29, 0x032b, 0x0000, 0xfe29, 0x032b, 0x002b, 0xfd9c, 0x032b, 0x0000, 0xfd9c, 0x036f, 0x0000, 0xfdc6, 0x02e6, 0x0000, 0xfdff, 
-	0x0024, 0x0010, 0x0003, 0x0482, 0xfe08, 0x03c8, 0x004e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 
-	0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 
-	0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 
-	0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0x04b4, 0xfe1e, 0x03fa, 0x04c7, 0xfe1e, 0x03ac, 0x043d, 0xfe1e, 
-	0x03e5, 0x04b4, 0xfdf2, 0x03fa, 0x0450, 0xfe1e, 0x0397, 0x0450, 0xfdf2, 0x0397, 0x0482, 0xfe1e, 0x040e, 0x0482, 0xfdf2, 0x040e, 
-	0x0482, 0xfe1e, 0x0382, 0x0482, 0xfdf2, 0x0382, 0x04c7, 0xfdf2, 0x03ac, 0x043d, 0xfdf2, 0x03e5, 0x0024, 0x0010, 0x0003, 0xfb7c, 
-	0xfe08, 0x03c8, 0x004e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 
-	0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 
-	0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 
-	0x0021, 0x0003, 0x000c, 0x0006, 0xfbad, 0xfe1e, 0x03fa, 0xfbc0, 0xfe1e, 0x03ac, 0xfb37, 0xfe1e, 0x03e5, 0xfbad, 0xfdf2, 0x03fa, 
-	0xfb4a, 0xfe1e, 0x0397, 0xfb4a, 0xfdf2, 0x0397, 0xfb7b, 0xfe1e, 0x040e, 0xfb7b, 0xfdf2, 0x040e, 0xfb7b, 0xfe1e, 0x0382, 0xfb7b, 
-	0xfdf2, 0x0382, 0xfbc0, 0xfdf2, 0x03ac, 0xfb37, 0xfdf2, 0x03e5, 0x0024, 0x0010, 0x0003, 0xfcd6, 0x0015, 0xfde3, 0x004d, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 
-	0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 
-	0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 
-	0xfd07, 0x002b, 0xfe14, 0xfd1a, 0x002b, 0xfdc6, 0xfc91, 0x002b, 0xfdff, 0xfd07, 0x0000, 0xfe14, 0xfca4, 0x002b, 0xfdb1, 0xfca4, 
-	0x0000, 0xfdb1, 0xfcd5, 0x002b, 0xfe29, 0xfcd5, 0x0000, 0xfe29, 0xfcd5, 0x002b, 0xfd9c, 0xfcd5, 0x0000, 0xfd9c, 0xfd1a, 0x0000, 
-	0xfdc6, 0xfc91, 0x0000, 0xfdff, 0x000c, 0x0004, 0x0002, 0x068a, 0xfef9, 0x08e7, 0x0429, 0x0000, 0x0006, 0x0003, 0x0009, 0x0000, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0x0761, 0xfef9, 0x04d3, 0x0761, 0xfef9, 0x0cfb, 0x05b4, 0xfef9, 0x0cfb, 0x05b4, 0xfef9, 0x04d3, 
-	0x000c, 0x0004, 0x0002, 0xf976, 0xfef9, 0x08e7, 0x0429, 0x0000, 0x0006, 0x0003, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 
-	0xf89f, 0xfef9, 0x04d3, 0xf89f, 0xfef9, 0x0cfb, 0xfa4c, 0xfef9, 0x0cfb, 0xfa4c, 0xfef9, 0x04d3, 0x0030, 0x0010, 0x0002, 0x0000, 
-	0xfdf3, 0x0909, 0x0256, 0x0000, 0x0003, 0x002d, 0x002d, 0x002a, 0x002a, 0x0027, 0x0027, 0x0024, 0x0024, 0x0021, 0x0021, 0x001e, 
-	0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 
-	0x0006, 0x0000, 0x0000, 0x0003, 0x00e4, 0xfdf3, 0x0b32, 0x0000, 0xfdf3, 0x0b5f, 0x01a6, 0xfdf3, 0x0ab0, 0x0228, 0xfdf3, 0x09ee, 
-	0x0255, 0xfdf3, 0x090a, 0x0228, 0xfdf3, 0x0825, 0x01a6, 0xfdf3, 0x0763, 0x00e4, 0xfdf3, 0x06e1, 0x0000, 0xfdf3, 0x06b4, 0xff1c, 
-	0xfdf3, 0x06e1, 0xfe5a, 0xfdf3, 0x0763, 0xfdd8, 0xfdf3, 0x0825, 0xfdab, 0xfdf3, 0x090a, 0xfdd8, 0xfdf3, 0x09ee, 0xfe5a, 0xfdf3, 
-	0x0ab0, 0xff1c, 0xfdf3, 0x0b32, 0x0024, 0x000c, 0x0002, 0x0117, 0xfdf3, 0x09d1, 0x0070, 0x0000, 0x0021, 0x0000, 0x001e, 0x0021, 
-	0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0003, 0x0006, 0x0000, 0x0003, 0x0117, 0xfdf3, 0x0a41, 0x00e0, 0xfdf3, 0x0a32, 0x00b7, 0xfdf3, 0x0a09, 0x00a8, 0xfdf3, 0x09d2, 
-	0x00b7, 0xfdf3, 0x099a, 0x00e0, 0xfdf3, 0x0971, 0x0117, 0xfdf3, 0x0962, 0x014f, 0xfdf3, 0x0971, 0x0178, 0xfdf3, 0x099a, 0x0187, 
-	0xfdf3, 0x09d2, 0x0178, 0xfdf3, 0x0a09, 0x014f, 0xfdf3, 0x0a32, 0x0024, 0x000c, 0x0002, 0xfee9, 0xfdf3, 0x09d1, 0x0070, 0x0000, 
-	0x0021, 0x0000, 0x001e, 0x0021, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0xfee9, 0xfdf3, 0x0a41, 0xff20, 0xfdf3, 0x0a32, 0xff49, 0xfdf3, 
-	0x0a09, 0xff58, 0xfdf3, 0x09d2, 0xff49, 0xfdf3, 0x099a, 0xff20, 0xfdf3, 0x0971, 0xfee9, 0xfdf3, 0x0962, 0xfeb1, 0xfdf3, 0x0971, 
-	0xfe88, 0xfdf3, 0x099a, 0xfe79, 0xfdf3, 0x09d2, 0xfe88, 0xfdf3, 0x0a09, 0xfeb1, 0xfdf3, 0x0a32, 0x0030, 0x0010, 0x0002, 0x0000, 
-	0xfdf3, 0x08e3, 0x00c5, 0x0000, 0x002d, 0x0000, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x0024, 0x001e, 0x0021, 
-	0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0003, 0x0006, 0x0000, 0x0003, 0x0000, 0xfdf3, 0x0985, 0x0047, 0xfdf3, 0x0980, 0x0084, 0xfdf3, 0x096c, 0x00ad, 0xfdf3, 0x0941, 
-	0x00bb, 0xfdf3, 0x0903, 0x00ad, 0xfdf3, 0x08bc, 0x0084, 0xfdf3, 0x087e, 0x0047, 0xfdf3, 0x0853, 0x0000, 0xfdf3, 0x0842, 0xffb9, 
-	0xfdf3, 0x0853, 0xff7c, 0xfdf3, 0x087e, 0xff53, 0xfdf3, 0x08bd, 0xff45, 0xfdf3, 0x0904, 0xff53, 0xfdf3, 0x0942, 0xff7c, 0xfdf3, 
-	0x096d, 0xffb9, 0xfdf3, 0x0980, 0x0036, 0x0010, 0x0002, 0x0000, 0xfe11, 0x08f2, 0x03de, 0x0000, 0x0021, 0x001b, 0x0027, 0x0033, 
-	0x0033, 0x001e, 0x0015, 0x0030, 0x0030, 0x002a, 0x002a, 0x002d, 0x0024, 0x0027, 0x001e, 0x0021, 0x001b, 0x0003, 0x0009, 0x0018, 
-	0x0018, 0x0000, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd8d, 0xfe11, 0x05f4, 0xfee2, 
-	0xfe11, 0x053e, 0xfc29, 0xfe11, 0x0951, 0xfc29, 0xfe11, 0x088f, 0xfd45, 0xfe11, 0x0bab, 0xfc6f, 0xfe11, 0x0a6a, 0xfe86, 0xfe11, 
-	0x0c81, 0x0000, 0xfe11, 0x0ccd, 0xfc99, 0xfe11, 0x071e, 0x0000, 0xfe11, 0x0518, 0x0273, 0xfe11, 0x05f4, 0x011e, 0xfe11, 0x053e, 
-	0x03d7, 0xfe11, 0x0951, 0x03d7, 0xfe11, 0x088f, 0x02bb, 0xfe11, 0x0bab, 0x0391, 0xfe11, 0x0a6a, 0x017a, 0xfe11, 0x0c81, 0x0367, 
-	0xfe11, 0x071e, 0x0012, 0x0005, 0x0002, 0x02a5, 0xfdf3, 0x091a, 0x012b, 0x0000, 0x000f, 0x0006, 0x000c, 0x0000, 0x0009, 0x000c, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0x02a6, 0xfdf3, 0x0a16, 0x0236, 0xfdf3, 0x0a30, 0x02e0, 0xfdf3, 0x088c, 0x0314, 0xfdf3, 0x091c, 
-	0x0304, 0xfdf3, 0x09b2, 0x0251, 0xfdf3, 0x0805, 0x0012, 0x0005, 0x0002, 0xfd5b, 0xfdf3, 0x091a, 0x012b, 0x0000, 0x000f, 0x0006, 
-	0x000c, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd5a, 0xfdf3, 0x0a16, 0xfdca, 0xfdf3, 0x0a30, 0xfd20, 0xfdf3, 
-	0x088c, 0xfcec, 0xfdf3, 0x091c, 0xfcfc, 0xfdf3, 0x09b2, 0xfdaf, 0xfdf3, 0x0805, 0x0018, 0x0006, 0x0003, 0x0335, 0xfe06, 0x09c2, 
-	0x00e8, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x0015, 0x0006, 0x000f, 0x0015, 0x0000, 
-	0x0006, 0x000c, 0x0015, 0x000f, 0x0341, 0xfe15, 0x0a38, 0x0407, 0xfdf3, 0x0960, 0x038e, 0xfe17, 0x0944, 0x03ba, 0xfdf4, 0x0a7c, 
-	0x0264, 0xfdfc, 0x09b3, 0x030c, 0xfe18, 0x0922, 0x02b1, 0xfdfb, 0x0909, 0x02c0, 0xfe16, 0x09ec, 0x0018, 0x0006, 0x0003, 0xfccb, 
-	0xfe06, 0x09c2, 0x00e8, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0015, 0x0012, 0x0003, 
-	0x0015, 0x0003, 0x0000, 0x000c, 0x0012, 0x0015, 0xfcbf, 0xfe15, 0x0a38, 0xfc72, 0xfe17, 0x0944, 0xfbf9, 0xfdf3, 0x0960, 0xfc46, 
-	0xfdf4, 0x0a7c, 0xfd9c, 0xfdfc, 0x09b3, 0xfd4f, 0xfdfb, 0x0909, 0xfcf4, 0xfe18, 0x0922, 0xfd40, 0xfe16, 0x09ec, 0x0024, 0x000b, 
-	0x0002, 0x0001, 0xfdf3, 0x0bc8, 0x014f, 0x0000, 0x001e, 0x0021, 0x001b, 0x001e, 0x001b, 0x0018, 0x0015, 0x0018, 0x0012, 0x0015, 
-	0x000f, 0x0012, 0x000f, 0x000c, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x0150, 0xfdf3, 0x0bdf, 0x0126, 
-	0xfdf3, 0x0b75, 0x00cd, 0xfdf3, 0x0c07, 0x00b4, 0xfdf3, 0x0b98, 0x003d, 0xfdf3, 0x0baa, 0x0045, 0xfdf3, 0x0c1c, 0xffbd, 0xfdf3, 
-	0x0c1c, 0xffc6, 0xfdf3, 0x0baa, 0xff4f, 0xfdf3, 0x0b99, 0xff36, 0xfdf3, 0x0c08, 0xfeb3, 0xfdf3, 0x0be1, 0xfedc, 0xfdf3, 0x0b76, 
-	0x0018, 0x0007, 0x0002, 0x015a, 0xfdf3, 0x06f8, 0x010b, 0x0000, 0x000f, 0x0015, 0x0015, 0x0006, 0x0012, 0x000c, 0x0003, 0x000f, 
-	0x000c, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0x0168, 0xfdf3, 0x0647, 0x0202, 0xfdf3, 0x065a, 0x021c, 0xfdf3, 0x076c, 0x01d9, 
-	0xfdf3, 0x07aa, 0x00c5, 0xfdf3, 0x0672, 0x0256, 0xfdf3, 0x069d, 0x005e, 0xfdf3, 0x06c3, 0x0252, 0xfdf3, 0x0708, 0x0018, 0x0007, 
-	0x0002, 0xfea6, 0xfdf3, 0x06f8, 0x010b, 0x0000, 0x000f, 0x0015, 0x0015, 0x0006, 0x0012, 0x000c, 0x0003, 0x000f, 0x000c, 0x0000, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0xfe98, 0xfdf3, 0x0647, 0xfdfe, 0xfdf3, 0x065a, 0xfde4, 0xfdf3, 0x076c, 0xfe27, 0xfdf3, 0x07aa, 
-	0xff3b, 0xfdf3, 0x0672, 0xfdaa, 0xfdf3, 0x069d, 0xffa2, 0xfdf3, 0x06c3, 0xfdae, 0xfdf3, 0x0708, 0x0024, 0x0014, 0x0003, 0xf8ce, 
-	0x004c, 0xffd6, 0x0003, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x0015, 0x0018, 0x001b, 0x0012, 
-	0x000f, 0x0015, 0x001e, 0x001e, 0x0012, 0x001b, 0x0000, 0x0021, 0x0003, 0x0009, 0x0018, 0x000c, 0x000c, 0x0018, 0x0012, 0x0018, 
-	0x0009, 0x001b, 0x000f, 0x000c, 0x0015, 0x001e, 0x0015, 0x0012, 0x0006, 0x0009, 0x0000, 0x001b, 0x0003, 0x001e, 0x000f, 0x0000, 
-	0x0009, 0x001e, 0x0021, 0x000f, 0x0006, 0x001b, 0x0009, 0x001b, 0x0006, 0x0003, 0x000f, 0x0021, 0x0000, 0x001e, 0x0003, 0x0021, 
-	0xf8cd, 0x004f, 0xffd8, 0xf8cd, 0x0049, 0xffd4, 0xf8cd, 0x0049, 0xffd8, 0xf8ce, 0x004f, 0xffd8, 0xf8ce, 0x004f, 0xffd4, 0xf8ce, 
-	0x004f, 0xffd4, 0xf8ce, 0x0049, 0xffd8, 0xf8ce, 0x0049, 0xffd4, 0xf8ce, 0x004f, 0xffd8, 0xf8ce, 0x0049, 0xffd8, 0xf8ce, 0x0049, 
-	0xffd4, 0xf8cd, 0x004f, 0xffd4, 0x0024, 0x000a, 0x0003, 0xfdc2, 0xfe09, 0x047f, 0x0121, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 
-	0x000c, 0x000f, 0x0006, 0x0012, 0x0015, 0x0018, 0x001b, 0x0009, 0x0015, 0x001e, 0x0018, 0x0000, 0x0021, 0x0003, 0x0009, 0x001b, 
-	0x000c, 0x0006, 0x0003, 0x0012, 0x0018, 0x001e, 0x001b, 0x0015, 0x0012, 0x001e, 0xfed7, 0xfdf3, 0x0431, 0xfe95, 0xfe1f, 0x0441, 
-	0xfe95, 0xfdf3, 0x0441, 0xfd66, 0xfdf3, 0x04cd, 0xfcac, 0xfe1f, 0x04cd, 0xfcac, 0xfdf3, 0x04cd, 0xfe21, 0xfe1f, 0x046b, 0xfe21, 
-	0xfdf3, 0x046b, 0xfdb2, 0xfdf3, 0x049f, 0xfd66, 0xfe1f, 0x04cd, 0xfdb2, 0xfe1f, 0x049f, 0xfed7, 0xfe1f, 0x0431, 0x0024, 0x000a, 
-	0x0003, 0x023e, 0xfe09, 0x047f, 0x0121, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0003, 0x0012, 0x0015, 0x0018, 
-	0x0009, 0x001b, 0x0012, 0x0018, 0x001e, 0x0000, 0x0006, 0x0021, 0x0009, 0x000f, 0x001b, 0x0003, 0x0015, 0x0006, 0x0018, 0x001b, 
-	0x001e, 0x0012, 0x001e, 0x0015, 0x0129, 0xfdf3, 0x0431, 0x016b, 0xfdf3, 0x0441, 0x016b, 0xfe1f, 0x0441, 0x029a, 0xfdf3, 0x04cd, 
-	0x0354, 0xfdf3, 0x04cd, 0x0354, 0xfe1f, 0x04cd, 0x01df, 0xfdf3, 0x046b, 0x01df, 0xfe1f, 0x046b, 0x024e, 0xfdf3, 0x049f, 0x029a, 
-	0xfe1f, 0x04cd, 0x024e, 0xfe1f, 0x049f, 0x0129, 0xfe1f, 0x0431, 0x002a, 0x000c, 0x0003, 0x04a5, 0xfe08, 0x0b91, 0x0141, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0006, 0x000c, 0x0012, 0x000f, 0x0015, 0x0009, 0x0018, 0x001b, 0x001e, 0x001b, 
-	0x0021, 0x001e, 0x0000, 0x0024, 0x0003, 0x0009, 0x0012, 0x000c, 0x0006, 0x0003, 0x000c, 0x0000, 0x0018, 0x0024, 0x0018, 0x001e, 
-	0x0024, 0x0015, 0x0027, 0x0009, 0x03c8, 0xfdf2, 0x0c0b, 0x0411, 0xfe1e, 0x0ba8, 0x0411, 0xfdf2, 0x0ba8, 0x0485, 0xfdf3, 0x0acf, 
-	0x0450, 0xfe1e, 0x0b3f, 0x0485, 0xfe1e, 0x0acf, 0x0450, 0xfdf2, 0x0b3f, 0x05a5, 0xfe1e, 0x0acf, 0x03a6, 0xfdf2, 0x0c37, 0x03a6, 
-	0xfdf2, 0x0c54, 0x03a6, 0xfe1e, 0x0c37, 0x03a6, 0xfe1e, 0x0c54, 0x03c8, 0xfe1e, 0x0c0b, 0x05a5, 0xfdf3, 0x0acf, 0x002a, 0x000c, 
-	0x0003, 0xfb5b, 0xfe08, 0x0b91, 0x0141, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0003, 0x0012, 0x000f, 0x000c, 
-	0x0009, 0x0015, 0x0018, 0x001b, 0x001e, 0x001e, 0x001b, 0x0021, 0x0000, 0x0006, 0x0024, 0x0009, 0x000f, 0x0012, 0x0003, 0x000f, 
-	0x0006, 0x0000, 0x0024, 0x0018, 0x0018, 0x0024, 0x001b, 0x0015, 0x0009, 0x0027, 0xfc38, 0xfdf2, 0x0c0b, 0xfbef, 0xfdf2, 0x0ba8, 
-	0xfbef, 0xfe1e, 0x0ba8, 0xfb7b, 0xfdf3, 0x0acf, 0xfb7b, 0xfe1e, 0x0acf, 0xfbb0, 0xfe1e, 0x0b3f, 0xfbb0, 0xfdf2, 0x0b3f, 0xfa5b, 
-	0xfe1e, 0x0acf, 0xfc5a, 0xfdf2, 0x0c37, 0xfc5a, 0xfe1e, 0x0c37, 0xfc5a, 0xfdf2, 0x0c54, 0xfc5a, 0xfe1e, 0x0c54, 0xfc38, 0xfe1e, 
-	0x0c0b, 0xfa5b, 0xfdf3, 0x0acf, 0x000c, 0x0002, 0x0003, 0x0000, 0x021e, 0x092b, 0x019d, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 
-	0x0009, 0x0003, 0xfedc, 0x021e, 0x0a50, 0x0124, 0x021e, 0x0806, 0xfedc, 0x021e, 0x0806, 0x0124, 0x021e, 0x0a50, 0x0018, 0x0008, 
-	0x0003, 0x0000, 0x034a, 0x092a, 0x00dd, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0009, 0x0006, 0x0012, 0x0015, 
-	0x000c, 0x0003, 0x0000, 0x0015, 0x0003, 0x0009, 0x0012, 0x000c, 0x0009, 0x0000, 0x0006, 0x0015, 0x000f, 0x000c, 0xffda, 0x0270, 
-	0x0927, 0x0003, 0x0424, 0x0951, 0xffda, 0x0424, 0x0927, 0xfffd, 0x0270, 0x0904, 0x0026, 0x0424, 0x092e, 0x0026, 0x0270, 0x092e, 
-	0xfffd, 0x0424, 0x0904, 0x0003, 0x0270, 0x0951, 0x0036, 0x0012, 0x0002, 0x0000, 0x024c, 0x092b, 0x0080, 0x0000, 0x0033, 0x0030, 
-	0x002d, 0x0024, 0x0021, 0x001e, 0x001b, 0x0012, 0x000f, 0x000c, 0x0009, 0x0000, 0x0027, 0x0033, 0x0030, 0x002a, 0x002a, 0x002d, 
-	0x0024, 0x0027, 0x0015, 0x0021, 0x001e, 0x0018, 0x0018, 0x001b, 0x0012, 0x0015, 0x0003, 0x000f, 0x000c, 0x0006, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xff8a, 0x0237, 0x092b, 0xffbc, 0x0237, 0x08c0, 0x0044, 0x0237, 0x0996, 0xffbc, 0x0237, 0x0996, 0x0076, 0x0237, 
-	0x092b, 0x0044, 0x0237, 0x08c0, 0xffa8, 0x024b, 0x092b, 0xffcd, 0x024b, 0x08db, 0x0033, 0x024b, 0x097a, 0xffcd, 0x024b, 0x097a, 
-	0x0058, 0x024b, 0x092b, 0x0033, 0x024b, 0x08db, 0xffc4, 0x0261, 0x092b, 0xffde, 0x0261, 0x08f5, 0x0022, 0x0261, 0x0961, 0xffde, 
-	0x0261, 0x0961, 0x003c, 0x0261, 0x092b, 0x0022, 0x0261, 0x08f5, 0x0012, 0x0006, 0x0002, 0x0096, 0x023a, 0x09cf, 0x0034, 0x0000, 
-	0x000c, 0x000f, 0x0003, 0x0006, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0081, 0x023a, 0x09a2, 0x00ac, 
-	0x023a, 0x09a2, 0x00ca, 0x023a, 0x09cf, 0x00ac, 0x023a, 0x09fc, 0x0081, 0x023a, 0x09fc, 0x0063, 0x023a, 0x09cf, 0x000c, 0x0002, 
-	0x0003, 0xfa2c, 0x020c, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfb1c, 0x020c, 0x087b, 0xf93c, 
-	0x020c, 0x09da, 0xfb1c, 0x020c, 0x09da, 0xf93c, 0x020c, 0x087b, 0x000c, 0x0002, 0x0003, 0xfc0c, 0x020c, 0x092a, 0x0129, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfcfc, 0x020c, 0x087b, 0xfb1c, 0x020c, 0x09da, 0xfcfc, 0x020c, 0x09da, 0xfb1c, 
-	0x020c, 0x087b, 0x000c, 0x0002, 0x0003, 0xfdec, 0x020c, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 
-	0xfedc, 0x020c, 0x087b, 0xfcfc, 0x020c, 0x09da, 0xfedc, 0x020c, 0x09da, 0xfcfc, 0x020c, 0x087b, 0x000c, 0x0002, 0x0003, 0x0214, 
-	0x020c, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0124, 0x020c, 0x087b, 0x0124, 0x020c, 0x09da, 
-	0x0304, 0x020c, 0x09da, 0x0304, 0x020c, 0x087b, 0x000c, 0x0002, 0x0003, 0x03f4, 0x020c, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0000, 0x0006, 0x0009, 0x0304, 0x020c, 0x087b, 0x0304, 0x020c, 0x09da, 0x04e4, 0x020c, 0x09da, 0x04e4, 0x020c, 0x087b, 
-	0x000c, 0x0002, 0x0003, 0x05d4, 0x020c, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x04e4, 0x020c, 
-	0x087b, 0x04e4, 0x020c, 0x09da, 0x06c4, 0x020c, 0x09da, 0x06c4, 0x020c, 0x087b, 0x000c, 0x0004, 0x0002, 0x02ad, 0xfe03, 0x0c89, 
-	0x0056, 0x0000, 0x0000, 0x0006, 0x0009, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003, 0x02c9, 0xfe03, 0x0cdb, 0x026d, 0xfe03, 0x0c50, 
-	0x02ed, 0xfe03, 0x0cc3, 0x0292, 0xfe03, 0x0c38, 0x000c, 0x0004, 0x0002, 0x0289, 0xfe13, 0x0ca1, 0x0056, 0x0000, 0x0009, 0x0006, 
-	0x0009, 0x0000, 0x0006, 0x0003, 0x0000, 0x0003, 0x026d, 0xfe13, 0x0c50, 0x0249, 0xfe13, 0x0c68, 0x02a4, 0xfe13, 0x0cf3, 0x02c9, 
-	0xfe13, 0x0cdb, 0x000c, 0x0004, 0x0002, 0xfd77, 0xfe13, 0x0ca1, 0x0056, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003, 
-	0x0000, 0x0003, 0xfd93, 0xfe13, 0x0c50, 0xfdb7, 0xfe13, 0x0c68, 0xfd5c, 0xfe13, 0x0cf3, 0xfd37, 0xfe13, 0x0cdb, 0x000c, 0x0004, 
-	0x0002, 0xfd53, 0xfe03, 0x0c89, 0x0056, 0x0000, 0x0000, 0x0006, 0x0009, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd37, 0xfe03, 
-	0x0cdb, 0xfd93, 0xfe03, 0x0c50, 0xfd13, 0xfe03, 0x0cc3, 0xfd6e, 0xfe03, 0x0c38, 0x000c, 0x0002, 0x0003, 0xfb35, 0xffe1, 0xfd17, 
-	0x00b7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfbb0, 0xffc2, 0xfd6e, 0xfb9a, 0x0000, 0xfc93, 0xfad3, 0xffc2, 
-	0xfd9a, 0xfab9, 0x0000, 0xfc93, 0x000c, 0x0002, 0x0003, 0xfb62, 0xffa3, 0xfe03, 0x00b4, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 
-	0x0009, 0x0003, 0xfbb0, 0xffc2, 0xfd6e, 0xfb20, 0xff83, 0xfe98, 0xfbf0, 0xff83, 0xfe42, 0xfad3, 0xffc2, 0xfd9a, 0x000c, 0x0002, 
-	0x0003, 0xfbbc, 0xff64, 0xfee2, 0x00af, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfbf0, 0xff83, 0xfe42, 0xfb9c, 
-	0xff44, 0xff82, 0xfc58, 0xff44, 0xff05, 0xfb20, 0xff83, 0xfe98, 0x000c, 0x0002, 0x0003, 0xfc40, 0xff1f, 0xffaa, 0x00ac, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfb9c, 0xff44, 0xff82, 0xfc45, 0xfef9, 0x004e, 0xfc58, 0xff44, 0xff05, 0xfce4, 
-	0xfef9, 0xffaf, 0x000c, 0x0002, 0x0003, 0x03c0, 0xff1f, 0xffaa, 0x00ac, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 
-	0x0464, 0xff44, 0xff82, 0x03a8, 0xff44, 0xff05, 0x03bb, 0xfef9, 0x004e, 0x031c, 0xfef9, 0xffaf, 0x000c, 0x0002, 0x0003, 0x0444, 
-	0xff64, 0xfee2, 0x00af, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0464, 0xff44, 0xff82, 0x0410, 0xff83, 0xfe42, 
-	0x03a8, 0xff44, 0xff05, 0x04e0, 0xff83, 0xfe98, 0x000c, 0x0002, 0x0003, 0x049e, 0xffa3, 0xfe03, 0x00b4, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0003, 0x0009, 0x0006, 0x0410, 0xff83, 0xfe42, 0x04e0, 0xff83, 0xfe98, 0x0450, 0xffc2, 0xfd6e, 0x052d, 0xffc2, 0xfd9a, 
-	0x000c, 0x0002, 0x0003, 0x04cb, 0xffe1, 0xfd17, 0x00b7, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0547, 0x0000, 
-	0xfc93, 0x0466, 0x0000, 0xfc93, 0x052d, 0xffc2, 0xfd9a, 0x0450, 0xffc2, 0xfd6e, 0x001e, 0x0008, 0x0003, 0xfb92, 0xffa1, 0xfe9b, 
-	0x0216, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x000f, 0x0012, 0x0009, 0x0015, 0x0018, 0x0012, 0x0000, 0x000c, 
-	0x0003, 0x0009, 0x0003, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x001b, 0x0018, 0xfabe, 0x0009, 0xfcc7, 0xfad3, 0x0002, 0xfd9a, 
-	0xfabe, 0x0035, 0xfcc7, 0xfb20, 0xffc4, 0xfe98, 0xfad3, 0xffd7, 0xfd9a, 0xfb20, 0xff98, 0xfe98, 0xfb9c, 0xff85, 0xff82, 0xfb9c, 
-	0xff59, 0xff82, 0xfc66, 0xff39, 0x006f, 0xfc66, 0xff0d, 0x006f, 0x001e, 0x0008, 0x0003, 0x046e, 0xffa1, 0xfe9b, 0x0216, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0009, 0x0003, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0012, 0x0015, 0x0000, 0x0018, 0x0003, 0x0009, 
-	0x0006, 0x0003, 0x000c, 0x001b, 0x000f, 0x000f, 0x001b, 0x0012, 0x0542, 0x0009, 0xfcc7, 0x052d, 0x0002, 0xfd9a, 0x052d, 0xffd7, 
-	0xfd9a, 0x04e0, 0xff98, 0xfe98, 0x04e0, 0xffc4, 0xfe98, 0x0464, 0xff59, 0xff82, 0x039a, 0xff39, 0x006f, 0x039a, 0xff0d, 0x006f, 
-	0x0542, 0x0035, 0xfcc7, 0x0464, 0xff85, 0xff82, 0x0012, 0x0004, 0x0003, 0xfc48, 0xfe76, 0x03a0, 0x0132, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0003, 0x0009, 0x0006, 0x0000, 0x000c, 0x0003, 0x0003, 0x000f, 0x0009, 0xfbe4, 0xfdf2, 0x04a2, 0xfcaa, 0xfef9, 0x02c1, 
-	0xfbe4, 0xfef9, 0x02c1, 0xfbe4, 0xfef9, 0x029e, 0xfcab, 0xfdf2, 0x04a2, 0xfcaa, 0xfef9, 0x029e, 0x0012, 0x0004, 0x0003, 0x03b8, 
-	0xfe76, 0x03a0, 0x0132, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x000c, 0x0000, 0x000f, 0x0003, 0x0000, 0x0006, 0x0009, 
-	0x0356, 0xfef9, 0x02c1, 0x041c, 0xfdf2, 0x04a2, 0x041c, 0xfef9, 0x02c1, 0x041c, 0xfef9, 0x029e, 0x0356, 0xfef9, 0x029e, 0x0355, 
-	0xfdf2, 0x04a2, 0x0144, 0x00cc, 0x0002, 0xfc47, 0xfe8b, 0x03b4, 0x014c, 0x0000, 0x000f, 0x0000, 0x0132, 0x0135, 0x013e, 0x0141, 
-	0x0141, 0x0114, 0x0123, 0x012c, 0x0141, 0x0132, 0x0135, 0x013e, 0x0117, 0x0138, 0x0129, 0x013e, 0x012f, 0x0120, 0x0126, 0x013b, 
-	0x013b, 0x0138, 0x012f, 0x013b, 0x0138, 0x012c, 0x0135, 0x010e, 0x0111, 0x0132, 0x012c, 0x012f, 0x00f3, 0x0102, 0x0126, 0x0117, 
-	0x0102, 0x0126, 0x00f3, 0x0117, 0x0120, 0x0126, 0x0123, 0x0117, 0x00fc, 0x0102, 0x00ff, 0x00f3, 0x0105, 0x00ea, 0x010e, 0x0129, 
-	0x0105, 0x0129, 0x00ea, 0x010e, 0x0114, 0x0129, 0x010b, 0x010e, 0x00f0, 0x0105, 0x00e7, 0x00ea, 0x010b, 0x00e7, 0x00e4, 0x0108, 
-	0x0114, 0x00f0, 0x00ed, 0x0111, 0x0123, 0x00ff, 0x00fc, 0x0120, 0x011a, 0x00f6, 0x00f9, 0x011d, 0x0129, 0x011d, 0x011d, 0x011a, 
-	0x0126, 0x011a, 0x0120, 0x0123, 0x010b, 0x011d, 0x011a, 0x0108, 0x0117, 0x0108, 0x0111, 0x0114, 0x010e, 0x0111, 0x0108, 0x010b, 
-	0x0105, 0x00f9, 0x00f9, 0x00f6, 0x0102, 0x00f6, 0x00fc, 0x00ff, 0x00e7, 0x00f9, 0x00f6, 0x00e4, 0x00f3, 0x00e4, 0x00ed, 0x00f0, 
-	0x00ea, 0x00ed, 0x00e4, 0x00e7, 0x00d5, 0x00d2, 0x00e1, 0x00de, 0x00e1, 0x00b4, 0x00c3, 0x00cf, 0x00d2, 0x00e1, 0x00d5, 0x00de, 
-	0x00b7, 0x00d8, 0x00c9, 0x00de, 0x00cc, 0x00c0, 0x00c6, 0x00db, 0x00db, 0x00d8, 0x00cc, 0x00db, 0x00cf, 0x00d8, 0x00d5, 0x00ae, 
-	0x00b1, 0x00d2, 0x00cc, 0x00cf, 0x0093, 0x00a2, 0x00c6, 0x00b7, 0x00a2, 0x00c6, 0x0093, 0x00b7, 0x00c0, 0x00c6, 0x00c3, 0x00b7, 
-	0x009c, 0x00a2, 0x009f, 0x0093, 0x00a5, 0x008a, 0x00ae, 0x00c9, 0x00a5, 0x00c9, 0x008a, 0x00ae, 0x00b4, 0x00c9, 0x00ab, 0x00ae, 
-	0x0090, 0x00a5, 0x0087, 0x008a, 0x00ab, 0x0087, 0x0084, 0x00a8, 0x00b4, 0x0090, 0x008d, 0x00b1, 0x00c3, 0x009f, 0x009c, 0x00c0, 
-	0x00ba, 0x0096, 0x0099, 0x00bd, 0x00c9, 0x00bd, 0x00bd, 0x00ba, 0x00c6, 0x00ba, 0x00c0, 0x00c3, 0x00ab, 0x00bd, 0x00ba, 0x00a8, 
-	0x00b7, 0x00a8, 0x00b1, 0x00b4, 0x00ae, 0x00b1, 0x00a8, 0x00ab, 0x00a5, 0x0099, 0x0099, 0x0096, 0x00a2, 0x0096, 0x009c, 0x009f, 
-	0x0087, 0x0099, 0x0096, 0x0084, 0x0093, 0x0084, 0x008d, 0x0090, 0x008a, 0x008d, 0x0084, 0x0087, 0x0006, 0x000c, 0x0018, 0x0003, 
-	0x0021, 0x0009, 0x002a, 0x0030, 0x0030, 0x0027, 0x0027, 0x0024, 0x0024, 0x002a, 0x001b, 0x0030, 0x0015, 0x002a, 0x0039, 0x0027, 
-	0x0036, 0x0024, 0x0081, 0x0039, 0x004b, 0x007e, 0x007e, 0x0081, 0x007b, 0x0048, 0x003c, 0x0072, 0x0075, 0x003f, 0x0033, 0x0078, 
-	0x0078, 0x007b, 0x006f, 0x0075, 0x0072, 0x006c, 0x006c, 0x0036, 0x002d, 0x006f, 0x0081, 0x006c, 0x007e, 0x0072, 0x0078, 0x0081, 
-	0x007b, 0x007e, 0x0075, 0x007b, 0x006f, 0x0078, 0x0072, 0x0075, 0x006c, 0x006f, 0x0063, 0x004e, 0x0003, 0x0060, 0x0060, 0x0063, 
-	0x0000, 0x0054, 0x0069, 0x0021, 0x0006, 0x0057, 0x005a, 0x0045, 0x0054, 0x005a, 0x0051, 0x0066, 0x005d, 0x0042, 0x0066, 0x0069, 
-	0x0057, 0x005d, 0x0057, 0x0069, 0x005d, 0x0066, 0x0069, 0x0060, 0x0066, 0x0063, 0x0063, 0x005a, 0x0060, 0x0054, 0x005a, 0x005d, 
-	0x0054, 0x0057, 0x004e, 0x004b, 0x0045, 0x003c, 0x0048, 0x0051, 0x0042, 0x003f, 0x0051, 0x0042, 0x003f, 0x0048, 0x004b, 0x003c, 
-	0x0045, 0x004e, 0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045, 0x003c, 0x003f, 0x002d, 0x0033, 0x0033, 0x0039, 0x0039, 0x0036, 
-	0x0036, 0x002d, 0x0030, 0x0033, 0x002a, 0x002d, 0x0027, 0x001e, 0x0024, 0x0012, 0x0021, 0x0006, 0x0003, 0x0021, 0x001e, 0x001b, 
-	0x0012, 0x001e, 0x0015, 0x001b, 0x0009, 0x0018, 0x000f, 0x0018, 0x0012, 0x0015, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0000, 
-	0x0000, 0x0003, 0xfbec, 0xfe02, 0x04cb, 0xfbec, 0xfe04, 0x04c7, 0xfbe7, 0xfe02, 0x04cb, 0xfbe7, 0xfdf1, 0x04bf, 0xfbe7, 0xfdf1, 
-	0x04c4, 0xfbec, 0xfdf1, 0x04c4, 0xfbec, 0xfef8, 0x02a8, 0xfbe7, 0xfef8, 0x02a8, 0xfbec, 0xfdf1, 0x04bf, 0xfbe7, 0xfef8, 0x02ad, 
-	0xfbec, 0xfef8, 0x02ad, 0xfbe7, 0xfe04, 0x04c7, 0xfbec, 0xff0b, 0x029e, 0xfbec, 0xff0c, 0x02a2, 0xfbe7, 0xff0b, 0x029e, 0xfbe7, 
-	0xff09, 0x029e, 0xfbe7, 0xff0c, 0x02a2, 0xfbe7, 0xff0c, 0x02a2, 0xfbec, 0xff09, 0x029e, 0xfbec, 0xff0c, 0x02a2, 0xfbec, 0xff24, 
-	0x02bd, 0xfbe7, 0xff24, 0x02bd, 0xfbe7, 0xfe1b, 0x04a5, 0xfbec, 0xfe1b, 0x04a5, 0xfbe7, 0xff1f, 0x02bd, 0xfbec, 0xff1f, 0x02bd, 
-	0xfbec, 0xfe16, 0x04a5, 0xfbe7, 0xfe16, 0x04a5, 0xfbec, 0xfe12, 0x04c9, 0xfbe7, 0xfe12, 0x04c9, 0xfbec, 0xfe1b, 0x04c0, 0xfbe7, 
-	0xfe1b, 0x04c0, 0xfbec, 0xfe11, 0x04c5, 0xfbec, 0xfe16, 0x04be, 0xfbe7, 0xfe16, 0x04be, 0xfbe7, 0xfe11, 0x04c5, 0xfbec, 0xff19, 
-	0x029e, 0xfbe7, 0xff19, 0x029e, 0xfbec, 0xff20, 0x02a2, 0xfbe7, 0xff20, 0x02a2, 0xfbe7, 0xff16, 0x02a2, 0xfbe7, 0xff1c, 0x02a4, 
-	0xfbec, 0xff1c, 0x02a4, 0xfbec, 0xff16, 0x02a2, 0xfca7, 0xff24, 0x02c1, 0xfca7, 0xfe1b, 0x04a2, 0xfca7, 0xfe1b, 0x04c7, 0xfca7, 
-	0xfe1b, 0x04cb, 0xfca3, 0xfe1b, 0x04cb, 0xfca7, 0xff22, 0x02a2, 0xfca3, 0xff24, 0x02c1, 0xfca3, 0xfe1b, 0x04a2, 0xfca3, 0xff22, 
-	0x029e, 0xfca7, 0xff22, 0x029e, 0xfca3, 0xff22, 0x02a2, 0xfca3, 0xfe1b, 0x04c7, 0xfca7, 0xff1f, 0x02c1, 0xfca7, 0xfe16, 0x04a2, 
-	0xfca7, 0xfe16, 0x04c7, 0xfca7, 0xfe16, 0x04cb, 0xfca3, 0xfe16, 0x04cb, 0xfca7, 0xff1e, 0x02a2, 0xfca3, 0xff1f, 0x02c1, 0xfca3, 
-	0xfe16, 0x04a2, 0xfca3, 0xff1e, 0x029e, 0xfca7, 0xff1e, 0x029e, 0xfca3, 0xff1e, 0x02a2, 0xfca3, 0xfe16, 0x04c7, 0xfca3, 0xfef8, 
-	0x029e, 0xfca7, 0xfef8, 0x029e, 0xfca7, 0xfdf2, 0x04cb, 0xfca7, 0xfdf2, 0x04c7, 0xfca7, 0xfef8, 0x02a2, 0xfca3, 0xfef8, 0x02a2, 
-	0xfca3, 0xfdf2, 0x04c7, 0xfca3, 0xfdf2, 0x04cb, 0xfc39, 0xff24, 0x02c1, 0xfc39, 0xfe1b, 0x04a2, 0xfc39, 0xfe1b, 0x04c7, 0xfc39, 
-	0xfe1b, 0x04cb, 0xfc35, 0xfe1b, 0x04cb, 0xfc39, 0xff22, 0x02a2, 0xfc35, 0xff24, 0x02c1, 0xfc35, 0xfe1b, 0x04a2, 0xfc35, 0xff22, 
-	0x029e, 0xfc39, 0xff22, 0x029e, 0xfc35, 0xff22, 0x02a2, 0xfc35, 0xfe1b, 0x04c7, 0xfc39, 0xff1f, 0x02c1, 0xfc39, 0xfe16, 0x04a2, 
-	0xfc39, 0xfe16, 0x04c7, 0xfc39, 0xfe16, 0x04cb, 0xfc35, 0xfe16, 0x04cb, 0xfc39, 0xff1e, 0x02a2, 0xfc35, 0xff1f, 0x02c1, 0xfc35, 
-	0xfe16, 0x04a2, 0xfc35, 0xff1e, 0x029e, 0xfc39, 0xff1e, 0x029e, 0xfc35, 0xff1e, 0x02a2, 0xfc35, 0xfe16, 0x04c7, 0xfc39, 0xfef8, 
-	0x029e, 0xfc35, 0xfef8, 0x029e, 0xfc39, 0xfdf2, 0x04cb, 0xfc39, 0xfdf2, 0x04c7, 0xfc39, 0xfef8, 0x02a2, 0xfc35, 0xfef8, 0x02a2, 
-	0xfc35, 0xfdf2, 0x04c7, 0xfc35, 0xfdf2, 0x04cb, 0x003c, 0x002a, 0x0002, 0x032a, 0x00c9, 0xfde3, 0x00b4, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x0302, 0x00e7, 0xfe5f, 0x032b, 0x00ae, 0xfde3, 0x0394, 0x00e7, 0xfe30, 0x0394, 0x00e7, 0xfd96, 0x02a8, 0x00e7, 
-	0xfde3, 0x0302, 0x00e7, 0xfd66, 0x03ad, 0x0144, 0xfde3, 0x0353, 0x0144, 0xfe5f, 0x02c1, 0x0144, 0xfe30, 0x02c1, 0x0144, 0xfd96, 
-	0x0353, 0x0144, 0xfd66, 0x032b, 0x017d, 0xfde3, 0x0325, 0x0016, 0xfddd, 0x0325, 0x0016, 0xfde8, 0x0325, 0x00c8, 0xfde8, 0x0325, 
-	0x00c8, 0xfddd, 0x0330, 0x0016, 0xfddd, 0x0330, 0x00c8, 0xfddd, 0x0330, 0x0016, 0xfde8, 0x0330, 0x00c8, 0xfde8, 0x003c, 0x002a, 
-	0x0002, 0x026c, 0x00c9, 0xff00, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x0244, 0x00e7, 0xff7c, 0x026c, 0x00ae, 0xfeff, 
-	0x02d6, 0x00e7, 0xff4c, 0x02d6, 0x00e7, 0xfeb2, 0x01e9, 0x00e7, 0xfeff, 0x0244, 0x00e7, 0xfe83, 0x02ef, 0x0144, 0xfeff, 0x0295, 
-	0x0144, 0xff7c, 0x0202, 0x0144, 0xff4c, 0x0202, 0x0144, 0xfeb2, 0x0295, 0x0144, 0xfe83, 0x026c, 0x017d, 0xfeff, 0x0267, 0x0016, 
-	0xfefa, 0x0267, 0x0016, 0xff05, 0x0267, 0x00c8, 0xff05, 0x0267, 0x00c8, 0xfefa, 0x0272, 0x0016, 0xfefa, 0x0272, 0x00c8, 0xfefa, 
-	0x0272, 0x0016, 0xff05, 0x0272, 0x00c8, 0xff05, 0x003c, 0x002a, 0x0002, 0x014f, 0x00c9, 0xffbd, 0x00b4, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x0127, 0x00e7, 0x0039, 0x014f, 0x00ae, 0xffbe, 0x01b9, 0x00e7, 0x000a, 0x01b9, 0x00e7, 0xff71, 0x00cc, 0x00e7, 
-	0xffbe, 0x0127, 0x00e7, 0xff41, 0x01d2, 0x0144, 0xffbe, 0x0178, 0x0144, 0x0039, 0x00e5, 0x0144, 0x000a, 0x00e5, 0x0144, 0xff71, 
-	0x0178, 0x0144, 0xff41, 0x014f, 0x017d, 0xffbe, 0x014a, 0x0016, 0xffb8, 0x014a, 0x0016, 0xffc3, 0x014a, 0x00c8, 0xffc3, 0x014a, 
-	0x00c8, 0xffb8, 0x0155, 0x0016, 0xffb8, 0x0155, 0x00c8, 0xffb8, 0x0155, 0x0016, 0xffc3, 0x0155, 0x00c8, 0xffc3, 0x003c, 0x002a, 
-	0x0002, 0xfeb1, 0x00c9, 0xffbd, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfe88, 0x00e7, 0x0039, 0xfeb1, 0x00ae, 0xffbe, 
-	0xff1b, 0x00e7, 0x000a, 0xff1b, 0x00e7, 0xff71, 0xfe2e, 0x00e7, 0xffbe, 0xfe88, 0x00e7, 0xff41, 0xff34, 0x0144, 0xffbe, 0xfed9, 
-	0x0144, 0x0039, 0xfe47, 0x0144, 0x000a, 0xfe47, 0x0144, 0xff71, 0xfed9, 0x0144, 0xff41, 0xfeb1, 0x017d, 0xffbe, 0xfeab, 0x0016, 
-	0xffb8, 0xfeab, 0x0016, 0xffc3, 0xfeab, 0x00c8, 0xffc3, 0xfeab, 0x00c8, 0xffb8, 0xfeb6, 0x0016, 0xffb8, 0xfeb6, 0x00c8, 0xffb8, 
-	0xfeb6, 0x0016, 0xffc3, 0xfeb6, 0x00c8, 0xffc3, 0x003c, 0x002a, 0x0002, 0xfd94, 0x00c9, 0xff00, 0x00b4, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0xfd6b, 0x00e7, 0xff7c, 0xfd94, 0x00ae, 0xfeff, 0xfdfe, 0x00e7, 0xff4c, 0xfdfe, 0x00e7, 0xfeb2, 0xfd11, 0x00e7, 
-	0xfeff, 0xfd6b, 0x00e7, 0xfe83, 0xfe17, 0x0144, 0xfeff, 0xfdbc, 0x0144, 0xff7c, 0xfd2a, 0x0144, 0xff4c, 0xfd2a, 0x0144, 0xfeb2, 
-	0xfdbc, 0x0144, 0xfe83, 0xfd94, 0x017d, 0xfeff, 0xfd8e, 0x0016, 0xfefa, 0xfd8e, 0x0016, 0xff05, 0xfd8e, 0x00c8, 0xff05, 0xfd8e, 
-	0x00c8, 0xfefa, 0xfd99, 0x0016, 0xfefa, 0xfd99, 0x00c8, 0xfefa, 0xfd99, 0x0016, 0xff05, 0xfd99, 0x00c8, 0xff05, 0x003c, 0x002a, 
-	0x0002, 0xfcd6, 0x00c9, 0xfde3, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfcad, 0x00e7, 0xfe5f, 0xfcd5, 0x00ae, 0xfde3, 
-	0xfd3f, 0x00e7, 0xfe30, 0xfd3f, 0x00e7, 0xfd96, 0xfc53, 0x00e7, 0xfde3, 0xfcad, 0x00e7, 0xfd66, 0xfd58, 0x0144, 0xfde3, 0xfcfe, 
-	0x0144, 0xfe5f, 0xfc6c, 0x0144, 0xfe30, 0xfc6c, 0x0144, 0xfd96, 0xfcfe, 0x0144, 0xfd66, 0xfcd5, 0x017d, 0xfde3, 0xfcd0, 0x0016, 
-	0xfddd, 0xfcd0, 0x0016, 0xfde8, 0xfcd0, 0x00c8, 0xfde8, 0xfcd0, 0x00c8, 0xfddd, 0xfcdb, 0x0016, 0xfddd, 0xfcdb, 0x00c8, 0xfddd, 
-	0xfcdb, 0x0016, 0xfde8, 0xfcdb, 0x00c8, 0xfde8, 0x003c, 0x002a, 0x0002, 0xfd26, 0xfeb4, 0x045b, 0x00b4, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0xfcfd, 0xfed1, 0x04d8, 0xfd25, 0xfe98, 0x045b, 0xfd8f, 0xfed1, 0x04a8, 0xfd8f, 0xfed1, 0x040e, 0xfca3, 0xfed1, 
-	0x045b, 0xfcfd, 0xfed1, 0x03df, 0xfda8, 0xff2e, 0x045b, 0xfd4e, 0xff2e, 0x04d8, 0xfcbc, 0xff2e, 0x04a8, 0xfcbc, 0xff2e, 0x040e, 
-	0xfd4e, 0xff2e, 0x03df, 0xfd25, 0xff67, 0x045b, 0xfd20, 0xfe00, 0x0456, 0xfd20, 0xfe00, 0x0461, 0xfd20, 0xfeb3, 0x0461, 0xfd20, 
-	0xfeb3, 0x0456, 0xfd2b, 0xfe00, 0x0456, 0xfd2b, 0xfeb3, 0x0456, 0xfd2b, 0xfe00, 0x0461, 0xfd2b, 0xfeb3, 0x0461, 0x003c, 0x002a, 
-	0x0002, 0xfb7c, 0xfe91, 0x03c8, 0x0087, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfb5d, 0xfea7, 0x0426, 0xfb7b, 0xfe7c, 0x03c8, 
-	0xfbcb, 0xfea7, 0x0402, 0xfbcb, 0xfea7, 0x038e, 0xfb19, 0xfea7, 0x03c8, 0xfb5d, 0xfea7, 0x036b, 0xfbde, 0xfeec, 0x03c8, 0xfb9a, 
-	0xfeec, 0x0426, 0xfb2c, 0xfeec, 0x0402, 0xfb2c, 0xfeec, 0x038e, 0xfb9a, 0xfeec, 0x036b, 0xfb7b, 0xff17, 0x03c8, 0xfb77, 0xfe0a, 
-	0x03c4, 0xfb77, 0xfe0a, 0x03cc, 0xfb77, 0xfe90, 0x03cc, 0xfb77, 0xfe90, 0x03c4, 0xfb80, 0xfe0a, 0x03c4, 0xfb80, 0xfe90, 0x03c4, 
-	0xfb80, 0xfe0a, 0x03cc, 0xfb80, 0xfe90, 0x03cc, 0x003c, 0x002a, 0x0002, 0x02df, 0xfeb8, 0x045b, 0x00b4, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x02b7, 0xfed5, 0x04d8, 0x02df, 0xfe9c, 0x045b, 0x0349, 0xfed5, 0x04a8, 0x0349, 0xfed5, 0x040e, 0x025c, 0xfed5, 
-	0x045b, 0x02b7, 0xfed5, 0x03df, 0x0362, 0xff31, 0x045b, 0x0308, 0xff31, 0x04d8, 0x0275, 0xff31, 0x04a8, 0x0275, 0xff31, 0x040e, 
-	0x0308, 0xff31, 0x03df, 0x02df, 0xff6b, 0x045b, 0x02da, 0xfe04, 0x0456, 0x02da, 0xfe04, 0x0461, 0x02da, 0xfeb6, 0x0461, 0x02da, 
-	0xfeb6, 0x0456, 0x02e5, 0xfe04, 0x0456, 0x02e5, 0xfeb6, 0x0456, 0x02e5, 0xfe04, 0x0461, 0x02e5, 0xfeb6, 0x0461, 0x003c, 0x002a, 
-	0x0002, 0x0482, 0xfe91, 0x03c8, 0x0087, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x0464, 0xfea7, 0x0426, 0x0482, 0xfe7c, 0x03c8, 
-	0x04d2, 0xfea7, 0x0402, 0x04d2, 0xfea7, 0x038e, 0x0420, 0xfea7, 0x03c8, 0x0464, 0xfea7, 0x036b, 0x04e4, 0xfeec, 0x03c8, 0x04a0, 
-	0xfeec, 0x0426, 0x0433, 0xfeec, 0x0402, 0x0433, 0xfeec, 0x038e, 0x04a0, 0xfeec, 0x036b, 0x0482, 0xff17, 0x03c8, 0x047e, 0xfe0a, 
-	0x03c4, 0x047e, 0xfe0a, 0x03cc, 0x047e, 0xfe90, 0x03cc, 0x047e, 0xfe90, 0x03c4, 0x0486, 0xfe0a, 0x03c4, 0x0486, 0xfe90, 0x03c4, 
-	0x0486, 0xfe0a, 0x03cc, 0x0486, 0xfe90, 0x03cc, 0x003c, 0x002a, 0x0002, 0x04d6, 0xfedc, 0x0b55, 0x00d8, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x04a5, 0xfeff, 0x0beb, 0x04d6, 0xfeba, 0x0b56, 0x0555, 0xfeff, 0x0bb2, 0x0555, 0xfeff, 0x0af9, 0x0439, 0xfeff, 
-	0x0b56, 0x04a5, 0xfeff, 0x0ac0, 0x0573, 0xff6e, 0x0b56, 0x0506, 0xff6e, 0x0beb, 0x0457, 0xff6e, 0x0bb2, 0x0457, 0xff6e, 0x0af9, 
-	0x0506, 0xff6e, 0x0ac0, 0x04d6, 0xffb3, 0x0b56, 0x04cf, 0xfe04, 0x0b4f, 0x04cf, 0xfe04, 0x0b5c, 0x04cf, 0xfeda, 0x0b5c, 0x04cf, 
-	0xfeda, 0x0b4f, 0x04dd, 0xfe04, 0x0b4f, 0x04dd, 0xfeda, 0x0b4f, 0x04dd, 0xfe04, 0x0b5c, 0x04dd, 0xfeda, 0x0b5c, 0x003c, 0x002a, 
-	0x0002, 0x048c, 0xfe85, 0x0bcf, 0x0087, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x046e, 0xfe9b, 0x0c2d, 0x048c, 0xfe70, 0x0bcf, 
-	0x04dc, 0xfe9b, 0x0c09, 0x04dc, 0xfe9b, 0x0b96, 0x042a, 0xfe9b, 0x0bcf, 0x046e, 0xfe9b, 0x0b72, 0x04ef, 0xfee1, 0x0bcf, 0x04ab, 
-	0xfee1, 0x0c2d, 0x043d, 0xfee1, 0x0c09, 0x043d, 0xfee1, 0x0b96, 0x04ab, 0xfee1, 0x0b72, 0x048c, 0xff0c, 0x0bcf, 0x0488, 0xfdfe, 
-	0x0bcb, 0x0488, 0xfdfe, 0x0bd4, 0x0488, 0xfe84, 0x0bd4, 0x0488, 0xfe84, 0x0bcb, 0x0491, 0xfdfe, 0x0bcb, 0x0491, 0xfe84, 0x0bcb, 
-	0x0491, 0xfdfe, 0x0bd4, 0x0491, 0xfe84, 0x0bd4, 0x003c, 0x002a, 0x0002, 0x0531, 0xfea6, 0x0bcf, 0x00a9, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0x050b, 0xfec1, 0x0c44, 0x0531, 0xfe8b, 0x0bcf, 0x0595, 0xfec1, 0x0c18, 0x0595, 0xfec1, 0x0b87, 0x04b7, 0xfec1, 
-	0x0bcf, 0x050b, 0xfec1, 0x0b5b, 0x05ac, 0xff18, 0x0bcf, 0x0557, 0xff18, 0x0c44, 0x04ce, 0xff18, 0x0c18, 0x04ce, 0xff18, 0x0b87, 
-	0x0557, 0xff18, 0x0b5b, 0x0531, 0xff4e, 0x0bcf, 0x052c, 0xfdfd, 0x0bca, 0x052c, 0xfdfd, 0x0bd5, 0x052c, 0xfea4, 0x0bd5, 0x052c, 
-	0xfea4, 0x0bca, 0x0536, 0xfdfd, 0x0bca, 0x0536, 0xfea4, 0x0bca, 0x0536, 0xfdfd, 0x0bd5, 0x0536, 0xfea4, 0x0bd5, 0x003c, 0x002a, 
-	0x0002, 0xfb0a, 0xfedc, 0x0b55, 0x00d8, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfad9, 0xfeff, 0x0beb, 0xfb0a, 0xfeba, 0x0b56, 
-	0xfb89, 0xfeff, 0x0bb2, 0xfb89, 0xfeff, 0x0af9, 0xfa6d, 0xfeff, 0x0b56, 0xfad9, 0xfeff, 0x0ac0, 0xfba7, 0xff6e, 0x0b56, 0xfb3b, 
-	0xff6e, 0x0beb, 0xfa8b, 0xff6e, 0x0bb2, 0xfa8b, 0xff6e, 0x0af9, 0xfb3b, 0xff6e, 0x0ac0, 0xfb0a, 0xffb3, 0x0b56, 0xfb03, 0xfe04, 
-	0x0b4f, 0xfb03, 0xfe04, 0x0b5c, 0xfb03, 0xfeda, 0x0b5c, 0xfb03, 0xfeda, 0x0b4f, 0xfb11, 0xfe04, 0x0b4f, 0xfb11, 0xfeda, 0x0b4f, 
-	0xfb11, 0xfe04, 0x0b5c, 0xfb11, 0xfeda, 0x0b5c, 0x003c, 0x002a, 0x0002, 0xfb6d, 0xfe85, 0x0bcf, 0x0087, 0x0000, 0x0039, 0x002a, 
-	0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 
-	0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 
-	0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 
-	0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 
-	0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 
-	0x0000, 0x0003, 0xfb4e, 0xfe9b, 0x0c2d, 0xfb6c, 0xfe70, 0x0bcf, 0xfbbc, 0xfe9b, 0x0c09, 0xfbbc, 0xfe9b, 0x0b96, 0xfb0a, 0xfe9b, 
-	0x0bcf, 0xfb4e, 0xfe9b, 0x0b72, 0xfbcf, 0xfee1, 0x0bcf, 0xfb8b, 0xfee1, 0x0c2d, 0xfb1d, 0xfee1, 0x0c09, 0xfb1d, 0xfee1, 0x0b96, 
-	0xfb8b, 0xfee1, 0x0b72, 0xfb6c, 0xff0c, 0x0bcf, 0xfb68, 0xfdfe, 0x0bcb, 0xfb68, 0xfdfe, 0x0bd4, 0xfb68, 0xfe84, 0x0bd4, 0xfb68, 
-	0xfe84, 0x0bcb, 0xfb71, 0xfdfe, 0x0bcb, 0xfb71, 0xfe84, 0x0bcb, 0xfb71, 0xfdfe, 0x0bd4, 0xfb71, 0xfe84, 0x0bd4, 0x003c, 0x002a, 
-	0x0002, 0xfac8, 0xfea6, 0x0bcf, 0x00a9, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 
-	0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 
-	0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 
-	0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 
-	0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 
-	0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfaa2, 0xfec1, 0x0c44, 0xfac7, 0xfe8b, 0x0bcf, 
-	0xfb2b, 0xfec1, 0x0c18, 0xfb2b, 0xfec1, 0x0b87, 0xfa4d, 0xfec1, 0x0bcf, 0xfaa2, 0xfec1, 0x0b5b, 0xfb42, 0xff18, 0x0bcf, 0xfaed, 
-	0xff18, 0x0c44, 0xfa64, 0xff18, 0x0c18, 0xfa64, 0xff18, 0x0b87, 0xfaed, 0xff18, 0x0b5b, 0xfac7, 0xff4e, 0x0bcf, 0xfac2, 0xfdfd, 
-	0x0bca, 0xfac2, 0xfdfd, 0x0bd5, 0xfac2, 0xfea4, 0x0bd5, 0xfac2, 0xfea4, 0x0bca, 0xfacd, 0xfdfd, 0x0bca, 0xfacd, 0xfea4, 0x0bca, 
-	0xfacd, 0xfdfd, 0x0bd5, 0xfacd, 0xfea4, 0x0bd5, 0x0018, 0x0004, 0x0003, 0x0000, 0xff7d, 0xfef9, 0x0428, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x000c, 0x0012, 0x0015, 0x031c, 0x0000, 0xffaf, 0x0410, 0xfef9, 0xfe42, 
-	0x0410, 0x0000, 0xfe42, 0x031c, 0xfef9, 0xffaf, 0xfce4, 0x0000, 0xffaf, 0xfbf0, 0x0000, 0xfe42, 0xfbf0, 0xfef9, 0xfe42, 0xfce4, 
-	0xfef9, 0xffaf, 0x0012, 0x0004, 0x0003, 0x043b, 0xff7d, 0xfd6b, 0x0100, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0000, 
-	0x0000, 0x000c, 0x0003, 0x0009, 0x000f, 0x000c, 0x0447, 0x0000, 0xfd6a, 0x0466, 0xfef9, 0xfc93, 0x0466, 0x0000, 0xfc93, 0x0410, 
-	0x0000, 0xfe42, 0x0447, 0xfef9, 0xfd6a, 0x0410, 0xfef9, 0xfe42, 0x000c, 0x0005, 0x0002, 0x0466, 0xff7d, 0xfbe4, 0x00dc, 0x0000, 
-	0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003, 0x0000, 0x0003, 0x0466, 0x0000, 0xfb34, 0x0466, 0x0000, 0xfc93, 
-	0x0466, 0xfef9, 0xfc93, 0x0466, 0xfef9, 0xfb34, 0x0012, 0x0004, 0x0003, 0xfbc5, 0xff7d, 0xfd6b, 0x0100, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0009, 0x0000, 0x000c, 0x0000, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0xfbb9, 0x0000, 0xfd6a, 0xfb9a, 0x0000, 0xfc93, 
-	0xfb9a, 0xfef9, 0xfc93, 0xfbf0, 0x0000, 0xfe42, 0xfbb9, 0xfef9, 0xfd6a, 0xfbf0, 0xfef9, 0xfe42, 0x000c, 0x0005, 0x0002, 0xfb9a, 
-	0xff7d, 0xfbe4, 0x00dc, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003, 0x0000, 0x0003, 0xfb9a, 0x0000, 
-	0xfb34, 0xfb9a, 0x0000, 0xfc93, 0xfb9a, 0xfef9, 0xfc93, 0xfb9a, 0xfef9, 0xfb34, 0x006c, 0x0029, 0x0002, 0xfa7e, 0x0435, 0xffe7, 
-	0x085e, 0x0000, 0x0030, 0x0009, 0x0015, 0x0027, 0x0009, 0x0069, 0x0057, 0x004e, 0x005a, 0x0045, 0x0039, 0x0042, 0x0033, 0x003f, 
-	0x0030, 0x003c, 0x0066, 0x000c, 0x0069, 0x000f, 0x001b, 0x0066, 0x0054, 0x0060, 0x0063, 0x005d, 0x0060, 0x0063, 0x005a, 0x005d, 
-	0x0039, 0x0051, 0x0054, 0x0057, 0x0051, 0x0054, 0x004e, 0x004b, 0x0048, 0x004b, 0x004b, 0x0036, 0x0045, 0x0048, 0x0042, 0x0036, 
-	0x003f, 0x002d, 0x003c, 0x002a, 0x0033, 0x0039, 0x0018, 0x0015, 0x0036, 0x0000, 0x0030, 0x0033, 0x002d, 0x001e, 0x0003, 0x0021, 
-	0x0021, 0x0027, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x0006, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0xfb19, 0x0000, 0x01db, 0xfb19, 0xfecd, 0x01db, 0xf9e3, 0x05f3, 0x0641, 0xfa56, 0x05f3, 0x0641, 
-	0xf9e3, 0x0376, 0x0641, 0xfa56, 0x00f8, 0x0641, 0xfa56, 0x0000, 0x0641, 0xfa56, 0xfecd, 0x0641, 0xf9e3, 0xfecd, 0x0641, 0xf9e3, 
-	0x0000, 0x0641, 0xfb19, 0x0000, 0x03aa, 0xfb19, 0xfecd, 0x03aa, 0xfa56, 0x0000, 0x03aa, 0xfa56, 0xfecd, 0x03aa, 0xfa56, 0x00f8, 
-	0x03aa, 0xfb19, 0x00f8, 0x03aa, 0xfa56, 0x05f4, 0x03aa, 0xfb19, 0x05f4, 0x03aa, 0xfb19, 0x00f8, 0x01db, 0xfb19, 0x05f4, 0x01db, 
-	0xfa56, 0x0376, 0x03aa, 0xfb19, 0x0376, 0x03aa, 0xfb19, 0x0376, 0x01db, 0xfb19, 0x0376, 0xf98c, 0xfb19, 0x00f8, 0xf98c, 0xfb19, 
-	0x00f8, 0xfca1, 0xfb19, 0x0376, 0xfca1, 0xfb19, 0x075d, 0x01db, 0xfb19, 0x075d, 0xfca1, 0xfb19, 0x05f4, 0xfca1, 0xfb19, 0x05f4, 
-	0xf98c, 0xfb19, 0x075d, 0xf98c, 0xfb19, 0x099e, 0xfca1, 0xfb19, 0x099e, 0xf98c, 0xf9e3, 0x00f8, 0x0641, 0xfa56, 0x0376, 0x0641, 
-	0x0144, 0x00cc, 0x0002, 0x03b9, 0xfe8b, 0x03b4, 0x014c, 0x0000, 0x000f, 0x0000, 0x0132, 0x0135, 0x013e, 0x0141, 0x0141, 0x0114, 
-	0x0123, 0x012c, 0x0141, 0x0132, 0x0135, 0x013e, 0x0117, 0x0138, 0x0129, 0x013e, 0x012f, 0x0120, 0x0126, 0x013b, 0x013b, 0x0138, 
-	0x012f, 0x013b, 0x0138, 0x012c, 0x0135, 0x010e, 0x0111, 0x0132, 0x012c, 0x012f, 0x00f3, 0x0102, 0x0126, 0x0117, 0x0102, 0x0126, 
-	0x00f3, 0x0117, 0x0120, 0x0126, 0x0123, 0x0117, 0x00fc, 0x0102, 0x00ff, 0x00f3, 0x0105, 0x00ea, 0x010e, 0x0129, 0x0105, 0x0129, 
-	0x00ea, 0x010e, 0x0114, 0x0129, 0x010b, 0x010e, 0x00f0, 0x0105, 0x00e7, 0x00ea, 0x010b, 0x00e7, 0x00e4, 0x0108, 0x0114, 0x00f0, 
-	0x00ed, 0x0111, 0x0123, 0x00ff, 0x00fc, 0x0120, 0x011a, 0x00f6, 0x00f9, 0x011d, 0x0129, 0x011d, 0x011d, 0x011a, 0x0126, 0x011a, 
-	0x0120, 0x0123, 0x010b, 0x011d, 0x011a, 0x0108, 0x0117, 0x0108, 0x0111, 0x0114, 0x010e, 0x0111, 0x0108, 0x010b, 0x0105, 0x00f9, 
-	0x00f9, 0x00f6, 0x0102, 0x00f6, 0x00fc, 0x00ff, 0x00e7, 0x00f9, 0x00f6, 0x00e4, 0x00f3, 0x00e4, 0x00ed, 0x00f0, 0x00ea, 0x00ed, 
-	0x00e4, 0x00e7, 0x00d5, 0x00d2, 0x00e1, 0x00de, 0x00e1, 0x00b4, 0x00c3, 0x00cf, 0x00d2, 0x00e1, 0x00d5, 0x00de, 0x00b7, 0x00d8, 
-	0x00c9, 0x00de, 0x00cc, 0x00c0, 0x00c6, 0x00db, 0x00db, 0x00d8, 0x00cc, 0x00db, 0x00cf, 0x00d8, 0x00d5, 0x00ae, 0x00b1, 0x00d2, 
-	0x00cc, 0x00cf, 0x0093, 0x00a2, 0x00c6, 0x00b7, 0x00a2, 0x00c6, 0x0093, 0x00b7, 0x00c0, 0x00c6, 0x00c3, 0x00b7, 0x009c, 0x00a2, 
-	0x009f, 0x0093, 0x00a5, 0x008a, 0x00ae, 0x00c9, 0x00a5, 0x00c9, 0x008a, 0x00ae, 0x00b4, 0x00c9, 0x00ab, 0x00ae, 0x0090, 0x00a5, 
-	0x0087, 0x008a, 0x00ab, 0x0087, 0x0084, 0x00a8, 0x00b4, 0x0090, 0x008d, 0x00b1, 0x00c3, 0x009f, 0x009c, 0x00c0, 0x00ba, 0x0096, 
-	0x0099, 0x00bd, 0x00c9, 0x00bd, 0x00bd, 0x00ba, 0x00c6, 0x00ba, 0x00c0, 0x00c3, 0x00ab, 0x00bd, 0x00ba, 0x00a8, 0x00b7, 0x00a8, 
-	0x00b1, 0x00b4, 0x00ae, 0x00b1, 0x00a8, 0x00ab, 0x00a5, 0x0099, 0x0099, 0x0096, 0x00a2, 0x0096, 0x009c, 0x009f, 0x0087, 0x0099, 
-	0x0096, 0x0084, 0x0093, 0x0084, 0x008d, 0x0090, 0x008a, 0x008d, 0x0084, 0x0087, 0x0006, 0x000c, 0x0018, 0x0003, 0x0021, 0x0009, 
-	0x002a, 0x0030, 0x0030, 0x0027, 0x0027, 0x0024, 0x0024, 0x002a, 0x001b, 0x0030, 0x0015, 0x002a, 0x0039, 0x0027, 0x0036, 0x0024, 
-	0x0081, 0x0039, 0x004b, 0x007e, 0x007e, 0x0081, 0x007b, 0x0048, 0x003c, 0x0072, 0x0075, 0x003f, 0x0033, 0x0078, 0x0078, 0x007b, 
-	0x006f, 0x0075, 0x0072, 0x006c, 0x006c, 0x0036, 0x002d, 0x006f, 0x0081, 0x006c, 0x007e, 0x0072, 0x0078, 0x0081, 0x007b, 0x007e, 
-	0x0075, 0x007b, 0x006f, 0x0078, 0x0072, 0x0075, 0x006c, 0x006f, 0x0063, 0x004e, 0x0003, 0x0060, 0x0060, 0x0063, 0x0000, 0x0054, 
-	0x0069, 0x0021, 0x0006, 0x0057, 0x005a, 0x0045, 0x0054, 0x005a, 0x0051, 0x0066, 0x005d, 0x0042, 0x0066, 0x0069, 0x0057, 0x005d, 
-	0x0057, 0x0069, 0x005d, 0x0066, 0x0069, 0x0060, 0x0066, 0x0063, 0x0063, 0x005a, 0x0060, 0x0054, 0x005a, 0x005d, 0x0054, 0x0057, 
-	0x004e, 0x004b, 0x0045, 0x003c, 0x0048, 0x0051, 0x0042, 0x003f, 0x0051, 0x0042, 0x003f, 0x0048, 0x004b, 0x003c, 0x0045, 0x004e, 
-	0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045, 0x003c, 0x003f, 0x002d, 0x0033, 0x0033, 0x0039, 0x0039, 0x0036, 0x0036, 0x002d, 
-	0x0030, 0x0033, 0x002a, 0x002d, 0x0027, 0x001e, 0x0024, 0x0012, 0x0021, 0x0006, 0x0003, 0x0021, 0x001e, 0x001b, 0x0012, 0x001e, 
-	0x0015, 0x001b, 0x0009, 0x0018, 0x000f, 0x0018, 0x0012, 0x0015, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0000, 0x0000, 0x0003, 
-	0x0414, 0xfe02, 0x04cb, 0x0414, 0xfe04, 0x04c7, 0x0419, 0xfe02, 0x04cb, 0x0419, 0xfdf1, 0x04bf, 0x0419, 0xfdf1, 0x04c4, 0x0414, 
-	0xfdf1, 0x04c4, 0x0414, 0xfef8, 0x02a8, 0x0419, 0xfef8, 0x02a8, 0x0414, 0xfdf1, 0x04bf, 0x0419, 0xfef8, 0x02ad, 0x0414, 0xfef8, 
-	0x02ad, 0x0419, 0xfe04, 0x04c7, 0x0414, 0xff0b, 0x029e, 0x0414, 0xff0c, 0x02a2, 0x0419, 0xff0b, 0x029e, 0x0419, 0xff09, 0x029e, 
-	0x0419, 0xff0c, 0x02a2, 0x0419, 0xff0c, 0x02a2, 0x0414, 0xff09, 0x029e, 0x0414, 0xff0c, 0x02a2, 0x0414, 0xff24, 0x02bd, 0x0419, 
-	0xff24, 0x02bd, 0x0419, 0xfe1b, 0x04a5, 0x0414, 0xfe1b, 0x04a5, 0x0419, 0xff1f, 0x02bd, 0x0414, 0xff1f, 0x02bd, 0x0414, 0xfe16, 
-	0x04a5, 0x0419, 0xfe16, 0x04a5, 0x0414, 0xfe12, 0x04c9, 0x0419, 0xfe12, 0x04c9, 0x0414, 0xfe1b, 0x04c0, 0x0419, 0xfe1b, 0x04c0, 
-	0x0414, 0xfe11, 0x04c5, 0x0414, 0xfe16, 0x04be, 0x0419, 0xfe16, 0x04be, 0x0419, 0xfe11, 0x04c5, 0x0414, 0xff19, 0x029e, 0x0419, 
-	0xff19, 0x029e, 0x0414, 0xff20, 0x02a2, 0x0419, 0xff20, 0x02a2, 0x0419, 0xff16, 0x02a2, 0x0419, 0xff1c, 0x02a4, 0x0414, 0xff1c, 
-	0x02a4, 0x0414, 0xff16, 0x02a2, 0x0359, 0xff24, 0x02c1, 0x0359, 0xfe1b, 0x04a2, 0x0359, 0xfe1b, 0x04c7, 0x0359, 0xfe1b, 0x04cb, 
-	0x035d, 0xfe1b, 0x04cb, 0x0359, 0xff22, 0x02a2, 0x035d, 0xff24, 0x02c1, 0x035d, 0xfe1b, 0x04a2, 0x035d, 0xff22, 0x029e, 0x0359, 
-	0xff22, 0x029e, 0x035d, 0xff22, 0x02a2, 0x035d, 0xfe1b, 0x04c7, 0x0359, 0xff1f, 0x02c1, 0x0359, 0xfe16, 0x04a2, 0x0359, 0xfe16, 
-	0x04c7, 0x0359, 0xfe16, 0x04cb, 0x035d, 0xfe16, 0x04cb, 0x0359, 0xff1e, 0x02a2, 0x035d, 0xff1f, 0x02c1, 0x035d, 0xfe16, 0x04a2, 
-	0x035d, 0xff1e, 0x029e, 0x0359, 0xff1e, 0x029e, 0x035d, 0xff1e, 0x02a2, 0x035d, 0xfe16, 0x04c7, 0x035d, 0xfef8, 0x029e, 0x0359, 
-	0xfef8, 0x029e, 0x0359, 0xfdf2, 0x04cb, 0x0359, 0xfdf2, 0x04c7, 0x0359, 0xfef8, 0x02a2, 0x035d, 0xfef8, 0x02a2, 0x035d, 0xfdf2, 
-	0x04c7, 0x035d, 0xfdf2, 0x04cb, 0x03c7, 0xff24, 0x02c1, 0x03c7, 0xfe1b, 0x04a2, 0x03c7, 0xfe1b, 0x04c7, 0x03c7, 0xfe1b, 0x04cb, 
-	0x03cb, 0xfe1b, 0x04cb, 0x03c7, 0xff22, 0x02a2, 0x03cb, 0xff24, 0x02c1, 0x03cb, 0xfe1b, 0x04a2, 0x03cb, 0xff22, 0x029e, 0x03c7, 
-	0xff22, 0x029e, 0x03cb, 0xff22, 0x02a2, 0x03cb, 0xfe1b, 0x04c7, 0x03c7, 0xff1f, 0x02c1, 0x03c7, 0xfe16, 0x04a2, 0x03c7, 0xfe16, 
-	0x04c7, 0x03c7, 0xfe16, 0x04cb, 0x03cb, 0xfe16, 0x04cb, 0x03c7, 0xff1e, 0x02a2, 0x03cb, 0xff1f, 0x02c1, 0x03cb, 0xfe16, 0x04a2, 
-	0x03cb, 0xff1e, 0x029e, 0x03c7, 0xff1e, 0x029e, 0x03cb, 0xff1e, 0x02a2, 0x03cb, 0xfe16, 0x04c7, 0x03c7, 0xfef8, 0x029e, 0x03cb, 
-	0xfef8, 0x029e, 0x03c7, 0xfdf2, 0x04cb, 0x03c7, 0xfdf2, 0x04c7, 0x03c7, 0xfef8, 0x02a2, 0x03cb, 0xfef8, 0x02a2, 0x03cb, 0xfdf2, 
-	0x04c7, 0x03cb, 0xfdf2, 0x04cb, 0x0090, 0x0030, 0x0002, 0x058d, 0x0295, 0x092b, 0x03f7, 0x0000, 0x0042, 0x005d, 0x0069, 0x0051, 
-	0x0057, 0x0087, 0x001e, 0x002a, 0x008a, 0x0060, 0x008d, 0x0081, 0x0084, 0x007e, 0x007b, 0x008d, 0x0078, 0x0066, 0x0087, 0x008a, 
-	0x0081, 0x0084, 0x007e, 0x006c, 0x0063, 0x007b, 0x0072, 0x0075, 0x0075, 0x0078, 0x006f, 0x0072, 0x006c, 0x006f, 0x0066, 0x0069, 
-	0x0060, 0x0063, 0x005d, 0x0015, 0x005a, 0x0054, 0x004b, 0x005a, 0x003f, 0x001b, 0x0054, 0x0057, 0x0051, 0x002d, 0x0021, 0x0045, 
-	0x0048, 0x0027, 0x0039, 0x004e, 0x004e, 0x0003, 0x0024, 0x000c, 0x0018, 0x004b, 0x0033, 0x003c, 0x0045, 0x0048, 0x0042, 0x0036, 
-	0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 0x002d, 0x0030, 0x0012, 0x002a, 0x0000, 0x0027, 0x0021, 0x0024, 0x001b, 0x001e, 
-	0x0015, 0x0018, 0x000f, 0x0012, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003, 0x058d, 0x0307, 0x0576, 0x058d, 
-	0x0307, 0x06c7, 0x058d, 0x033d, 0x0576, 0x058d, 0x033d, 0x06c7, 0x058d, 0x033d, 0x0541, 0x058d, 0x033d, 0x06fd, 0x058d, 0x0307, 
-	0x06fd, 0x058d, 0x0223, 0x0883, 0x058d, 0x0307, 0x0883, 0x058d, 0x0307, 0x084d, 0x058d, 0x0223, 0x084d, 0x058d, 0x0223, 0x0541, 
-	0x058d, 0x0307, 0x0541, 0x058d, 0x0223, 0x0576, 0x058d, 0x0223, 0x06fd, 0x058d, 0x0307, 0x0a09, 0x058d, 0x033d, 0x0a09, 0x058d, 
-	0x033d, 0x09d3, 0x058d, 0x01ed, 0x06fd, 0x058d, 0x01ed, 0x06c7, 0x058d, 0x033d, 0x0883, 0x058d, 0x033d, 0x084d, 0x058d, 0x01ed, 
-	0x084d, 0x058d, 0x01ed, 0x0541, 0x058d, 0x01ed, 0x0576, 0x058d, 0x0307, 0x09d3, 0x058d, 0x0223, 0x06c7, 0x058d, 0x0223, 0x0a09, 
-	0x058d, 0x01ed, 0x09d3, 0x058d, 0x01ed, 0x0a09, 0x058d, 0x0223, 0x09d3, 0x058d, 0x01ed, 0x0883, 0x058d, 0x0223, 0x0b8f, 0x058d, 
-	0x0307, 0x0b8f, 0x058d, 0x0307, 0x0b59, 0x058d, 0x0223, 0x0b59, 0x058d, 0x0307, 0x0d15, 0x058d, 0x033d, 0x0d15, 0x058d, 0x033d, 
-	0x0cdf, 0x058d, 0x033d, 0x0b8f, 0x058d, 0x033d, 0x0b59, 0x058d, 0x0307, 0x0cdf, 0x058d, 0x0223, 0x0d15, 0x058d, 0x01ed, 0x0cdf, 
-	0x058d, 0x01ed, 0x0d15, 0x058d, 0x01ed, 0x0b59, 0x058d, 0x01ed, 0x0b8f, 0x058d, 0x0223, 0x0cdf, 0x0090, 0x0030, 0x0002, 0xfa73, 
-	0x0295, 0x092b, 0x03f7, 0x0000, 0x0042, 0x005d, 0x0069, 0x0051, 0x0057, 0x0087, 0x001e, 0x002a, 0x008a, 0x0060, 0x008d, 0x0081, 
-	0x0084, 0x007e, 0x007b, 0x008d, 0x0078, 0x0066, 0x0087, 0x008a, 0x0081, 0x0084, 0x007e, 0x006c, 0x0063, 0x007b, 0x0072, 0x0075, 
-	0x0075, 0x0078, 0x006f, 0x0072, 0x006c, 0x006f, 0x0066, 0x0069, 0x0060, 0x0063, 0x005d, 0x0015, 0x005a, 0x0054, 0x004b, 0x005a, 
-	0x003f, 0x001b, 0x0054, 0x0057, 0x0051, 0x002d, 0x0021, 0x0045, 0x0048, 0x0027, 0x0039, 0x004e, 0x004e, 0x0003, 0x0024, 0x000c, 
-	0x0018, 0x004b, 0x0033, 0x003c, 0x0045, 0x0048, 0x0042, 0x0036, 0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 0x002d, 0x0030, 
-	0x0012, 0x002a, 0x0000, 0x0027, 0x0021, 0x0024, 0x001b, 0x001e, 0x0015, 0x0018, 0x000f, 0x0012, 0x0009, 0x000f, 0x000c, 0x0006, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0xfa73, 0x0307, 0x0576, 0xfa73, 0x0307, 0x06c7, 0xfa73, 0x033d, 0x0576, 0xfa73, 0x033d, 0x06c7, 
-	0xfa73, 0x033d, 0x0541, 0xfa73, 0x033d, 0x06fd, 0xfa73, 0x0307, 0x06fd, 0xfa73, 0x0223, 0x0883, 0xfa73, 0x0307, 0x0883, 0xfa73, 
-	0x0307, 0x084d, 0xfa73, 0x0223, 0x084d, 0xfa73, 0x0223, 0x0541, 0xfa73, 0x0307, 0x0541, 0xfa73, 0x0223, 0x0576, 0xfa73, 0x0223, 
-	0x06fd, 0xfa73, 0x0307, 0x0a09, 0xfa73, 0x033d, 0x0a09, 0xfa73, 0x033d, 0x09d3, 0xfa73, 0x01ed, 0x06fd, 0xfa73, 0x01ed, 0x06c7, 
-	0xfa73, 0x033d, 0x0883, 0xfa73, 0x033d, 0x084d, 0xfa73, 0x01ed, 0x084d, 0xfa73, 0x01ed, 0x0541, 0xfa73, 0x01ed, 0x0576, 0xfa73, 
-	0x0307, 0x09d3, 0xfa73, 0x0223, 0x06c7, 0xfa73, 0x0223, 0x0a09, 0xfa73, 0x01ed, 0x09d3, 0xfa73, 0x01ed, 0x0a09, 0xfa73, 0x0223, 
-	0x09d3, 0xfa73, 0x01ed, 0x0883, 0xfa73, 0x0223, 0x0b8f, 0xfa73, 0x0307, 0x0b8f, 0xfa73, 0x0307, 0x0b59, 0xfa73, 0x0223, 0x0b59, 
-	0xfa73, 0x0307, 0x0d15, 0xfa73, 0x033d, 0x0d15, 0xfa73, 0x033d, 0x0cdf, 0xfa73, 0x033d, 0x0b8f, 0xfa73, 0x033d, 0x0b59, 0xfa73, 
-	0x0307, 0x0cdf, 0xfa73, 0x0223, 0x0d15, 0xfa73, 0x01ed, 0x0cdf, 0xfa73, 0x01ed, 0x0d15, 0xfa73, 0x01ed, 0x0b59, 0xfa73, 0x01ed, 
-	0x0b8f, 0xfa73, 0x0223, 0x0cdf, 0x000c, 0x0002, 0x0003, 0xfa2c, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 
-	0x0009, 0x0003, 0xfb1c, 0x01dc, 0x09da, 0xf93c, 0x01dc, 0x087b, 0xfb1c, 0x01dc, 0x087b, 0xf93c, 0x01dc, 0x09da, 0x000c, 0x0002, 
-	0x0003, 0xfc0c, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfcfc, 0x01dc, 0x09da, 0xfb1c, 
-	0x01dc, 0x087b, 0xfcfc, 0x01dc, 0x087b, 0xfb1c, 0x01dc, 0x09da, 0x000c, 0x0002, 0x0003, 0xfdec, 0x01dc, 0x092a, 0x0129, 0x0000, 
-	0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfedc, 0x01dc, 0x09da, 0xfcfc, 0x01dc, 0x087b, 0xfedc, 0x01dc, 0x087b, 0xfcfc, 
-	0x01dc, 0x09da, 0x000c, 0x0002, 0x0003, 0x0000, 0x01ee, 0x092b, 0x019d, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 
-	0xfedc, 0x01ee, 0x0806, 0x0124, 0x01ee, 0x0a50, 0xfedc, 0x01ee, 0x0a50, 0x0124, 0x01ee, 0x0806, 0x000c, 0x0002, 0x0003, 0x0214, 
-	0x01dc, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0124, 0x01dc, 0x09da, 0x0124, 0x01dc, 0x087b, 
-	0x0304, 0x01dc, 0x087b, 0x0304, 0x01dc, 0x09da, 0x000c, 0x0002, 0x0003, 0x03f4, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 
-	0x0006, 0x0000, 0x0006, 0x0009, 0x0304, 0x01dc, 0x09da, 0x0304, 0x01dc, 0x087b, 0x04e4, 0x01dc, 0x087b, 0x04e4, 0x01dc, 0x09da, 
-	0x000c, 0x0002, 0x0003, 0x05d4, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x04e4, 0x01dc, 
-	0x09da, 0x04e4, 0x01dc, 0x087b, 0x06c4, 0x01dc, 0x087b, 0x06c4, 0x01dc, 0x09da, 0x006c, 0x0029, 0x0002, 0x0582, 0x0435, 0xffe7, 
-	0x085e, 0x0000, 0x0030, 0x0009, 0x0015, 0x0027, 0x0009, 0x0069, 0x0057, 0x004e, 0x005a, 0x0045, 0x0039, 0x0042, 0x0033, 0x003f, 
-	0x0030, 0x003c, 0x0066, 0x000c, 0x0069, 0x000f, 0x001b, 0x0066, 0x0054, 0x0060, 0x0063, 0x005d, 0x0060, 0x0063, 0x005a, 0x005d, 
-	0x0039, 0x0051, 0x0054, 0x0057, 0x0051, 0x0054, 0x004e, 0x004b, 0x0048, 0x004b, 0x004b, 0x0036, 0x0045, 0x0048, 0x0042, 0x0036, 
-	0x003f, 0x002d, 0x003c, 0x002a, 0x0033, 0x0039, 0x0018, 0x0015, 0x0036, 0x0000, 0x0030, 0x0033, 0x002d, 0x001e, 0x0003, 0x0021, 
-	0x0021, 0x0027, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x0006, 
-	0x0006, 0x0009, 0x0000, 0x0003, 0x04e7, 0x0000, 0x01db, 0x04e7, 0xfecd, 0x01db, 0x061d, 0x05f3, 0x0641, 0x05aa, 0x05f3, 0x0641, 
-	0x061d, 0x0376, 0x0641, 0x05aa, 0x00f8, 0x0641, 0x05aa, 0x0000, 0x0641, 0x05aa, 0xfecd, 0x0641, 0x061d, 0xfecd, 0x0641, 0x061d, 
-	0x0000, 0x0641, 0x04e7, 0x0000, 0x03aa, 0x04e7, 0xfecd, 0x03aa, 0x05aa, 0x0000, 0x03aa, 0x05aa, 0xfecd, 0x03aa, 0x05aa, 0x00f8, 
-	0x03aa, 0x04e7, 0x00f8, 0x03aa, 0x05aa, 0x05f4, 0x03aa, 0x04e7, 0x05f4, 0x03aa, 0x04e7, 0x00f8, 0x01db, 0x04e7, 0x05f4, 0x01db, 
-	0x05aa, 0x0376, 0x03aa, 0x04e7, 0x0376, 0x03aa, 0x04e7, 0x0376, 0x01db, 0x04e7, 0x0376, 0xf98c, 0x04e7, 0x00f8, 0xf98c, 0x04e7, 
-	0x00f8, 0xfca1, 0x04e7, 0x0376, 0xfca1, 0x04e7, 0x075d, 0x01db, 0x04e7, 0x075d, 0xfca1, 0x04e7, 0x05f4, 0xfca1, 0x04e7, 0x05f4, 
-	0xf98c, 0x04e7, 0x075d, 0xf98c, 0x04e7, 0x099e, 0xfca1, 0x04e7, 0x099e, 0xf98c, 0x061d, 0x00f8, 0x0641, 0x05aa, 0x0376, 0x0641, 
-	0x000c, 0x0002, 0x0003, 0x047e, 0x037e, 0x0b53, 0x000c, 0x03e6, 0x0000, 0x0003, 0x0009, 0x0000, 0x0009, 0x0006, 0x047e, 0x037e, 
-	0x0b5f, 0x047e, 0x037e, 0x0b47, 0x047e, 0x037e, 0x0b5f, 0x047e, 0x037e, 0x0b47, 0x0024, 0x0014, 0x0002, 0x045b, 0x01db, 0x05d6, 
-	0x001c, 0x03e8, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x045e, 0x01c8, 0x05eb, 0x045e, 0x01c0, 0x05dd, 
-	0x0465, 0x01d4, 0x05ca, 0x045d, 0x01ef, 0x05c2, 0x045e, 0x01f6, 0x05d0, 0x0466, 0x01e2, 0x05e2, 0x0451, 0x01cf, 0x05e7, 0x0451, 
-	0x01f0, 0x05d4, 0x0454, 0x01e0, 0x05df, 0x0450, 0x01c7, 0x05da, 0x0450, 0x01e8, 0x05c7, 0x0453, 0x01d7, 0x05ce, 0x0024, 0x0014, 
-	0x0002, 0x0448, 0x0115, 0x0480, 0x001c, 0x03e9, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x044c, 0x0102, 
-	0x0494, 0x044b, 0x00fa, 0x0486, 0x0452, 0x010e, 0x0473, 0x044b, 0x0129, 0x046c, 0x044b, 0x0130, 0x047a, 0x0453, 0x011c, 0x048c, 
-	0x043e, 0x0109, 0x0491, 0x043e, 0x012a, 0x047e, 0x0441, 0x011a, 0x0489, 0x043d, 0x0101, 0x0483, 0x043d, 0x0122, 0x0470, 0x0440, 
-	0x0111, 0x0478, 0x0024, 0x0014, 0x0002, 0x0436, 0x0060, 0x0321, 0x001c, 0x03ea, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x043a, 0x004b, 0x0333, 0x0439, 0x0045, 0x0324, 0x0440, 0x005b, 0x0314, 0x0439, 0x0076, 0x030f, 0x0439, 0x007c, 
-	0x031d, 0x0441, 0x0066, 0x032d, 0x042c, 0x0052, 0x0330, 0x042c, 0x0075, 0x0321, 0x042f, 0x0064, 0x032a, 0x042b, 0x004c, 0x0322, 
-	0x042b, 0x006f, 0x0312, 0x042e, 0x005d, 0x0318, 0x0024, 0x0014, 0x0002, 0x0433, 0xffe6, 0x01aa, 0x001c, 0x03eb, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0437, 0xffce, 0x01b7, 0x0437, 0xffcb, 0x01a8, 0x043e, 0xffe4, 0x019d, 0x0437, 
-	0xffff, 0x019d, 0x0437, 0x0001, 0x01ac, 0x043e, 0xffe9, 0x01b8, 0x0429, 0xffd5, 0x01b5, 0x0429, 0xfffb, 0x01ad, 0x042c, 0xffe8, 
-	0x01b3, 0x0429, 0xffd2, 0x01a6, 0x0429, 0xfff7, 0x019e, 0x042c, 0xffe4, 0x01a0, 0x0024, 0x0014, 0x0002, 0x0455, 0xffc8, 0x0024, 
-	0x001d, 0x03ec, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0458, 0xffac, 0x002a, 0x045a, 0xffad, 0x001a, 
-	0x0462, 0xffc8, 0x0017, 0x0459, 0xffe3, 0x001d, 0x0457, 0xffe2, 0x002d, 0x045e, 0xffc7, 0x0032, 0x044a, 0xffb4, 0x0028, 0x0449, 
-	0xffda, 0x002a, 0x044d, 0xffc7, 0x002c, 0x044d, 0xffb5, 0x0019, 0x044c, 0xffdb, 0x001b, 0x044f, 0xffc8, 0x0018, 0x0024, 0x0014, 
-	0x0002, 0x04f4, 0x009c, 0xfd41, 0x001c, 0x03f2, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x04fb, 0x0080, 
-	0xfd40, 0x04fa, 0x0085, 0xfd31, 0x04fe, 0x00a1, 0xfd33, 0x04f5, 0x00b8, 0xfd42, 0x04f6, 0x00b3, 0xfd51, 0x0500, 0x0098, 0xfd4e, 
-	0x04ec, 0x0086, 0xfd43, 0x04e9, 0x00aa, 0xfd4f, 0x04ee, 0x0098, 0xfd4a, 0x04eb, 0x008b, 0xfd34, 0x04e8, 0x00af, 0xfd40, 0x04ed, 
-	0x009e, 0xfd38, 0x0024, 0x0014, 0x0002, 0x03ce, 0x00bd, 0xfc7a, 0x001e, 0x03f3, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x03d6, 0x00a3, 0xfc6e, 0x03c7, 0x00a3, 0xfc6c, 0x03c0, 0x00bf, 0xfc6c, 0x03c4, 0x00d7, 0xfc7b, 0x03d4, 0x00d7, 
-	0xfc7d, 0x03dc, 0x00bf, 0xfc6f, 0x03d4, 0x00a7, 0xfc7d, 0x03d2, 0x00cb, 0xfc87, 0x03d6, 0x00ba, 0xfc7f, 0x03c5, 0x00a7, 0xfc7b, 
-	0x03c3, 0x00cb, 0xfc85, 0x03c2, 0x00ba, 0xfc7d, 0x0024, 0x0014, 0x0002, 0x0254, 0x00a8, 0xfcd3, 0x001d, 0x03f4, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0258, 0x008f, 0xfcc4, 0x024b, 0x008e, 0xfccd, 0x0245, 0x00aa, 0xfcd1, 0x0250, 
-	0x00c2, 0xfcda, 0x025d, 0x00c3, 0xfcd1, 0x025c, 0x00ab, 0xfcc2, 0x0261, 0x0093, 0xfcd1, 0x0264, 0x00b8, 0xfcda, 0x0262, 0x00a7, 
-	0xfcd2, 0x0254, 0x0092, 0xfcda, 0x0257, 0x00b7, 0xfce3, 0x0252, 0x00a5, 0xfcdd, 0x0024, 0x0014, 0x0002, 0x0124, 0x0095, 0xfdce, 
-	0x001d, 0x03f5, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0127, 0x007b, 0xfdc1, 0x011a, 0x007b, 0xfdca, 
-	0x0114, 0x0096, 0xfdce, 0x0121, 0x00af, 0xfdd5, 0x012d, 0x00af, 0xfdcc, 0x012b, 0x0097, 0xfdbd, 0x0130, 0x007f, 0xfdcd, 0x0134, 
-	0x00a4, 0xfdd5, 0x0132, 0x0093, 0xfdcd, 0x0123, 0x007f, 0xfdd6, 0x0128, 0x00a4, 0xfdde, 0x0122, 0x0092, 0xfdd9, 0x0024, 0x0014, 
-	0x0002, 0xffbd, 0x0095, 0xfe2c, 0x001e, 0x03f6, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xffc4, 0x007b, 
-	0xfe24, 0xffb5, 0x007b, 0xfe1f, 0xffb0, 0x0097, 0xfe1d, 0xffb3, 0x00af, 0xfe2c, 0xffc2, 0x00af, 0xfe30, 0xffcb, 0x0096, 0xfe25, 
-	0xffbf, 0x007f, 0xfe32, 0xffbe, 0x00a4, 0xfe3b, 0xffc1, 0x0092, 0xfe35, 0xffb0, 0x0080, 0xfe2d, 0xffaf, 0x00a4, 0xfe36, 0xffaf, 
-	0x0093, 0xfe2e, 0x0024, 0x0014, 0x0002, 0xfd1b, 0x00c6, 0xfc9e, 0x001e, 0x03fc, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfd20, 0x00ac, 0xfc94, 0xfd11, 0x00ad, 0xfc90, 0xfd0d, 0x00c9, 0xfc8f, 0xfd12, 0x00e1, 0xfc9f, 0xfd21, 0x00e0, 
-	0xfca2, 0xfd28, 0x00c7, 0xfc96, 0xfd1d, 0x00b0, 0xfca3, 0xfd1d, 0x00d5, 0xfcad, 0xfd1f, 0x00c3, 0xfca6, 0xfd0d, 0x00b1, 0xfc9f, 
-	0xfd0e, 0x00d6, 0xfca9, 0xfd0d, 0x00c5, 0xfca1, 0x0024, 0x0014, 0x0002, 0xfb9b, 0x00e6, 0xfcc3, 0x001c, 0x03fd, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb99, 0x00cd, 0xfcb5, 0xfb8c, 0x00ce, 0xfcbe, 0xfb8a, 0x00ea, 0xfcc2, 0xfb99, 
-	0x0100, 0xfcca, 0xfba6, 0x00ff, 0xfcc1, 0xfba1, 0x00e8, 0xfcb2, 0xfba2, 0x00d0, 0xfcc1, 0xfbab, 0x00f4, 0xfcca, 0xfba7, 0x00e3, 
-	0xfcc2, 0xfb95, 0x00d1, 0xfcca, 0xfb9e, 0x00f5, 0xfcd3, 0xfb97, 0x00e4, 0xfccd, 0x0024, 0x0014, 0x0002, 0xfb3d, 0x00e9, 0xfe2a, 
-	0x001f, 0x03fe, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb2d, 0x00d0, 0xfe21, 0xfb30, 0x00d0, 0xfe30, 
-	0xfb33, 0x00eb, 0xfe37, 0xfb42, 0x0102, 0xfe2f, 0xfb3f, 0x0103, 0xfe20, 0xfb2e, 0x00ec, 0xfe1c, 0xfb3c, 0x00d3, 0xfe1e, 0xfb49, 
-	0x00f7, 0xfe1e, 0xfb40, 0x00e6, 0xfe1c, 0xfb3f, 0x00d2, 0xfe2d, 0xfb4c, 0x00f6, 0xfe2d, 0xfb43, 0x00e5, 0xfe30, 0x0024, 0x0014, 
-	0x0002, 0xfba2, 0x00c4, 0xffa7, 0x001f, 0x03ff, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb91, 0x00ac, 
-	0xff9d, 0xfb96, 0x00aa, 0xffac, 0xfb9a, 0x00c5, 0xffb5, 0xfba9, 0x00dc, 0xffae, 0xfba4, 0x00de, 0xff9f, 0xfb93, 0x00c8, 0xff9a, 
-	0xfba0, 0x00af, 0xff99, 0xfbae, 0x00d3, 0xff9a, 0xfba4, 0x00c2, 0xff99, 0xfba4, 0x00ad, 0xffa8, 0xfbb2, 0x00d0, 0xffa9, 0xfba9, 
-	0x00bf, 0xffab, 0x0024, 0x0014, 0x0002, 0xfc05, 0x0083, 0x011f, 0x001e, 0x0400, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfbf4, 0x006c, 0x0114, 0xfbf7, 0x0069, 0x0123, 0xfbfc, 0x0083, 0x012e, 0xfc0b, 0x009b, 0x0128, 0xfc08, 0x009e, 
-	0x0119, 0xfbf6, 0x0088, 0x0113, 0xfc03, 0x006f, 0x0111, 0xfc11, 0x0092, 0x0115, 0xfc07, 0x0082, 0x0112, 0xfc07, 0x006c, 0x0120, 
-	0xfc15, 0x008f, 0x0124, 0xfc0b, 0x007e, 0x0125, 0x0024, 0x0014, 0x0002, 0xfcee, 0x0000, 0x0408, 0x001d, 0x0406, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfcdd, 0xffe9, 0x0400, 0xfce3, 0xffe7, 0x040e, 0xfce8, 0x0000, 0x0416, 0xfcf5, 
-	0x0018, 0x040e, 0xfcef, 0x001a, 0x03ff, 0xfcdd, 0x0004, 0x03fd, 0xfceb, 0xffec, 0x03fa, 0xfcf8, 0x000e, 0x03fa, 0xfcee, 0xffff, 
-	0x03fa, 0xfcf1, 0xffea, 0x0409, 0xfcfe, 0x000c, 0x0408, 0xfcf6, 0xfffc, 0x040c, 0x0024, 0x0014, 0x0002, 0xfd8e, 0xffd3, 0x056f, 
-	0x001f, 0x0407, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd7d, 0xffba, 0x0568, 0xfd83, 0xffb8, 0x0576, 
-	0xfd88, 0xffd3, 0x057e, 0xfd95, 0xffeb, 0x0574, 0xfd8e, 0xffed, 0x0566, 0xfd7d, 0xffd6, 0x0565, 0xfd8b, 0xffbd, 0x0562, 0xfd97, 
-	0xffe1, 0x0560, 0xfd8e, 0xffd0, 0x0561, 0xfd91, 0xffbb, 0x0570, 0xfd9e, 0xffdf, 0x056f, 0xfd96, 0xffce, 0x0572, 0x0024, 0x0014, 
-	0x0002, 0xfe36, 0xffa8, 0x06d3, 0x001f, 0x0408, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe25, 0xff8f, 
-	0x06cc, 0xfe2b, 0xff8e, 0x06da, 0xfe31, 0xffa9, 0x06e2, 0xfe3d, 0xffc0, 0x06d8, 0xfe36, 0xffc2, 0x06ca, 0xfe25, 0xffac, 0x06c9, 
-	0xfe33, 0xff93, 0x06c6, 0xfe3f, 0xffb7, 0x06c5, 0xfe36, 0xffa6, 0x06c5, 0xfe39, 0xff91, 0x06d4, 0xfe46, 0xffb5, 0x06d3, 0xfe3e, 
-	0xffa4, 0x06d6, 0x0024, 0x0014, 0x0002, 0xfed8, 0xff7a, 0x0839, 0x001f, 0x0409, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfec7, 0xff61, 0x0832, 0xfecd, 0xff5f, 0x0840, 0xfed3, 0xff7a, 0x0848, 0xfedf, 0xff92, 0x083f, 0xfed9, 0xff94, 
-	0x0831, 0xfec7, 0xff7d, 0x082f, 0xfed5, 0xff64, 0x082c, 0xfee2, 0xff88, 0x082b, 0xfed8, 0xff77, 0x082b, 0xfedc, 0xff62, 0x083a, 
-	0xfee8, 0xff86, 0x0839, 0xfee0, 0xff75, 0x083d, 0x0024, 0x0014, 0x0002, 0xff72, 0xff41, 0x09a1, 0x001e, 0x040a, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xff61, 0xff29, 0x0999, 0xff67, 0xff26, 0x09a7, 0xff6c, 0xff41, 0x09b0, 0xff79, 
-	0xff59, 0x09a8, 0xff73, 0xff5b, 0x099a, 0xff62, 0xff45, 0x0997, 0xff6f, 0xff2c, 0x0994, 0xff7c, 0xff50, 0x0994, 0xff72, 0xff3f, 
-	0x0993, 0xff75, 0xff2a, 0x09a2, 0xff82, 0xff4d, 0x09a3, 0xff7a, 0xff3c, 0x09a5, 0x0024, 0x0014, 0x0002, 0x0103, 0xfeac, 0x0c2d, 
-	0x001c, 0x0410, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x00f4, 0xfe94, 0x0c2c, 0x0100, 0xfe91, 0x0c35, 
-	0x0109, 0xfeab, 0x0c3c, 0x010f, 0xfec4, 0x0c31, 0x0102, 0xfec7, 0x0c29, 0x00f2, 0xfeb0, 0x0c2d, 0x00fd, 0xfe98, 0x0c20, 0x0107, 
-	0xfebd, 0x0c1e, 0x00ff, 0xfeac, 0x0c21, 0x010a, 0xfe95, 0x0c29, 0x0114, 0xfeba, 0x0c27, 0x010f, 0xfea8, 0x0c2b, 0x0024, 0x0014, 
-	0x0002, 0x027a, 0xfe77, 0x0c57, 0x001d, 0x0411, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0271, 0xfe5c, 
-	0x0c60, 0x0280, 0xfe5b, 0x0c5b, 0x0289, 0xfe76, 0x0c5d, 0x0281, 0xfe91, 0x0c55, 0x0273, 0xfe92, 0x0c5b, 0x026f, 0xfe78, 0x0c66, 
-	0x026c, 0xfe63, 0x0c53, 0x026e, 0xfe89, 0x0c4f, 0x026c, 0xfe76, 0x0c54, 0x027b, 0xfe62, 0x0c4d, 0x027c, 0xfe88, 0x0c49, 0x027f, 
-	0xfe75, 0x0c4d, 0x0024, 0x0014, 0x0002, 0x039b, 0xfe72, 0x0b59, 0x001d, 0x0412, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x039b, 0xfe57, 0x0b5f, 0x03a3, 0xfe57, 0x0b52, 0x03aa, 0xfe73, 0x0b50, 0x039f, 0xfe8d, 0x0b51, 0x0397, 0xfe8c, 
-	0x0b5f, 0x039c, 0xfe72, 0x0b68, 0x038f, 0xfe5e, 0x0b58, 0x038c, 0xfe84, 0x0b58, 0x038f, 0xfe71, 0x0b5b, 0x0397, 0xfe5e, 0x0b4b, 
-	0x0394, 0xfe84, 0x0b4a, 0x0399, 0xfe71, 0x0b4a, 0x0024, 0x0014, 0x0002, 0x041d, 0xfe85, 0x09e5, 0x001d, 0x0413, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0421, 0xfe69, 0x09ea, 0x0424, 0xfe6a, 0x09db, 0x042a, 0xfe86, 0x09d8, 0x041f, 
-	0xfea0, 0x09dd, 0x041c, 0xfe9f, 0x09ed, 0x0425, 0xfe84, 0x09f3, 0x0413, 0xfe70, 0x09e8, 0x0410, 0xfe96, 0x09ea, 0x0414, 0xfe83, 
-	0x09eb, 0x0416, 0xfe71, 0x09d9, 0x0413, 0xfe97, 0x09db, 0x0418, 0xfe84, 0x09d8, 0x0024, 0x0014, 0x0002, 0x0440, 0xfea2, 0x085b, 
-	0x001c, 0x0414, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0447, 0xfe87, 0x0860, 0x0447, 0xfe88, 0x0851, 
-	0x044c, 0xfea4, 0x084d, 0x0442, 0xfebd, 0x0855, 0x0442, 0xfebc, 0x0865, 0x044c, 0xfea1, 0x0869, 0x0439, 0xfe8d, 0x0860, 0x0435, 
-	0xfeb3, 0x0864, 0x043a, 0xfea0, 0x0864, 0x0439, 0xfe8e, 0x0851, 0x0435, 0xfeb4, 0x0854, 0x043a, 0xfea2, 0x0851, 0x0024, 0x0014, 
-	0x0002, 0x0437, 0xfec9, 0x06d0, 0x001d, 0x0415, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x043e, 0xfeae, 
-	0x06d5, 0x043e, 0xfeaf, 0x06c5, 0x0442, 0xfecb, 0x06c2, 0x0438, 0xfee4, 0x06cc, 0x0439, 0xfee2, 0x06db, 0x0443, 0xfec8, 0x06de, 
-	0x0430, 0xfeb4, 0x06d7, 0x042d, 0xfed9, 0x06db, 0x0431, 0xfec7, 0x06db, 0x042f, 0xfeb6, 0x06c7, 0x042c, 0xfedb, 0x06cb, 0x0430, 
-	0xfec9, 0x06c7, 0x0024, 0x0014, 0x0002, 0x041b, 0xfefe, 0x0548, 0x001d, 0x0416, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x0422, 0xfee2, 0x054c, 0x0420, 0xfee5, 0x053d, 0x0425, 0xff01, 0x053b, 0x041b, 0xff19, 0x0546, 0x041d, 0xff17, 
-	0x0555, 0x0427, 0xfefc, 0x0556, 0x0414, 0xfee8, 0x054f, 0x0410, 0xff0e, 0x0555, 0x0415, 0xfefb, 0x0553, 0x0412, 0xfeeb, 0x053f, 
-	0x040f, 0xff10, 0x0545, 0x0413, 0xfefe, 0x0540, 0x0024, 0x0014, 0x0002, 0x03eb, 0xff4a, 0x03c7, 0x001c, 0x0417, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x03f2, 0xff2e, 0x03c8, 0x03ef, 0xff31, 0x03b9, 0x03f2, 0xff4e, 0x03b9, 0x03ea, 
-	0xff65, 0x03c7, 0x03ed, 0xff62, 0x03d6, 0x03f8, 0xff47, 0x03d3, 0x03e4, 0xff34, 0x03cd, 0x03e1, 0xff58, 0x03d6, 0x03e6, 0xff46, 
-	0x03d3, 0x03e1, 0xff37, 0x03be, 0x03de, 0xff5c, 0x03c7, 0x03e2, 0xff4a, 0x03c0, 0x0024, 0x0014, 0x0002, 0x01ae, 0xffa5, 0x0210, 
-	0x001d, 0x041a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x01b6, 0xff8b, 0x0205, 0x01a7, 0xff8c, 0x0201, 
-	0x01a1, 0xffa7, 0x0201, 0x01a4, 0xffbf, 0x0211, 0x01b3, 0xffbf, 0x0215, 0x01bc, 0xffa7, 0x0207, 0x01b3, 0xff8f, 0x0214, 0x01b1, 
-	0xffb3, 0x021f, 0x01b5, 0xffa2, 0x0217, 0x01a4, 0xff8f, 0x0210, 0x01a2, 0xffb3, 0x021c, 0x01a1, 0xffa2, 0x0213, 0x0024, 0x0014, 
-	0x0002, 0x0029, 0xffad, 0x01c8, 0x001e, 0x041b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0030, 0xff93, 
-	0x01bc, 0x0021, 0xff93, 0x01ba, 0x001b, 0xffaf, 0x01ba, 0x001f, 0xffc6, 0x01ca, 0x002f, 0xffc6, 0x01cc, 0x0037, 0xffae, 0x01be, 
-	0x002e, 0xff96, 0x01cb, 0x002d, 0xffba, 0x01d7, 0x0030, 0xffa9, 0x01cf, 0x001e, 0xff97, 0x01c9, 0x001e, 0xffbb, 0x01d4, 0x001c, 
-	0xffaa, 0x01cc, 0x0024, 0x0014, 0x0002, 0xfea0, 0xffb9, 0x019c, 0x001e, 0x041c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfea7, 0xff9f, 0x018f, 0xfe97, 0xff9f, 0x018e, 0xfe92, 0xffbb, 0x018f, 0xfe98, 0xffd2, 0x019f, 0xfea7, 0xffd2, 
-	0x019f, 0xfead, 0xffba, 0x0191, 0xfea6, 0xffa2, 0x019e, 0xfea6, 0xffc6, 0x01aa, 0xfea8, 0xffb5, 0x01a1, 0xfe97, 0xffa2, 0x019e, 
-	0xfe97, 0xffc6, 0x01a9, 0xfe95, 0xffb5, 0x01a0, 0x0024, 0x0014, 0x0002, 0xfd19, 0xffad, 0x01d0, 0x001d, 0x041d, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd20, 0xff94, 0x01c1, 0xfd12, 0xff93, 0x01c7, 0xfd0a, 0xffad, 0x01cc, 0xfd13, 
-	0xffc6, 0x01d8, 0xfd21, 0xffc7, 0x01d1, 0xfd23, 0xffb1, 0x01c0, 0xfd26, 0xff98, 0x01cf, 0xfd27, 0xffbc, 0x01da, 0xfd27, 0xffab, 
-	0x01d1, 0xfd18, 0xff96, 0x01d5, 0xfd19, 0xffba, 0x01e1, 0xfd15, 0xffa9, 0x01d9, 0x0024, 0x0014, 0x0002, 0xfc04, 0xfeec, 0x0475, 
-	0x001c, 0x0424, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc01, 0xfed4, 0x0467, 0xfbff, 0xfed0, 0x0476, 
-	0xfbf8, 0xfee9, 0x0482, 0xfc01, 0xff04, 0x0483, 0xfc03, 0xff08, 0x0473, 0xfbfc, 0xfef0, 0x0467, 0xfc0f, 0xfeda, 0x046b, 0xfc10, 
-	0xfeff, 0x0473, 0xfc0d, 0xfeee, 0x046d, 0xfc0d, 0xfed7, 0x047a, 0xfc0e, 0xfefc, 0x0483, 0xfc0a, 0xfee9, 0x0480, 0x0024, 0x0014, 
-	0x0002, 0xfbbe, 0xfea9, 0x05f3, 0x001d, 0x0425, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfbbc, 0xfe8f, 
-	0x05e9, 0xfbb8, 0xfe8d, 0x05f8, 0xfbb1, 0xfea7, 0x0600, 0xfbbb, 0xfec2, 0x05ff, 0xfbbe, 0xfec4, 0x05f0, 0xfbb7, 0xfeaa, 0x05e5, 
-	0xfbc9, 0xfe95, 0x05ed, 0xfbcb, 0xfebb, 0x05f2, 0xfbc8, 0xfea9, 0x05ed, 0xfbc6, 0xfe93, 0x05fc, 0xfbc8, 0xfeb9, 0x0601, 0xfbc3, 
-	0xfea6, 0x0600, 0x0024, 0x0014, 0x0002, 0xfb5e, 0xfe8f, 0x0771, 0x001d, 0x0426, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfb5b, 0xfe74, 0x076a, 0xfb57, 0xfe74, 0x0779, 0xfb51, 0xfe8f, 0x077f, 0xfb5b, 0xfea9, 0x077b, 0xfb5f, 0xfeaa, 
-	0x076c, 0xfb57, 0xfe90, 0x0763, 0xfb68, 0xfe7b, 0x076d, 0xfb6b, 0xfea1, 0x076f, 0xfb67, 0xfe8e, 0x076b, 0xfb65, 0xfe7b, 0x077d, 
-	0xfb68, 0xfea1, 0x077e, 0xfb63, 0xfe8e, 0x077e, 0x0024, 0x0014, 0x0002, 0xfb62, 0xfe99, 0x08f8, 0x001c, 0x0427, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb5a, 0xfe7e, 0x08f3, 0xfb61, 0xfe7e, 0x0901, 0xfb60, 0xfe9a, 0x0908, 0xfb65, 
-	0xfeb4, 0x08fd, 0xfb5e, 0xfeb3, 0x08ef, 0xfb53, 0xfe99, 0x08ef, 0xfb67, 0xfe84, 0x08ec, 0xfb69, 0xfeaa, 0x08e9, 0xfb64, 0xfe97, 
-	0x08ea, 0xfb6e, 0xfe85, 0x08fa, 0xfb71, 0xfeaa, 0x08f7, 0xfb6e, 0xfe98, 0x08fc, 0x0024, 0x0014, 0x0002, 0xfcba, 0xfe91, 0x0988, 
-	0x001c, 0x0428, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfcb0, 0xfe77, 0x098f, 0xfcbf, 0xfe76, 0x098e, 
-	0xfcc8, 0xfe91, 0x0992, 0xfcc3, 0xfeab, 0x0989, 0xfcb3, 0xfeac, 0x0989, 0xfcac, 0xfe93, 0x0994, 0xfcaf, 0xfe7d, 0x0981, 0xfcb2, 
-	0xfea3, 0x097d, 0xfcaf, 0xfe91, 0x0982, 0xfcbf, 0xfe7c, 0x0980, 0xfcc2, 0xfea2, 0x097c, 0xfcc2, 0xfe8f, 0x0981, 0x0024, 0x0014, 
-	0x0002, 0xffcc, 0xfe7b, 0x093e, 0x001d, 0x042f, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xffc5, 0xfe60, 
-	0x0945, 0xffd4, 0xfe60, 0x0945, 0xffda, 0xfe7b, 0x0949, 0xffd4, 0xfe95, 0x0940, 0xffc4, 0xfe95, 0x0940, 0xffbe, 0xfe7b, 0x094a, 
-	0xffc4, 0xfe66, 0x0937, 0xffc4, 0xfe8c, 0x0933, 0xffc2, 0xfe79, 0x0938, 0xffd4, 0xfe66, 0x0936, 0xffd4, 0xfe8c, 0x0933, 0xffd6, 
-	0xfe7a, 0x0938, 0x0024, 0x0014, 0x0002, 0x0155, 0xfe82, 0x094f, 0x001d, 0x0430, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x014e, 0xfe67, 0x0955, 0x015e, 0xfe67, 0x0957, 0x0163, 0xfe83, 0x095c, 0x015d, 0xfe9d, 0x0952, 0x014e, 0xfe9c, 
-	0x0950, 0x0147, 0xfe82, 0x0959, 0x0150, 0xfe6d, 0x0947, 0x014f, 0xfe93, 0x0943, 0x014d, 0xfe80, 0x0948, 0x015f, 0xfe6e, 0x0949, 
-	0x015f, 0xfe93, 0x0945, 0x0161, 0xfe81, 0x094a, 0x0024, 0x0014, 0x0002, 0x02d9, 0xfe8d, 0x0995, 0x001c, 0x0431, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x02d4, 0xfe72, 0x0999, 0x02e3, 0xfe73, 0x099d, 0x02e7, 0xfe8f, 0x09a2, 0x02e2, 
-	0xfea8, 0x0997, 0x02d3, 0xfea8, 0x0994, 0x02cc, 0xfe8d, 0x099c, 0x02d7, 0xfe79, 0x098b, 0x02d6, 0xfe9f, 0x0988, 0x02d4, 0xfe8c, 
-	0x098c, 0x02e6, 0xfe7a, 0x098f, 0x02e5, 0xfe9f, 0x098b, 0x02e7, 0xfe8d, 0x0990, 0x0024, 0x0014, 0x0002, 0x0461, 0xfeb1, 0x09af, 
-	0x001d, 0x0432, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x045f, 0xfe95, 0x09b7, 0x046e, 0xfe98, 0x09b3, 
-	0x0470, 0xfeb4, 0x09b6, 0x0464, 0xfecc, 0x09ae, 0x0455, 0xfec9, 0x09b2, 0x0456, 0xfeaf, 0x09bd, 0x045a, 0xfe9b, 0x09aa, 0x0453, 
-	0xfec0, 0x09a6, 0x0456, 0xfead, 0x09ab, 0x0469, 0xfe9d, 0x09a5, 0x0462, 0xfec2, 0x09a2, 0x0468, 0xfeb1, 0x09a6, 0x0024, 0x0014, 
-	0x0002, 0x0544, 0xff1a, 0x08a1, 0x001f, 0x0433, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0555, 0xff00, 
-	0x08a2, 0x0556, 0xff06, 0x0893, 0x0550, 0xff21, 0x0896, 0x053d, 0xff33, 0x08a0, 0x053b, 0xff2e, 0x08af, 0x054e, 0xff18, 0x08b0, 
-	0x0545, 0xff01, 0x08a1, 0x0533, 0xff21, 0x08aa, 0x053f, 0xff12, 0x08a8, 0x0547, 0xff06, 0x0892, 0x0535, 0xff26, 0x089b, 0x0540, 
-	0xff18, 0x0895, 0x0024, 0x0014, 0x0002, 0x0409, 0x001e, 0x060d, 0x001c, 0x0438, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x041b, 0x000a, 0x0603, 0x0412, 0x0010, 0x05f7, 0x040a, 0x0029, 0x0601, 0x03ff, 0x0036, 0x0618, 0x0408, 0x0030, 
-	0x0623, 0x041a, 0x0020, 0x0616, 0x040e, 0x0007, 0x060c, 0x0401, 0x0022, 0x0623, 0x040b, 0x0016, 0x0618, 0x0405, 0x000d, 0x0600, 
-	0x03f8, 0x0028, 0x0617, 0x03ff, 0x001d, 0x0609, 0x0024, 0x0014, 0x0002, 0x031f, 0x00aa, 0x04ed, 0x001d, 0x0439, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0331, 0x0095, 0x04e2, 0x0328, 0x009b, 0x04d7, 0x0320, 0x00b5, 0x04e1, 0x0315, 
-	0x00c1, 0x04f9, 0x031f, 0x00bb, 0x0504, 0x0331, 0x00aa, 0x04f6, 0x0324, 0x0093, 0x04eb, 0x0317, 0x00ad, 0x0503, 0x0321, 0x00a1, 
-	0x04f8, 0x031b, 0x0098, 0x04e0, 0x030e, 0x00b3, 0x04f8, 0x0316, 0x00a8, 0x04ea, 0x0024, 0x0014, 0x0002, 0x0231, 0x0137, 0x03d2, 
-	0x001d, 0x043a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0243, 0x0123, 0x03c7, 0x0239, 0x0129, 0x03bc, 
-	0x0231, 0x0142, 0x03c7, 0x0227, 0x014e, 0x03de, 0x0231, 0x0149, 0x03e9, 0x0242, 0x0138, 0x03da, 0x0236, 0x0120, 0x03d1, 0x022a, 
-	0x013b, 0x03e9, 0x0233, 0x012f, 0x03dd, 0x022d, 0x0126, 0x03c5, 0x0220, 0x0140, 0x03de, 0x0227, 0x0135, 0x03cf, 0x0024, 0x0014, 
-	0x0002, 0x0129, 0x01ab, 0x02c4, 0x001d, 0x043b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x013b, 0x0199, 
-	0x02b8, 0x0130, 0x019d, 0x02ae, 0x0126, 0x01b6, 0x02b8, 0x011d, 0x01c2, 0x02d0, 0x0129, 0x01bf, 0x02da, 0x013b, 0x01af, 0x02ca, 
-	0x0130, 0x0195, 0x02c3, 0x0123, 0x01b0, 0x02db, 0x012d, 0x01a4, 0x02cf, 0x0125, 0x0199, 0x02b9, 0x0118, 0x01b3, 0x02d0, 0x011f, 
-	0x01a9, 0x02c2, 0x0024, 0x0014, 0x0002, 0xfff3, 0x01e3, 0x01d8, 0x001d, 0x043c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x0004, 0x01d2, 0x01cb, 0xfff8, 0x01d3, 0x01c2, 0xffec, 0x01eb, 0x01cb, 0xffe5, 0x01f9, 0x01e3, 0xfff2, 0x01f8, 
-	0x01ec, 0x0002, 0x01ea, 0x01da, 0xfffc, 0x01ce, 0x01d7, 0xffef, 0x01e9, 0x01ef, 0xfff9, 0x01dd, 0x01e2, 0xffef, 0x01cf, 0x01cf, 
-	0xffe2, 0x01ea, 0x01e6, 0xffe8, 0x01df, 0x01d8, 0x0024, 0x0014, 0x0002, 0xfd42, 0x01bc, 0x0057, 0x001c, 0x0442, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd54, 0x01ac, 0x004a, 0xfd47, 0x01ab, 0x0042, 0xfd39, 0x01c2, 0x004a, 0xfd30, 
-	0x01d0, 0x0061, 0xfd3e, 0x01d1, 0x0069, 0xfd51, 0x01c4, 0x0058, 0xfd4d, 0x01a8, 0x0057, 0xfd3d, 0x01c2, 0x006d, 0xfd47, 0x01b7, 
-	0x0061, 0xfd3f, 0x01a7, 0x004f, 0xfd30, 0x01c1, 0x0065, 0xfd37, 0x01b6, 0x0057, 0x0024, 0x0014, 0x0002, 0xfc1d, 0x01bb, 0xff57, 
-	0x001c, 0x0443, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc32, 0x01a9, 0xff51, 0xfc2a, 0x01ab, 0xff44, 
-	0xfc1d, 0x01c4, 0xff48, 0xfc0c, 0x01d1, 0xff5b, 0xfc14, 0x01ce, 0xff69, 0xfc2b, 0x01c0, 0xff60, 0xfc24, 0x01a5, 0xff58, 0xfc0f, 
-	0x01c0, 0xff69, 0xfc1d, 0x01b4, 0xff61, 0xfc1d, 0x01a7, 0xff4b, 0xfc07, 0x01c2, 0xff5b, 0xfc13, 0x01b7, 0xff51, 0x0024, 0x0014, 
-	0x0002, 0xfbf5, 0x021c, 0xfde5, 0x001d, 0x0444, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc07, 0x0206, 
-	0xfde8, 0xfc09, 0x020a, 0xfdd9, 0xfbff, 0x0225, 0xfdd8, 0xfbe8, 0x0234, 0xfddf, 0xfbe6, 0x0230, 0xfdee, 0xfbfb, 0x021e, 0xfdf3, 
-	0xfbf7, 0x0205, 0xfde5, 0xfbe0, 0x0223, 0xfde9, 0xfbee, 0x0215, 0xfdea, 0xfbf9, 0x0209, 0xfdd6, 0xfbe2, 0x0226, 0xfdda, 0xfbf0, 
-	0x021a, 0xfdd7, 0x0024, 0x0014, 0x0002, 0xfc5b, 0x025d, 0xfc6d, 0x001d, 0x0445, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfc68, 0x0247, 0xfc7b, 0xfc6f, 0x0248, 0xfc6d, 0xfc6a, 0x0263, 0xfc65, 0xfc55, 0x0275, 0xfc61, 0xfc4d, 0x0274, 
-	0xfc6e, 0xfc5c, 0x0261, 0xfc7d, 0xfc5a, 0x0246, 0xfc73, 0xfc47, 0x0266, 0xfc6a, 0xfc52, 0x0258, 0xfc71, 0xfc62, 0x0247, 0xfc65, 
-	0xfc4f, 0x0267, 0xfc5c, 0xfc5c, 0x0259, 0xfc60, 0x0024, 0x0014, 0x0002, 0xff3e, 0x0259, 0xfbb8, 0x001d, 0x044c, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xff36, 0x0243, 0xfbca, 0xff46, 0x0243, 0xfbc9, 0xff4c, 0x025d, 0xfbc1, 0xff45, 
-	0x0270, 0xfbac, 0xff35, 0x0270, 0xfbad, 0xff30, 0x025d, 0xfbc2, 0xff36, 0x0242, 0xfbba, 0xff35, 0x0262, 0xfba6, 0xff33, 0x0254, 
-	0xfbb2, 0xff45, 0x0242, 0xfbba, 0xff45, 0x0262, 0xfba5, 0xff47, 0x0254, 0xfbb2, 0x0024, 0x0014, 0x0002, 0x00c8, 0x0257, 0xfbaf, 
-	0x001d, 0x044d, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x00c0, 0x0241, 0xfbc1, 0x00d0, 0x0241, 0xfbc1, 
-	0x00d6, 0x025c, 0xfbb8, 0x00d0, 0x026e, 0xfba4, 0x00c1, 0x026e, 0xfba4, 0x00ba, 0x025c, 0xfbb8, 0x00c0, 0x0241, 0xfbb1, 0x00c0, 
-	0x0260, 0xfb9d, 0x00be, 0x0252, 0xfba9, 0x00d0, 0x0240, 0xfbb1, 0x00d0, 0x0260, 0xfb9c, 0x00d2, 0x0252, 0xfba9, 0x0024, 0x0014, 
-	0x0002, 0x0251, 0x0246, 0xfbc7, 0x001d, 0x044e, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0244, 0x0232, 
-	0xfbd6, 0x0253, 0x0230, 0xfbda, 0x025e, 0x024a, 0xfbd3, 0x025f, 0x025c, 0xfbbe, 0x0250, 0x025e, 0xfbba, 0x0243, 0x024d, 0xfbcd, 
-	0x0248, 0x0231, 0xfbc7, 0x0250, 0x0250, 0xfbb3, 0x024a, 0x0243, 0xfbbf, 0x0257, 0x022f, 0xfbcb, 0x025f, 0x024e, 0xfbb7, 0x025d, 
-	0x0240, 0xfbc4, 0x0024, 0x0014, 0x0002, 0x03e3, 0x015c, 0xfe1b, 0x001e, 0x0456, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x03cb, 0x0151, 0xfe12, 0x03cf, 0x014c, 0xfe21, 0x03e2, 0x0160, 0xfe29, 0x03fa, 0x016d, 0xfe20, 0x03f6, 0x0172, 
-	0xfe11, 0x03db, 0x0169, 0xfe0f, 0x03d9, 0x014c, 0xfe0d, 0x03f7, 0x0163, 0xfe0c, 0x03e6, 0x015b, 0xfe0c, 0x03dd, 0x0147, 0xfe1b, 
-	0x03fb, 0x015f, 0xfe1a, 0x03eb, 0x0155, 0xfe1e, 0x0024, 0x0014, 0x0002, 0x043e, 0x00ee, 0xff8b, 0x001e, 0x0457, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0427, 0x00e2, 0xff82, 0x042a, 0x00de, 0xff91, 0x043d, 0x00f3, 0xff99, 0x0455, 
-	0x00ff, 0xff91, 0x0452, 0x0103, 0xff82, 0x0437, 0x00fa, 0xff7f, 0x0435, 0x00dd, 0xff7e, 0x0453, 0x00f4, 0xff7d, 0x0442, 0x00eb, 
-	0xff7d, 0x0438, 0x00d9, 0xff8d, 0x0456, 0x00f0, 0xff8c, 0x0446, 0x00e6, 0xff8f, 0x0024, 0x0014, 0x0002, 0x0489, 0x009a, 0x0105, 
-	0x001e, 0x0458, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0472, 0x008e, 0x00fd, 0x0475, 0x008b, 0x010c, 
-	0x0487, 0x00a0, 0x0113, 0x049f, 0x00ac, 0x010a, 0x049c, 0x00af, 0x00fb, 0x0482, 0x00a5, 0x00f8, 0x0480, 0x0088, 0x00f9, 0x049e, 
-	0x00a0, 0x00f8, 0x048d, 0x0097, 0x00f8, 0x0483, 0x0086, 0x0109, 0x04a1, 0x009d, 0x0107, 0x0490, 0x0093, 0x010b, 0x0024, 0x0014, 
-	0x0002, 0x04f7, 0x0054, 0x040f, 0x001d, 0x0460, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x04e0, 0x0047, 
-	0x0409, 0x04e2, 0x0046, 0x0419, 0x04f3, 0x005d, 0x041d, 0x050c, 0x0068, 0x0415, 0x050a, 0x0068, 0x0405, 0x04f0, 0x005d, 0x0402, 
-	0x04ef, 0x0041, 0x0408, 0x050c, 0x0058, 0x0405, 0x04fc, 0x004f, 0x0404, 0x04f0, 0x0041, 0x0417, 0x050e, 0x0058, 0x0414, 0x04fe, 
-	0x004f, 0x0418, 0x0024, 0x0014, 0x0002, 0x051a, 0x005c, 0x0599, 0x001d, 0x0461, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x0504, 0x004e, 0x0593, 0x0505, 0x004f, 0x05a3, 0x0516, 0x0065, 0x05a7, 0x052f, 0x0070, 0x059e, 0x052e, 0x006f, 
-	0x058f, 0x0514, 0x0064, 0x058b, 0x0512, 0x0048, 0x0592, 0x0530, 0x0060, 0x058f, 0x051f, 0x0056, 0x058f, 0x0513, 0x0049, 0x05a2, 
-	0x0531, 0x0060, 0x059f, 0x0521, 0x0057, 0x05a2, 0x0024, 0x0014, 0x0002, 0x0530, 0x0076, 0x0723, 0x001e, 0x0462, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x051a, 0x0068, 0x071e, 0x051b, 0x006a, 0x072d, 0x052b, 0x0080, 0x0731, 0x0545, 
-	0x008b, 0x0729, 0x0544, 0x0089, 0x0719, 0x052a, 0x007e, 0x0715, 0x0529, 0x0062, 0x071d, 0x0546, 0x007a, 0x071a, 0x0535, 0x0070, 
-	0x071a, 0x0529, 0x0064, 0x072d, 0x0547, 0x007b, 0x072a, 0x0536, 0x0072, 0x072d, 0x0024, 0x0014, 0x0002, 0x053b, 0x00a4, 0x08ab, 
-	0x001d, 0x0463, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0525, 0x0096, 0x08a7, 0x0525, 0x0098, 0x08b6, 
-	0x0536, 0x00af, 0x08b9, 0x054f, 0x00b9, 0x08b0, 0x054f, 0x00b7, 0x08a1, 0x0535, 0x00ab, 0x089d, 0x0534, 0x0090, 0x08a8, 0x0551, 
-	0x00a7, 0x08a3, 0x0541, 0x009e, 0x08a3, 0x0534, 0x0093, 0x08b7, 0x0552, 0x00aa, 0x08b3, 0x0541, 0x00a1, 0x08b7, 0x0024, 0x0014, 
-	0x0002, 0x0543, 0x0103, 0x0a2a, 0x001d, 0x0464, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x052d, 0x00f3, 
-	0x0a29, 0x052d, 0x00f9, 0x0a38, 0x053d, 0x0110, 0x0a36, 0x0557, 0x0118, 0x0a2c, 0x0556, 0x0113, 0x0a1d, 0x053d, 0x0106, 0x0a1b, 
-	0x053b, 0x00ee, 0x0a2b, 0x0559, 0x0104, 0x0a22, 0x0548, 0x00fb, 0x0a24, 0x053c, 0x00f4, 0x0a3a, 0x0559, 0x010a, 0x0a31, 0x0548, 
-	0x0101, 0x0a36, 0x0024, 0x0014, 0x0002, 0x0528, 0x01cc, 0x0b7a, 0x001c, 0x0465, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0x0515, 0x01b8, 0x0b79, 0x0511, 0x01c2, 0x0b84, 0x051f, 0x01d9, 0x0b7d, 0x0539, 0x01e2, 0x0b77, 0x053e, 0x01d8, 
-	0x0b6c, 0x0527, 0x01c7, 0x0b69, 0x0523, 0x01b6, 0x0b80, 0x0540, 0x01cd, 0x0b77, 0x0530, 0x01c2, 0x0b78, 0x051e, 0x01c0, 0x0b8b, 
-	0x053b, 0x01d7, 0x0b82, 0x052b, 0x01ce, 0x0b86, 0x0024, 0x0014, 0x0002, 0x02a3, 0x030f, 0x0be4, 0x001c, 0x046a, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x02a4, 0x02f3, 0x0be4, 0x0296, 0x02f7, 0x0be0, 0x0299, 0x0312, 0x0bd8, 0x02a4, 
-	0x032b, 0x0be0, 0x02b2, 0x0327, 0x0be4, 0x02b3, 0x030b, 0x0bdf, 0x02a3, 0x02fc, 0x0bf1, 0x02ad, 0x0320, 0x0bf1, 0x02ab, 0x030d, 
-	0x0bef, 0x0294, 0x0300, 0x0bed, 0x029e, 0x0324, 0x0bee, 0x0298, 0x0312, 0x0bea, 0x0024, 0x0014, 0x0002, 0x013d, 0x0372, 0x0b5e, 
-	0x001c, 0x046b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x013e, 0x0356, 0x0b60, 0x0130, 0x035a, 0x0b59, 
-	0x0135, 0x0375, 0x0b50, 0x013f, 0x038e, 0x0b59, 0x014c, 0x038a, 0x0b60, 0x014e, 0x036e, 0x0b5c, 0x013b, 0x0360, 0x0b6c, 0x0145, 
-	0x0384, 0x0b6c, 0x0143, 0x0371, 0x0b6a, 0x012d, 0x0363, 0x0b66, 0x0137, 0x0388, 0x0b66, 0x0132, 0x0376, 0x0b62, 0x0024, 0x0014, 
-	0x0002, 0xfff6, 0x03cc, 0x0a95, 0x001c, 0x046c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 
-	0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 
-	0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfff8, 0x03b1, 
-	0x0a99, 0xffeb, 0x03b5, 0x0a90, 0xfff2, 0x03cf, 0x0a86, 0xfff9, 0x03e8, 0x0a8f, 0x0004, 0x03e5, 0x0a99, 0x0006, 0x03c9, 0x0a97, 
-	0xfff2, 0x03bb, 0x0aa4, 0xfffb, 0x03e0, 0x0aa3, 0xfffa, 0x03cd, 0x0aa2, 0xffe6, 0x03be, 0x0a9a, 0xffef, 0x03e3, 0x0a9a, 0xffeb, 
-	0x03d1, 0x0a97, 0x0024, 0x0014, 0x0002, 0xfeeb, 0x03fb, 0x097a, 0x001d, 0x046d, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 
-	0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 
-	0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 
-	0x0000, 0x0003, 0xfeed, 0x03e2, 0x0984, 0xfee5, 0x03e1, 0x0977, 0xfeed, 0x03fa, 0x096b, 0xfeee, 0x0416, 0x0971, 0xfef6, 0x0416, 
-	0x097e, 0xfefb, 0x03fb, 0x0983, 0xfee3, 0x03ec, 0x098a, 0xfee9, 0x0411, 0x0986, 0xfeea, 0x03fe, 0x0988, 0xfedb, 0x03ec, 0x097d, 
-	0xfee1, 0x0411, 0x0978, 0xfee0, 0x03fe, 0x0977, 0x0024, 0x0014, 0x0002, 0xfe8b, 0x03b7, 0x0809, 0x001c, 0x046e, 0x0006, 0x000f, 
-	0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 
-	0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000, 
-	0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe8c, 0x03a0, 0x0819, 0xfe8b, 0x039b, 0x080a, 0xfe95, 0x03b2, 0x07fc, 0xfe91, 
-	0x03ce, 0x07fa, 0xfe92, 0x03d3, 0x080a, 0xfe96, 0x03ba, 0x0817, 0xfe7f, 0x03a9, 0x0816, 0xfe84, 0x03cd, 0x080c, 0xfe84, 0x03bb, 
-	0x0813, 0xfe7f, 0x03a4, 0x0807, 0xfe83, 0x03c8, 0x07fd, 0xfe84, 0x03b6, 0x0800, 0x0048, 0x0030, 0x0002, 0x0468, 0x0299, 0x0731, 
-	0x0059, 0x0064, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x0445, 0x02e2, 0x070c, 0x0450, 0x02d5, 0x0723, 0x0416, 0x02b9, 0x0724, 0x042d, 0x02b7, 0x0735, 0x044f, 0x02c7, 
-	0x070a, 0x042c, 0x02a9, 0x071b, 0x0416, 0x027d, 0x0744, 0x042e, 0x028c, 0x074c, 0x042d, 0x027e, 0x0732, 0x0446, 0x0252, 0x0759, 
-	0x0450, 0x026d, 0x075b, 0x044f, 0x025f, 0x0741, 0x048a, 0x0251, 0x0757, 0x0481, 0x026d, 0x0759, 0x0480, 0x025f, 0x0740, 0x04ba, 
-	0x027b, 0x073f, 0x04a3, 0x028b, 0x0748, 0x04a2, 0x027d, 0x072e, 0x04ba, 0x02b7, 0x071f, 0x04a3, 0x02b6, 0x0731, 0x04a2, 0x02a8, 
-	0x0717, 0x0489, 0x02e2, 0x070a, 0x0480, 0x02d4, 0x0722, 0x047f, 0x02c7, 0x0708, 0x0048, 0x0030, 0x0002, 0x04a5, 0x000f, 0xfea9, 
-	0x0058, 0x0065, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x047e, 0x005d, 0xfeb8, 0x0486, 0x0043, 0xfec1, 0x0454, 0x0030, 0xfe9d, 0x0467, 0x0022, 0xfeae, 0x048d, 0x004c, 
-	0xfea6, 0x046e, 0x002b, 0xfe93, 0x0459, 0xfff0, 0xfe89, 0x046b, 0xfff5, 0xfea0, 0x0472, 0xfffd, 0xfe85, 0x048b, 0xffc2, 0xfe88, 
-	0x048e, 0xffd4, 0xfe9f, 0x0496, 0xffdc, 0xfe84, 0x04cc, 0xffc2, 0xfe9a, 0x04bd, 0xffd3, 0xfeab, 0x04c5, 0xffdc, 0xfe91, 0x04f7, 
-	0xffef, 0xfeb4, 0x04dc, 0xfff4, 0xfebe, 0x04e3, 0xfffd, 0xfea4, 0x04f2, 0x002f, 0xfec8, 0x04d9, 0x0021, 0xfecd, 0x04e0, 0x002a, 
-	0xfeb2, 0x04c0, 0x005d, 0xfeca, 0x04b5, 0x0042, 0xfece, 0x04bc, 0x004b, 0xfeb3, 0x0048, 0x0030, 0x0002, 0xfe74, 0x00a6, 0xfd50, 
-	0x0059, 0x0066, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfe59, 0x00ef, 0xfd7b, 0xfe6c, 0x00d9, 0xfd78, 0xfe40, 0x00b5, 0xfd96, 0xfe5b, 0x00b0, 0xfd8b, 0xfe55, 0x00db, 
-	0xfd66, 0xfe44, 0x00b2, 0xfd79, 0xfe46, 0x0073, 0xfd87, 0xfe5f, 0x0081, 0xfd80, 0xfe48, 0x0083, 0xfd6f, 0xfe67, 0x004f, 0xfd58, 
-	0xfe76, 0x0067, 0xfd5e, 0xfe5f, 0x0069, 0xfd4d, 0xfe90, 0x005e, 0xfd24, 0xfe94, 0x0072, 0xfd39, 0xfe7c, 0x0074, 0xfd27, 0xfea8, 
-	0x0098, 0xfd09, 0xfea5, 0x009b, 0xfd26, 0xfe8e, 0x009d, 0xfd14, 0xfea3, 0x00da, 0xfd18, 0xfea1, 0x00ca, 0xfd30, 0xfe8a, 0x00cc, 
-	0xfd1f, 0xfe82, 0x00fe, 0xfd47, 0xfe8a, 0x00e4, 0xfd52, 0xfe72, 0x00e6, 0xfd41, 0x0048, 0x0030, 0x0002, 0xfc67, 0x0038, 0x0295, 
-	0x0058, 0x0067, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfca2, 0x0079, 0x028e, 0xfc8d, 0x0069, 0x0282, 0xfcbc, 0x003c, 0x027c, 0xfc9f, 0x003d, 0x0275, 0xfc96, 0x0064, 
-	0x029e, 0xfca8, 0x0038, 0x0291, 0xfca3, 0xfffe, 0x0278, 0xfc8e, 0x0010, 0x0272, 0xfc96, 0x000b, 0x028e, 0xfc67, 0xffe1, 0x0285, 
-	0xfc63, 0xfffc, 0x027c, 0xfc6b, 0xfff7, 0x0297, 0xfc2b, 0xfff7, 0x029c, 0xfc38, 0x000b, 0x028c, 0xfc40, 0x0006, 0x02a8, 0xfc12, 
-	0x0032, 0x02ae, 0xfc25, 0x0036, 0x0299, 0xfc2e, 0x0031, 0x02b5, 0xfc2a, 0x0071, 0x02b2, 0xfc37, 0x0063, 0x029c, 0xfc40, 0x005e, 
-	0x02b8, 0xfc66, 0x008f, 0x02a5, 0xfc62, 0x0078, 0x0293, 0xfc6a, 0x0073, 0x02ae, 0x0048, 0x0030, 0x0002, 0x0012, 0xfef8, 0x0b01, 
-	0x0059, 0x0068, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x004a, 0xff3b, 0x0af2, 0x0033, 0xff2b, 0x0aea, 0x0060, 0xff00, 0x0ad9, 0x0043, 0xff00, 0x0ad8, 0x0041, 0xff25, 
-	0x0b03, 0x0051, 0xfefb, 0x0af1, 0x0048, 0xfec0, 0x0ad7, 0x0032, 0xfed3, 0x0ad7, 0x003f, 0xfecd, 0x0af0, 0x0010, 0xfea1, 0x0aee, 
-	0x000a, 0xfebc, 0x0ae7, 0x0017, 0xfeb7, 0x0b00, 0xffda, 0xfeb5, 0x0b10, 0xffe3, 0xfecb, 0x0b00, 0xfff1, 0xfec5, 0x0b19, 0xffc4, 
-	0xfef0, 0x0b2a, 0xffd3, 0xfef5, 0x0b12, 0xffe1, 0xfeef, 0x0b2b, 0xffdc, 0xff30, 0x0b2b, 0xffe4, 0xff23, 0x0b13, 0xfff2, 0xff1d, 
-	0x0b2c, 0x0013, 0xff4f, 0x0b14, 0x000b, 0xff39, 0x0b02, 0x0019, 0xff33, 0x0b1b, 0x0048, 0x0030, 0x0002, 0x0321, 0xff95, 0x028c, 
-	0x0059, 0x0069, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x030a, 0xffd9, 0x02c0, 0x031d, 0xffc5, 0x02b9, 0x02f5, 0xff9e, 0x02d8, 0x030e, 0xff9a, 0x02ca, 0x0305, 0xffc7, 
-	0x02aa, 0x02f5, 0xff9d, 0x02bb, 0x02f9, 0xff5d, 0x02c4, 0x0311, 0xff6b, 0x02bc, 0x02f8, 0xff6e, 0x02ad, 0x0315, 0xff3d, 0x0290, 
-	0x0325, 0xff54, 0x0296, 0x030d, 0xff57, 0x0287, 0x0339, 0xff50, 0x0259, 0x033f, 0xff62, 0x026f, 0x0326, 0xff65, 0x0260, 0x034e, 
-	0xff8c, 0x0240, 0x034e, 0xff8d, 0x025d, 0x0335, 0xff90, 0x024e, 0x034a, 0xffcd, 0x0254, 0x034b, 0xffbb, 0x026b, 0x0332, 0xffbe, 
-	0x025c, 0x032e, 0xffed, 0x0289, 0x0337, 0xffd2, 0x0291, 0x031e, 0xffd5, 0x0282, 0x0048, 0x0030, 0x0002, 0xfc43, 0xff50, 0x02fb, 
-	0x0059, 0x006a, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfc66, 0xff9b, 0x031b, 0xfc5f, 0xff89, 0x0305, 0xfc93, 0xff68, 0x0318, 0xfc80, 0xff65, 0x0303, 0xfc58, 0xff81, 
-	0x0320, 0xfc79, 0xff5d, 0x031e, 0xfc92, 0xff27, 0x0304, 0xfc7f, 0xff37, 0x02f4, 0xfc78, 0xff2e, 0x030f, 0xfc62, 0xfefe, 0x02eb, 
-	0xfc5d, 0xff19, 0x02e3, 0xfc56, 0xff11, 0x02fe, 0xfc20, 0xff04, 0x02dc, 0xfc2e, 0xff1d, 0x02d7, 0xfc26, 0xff15, 0x02f3, 0xfbf3, 
-	0xff36, 0x02df, 0xfc0d, 0xff41, 0x02da, 0xfc06, 0xff39, 0x02f5, 0xfbf4, 0xff77, 0x02f3, 0xfc0e, 0xff70, 0x02e8, 0xfc07, 0xff68, 
-	0x0303, 0xfc24, 0xffa1, 0x030c, 0xfc30, 0xff8e, 0x02fa, 0xfc29, 0xff86, 0x0315, 0x0048, 0x0030, 0x0002, 0xfe42, 0xfe7a, 0x0958, 
-	0x0059, 0x006b, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfe3f, 0xfec8, 0x092f, 0xfe31, 0xfeb2, 0x093d, 0xfe38, 0xfe93, 0x0904, 0xfe2d, 0xfe8c, 0x091e, 0xfe4e, 0xfeb1, 
-	0x0939, 0xfe49, 0xfe8c, 0x091b, 0xfe38, 0xfe50, 0x090b, 0xfe2c, 0xfe5c, 0x0923, 0xfe49, 0xfe5b, 0x091f, 0xfe3c, 0xfe25, 0x093f, 
-	0xfe2f, 0xfe3d, 0x0948, 0xfe4c, 0xfe3c, 0x0945, 0xfe44, 0xfe2b, 0x0982, 0xfe35, 0xfe42, 0x0978, 0xfe52, 0xfe41, 0x0975, 0xfe4a, 
-	0xfe5f, 0x09ad, 0xfe39, 0xfe67, 0x0997, 0xfe56, 0xfe66, 0x0994, 0xfe4b, 0xfea3, 0x09a7, 0xfe3a, 0xfe98, 0x0992, 0xfe57, 0xfe97, 
-	0x098f, 0xfe46, 0xfece, 0x0972, 0xfe36, 0xfeb7, 0x096d, 0xfe53, 0xfeb6, 0x096a, 0x0048, 0x0030, 0x0002, 0x04e1, 0xff9a, 0x073e, 
-	0x0059, 0x006c, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x04a5, 0xffc2, 0x0771, 0x04bc, 0xffb2, 0x076f, 0x0493, 0xff83, 0x0762, 0x04b0, 0xff84, 0x0764, 0x04af, 0xffbb, 
-	0x0757, 0x04a2, 0xff8e, 0x074c, 0x04af, 0xff50, 0x073e, 0x04c4, 0xff60, 0x074a, 0x04b6, 0xff6a, 0x0732, 0x04e8, 0xff49, 0x071a, 
-	0x04ed, 0xff5b, 0x0731, 0x04df, 0xff64, 0x0719, 0x051d, 0xff70, 0x070c, 0x0513, 0xff77, 0x0726, 0x0505, 0xff81, 0x070e, 0x052f, 
-	0xffb0, 0x071b, 0x0520, 0xffa5, 0x0731, 0x0512, 0xffae, 0x0719, 0x0513, 0xffe3, 0x073f, 0x050c, 0xffc9, 0x074b, 0x04fe, 0xffd3, 
-	0x0733, 0x04da, 0xffea, 0x0763, 0x04e3, 0xffce, 0x0765, 0x04d5, 0xffd8, 0x074d, 0x0048, 0x0030, 0x0002, 0xfe9d, 0x01db, 0x0113, 
-	0x0059, 0x006d, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfe74, 0x01fd, 0x015b, 0xfe8c, 0x01f4, 0x014e, 0xfe78, 0x01b9, 0x015d, 0xfe8f, 0x01c4, 0x014f, 0xfe73, 0x01f2, 
-	0x0140, 0xfe76, 0x01c2, 0x0141, 0xfe92, 0x0189, 0x0133, 0xfea2, 0x01a1, 0x0131, 0xfe88, 0x01a0, 0x0124, 0xfeb2, 0x018a, 0x00f7, 
-	0xfeb8, 0x01a2, 0x0106, 0xfe9f, 0x01a0, 0x00f9, 0xfec5, 0x01ba, 0x00cc, 0xfec6, 0x01c4, 0x00e7, 0xfead, 0x01c3, 0x00d9, 0xfec1, 
-	0x01fe, 0x00ca, 0xfec3, 0x01f5, 0x00e6, 0xfeaa, 0x01f3, 0x00d8, 0xfea7, 0x022d, 0x00f3, 0xfeb1, 0x0217, 0x0103, 0xfe97, 0x0215, 
-	0x00f6, 0xfe88, 0x022d, 0x0130, 0xfe9a, 0x0217, 0x012e, 0xfe81, 0x0215, 0x0121, 0x0048, 0x0030, 0x0002, 0xfdb2, 0x0258, 0xfbcf, 
-	0x0059, 0x006e, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0xfdab, 0x028b, 0xfb86, 0xfd9f, 0x027d, 0xfb9c, 0xfda9, 0x0248, 0xfb78, 0xfd9d, 0x024d, 0xfb92, 0xfdbc, 0x027c, 
-	0xfb99, 0xfdba, 0x024d, 0xfb8f, 0xfdac, 0x020f, 0xfb9d, 0xfd9f, 0x0224, 0xfbac, 0xfdbc, 0x0224, 0xfba9, 0xfdb2, 0x0201, 0xfbdf, 
-	0xfda4, 0x021a, 0xfbdc, 0xfdc1, 0x021a, 0xfbd9, 0xfdb9, 0x0226, 0xfc17, 0xfda9, 0x0234, 0xfc04, 0xfdc6, 0x0234, 0xfc01, 0xfdbc, 
-	0x0268, 0xfc25, 0xfdaa, 0x0264, 0xfc0e, 0xfdc7, 0x0264, 0xfc0b, 0xfdb9, 0x02a1, 0xfc01, 0xfda8, 0x028d, 0xfbf4, 0xfdc5, 0x028c, 
-	0xfbf1, 0xfdb2, 0x02b0, 0xfbbf, 0xfda3, 0x0297, 0xfbc5, 0xfdc0, 0x0297, 0xfbc2, 0x0048, 0x0030, 0x0002, 0x0365, 0x01db, 0xfcb7, 
-	0x0059, 0x006f, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x03b4, 0x01f9, 0xfc9c, 0x0397, 0x01f6, 0xfc97, 0x03a8, 0x01b9, 0xfc88, 0x038f, 0x01c8, 0xfc89, 0x03a3, 0x01ec, 
-	0xfcb0, 0x039b, 0x01be, 0xfca2, 0x0375, 0x018d, 0xfc90, 0x036a, 0x01a8, 0xfc8f, 0x0376, 0x019f, 0xfca8, 0x0338, 0x018f, 0xfcaf, 
-	0x033f, 0x01a9, 0xfca5, 0x034b, 0x01a0, 0xfcbe, 0x0316, 0x01bd, 0xfcd3, 0x0326, 0x01cb, 0xfcbf, 0x0332, 0x01c1, 0xfcd7, 0x0322, 
-	0x01fd, 0xfce6, 0x032f, 0x01f9, 0xfccd, 0x033b, 0x01ef, 0xfce5, 0x0355, 0x0229, 0xfcde, 0x0353, 0x0218, 0xfcc7, 0x035f, 0x020e, 
-	0xfce0, 0x0391, 0x0228, 0xfcbf, 0x037f, 0x0217, 0xfcb1, 0x038b, 0x020d, 0xfcc9, 0x0048, 0x0030, 0x0002, 0x04c7, 0x0065, 0x0286, 
-	0x0058, 0x0070, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x051c, 0x007d, 0x027c, 0x0502, 0x0077, 0x0271, 0x0513, 0x003a, 0x0278, 0x04fc, 0x0047, 0x026d, 0x0506, 0x0075, 
-	0x028e, 0x0500, 0x0045, 0x028a, 0x04de, 0x0010, 0x027b, 0x04d5, 0x0029, 0x0270, 0x04d9, 0x0027, 0x028d, 0x049b, 0x0018, 0x0286, 
-	0x04a6, 0x002f, 0x0277, 0x04aa, 0x002c, 0x0294, 0x0472, 0x004d, 0x0290, 0x0488, 0x0055, 0x027f, 0x048c, 0x0052, 0x029c, 0x047b, 
-	0x0090, 0x0295, 0x048e, 0x0085, 0x0282, 0x0493, 0x0082, 0x029f, 0x04b0, 0x00ba, 0x0291, 0x04b5, 0x00a3, 0x0280, 0x04b9, 0x00a0, 
-	0x029c, 0x04f3, 0x00b2, 0x0287, 0x04e5, 0x009d, 0x0278, 0x04e9, 0x009b, 0x0295, 0x0048, 0x0030, 0x0002, 0x0419, 0x029c, 0x0c13, 
-	0x0059, 0x0071, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 
-	0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 
-	0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 
-	0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 
-	0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 
-	0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 
-	0x0000, 0x0003, 0x0439, 0x02e8, 0x0c35, 0x043e, 0x02ce, 0x0c2a, 0x042a, 0x02ba, 0x0c65, 0x0433, 0x02ad, 0x0c4d, 0x0422, 0x02d8, 
-	0x0c2c, 0x0418, 0x02b7, 0x0c4e, 0x0412, 0x027b, 0x0c64, 0x0422, 0x027f, 0x0c4c, 0x0406, 0x028a, 0x0c4e, 0x03fe, 0x024f, 0x0c34, 
-	0x0413, 0x0260, 0x0c2a, 0x03f8, 0x026a, 0x0c2c, 0x03fa, 0x0251, 0x0bf0, 0x0410, 0x0261, 0x0bf9, 0x03f5, 0x026c, 0x0bfb, 0x0409, 
-	0x027f, 0x0bc1, 0x041b, 0x0282, 0x0bd7, 0x0400, 0x028d, 0x0bd9, 0x0421, 0x02bf, 0x0bc1, 0x042c, 0x02b0, 0x0bd7, 0x0411, 0x02ba, 
-	0x0bd9, 0x0435, 0x02ea, 0x0bf1, 0x043b, 0x02cf, 0x0bfa, 0x0420, 0x02d9, 0x0bfc, 0x0024, 0x0014, 0x0002, 0xfea0, 0x032f, 0x067d, 
-	0x001d, 0x046f, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021, 0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 
-	0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b, 0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 
-	0x0012, 0x0000, 0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe9e, 0x0318, 0x068b, 0xfea1, 0x0314, 0x067c, 
-	0xfeae, 0x032b, 0x0671, 0xfeaa, 0x0347, 0x066f, 0xfea7, 0x034b, 0x067e, 0xfea9, 0x0333, 0x068c, 0xfe92, 0x0321, 0x0686, 0xfe99, 
-	0x0346, 0x067d, 0xfe98, 0x0334, 0x0684, 0xfe95, 0x031d, 0x0677, 0xfe9c, 0x0341, 0x066e, 0xfe9c, 0x032e, 0x0671, 0x000c, 0x0002, 
-	0x0003, 0xfcb4, 0x0000, 0xfc6a, 0x01a3, 0x0000, 0x0000, 0x0006, 0x0003, 0x0003, 0x0006, 0x0009, 0xfb9a, 0x0000, 0xfc93, 0xfb9a, 
-	0x0000, 0xfb34, 0xfdcd, 0x0000, 0xfda0, 0xfdcd, 0x0000, 0xfb34, 0x000f, 0x0003, 0x0003, 0xfcb4, 0x0000, 0xfe21, 0x01e7, 0x0000, 
-	0x0009, 0x0000, 0x000c, 0x0009, 0x000c, 0x0006, 0x0006, 0x000c, 0x0003, 0xfce4, 0x0000, 0xffaf, 0xfb9a, 0x0000, 0xfc93, 0xfbb9, 
-	0x0000, 0xfd6a, 0xfbf0, 0x0000, 0xfe42, 0xfdcd, 0x0000, 0xfda0, 0x000c, 0x0002, 0x0003, 0x034c, 0x0000, 0xfc67, 0x01a0, 0x0000, 
-	0x0000, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0233, 0x0000, 0xfd9a, 0x0466, 0x0000, 0xfc93, 0x0466, 0x0000, 0xfb34, 0x0233, 
-	0x0000, 0xfb34, 0x000f, 0x0003, 0x0003, 0x034c, 0x0000, 0xfe21, 0x01e7, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x0009, 0x000c, 
-	0x0000, 0x0006, 0x000c, 0x031c, 0x0000, 0xffaf, 0x0466, 0x0000, 0xfc93, 0x0410, 0x0000, 0xfe42, 0x0447, 0x0000, 0xfd6a, 0x0233, 
-	0x0000, 0xfd9a, 0x000c, 0x0002, 0x0003, 0x0113, 0x0004, 0xffab, 0x0154, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0006, 0x0003, 
-	0x0125, 0x0000, 0x00d7, 0x0221, 0x0000, 0x0060, 0x0006, 0x0008, 0xfedb, 0x0131, 0x0000, 0xfe7f, 0x000c, 0x0002, 0x0003, 0x0226, 
-	0x0000, 0xfefd, 0x0163, 0x0000, 0x0003, 0x0000, 0x0006, 0x0006, 0x0009, 0x0003, 0x031c, 0x0000, 0xffaf, 0x0221, 0x0000, 0x0060, 
-	0x0233, 0x0000, 0xfd9a, 0x0131, 0x0000, 0xfe7f, 0x000c, 0x0002, 0x0003, 0x0000, 0x0004, 0xffe9, 0x0179, 0x0000, 0x0003, 0x0009, 
-	0x0000, 0x0003, 0x0006, 0x0009, 0xfedb, 0x0000, 0x00d7, 0x0000, 0x0000, 0x00f6, 0x0125, 0x0000, 0x00d7, 0x0006, 0x0008, 0xfedb, 
-	0x000c, 0x0002, 0x0003, 0xfef3, 0x0004, 0xffb5, 0x015e, 0x0000, 0x0000, 0x0006, 0x0003, 0x0006, 0x0009, 0x0003, 0xfedb, 0x0000, 
-	0x00d7, 0xfddf, 0x0000, 0x0060, 0x0006, 0x0008, 0xfedb, 0xfecc, 0x0000, 0xfe93, };
+	0x6d69, 0x6c64, 0x0116, 0x0003, 0xfb9d, 0xff93, 0xfcc5, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0009, 0x0003, 0x0012, 0x000f, 0x000f, 
+	0x0012, 0x0015, 0x000f, 0x0015, 0x0009, 0xfb85, 0xfef9, 0xfc93, 0xfb85, 0xfef9, 0xfcf7, 0xfb85, 0x002d, 0xfc93, 0xfbb4, 0x002d, 
+	0xfc93, 0xfbb4, 0xfef9, 0xfc93, 0xfb85, 0x002d, 0xfcf7, 0xfbb4, 0xfef9, 0xfcf7, 0xfbb4, 0x002d, 0xfcf7, 0x0003, 0xfce6, 0xff93, 
+	0xffae, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 
+	0x0003, 0x000c, 0x000f, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0012, 0x000c, 0x0015, 0x000f, 0x000f, 0x0015, 0x0012, 0xfcb2, 
+	0xfef9, 0xff9b, 0xfcb2, 0x002d, 0xff9b, 0xfcd3, 0x002d, 0xff7a, 0xfcd3, 0xfef9, 0xff7a, 0xfcf9, 0xfef9, 0xffe1, 0xfcf9, 0x002d, 
+	0xffe1, 0xfd19, 0x002d, 0xffc1, 0xfd19, 0xfef9, 0xffc1, 0x0003, 0xfede, 0xff93, 0x00cf, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 
+	0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x0003, 0x000c, 0x000f, 0x0003, 0x000f, 0x0006, 
+	0x0006, 0x000f, 0x0012, 0x000c, 0x0015, 0x000f, 0x000f, 0x0015, 0x0012, 0xfea7, 0xfef9, 0x00d9, 0xfea7, 0x002d, 0x00d9, 0xfeb3, 
+	0x002d, 0x00ac, 0xfeb3, 0xfef9, 0x00ac, 0xff08, 0xfef9, 0x00f3, 0xff08, 0x002d, 0x00f3, 0xff14, 0x002d, 0x00c6, 0xff14, 0xfef9, 
+	0x00c6, 0x0003, 0x0122, 0xff93, 0x00cf, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 
+	0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x0003, 0x0012, 0x0009, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x000c, 
+	0x0015, 0x000c, 0x0012, 0x00ec, 0xfef9, 0x00c6, 0x00f8, 0xfef9, 0x00f3, 0x00ec, 0x002d, 0x00c6, 0x00f8, 0x002d, 0x00f3, 0x0159, 
+	0x002d, 0x00d9, 0x014d, 0x002d, 0x00ac, 0x0159, 0xfef9, 0x00d9, 0x014d, 0xfef9, 0x00ac, 0x0003, 0xfbf2, 0xff93, 0xfe41, 0x00a3, 
+	0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0000, 0x0006, 0x000c, 0x0003, 0x0009, 
+	0x000f, 0x0003, 0x000f, 0x0006, 0x0009, 0x0012, 0x000f, 0x000f, 0x0012, 0x0015, 0x000f, 0x0015, 0x0006, 0xfbc9, 0xfef9, 0xfe1c, 
+	0xfbc9, 0x002d, 0xfe1c, 0xfbf4, 0x002d, 0xfe0a, 0xfbf0, 0xfef9, 0xfe78, 0xfbf4, 0xfef9, 0xfe0a, 0xfbf0, 0x002d, 0xfe78, 0xfc1a, 
+	0xfef9, 0xfe66, 0xfc1a, 0x002d, 0xfe66, 0x0003, 0x031a, 0xff93, 0xffae, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 
+	0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x0003, 0x0012, 0x0009, 0x0009, 0x0012, 
+	0x000c, 0x0015, 0x000f, 0x000c, 0x0015, 0x000c, 0x0012, 0x02e7, 0xfef9, 0xffc1, 0x0307, 0xfef9, 0xffe1, 0x02e7, 0x002d, 0xffc1, 
+	0x0307, 0x002d, 0xffe1, 0x034e, 0x002d, 0xff9b, 0x032d, 0x002d, 0xff7a, 0x034e, 0xfef9, 0xff9b, 0x032d, 0xfef9, 0xff7a, 0x0003, 
+	0x0463, 0xff93, 0xfcc5, 0x00a3, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x000f, 0x0006, 0x0009, 0x0006, 0x000f, 0x000c, 0x0012, 0x000f, 0x0009, 0x000f, 0x0012, 0x0015, 0x0012, 
+	0x000c, 0x044c, 0xfef9, 0xfc93, 0x044c, 0x002d, 0xfc93, 0x047b, 0x002d, 0xfc93, 0x047b, 0xfef9, 0xfc93, 0x044c, 0x002d, 0xfcf7, 
+	0x047b, 0x002d, 0xfcf7, 0x047b, 0xfef9, 0xfcf7, 0x044c, 0xfef9, 0xfcf7, 0x0003, 0x040e, 0xff93, 0xfe41, 0x00a3, 0x0000, 0x0001, 
+	0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x0012, 
+	0x000f, 0x000c, 0x0012, 0x000c, 0x0015, 0x0003, 0x0015, 0x0009, 0x0009, 0x0015, 0x000c, 0x03e6, 0xfef9, 0xfe66, 0x0410, 0xfef9, 
+	0xfe78, 0x03e6, 0x002d, 0xfe66, 0x0410, 0x002d, 0xfe78, 0x0437, 0x002d, 0xfe1c, 0x040c, 0x002d, 0xfe0a, 0x040c, 0xfef9, 0xfe0a, 
+	0x0437, 0xfef9, 0xfe1c, 0x0003, 0xfaa9, 0xff97, 0xfcc3, 0x00a7, 0x0000, 0x0001, 0x0000, 0x0018, 0x0014, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0003, 0x0009, 0x0000, 0x0009, 0x0006, 0x0003, 0x0009, 0x0006, 0x0000, 0x0006, 0x000c, 0x0000, 0x0006, 0x000f, 0x0000, 
+	0x000f, 0x000c, 0x0006, 0x0009, 0x000f, 0x0006, 0x000f, 0x000c, 0x0003, 0x0012, 0x0009, 0x000c, 0x000f, 0x0012, 0x0003, 0x0012, 
+	0x0015, 0x0003, 0x0015, 0x0009, 0x0006, 0x0009, 0x0015, 0x0006, 0x0015, 0x000f, 0x0009, 0x0012, 0x0015, 0x0009, 0x0015, 0x000f, 
+	0x000c, 0x000f, 0x0015, 0x000c, 0x0015, 0x0012, 0x0012, 0x000f, 0x0015, 0xfa92, 0xfef9, 0xfc91, 0xfa92, 0xfef9, 0xfcf5, 0xfa92, 
+	0x0034, 0xfc91, 0xfa92, 0x0034, 0xfcf5, 0xfac0, 0xfef9, 0xfc91, 0xfac0, 0x0034, 0xfc91, 0xfac0, 0xfef9, 0xfcf5, 0xfac0, 0x0034, 
+	0xfcf5, 0x0002, 0x0000, 0x0521, 0x0de7, 0x02e1, 0x0000, 0x0001, 0x0000, 0x0051, 0x0018, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 
+	0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0018, 0x001b, 0x001e, 0x001e, 0x0021, 0x0021, 
+	0x0024, 0x0024, 0x0027, 0x0027, 0x002a, 0x002a, 0x002d, 0x002d, 0x0030, 0x0030, 0x0033, 0x0036, 0x0039, 0x0039, 0x003c, 0x003c, 
+	0x003f, 0x003f, 0x0042, 0x0042, 0x0045, 0x0045, 0x0048, 0x0048, 0x004b, 0x004b, 0x004e, 0xfd24, 0x04c8, 0x0de7, 0xfdb7, 0x0565, 
+	0x0de7, 0xfe63, 0x05d6, 0x0de7, 0xff33, 0x0622, 0x0de7, 0x0000, 0x063b, 0x0de7, 0x00cd, 0x0622, 0x0de7, 0x019d, 0x05d6, 0x0de7, 
+	0x0249, 0x0565, 0x0de7, 0x02dc, 0x04c8, 0x0de7, 0xfdb3, 0x045a, 0x0de7, 0xfe2c, 0x04da, 0x0de7, 0xfeae, 0x0532, 0x0de7, 0xff62, 
+	0x0574, 0x0de7, 0x0000, 0x0586, 0x0de7, 0x009e, 0x0574, 0x0de7, 0x0152, 0x0532, 0x0de7, 0x01d4, 0x04da, 0x0de7, 0x024d, 0x045a, 
+	0x0de7, 0xfe2b, 0x0408, 0x0de7, 0xfe89, 0x046d, 0x0de7, 0xfef8, 0x04b6, 0x0de7, 0xff7b, 0x04e6, 0x0de7, 0x0000, 0x04f6, 0x0de7, 
+	0x0085, 0x04e6, 0x0de7, 0x0108, 0x04b6, 0x0de7, 0x0177, 0x046d, 0x0de7, 0x01d5, 0x0408, 0x0de7, 0x0002, 0x0000, 0x00d2, 0x0ddf, 
+	0x03fb, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 0x0006, 0x000c, 0x000f, 
+	0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0xfc93, 0x02d9, 0x0ddf, 0xff25, 0xfffe, 0x0ddf, 0x036d, 0x02d9, 0x0ddf, 0x00db, 
+	0xfffe, 0x0ddf, 0xff25, 0xfecb, 0x0ddf, 0xff25, 0xffa7, 0x0ddf, 0x00db, 0xfecb, 0x0ddf, 0x00db, 0xffa7, 0x0ddf, 0x0002, 0xfed0, 
+	0xfe6a, 0x055b, 0x0078, 0x0000, 0x0002, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 
+	0xfec8, 0xfdf2, 0x0554, 0xfec8, 0xfdf2, 0x0562, 0xfec8, 0xfee2, 0x0554, 0xfed7, 0xfdf2, 0x0554, 0xfec8, 0xfee2, 0x0562, 0xfed7, 
+	0xfdf2, 0x0562, 0xfed7, 0xfee2, 0x0554, 0xfed7, 0xfee2, 0x0562, 0x12c0, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0009, 0x0006, 0x0009, 0xfecf, 0xfdf2, 0x0554, 0xfecf, 0xfdf2, 0x0562, 0xfecf, 0xfee2, 0x0554, 0xfecf, 0xfee2, 0x0562, 0x0002, 
+	0x0130, 0xfe6a, 0x055b, 0x0078, 0x0000, 0x0002, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 
+	0x0015, 0x0129, 0xfdf2, 0x0554, 0x0129, 0xfdf2, 0x0562, 0x0129, 0xfee2, 0x0554, 0x0138, 0xfdf2, 0x0554, 0x0129, 0xfee2, 0x0562, 
+	0x0138, 0xfdf2, 0x0562, 0x0138, 0xfee2, 0x0554, 0x0138, 0xfee2, 0x0562, 0x12c0, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0x0009, 0x0131, 0xfdf2, 0x0554, 0x0131, 0xfdf2, 0x0562, 0x0131, 0xfee2, 0x0554, 0x0131, 0xfee2, 0x0562, 
+	0x0002, 0x0000, 0xfe46, 0x042d, 0x00ca, 0x0000, 0x0002, 0x0000, 0x0030, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 
+	0x0006, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 
+	0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0xff48, 0xfdf2, 0x042d, 0xff48, 0xfe9a, 0x042d, 
+	0xff59, 0xfdf2, 0x042d, 0xff59, 0xfe9a, 0x042d, 0xffae, 0xfdf2, 0x042d, 0xffae, 0xfe9a, 0x042d, 0xffbf, 0xfdf2, 0x042d, 0xffbf, 
+	0xfe9a, 0x042d, 0x0041, 0xfdf2, 0x042d, 0x0041, 0xfe9a, 0x042d, 0x0052, 0xfdf2, 0x042d, 0x0052, 0xfe9a, 0x042d, 0x00a7, 0xfdf2, 
+	0x042d, 0x00a7, 0xfe9a, 0x042d, 0x00b8, 0xfdf2, 0x042d, 0x00b8, 0xfe9a, 0x042d, 0x12c0, 0x0018, 0x0004, 0x0000, 0x0003, 0x0006, 
+	0x0009, 0x000c, 0x000f, 0x0012, 0x0015, 0xff50, 0xfdf2, 0x042d, 0xff50, 0xfe9a, 0x042d, 0xffb6, 0xfdf2, 0x042d, 0xffb6, 0xfe9a, 
+	0x042d, 0x004a, 0xfdf2, 0x042d, 0x004a, 0xfe9a, 0x042d, 0x00b0, 0xfdf2, 0x042d, 0x00b0, 0xfe9a, 0x042d, 0x0003, 0x0000, 0xfea2, 
+	0x043f, 0x00c0, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xff41, 0xfe87, 0x043f, 
+	0x00bf, 0xfe87, 0x043f, 0x00bf, 0xfebd, 0x043f, 0xff41, 0xfebd, 0x043f, 0x0002, 0x0000, 0xfee2, 0x04c8, 0x01de, 0x0000, 0x0001, 
+	0x0000, 0x0057, 0x001c, 0x0000, 0x0003, 0x0003, 0x0006, 0x0009, 0x0006, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0015, 
+	0x0012, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x0021, 0x001e, 0x0021, 0x0024, 0x0024, 0x0027, 0x0027, 0x002a, 0x002a, 
+	0x002d, 0x0030, 0x002d, 0x0030, 0x0033, 0x0033, 0x0036, 0x0036, 0x0039, 0x003c, 0x0039, 0x003c, 0x003f, 0x003f, 0x0042, 0x0042, 
+	0x0045, 0x0048, 0x0045, 0x0048, 0x004b, 0x004b, 0x004e, 0x004e, 0x0051, 0x0051, 0x0054, 0xfe4f, 0xfee2, 0x03fc, 0xfe50, 0xfee2, 
+	0x0545, 0xfe7f, 0xfee2, 0x0545, 0xfe7f, 0xfee2, 0x0496, 0xfea8, 0xfee2, 0x0496, 0xfea8, 0xfee2, 0x0562, 0xfef8, 0xfee2, 0x0562, 
+	0xfef8, 0xfee2, 0x0474, 0xff30, 0xfee2, 0x0474, 0xff30, 0xfee2, 0x0584, 0xff94, 0xfee2, 0x0584, 0xff94, 0xfee2, 0x0463, 0xffd2, 
+	0xfee2, 0x0463, 0xffd2, 0xfee2, 0x0595, 0x0000, 0xfee2, 0x0595, 0x002e, 0xfee2, 0x0595, 0x002e, 0xfee2, 0x0463, 0x006c, 0xfee2, 
+	0x0463, 0x006c, 0xfee2, 0x0584, 0x00d0, 0xfee2, 0x0584, 0x00d0, 0xfee2, 0x0474, 0x0108, 0xfee2, 0x0474, 0x0108, 0xfee2, 0x0562, 
+	0x0158, 0xfee2, 0x0562, 0x0158, 0xfee2, 0x0496, 0x0181, 0xfee2, 0x0496, 0x0181, 0xfee2, 0x0545, 0x01b0, 0xfee2, 0x0545, 0x01b1, 
+	0xfee2, 0x03fc, 0x0003, 0x0349, 0x01ab, 0xfa9f, 0x014a, 0x0000, 0x0001, 0x0000, 0x0015, 0x0006, 0x0000, 0x0003, 0x0006, 0x0006, 
+	0x0003, 0x0009, 0x000c, 0x0006, 0x0009, 0x000c, 0x0009, 0x000f, 0x0012, 0x000f, 0x0009, 0x0012, 0x0009, 0x0003, 0x029a, 0x017f, 
+	0xfbb2, 0x03f9, 0x017f, 0xfbb2, 0x029a, 0x01d7, 0xfbb2, 0x03f9, 0x01d7, 0xfbb2, 0x029a, 0x01d7, 0xf98b, 0x03f9, 0x01d7, 0xf98b, 
+	0x03f9, 0x017f, 0xf98b, 0x0003, 0x01f3, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0001, 0x0000, 0x001b, 0x0008, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0006, 0x0009, 0x0009, 0x0006, 0x000c, 0x000f, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x0015, 0x000f, 0x0012, 0x0018, 
+	0x000c, 0x0006, 0x0018, 0x0006, 0x0003, 0x014d, 0x017f, 0xfbff, 0x029a, 0x017f, 0xfbff, 0x029a, 0x01d7, 0xfbff, 0x014d, 0x01d7, 
+	0xfbff, 0x029a, 0x01d7, 0xfbb2, 0x014d, 0x01d7, 0xfbb2, 0x029a, 0x01d7, 0xf98b, 0x014d, 0x01d7, 0xf98b, 0x029a, 0x017f, 0xfbb2, 
+	0x0003, 0x00a6, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0001, 0x0000, 0x0018, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 
+	0x0009, 0x0006, 0x000c, 0x000f, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x0015, 0x000f, 0x0012, 0x0000, 0x017f, 0xfbff, 0x014d, 
+	0x017f, 0xfbff, 0x014d, 0x01d7, 0xfbff, 0x0000, 0x01d7, 0xfbff, 0x014d, 0x01d7, 0xfbb2, 0x0000, 0x01d7, 0xfbb2, 0x014d, 0x01d7, 
+	0xf98b, 0x0000, 0x01d7, 0xf98b, 0x0003, 0xff5a, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0001, 0x0000, 0x0018, 0x0006, 0x0000, 0x0003, 
+	0x0006, 0x0006, 0x0003, 0x0009, 0x000c, 0x0006, 0x0009, 0x000c, 0x0009, 0x000f, 0x0012, 0x000c, 0x000f, 0x0012, 0x000f, 0x0015, 
+	0xfeb3, 0x017f, 0xfbff, 0x0000, 0x017f, 0xfbff, 0xfeb3, 0x01d7, 0xfbff, 0x0000, 0x01d7, 0xfbff, 0xfeb3, 0x01d7, 0xfbb2, 0x0000, 
+	0x01d7, 0xfbb2, 0xfeb3, 0x01d7, 0xf98b, 0x0000, 0x01d7, 0xf98b, 0x0003, 0xfe0d, 0x01ab, 0xfac5, 0x0166, 0x0000, 0x0001, 0x0000, 
+	0x001b, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0009, 0x0006, 0x000f, 0x0006, 0x000c, 
+	0x000f, 0x0009, 0x000f, 0x0012, 0x0015, 0x0009, 0x0012, 0x0015, 0x0012, 0x0018, 0xfd66, 0x017f, 0xfbb2, 0xfd66, 0x017f, 0xfbff, 
+	0xfd66, 0x01d7, 0xfbff, 0xfd66, 0x01d7, 0xfbb2, 0xfeb3, 0x017f, 0xfbff, 0xfeb3, 0x01d7, 0xfbff, 0xfeb3, 0x01d7, 0xfbb2, 0xfd66, 
+	0x01d7, 0xf98b, 0xfeb3, 0x01d7, 0xf98b, 0x0003, 0xfcb7, 0x01ab, 0xfa9f, 0x014a, 0x0000, 0x0001, 0x0000, 0x0015, 0x0006, 0x0000, 
+	0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0x0009, 0x0006, 0x0012, 0x0006, 0x000c, 
+	0x0012, 0xfc07, 0x017f, 0xf98b, 0xfc07, 0x017f, 0xfbb2, 0xfc07, 0x01d7, 0xfbb2, 0xfc07, 0x01d7, 0xf98b, 0xfd66, 0x01d7, 0xfbb2, 
+	0xfd66, 0x017f, 0xfbb2, 0xfd66, 0x01d7, 0xf98b, 0x0003, 0x024b, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 
+	0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0009, 0x0003, 
+	0x0012, 0x000f, 0x000f, 0x0012, 0x0009, 0x0003, 0x0015, 0x0012, 0x000c, 0x0009, 0x0015, 0x0015, 0x0009, 0x0012, 0x021c, 0x01d7, 
+	0xfb92, 0x021c, 0x01d7, 0xfbf1, 0x021c, 0x01e7, 0xfb92, 0x027b, 0x01e7, 0xfb92, 0x027b, 0x01d7, 0xfb92, 0x021c, 0x01e7, 0xfbf1, 
+	0x027b, 0x01e7, 0xfbf1, 0x027b, 0x01d7, 0xfbf1, 0x0003, 0x00c3, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 
+	0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0009, 0x0003, 
+	0x0012, 0x000f, 0x000f, 0x0012, 0x0009, 0x0003, 0x0015, 0x0012, 0x000c, 0x0009, 0x0015, 0x0015, 0x0009, 0x0012, 0x0093, 0x01d7, 
+	0xfb92, 0x0093, 0x01d7, 0xfbf1, 0x0093, 0x01e7, 0xfb92, 0x00f3, 0x01e7, 0xfb92, 0x00f3, 0x01d7, 0xfb92, 0x0093, 0x01e7, 0xfbf1, 
+	0x00f3, 0x01e7, 0xfbf1, 0x00f3, 0x01d7, 0xfbf1, 0x0003, 0xff3c, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 
+	0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0009, 0x0003, 
+	0x0012, 0x000f, 0x000f, 0x0012, 0x0009, 0x0003, 0x0015, 0x0012, 0x000c, 0x0009, 0x0015, 0x0015, 0x0009, 0x0012, 0xff0c, 0x01d7, 
+	0xfb92, 0xff0c, 0x01d7, 0xfbf1, 0xff0c, 0x01e7, 0xfb92, 0xff6b, 0x01e7, 0xfb92, 0xff6b, 0x01d7, 0xfb92, 0xff0c, 0x01e7, 0xfbf1, 
+	0xff6b, 0x01e7, 0xfbf1, 0xff6b, 0x01d7, 0xfbf1, 0x0003, 0xfdb3, 0x01df, 0xfbc2, 0x0044, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 
+	0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x0006, 0x000f, 0x0009, 0x0003, 
+	0x0012, 0x000f, 0x000f, 0x0012, 0x0009, 0x0003, 0x0015, 0x0012, 0x000c, 0x0009, 0x0015, 0x0015, 0x0009, 0x0012, 0xfd83, 0x01d7, 
+	0xfb92, 0xfd83, 0x01d7, 0xfbf1, 0xfd83, 0x01e7, 0xfb92, 0xfde2, 0x01e7, 0xfb92, 0xfde2, 0x01d7, 0xfb92, 0xfd83, 0x01e7, 0xfbf1, 
+	0xfde2, 0x01e7, 0xfbf1, 0xfde2, 0x01d7, 0xfbf1, 0x0002, 0xfeae, 0xfefa, 0x021f, 0x0033, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 
+	0xfe7f, 0xfefa, 0x020c, 0xfe7f, 0xfefa, 0x0233, 0xfe9a, 0xfefa, 0x01f1, 0xfe9a, 0xfefa, 0x024e, 0xfec1, 0xfefa, 0x01f1, 0xfec1, 
+	0xfefa, 0x024e, 0xfedc, 0xfefa, 0x020c, 0xfedc, 0xfefa, 0x0233, 0x0002, 0xfe32, 0xfefa, 0x01a3, 0x0033, 0x0000, 0x0001, 0x0000, 
+	0x0018, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 
+	0x0012, 0x0015, 0xfe03, 0xfefa, 0x0190, 0xfe03, 0xfefa, 0x01b7, 0xfe1e, 0xfefa, 0x0175, 0xfe1e, 0xfefa, 0x01d2, 0xfe45, 0xfefa, 
+	0x0175, 0xfe45, 0xfefa, 0x01d2, 0xfe60, 0xfefa, 0x0190, 0xfe60, 0xfefa, 0x01b7, 0x0002, 0xfe32, 0xfefa, 0x029c, 0x0033, 0x0000, 
+	0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 
+	0x000f, 0x0015, 0x0012, 0x0015, 0xfe03, 0xfefa, 0x0289, 0xfe03, 0xfefa, 0x02af, 0xfe1e, 0xfefa, 0x026d, 0xfe1e, 0xfefa, 0x02cb, 
+	0xfe45, 0xfefa, 0x026d, 0xfe45, 0xfefa, 0x02cb, 0xfe60, 0xfefa, 0x0289, 0xfe60, 0xfefa, 0x02af, 0x0002, 0xfdb5, 0xfefa, 0x021f, 
+	0x0033, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 
+	0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0xfd86, 0xfefa, 0x020c, 0xfd86, 0xfefa, 0x0233, 0xfda2, 0xfefa, 0x01f1, 0xfda2, 
+	0xfefa, 0x024e, 0xfdc8, 0xfefa, 0x01f1, 0xfdc8, 0xfefa, 0x024e, 0xfde4, 0xfefa, 0x020c, 0xfde4, 0xfefa, 0x0233, 0x0002, 0x01cf, 
+	0xfefa, 0x021f, 0x00c5, 0x0000, 0x0001, 0x0000, 0x0024, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x000c, 0x0006, 
+	0x000c, 0x000f, 0x0009, 0x0012, 0x0012, 0x0015, 0x000f, 0x0018, 0x0018, 0x001b, 0x001e, 0x0015, 0x001e, 0x0021, 0x001b, 0x0021, 
+	0x0115, 0xfefa, 0x01e2, 0x0115, 0xfefa, 0x025e, 0x0191, 0xfefa, 0x01e2, 0x0191, 0xfefa, 0x025e, 0x0191, 0xfefa, 0x0165, 0x020d, 
+	0xfefa, 0x0165, 0x0191, 0xfefa, 0x02da, 0x020d, 0xfefa, 0x02da, 0x020d, 0xfefa, 0x01e2, 0x0289, 0xfefa, 0x01e2, 0x020d, 0xfefa, 
+	0x025e, 0x0289, 0xfefa, 0x025e, 0x0002, 0xffe3, 0xfefa, 0x021f, 0x0070, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0xff74, 0xfefa, 
+	0x0210, 0xff74, 0xfefa, 0x022f, 0xffc2, 0xfefa, 0x0210, 0xffc2, 0xfefa, 0x022f, 0x0004, 0xfefa, 0x0210, 0x0004, 0xfefa, 0x022f, 
+	0x0052, 0xfefa, 0x0210, 0x0052, 0xfefa, 0x022f, 0x0002, 0x00a7, 0xff64, 0x00e0, 0x0085, 0x0000, 0x0002, 0x0000, 0x0078, 0x0034, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 
+	0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 
+	0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 
+	0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 0x0042, 0x0045, 0x0048, 0x004b, 0x0048, 0x004e, 0x0048, 0x0051, 0x004b, 0x0054, 
+	0x004e, 0x0054, 0x004b, 0x0057, 0x0051, 0x0057, 0x004e, 0x005a, 0x0051, 0x005a, 0x0054, 0x005d, 0x0057, 0x005d, 0x005a, 0x005d, 
+	0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 0x006f, 0x0066, 0x0072, 
+	0x0069, 0x0072, 0x006c, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0x0057, 0xfef9, 0x00e0, 0x0057, 0xff19, 0x00e0, 0x00a7, 0xfef9, 
+	0x0090, 0x00a7, 0xfef9, 0x0130, 0x00a7, 0xff19, 0x0090, 0x00a7, 0xff19, 0x0130, 0x00f7, 0xfef9, 0x00e0, 0x00f7, 0xff19, 0x00e0, 
+	0x0086, 0xff21, 0x00d3, 0x0086, 0xff21, 0x00ee, 0x0099, 0xff21, 0x00bf, 0x0099, 0xff21, 0x0102, 0x00b5, 0xff21, 0x00bf, 0x00b5, 
+	0xff21, 0x0102, 0x00c8, 0xff21, 0x00d3, 0x00c8, 0xff21, 0x00ee, 0x008e, 0xff29, 0x00d6, 0x008e, 0xff29, 0x00eb, 0x009d, 0xff29, 
+	0x00c8, 0x009d, 0xff29, 0x00f9, 0x00b1, 0xff29, 0x00c8, 0x00b1, 0xff29, 0x00f9, 0x00c0, 0xff29, 0x00d6, 0x00c0, 0xff29, 0x00eb, 
+	0x009c, 0xff2e, 0x00d5, 0x009c, 0xff2e, 0x00ec, 0x009c, 0xffcf, 0x00d5, 0x00b2, 0xff2e, 0x00d5, 0x009c, 0xffcf, 0x00ec, 0x00b2, 
+	0xff2e, 0x00ec, 0x00b2, 0xffcf, 0x00d5, 0x00b2, 0xffcf, 0x00ec, 0x00a0, 0xff19, 0x0112, 0x00a0, 0xff19, 0x011f, 0x00a0, 0xff1f, 
+	0x0112, 0x00ad, 0xff19, 0x0112, 0x00a0, 0xff1f, 0x011f, 0x00ad, 0xff19, 0x011f, 0x00ad, 0xff1f, 0x0112, 0x00ad, 0xff1f, 0x011f, 
+	0x0960, 0x0054, 0x0026, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x0018, 
+	0x0021, 0x001b, 0x0024, 0x001b, 0x0027, 0x001e, 0x002a, 0x0021, 0x002d, 0x0024, 0x0030, 0x0027, 0x0033, 0x002a, 0x0036, 0x002d, 
+	0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x003c, 0x003f, 0x003c, 0x0042, 0x003c, 0x0045, 0x003f, 0x0048, 0x0042, 
+	0x0048, 0x003f, 0x004b, 0x0045, 0x004b, 0x0042, 0x004e, 0x0045, 0x004e, 0x0048, 0x0051, 0x004b, 0x0051, 0x004e, 0x0051, 0x0057, 
+	0xfef9, 0x00e0, 0x0057, 0xff19, 0x00e0, 0x00a7, 0xfef9, 0x0090, 0x00a7, 0xfef9, 0x0130, 0x00a7, 0xff19, 0x0090, 0x00a7, 0xff19, 
+	0x0130, 0x00f7, 0xfef9, 0x00e0, 0x00f7, 0xff19, 0x00e0, 0x008a, 0xff25, 0x00d5, 0x008a, 0xff25, 0x00ed, 0x0099, 0xff21, 0x00bf, 
+	0x009d, 0xff29, 0x00c8, 0x009d, 0xff29, 0x00f9, 0x0099, 0xff21, 0x0102, 0x00b5, 0xff21, 0x00bf, 0x00b1, 0xff29, 0x00c8, 0x00b1, 
+	0xff29, 0x00f9, 0x00b5, 0xff21, 0x0102, 0x00c4, 0xff25, 0x00d5, 0x00c4, 0xff25, 0x00ed, 0x009c, 0xff2e, 0x00d5, 0x009c, 0xff2e, 
+	0x00ec, 0x009c, 0xffcf, 0x00d5, 0x00b2, 0xff2e, 0x00d5, 0x009c, 0xffcf, 0x00ec, 0x00b2, 0xff2e, 0x00ec, 0x00b2, 0xffcf, 0x00d5, 
+	0x00b2, 0xffcf, 0x00ec, 0x0002, 0xff59, 0xff64, 0x00e0, 0x0085, 0x0000, 0x0002, 0x0000, 0x0078, 0x0034, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 
+	0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 
+	0x0042, 0x003f, 0x0045, 0x0042, 0x0045, 0x0048, 0x004b, 0x0048, 0x004e, 0x0048, 0x0051, 0x004b, 0x0054, 0x004e, 0x0054, 0x004b, 
+	0x0057, 0x0051, 0x0057, 0x004e, 0x005a, 0x0051, 0x005a, 0x0054, 0x005d, 0x0057, 0x005d, 0x005a, 0x005d, 0x0060, 0x0063, 0x0060, 
+	0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 0x006f, 0x0066, 0x0072, 0x0069, 0x0072, 0x006c, 
+	0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0xff09, 0xfef9, 0x00e0, 0xff09, 0xff19, 0x00e0, 0xff59, 0xfef9, 0x0090, 0xff59, 0xfef9, 
+	0x0130, 0xff59, 0xff19, 0x0090, 0xff59, 0xff19, 0x0130, 0xffa9, 0xfef9, 0x00e0, 0xffa9, 0xff19, 0x00e0, 0xff38, 0xff21, 0x00d3, 
+	0xff38, 0xff21, 0x00ee, 0xff4b, 0xff21, 0x00bf, 0xff4b, 0xff21, 0x0102, 0xff67, 0xff21, 0x00bf, 0xff67, 0xff21, 0x0102, 0xff7a, 
+	0xff21, 0x00d3, 0xff7a, 0xff21, 0x00ee, 0xff40, 0xff29, 0x00d6, 0xff40, 0xff29, 0x00eb, 0xff4f, 0xff29, 0x00c8, 0xff4f, 0xff29, 
+	0x00f9, 0xff63, 0xff29, 0x00c8, 0xff63, 0xff29, 0x00f9, 0xff72, 0xff29, 0x00d6, 0xff72, 0xff29, 0x00eb, 0xff4e, 0xff2e, 0x00d5, 
+	0xff4e, 0xff2e, 0x00ec, 0xff4e, 0xffcf, 0x00d5, 0xff64, 0xff2e, 0x00d5, 0xff4e, 0xffcf, 0x00ec, 0xff64, 0xff2e, 0x00ec, 0xff64, 
+	0xffcf, 0x00d5, 0xff64, 0xffcf, 0x00ec, 0xff53, 0xff19, 0x0112, 0xff53, 0xff19, 0x011f, 0xff53, 0xff1f, 0x0112, 0xff60, 0xff19, 
+	0x0112, 0xff53, 0xff1f, 0x011f, 0xff60, 0xff19, 0x011f, 0xff60, 0xff1f, 0x0112, 0xff60, 0xff1f, 0x011f, 0x12c0, 0x0048, 0x0020, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 
+	0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 
+	0x0021, 0x0027, 0x0024, 0x002a, 0x002d, 0x002a, 0x002d, 0x0030, 0x002d, 0x0033, 0x0030, 0x0036, 0x0033, 0x0036, 0x0030, 0x0039, 
+	0x002a, 0x0039, 0x0039, 0x0027, 0x0033, 0x003c, 0x002a, 0x003c, 0x0036, 0x003f, 0x0039, 0x003f, 0x003c, 0x003f, 0x0042, 0x0045, 
+	0xff09, 0xfef9, 0x00e0, 0xff09, 0xff19, 0x00e0, 0xff59, 0xfef9, 0x0090, 0xff59, 0xfef9, 0x0130, 0xff59, 0xff19, 0x0090, 0xff59, 
+	0xff19, 0x0130, 0xffa9, 0xfef9, 0x00e0, 0xffa9, 0xff19, 0x00e0, 0xff38, 0xff21, 0x00d3, 0xff38, 0xff21, 0x00ee, 0xff4b, 0xff21, 
+	0x00bf, 0xff4b, 0xff21, 0x0102, 0xff67, 0xff21, 0x00bf, 0xff67, 0xff21, 0x0102, 0xff6d, 0xff28, 0x00d2, 0xff4a, 0xff2b, 0x00d1, 
+	0xff4a, 0xff2b, 0x00f0, 0xff4e, 0xffcf, 0x00d5, 0xff4e, 0xffcf, 0x00ec, 0xff6d, 0xff28, 0x00f0, 0xff64, 0xffcf, 0x00d5, 0xff64, 
+	0xffcf, 0x00ec, 0xff53, 0xff1c, 0x0119, 0xff60, 0xff1c, 0x0119, 0x0002, 0xfd48, 0xff64, 0xfffa, 0x0085, 0x0000, 0x0002, 0x0000, 
+	0x0078, 0x0034, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 
+	0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x0018, 0x0021, 
+	0x001b, 0x0024, 0x001e, 0x0024, 0x001b, 0x0027, 0x0021, 0x0027, 0x001e, 0x002a, 0x0021, 0x002a, 0x0024, 0x002d, 0x0027, 0x002d, 
+	0x002a, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 
+	0x0042, 0x0045, 0x0048, 0x004b, 0x0048, 0x004e, 0x004b, 0x0051, 0x004e, 0x0054, 0x0051, 0x0057, 0x0054, 0x005a, 0x0057, 0x005d, 
+	0x005a, 0x005d, 0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 0x006f, 
+	0x0066, 0x0072, 0x0069, 0x0072, 0x006c, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0xfd03, 0xfef9, 0xffd2, 0xfd03, 0xff19, 0xffd2, 
+	0xfd20, 0xfef9, 0x003e, 0xfd70, 0xfef9, 0xffb5, 0xfd20, 0xff19, 0x003e, 0xfd70, 0xff19, 0xffb5, 0xfd8d, 0xfef9, 0x0021, 0xfd8d, 
+	0xff19, 0x0021, 0xfd24, 0xff19, 0x002c, 0xfd24, 0xff1f, 0x002c, 0xfd2a, 0xff19, 0x0021, 0xfd2f, 0xff19, 0x0032, 0xfd2a, 0xff1f, 
+	0x0021, 0xfd2f, 0xff1f, 0x0032, 0xfd35, 0xff19, 0x0027, 0xfd35, 0xff1f, 0x0027, 0xfd25, 0xff21, 0xfff5, 0xfd2c, 0xff21, 0x000f, 
+	0xfd32, 0xff21, 0xffde, 0xfd44, 0xff21, 0x001d, 0xfd4d, 0xff21, 0xffd7, 0xfd5e, 0xff21, 0x0015, 0xfd65, 0xff21, 0xffe4, 0xfd6c, 
+	0xff21, 0xffff, 0xfd2e, 0xff29, 0xfff7, 0xfd33, 0xff29, 0x0009, 0xfd38, 0xff29, 0xffe5, 0xfd45, 0xff29, 0x0014, 0xfd4c, 0xff29, 
+	0xffdf, 0xfd59, 0xff29, 0x000e, 0xfd5e, 0xff29, 0xffea, 0xfd63, 0xff29, 0xfffe, 0xfd39, 0xff2e, 0xfffe, 0xfd39, 0xffcf, 0xfffe, 
+	0xfd44, 0xff2e, 0xffeb, 0xfd4c, 0xff2e, 0x0008, 0xfd44, 0xffcf, 0xffeb, 0xfd4c, 0xffcf, 0x0008, 0xfd58, 0xff2e, 0xfff6, 0xfd58, 
+	0xffcf, 0xfff6, 0x12c0, 0x0036, 0x001e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 
+	0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 
+	0x001e, 0x001b, 0x001e, 0x001b, 0x0021, 0x001b, 0x0024, 0x001b, 0x0027, 0x001e, 0x0027, 0x001b, 0x002a, 0x0021, 0x002a, 0x0027, 
+	0x002a, 0x0024, 0x002d, 0x0027, 0x002d, 0x0024, 0x0030, 0x002a, 0x0030, 0x002d, 0x0030, 0x001e, 0x0033, 0x0027, 0x0033, 0x002a, 
+	0x0033, 0xfd03, 0xfef9, 0xffd2, 0xfd03, 0xff19, 0xffd2, 0xfd20, 0xfef9, 0x003e, 0xfd70, 0xfef9, 0xffb5, 0xfd2b, 0xff1c, 0x002c, 
+	0xfd70, 0xff19, 0xffb5, 0xfd8d, 0xfef9, 0x0021, 0xfd8d, 0xff19, 0x0021, 0xfd32, 0xff21, 0xffde, 0xfd31, 0xff28, 0xfff4, 0xfd4c, 
+	0xff25, 0xffdb, 0xfd2f, 0xff25, 0x000c, 0xfd39, 0xffcf, 0xfffe, 0xfd53, 0xff2c, 0xffee, 0xfd4f, 0xff27, 0x0012, 0xfd4e, 0xffcf, 
+	0xfff0, 0xfd4c, 0xffcf, 0x0008, 0xfd67, 0xff24, 0xfff6, 0x0002, 0xfe6a, 0xff64, 0x00a0, 0x0085, 0x0000, 0x0002, 0x0000, 0x0078, 
+	0x0034, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 
+	0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x0018, 0x0021, 0x001b, 
+	0x0024, 0x001e, 0x0024, 0x001b, 0x0027, 0x0021, 0x0027, 0x001e, 0x002a, 0x0021, 0x002a, 0x0024, 0x002d, 0x0027, 0x002d, 0x002a, 
+	0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 0x0042, 
+	0x0045, 0x0048, 0x004b, 0x0048, 0x004e, 0x004b, 0x0051, 0x004e, 0x0054, 0x0051, 0x0057, 0x0054, 0x005a, 0x0057, 0x005d, 0x005a, 
+	0x005d, 0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 0x006f, 0x0066, 
+	0x0072, 0x0069, 0x0072, 0x006c, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0xfe25, 0xfef9, 0x0078, 0xfe25, 0xff19, 0x0078, 0xfe42, 
+	0xfef9, 0x00e6, 0xfe92, 0xfef9, 0x005b, 0xfe42, 0xff19, 0x00e6, 0xfe92, 0xff19, 0x005b, 0xfeaf, 0xfef9, 0x00c8, 0xfeaf, 0xff19, 
+	0x00c8, 0xfe45, 0xff19, 0x00d3, 0xfe45, 0xff1f, 0x00d3, 0xfe4c, 0xff19, 0x00c8, 0xfe51, 0xff19, 0x00d9, 0xfe4c, 0xff1f, 0x00c8, 
+	0xfe51, 0xff1f, 0x00d9, 0xfe57, 0xff19, 0x00ce, 0xfe57, 0xff1f, 0x00ce, 0xfe47, 0xff21, 0x009c, 0xfe4e, 0xff21, 0x00b6, 0xfe54, 
+	0xff21, 0x0084, 0xfe65, 0xff21, 0x00c4, 0xfe6f, 0xff21, 0x007d, 0xfe80, 0xff21, 0x00bd, 0xfe86, 0xff21, 0x008b, 0xfe8e, 0xff21, 
+	0x00a5, 0xfe4f, 0xff29, 0x009d, 0xfe55, 0xff29, 0x00b1, 0xfe5a, 0xff29, 0x008b, 0xfe67, 0xff29, 0x00bb, 0xfe6e, 0xff29, 0x0086, 
+	0xfe7a, 0xff29, 0x00b6, 0xfe7f, 0xff29, 0x0090, 0xfe85, 0xff29, 0x00a4, 0xfe5b, 0xff2e, 0x00a4, 0xfe5b, 0xffcf, 0x00a4, 0xfe66, 
+	0xff2e, 0x0091, 0xfe6e, 0xff2e, 0x00b0, 0xfe66, 0xffcf, 0x0091, 0xfe6e, 0xffcf, 0x00b0, 0xfe79, 0xff2e, 0x009c, 0xfe79, 0xffcf, 
+	0x009c, 0x12c0, 0x0039, 0x001e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 
+	0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 
+	0x0018, 0x0021, 0x001b, 0x0021, 0x001b, 0x0024, 0x001b, 0x0027, 0x0021, 0x0027, 0x001b, 0x002a, 0x0024, 0x002d, 0x0021, 0x002d, 
+	0x0024, 0x0030, 0x0027, 0x0030, 0x002d, 0x0030, 0x001e, 0x0033, 0x0021, 0x0036, 0x0027, 0x0036, 0x002a, 0x0036, 0x0033, 0x0036, 
+	0xfe25, 0xfef9, 0x0078, 0xfe25, 0xff19, 0x0078, 0xfe42, 0xfef9, 0x00e6, 0xfe92, 0xfef9, 0x005b, 0xfe42, 0xff19, 0x00e6, 0xfe92, 
+	0xff19, 0x005b, 0xfeaf, 0xfef9, 0x00c8, 0xfeaf, 0xff19, 0x00c8, 0xfe51, 0xff25, 0x0092, 0xfe55, 0xff28, 0x00ae, 0xfe6f, 0xff21, 
+	0x007d, 0xfe73, 0xff2b, 0x0091, 0xfe5b, 0xffcf, 0x00a4, 0xfe70, 0xff2b, 0x00b6, 0xfe65, 0xff21, 0x00c4, 0xfe6f, 0xffcf, 0x0097, 
+	0xfe6e, 0xffcf, 0x00b0, 0xfe86, 0xff21, 0x008b, 0xfe86, 0xff24, 0x00ad, 0x0002, 0x0196, 0xff64, 0x00a0, 0x0085, 0x0000, 0x0002, 
+	0x0000, 0x0078, 0x0034, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 
+	0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 
+	0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 0x0042, 0x0045, 0x0048, 0x004b, 0x0048, 0x004e, 0x0048, 
+	0x0051, 0x004b, 0x0054, 0x004e, 0x0054, 0x004b, 0x0057, 0x0051, 0x0057, 0x004e, 0x005a, 0x0051, 0x005a, 0x0054, 0x005d, 0x0057, 
+	0x005d, 0x005a, 0x005d, 0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 
+	0x006f, 0x0066, 0x0072, 0x0069, 0x0072, 0x006c, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0x0151, 0xfef9, 0x00c8, 0x0151, 0xff19, 
+	0x00c8, 0x016e, 0xfef9, 0x005b, 0x01be, 0xfef9, 0x00e6, 0x016e, 0xff19, 0x005b, 0x01be, 0xff19, 0x00e6, 0x01db, 0xfef9, 0x0078, 
+	0x01db, 0xff19, 0x0078, 0x0172, 0xff21, 0x00a5, 0x017a, 0xff21, 0x008b, 0x0180, 0xff21, 0x00bd, 0x0191, 0xff21, 0x007d, 0x019b, 
+	0xff21, 0x00c4, 0x01ac, 0xff21, 0x0084, 0x01b2, 0xff21, 0x00b6, 0x01b9, 0xff21, 0x009c, 0x017b, 0xff29, 0x00a4, 0x0181, 0xff29, 
+	0x0090, 0x0186, 0xff29, 0x00b6, 0x0192, 0xff29, 0x0086, 0x0199, 0xff29, 0x00bb, 0x01a6, 0xff29, 0x008b, 0x01ab, 0xff29, 0x00b1, 
+	0x01b1, 0xff29, 0x009d, 0x0187, 0xff2e, 0x009c, 0x0187, 0xffcf, 0x009c, 0x0192, 0xff2e, 0x00b0, 0x019a, 0xff2e, 0x0091, 0x0192, 
+	0xffcf, 0x00b0, 0x019a, 0xffcf, 0x0091, 0x01a5, 0xff2e, 0x00a4, 0x01a5, 0xffcf, 0x00a4, 0x01a9, 0xff19, 0x00ce, 0x01a9, 0xff1f, 
+	0x00ce, 0x01af, 0xff19, 0x00d9, 0x01b4, 0xff19, 0x00c8, 0x01af, 0xff1f, 0x00d9, 0x01b4, 0xff1f, 0x00c8, 0x01bb, 0xff19, 0x00d3, 
+	0x01bb, 0xff1f, 0x00d3, 0x12c0, 0x0039, 0x001e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 
+	0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 
+	0x0018, 0x001e, 0x001b, 0x0021, 0x001b, 0x0024, 0x0021, 0x0024, 0x001e, 0x0027, 0x0021, 0x0027, 0x0021, 0x002a, 0x0021, 0x002d, 
+	0x0024, 0x002d, 0x0027, 0x002d, 0x0024, 0x0030, 0x0030, 0x002d, 0x0024, 0x0033, 0x002a, 0x0033, 0x002a, 0x0036, 0x0033, 0x0036, 
+	0x002d, 0x0036, 0x0151, 0xfef9, 0x00c8, 0x0151, 0xff19, 0x00c8, 0x016e, 0xfef9, 0x005b, 0x01be, 0xfef9, 0x00e6, 0x016e, 0xff19, 
+	0x005b, 0x01be, 0xff19, 0x00e6, 0x01db, 0xfef9, 0x0078, 0x01db, 0xff19, 0x0078, 0x017a, 0xff21, 0x008b, 0x0177, 0xff25, 0x00a5, 
+	0x0191, 0xff21, 0x007d, 0x018d, 0xff2b, 0x0091, 0x018c, 0xff28, 0x00b8, 0x01af, 0xff25, 0x0092, 0x0191, 0xffcf, 0x0097, 0x01ab, 
+	0xff28, 0x00ae, 0x019b, 0xff21, 0x00c4, 0x0192, 0xffcf, 0x00b0, 0x01a5, 0xffcf, 0x00a4, 0x0002, 0x02b8, 0xff64, 0xfffa, 0x0085, 
+	0x0000, 0x0002, 0x0000, 0x0078, 0x0034, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 
+	0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x001b, 0x0018, 
+	0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0x0030, 0x0033, 0x0030, 
+	0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 0x0042, 0x0045, 0x0048, 0x004b, 0x0048, 
+	0x004e, 0x0048, 0x0051, 0x004b, 0x0054, 0x004e, 0x0054, 0x004b, 0x0057, 0x0051, 0x0057, 0x004e, 0x005a, 0x0051, 0x005a, 0x0054, 
+	0x005d, 0x0057, 0x005d, 0x005a, 0x005d, 0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 
+	0x006f, 0x0069, 0x006f, 0x0066, 0x0072, 0x0069, 0x0072, 0x006c, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0x0273, 0xfef9, 0x0021, 
+	0x0273, 0xff19, 0x0021, 0x0290, 0xfef9, 0xffb5, 0x02e0, 0xfef9, 0x003e, 0x0290, 0xff19, 0xffb5, 0x02e0, 0xff19, 0x003e, 0x02fd, 
+	0xfef9, 0xffd2, 0x02fd, 0xff19, 0xffd2, 0x0294, 0xff21, 0xffff, 0x029b, 0xff21, 0xffe4, 0x02a2, 0xff21, 0x0015, 0x02b3, 0xff21, 
+	0xffd7, 0x02bc, 0xff21, 0x001d, 0x02ce, 0xff21, 0xffde, 0x02d4, 0xff21, 0x000f, 0x02db, 0xff21, 0xfff5, 0x029d, 0xff29, 0xfffe, 
+	0x02a2, 0xff29, 0xffea, 0x02a7, 0xff29, 0x000e, 0x02b4, 0xff29, 0xffdf, 0x02bb, 0xff29, 0x0014, 0x02c8, 0xff29, 0xffe5, 0x02cd, 
+	0xff29, 0x0009, 0x02d2, 0xff29, 0xfff7, 0x02a8, 0xff2e, 0xfff6, 0x02a8, 0xffcf, 0xfff6, 0x02b4, 0xff2e, 0x0008, 0x02bc, 0xff2e, 
+	0xffeb, 0x02b4, 0xffcf, 0x0008, 0x02bc, 0xffcf, 0xffeb, 0x02c7, 0xff2e, 0xfffe, 0x02c7, 0xffcf, 0xfffe, 0x02cb, 0xff19, 0x0027, 
+	0x02cb, 0xff1f, 0x0027, 0x02d1, 0xff19, 0x0032, 0x02d6, 0xff19, 0x0021, 0x02d1, 0xff1f, 0x0032, 0x02d6, 0xff1f, 0x0021, 0x02dc, 
+	0xff19, 0x002c, 0x02dc, 0xff1f, 0x002c, 0x12c0, 0x0036, 0x001e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0012, 0x0009, 0x000c, 0x0015, 0x0012, 0x0015, 0x0015, 0x000f, 
+	0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0024, 0x001b, 0x0027, 0x001e, 0x0027, 
+	0x0021, 0x0027, 0x0024, 0x0027, 0x001e, 0x002a, 0x0021, 0x002d, 0x002a, 0x002d, 0x0021, 0x0030, 0x0027, 0x0030, 0x002a, 0x0033, 
+	0x002d, 0x0033, 0x0027, 0x0033, 0x0273, 0xfef9, 0x0021, 0x0273, 0xff19, 0x0021, 0x0290, 0xfef9, 0xffb5, 0x02e0, 0xfef9, 0x003e, 
+	0x0290, 0xff19, 0xffb5, 0x02e0, 0xff19, 0x003e, 0x02fd, 0xfef9, 0xffd2, 0x02fd, 0xff19, 0xffd2, 0x0299, 0xff24, 0xfff6, 0x02b4, 
+	0xff25, 0xffdb, 0x02ad, 0xff2c, 0xffee, 0x02b1, 0xff27, 0x0012, 0x02ce, 0xff21, 0xffde, 0x02cf, 0xff28, 0xfff4, 0x02b2, 0xffcf, 
+	0xfff0, 0x02b4, 0xffcf, 0x0008, 0x02d1, 0xff25, 0x000c, 0x02c7, 0xffcf, 0xfffe, 0x0002, 0xfdd3, 0xff04, 0x0065, 0x00b0, 0x0000, 
+	0x0001, 0x0000, 0x0057, 0x001c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 
+	0x0012, 0x0015, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x0021, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 
+	0x002a, 0x0030, 0x002d, 0x0033, 0x0033, 0x0036, 0x0030, 0x0039, 0x0039, 0x003c, 0x0036, 0x003f, 0x003c, 0x0042, 0x003f, 0x0045, 
+	0x0045, 0x0048, 0x0042, 0x004b, 0x0048, 0x004e, 0x004b, 0x0051, 0x004e, 0x0054, 0x0051, 0x0054, 0xfd3c, 0xff00, 0x0026, 0xfd44, 
+	0xff00, 0xfffe, 0xfd45, 0xff00, 0x004b, 0xfd60, 0xff00, 0x0074, 0xfd8b, 0xff00, 0x0099, 0xfda4, 0xff00, 0x00a8, 0xfdbe, 0xff00, 
+	0x00b7, 0xfdf4, 0xff00, 0x00c9, 0xfe24, 0xff00, 0x00cc, 0xfe49, 0xff00, 0x00c1, 0xfe69, 0xff00, 0x00a6, 0xfd58, 0xff08, 0x002f, 
+	0xfd60, 0xff08, 0x004b, 0xfd64, 0xff08, 0x0015, 0xfd78, 0xff08, 0x006a, 0xfd7e, 0xff08, 0x0027, 0xfd9b, 0xff08, 0x0088, 0xfd99, 
+	0xff08, 0x003a, 0xfdbf, 0xff08, 0x0054, 0xfdb0, 0xff08, 0x0094, 0xfdc5, 0xff08, 0x00a0, 0xfdce, 0xff08, 0x005f, 0xfdf0, 0xff08, 
+	0x00b0, 0xfde0, 0xff08, 0x0067, 0xfe09, 0xff08, 0x007b, 0xfe17, 0xff08, 0x00b4, 0xfe27, 0xff08, 0x0088, 0xfe34, 0xff08, 0x00ad, 
+	0xfe44, 0xff08, 0x0096, 0x0002, 0x0000, 0xff04, 0x0118, 0x00af, 0x0000, 0x0001, 0x0000, 0x0057, 0x001c, 0x0000, 0x0003, 0x0003, 
+	0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 
+	0x001e, 0x0021, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x002a, 0x002d, 0x0027, 0x0030, 0x002d, 0x0033, 0x0030, 0x0036, 0x0033, 
+	0x0039, 0x0036, 0x003c, 0x003c, 0x003f, 0x0039, 0x0042, 0x003f, 0x0045, 0x0042, 0x0048, 0x0045, 0x004b, 0x0048, 0x004e, 0x004b, 
+	0x0051, 0x004e, 0x0054, 0x0054, 0x0051, 0xff58, 0xff00, 0x00e6, 0xff65, 0xff00, 0x010d, 0xff80, 0xff00, 0x0129, 0xffab, 0xff00, 
+	0x013e, 0xffe3, 0xff00, 0x014a, 0x0000, 0xff00, 0x014a, 0x001d, 0xff00, 0x014a, 0x0055, 0xff00, 0x013e, 0x0080, 0xff00, 0x0129, 
+	0x009b, 0xff00, 0x010d, 0x00a8, 0xff00, 0x00e6, 0xff7f, 0xff08, 0x00ea, 0xff82, 0xff08, 0x0107, 0xff9f, 0xff08, 0x00ed, 0xff97, 
+	0xff08, 0x011b, 0xffbb, 0xff08, 0x012b, 0xffc0, 0xff08, 0x00f0, 0xffe8, 0xff08, 0x0133, 0xffee, 0xff08, 0x00f4, 0x0000, 0xff08, 
+	0x0133, 0x0000, 0xff08, 0x00f6, 0x0012, 0xff08, 0x00f4, 0x0018, 0xff08, 0x0133, 0x0040, 0xff08, 0x00f0, 0x0045, 0xff08, 0x012b, 
+	0x0061, 0xff08, 0x00ed, 0x0069, 0xff08, 0x011b, 0x0081, 0xff08, 0x00ea, 0x007e, 0xff08, 0x0107, 0x0002, 0x022d, 0xff04, 0x0065, 
+	0x00b0, 0x0000, 0x0001, 0x0000, 0x0057, 0x001c, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 
+	0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0018, 0x0018, 0x001b, 0x001e, 0x001b, 0x0021, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 
+	0x0027, 0x002d, 0x002a, 0x0030, 0x002d, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0039, 0x003c, 0x0036, 0x003f, 0x003c, 0x0042, 
+	0x003f, 0x0045, 0x0045, 0x0048, 0x0042, 0x004b, 0x004b, 0x004e, 0x0048, 0x0051, 0x004e, 0x0054, 0x0051, 0x0054, 0x0197, 0xff00, 
+	0x00a6, 0x01b7, 0xff00, 0x00c1, 0x01dc, 0xff00, 0x00cc, 0x020c, 0xff00, 0x00c9, 0x0242, 0xff00, 0x00b7, 0x025c, 0xff00, 0x00a8, 
+	0x0275, 0xff00, 0x0099, 0x02a0, 0xff00, 0x0074, 0x02bb, 0xff00, 0x004b, 0x02c4, 0xff00, 0x0026, 0x02bc, 0xff00, 0xfffe, 0x01bc, 
+	0xff08, 0x0096, 0x01cc, 0xff08, 0x00ad, 0x01d9, 0xff08, 0x0088, 0x01e9, 0xff08, 0x00b4, 0x01f7, 0xff08, 0x007b, 0x0210, 0xff08, 
+	0x00b0, 0x0220, 0xff08, 0x0067, 0x023b, 0xff08, 0x00a0, 0x0232, 0xff08, 0x005f, 0x0241, 0xff08, 0x0054, 0x0250, 0xff08, 0x0094, 
+	0x0267, 0xff08, 0x003a, 0x0265, 0xff08, 0x0088, 0x0288, 0xff08, 0x006a, 0x0282, 0xff08, 0x0027, 0x029c, 0xff08, 0x0015, 0x02a0, 
+	0xff08, 0x004b, 0x02a8, 0xff08, 0x002f, 0x0002, 0x05b4, 0x003a, 0x08da, 0x0409, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x05b4, 0x0000, 0x04d3, 0x05b4, 0x0000, 0x0ce2, 0x05b4, 0x0075, 0x04d3, 
+	0x05b4, 0x0075, 0x0ce2, 0x0002, 0xfa4c, 0x003a, 0x08da, 0x0409, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0xfa4c, 0x0000, 0x04d3, 0xfa4c, 0x0000, 0x0ce2, 0xfa4c, 0x0075, 0x04d3, 0xfa4c, 0x0075, 
+	0x0ce2, 0x0002, 0x0000, 0x0b6e, 0xfb91, 0x06d4, 0x0000, 0x0001, 0x0000, 0x002a, 0x000d, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 
+	0x0009, 0x0006, 0x000c, 0x000c, 0x000f, 0x000c, 0x0012, 0x0012, 0x0015, 0x0012, 0x0018, 0x0018, 0x001b, 0x0018, 0x001e, 0x001e, 
+	0x0021, 0x001e, 0x0024, 0x0024, 0x0027, 0xf97f, 0x0ad9, 0xfd8b, 0xf981, 0x0ad8, 0xf98b, 0xfbbf, 0x0b96, 0xf98b, 0xfbbf, 0x0b96, 
+	0xfd8f, 0xfdcd, 0x0be8, 0xf98b, 0xfdcd, 0x0be8, 0xfd94, 0x0000, 0x0c04, 0xf98b, 0x0000, 0x0c04, 0xfd96, 0x0233, 0x0be8, 0xf98b, 
+	0x0233, 0x0be8, 0xfd94, 0x0441, 0x0b96, 0xf98b, 0x0441, 0x0b96, 0xfd8f, 0x067f, 0x0ad8, 0xf98b, 0x0681, 0x0ad9, 0xfd8b, 0x0002, 
+	0x0000, 0x0962, 0xff3d, 0x0735, 0x0000, 0x0001, 0x0000, 0x002a, 0x0013, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 
+	0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 
+	0x001b, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x0027, 0xf97f, 
+	0x0ad9, 0xfd8b, 0xf981, 0x06c1, 0x00ee, 0xfbbf, 0x0b96, 0xfd8f, 0xfbd8, 0x07e1, 0x00ee, 0xfdcd, 0x0be8, 0xfd94, 0xfdd9, 0x0832, 
+	0x00ee, 0x0000, 0x0c04, 0xfd96, 0x0000, 0x084d, 0x00ee, 0x0227, 0x0832, 0x00ee, 0x0233, 0x0be8, 0xfd94, 0x0428, 0x07e1, 0x00ee, 
+	0x0441, 0x0b96, 0xfd8f, 0x067f, 0x06c1, 0x00ee, 0x0681, 0x0ad9, 0xfd8b, 0x0002, 0x0000, 0x06ed, 0x029b, 0x06d9, 0x0000, 0x0001, 
+	0x0000, 0x002a, 0x000d, 0x0000, 0x0003, 0x0000, 0x0006, 0x0009, 0x0006, 0x0006, 0x000c, 0x000f, 0x000c, 0x000c, 0x0012, 0x0012, 
+	0x0015, 0x0012, 0x0018, 0x0018, 0x001b, 0x0018, 0x001e, 0x001e, 0x0021, 0x001e, 0x0024, 0x0024, 0x0027, 0xf981, 0x058e, 0x0449, 
+	0xf981, 0x06c1, 0x00ee, 0xfbe2, 0x06b3, 0x0449, 0xfbd8, 0x07e1, 0x00ee, 0xfddf, 0x0703, 0x0449, 0xfdd9, 0x0832, 0x00ee, 0x0000, 
+	0x071e, 0x0449, 0x0000, 0x084d, 0x00ee, 0x0221, 0x0703, 0x0449, 0x0227, 0x0832, 0x00ee, 0x041e, 0x06b3, 0x0449, 0x0428, 0x07e1, 
+	0x00ee, 0x067f, 0x058e, 0x0449, 0x067f, 0x06c1, 0x00ee, 0x0002, 0x0000, 0x0676, 0x05d3, 0x06bc, 0x0000, 0x0001, 0x0000, 0x002a, 
+	0x000d, 0x0000, 0x0003, 0x0003, 0x0006, 0x0009, 0x0006, 0x0006, 0x000c, 0x000f, 0x000c, 0x000c, 0x0012, 0x0015, 0x0012, 0x0012, 
+	0x0018, 0x0018, 0x001b, 0x0018, 0x001e, 0x001e, 0x0021, 0x001e, 0x0024, 0x0027, 0x0024, 0xf981, 0x058e, 0x0449, 0xf981, 0x05cd, 
+	0x075e, 0xfbe4, 0x06f3, 0x075e, 0xfbe2, 0x06b3, 0x0449, 0xfde0, 0x0743, 0x075e, 0xfddf, 0x0703, 0x0449, 0x0000, 0x075e, 0x075e, 
+	0x0000, 0x071e, 0x0449, 0x0220, 0x0743, 0x075e, 0x0221, 0x0703, 0x0449, 0x041c, 0x06f3, 0x075e, 0x041e, 0x06b3, 0x0449, 0x067f, 
+	0x05cd, 0x075e, 0x067f, 0x058e, 0x0449, 0x0002, 0x0000, 0x06e5, 0x08c7, 0x06bc, 0x0000, 0x0001, 0x0000, 0x002a, 0x000d, 0x0000, 
+	0x0003, 0x0003, 0x0006, 0x0009, 0x0006, 0x0006, 0x000c, 0x000f, 0x000c, 0x000c, 0x0012, 0x0015, 0x0012, 0x0012, 0x0018, 0x001b, 
+	0x0018, 0x0018, 0x001e, 0x0021, 0x001e, 0x001e, 0x0024, 0x0027, 0x0024, 0xf981, 0x05cd, 0x075e, 0xf981, 0x066d, 0x0a31, 0xfbe4, 
+	0x0793, 0x0a31, 0xfbe4, 0x06f3, 0x075e, 0xfde0, 0x07e2, 0x0a31, 0xfde0, 0x0743, 0x075e, 0x0000, 0x07fd, 0x0a31, 0x0000, 0x075e, 
+	0x075e, 0x0220, 0x07e2, 0x0a31, 0x0220, 0x0743, 0x075e, 0x041c, 0x0793, 0x0a31, 0x041c, 0x06f3, 0x075e, 0x067f, 0x066d, 0x0a31, 
+	0x067f, 0x05cd, 0x075e, 0x0002, 0x0000, 0x0693, 0x0c0c, 0x06e7, 0x0000, 0x0001, 0x0000, 0x002a, 0x000d, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0006, 0x0009, 0x0006, 0x000c, 0x000c, 0x000f, 0x000c, 0x0012, 0x0012, 0x0015, 0x0012, 0x0018, 0x001b, 0x0018, 0x0018, 
+	0x001e, 0x0021, 0x001e, 0x001e, 0x0024, 0x0024, 0x0027, 0xf981, 0x0529, 0x0de8, 0xf981, 0x066d, 0x0a31, 0xfbe0, 0x064d, 0x0de8, 
+	0xfbe4, 0x0793, 0x0a31, 0xfdde, 0x069d, 0x0de8, 0xfde0, 0x07e2, 0x0a31, 0x0000, 0x06b8, 0x0de8, 0x0000, 0x07fd, 0x0a31, 0x0222, 
+	0x069d, 0x0de8, 0x0220, 0x07e2, 0x0a31, 0x0420, 0x064d, 0x0de8, 0x041c, 0x0793, 0x0a31, 0x067f, 0x0529, 0x0de8, 0x067f, 0x066d, 
+	0x0a31, 0x0002, 0xfdb3, 0x00bf, 0xfba4, 0x00cf, 0x0000, 0x0001, 0x0000, 0x0012, 0x0007, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0xfd81, 0x0000, 0xfb66, 0xfd81, 0x0000, 0xfbe2, 0xfd81, 
+	0x017f, 0xfb66, 0xfd81, 0x017f, 0xfbe2, 0xfde4, 0x0000, 0xfbe2, 0xfde4, 0x017f, 0xfbe2, 0x0002, 0xff3c, 0x00bf, 0xfbe2, 0x00c6, 
+	0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0xff0a, 0x0000, 0xfbe2, 
+	0xff0a, 0x017f, 0xfbe2, 0xff6d, 0x0000, 0xfbe2, 0xff6d, 0x017f, 0xfbe2, 0x0002, 0x00c3, 0x00bf, 0xfbe2, 0x00c6, 0x0000, 0x0001, 
+	0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0091, 0x0000, 0xfbe2, 0x0091, 0x017f, 
+	0xfbe2, 0x00f5, 0x0000, 0xfbe2, 0x00f5, 0x017f, 0xfbe2, 0x0002, 0x024b, 0x00bf, 0xfbe2, 0x00c6, 0x0000, 0x0001, 0x0000, 0x000c, 
+	0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x021a, 0x0000, 0xfbe2, 0x021a, 0x017f, 0xfbe2, 0x027d, 
+	0x0000, 0xfbe2, 0x027d, 0x017f, 0xfbe2, 0x0003, 0xfc37, 0x00c4, 0xfb59, 0x00cb, 0x0000, 0x0001, 0x0000, 0x0018, 0x0006, 0x0000, 
+	0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0009, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 
+	0x000c, 0xfc0d, 0x0188, 0xfb34, 0xfc0e, 0x0000, 0xfb34, 0xfc0e, 0x0000, 0xfb7c, 0xfc0d, 0x0188, 0xfb7d, 0xfc60, 0x0000, 0xfb7c, 
+	0xfc60, 0x0188, 0xfb7d, 0xfc60, 0x0188, 0xfb34, 0xfc60, 0x0000, 0xfb34, 0x0003, 0xfd64, 0x00c4, 0xfb73, 0x00c7, 0x0000, 0x0002, 
+	0x0000, 0x0012, 0x0004, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0xfd42, 
+	0x0000, 0xfb68, 0xfd42, 0x0000, 0xfb7e, 0xfd42, 0x0188, 0xfb7e, 0xfd42, 0x0188, 0xfb68, 0xfd85, 0x0188, 0xfb7e, 0xfd81, 0x0000, 
+	0xfb7e, 0x12c0, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfd42, 0x0000, 0xfb73, 0xfd81, 0x0000, 0xfb7e, 
+	0xfd85, 0x0188, 0xfb7e, 0xfd42, 0x0188, 0xfb73, 0x0003, 0x029c, 0x00c4, 0xfb73, 0x00c7, 0x0000, 0x0002, 0x0000, 0x0012, 0x0004, 
+	0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000f, 0x000c, 0x0009, 0x027b, 0x0188, 0xfb7e, 0x027f, 
+	0x0000, 0xfb7e, 0x02be, 0x0188, 0xfb7e, 0x02be, 0x0000, 0xfb7e, 0x02be, 0x0188, 0xfb68, 0x02be, 0x0000, 0xfb68, 0x12c0, 0x000c, 
+	0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x027f, 0x0000, 0xfb7e, 0x02be, 0x0000, 0xfb73, 0x02be, 0x0188, 0xfb73, 
+	0x027b, 0x0188, 0xfb7e, 0x0003, 0x03c9, 0x00c4, 0xfb59, 0x00cb, 0x0000, 0x0001, 0x0000, 0x0018, 0x0006, 0x0000, 0x0003, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0x0003, 0x000c, 0x0009, 0x0003, 0x000f, 0x000c, 0x000f, 0x0012, 0x000c, 0x0015, 0x0012, 0x000f, 0x03a0, 
+	0x0000, 0xfb34, 0x03a0, 0x0000, 0xfb7c, 0x03a0, 0x0188, 0xfb34, 0x03a0, 0x0188, 0xfb7d, 0x03f3, 0x0188, 0xfb7d, 0x03f2, 0x0000, 
+	0xfb7c, 0x03f3, 0x0188, 0xfb34, 0x03f2, 0x0000, 0xfb34, 0x0002, 0xfa93, 0xfff9, 0x0026, 0x0103, 0x0000, 0x0001, 0x0000, 0x0018, 
+	0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0003, 
+	0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x000c, 
+	0x0015, 0xfa75, 0xfef9, 0x000a, 0xfa75, 0xfef9, 0x0043, 0xfa75, 0x00f8, 0x000a, 0xfab0, 0xfef9, 0x000a, 0xfab0, 0x00f8, 0x000a, 
+	0xfa75, 0x00f8, 0x0043, 0xfab0, 0xfef9, 0x0043, 0xfab0, 0x00f8, 0x0043, 0x0002, 0xfa93, 0xfff9, 0xfe71, 0x0103, 0x0000, 0x0001, 
+	0x0000, 0x0018, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0009, 
+	0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0015, 0x0009, 0x0015, 0x0012, 
+	0x0015, 0x000c, 0x0015, 0xfa75, 0xfef9, 0xfe54, 0xfa75, 0xfef9, 0xfe8d, 0xfa75, 0x00f8, 0xfe54, 0xfab0, 0xfef9, 0xfe54, 0xfab0, 
+	0x00f8, 0xfe54, 0xfa75, 0x00f8, 0xfe8d, 0xfab0, 0xfef9, 0xfe8d, 0xfab0, 0x00f8, 0xfe8d, 0x0002, 0x056d, 0xfff9, 0xfe71, 0x0103, 
+	0x0000, 0x0001, 0x0000, 0x0018, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0x0006, 0x0015, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0550, 0xfef9, 0xfe54, 0x0550, 0xfef9, 0xfe8d, 0x0550, 0x00f8, 0xfe54, 0x0550, 0x00f8, 
+	0xfe8d, 0x058b, 0xfef9, 0xfe54, 0x058b, 0xfef9, 0xfe8d, 0x058b, 0x00f8, 0xfe8d, 0x058b, 0x00f8, 0xfe54, 0x0002, 0x056d, 0xfff9, 
+	0x0026, 0x0103, 0x0000, 0x0001, 0x0000, 0x0018, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 
+	0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0x0006, 
+	0x0015, 0x000c, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0550, 0xfef9, 0x000a, 0x0550, 0xfef9, 0x0043, 0x0550, 0x00f8, 0x000a, 
+	0x0550, 0x00f8, 0x0043, 0x058b, 0xfef9, 0x000a, 0x058b, 0xfef9, 0x0043, 0x058b, 0x00f8, 0x0043, 0x058b, 0x00f8, 0x000a, 0x0002, 
+	0x05d6, 0xff34, 0x073e, 0x0146, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 
+	0x0015, 0x05aa, 0xfdf2, 0x0725, 0x05aa, 0xfdf2, 0x0758, 0x05aa, 0x0075, 0x0725, 0x0602, 0xfdf2, 0x0725, 0x05aa, 0x0075, 0x0758, 
+	0x0602, 0xfdf2, 0x0758, 0x0602, 0x0075, 0x0725, 0x0602, 0x0075, 0x0758, 0x0003, 0x0340, 0xfe90, 0x0340, 0x00c5, 0x0000, 0x0001, 
+	0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0003, 0x000c, 0x0009, 0x0006, 0x0009, 0x000f, 0x0009, 
+	0x000c, 0x0012, 0x0009, 0x0012, 0x000f, 0x0015, 0x000f, 0x0012, 0x0015, 0x0012, 0x000c, 0x0329, 0xfdf2, 0x02cd, 0x0329, 0xfdf2, 
+	0x03b4, 0x0329, 0xff2e, 0x02cd, 0x0329, 0xff2e, 0x03b4, 0x0358, 0xfdf2, 0x03b4, 0x0358, 0xff2e, 0x02cd, 0x0358, 0xff2e, 0x03b4, 
+	0x0358, 0xfdf2, 0x02cd, 0x0003, 0xfcc0, 0xfe90, 0x0340, 0x00c5, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0000, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0009, 0x0006, 0x0012, 0x0009, 
+	0x0012, 0x000c, 0x0003, 0x0015, 0x0012, 0x000f, 0x000c, 0x0015, 0x0015, 0x000c, 0x0012, 0xfca8, 0xfdf2, 0x02cd, 0xfca8, 0xfdf2, 
+	0x03b4, 0xfca8, 0xff2e, 0x03b4, 0xfca8, 0xff2e, 0x02cd, 0xfcd7, 0xff2e, 0x02cd, 0xfcd7, 0xfdf2, 0x02cd, 0xfcd7, 0xff2e, 0x03b4, 
+	0xfcd7, 0xfdf2, 0x03b4, 0x0003, 0xfbc8, 0xfe90, 0x02ff, 0x00a7, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0000, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0009, 0x0006, 0x0012, 0x0009, 
+	0x0012, 0x000c, 0x0003, 0x0015, 0x0012, 0x000f, 0x000c, 0x0015, 0x0015, 0x000c, 0x0012, 0xfbb1, 0xfdf2, 0x02cd, 0xfbb1, 0xfdf2, 
+	0x0331, 0xfbb1, 0xff2e, 0x0331, 0xfbb1, 0xff2e, 0x02cd, 0xfbdf, 0xff2e, 0x02cd, 0xfbdf, 0xfdf2, 0x02cd, 0xfbdf, 0xff2e, 0x0331, 
+	0xfbdf, 0xfdf2, 0x0331, 0x0003, 0x0438, 0xfe90, 0x02ff, 0x00a7, 0x0000, 0x0001, 0x0000, 0x0018, 0x000a, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0x0006, 0x000c, 0x0012, 0x0006, 0x0012, 0x0009, 0x000c, 
+	0x000f, 0x0015, 0x000c, 0x0015, 0x0012, 0x0009, 0x0012, 0x0015, 0x0009, 0x0015, 0x000f, 0x0421, 0xfdf2, 0x02cd, 0x0421, 0xfdf2, 
+	0x0331, 0x0421, 0xff2e, 0x02cd, 0x044f, 0xfdf2, 0x02cd, 0x0421, 0xff2e, 0x0331, 0x044f, 0xfdf2, 0x0331, 0x044f, 0xff2e, 0x02cd, 
+	0x044f, 0xff2e, 0x0331, 0x0002, 0x05d6, 0xff34, 0x0920, 0x0146, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x05aa, 0xfdf2, 0x0906, 0x05aa, 0xfdf2, 0x093a, 0x05aa, 0x0075, 0x0906, 0x0602, 0xfdf2, 
+	0x0906, 0x05aa, 0x0075, 0x093a, 0x0602, 0xfdf2, 0x093a, 0x0602, 0x0075, 0x0906, 0x0602, 0x0075, 0x093a, 0x0002, 0x05d6, 0xff34, 
+	0x0b01, 0x0146, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x05aa, 
+	0xfdf2, 0x0ae8, 0x05aa, 0xfdf2, 0x0b1b, 0x05aa, 0x0075, 0x0ae8, 0x0602, 0xfdf2, 0x0ae8, 0x05aa, 0x0075, 0x0b1b, 0x0602, 0xfdf2, 
+	0x0b1b, 0x0602, 0x0075, 0x0ae8, 0x0602, 0x0075, 0x0b1b, 0x0002, 0x05d6, 0xff34, 0x0d06, 0x0147, 0x0000, 0x0001, 0x0000, 0x0018, 
+	0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 
+	0x0012, 0x000c, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0015, 0x0012, 0x05aa, 0xfdf2, 0x0ce2, 0x05aa, 0xfdf2, 0x0d2b, 0x05aa, 
+	0x0075, 0x0ce2, 0x0602, 0xfdf2, 0x0ce2, 0x05aa, 0x0075, 0x0d2b, 0x0602, 0xfdf2, 0x0d2b, 0x0602, 0x0075, 0x0d2b, 0x0602, 0x0075, 
+	0x0ce2, 0x0002, 0xfa2a, 0xff34, 0x0d06, 0x0147, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 
+	0x0015, 0x0012, 0x0015, 0xf9fe, 0xfdf2, 0x0ce2, 0xf9fe, 0xfdf2, 0x0d2b, 0xf9fe, 0x0075, 0x0ce2, 0xfa56, 0xfdf2, 0x0ce2, 0xf9fe, 
+	0x0075, 0x0d2b, 0xfa56, 0xfdf2, 0x0d2b, 0xfa56, 0x0075, 0x0ce2, 0xfa56, 0x0075, 0x0d2b, 0x0002, 0xfa2a, 0xff34, 0x0b01, 0x0146, 
+	0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 
+	0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0xf9fe, 0xfdf2, 0x0ae8, 
+	0xf9fe, 0xfdf2, 0x0b1b, 0xf9fe, 0x0075, 0x0ae8, 0xfa56, 0xfdf2, 0x0ae8, 0xf9fe, 0x0075, 0x0b1b, 0xfa56, 0xfdf2, 0x0b1b, 0xfa56, 
+	0x0075, 0x0ae8, 0xfa56, 0x0075, 0x0b1b, 0x0002, 0xfa2a, 0xff34, 0x0920, 0x0146, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 
+	0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0xf9fe, 0xfdf2, 0x0906, 0xf9fe, 0xfdf2, 0x093a, 0xf9fe, 0x0075, 0x0906, 
+	0xfa56, 0xfdf2, 0x0906, 0xf9fe, 0x0075, 0x093a, 0xfa56, 0xfdf2, 0x093a, 0xfa56, 0x0075, 0x0906, 0xfa56, 0x0075, 0x093a, 0x0002, 
+	0xfa2a, 0xff34, 0x073e, 0x0146, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 
+	0x0015, 0xf9fe, 0xfdf2, 0x0725, 0xf9fe, 0xfdf2, 0x0758, 0xf9fe, 0x0075, 0x0725, 0xfa56, 0xfdf2, 0x0725, 0xf9fe, 0x0075, 0x0758, 
+	0xfa56, 0xfdf2, 0x0758, 0xfa56, 0x0075, 0x0725, 0xfa56, 0x0075, 0x0758, 0x0002, 0x0620, 0xfe74, 0x04c3, 0x0088, 0x0000, 0x0001, 
+	0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0604, 0xfdf2, 0x04a7, 0x0604, 0xfdf2, 
+	0x04e0, 0x0604, 0xfef6, 0x04a7, 0x063d, 0xfdf2, 0x04a7, 0x0604, 0xfef6, 0x04e0, 0x063d, 0xfdf2, 0x04e0, 0x063d, 0xfef6, 0x04a7, 
+	0x063d, 0xfef6, 0x04e0, 0x0002, 0x0620, 0xfe74, 0x0622, 0x0088, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0604, 0xfdf2, 0x0606, 0x0604, 0xfdf2, 0x063f, 0x0604, 0xfef6, 0x0606, 0x063d, 0xfdf2, 
+	0x0606, 0x0604, 0xfef6, 0x063f, 0x063d, 0xfdf2, 0x063f, 0x063d, 0xfef6, 0x0606, 0x063d, 0xfef6, 0x063f, 0x0002, 0x0552, 0xfe76, 
+	0x043d, 0x008a, 0x0000, 0x0001, 0x0000, 0x0018, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0536, 
+	0xfdf2, 0x0421, 0x0536, 0xfdf2, 0x045a, 0x0536, 0xfef9, 0x0421, 0x056f, 0xfdf2, 0x0421, 0x0536, 0xfef9, 0x045a, 0x056f, 0xfdf2, 
+	0x045a, 0x056f, 0xfef9, 0x0421, 0x056f, 0xfef9, 0x045a, 0x0002, 0x067f, 0x018d, 0x0de8, 0x039c, 0x0000, 0x0001, 0x0000, 0x0006, 
+	0x0001, 0x0000, 0x0003, 0x067f, 0xfdf2, 0x0de8, 0x067f, 0x0529, 0x0de8, 0x0002, 0xf981, 0x018d, 0x0de8, 0x039c, 0x0000, 0x0001, 
+	0x0000, 0x0006, 0x0001, 0x0000, 0x0003, 0xf981, 0xfdf2, 0x0de8, 0xf981, 0x0529, 0x0de8, 0x0002, 0xfe79, 0x0067, 0xfbbb, 0x009b, 
+	0x0000, 0x0001, 0x0000, 0x0036, 0x0019, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 0x0018, 0x001b, 0x0012, 0x001e, 0x001b, 
+	0x001e, 0x0015, 0x0021, 0x001e, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x0027, 0x002a, 0x0024, 0x002a, 0x002d, 0x0024, 
+	0x0030, 0x002d, 0x0030, 0x0027, 0x0033, 0x0030, 0x0033, 0xfe05, 0x0000, 0xfbbb, 0xfe05, 0x00b9, 0xfbbb, 0xfe17, 0x0000, 0xfbbb, 
+	0xfe05, 0x00ce, 0xfbbb, 0xfe17, 0x00b9, 0xfbbb, 0xfe17, 0x00ce, 0xfbbb, 0xfe70, 0x00b9, 0xfbbb, 0xfe70, 0x00ce, 0xfbbb, 0xfe70, 
+	0x0000, 0xfbbb, 0xfe81, 0x0000, 0xfbbb, 0xfe81, 0x00b9, 0xfbbb, 0xfe81, 0x00ce, 0xfbbb, 0xfed9, 0x00b9, 0xfbbb, 0xfed9, 0x00ce, 
+	0xfbbb, 0xfed9, 0x0000, 0xfbbb, 0xfeec, 0x0000, 0xfbbb, 0xfeec, 0x00b9, 0xfbbb, 0xfeec, 0x00ce, 0xfbbb, 0x0002, 0x0000, 0x0067, 
+	0xfbbb, 0x009a, 0x0000, 0x0001, 0x0000, 0x0036, 0x0019, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 0x0018, 0x001b, 0x0012, 
+	0x001e, 0x001b, 0x001e, 0x0015, 0x0021, 0x001e, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x0027, 0x002a, 0x0024, 0x002a, 
+	0x002d, 0x0024, 0x0030, 0x002d, 0x0030, 0x0027, 0x0033, 0x0030, 0x0033, 0xff8d, 0x0000, 0xfbbb, 0xff8d, 0x00b9, 0xfbbb, 0xffa0, 
+	0x0000, 0xfbbb, 0xff8d, 0x00ce, 0xfbbb, 0xffa0, 0x00b9, 0xfbbb, 0xffa0, 0x00ce, 0xfbbb, 0xfff8, 0x00b9, 0xfbbb, 0xfff8, 0x00ce, 
+	0xfbbb, 0xfff8, 0x0000, 0xfbbb, 0x0008, 0x0000, 0xfbbb, 0x0008, 0x00b9, 0xfbbb, 0x0008, 0x00ce, 0xfbbb, 0x0060, 0x00b9, 0xfbbb, 
+	0x0060, 0x00ce, 0xfbbb, 0x0060, 0x0000, 0xfbbb, 0x0073, 0x0000, 0xfbbb, 0x0073, 0x00b9, 0xfbbb, 0x0073, 0x00ce, 0xfbbb, 0x0002, 
+	0x0187, 0x0067, 0xfbbb, 0x009b, 0x0000, 0x0001, 0x0000, 0x0036, 0x0019, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 0x0018, 
+	0x001b, 0x0012, 0x001e, 0x001b, 0x001e, 0x0015, 0x0021, 0x001e, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x0027, 0x002a, 
+	0x0024, 0x002a, 0x002d, 0x0024, 0x0030, 0x002d, 0x0030, 0x0027, 0x0033, 0x0030, 0x0033, 0x0114, 0x0000, 0xfbbb, 0x0114, 0x00b9, 
+	0xfbbb, 0x0127, 0x0000, 0xfbbb, 0x0114, 0x00ce, 0xfbbb, 0x0127, 0x00b9, 0xfbbb, 0x0127, 0x00ce, 0xfbbb, 0x017f, 0x00b9, 0xfbbb, 
+	0x017f, 0x00ce, 0xfbbb, 0x017f, 0x0000, 0xfbbb, 0x0190, 0x0000, 0xfbbb, 0x0190, 0x00b9, 0xfbbb, 0x0190, 0x00ce, 0xfbbb, 0x01e9, 
+	0x00b9, 0xfbbb, 0x01e9, 0x00ce, 0xfbbb, 0x01e9, 0x0000, 0xfbbb, 0x01fb, 0x0000, 0xfbbb, 0x01fb, 0x00b9, 0xfbbb, 0x01fb, 0x00ce, 
+	0xfbbb, 0x0003, 0x04e2, 0x0000, 0xfbe4, 0x00d7, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 
+	0x0009, 0x0466, 0x0000, 0xfb34, 0x0466, 0x0000, 0xfc93, 0x055f, 0x0000, 0xfc93, 0x055f, 0x0000, 0xfb34, 0x0002, 0x0000, 0xfef9, 
+	0xff76, 0x08d6, 0x0000, 0x0001, 0x0000, 0x003f, 0x0012, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 
+	0x000f, 0x000f, 0x0012, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x001e, 0x0021, 0x0021, 0x0024, 0x0024, 0x0027, 0x002a, 
+	0x002d, 0x002d, 0x0030, 0x0030, 0x0033, 0x0033, 0x0036, 0x0036, 0x0039, 0x003c, 0x0039, 0xf89c, 0xfef9, 0xfa9d, 0xf89c, 0xfef9, 
+	0xfcea, 0xf8c0, 0xfef9, 0xfe5c, 0xf92c, 0xfef9, 0xffbf, 0xf9db, 0xfef9, 0x0105, 0xfac6, 0xfef9, 0x0224, 0xfbe5, 0xfef9, 0x030f, 
+	0xfca9, 0xfef9, 0x0378, 0xfd2c, 0xfef9, 0x03be, 0xfe8f, 0xfef9, 0x042a, 0x0000, 0xfef9, 0x044e, 0x0171, 0xfef9, 0x042a, 0x02d4, 
+	0xfef9, 0x03be, 0x0357, 0xfef9, 0x0378, 0x041b, 0xfef9, 0x030f, 0x053a, 0xfef9, 0x0224, 0x0625, 0xfef9, 0x0105, 0x06d4, 0xfef9, 
+	0xffbf, 0x0740, 0xfef9, 0xfe5c, 0x0764, 0xfef9, 0xfcea, 0x0764, 0xfef9, 0xfa9d, 0x0002, 0x0000, 0xfe0b, 0x0d2c, 0x0615, 0x0000, 
+	0x0001, 0x0000, 0x0045, 0x0016, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x000c, 0x0009, 0x000f, 0x0012, 0x000f, 0x0015, 
+	0x0012, 0x0018, 0x0018, 0x001b, 0x0015, 0x001e, 0x001e, 0x0021, 0x001b, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 
+	0x002a, 0x0030, 0x002d, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003f, 0x003c, 0x0042, 0x003f, 0x0042, 
+	0xf9fe, 0xfdf2, 0x0d2b, 0xf9fe, 0xfdf2, 0x0e21, 0x0000, 0xfdf2, 0x0e21, 0x0602, 0xfdf2, 0x0e21, 0x0602, 0xfdf2, 0x0d2b, 0xfd25, 
+	0xfe23, 0x0d46, 0xfd25, 0xfe23, 0x0e30, 0xfde0, 0xfe23, 0x0c29, 0xfddc, 0xfe23, 0x0e30, 0xfe93, 0xfe23, 0x0e30, 0xfe93, 0xfe23, 
+	0x0c88, 0xff4a, 0xfe23, 0x0cc3, 0xff4a, 0xfe23, 0x0e30, 0x0000, 0xfe23, 0x0cd1, 0x0000, 0xfe23, 0x0e30, 0x00b6, 0xfe23, 0x0cc3, 
+	0x00b6, 0xfe23, 0x0e30, 0x016d, 0xfe23, 0x0c88, 0x016d, 0xfe23, 0x0e30, 0x0224, 0xfe23, 0x0c30, 0x0224, 0xfe23, 0x0e30, 0x02db, 
+	0xfe23, 0x0d46, 0x02db, 0xfe23, 0x0e30, 0x0003, 0xf9da, 0x0000, 0xfbe4, 0x00fb, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 
+	0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xf926, 0x0000, 0xfb34, 0xf926, 0x0000, 0xfc93, 0xfa8d, 0x0000, 0xfc93, 0xfa8d, 0x0000, 
+	0xfb34, 0x0003, 0xf9da, 0x0000, 0xfd8c, 0x0133, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 
+	0x0009, 0xf926, 0x0000, 0xfc93, 0xf926, 0x0000, 0xfe85, 0xfa8d, 0x0000, 0xfe85, 0xfa8d, 0x0000, 0xfc93, 0x0003, 0xf9da, 0x0000, 
+	0xff59, 0x0116, 0x0000, 0x0001, 0x0000, 0x000f, 0x0003, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0xf926, 0x0000, 0xfe85, 0xf926, 0x0000, 0x001e, 0xfa8d, 0x0000, 0x002c, 0xfa8d, 0x0000, 0xfe85, 0xf926, 0x0000, 0x002c, 0x0003, 
+	0xf9da, 0x0000, 0x0103, 0x0119, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xf926, 
+	0x0000, 0x002c, 0xf926, 0x0000, 0x01db, 0xfa8d, 0x0000, 0x01db, 0xfa8d, 0x0000, 0x002c, 0x0003, 0x05be, 0x0000, 0xfbe4, 0x00c8, 
+	0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x055f, 0x0000, 0xfb34, 0x055f, 0x0000, 
+	0xfc93, 0x061d, 0x0000, 0xfb34, 0x061d, 0x0000, 0xfc93, 0x0003, 0x05be, 0x0000, 0xfd3c, 0x00c1, 0x0000, 0x0001, 0x0000, 0x000c, 
+	0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x055f, 0x0000, 0xfc93, 0x055f, 0x0000, 0xfde5, 0x061d, 0x0000, 0xfc93, 
+	0x061d, 0x0000, 0xfde5, 0x0003, 0x05be, 0x0000, 0xfe8e, 0x00c1, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0x055f, 0x0000, 0xfde5, 0x055f, 0x0000, 0xff37, 0x061d, 0x0000, 0xfde5, 0x061d, 0x0000, 0xff37, 0x0003, 
+	0x05be, 0x0000, 0xffe0, 0x00c1, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x055f, 
+	0x0000, 0xff37, 0x055f, 0x0000, 0x0089, 0x061d, 0x0000, 0xff37, 0x061d, 0x0000, 0x0089, 0x0003, 0x05be, 0x0000, 0x0132, 0x00c1, 
+	0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x055f, 0x0000, 0x0089, 0x055f, 0x0000, 
+	0x01db, 0x061d, 0x0000, 0x0089, 0x061d, 0x0000, 0x01db, 0x0003, 0xfdd8, 0x0000, 0xff00, 0x0160, 0x0000, 0x0001, 0x0000, 0x000c, 
+	0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfce4, 0x0000, 0xffaf, 0xfddf, 0x0000, 0x0060, 0xfecc, 0x0000, 0xfe93, 
+	0xfdcd, 0x0000, 0xfda0, 0x0003, 0xfb14, 0x0000, 0xfbe4, 0x00dd, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0xfa8d, 0x0000, 0xfb34, 0xfa8d, 0x0000, 0xfc93, 0xfb9a, 0x0000, 0xfb34, 0xfb9a, 0x0000, 0xfc93, 0x0002, 
+	0x0000, 0x0457, 0x0000, 0x0308, 0x0000, 0x0001, 0x0000, 0x00e4, 0x004c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 
+	0x000c, 0x000c, 0x000f, 0x0006, 0x0012, 0x000f, 0x0015, 0x0018, 0x0012, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 
+	0x0021, 0x0024, 0x0027, 0x0027, 0x002a, 0x002a, 0x002d, 0x002d, 0x0030, 0x0030, 0x0033, 0x0033, 0x0036, 0x0036, 0x0039, 0x003c, 
+	0x0039, 0x003f, 0x003c, 0x003f, 0x0042, 0x0042, 0x0045, 0x0045, 0x0048, 0x0048, 0x004b, 0x004b, 0x004e, 0x004e, 0x0051, 0x0054, 
+	0x0051, 0x0057, 0x0054, 0x0057, 0x005a, 0x005a, 0x005d, 0x005d, 0x0060, 0x0060, 0x0063, 0x0063, 0x0066, 0x0066, 0x0069, 0x006c, 
+	0x0069, 0x006f, 0x006c, 0x006f, 0x0072, 0x0072, 0x0075, 0x0075, 0x0078, 0x0078, 0x007b, 0x007b, 0x007e, 0x007e, 0x0081, 0x0084, 
+	0x0081, 0x0087, 0x0084, 0x0087, 0x008a, 0x008a, 0x008d, 0x008d, 0x0090, 0x0090, 0x0093, 0x0093, 0x0096, 0x0099, 0x0096, 0x009c, 
+	0x0099, 0x009f, 0x009c, 0x00a2, 0x009f, 0x00a5, 0x00a2, 0x00a8, 0x00a5, 0x00ab, 0x00a8, 0x00ab, 0x00ae, 0x00ae, 0x00b1, 0x00b4, 
+	0x00b1, 0x00b7, 0x00b4, 0x00ba, 0x00b7, 0x00bd, 0x00ba, 0x00c0, 0x00bd, 0x00c3, 0x00c0, 0x00c3, 0x00c6, 0x00c6, 0x00c9, 0x00cc, 
+	0x00c9, 0x00cf, 0x00cc, 0x00d2, 0x00cf, 0x00d5, 0x00d2, 0x00d8, 0x00d5, 0x00db, 0x00d8, 0x00db, 0x00de, 0x00de, 0x00e1, 0x0015, 
+	0x00e1, 0xff9a, 0x023a, 0x0000, 0xff9a, 0x0257, 0x0000, 0xffb7, 0x023a, 0x0000, 0xff9a, 0x02ea, 0x0000, 0xff9a, 0x0307, 0x0000, 
+	0xffb7, 0x0307, 0x0000, 0x0049, 0x023a, 0x0000, 0x0049, 0x0307, 0x0000, 0x0049, 0x01a8, 0x0000, 0x000e, 0x01a8, 0x0000, 0xfff2, 
+	0x01a8, 0x0000, 0xfff2, 0x018b, 0x0000, 0xfff2, 0x0150, 0x0000, 0x000e, 0x0150, 0x0000, 0x000e, 0x018b, 0x0000, 0x0049, 0x018b, 
+	0x0000, 0x0066, 0x018b, 0x0000, 0x0066, 0x01a8, 0x0000, 0x0066, 0x023a, 0x0000, 0x0066, 0x0257, 0x0000, 0x0049, 0x0257, 0x0000, 
+	0xffb7, 0x0257, 0x0000, 0xffb7, 0x02ea, 0x0000, 0x0049, 0x02ea, 0x0000, 0x0066, 0x02ea, 0x0000, 0x0066, 0x0307, 0x0000, 0x0066, 
+	0x0399, 0x0000, 0x0066, 0x03b6, 0x0000, 0x0049, 0x03b6, 0x0000, 0xffb7, 0x03b6, 0x0000, 0xffb7, 0x0449, 0x0000, 0x0049, 0x0449, 
+	0x0000, 0x0066, 0x0449, 0x0000, 0x0066, 0x0466, 0x0000, 0x0066, 0x04f8, 0x0000, 0x0066, 0x0516, 0x0000, 0x0049, 0x0516, 0x0000, 
+	0xffb7, 0x0516, 0x0000, 0xffb7, 0x05a8, 0x0000, 0x0049, 0x05a8, 0x0000, 0x0066, 0x05a8, 0x0000, 0x0066, 0x05c5, 0x0000, 0x0066, 
+	0x0657, 0x0000, 0x0066, 0x0675, 0x0000, 0x0049, 0x0675, 0x0000, 0xffb7, 0x0675, 0x0000, 0xffb7, 0x0707, 0x0000, 0xfff2, 0x0707, 
+	0x0000, 0x000e, 0x0707, 0x0000, 0x000e, 0x0724, 0x0000, 0x000e, 0x075f, 0x0000, 0xfff2, 0x075f, 0x0000, 0xfff2, 0x0724, 0x0000, 
+	0xffb7, 0x0724, 0x0000, 0xff9a, 0x0724, 0x0000, 0xff9a, 0x0707, 0x0000, 0xff9a, 0x0675, 0x0000, 0xff9a, 0x0657, 0x0000, 0xffb7, 
+	0x0657, 0x0000, 0x0049, 0x0657, 0x0000, 0x0049, 0x05c5, 0x0000, 0xffb7, 0x05c5, 0x0000, 0xff9a, 0x05c5, 0x0000, 0xff9a, 0x05a8, 
+	0x0000, 0xff9a, 0x0516, 0x0000, 0xff9a, 0x04f8, 0x0000, 0xffb7, 0x04f8, 0x0000, 0x0049, 0x04f8, 0x0000, 0x0049, 0x0466, 0x0000, 
+	0xffb7, 0x0466, 0x0000, 0xff9a, 0x0466, 0x0000, 0xff9a, 0x0449, 0x0000, 0xff9a, 0x03b6, 0x0000, 0xff9a, 0x0399, 0x0000, 0xffb7, 
+	0x0399, 0x0000, 0x0049, 0x0399, 0x0000, 0x0002, 0x0000, 0x00b2, 0x0000, 0x00da, 0x03e7, 0x0002, 0x0000, 0x0156, 0x00a1, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 
+	0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0009, 0x001e, 0x000f, 0x0021, 0x0012, 0x0024, 0x0015, 
+	0x0024, 0x0018, 0x0027, 0x001b, 0x0027, 0x0015, 0x002a, 0x002a, 0x001e, 0x001b, 0x002d, 0x002d, 0x0021, 0x0024, 0x0030, 0x0030, 
+	0x002a, 0x0027, 0x0033, 0x0033, 0x002d, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x0039, 0x002a, 0x003c, 0x0036, 0x003c, 0x002d, 
+	0x003f, 0x0039, 0x003f, 0x003c, 0x003f, 0x003c, 0x0042, 0x001e, 0x0042, 0x003f, 0x0045, 0x0042, 0x0045, 0x0021, 0x0045, 0x0048, 
+	0x004b, 0x0048, 0x004e, 0x0048, 0x0051, 0x004b, 0x0054, 0x004e, 0x0054, 0x004b, 0x0057, 0x004e, 0x005a, 0x0051, 0x005a, 0x0054, 
+	0x005d, 0x0057, 0x005d, 0x0051, 0x0060, 0x0057, 0x0063, 0x005a, 0x0066, 0x0060, 0x0066, 0x005d, 0x0069, 0x0063, 0x0069, 0x0060, 
+	0x006c, 0x0063, 0x006f, 0x006c, 0x006f, 0x0066, 0x0072, 0x006c, 0x0072, 0x0069, 0x0075, 0x006f, 0x0075, 0x0072, 0x0075, 0x0078, 
+	0x007b, 0x0078, 0x007e, 0x0078, 0x0081, 0x007b, 0x0084, 0x007e, 0x0084, 0x007b, 0x0087, 0x0081, 0x0087, 0x007e, 0x008a, 0x0081, 
+	0x008a, 0x0084, 0x008d, 0x0087, 0x008d, 0x008a, 0x008d, 0x0090, 0x0093, 0x0090, 0x0096, 0x0093, 0x0099, 0x0096, 0x0099, 0x009c, 
+	0x009f, 0x009c, 0x00a2, 0x009f, 0x00a5, 0x00a2, 0x00a5, 0x009f, 0x00a8, 0x00a5, 0x00ab, 0x00a8, 0x00ab, 0x00a8, 0x00ae, 0x00ab, 
+	0x00b1, 0x00ae, 0x00b1, 0x00ae, 0x00b4, 0x00b1, 0x00b7, 0x00b4, 0x00b7, 0x00ba, 0x00b4, 0x00ba, 0x00bd, 0x00bd, 0x00b7, 0x00c0, 
+	0x00c3, 0x00c0, 0x00c6, 0x00c3, 0x00c9, 0x00c6, 0x00c9, 0x00cc, 0x00cf, 0x00cc, 0x00d2, 0x00cf, 0x00d5, 0x00d2, 0x00d5, 0x00d8, 
+	0x00db, 0x00d8, 0x00de, 0x00d8, 0x00e1, 0x00db, 0x00e4, 0x00de, 0x00e4, 0x00db, 0x00e7, 0x00de, 0x00ea, 0x00de, 0x00ed, 0x00e1, 
+	0x00ed, 0x00e4, 0x00f0, 0x00ea, 0x00f0, 0x00e4, 0x00f3, 0x00e7, 0x00f3, 0x00ea, 0x00f6, 0x00ed, 0x00f6, 0x00f0, 0x00f9, 0x00f3, 
+	0x00f9, 0x00e7, 0x00fc, 0x00ed, 0x00ff, 0x00f3, 0x0102, 0x00fc, 0x0102, 0x00f6, 0x0105, 0x0105, 0x00ff, 0x00f9, 0x0108, 0x0108, 
+	0x0102, 0x0105, 0x010b, 0x0108, 0x010e, 0x010b, 0x010e, 0x0111, 0x00ff, 0x00e1, 0x0111, 0x0111, 0x0114, 0x0102, 0x0117, 0x010e, 
+	0x0117, 0x010b, 0x011a, 0x0114, 0x011a, 0x011a, 0x0117, 0x00ff, 0x011a, 0x0114, 0x011d, 0x011d, 0x0117, 0x00fc, 0x011d, 0x0120, 
+	0x0123, 0x0126, 0x0129, 0x0126, 0x012c, 0x0129, 0x012f, 0x012c, 0x012f, 0x0132, 0x0135, 0x0132, 0x0138, 0x0135, 0x013b, 0x0138, 
+	0x013b, 0x013e, 0x0141, 0x013e, 0x0144, 0x0141, 0x0147, 0x0144, 0x0147, 0x014a, 0x014d, 0x014a, 0x0150, 0x014d, 0x0153, 0x0150, 
+	0x0153, 0xff5d, 0x00e7, 0xffbd, 0xff5d, 0x00e7, 0x0043, 0xff95, 0x010d, 0xffd4, 0xffbd, 0x00e7, 0xff5d, 0xff95, 0x010d, 0x002c, 
+	0xffbd, 0x00e7, 0x00a3, 0xffcc, 0x0133, 0xffeb, 0xffd4, 0x010d, 0xff95, 0xffcc, 0x0133, 0x0015, 0xffd4, 0x010d, 0x006b, 0x0043, 
+	0x00e7, 0xff5d, 0x0043, 0x00e7, 0x00a3, 0xffeb, 0x0133, 0xffcc, 0xffeb, 0x0133, 0x0034, 0x002c, 0x010d, 0xff95, 0x002c, 0x010d, 
+	0x006b, 0x0015, 0x0133, 0xffcc, 0x0015, 0x0133, 0x0034, 0x0034, 0x0133, 0xffeb, 0x0034, 0x0133, 0x0015, 0x006b, 0x010d, 0xffd4, 
+	0x006b, 0x010d, 0x002c, 0x00a3, 0x00e7, 0xffbd, 0x00a3, 0x00e7, 0x0043, 0xff80, 0x00c8, 0xffcb, 0xff80, 0x00c8, 0x0035, 0xff80, 
+	0x00d6, 0xffcb, 0xffcb, 0x00c8, 0xff80, 0xff80, 0x00d6, 0x0035, 0xffcb, 0x00c8, 0x0080, 0xffcb, 0x00d6, 0xff80, 0xffcb, 0x00d6, 
+	0x0080, 0x0035, 0x00c8, 0xff80, 0x0035, 0x00c8, 0x0080, 0x0035, 0x00d6, 0xff80, 0x0035, 0x00d6, 0x0080, 0x0080, 0x00c8, 0xffcb, 
+	0x0080, 0x00c8, 0x0035, 0x0080, 0x00d6, 0xffcb, 0x0080, 0x00d6, 0x0035, 0xff87, 0x0000, 0xffdd, 0xff87, 0x00f7, 0xffdd, 0xff91, 
+	0x0000, 0xffc4, 0xff93, 0x0000, 0xffe0, 0xff91, 0x00f7, 0xffc4, 0xff93, 0x00f7, 0xffe0, 0xff9c, 0x0000, 0xffca, 0xff9c, 0x00f7, 
+	0xffca, 0xff87, 0x0000, 0x0023, 0xff87, 0x00f7, 0x0023, 0xff91, 0x0000, 0x003c, 0xff91, 0x00f7, 0x003c, 0xff88, 0x000e, 0xffcf, 
+	0xff88, 0x000e, 0x0032, 0xff88, 0x001d, 0xffcf, 0xff88, 0x001d, 0x0032, 0xffcf, 0x000e, 0x0078, 0xffcf, 0x001d, 0x0078, 0x0031, 
+	0x000e, 0x0078, 0x0031, 0x001d, 0x0078, 0x0078, 0x000e, 0x0032, 0x0078, 0x001d, 0x0032, 0x0078, 0x000e, 0xffcf, 0x0078, 0x001d, 
+	0xffcf, 0xffc4, 0x0000, 0x006f, 0xffc4, 0x00f7, 0x006f, 0xffdd, 0x0000, 0x0079, 0xffdd, 0x00f7, 0x0079, 0xffc4, 0x00c8, 0xff91, 
+	0xffc4, 0x00f7, 0xff91, 0xffdd, 0x00c8, 0xff87, 0xffdd, 0x00f7, 0xff87, 0xffcc, 0x0138, 0xffeb, 0xffcc, 0x0138, 0x0015, 0xffcc, 
+	0x015b, 0xffeb, 0xffeb, 0x0138, 0xffcc, 0xffcc, 0x015b, 0x0015, 0xffeb, 0x0138, 0x0034, 0xffe5, 0x0165, 0xfff5, 0xffeb, 0x015b, 
+	0xffcc, 0xffe5, 0x0165, 0x000b, 0xffeb, 0x015b, 0x0034, 0xfff5, 0x0165, 0xffe5, 0xfff5, 0x0165, 0x001b, 0x0015, 0x0138, 0x0034, 
+	0x0015, 0x015b, 0xffcc, 0x0015, 0x015b, 0x0034, 0x000b, 0x0165, 0xffe5, 0x000b, 0x0165, 0x001b, 0x001b, 0x0165, 0xfff5, 0x001b, 
+	0x0165, 0x000b, 0x0015, 0x0138, 0xffcc, 0x0034, 0x0138, 0xffeb, 0x0034, 0x015b, 0x0015, 0x0034, 0x015b, 0xffeb, 0x0034, 0x0138, 
+	0x0015, 0xffdd, 0x001d, 0x0079, 0x0023, 0x001d, 0x0079, 0x0023, 0x0000, 0x0079, 0x0023, 0x00f7, 0x0079, 0x003c, 0x0000, 0x006f, 
+	0x003c, 0x00f7, 0x006f, 0x0023, 0x00c8, 0xff87, 0x0023, 0x00f7, 0xff87, 0x003c, 0x00c8, 0xff91, 0x003c, 0x00f7, 0xff91, 0x006f, 
+	0x0000, 0xffc4, 0x006f, 0x00f7, 0xffc4, 0x0079, 0x0000, 0xffdd, 0x0079, 0x00f7, 0xffdd, 0x006f, 0x0000, 0x003c, 0x006f, 0x00f7, 
+	0x003c, 0x0079, 0x0000, 0x0023, 0x0079, 0x00f7, 0x0023, 0x12c0, 0x00b4, 0x005c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 
+	0x000c, 0x001b, 0x0015, 0x001b, 0x0009, 0x001e, 0x000f, 0x0021, 0x0012, 0x0024, 0x0015, 0x0024, 0x0012, 0x0027, 0x0027, 0x001e, 
+	0x0018, 0x002a, 0x001b, 0x002a, 0x0018, 0x002d, 0x002d, 0x0021, 0x001b, 0x0030, 0x0033, 0x0030, 0x0015, 0x0033, 0x0033, 0x0036, 
+	0x0024, 0x0036, 0x0033, 0x0039, 0x0036, 0x0039, 0x0030, 0x003c, 0x002a, 0x003c, 0x0030, 0x003f, 0x003c, 0x003f, 0x0039, 0x003f, 
+	0x0036, 0x0042, 0x003c, 0x0045, 0x0039, 0x0048, 0x0042, 0x0048, 0x003f, 0x004b, 0x0045, 0x004b, 0x0048, 0x004b, 0x004e, 0x0042, 
+	0x0024, 0x004e, 0x004e, 0x0027, 0x004e, 0x0051, 0x0054, 0x0045, 0x002a, 0x0054, 0x0054, 0x002d, 0x0054, 0x0057, 0x0051, 0x0057, 
+	0x0027, 0x005a, 0x0051, 0x005a, 0x002d, 0x005d, 0x0057, 0x005d, 0x005a, 0x005d, 0x0051, 0x0060, 0x0042, 0x0060, 0x0048, 0x0060, 
+	0x0057, 0x0063, 0x0060, 0x0063, 0x0045, 0x0063, 0x004b, 0x0063, 0x005a, 0x0066, 0x001e, 0x0066, 0x0066, 0x0069, 0x0021, 0x0069, 
+	0x005d, 0x0069, 0x006c, 0x006f, 0x006c, 0x0072, 0x006c, 0x0075, 0x006f, 0x0078, 0x0075, 0x0078, 0x0072, 0x007b, 0x0072, 0x007e, 
+	0x007e, 0x0081, 0x007e, 0x0084, 0x0084, 0x0087, 0x0084, 0x008a, 0x008d, 0x008a, 0x008d, 0x0090, 0x008a, 0x0093, 0x0096, 0x0099, 
+	0x0096, 0x009c, 0x0099, 0x009f, 0x009c, 0x00a2, 0x009c, 0x00a5, 0x009f, 0x00a8, 0x00a5, 0x00ab, 0x00a5, 0x00ae, 0x00a8, 0x00b1, 
+	0x00ae, 0x00b1, 0xff5d, 0x00e7, 0xffbd, 0xff5d, 0x00e7, 0x0043, 0xff95, 0x010d, 0xffd4, 0xffbd, 0x00e7, 0xff5d, 0xff95, 0x010d, 
+	0x002c, 0xffbd, 0x00e7, 0x00a3, 0xffd4, 0x010d, 0xff95, 0xffcc, 0x0136, 0xffeb, 0xffd4, 0x010d, 0x006b, 0xffcc, 0x0136, 0x0015, 
+	0x0043, 0x00e7, 0xff5d, 0x0043, 0x00e7, 0x00a3, 0xffeb, 0x0136, 0xffcc, 0x002c, 0x010d, 0xff95, 0xffeb, 0x0136, 0x0034, 0x002c, 
+	0x010d, 0x006b, 0xffcc, 0x015b, 0x0015, 0xffcc, 0x015b, 0xffeb, 0xffeb, 0x015b, 0xffcc, 0xffed, 0x0165, 0xffed, 0xffeb, 0x015b, 
+	0x0034, 0xffed, 0x0165, 0x0013, 0x0015, 0x015b, 0xffcc, 0x0015, 0x015b, 0x0034, 0x0013, 0x0165, 0xffed, 0x0013, 0x0165, 0x0013, 
+	0x0015, 0x0136, 0xffcc, 0x0034, 0x0136, 0xffeb, 0x0015, 0x0136, 0x0034, 0x0034, 0x0136, 0x0015, 0x006b, 0x010d, 0xffd4, 0x006b, 
+	0x010d, 0x002c, 0x0034, 0x015b, 0xffeb, 0x0034, 0x015b, 0x0015, 0x00a3, 0x00e7, 0xffbd, 0x00a3, 0x00e7, 0x0043, 0xff8e, 0x0009, 
+	0xffcf, 0xff93, 0x0000, 0xffe0, 0xff8a, 0x000b, 0x0031, 0xff91, 0x00f7, 0xffce, 0xff93, 0x00f7, 0xffe0, 0xff8c, 0x00f7, 0x0030, 
+	0xffd2, 0x000e, 0x0077, 0xffd0, 0x00f7, 0x0074, 0x002e, 0x000e, 0x0077, 0x0030, 0x00f7, 0x0074, 0x0076, 0x000b, 0x0031, 0x0076, 
+	0x000b, 0xffd0, 0x0074, 0x00f7, 0xffd0, 0x0074, 0x00f7, 0x0030, 0xff80, 0x00cf, 0xffcb, 0xff80, 0x00cf, 0x0035, 0xffce, 0x00cc, 
+	0xff86, 0xffcb, 0x00cf, 0x0080, 0xffd0, 0x00f7, 0xff8c, 0x0032, 0x00cc, 0xff86, 0x0035, 0x00cf, 0x0080, 0x0030, 0x00f7, 0xff8c, 
+	0x0080, 0x00cf, 0xffcb, 0x0080, 0x00cf, 0x0035, 0x0002, 0x0000, 0x0000, 0xfc8b, 0x00e1, 0x0000, 0x0001, 0x0000, 0x0018, 0x0008, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 
+	0xff38, 0x0000, 0xfcf4, 0xffc2, 0x0000, 0xfc69, 0x00c8, 0x0000, 0xfcf4, 0x003e, 0x0000, 0xfc69, 0xffc2, 0x0000, 0xfc22, 0xffc2, 
+	0x0000, 0xfc61, 0x003e, 0x0000, 0xfc22, 0x003e, 0x0000, 0xfc61, 0x0002, 0x0000, 0x0000, 0xfdea, 0x01a0, 0x0000, 0x0001, 0x0000, 
+	0x0063, 0x001e, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 
+	0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x0021, 0x0024, 0x0024, 0x0027, 0x0027, 0x002a, 0x002a, 0x002d, 0x002d, 0x0030, 
+	0x0030, 0x0033, 0x0033, 0x0036, 0x0036, 0x0039, 0x0039, 0x003c, 0x003c, 0x003f, 0x0042, 0x0045, 0x0045, 0x0048, 0x0048, 0x004b, 
+	0x004b, 0x004e, 0x004e, 0x0051, 0x0051, 0x0054, 0x0054, 0x0057, 0x0057, 0x005a, 0x005a, 0x005d, 0x005d, 0x0060, 0xfe65, 0x0000, 
+	0xfda6, 0xfea3, 0x0000, 0xfdf1, 0xfeee, 0x0000, 0xfe2e, 0xff43, 0x0000, 0xfe5c, 0xffa0, 0x0000, 0xfe78, 0x0000, 0x0000, 0xfe81, 
+	0x0060, 0x0000, 0xfe78, 0x00bd, 0x0000, 0xfe5c, 0x0112, 0x0000, 0xfe2e, 0x015d, 0x0000, 0xfdf1, 0x019b, 0x0000, 0xfda6, 0xfea4, 
+	0x0000, 0xfd7c, 0xfed8, 0x0000, 0xfdbb, 0xff17, 0x0000, 0xfdf0, 0xff60, 0x0000, 0xfe16, 0xffaf, 0x0000, 0xfe2e, 0x0000, 0x0000, 
+	0xfe36, 0x0051, 0x0000, 0xfe2e, 0x00a0, 0x0000, 0xfe16, 0x00e9, 0x0000, 0xfdf0, 0x0128, 0x0000, 0xfdbb, 0x015c, 0x0000, 0xfd7c, 
+	0xfee2, 0x0000, 0xfd52, 0xff0d, 0x0000, 0xfd86, 0xff41, 0x0000, 0xfdb1, 0xff7d, 0x0000, 0xfdd1, 0xffbd, 0x0000, 0xfde5, 0x0000, 
+	0x0000, 0xfdeb, 0x0043, 0x0000, 0xfde5, 0x0083, 0x0000, 0xfdd1, 0x00bf, 0x0000, 0xfdb1, 0x00f3, 0x0000, 0xfd86, 0x011e, 0x0000, 
+	0xfd52, 0x0003, 0xfd94, 0x0015, 0xff00, 0x004e, 0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 
+	0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 
+	0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0xfd4f, 0x0000, 0xff1c, 0xfd4f, 0x002b, 
+	0xff1c, 0xfd62, 0x0000, 0xfece, 0xfd94, 0x0000, 0xff46, 0xfd62, 0x002b, 0xfece, 0xfd94, 0x002b, 0xff46, 0xfdc5, 0x002b, 0xff31, 
+	0xfdd9, 0x002b, 0xfee3, 0xfd94, 0x0000, 0xfeb9, 0xfd94, 0x002b, 0xfeb9, 0xfdd9, 0x0000, 0xfee3, 0xfdc5, 0x0000, 0xff31, 0x0003, 
+	0xfeb1, 0x0015, 0xffbe, 0x004d, 0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 
+	0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 
+	0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 
+	0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0xfe6c, 0x0000, 0xffda, 0xfe6c, 0x002b, 0xffda, 0xfe7f, 
+	0x0000, 0xff8c, 0xfeb1, 0x0000, 0x0003, 0xfe7f, 0x002b, 0xff8c, 0xfeb1, 0x002b, 0x0003, 0xfee2, 0x002b, 0xffef, 0xfef5, 0x002b, 
+	0xffa1, 0xfeb1, 0x0000, 0xff78, 0xfeb1, 0x002b, 0xff78, 0xfef5, 0x0000, 0xffa1, 0xfee2, 0x0000, 0xffef, 0x0003, 0x014f, 0x0015, 
+	0xffbe, 0x004e, 0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 
+	0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 
+	0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 
+	0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0x010b, 0x0000, 0xffda, 0x010b, 0x002b, 0xffda, 0x011e, 0x0000, 0xff8c, 
+	0x014f, 0x0000, 0x0003, 0x011e, 0x002b, 0xff8c, 0x014f, 0x002b, 0x0003, 0x0181, 0x002b, 0xffef, 0x0194, 0x002b, 0xffa1, 0x014f, 
+	0x0000, 0xff78, 0x014f, 0x002b, 0xff78, 0x0194, 0x0000, 0xffa1, 0x0181, 0x0000, 0xffef, 0x0003, 0x026c, 0x0015, 0xff00, 0x004e, 
+	0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 
+	0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 
+	0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 
+	0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0x0227, 0x0000, 0xff1c, 0x0227, 0x002b, 0xff1c, 0x023b, 0x0000, 0xfece, 0x026c, 0x0000, 
+	0xff46, 0x023b, 0x002b, 0xfece, 0x026c, 0x002b, 0xff46, 0x029e, 0x002b, 0xff31, 0x02b1, 0x002b, 0xfee3, 0x026c, 0x0000, 0xfeb9, 
+	0x026c, 0x002b, 0xfeb9, 0x02b1, 0x0000, 0xfee3, 0x029e, 0x0000, 0xff31, 0x0003, 0x032a, 0x0015, 0xfde3, 0x004e, 0x0000, 0x0001, 
+	0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 
+	0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 
+	0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 
+	0x0021, 0x0015, 0x0012, 0x02e6, 0x0000, 0xfdff, 0x02e6, 0x002b, 0xfdff, 0x02f9, 0x0000, 0xfdb1, 0x032b, 0x0000, 0xfe29, 0x02f9, 
+	0x002b, 0xfdb1, 0x032b, 0x002b, 0xfe29, 0x035c, 0x002b, 0xfe14, 0x036f, 0x002b, 0xfdc6, 0x032b, 0x0000, 0xfd9c, 0x032b, 0x002b, 
+	0xfd9c, 0x036f, 0x0000, 0xfdc6, 0x035c, 0x0000, 0xfe14, 0x0003, 0x0482, 0xfe08, 0x03c8, 0x004e, 0x0000, 0x0001, 0x0000, 0x0024, 
+	0x0010, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 
+	0x0009, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 
+	0x0015, 0x001b, 0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 
+	0x0012, 0x043d, 0xfdf2, 0x03e5, 0x043d, 0xfe1e, 0x03e5, 0x0450, 0xfdf2, 0x0397, 0x0482, 0xfdf2, 0x040e, 0x0450, 0xfe1e, 0x0397, 
+	0x0482, 0xfe1e, 0x040e, 0x04b4, 0xfe1e, 0x03fa, 0x04c7, 0xfe1e, 0x03ac, 0x0482, 0xfdf2, 0x0382, 0x0482, 0xfe1e, 0x0382, 0x04c7, 
+	0xfdf2, 0x03ac, 0x04b4, 0xfdf2, 0x03fa, 0x0003, 0xfb7c, 0xfe08, 0x03c8, 0x004e, 0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 
+	0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 
+	0x000f, 0x0003, 0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 
+	0x0018, 0x001b, 0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0xfb37, 
+	0xfdf2, 0x03e5, 0xfb37, 0xfe1e, 0x03e5, 0xfb4a, 0xfdf2, 0x0397, 0xfb7b, 0xfdf2, 0x040e, 0xfb4a, 0xfe1e, 0x0397, 0xfb7b, 0xfe1e, 
+	0x040e, 0xfbad, 0xfe1e, 0x03fa, 0xfbc0, 0xfe1e, 0x03ac, 0xfb7b, 0xfdf2, 0x0382, 0xfb7b, 0xfe1e, 0x0382, 0xfbc0, 0xfdf2, 0x03ac, 
+	0xfbad, 0xfdf2, 0x03fa, 0x0003, 0xfcd6, 0x0015, 0xfde3, 0x004d, 0x0000, 0x0001, 0x0000, 0x0024, 0x0010, 0x0000, 0x0003, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x0003, 0x000c, 0x0006, 0x0003, 0x0009, 0x000f, 0x0003, 0x000f, 0x0012, 0x0009, 0x0012, 0x000f, 0x0003, 
+	0x0012, 0x0015, 0x0003, 0x0015, 0x000c, 0x0006, 0x000c, 0x0018, 0x000c, 0x001b, 0x0018, 0x000c, 0x0015, 0x001b, 0x0018, 0x001b, 
+	0x0015, 0x0018, 0x0015, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x001e, 0x0015, 0x0021, 0x0015, 0x0012, 0xfc91, 0x0000, 0xfdff, 
+	0xfc91, 0x002b, 0xfdff, 0xfca4, 0x0000, 0xfdb1, 0xfcd5, 0x0000, 0xfe29, 0xfca4, 0x002b, 0xfdb1, 0xfcd5, 0x002b, 0xfe29, 0xfd07, 
+	0x002b, 0xfe14, 0xfd1a, 0x002b, 0xfdc6, 0xfcd5, 0x0000, 0xfd9c, 0xfcd5, 0x002b, 0xfd9c, 0xfd1a, 0x0000, 0xfdc6, 0xfd07, 0x0000, 
+	0xfe14, 0x0002, 0x068a, 0xfef9, 0x08e7, 0x0429, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0009, 0x0006, 0x0009, 0x05b4, 0xfef9, 0x04d3, 0x05b4, 0xfef9, 0x0cfb, 0x0761, 0xfef9, 0x04d3, 0x0761, 0xfef9, 0x0cfb, 0x0002, 
+	0xf976, 0xfef9, 0x08e7, 0x0429, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 
+	0x0009, 0xf89f, 0xfef9, 0x04d3, 0xf89f, 0xfef9, 0x0cfb, 0xfa4c, 0xfef9, 0x04d3, 0xfa4c, 0xfef9, 0x0cfb, 0x0002, 0x0000, 0xfdf3, 
+	0x0909, 0x0256, 0x0000, 0x0001, 0x0000, 0x0030, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 
+	0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 0x0021, 
+	0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0xfdab, 0xfdf3, 0x090a, 0xfdd8, 0xfdf3, 0x0825, 0xfdd8, 0xfdf3, 0x09ee, 
+	0xfe5a, 0xfdf3, 0x0763, 0xfe5a, 0xfdf3, 0x0ab0, 0xff1c, 0xfdf3, 0x06e1, 0xff1c, 0xfdf3, 0x0b32, 0x0000, 0xfdf3, 0x06b4, 0x0000, 
+	0xfdf3, 0x0b5f, 0x00e4, 0xfdf3, 0x06e1, 0x00e4, 0xfdf3, 0x0b32, 0x01a6, 0xfdf3, 0x0763, 0x01a6, 0xfdf3, 0x0ab0, 0x0228, 0xfdf3, 
+	0x0825, 0x0228, 0xfdf3, 0x09ee, 0x0255, 0xfdf3, 0x090a, 0x0002, 0x0117, 0xfdf3, 0x09d1, 0x0070, 0x0000, 0x0001, 0x0000, 0x0024, 
+	0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 
+	0x0018, 0x0015, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0021, 0x00a8, 0xfdf3, 0x09d2, 0x00b7, 0xfdf3, 0x099a, 0x00b7, 
+	0xfdf3, 0x0a09, 0x00e0, 0xfdf3, 0x0971, 0x00e0, 0xfdf3, 0x0a32, 0x0117, 0xfdf3, 0x0962, 0x0117, 0xfdf3, 0x0a41, 0x014f, 0xfdf3, 
+	0x0971, 0x014f, 0xfdf3, 0x0a32, 0x0178, 0xfdf3, 0x099a, 0x0178, 0xfdf3, 0x0a09, 0x0187, 0xfdf3, 0x09d2, 0x0002, 0xfee9, 0xfdf3, 
+	0x09d1, 0x0070, 0x0000, 0x0001, 0x0000, 0x0024, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 
+	0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0021, 0xfe79, 
+	0xfdf3, 0x09d2, 0xfe88, 0xfdf3, 0x099a, 0xfe88, 0xfdf3, 0x0a09, 0xfeb1, 0xfdf3, 0x0971, 0xfeb1, 0xfdf3, 0x0a32, 0xfee9, 0xfdf3, 
+	0x0962, 0xfee9, 0xfdf3, 0x0a41, 0xff20, 0xfdf3, 0x0971, 0xff20, 0xfdf3, 0x0a32, 0xff49, 0xfdf3, 0x099a, 0xff49, 0xfdf3, 0x0a09, 
+	0xff58, 0xfdf3, 0x09d2, 0x0002, 0x0000, 0xfdf3, 0x08e3, 0x00c5, 0x0000, 0x0001, 0x0000, 0x0030, 0x0010, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 
+	0x001e, 0x001b, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x002d, 0xff45, 0xfdf3, 0x0904, 
+	0xff53, 0xfdf3, 0x08bd, 0xff53, 0xfdf3, 0x0942, 0xff7c, 0xfdf3, 0x087e, 0xff7c, 0xfdf3, 0x096d, 0xffb9, 0xfdf3, 0x0853, 0xffb9, 
+	0xfdf3, 0x0980, 0x0000, 0xfdf3, 0x0842, 0x0000, 0xfdf3, 0x0985, 0x0047, 0xfdf3, 0x0853, 0x0047, 0xfdf3, 0x0980, 0x0084, 0xfdf3, 
+	0x087e, 0x0084, 0xfdf3, 0x096c, 0x00ad, 0xfdf3, 0x08bc, 0x00ad, 0xfdf3, 0x0941, 0x00bb, 0xfdf3, 0x0903, 0x0002, 0x0000, 0xfe11, 
+	0x08f2, 0x03de, 0x0000, 0x0001, 0x0000, 0x0036, 0x0010, 0x0000, 0x0003, 0x0000, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000c, 
+	0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x0021, 0x0024, 0x0024, 0x0027, 0x0027, 
+	0x002a, 0x002a, 0x002d, 0x002d, 0x0030, 0x0030, 0x0033, 0xfc29, 0xfe11, 0x088f, 0xfc29, 0xfe11, 0x0951, 0xfc99, 0xfe11, 0x071e, 
+	0xfd8d, 0xfe11, 0x05f4, 0xfee2, 0xfe11, 0x053e, 0x0000, 0xfe11, 0x0518, 0x011e, 0xfe11, 0x053e, 0x0273, 0xfe11, 0x05f4, 0x0367, 
+	0xfe11, 0x071e, 0x03d7, 0xfe11, 0x088f, 0x03d7, 0xfe11, 0x0951, 0xfc6f, 0xfe11, 0x0a6a, 0xfd45, 0xfe11, 0x0bab, 0xfe86, 0xfe11, 
+	0x0c81, 0x0000, 0xfe11, 0x0ccd, 0x017a, 0xfe11, 0x0c81, 0x02bb, 0xfe11, 0x0bab, 0x0391, 0xfe11, 0x0a6a, 0x0002, 0x02a5, 0xfdf3, 
+	0x091a, 0x012b, 0x0000, 0x0001, 0x0000, 0x0012, 0x0005, 0x0000, 0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x000c, 0x0009, 0x000f, 
+	0x000c, 0x0236, 0xfdf3, 0x0a30, 0x02a6, 0xfdf3, 0x0a16, 0x0304, 0xfdf3, 0x09b2, 0x0314, 0xfdf3, 0x091c, 0x02e0, 0xfdf3, 0x088c, 
+	0x0251, 0xfdf3, 0x0805, 0x0002, 0xfd5b, 0xfdf3, 0x091a, 0x012b, 0x0000, 0x0001, 0x0000, 0x0012, 0x0005, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0xfcec, 0xfdf3, 0x091c, 0xfcfc, 0xfdf3, 0x09b2, 0xfd20, 0xfdf3, 0x088c, 
+	0xfd5a, 0xfdf3, 0x0a16, 0xfdaf, 0xfdf3, 0x0805, 0xfdca, 0xfdf3, 0x0a30, 0x0003, 0x0335, 0xfe06, 0x09c2, 0x00e8, 0x0000, 0x0001, 
+	0x0000, 0x0018, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0x000f, 
+	0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0264, 0xfdfc, 0x09b3, 0x02c0, 0xfe16, 0x09ec, 0x030c, 0xfe18, 0x0922, 0x02b1, 0xfdfb, 
+	0x0909, 0x038e, 0xfe17, 0x0944, 0x0341, 0xfe15, 0x0a38, 0x0407, 0xfdf3, 0x0960, 0x03ba, 0xfdf4, 0x0a7c, 0x0003, 0xfccb, 0xfe06, 
+	0x09c2, 0x00e8, 0x0000, 0x0001, 0x0000, 0x0018, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0009, 0x0006, 0x000c, 
+	0x0009, 0x000c, 0x000f, 0x000f, 0x000c, 0x0012, 0x000f, 0x0012, 0x0015, 0xfbf9, 0xfdf3, 0x0960, 0xfc46, 0xfdf4, 0x0a7c, 0xfcbf, 
+	0xfe15, 0x0a38, 0xfc72, 0xfe17, 0x0944, 0xfd40, 0xfe16, 0x09ec, 0xfcf4, 0xfe18, 0x0922, 0xfd9c, 0xfdfc, 0x09b3, 0xfd4f, 0xfdfb, 
+	0x0909, 0x0002, 0x0001, 0xfdf3, 0x0bc8, 0x014f, 0x0000, 0x0001, 0x0000, 0x0024, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0006, 
+	0x0009, 0x0009, 0x000c, 0x000f, 0x000c, 0x000f, 0x0012, 0x0015, 0x0012, 0x0015, 0x0018, 0x0018, 0x001b, 0x001b, 0x001e, 0x0021, 
+	0x001e, 0xfeb3, 0xfdf3, 0x0be1, 0xfedc, 0xfdf3, 0x0b76, 0xff36, 0xfdf3, 0x0c08, 0xff4f, 0xfdf3, 0x0b99, 0xffc6, 0xfdf3, 0x0baa, 
+	0xffbd, 0xfdf3, 0x0c1c, 0x0045, 0xfdf3, 0x0c1c, 0x003d, 0xfdf3, 0x0baa, 0x00b4, 0xfdf3, 0x0b98, 0x00cd, 0xfdf3, 0x0c07, 0x0150, 
+	0xfdf3, 0x0bdf, 0x0126, 0xfdf3, 0x0b75, 0x0002, 0x015a, 0xfdf3, 0x06f8, 0x010b, 0x0000, 0x0001, 0x0000, 0x0018, 0x0007, 0x0000, 
+	0x0003, 0x0003, 0x0006, 0x0006, 0x0009, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0012, 0x005e, 0xfdf3, 0x06c3, 
+	0x00c5, 0xfdf3, 0x0672, 0x0168, 0xfdf3, 0x0647, 0x0202, 0xfdf3, 0x065a, 0x0256, 0xfdf3, 0x069d, 0x0252, 0xfdf3, 0x0708, 0x021c, 
+	0xfdf3, 0x076c, 0x01d9, 0xfdf3, 0x07aa, 0x0002, 0xfea6, 0xfdf3, 0x06f8, 0x010b, 0x0000, 0x0001, 0x0000, 0x0018, 0x0007, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 0x000c, 0x0006, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0xfdaa, 0xfdf3, 0x069d, 
+	0xfdae, 0xfdf3, 0x0708, 0xfdfe, 0xfdf3, 0x065a, 0xfde4, 0xfdf3, 0x076c, 0xfe27, 0xfdf3, 0x07aa, 0xfe98, 0xfdf3, 0x0647, 0xff3b, 
+	0xfdf3, 0x0672, 0xffa2, 0xfdf3, 0x06c3, 0x0003, 0xf8ce, 0x004c, 0xffd6, 0x0003, 0x0000, 0x0002, 0x0000, 0x0018, 0x000c, 0x0000, 
+	0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0000, 0x000c, 0x000f, 0x0000, 0x000f, 0x0003, 0x0003, 0x000f, 
+	0x0012, 0x0003, 0x0012, 0x0006, 0x0009, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0006, 0x0012, 0x0015, 0x000c, 0x0015, 0x000f, 
+	0x000f, 0x0015, 0x0012, 0xf8cd, 0x0049, 0xffd4, 0xf8cd, 0x0049, 0xffd8, 0xf8cd, 0x004f, 0xffd8, 0xf8cd, 0x004f, 0xffd4, 0xf8ce, 
+	0x0049, 0xffd4, 0xf8ce, 0x0049, 0xffd8, 0xf8ce, 0x004f, 0xffd8, 0xf8ce, 0x004f, 0xffd4, 0x0258, 0x000c, 0x0004, 0x0000, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0000, 0x0006, 0x0009, 0x0003, 0x0009, 0x0006, 0xf8ce, 0x0049, 0xffd4, 0xf8ce, 0x0049, 0xffd8, 
+	0xf8ce, 0x004f, 0xffd8, 0xf8ce, 0x004f, 0xffd4, 0x0003, 0xfdc2, 0xfe09, 0x047f, 0x0121, 0x0000, 0x0001, 0x0000, 0x0024, 0x000a, 
+	0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0009, 0x0009, 0x000c, 0x000f, 0x000c, 0x0012, 0x000f, 0x000f, 
+	0x0012, 0x0015, 0x0012, 0x0018, 0x0015, 0x0015, 0x0018, 0x001b, 0x0018, 0x001e, 0x001b, 0x001b, 0x001e, 0x0021, 0xfcac, 0xfdf3, 
+	0x04cd, 0xfd66, 0xfdf3, 0x04cd, 0xfcac, 0xfe1f, 0x04cd, 0xfd66, 0xfe1f, 0x04cd, 0xfdb2, 0xfdf3, 0x049f, 0xfdb2, 0xfe1f, 0x049f, 
+	0xfe21, 0xfdf3, 0x046b, 0xfe21, 0xfe1f, 0x046b, 0xfe95, 0xfdf3, 0x0441, 0xfe95, 0xfe1f, 0x0441, 0xfed7, 0xfdf3, 0x0431, 0xfed7, 
+	0xfe1f, 0x0431, 0x0003, 0x023e, 0xfe09, 0x047f, 0x0121, 0x0000, 0x0001, 0x0000, 0x0024, 0x000a, 0x0000, 0x0003, 0x0006, 0x0000, 
+	0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0x000f, 0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 
+	0x0012, 0x0015, 0x001b, 0x0018, 0x001b, 0x001e, 0x0018, 0x001b, 0x0021, 0x001e, 0x0129, 0xfdf3, 0x0431, 0x016b, 0xfdf3, 0x0441, 
+	0x016b, 0xfe1f, 0x0441, 0x0129, 0xfe1f, 0x0431, 0x01df, 0xfe1f, 0x046b, 0x01df, 0xfdf3, 0x046b, 0x024e, 0xfe1f, 0x049f, 0x024e, 
+	0xfdf3, 0x049f, 0x029a, 0xfe1f, 0x04cd, 0x029a, 0xfdf3, 0x04cd, 0x0354, 0xfe1f, 0x04cd, 0x0354, 0xfdf3, 0x04cd, 0x0003, 0x04a5, 
+	0xfe08, 0x0b91, 0x0141, 0x0000, 0x0001, 0x0000, 0x002a, 0x000c, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 
+	0x000c, 0x0003, 0x000f, 0x0006, 0x000c, 0x0009, 0x0012, 0x000c, 0x0012, 0x0015, 0x0015, 0x0012, 0x0018, 0x0015, 0x0018, 0x001b, 
+	0x001b, 0x0018, 0x001e, 0x0018, 0x0021, 0x001e, 0x001e, 0x0021, 0x0024, 0x001e, 0x0024, 0x0027, 0x03a6, 0xfdf2, 0x0c37, 0x03a6, 
+	0xfdf2, 0x0c54, 0x03a6, 0xfe1e, 0x0c37, 0x03c8, 0xfe1e, 0x0c0b, 0x03c8, 0xfdf2, 0x0c0b, 0x03a6, 0xfe1e, 0x0c54, 0x0411, 0xfe1e, 
+	0x0ba8, 0x0411, 0xfdf2, 0x0ba8, 0x0450, 0xfe1e, 0x0b3f, 0x0450, 0xfdf2, 0x0b3f, 0x0485, 0xfdf3, 0x0acf, 0x0485, 0xfe1e, 0x0acf, 
+	0x05a5, 0xfe1e, 0x0acf, 0x05a5, 0xfdf3, 0x0acf, 0x0003, 0xfb5b, 0xfe08, 0x0b91, 0x0141, 0x0000, 0x0001, 0x0000, 0x002a, 0x000c, 
+	0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000f, 0x000c, 0x0012, 0x000c, 
+	0x0015, 0x0012, 0x0012, 0x0015, 0x0018, 0x0015, 0x001b, 0x0018, 0x0018, 0x001b, 0x001e, 0x001b, 0x0021, 0x001e, 0x001e, 0x0021, 
+	0x0024, 0x0024, 0x0021, 0x0027, 0xfa5b, 0xfdf3, 0x0acf, 0xfa5b, 0xfe1e, 0x0acf, 0xfb7b, 0xfdf3, 0x0acf, 0xfb7b, 0xfe1e, 0x0acf, 
+	0xfbb0, 0xfe1e, 0x0b3f, 0xfbb0, 0xfdf2, 0x0b3f, 0xfbef, 0xfdf2, 0x0ba8, 0xfbef, 0xfe1e, 0x0ba8, 0xfc38, 0xfdf2, 0x0c0b, 0xfc38, 
+	0xfe1e, 0x0c0b, 0xfc5a, 0xfdf2, 0x0c37, 0xfc5a, 0xfe1e, 0x0c37, 0xfc5a, 0xfdf2, 0x0c54, 0xfc5a, 0xfe1e, 0x0c54, 0x0003, 0x0000, 
+	0x021e, 0x092b, 0x019d, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfedc, 0x021e, 
+	0x0806, 0xfedc, 0x021e, 0x0a50, 0x0124, 0x021e, 0x0806, 0x0124, 0x021e, 0x0a50, 0x0003, 0x0000, 0x034a, 0x092a, 0x00dd, 0x0000, 
+	0x0001, 0x0000, 0x0018, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0000, 0x000c, 0x0009, 0x0003, 0x000f, 0x0006, 
+	0x0006, 0x000f, 0x0012, 0x000c, 0x0012, 0x0009, 0x0006, 0x0012, 0x0015, 0x000c, 0x0015, 0x0012, 0xffda, 0x0270, 0x0927, 0xffda, 
+	0x0424, 0x0927, 0xfffd, 0x0270, 0x0904, 0x0003, 0x0424, 0x0951, 0x0003, 0x0270, 0x0951, 0xfffd, 0x0424, 0x0904, 0x0026, 0x0424, 
+	0x092e, 0x0026, 0x0270, 0x092e, 0x0002, 0x0000, 0x024c, 0x092b, 0x0080, 0x0000, 0x0001, 0x0000, 0x0036, 0x0012, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x0012, 0x0015, 0x0012, 0x0018, 0x0015, 0x001b, 
+	0x0018, 0x001e, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0027, 0x002d, 0x002a, 0x0030, 0x002d, 0x0033, 
+	0x0030, 0x0033, 0xff8a, 0x0237, 0x092b, 0xffbc, 0x0237, 0x08c0, 0xffbc, 0x0237, 0x0996, 0x0044, 0x0237, 0x08c0, 0x0044, 0x0237, 
+	0x0996, 0x0076, 0x0237, 0x092b, 0xffa8, 0x024b, 0x092b, 0xffcd, 0x024b, 0x08db, 0xffcd, 0x024b, 0x097a, 0x0033, 0x024b, 0x08db, 
+	0x0033, 0x024b, 0x097a, 0x0058, 0x024b, 0x092b, 0xffc4, 0x0261, 0x092b, 0xffde, 0x0261, 0x08f5, 0xffde, 0x0261, 0x0961, 0x0022, 
+	0x0261, 0x08f5, 0x0022, 0x0261, 0x0961, 0x003c, 0x0261, 0x092b, 0x0002, 0x0096, 0x023a, 0x09cf, 0x0034, 0x0000, 0x0001, 0x0000, 
+	0x0012, 0x0006, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x0063, 0x023a, 
+	0x09cf, 0x0081, 0x023a, 0x09a2, 0x0081, 0x023a, 0x09fc, 0x00ac, 0x023a, 0x09a2, 0x00ac, 0x023a, 0x09fc, 0x00ca, 0x023a, 0x09cf, 
+	0x0003, 0xfa2c, 0x020c, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 
+	0xf93c, 0x020c, 0x087b, 0xf93c, 0x020c, 0x09da, 0xfb1c, 0x020c, 0x087b, 0xfb1c, 0x020c, 0x09da, 0x0003, 0xfc0c, 0x020c, 0x092a, 
+	0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfb1c, 0x020c, 0x087b, 0xfb1c, 
+	0x020c, 0x09da, 0xfcfc, 0x020c, 0x087b, 0xfcfc, 0x020c, 0x09da, 0x0003, 0xfdec, 0x020c, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 
+	0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfcfc, 0x020c, 0x087b, 0xfcfc, 0x020c, 0x09da, 0xfedc, 0x020c, 
+	0x087b, 0xfedc, 0x020c, 0x09da, 0x0003, 0x0214, 0x020c, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 
+	0x0006, 0x0000, 0x0006, 0x0009, 0x0124, 0x020c, 0x087b, 0x0124, 0x020c, 0x09da, 0x0304, 0x020c, 0x09da, 0x0304, 0x020c, 0x087b, 
+	0x0003, 0x03f4, 0x020c, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 
+	0x0304, 0x020c, 0x087b, 0x0304, 0x020c, 0x09da, 0x04e4, 0x020c, 0x09da, 0x04e4, 0x020c, 0x087b, 0x0003, 0x05d4, 0x020c, 0x092a, 
+	0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x04e4, 0x020c, 0x087b, 0x04e4, 
+	0x020c, 0x09da, 0x06c4, 0x020c, 0x09da, 0x06c4, 0x020c, 0x087b, 0x0002, 0x02ad, 0xfe03, 0x0c89, 0x0056, 0x0000, 0x0001, 0x0000, 
+	0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x026d, 0xfe03, 0x0c50, 0x0292, 0xfe03, 0x0c38, 
+	0x02c9, 0xfe03, 0x0cdb, 0x02ed, 0xfe03, 0x0cc3, 0x0002, 0x0289, 0xfe13, 0x0ca1, 0x0056, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0249, 0xfe13, 0x0c68, 0x026d, 0xfe13, 0x0c50, 0x02a4, 0xfe13, 
+	0x0cf3, 0x02c9, 0xfe13, 0x0cdb, 0x0002, 0xfd77, 0xfe13, 0x0ca1, 0x0056, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0xfd37, 0xfe13, 0x0cdb, 0xfd5c, 0xfe13, 0x0cf3, 0xfd93, 0xfe13, 0x0c50, 0xfdb7, 
+	0xfe13, 0x0c68, 0x0002, 0xfd53, 0xfe03, 0x0c89, 0x0056, 0x0000, 0x0001, 0x0000, 0x000c, 0x0004, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0x0009, 0xfd13, 0xfe03, 0x0cc3, 0xfd37, 0xfe03, 0x0cdb, 0xfd6e, 0xfe03, 0x0c38, 0xfd93, 0xfe03, 0x0c50, 
+	0x0003, 0xfb35, 0xffe1, 0xfd17, 0x00b7, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 
+	0xfab9, 0x0000, 0xfc93, 0xfad3, 0xffc2, 0xfd9a, 0xfb9a, 0x0000, 0xfc93, 0xfbb0, 0xffc2, 0xfd6e, 0x0003, 0xfb62, 0xffa3, 0xfe03, 
+	0x00b4, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfad3, 0xffc2, 0xfd9a, 0xfb20, 
+	0xff83, 0xfe98, 0xfbb0, 0xffc2, 0xfd6e, 0xfbf0, 0xff83, 0xfe42, 0x0003, 0xfbbc, 0xff64, 0xfee2, 0x00af, 0x0000, 0x0001, 0x0000, 
+	0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfb20, 0xff83, 0xfe98, 0xfb9c, 0xff44, 0xff82, 0xfbf0, 0xff83, 
+	0xfe42, 0xfc58, 0xff44, 0xff05, 0x0003, 0xfc40, 0xff1f, 0xffaa, 0x00ac, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 
+	0x0006, 0x0003, 0x0009, 0x0006, 0xfb9c, 0xff44, 0xff82, 0xfc45, 0xfef9, 0x004e, 0xfc58, 0xff44, 0xff05, 0xfce4, 0xfef9, 0xffaf, 
+	0x0003, 0x03c0, 0xff1f, 0xffaa, 0x00ac, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 
+	0x031c, 0xfef9, 0xffaf, 0x03bb, 0xfef9, 0x004e, 0x03a8, 0xff44, 0xff05, 0x0464, 0xff44, 0xff82, 0x0003, 0x0444, 0xff64, 0xfee2, 
+	0x00af, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x03a8, 0xff44, 0xff05, 0x0464, 
+	0xff44, 0xff82, 0x0410, 0xff83, 0xfe42, 0x04e0, 0xff83, 0xfe98, 0x0003, 0x049e, 0xffa3, 0xfe03, 0x00b4, 0x0000, 0x0001, 0x0000, 
+	0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0410, 0xff83, 0xfe42, 0x04e0, 0xff83, 0xfe98, 0x0450, 0xffc2, 
+	0xfd6e, 0x052d, 0xffc2, 0xfd9a, 0x0003, 0x04cb, 0xffe1, 0xfd17, 0x00b7, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 
+	0x0006, 0x0006, 0x0003, 0x0009, 0x0450, 0xffc2, 0xfd6e, 0x052d, 0xffc2, 0xfd9a, 0x0466, 0x0000, 0xfc93, 0x0547, 0x0000, 0xfc93, 
+	0x0003, 0xfb92, 0xffa1, 0xfe9b, 0x0216, 0x0000, 0x0001, 0x0000, 0x001e, 0x0008, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0x000f, 0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 0x0015, 
+	0x001b, 0x0018, 0xfabe, 0x0009, 0xfcc7, 0xfad3, 0xffd7, 0xfd9a, 0xfad3, 0x0002, 0xfd9a, 0xfabe, 0x0035, 0xfcc7, 0xfb20, 0xffc4, 
+	0xfe98, 0xfb20, 0xff98, 0xfe98, 0xfb9c, 0xff85, 0xff82, 0xfb9c, 0xff59, 0xff82, 0xfc66, 0xff39, 0x006f, 0xfc66, 0xff0d, 0x006f, 
+	0x0003, 0x046e, 0xffa1, 0xfe9b, 0x0216, 0x0000, 0x0001, 0x0000, 0x001e, 0x0008, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 
+	0x0003, 0x000c, 0x0009, 0x0003, 0x000f, 0x000c, 0x000f, 0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 0x0012, 0x0012, 
+	0x0018, 0x001b, 0x039a, 0xff0d, 0x006f, 0x0464, 0xff59, 0xff82, 0x039a, 0xff39, 0x006f, 0x0464, 0xff85, 0xff82, 0x04e0, 0xffc4, 
+	0xfe98, 0x04e0, 0xff98, 0xfe98, 0x052d, 0x0002, 0xfd9a, 0x052d, 0xffd7, 0xfd9a, 0x0542, 0x0009, 0xfcc7, 0x0542, 0x0035, 0xfcc7, 
+	0x0003, 0xfc48, 0xfe76, 0x03a0, 0x0132, 0x0000, 0x0001, 0x0000, 0x0012, 0x0004, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x0003, 0x000c, 0x0003, 0x000f, 0xfbe4, 0xfdf2, 0x04a2, 0xfcaa, 0xfef9, 0x02c1, 0xfbe4, 0xfef9, 0x02c1, 0xfcab, 
+	0xfdf2, 0x04a2, 0xfbe4, 0xfef9, 0x029e, 0xfcaa, 0xfef9, 0x029e, 0x0003, 0x03b8, 0xfe76, 0x03a0, 0x0132, 0x0000, 0x0001, 0x0000, 
+	0x0012, 0x0004, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x000f, 0x0006, 0x000c, 0x0355, 0xfdf2, 
+	0x04a2, 0x041c, 0xfdf2, 0x04a2, 0x0356, 0xfef9, 0x02c1, 0x041c, 0xfef9, 0x02c1, 0x041c, 0xfef9, 0x029e, 0x0356, 0xfef9, 0x029e, 
+	0x0002, 0xfc47, 0xfe8b, 0x03b4, 0x014c, 0x0000, 0x0002, 0x0000, 0x013e, 0x00c9, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x000c, 0x000c, 0x0006, 0x0003, 0x000f, 0x0009, 0x000f, 0x000c, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0006, 0x0018, 
+	0x0018, 0x0012, 0x0006, 0x001b, 0x0009, 0x001b, 0x0015, 0x001b, 0x0018, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x0012, 0x0024, 
+	0x001e, 0x0024, 0x0012, 0x0027, 0x0015, 0x0027, 0x0021, 0x0027, 0x002a, 0x001e, 0x002a, 0x002d, 0x002d, 0x0024, 0x002a, 0x0030, 
+	0x002a, 0x0033, 0x001e, 0x0036, 0x0021, 0x0036, 0x0033, 0x0036, 0x002d, 0x0039, 0x0030, 0x0039, 0x002d, 0x003c, 0x0033, 0x003c, 
+	0x003f, 0x0030, 0x0042, 0x003f, 0x0045, 0x0042, 0x0048, 0x0045, 0x004b, 0x0048, 0x004b, 0x004e, 0x004e, 0x0045, 0x004b, 0x0051, 
+	0x0048, 0x0054, 0x0051, 0x0054, 0x0057, 0x004e, 0x0057, 0x0045, 0x0057, 0x005a, 0x0057, 0x005d, 0x004e, 0x0060, 0x0051, 0x0060, 
+	0x005d, 0x0060, 0x0042, 0x005a, 0x0042, 0x0063, 0x005a, 0x0066, 0x005a, 0x0069, 0x005d, 0x0069, 0x0063, 0x0069, 0x003f, 0x0066, 
+	0x003f, 0x006c, 0x0063, 0x006c, 0x0066, 0x0039, 0x0066, 0x006f, 0x0069, 0x006f, 0x006c, 0x006f, 0x0039, 0x0072, 0x006f, 0x0072, 
+	0x003c, 0x0072, 0x003c, 0x0075, 0x0024, 0x0075, 0x0027, 0x0075, 0x0036, 0x0075, 0x0078, 0x0072, 0x0030, 0x0078, 0x0033, 0x0078, 
+	0x006c, 0x0078, 0x0045, 0x007b, 0x0054, 0x007b, 0x005d, 0x007b, 0x0060, 0x007b, 0x007b, 0x0063, 0x007e, 0x0081, 0x007e, 0x0084, 
+	0x007e, 0x0087, 0x0081, 0x008a, 0x0084, 0x008a, 0x0081, 0x008d, 0x0087, 0x008d, 0x0090, 0x0084, 0x0090, 0x0093, 0x0090, 0x0096, 
+	0x0090, 0x0099, 0x0084, 0x009c, 0x0093, 0x009c, 0x008a, 0x009f, 0x009c, 0x009f, 0x008a, 0x00a2, 0x008d, 0x00a2, 0x0093, 0x00a5, 
+	0x0096, 0x00a5, 0x0093, 0x00a8, 0x0099, 0x00a8, 0x009c, 0x00ab, 0x00a8, 0x00ab, 0x009f, 0x00ae, 0x00a2, 0x00ae, 0x00ab, 0x00ae, 
+	0x00b1, 0x00a5, 0x00b4, 0x00b1, 0x00b7, 0x00b4, 0x00ba, 0x00b7, 0x00ba, 0x00bd, 0x00bd, 0x00b4, 0x00ba, 0x00c0, 0x00b7, 0x00c3, 
+	0x00c0, 0x00c3, 0x00bd, 0x00c6, 0x00c6, 0x00b1, 0x00bd, 0x00c9, 0x00c0, 0x00c9, 0x00b4, 0x0096, 0x0096, 0x00cc, 0x00c6, 0x00cf, 
+	0x00c9, 0x00cf, 0x0099, 0x00cc, 0x0099, 0x00d2, 0x0084, 0x00d2, 0x0087, 0x00d2, 0x00d2, 0x00a2, 0x00d2, 0x00ab, 0x00d5, 0x00cc, 
+	0x00b4, 0x00d5, 0x00c3, 0x00d5, 0x00c9, 0x00d5, 0x00d5, 0x00d8, 0x00b1, 0x00d8, 0x00cc, 0x00db, 0x00d8, 0x00db, 0x00a5, 0x00db, 
+	0x00a8, 0x00db, 0x00cf, 0x00d8, 0x00de, 0x00e1, 0x00de, 0x00e4, 0x00de, 0x00e7, 0x00e1, 0x00ea, 0x00e4, 0x00ea, 0x00e1, 0x00ed, 
+	0x00e7, 0x00ed, 0x00f0, 0x00e4, 0x00f0, 0x00f3, 0x00f0, 0x00f6, 0x00f0, 0x00f9, 0x00e4, 0x00fc, 0x00f3, 0x00fc, 0x00ea, 0x00ff, 
+	0x00fc, 0x00ff, 0x00ea, 0x0102, 0x00ed, 0x0102, 0x00f3, 0x0105, 0x00f6, 0x0105, 0x00f3, 0x0108, 0x00f9, 0x0108, 0x00fc, 0x010b, 
+	0x0108, 0x010b, 0x00ff, 0x010e, 0x0102, 0x010e, 0x010b, 0x010e, 0x0111, 0x0105, 0x0114, 0x0111, 0x0117, 0x0114, 0x011a, 0x0117, 
+	0x011a, 0x011d, 0x011d, 0x0114, 0x011a, 0x0120, 0x0117, 0x0123, 0x0120, 0x0123, 0x011d, 0x0126, 0x0126, 0x0111, 0x011d, 0x0129, 
+	0x0120, 0x0129, 0x0114, 0x00f6, 0x00f6, 0x012c, 0x0126, 0x012f, 0x0129, 0x012f, 0x00f9, 0x012c, 0x00f9, 0x0132, 0x00e4, 0x0132, 
+	0x00e7, 0x0132, 0x0132, 0x0102, 0x0132, 0x010b, 0x0135, 0x012c, 0x0114, 0x0135, 0x0123, 0x0135, 0x0129, 0x0135, 0x0135, 0x0138, 
+	0x0111, 0x0138, 0x012c, 0x013b, 0x0138, 0x013b, 0x0105, 0x013b, 0x0108, 0x013b, 0x012f, 0x0138, 0xfbe7, 0xfdf1, 0x04bf, 0xfbe7, 
+	0xfdf1, 0x04c4, 0xfbe7, 0xfe04, 0x04c7, 0xfbec, 0xfdf1, 0x04bf, 0xfbe7, 0xfe02, 0x04cb, 0xfbec, 0xfdf1, 0x04c4, 0xfbe7, 0xfe12, 
+	0x04c9, 0xfbec, 0xfe02, 0x04cb, 0xfbe7, 0xfe11, 0x04c5, 0xfbec, 0xfe04, 0x04c7, 0xfbe7, 0xfe16, 0x04be, 0xfbec, 0xfe11, 0x04c5, 
+	0xfbe7, 0xfe1b, 0x04c0, 0xfbec, 0xfe12, 0x04c9, 0xfbe7, 0xfe16, 0x04a5, 0xfbe7, 0xfe1b, 0x04a5, 0xfbe7, 0xff1f, 0x02bd, 0xfbec, 
+	0xfe16, 0x04a5, 0xfbec, 0xfe16, 0x04be, 0xfbe7, 0xff24, 0x02bd, 0xfbec, 0xfe1b, 0x04a5, 0xfbe7, 0xff1c, 0x02a4, 0xfbe7, 0xff16, 
+	0x02a2, 0xfbe7, 0xff0c, 0x02a2, 0xfbe7, 0xfef8, 0x02ad, 0xfbe7, 0xfef8, 0x02a8, 0xfbe7, 0xff0b, 0x029e, 0xfbec, 0xfef8, 0x02a8, 
+	0xfbec, 0xfef8, 0x02ad, 0xfbe7, 0xff09, 0x029e, 0xfbe7, 0xff19, 0x029e, 0xfbec, 0xff09, 0x029e, 0xfbec, 0xff0b, 0x029e, 0xfbec, 
+	0xff16, 0x02a2, 0xfbe7, 0xff20, 0x02a2, 0xfbec, 0xff19, 0x029e, 0xfbec, 0xff1c, 0x02a4, 0xfbec, 0xff20, 0x02a2, 0xfbec, 0xff24, 
+	0x02bd, 0xfbec, 0xfe1b, 0x04c0, 0xfbec, 0xff1f, 0x02bd, 0xfbec, 0xff0c, 0x02a2, 0xfc35, 0xfdf2, 0x04c7, 0xfc35, 0xfdf2, 0x04cb, 
+	0xfc35, 0xfe16, 0x04c7, 0xfc39, 0xfdf2, 0x04c7, 0xfc35, 0xfe16, 0x04cb, 0xfc39, 0xfdf2, 0x04cb, 0xfc35, 0xfe16, 0x04a2, 0xfc35, 
+	0xfe1b, 0x04a2, 0xfc35, 0xff1f, 0x02c1, 0xfc39, 0xfe16, 0x04a2, 0xfc35, 0xfe1b, 0x04c7, 0xfc35, 0xfe1b, 0x04cb, 0xfc39, 0xfe16, 
+	0x04cb, 0xfc35, 0xff24, 0x02c1, 0xfc39, 0xfe1b, 0x04a2, 0xfc39, 0xfe1b, 0x04c7, 0xfc39, 0xfe1b, 0x04cb, 0xfc35, 0xff22, 0x02a2, 
+	0xfc35, 0xff1e, 0x02a2, 0xfc35, 0xfef8, 0x02a2, 0xfc35, 0xfef8, 0x029e, 0xfc35, 0xff1e, 0x029e, 0xfc39, 0xfef8, 0x029e, 0xfc39, 
+	0xfef8, 0x02a2, 0xfc35, 0xff22, 0x029e, 0xfc39, 0xff1e, 0x029e, 0xfc39, 0xff1f, 0x02c1, 0xfc39, 0xff22, 0x029e, 0xfc39, 0xfe16, 
+	0x04c7, 0xfc39, 0xff1e, 0x02a2, 0xfc39, 0xff22, 0x02a2, 0xfc39, 0xff24, 0x02c1, 0xfca3, 0xfdf2, 0x04c7, 0xfca3, 0xfdf2, 0x04cb, 
+	0xfca3, 0xfe16, 0x04c7, 0xfca7, 0xfdf2, 0x04c7, 0xfca3, 0xfe16, 0x04cb, 0xfca7, 0xfdf2, 0x04cb, 0xfca3, 0xfe16, 0x04a2, 0xfca3, 
+	0xfe1b, 0x04a2, 0xfca3, 0xff1f, 0x02c1, 0xfca7, 0xfe16, 0x04a2, 0xfca3, 0xfe1b, 0x04c7, 0xfca3, 0xfe1b, 0x04cb, 0xfca7, 0xfe16, 
+	0x04cb, 0xfca3, 0xff24, 0x02c1, 0xfca7, 0xfe1b, 0x04a2, 0xfca7, 0xfe1b, 0x04c7, 0xfca7, 0xfe1b, 0x04cb, 0xfca3, 0xff22, 0x02a2, 
+	0xfca3, 0xff1e, 0x02a2, 0xfca3, 0xfef8, 0x02a2, 0xfca3, 0xfef8, 0x029e, 0xfca3, 0xff1e, 0x029e, 0xfca7, 0xfef8, 0x029e, 0xfca7, 
+	0xfef8, 0x02a2, 0xfca3, 0xff22, 0x029e, 0xfca7, 0xff1e, 0x029e, 0xfca7, 0xff1f, 0x02c1, 0xfca7, 0xff22, 0x029e, 0xfca7, 0xfe16, 
+	0x04c7, 0xfca7, 0xff1e, 0x02a2, 0xfca7, 0xff22, 0x02a2, 0xfca7, 0xff24, 0x02c1, 0x0960, 0x006c, 0x0030, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0006, 0x0006, 0x0009, 0x000c, 0x0009, 0x000c, 0x000f, 0x000f, 0x0009, 0x000c, 0x0012, 0x000c, 0x0015, 0x0012, 
+	0x0015, 0x0018, 0x0012, 0x001b, 0x0018, 0x001e, 0x001b, 0x001e, 0x0021, 0x0021, 0x001b, 0x0021, 0x0024, 0x0024, 0x0018, 0x0024, 
+	0x0027, 0x0018, 0x0027, 0x0027, 0x0015, 0x002a, 0x002d, 0x0030, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0036, 0x0039, 
+	0x0033, 0x003c, 0x0039, 0x003f, 0x003c, 0x003f, 0x0042, 0x0042, 0x0039, 0x0042, 0x0045, 0x0039, 0x0048, 0x0045, 0x0048, 0x0048, 
+	0x0036, 0x004b, 0x004e, 0x0051, 0x004e, 0x0051, 0x0054, 0x0051, 0x0057, 0x0054, 0x0057, 0x005a, 0x0054, 0x005d, 0x005a, 0x0060, 
+	0x005d, 0x0060, 0x0063, 0x0063, 0x005a, 0x0063, 0x0066, 0x005a, 0x0069, 0x0066, 0x0069, 0x0069, 0x0057, 0xfbe9, 0xfdf1, 0x04bf, 
+	0xfbe9, 0xfdf1, 0x04c4, 0xfbe9, 0xfe03, 0x04c9, 0xfbe9, 0xfe15, 0x04c5, 0xfbe9, 0xfe18, 0x04a5, 0xfbe9, 0xfe16, 0x04be, 0xfbe9, 
+	0xff1f, 0x02bd, 0xfbe9, 0xff24, 0x02bd, 0xfbe9, 0xff19, 0x02a3, 0xfbe9, 0xff0c, 0x02a2, 0xfbe9, 0xfef8, 0x02ab, 0xfbe9, 0xff0a, 
+	0x029e, 0xfbe9, 0xff19, 0x029e, 0xfbe9, 0xff20, 0x02a2, 0xfc37, 0xfdf2, 0x04c9, 0xfc37, 0xfe18, 0x04c9, 0xfc37, 0xfe18, 0x04a2, 
+	0xfc37, 0xff1f, 0x02c1, 0xfc37, 0xff24, 0x02c1, 0xfc37, 0xff1e, 0x02a2, 0xfc37, 0xfef8, 0x02a2, 0xfc37, 0xfef8, 0x029e, 0xfc37, 
+	0xff1e, 0x029e, 0xfc37, 0xff22, 0x029e, 0xfc37, 0xff22, 0x02a2, 0xfca5, 0xfdf2, 0x04c9, 0xfca5, 0xfe18, 0x04c9, 0xfca5, 0xfe18, 
+	0x04a2, 0xfca5, 0xff1f, 0x02c1, 0xfca5, 0xff24, 0x02c1, 0xfca5, 0xff1e, 0x02a2, 0xfca5, 0xfef8, 0x02a2, 0xfca5, 0xfef8, 0x029e, 
+	0xfca5, 0xff1e, 0x029e, 0xfca5, 0xff22, 0x029e, 0xfca5, 0xff22, 0x02a2, 0x0002, 0x032a, 0x00c9, 0xfde3, 0x00b4, 0x0000, 0x0001, 
+	0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 
+	0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 
+	0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 
+	0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 
+	0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 
+	0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x02a8, 0x00e7, 0xfde3, 0x02c1, 0x0144, 0xfd96, 0x02c1, 0x0144, 0xfe30, 
+	0x0302, 0x00e7, 0xfd66, 0x0302, 0x00e7, 0xfe5f, 0x032b, 0x00ae, 0xfde3, 0x032b, 0x017d, 0xfde3, 0x0353, 0x0144, 0xfd66, 0x0353, 
+	0x0144, 0xfe5f, 0x0394, 0x00e7, 0xfd96, 0x0394, 0x00e7, 0xfe30, 0x03ad, 0x0144, 0xfde3, 0x0325, 0x0016, 0xfddd, 0x0325, 0x0016, 
+	0xfde8, 0x0325, 0x00c8, 0xfddd, 0x0330, 0x0016, 0xfddd, 0x0325, 0x00c8, 0xfde8, 0x0330, 0x0016, 0xfde8, 0x0330, 0x00c8, 0xfddd, 
+	0x0330, 0x00c8, 0xfde8, 0x0002, 0x026c, 0x00c9, 0xff00, 0x00b4, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 
+	0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 
+	0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 
+	0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 
+	0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 
+	0x0039, 0x01e9, 0x00e7, 0xfeff, 0x0202, 0x0144, 0xfeb2, 0x0202, 0x0144, 0xff4c, 0x0244, 0x00e7, 0xfe83, 0x0244, 0x00e7, 0xff7c, 
+	0x026c, 0x00ae, 0xfeff, 0x026c, 0x017d, 0xfeff, 0x0295, 0x0144, 0xfe83, 0x0295, 0x0144, 0xff7c, 0x02d6, 0x00e7, 0xfeb2, 0x02d6, 
+	0x00e7, 0xff4c, 0x02ef, 0x0144, 0xfeff, 0x0267, 0x0016, 0xfefa, 0x0267, 0x0016, 0xff05, 0x0267, 0x00c8, 0xfefa, 0x0272, 0x0016, 
+	0xfefa, 0x0267, 0x00c8, 0xff05, 0x0272, 0x0016, 0xff05, 0x0272, 0x00c8, 0xfefa, 0x0272, 0x00c8, 0xff05, 0x0002, 0x014f, 0x00c9, 
+	0xffbd, 0x00b4, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 
+	0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 
+	0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 
+	0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 
+	0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x00cc, 0x00e7, 0xffbe, 0x00e5, 0x0144, 
+	0xff71, 0x00e5, 0x0144, 0x000a, 0x0127, 0x00e7, 0xff41, 0x0127, 0x00e7, 0x0039, 0x014f, 0x00ae, 0xffbe, 0x014f, 0x017d, 0xffbe, 
+	0x0178, 0x0144, 0xff41, 0x0178, 0x0144, 0x0039, 0x01b9, 0x00e7, 0xff71, 0x01b9, 0x00e7, 0x000a, 0x01d2, 0x0144, 0xffbe, 0x014a, 
+	0x0016, 0xffb8, 0x014a, 0x0016, 0xffc3, 0x014a, 0x00c8, 0xffb8, 0x0155, 0x0016, 0xffb8, 0x014a, 0x00c8, 0xffc3, 0x0155, 0x0016, 
+	0xffc3, 0x0155, 0x00c8, 0xffb8, 0x0155, 0x00c8, 0xffc3, 0x0002, 0xfeb1, 0x00c9, 0xffbd, 0x00b4, 0x0000, 0x0001, 0x0000, 0x003c, 
+	0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 
+	0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 
+	0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 
+	0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 
+	0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 
+	0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfe2e, 0x00e7, 0xffbe, 0xfe47, 0x0144, 0xff71, 0xfe47, 0x0144, 0x000a, 0xfe88, 0x00e7, 
+	0xff41, 0xfe88, 0x00e7, 0x0039, 0xfeb1, 0x00ae, 0xffbe, 0xfeb1, 0x017d, 0xffbe, 0xfed9, 0x0144, 0xff41, 0xfed9, 0x0144, 0x0039, 
+	0xff1b, 0x00e7, 0xff71, 0xff1b, 0x00e7, 0x000a, 0xff34, 0x0144, 0xffbe, 0xfeab, 0x0016, 0xffb8, 0xfeab, 0x0016, 0xffc3, 0xfeab, 
+	0x00c8, 0xffb8, 0xfeb6, 0x0016, 0xffb8, 0xfeab, 0x00c8, 0xffc3, 0xfeb6, 0x0016, 0xffc3, 0xfeb6, 0x00c8, 0xffb8, 0xfeb6, 0x00c8, 
+	0xffc3, 0x0002, 0xfd94, 0x00c9, 0xff00, 0x00b4, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 
+	0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 
+	0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 
+	0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 
+	0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfd11, 
+	0x00e7, 0xfeff, 0xfd2a, 0x0144, 0xfeb2, 0xfd2a, 0x0144, 0xff4c, 0xfd6b, 0x00e7, 0xfe83, 0xfd6b, 0x00e7, 0xff7c, 0xfd94, 0x00ae, 
+	0xfeff, 0xfd94, 0x017d, 0xfeff, 0xfdbc, 0x0144, 0xfe83, 0xfdbc, 0x0144, 0xff7c, 0xfdfe, 0x00e7, 0xfeb2, 0xfdfe, 0x00e7, 0xff4c, 
+	0xfe17, 0x0144, 0xfeff, 0xfd8e, 0x0016, 0xfefa, 0xfd8e, 0x0016, 0xff05, 0xfd8e, 0x00c8, 0xfefa, 0xfd99, 0x0016, 0xfefa, 0xfd8e, 
+	0x00c8, 0xff05, 0xfd99, 0x0016, 0xff05, 0xfd99, 0x00c8, 0xfefa, 0xfd99, 0x00c8, 0xff05, 0x0002, 0xfcd6, 0x00c9, 0xfde3, 0x00b4, 
+	0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 
+	0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 
+	0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 
+	0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 
+	0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 
+	0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfc53, 0x00e7, 0xfde3, 0xfc6c, 0x0144, 0xfd96, 0xfc6c, 
+	0x0144, 0xfe30, 0xfcad, 0x00e7, 0xfd66, 0xfcad, 0x00e7, 0xfe5f, 0xfcd5, 0x00ae, 0xfde3, 0xfcd5, 0x017d, 0xfde3, 0xfcfe, 0x0144, 
+	0xfd66, 0xfcfe, 0x0144, 0xfe5f, 0xfd3f, 0x00e7, 0xfd96, 0xfd3f, 0x00e7, 0xfe30, 0xfd58, 0x0144, 0xfde3, 0xfcd0, 0x0016, 0xfddd, 
+	0xfcd0, 0x0016, 0xfde8, 0xfcd0, 0x00c8, 0xfddd, 0xfcdb, 0x0016, 0xfddd, 0xfcd0, 0x00c8, 0xfde8, 0xfcdb, 0x0016, 0xfde8, 0xfcdb, 
+	0x00c8, 0xfddd, 0xfcdb, 0x00c8, 0xfde8, 0x0002, 0xfd26, 0xfeb4, 0x045b, 0x00b4, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 
+	0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 
+	0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 
+	0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 
+	0x0039, 0x0036, 0x0039, 0xfca3, 0xfed1, 0x045b, 0xfcbc, 0xff2e, 0x040e, 0xfcbc, 0xff2e, 0x04a8, 0xfcfd, 0xfed1, 0x03df, 0xfcfd, 
+	0xfed1, 0x04d8, 0xfd25, 0xfe98, 0x045b, 0xfd25, 0xff67, 0x045b, 0xfd4e, 0xff2e, 0x03df, 0xfd4e, 0xff2e, 0x04d8, 0xfd8f, 0xfed1, 
+	0x040e, 0xfd8f, 0xfed1, 0x04a8, 0xfda8, 0xff2e, 0x045b, 0xfd20, 0xfe00, 0x0456, 0xfd20, 0xfe00, 0x0461, 0xfd20, 0xfeb3, 0x0456, 
+	0xfd2b, 0xfe00, 0x0456, 0xfd20, 0xfeb3, 0x0461, 0xfd2b, 0xfe00, 0x0461, 0xfd2b, 0xfeb3, 0x0456, 0xfd2b, 0xfeb3, 0x0461, 0x0002, 
+	0xfb7c, 0xfe91, 0x03c8, 0x0087, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 
+	0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 
+	0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 
+	0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 
+	0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfb19, 0xfea7, 0x03c8, 
+	0xfb2c, 0xfeec, 0x038e, 0xfb2c, 0xfeec, 0x0402, 0xfb5d, 0xfea7, 0x036b, 0xfb5d, 0xfea7, 0x0426, 0xfb7b, 0xfe7c, 0x03c8, 0xfb7b, 
+	0xff17, 0x03c8, 0xfb9a, 0xfeec, 0x036b, 0xfb9a, 0xfeec, 0x0426, 0xfbcb, 0xfea7, 0x038e, 0xfbcb, 0xfea7, 0x0402, 0xfbde, 0xfeec, 
+	0x03c8, 0xfb77, 0xfe0a, 0x03c4, 0xfb77, 0xfe0a, 0x03cc, 0xfb77, 0xfe90, 0x03c4, 0xfb80, 0xfe0a, 0x03c4, 0xfb77, 0xfe90, 0x03cc, 
+	0xfb80, 0xfe0a, 0x03cc, 0xfb80, 0xfe90, 0x03c4, 0xfb80, 0xfe90, 0x03cc, 0x0002, 0x02df, 0xfeb8, 0x045b, 0x00b4, 0x0000, 0x0001, 
+	0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 
+	0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 
+	0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 
+	0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 
+	0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 
+	0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x025c, 0xfed5, 0x045b, 0x0275, 0xff31, 0x040e, 0x0275, 0xff31, 0x04a8, 
+	0x02b7, 0xfed5, 0x03df, 0x02b7, 0xfed5, 0x04d8, 0x02df, 0xfe9c, 0x045b, 0x02df, 0xff6b, 0x045b, 0x0308, 0xff31, 0x03df, 0x0308, 
+	0xff31, 0x04d8, 0x0349, 0xfed5, 0x040e, 0x0349, 0xfed5, 0x04a8, 0x0362, 0xff31, 0x045b, 0x02da, 0xfe04, 0x0456, 0x02da, 0xfe04, 
+	0x0461, 0x02da, 0xfeb6, 0x0456, 0x02e5, 0xfe04, 0x0456, 0x02da, 0xfeb6, 0x0461, 0x02e5, 0xfe04, 0x0461, 0x02e5, 0xfeb6, 0x0456, 
+	0x02e5, 0xfeb6, 0x0461, 0x0002, 0x0482, 0xfe91, 0x03c8, 0x0087, 0x0000, 0x0001, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 
+	0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 
+	0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 
+	0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 
+	0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 
+	0x0039, 0x0420, 0xfea7, 0x03c8, 0x0433, 0xfeec, 0x038e, 0x0433, 0xfeec, 0x0402, 0x0464, 0xfea7, 0x036b, 0x0464, 0xfea7, 0x0426, 
+	0x0482, 0xfe7c, 0x03c8, 0x0482, 0xff17, 0x03c8, 0x04a0, 0xfeec, 0x036b, 0x04a0, 0xfeec, 0x0426, 0x04d2, 0xfea7, 0x038e, 0x04d2, 
+	0xfea7, 0x0402, 0x04e4, 0xfeec, 0x03c8, 0x047e, 0xfe0a, 0x03c4, 0x047e, 0xfe0a, 0x03cc, 0x047e, 0xfe90, 0x03c4, 0x0486, 0xfe0a, 
+	0x03c4, 0x047e, 0xfe90, 0x03cc, 0x0486, 0xfe0a, 0x03cc, 0x0486, 0xfe90, 0x03c4, 0x0486, 0xfe90, 0x03cc, 0x0002, 0x04d6, 0xfedc, 
+	0x0b55, 0x00d8, 0x0000, 0x0002, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 
+	0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 
+	0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 
+	0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 
+	0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x0439, 0xfeff, 0x0b56, 0x0457, 0xff6e, 
+	0x0af9, 0x0457, 0xff6e, 0x0bb2, 0x04a5, 0xfeff, 0x0ac0, 0x04a5, 0xfeff, 0x0beb, 0x04d6, 0xfeba, 0x0b56, 0x04d6, 0xffb3, 0x0b56, 
+	0x0506, 0xff6e, 0x0ac0, 0x0506, 0xff6e, 0x0beb, 0x0555, 0xfeff, 0x0af9, 0x0555, 0xfeff, 0x0bb2, 0x0573, 0xff6e, 0x0b56, 0x04cf, 
+	0xfe04, 0x0b4f, 0x04cf, 0xfe04, 0x0b5c, 0x04cf, 0xfeda, 0x0b4f, 0x04dd, 0xfe04, 0x0b4f, 0x04cf, 0xfeda, 0x0b5c, 0x04dd, 0xfe04, 
+	0x0b5c, 0x04dd, 0xfeda, 0x0b4f, 0x04dd, 0xfeda, 0x0b5c, 0x12c0, 0x002a, 0x001f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 
+	0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 
+	0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 
+	0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0439, 0xfeff, 0x0b56, 0x0457, 0xff6e, 0x0af9, 0x0457, 0xff6e, 
+	0x0bb2, 0x04a5, 0xfeff, 0x0ac0, 0x04a5, 0xfeff, 0x0beb, 0x04d6, 0xfeba, 0x0b56, 0x04d6, 0xffb3, 0x0b56, 0x0506, 0xff6e, 0x0ac0, 
+	0x0506, 0xff6e, 0x0beb, 0x0555, 0xfeff, 0x0af9, 0x0555, 0xfeff, 0x0bb2, 0x0573, 0xff6e, 0x0b56, 0x04d6, 0xfe04, 0x0b56, 0x04d6, 
+	0xfeda, 0x0b56, 0x0002, 0x048c, 0xfe85, 0x0bcf, 0x0087, 0x0000, 0x0002, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 
+	0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 
+	0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 
+	0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 
+	0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 
+	0x042a, 0xfe9b, 0x0bcf, 0x043d, 0xfee1, 0x0b96, 0x043d, 0xfee1, 0x0c09, 0x046e, 0xfe9b, 0x0b72, 0x046e, 0xfe9b, 0x0c2d, 0x048c, 
+	0xfe70, 0x0bcf, 0x048c, 0xff0c, 0x0bcf, 0x04ab, 0xfee1, 0x0b72, 0x04ab, 0xfee1, 0x0c2d, 0x04dc, 0xfe9b, 0x0b96, 0x04dc, 0xfe9b, 
+	0x0c09, 0x04ef, 0xfee1, 0x0bcf, 0x0488, 0xfdfe, 0x0bcb, 0x0488, 0xfdfe, 0x0bd4, 0x0488, 0xfe84, 0x0bcb, 0x0491, 0xfdfe, 0x0bcb, 
+	0x0488, 0xfe84, 0x0bd4, 0x0491, 0xfdfe, 0x0bd4, 0x0491, 0xfe84, 0x0bcb, 0x0491, 0xfe84, 0x0bd4, 0x12c0, 0x002a, 0x001f, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 
+	0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 
+	0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x042a, 0xfe9b, 0x0bcf, 
+	0x043d, 0xfee1, 0x0b96, 0x043d, 0xfee1, 0x0c09, 0x046e, 0xfe9b, 0x0b72, 0x046e, 0xfe9b, 0x0c2d, 0x048c, 0xfe70, 0x0bcf, 0x048c, 
+	0xff0c, 0x0bcf, 0x04ab, 0xfee1, 0x0b72, 0x04ab, 0xfee1, 0x0c2d, 0x04dc, 0xfe9b, 0x0b96, 0x04dc, 0xfe9b, 0x0c09, 0x04ef, 0xfee1, 
+	0x0bcf, 0x048d, 0xfdfe, 0x0bd0, 0x048d, 0xfe84, 0x0bd0, 0x0002, 0x0531, 0xfea6, 0x0bcf, 0x00a9, 0x0000, 0x0002, 0x0000, 0x003c, 
+	0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 
+	0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 
+	0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 
+	0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 
+	0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 
+	0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0x04b7, 0xfec1, 0x0bcf, 0x04ce, 0xff18, 0x0b87, 0x04ce, 0xff18, 0x0c18, 0x050b, 0xfec1, 
+	0x0b5b, 0x050b, 0xfec1, 0x0c44, 0x0531, 0xfe8b, 0x0bcf, 0x0531, 0xff4e, 0x0bcf, 0x0557, 0xff18, 0x0b5b, 0x0557, 0xff18, 0x0c44, 
+	0x0595, 0xfec1, 0x0b87, 0x0595, 0xfec1, 0x0c18, 0x05ac, 0xff18, 0x0bcf, 0x052c, 0xfdfd, 0x0bca, 0x052c, 0xfdfd, 0x0bd5, 0x052c, 
+	0xfea4, 0x0bca, 0x0536, 0xfdfd, 0x0bca, 0x052c, 0xfea4, 0x0bd5, 0x0536, 0xfdfd, 0x0bd5, 0x0536, 0xfea4, 0x0bca, 0x0536, 0xfea4, 
+	0x0bd5, 0x12c0, 0x002a, 0x001f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 
+	0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 
+	0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 
+	0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 
+	0x0024, 0x0027, 0x04b7, 0xfec1, 0x0bcf, 0x04ce, 0xff18, 0x0b87, 0x04ce, 0xff18, 0x0c18, 0x050b, 0xfec1, 0x0b5b, 0x050b, 0xfec1, 
+	0x0c44, 0x0531, 0xfe8b, 0x0bcf, 0x0531, 0xff4e, 0x0bcf, 0x0557, 0xff18, 0x0b5b, 0x0557, 0xff18, 0x0c44, 0x0595, 0xfec1, 0x0b87, 
+	0x0595, 0xfec1, 0x0c18, 0x05ac, 0xff18, 0x0bcf, 0x0531, 0xfdfd, 0x0bd0, 0x0531, 0xfea4, 0x0bd0, 0x0002, 0xfb0a, 0xfedc, 0x0b55, 
+	0x00d8, 0x0000, 0x0002, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 
+	0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 
+	0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 
+	0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 
+	0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 
+	0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfa6d, 0xfeff, 0x0b56, 0xfa8b, 0xff6e, 0x0af9, 
+	0xfa8b, 0xff6e, 0x0bb2, 0xfad9, 0xfeff, 0x0ac0, 0xfad9, 0xfeff, 0x0beb, 0xfb0a, 0xfeba, 0x0b56, 0xfb0a, 0xffb3, 0x0b56, 0xfb3b, 
+	0xff6e, 0x0ac0, 0xfb3b, 0xff6e, 0x0beb, 0xfb89, 0xfeff, 0x0af9, 0xfb89, 0xfeff, 0x0bb2, 0xfba7, 0xff6e, 0x0b56, 0xfb03, 0xfe04, 
+	0x0b4f, 0xfb03, 0xfe04, 0x0b5c, 0xfb03, 0xfeda, 0x0b4f, 0xfb11, 0xfe04, 0x0b4f, 0xfb03, 0xfeda, 0x0b5c, 0xfb11, 0xfe04, 0x0b5c, 
+	0xfb11, 0xfeda, 0x0b4f, 0xfb11, 0xfeda, 0x0b5c, 0x12c0, 0x002a, 0x001f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 
+	0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 
+	0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 
+	0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0xfa6d, 0xfeff, 0x0b56, 0xfa8b, 0xff6e, 0x0af9, 0xfa8b, 0xff6e, 0x0bb2, 
+	0xfad9, 0xfeff, 0x0ac0, 0xfad9, 0xfeff, 0x0beb, 0xfb0a, 0xfeba, 0x0b56, 0xfb0a, 0xffb3, 0x0b56, 0xfb3b, 0xff6e, 0x0ac0, 0xfb3b, 
+	0xff6e, 0x0beb, 0xfb89, 0xfeff, 0x0af9, 0xfb89, 0xfeff, 0x0bb2, 0xfba7, 0xff6e, 0x0b56, 0xfb0a, 0xfe04, 0x0b56, 0xfb0a, 0xfeda, 
+	0x0b56, 0x0002, 0xfb6d, 0xfe85, 0x0bcf, 0x0087, 0x0000, 0x0002, 0x0000, 0x003c, 0x002a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 
+	0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 
+	0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 
+	0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 
+	0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 0x0033, 0x0039, 0x0036, 0x0039, 0xfb0a, 
+	0xfe9b, 0x0bcf, 0xfb1d, 0xfee1, 0x0b96, 0xfb1d, 0xfee1, 0x0c09, 0xfb4e, 0xfe9b, 0x0b72, 0xfb4e, 0xfe9b, 0x0c2d, 0xfb6c, 0xfe70, 
+	0x0bcf, 0xfb6c, 0xff0c, 0x0bcf, 0xfb8b, 0xfee1, 0x0b72, 0xfb8b, 0xfee1, 0x0c2d, 0xfbbc, 0xfe9b, 0x0b96, 0xfbbc, 0xfe9b, 0x0c09, 
+	0xfbcf, 0xfee1, 0x0bcf, 0xfb68, 0xfdfe, 0x0bcb, 0xfb68, 0xfdfe, 0x0bd4, 0xfb68, 0xfe84, 0x0bcb, 0xfb71, 0xfdfe, 0x0bcb, 0xfb68, 
+	0xfe84, 0x0bd4, 0xfb71, 0xfdfe, 0x0bd4, 0xfb71, 0xfe84, 0x0bcb, 0xfb71, 0xfe84, 0x0bd4, 0x12c0, 0x002a, 0x001f, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 
+	0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 
+	0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 
+	0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0xfb0a, 0xfe9b, 0x0bcf, 0xfb1d, 
+	0xfee1, 0x0b96, 0xfb1d, 0xfee1, 0x0c09, 0xfb4e, 0xfe9b, 0x0b72, 0xfb4e, 0xfe9b, 0x0c2d, 0xfb6c, 0xfe70, 0x0bcf, 0xfb6c, 0xff0c, 
+	0x0bcf, 0xfb8b, 0xfee1, 0x0b72, 0xfb8b, 0xfee1, 0x0c2d, 0xfbbc, 0xfe9b, 0x0b96, 0xfbbc, 0xfe9b, 0x0c09, 0xfbcf, 0xfee1, 0x0bcf, 
+	0xfb6c, 0xfdfe, 0x0bd0, 0xfb6c, 0xfe84, 0x0bd0, 0x0002, 0xfac8, 0xfea6, 0x0bcf, 0x00a9, 0x0000, 0x0002, 0x0000, 0x003c, 0x002a, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0000, 0x000f, 
+	0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 
+	0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0018, 0x001e, 
+	0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 0x0027, 0x0024, 0x002a, 
+	0x0024, 0x002d, 0x0027, 0x0030, 0x002a, 0x0030, 0x0027, 0x0033, 0x002d, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0030, 0x0039, 
+	0x0033, 0x0039, 0x0036, 0x0039, 0xfa4d, 0xfec1, 0x0bcf, 0xfa64, 0xff18, 0x0b87, 0xfa64, 0xff18, 0x0c18, 0xfaa2, 0xfec1, 0x0b5b, 
+	0xfaa2, 0xfec1, 0x0c44, 0xfac7, 0xfe8b, 0x0bcf, 0xfac7, 0xff4e, 0x0bcf, 0xfaed, 0xff18, 0x0b5b, 0xfaed, 0xff18, 0x0c44, 0xfb2b, 
+	0xfec1, 0x0b87, 0xfb2b, 0xfec1, 0x0c18, 0xfb42, 0xff18, 0x0bcf, 0xfac2, 0xfdfd, 0x0bca, 0xfac2, 0xfdfd, 0x0bd5, 0xfac2, 0xfea4, 
+	0x0bca, 0xfacd, 0xfdfd, 0x0bca, 0xfac2, 0xfea4, 0x0bd5, 0xfacd, 0xfdfd, 0x0bd5, 0xfacd, 0xfea4, 0x0bca, 0xfacd, 0xfea4, 0x0bd5, 
+	0x12c0, 0x002a, 0x001f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 
+	0x000c, 0x0000, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0003, 0x0015, 0x0009, 0x0015, 0x0012, 
+	0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 
+	0x001e, 0x0018, 0x001e, 0x001b, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0024, 
+	0x0027, 0xfa4d, 0xfec1, 0x0bcf, 0xfa64, 0xff18, 0x0b87, 0xfa64, 0xff18, 0x0c18, 0xfaa2, 0xfec1, 0x0b5b, 0xfaa2, 0xfec1, 0x0c44, 
+	0xfac7, 0xfe8b, 0x0bcf, 0xfac7, 0xff4e, 0x0bcf, 0xfaed, 0xff18, 0x0b5b, 0xfaed, 0xff18, 0x0c44, 0xfb2b, 0xfec1, 0x0b87, 0xfb2b, 
+	0xfec1, 0x0c18, 0xfb42, 0xff18, 0x0bcf, 0xfac7, 0xfdfd, 0x0bd0, 0xfac7, 0xfea4, 0x0bd0, 0x0003, 0x0000, 0xff7d, 0xfef9, 0x0428, 
+	0x0000, 0x0001, 0x0000, 0x0018, 0x0004, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0012, 0x000f, 
+	0x0015, 0xfbf0, 0xfef9, 0xfe42, 0xfce4, 0xfef9, 0xffaf, 0xfce4, 0x0000, 0xffaf, 0xfbf0, 0x0000, 0xfe42, 0x031c, 0xfef9, 0xffaf, 
+	0x0410, 0xfef9, 0xfe42, 0x031c, 0x0000, 0xffaf, 0x0410, 0x0000, 0xfe42, 0x0003, 0x043b, 0xff7d, 0xfd6b, 0x0100, 0x0000, 0x0001, 
+	0x0000, 0x0012, 0x0004, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0009, 0x0009, 0x000c, 0x000f, 0x0410, 
+	0xfef9, 0xfe42, 0x0447, 0xfef9, 0xfd6a, 0x0410, 0x0000, 0xfe42, 0x0447, 0x0000, 0xfd6a, 0x0466, 0xfef9, 0xfc93, 0x0466, 0x0000, 
+	0xfc93, 0x0002, 0x0466, 0xff7d, 0xfbe4, 0x00dc, 0x0000, 0x0001, 0x0000, 0x000c, 0x0005, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0466, 0xfef9, 0xfb34, 0x0466, 0xfef9, 0xfc93, 0x0466, 0x0000, 0xfb34, 0x0466, 0x0000, 
+	0xfc93, 0x0003, 0xfbc5, 0xff7d, 0xfd6b, 0x0100, 0x0000, 0x0001, 0x0000, 0x0012, 0x0004, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 
+	0x0009, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x000c, 0xfb9a, 0xfef9, 0xfc93, 0xfbb9, 0xfef9, 0xfd6a, 0xfbb9, 0x0000, 0xfd6a, 
+	0xfb9a, 0x0000, 0xfc93, 0xfbf0, 0x0000, 0xfe42, 0xfbf0, 0xfef9, 0xfe42, 0x0002, 0xfb9a, 0xff7d, 0xfbe4, 0x00dc, 0x0000, 0x0001, 
+	0x0000, 0x000c, 0x0005, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0xfb9a, 0xfef9, 0xfb34, 
+	0xfb9a, 0xfef9, 0xfc93, 0xfb9a, 0x0000, 0xfb34, 0xfb9a, 0x0000, 0xfc93, 0x0002, 0xfa7e, 0x0435, 0xffe7, 0x085e, 0x0000, 0x0001, 
+	0x0000, 0x006c, 0x0029, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0015, 
+	0x0006, 0x0015, 0x0018, 0x0015, 0x001b, 0x0006, 0x001e, 0x0018, 0x0021, 0x001e, 0x0024, 0x0021, 0x0027, 0x0024, 0x002a, 0x0027, 
+	0x002d, 0x002a, 0x0012, 0x0012, 0x002d, 0x002d, 0x0030, 0x0033, 0x0030, 0x0036, 0x0033, 0x0039, 0x0036, 0x001b, 0x0039, 0x003c, 
+	0x001b, 0x003c, 0x003f, 0x003f, 0x0042, 0x0045, 0x0042, 0x0048, 0x0045, 0x0048, 0x004b, 0x0045, 0x004e, 0x0042, 0x0051, 0x004b, 
+	0x0054, 0x004e, 0x0057, 0x0051, 0x005a, 0x0054, 0x005d, 0x0057, 0x0060, 0x005a, 0x0030, 0x005a, 0x0063, 0x0060, 0x0063, 0x005d, 
+	0x0066, 0x0060, 0x0069, 0x0066, 0x0069, 0xf9e3, 0xfecd, 0x0641, 0xf9e3, 0x0000, 0x0641, 0xfa56, 0xfecd, 0x0641, 0xf9e3, 0x00f8, 
+	0x0641, 0xf9e3, 0x0376, 0x0641, 0xf9e3, 0x05f3, 0x0641, 0xfa56, 0x05f3, 0x0641, 0xfa56, 0xfecd, 0x03aa, 0xfa56, 0x0000, 0x03aa, 
+	0xfb19, 0xfecd, 0x03aa, 0xfa56, 0x0000, 0x0641, 0xfa56, 0x00f8, 0x03aa, 0xfa56, 0x00f8, 0x0641, 0xfa56, 0x0376, 0x03aa, 0xfa56, 
+	0x0376, 0x0641, 0xfa56, 0x05f4, 0x03aa, 0xfb19, 0x05f4, 0x03aa, 0xfb19, 0x0376, 0x03aa, 0xfb19, 0x00f8, 0x03aa, 0xfb19, 0x0000, 
+	0x03aa, 0xfb19, 0xfecd, 0x01db, 0xfb19, 0x0000, 0x01db, 0xfb19, 0x00f8, 0x01db, 0xfb19, 0x00f8, 0xfca1, 0xfb19, 0x00f8, 0xf98c, 
+	0xfb19, 0x0376, 0xf98c, 0xfb19, 0x0376, 0xfca1, 0xfb19, 0x0376, 0x01db, 0xfb19, 0x05f4, 0xf98c, 0xfb19, 0x05f4, 0xfca1, 0xfb19, 
+	0x05f4, 0x01db, 0xfb19, 0x075d, 0xf98c, 0xfb19, 0x075d, 0xfca1, 0xfb19, 0x075d, 0x01db, 0xfb19, 0x099e, 0xf98c, 0xfb19, 0x099e, 
+	0xfca1, 0x0002, 0x03b9, 0xfe8b, 0x03b4, 0x014c, 0x0000, 0x0002, 0x0000, 0x013e, 0x00c9, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 0x0006, 0x0012, 0x0015, 0x0012, 0x0018, 0x0012, 
+	0x001b, 0x0006, 0x001e, 0x0015, 0x001e, 0x000c, 0x0021, 0x001e, 0x0021, 0x000c, 0x0024, 0x000f, 0x0024, 0x0015, 0x0027, 0x0018, 
+	0x0027, 0x0015, 0x002a, 0x001b, 0x002a, 0x001e, 0x002d, 0x002a, 0x002d, 0x0021, 0x0030, 0x0024, 0x0030, 0x002d, 0x0030, 0x0033, 
+	0x0027, 0x0036, 0x0033, 0x0039, 0x0036, 0x003c, 0x0039, 0x003c, 0x003f, 0x003f, 0x0036, 0x003c, 0x0042, 0x0039, 0x0045, 0x0042, 
+	0x0045, 0x003f, 0x0048, 0x0048, 0x0033, 0x003f, 0x004b, 0x0042, 0x004b, 0x0036, 0x0018, 0x0018, 0x004e, 0x0048, 0x0051, 0x004b, 
+	0x0051, 0x001b, 0x004e, 0x001b, 0x0054, 0x0006, 0x0054, 0x0009, 0x0054, 0x0054, 0x0024, 0x0054, 0x002d, 0x0057, 0x004e, 0x0036, 
+	0x0057, 0x0045, 0x0057, 0x004b, 0x0057, 0x0057, 0x005a, 0x0033, 0x005a, 0x004e, 0x005d, 0x005a, 0x005d, 0x0027, 0x005d, 0x002a, 
+	0x005d, 0x0051, 0x005a, 0x0060, 0x0063, 0x0060, 0x0066, 0x0060, 0x0069, 0x0063, 0x006c, 0x0066, 0x006c, 0x0063, 0x006f, 0x0069, 
+	0x006f, 0x0072, 0x0066, 0x0072, 0x0075, 0x0072, 0x0078, 0x0072, 0x007b, 0x0066, 0x007e, 0x0075, 0x007e, 0x006c, 0x0081, 0x007e, 
+	0x0081, 0x006c, 0x0084, 0x006f, 0x0084, 0x0075, 0x0087, 0x0078, 0x0087, 0x0075, 0x008a, 0x007b, 0x008a, 0x007e, 0x008d, 0x008a, 
+	0x008d, 0x0081, 0x0090, 0x0084, 0x0090, 0x008d, 0x0090, 0x0093, 0x0087, 0x0096, 0x0093, 0x0099, 0x0096, 0x009c, 0x0099, 0x009c, 
+	0x009f, 0x009f, 0x0096, 0x009c, 0x00a2, 0x0099, 0x00a5, 0x00a2, 0x00a5, 0x009f, 0x00a8, 0x00a8, 0x0093, 0x009f, 0x00ab, 0x00a2, 
+	0x00ab, 0x0096, 0x0078, 0x0078, 0x00ae, 0x00a8, 0x00b1, 0x00ab, 0x00b1, 0x007b, 0x00ae, 0x007b, 0x00b4, 0x0066, 0x00b4, 0x0069, 
+	0x00b4, 0x00b4, 0x0084, 0x00b4, 0x008d, 0x00b7, 0x00ae, 0x0096, 0x00b7, 0x00a5, 0x00b7, 0x00ab, 0x00b7, 0x00b7, 0x00ba, 0x0093, 
+	0x00ba, 0x00ae, 0x00bd, 0x00ba, 0x00bd, 0x0087, 0x00bd, 0x008a, 0x00bd, 0x00b1, 0x00ba, 0x00c0, 0x00c3, 0x00c0, 0x00c6, 0x00c0, 
+	0x00c9, 0x00c3, 0x00cc, 0x00cc, 0x00c6, 0x00c3, 0x00cf, 0x00c9, 0x00cf, 0x00cc, 0x00d2, 0x00cc, 0x00d5, 0x00cf, 0x00d5, 0x00c6, 
+	0x00d8, 0x00d8, 0x00d2, 0x00c6, 0x00db, 0x00c9, 0x00db, 0x00d5, 0x00db, 0x00d8, 0x00de, 0x00d8, 0x00e1, 0x00db, 0x00e1, 0x00d2, 
+	0x00e4, 0x00de, 0x00e4, 0x00d2, 0x00e7, 0x00d5, 0x00e7, 0x00e1, 0x00e7, 0x00ea, 0x00de, 0x00ea, 0x00ed, 0x00ed, 0x00e4, 0x00ea, 
+	0x00f0, 0x00ea, 0x00f3, 0x00de, 0x00f6, 0x00e1, 0x00f6, 0x00f3, 0x00f6, 0x00ed, 0x00f9, 0x00f0, 0x00f9, 0x00ed, 0x00fc, 0x00f3, 
+	0x00fc, 0x00ff, 0x00f0, 0x0102, 0x00ff, 0x0105, 0x0102, 0x0108, 0x0105, 0x010b, 0x0108, 0x010b, 0x010e, 0x010e, 0x0105, 0x010b, 
+	0x0111, 0x0108, 0x0114, 0x0111, 0x0114, 0x0117, 0x010e, 0x0117, 0x0105, 0x0117, 0x011a, 0x0117, 0x011d, 0x010e, 0x0120, 0x0111, 
+	0x0120, 0x011d, 0x0120, 0x0102, 0x011a, 0x0102, 0x0123, 0x011a, 0x0126, 0x011a, 0x0129, 0x011d, 0x0129, 0x0123, 0x0129, 0x00ff, 
+	0x0126, 0x00ff, 0x012c, 0x0123, 0x012c, 0x0126, 0x00f9, 0x0126, 0x012f, 0x0129, 0x012f, 0x012c, 0x012f, 0x00f9, 0x0132, 0x012f, 
+	0x0132, 0x00fc, 0x0132, 0x00fc, 0x0135, 0x00e4, 0x0135, 0x00e7, 0x0135, 0x00f6, 0x0135, 0x0138, 0x0132, 0x00f0, 0x0138, 0x00f3, 
+	0x0138, 0x012c, 0x0138, 0x0105, 0x013b, 0x0114, 0x013b, 0x011d, 0x013b, 0x0120, 0x013b, 0x013b, 0x0123, 0x0359, 0xfdf2, 0x04c7, 
+	0x0359, 0xfdf2, 0x04cb, 0x0359, 0xfe16, 0x04c7, 0x035d, 0xfdf2, 0x04c7, 0x0359, 0xfe16, 0x04cb, 0x035d, 0xfdf2, 0x04cb, 0x0359, 
+	0xfe16, 0x04a2, 0x0359, 0xfe1b, 0x04a2, 0x0359, 0xff1f, 0x02c1, 0x035d, 0xfe16, 0x04a2, 0x0359, 0xfe1b, 0x04c7, 0x0359, 0xfe1b, 
+	0x04cb, 0x035d, 0xfe16, 0x04cb, 0x0359, 0xff24, 0x02c1, 0x035d, 0xfe1b, 0x04a2, 0x035d, 0xfe1b, 0x04c7, 0x035d, 0xfe1b, 0x04cb, 
+	0x0359, 0xff22, 0x02a2, 0x0359, 0xff1e, 0x02a2, 0x0359, 0xfef8, 0x02a2, 0x0359, 0xfef8, 0x029e, 0x0359, 0xff1e, 0x029e, 0x035d, 
+	0xfef8, 0x029e, 0x035d, 0xfef8, 0x02a2, 0x0359, 0xff22, 0x029e, 0x035d, 0xff1e, 0x029e, 0x035d, 0xff1f, 0x02c1, 0x035d, 0xff22, 
+	0x029e, 0x035d, 0xfe16, 0x04c7, 0x035d, 0xff1e, 0x02a2, 0x035d, 0xff22, 0x02a2, 0x035d, 0xff24, 0x02c1, 0x03c7, 0xfdf2, 0x04c7, 
+	0x03c7, 0xfdf2, 0x04cb, 0x03c7, 0xfe16, 0x04c7, 0x03cb, 0xfdf2, 0x04c7, 0x03c7, 0xfe16, 0x04cb, 0x03cb, 0xfdf2, 0x04cb, 0x03c7, 
+	0xfe16, 0x04a2, 0x03c7, 0xfe1b, 0x04a2, 0x03c7, 0xff1f, 0x02c1, 0x03cb, 0xfe16, 0x04a2, 0x03c7, 0xfe1b, 0x04c7, 0x03c7, 0xfe1b, 
+	0x04cb, 0x03cb, 0xfe16, 0x04cb, 0x03c7, 0xff24, 0x02c1, 0x03cb, 0xfe1b, 0x04a2, 0x03cb, 0xfe1b, 0x04c7, 0x03cb, 0xfe1b, 0x04cb, 
+	0x03c7, 0xff22, 0x02a2, 0x03c7, 0xff1e, 0x02a2, 0x03c7, 0xfef8, 0x02a2, 0x03c7, 0xfef8, 0x029e, 0x03c7, 0xff1e, 0x029e, 0x03cb, 
+	0xfef8, 0x029e, 0x03cb, 0xfef8, 0x02a2, 0x03c7, 0xff22, 0x029e, 0x03cb, 0xff1e, 0x029e, 0x03cb, 0xff1f, 0x02c1, 0x03cb, 0xff22, 
+	0x029e, 0x03cb, 0xfe16, 0x04c7, 0x03cb, 0xff1e, 0x02a2, 0x03cb, 0xff22, 0x02a2, 0x03cb, 0xff24, 0x02c1, 0x0414, 0xfdf1, 0x04bf, 
+	0x0414, 0xfdf1, 0x04c4, 0x0414, 0xfe04, 0x04c7, 0x0419, 0xfdf1, 0x04bf, 0x0414, 0xfe02, 0x04cb, 0x0419, 0xfdf1, 0x04c4, 0x0414, 
+	0xfe12, 0x04c9, 0x0419, 0xfe02, 0x04cb, 0x0414, 0xfe11, 0x04c5, 0x0419, 0xfe04, 0x04c7, 0x0414, 0xfe16, 0x04be, 0x0419, 0xfe11, 
+	0x04c5, 0x0414, 0xfe1b, 0x04c0, 0x0419, 0xfe12, 0x04c9, 0x0414, 0xfe16, 0x04a5, 0x0414, 0xfe1b, 0x04a5, 0x0414, 0xff1f, 0x02bd, 
+	0x0419, 0xfe16, 0x04a5, 0x0419, 0xfe16, 0x04be, 0x0414, 0xff24, 0x02bd, 0x0419, 0xfe1b, 0x04a5, 0x0414, 0xff1c, 0x02a4, 0x0414, 
+	0xff16, 0x02a2, 0x0414, 0xff0c, 0x02a2, 0x0414, 0xfef8, 0x02ad, 0x0414, 0xfef8, 0x02a8, 0x0414, 0xff0b, 0x029e, 0x0419, 0xfef8, 
+	0x02a8, 0x0419, 0xfef8, 0x02ad, 0x0414, 0xff09, 0x029e, 0x0414, 0xff19, 0x029e, 0x0419, 0xff09, 0x029e, 0x0419, 0xff0b, 0x029e, 
+	0x0419, 0xff16, 0x02a2, 0x0414, 0xff20, 0x02a2, 0x0419, 0xff19, 0x029e, 0x0419, 0xff1c, 0x02a4, 0x0419, 0xff20, 0x02a2, 0x0419, 
+	0xff24, 0x02bd, 0x0419, 0xfe1b, 0x04c0, 0x0419, 0xff1f, 0x02bd, 0x0419, 0xff0c, 0x02a2, 0x0960, 0x006c, 0x0030, 0x0000, 0x0003, 
+	0x0006, 0x0003, 0x0006, 0x0009, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x0009, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 0x0018, 
+	0x0018, 0x000f, 0x0018, 0x001b, 0x000f, 0x001e, 0x001b, 0x001e, 0x001e, 0x000c, 0x0021, 0x0024, 0x0027, 0x0024, 0x0027, 0x002a, 
+	0x0027, 0x002d, 0x002a, 0x002d, 0x0030, 0x002a, 0x0033, 0x0030, 0x0036, 0x0033, 0x0036, 0x0039, 0x0039, 0x0030, 0x0039, 0x003c, 
+	0x0030, 0x003f, 0x003c, 0x003f, 0x003f, 0x002d, 0x0042, 0x0045, 0x0042, 0x0048, 0x0045, 0x0048, 0x0048, 0x004b, 0x004e, 0x004b, 
+	0x004e, 0x0051, 0x0051, 0x004b, 0x004e, 0x0054, 0x004e, 0x0057, 0x0054, 0x0057, 0x005a, 0x0054, 0x005d, 0x005a, 0x0060, 0x005d, 
+	0x0060, 0x0063, 0x0063, 0x005d, 0x0063, 0x0066, 0x0066, 0x005a, 0x0066, 0x0069, 0x005a, 0x0069, 0x0069, 0x0057, 0x035b, 0xfdf2, 
+	0x04c9, 0x035b, 0xfe18, 0x04c9, 0x035b, 0xfe18, 0x04a2, 0x035b, 0xff1f, 0x02c1, 0x035b, 0xff24, 0x02c1, 0x035b, 0xff1e, 0x02a2, 
+	0x035b, 0xfef8, 0x02a2, 0x035b, 0xfef8, 0x029e, 0x035b, 0xff1e, 0x029e, 0x035b, 0xff22, 0x029e, 0x035b, 0xff22, 0x02a2, 0x03c9, 
+	0xfdf2, 0x04c9, 0x03c9, 0xfe18, 0x04c9, 0x03c9, 0xfe18, 0x04a2, 0x03c9, 0xff1f, 0x02c1, 0x03c9, 0xff24, 0x02c1, 0x03c9, 0xff1e, 
+	0x02a2, 0x03c9, 0xfef8, 0x02a2, 0x03c9, 0xfef8, 0x029e, 0x03c9, 0xff1e, 0x029e, 0x03c9, 0xff22, 0x029e, 0x03c9, 0xff22, 0x02a2, 
+	0x0417, 0xfdf1, 0x04bf, 0x0417, 0xfdf1, 0x04c4, 0x0417, 0xfe03, 0x04c9, 0x0417, 0xfe15, 0x04c5, 0x0417, 0xfe18, 0x04a5, 0x0417, 
+	0xfe16, 0x04be, 0x0417, 0xff1f, 0x02bd, 0x0417, 0xff24, 0x02bd, 0x0417, 0xff19, 0x02a3, 0x0417, 0xff0c, 0x02a2, 0x0417, 0xfef8, 
+	0x02ab, 0x0417, 0xff0a, 0x029e, 0x0417, 0xff19, 0x029e, 0x0417, 0xff20, 0x02a2, 0x0002, 0x058d, 0x0295, 0x092b, 0x03f7, 0x0000, 
+	0x0001, 0x0000, 0x0090, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 
+	0x000f, 0x0015, 0x0018, 0x0015, 0x001b, 0x0018, 0x001b, 0x001e, 0x001e, 0x0021, 0x0021, 0x0024, 0x0024, 0x0027, 0x0027, 0x002a, 
+	0x002a, 0x002d, 0x0030, 0x002d, 0x0033, 0x0030, 0x0033, 0x0036, 0x0036, 0x0039, 0x0039, 0x003c, 0x003c, 0x003f, 0x003f, 0x0042, 
+	0x0042, 0x0045, 0x0048, 0x0045, 0x004b, 0x0048, 0x004b, 0x004e, 0x004e, 0x0051, 0x0051, 0x0054, 0x0054, 0x0057, 0x005a, 0x0057, 
+	0x005d, 0x005a, 0x0060, 0x005d, 0x0063, 0x0060, 0x0066, 0x0063, 0x0069, 0x0066, 0x0069, 0x006c, 0x006c, 0x006f, 0x0072, 0x006f, 
+	0x0075, 0x0072, 0x0078, 0x0075, 0x007b, 0x0078, 0x007e, 0x007b, 0x0081, 0x007e, 0x0081, 0x0084, 0x0084, 0x0087, 0x008a, 0x0087, 
+	0x008d, 0x008a, 0x0012, 0x008d, 0x058d, 0x01ed, 0x0541, 0x058d, 0x01ed, 0x0576, 0x058d, 0x0223, 0x0541, 0x058d, 0x0223, 0x0576, 
+	0x058d, 0x0307, 0x0541, 0x058d, 0x0307, 0x0576, 0x058d, 0x033d, 0x0541, 0x058d, 0x0307, 0x06c7, 0x058d, 0x0223, 0x06c7, 0x058d, 
+	0x01ed, 0x06c7, 0x058d, 0x01ed, 0x06fd, 0x058d, 0x01ed, 0x084d, 0x058d, 0x01ed, 0x0883, 0x058d, 0x0223, 0x0883, 0x058d, 0x0307, 
+	0x0883, 0x058d, 0x0307, 0x09d3, 0x058d, 0x0223, 0x09d3, 0x058d, 0x01ed, 0x09d3, 0x058d, 0x01ed, 0x0a09, 0x058d, 0x01ed, 0x0b59, 
+	0x058d, 0x01ed, 0x0b8f, 0x058d, 0x0223, 0x0b8f, 0x058d, 0x0307, 0x0b8f, 0x058d, 0x0307, 0x0cdf, 0x058d, 0x0223, 0x0cdf, 0x058d, 
+	0x01ed, 0x0cdf, 0x058d, 0x01ed, 0x0d15, 0x058d, 0x0223, 0x0d15, 0x058d, 0x0307, 0x0d15, 0x058d, 0x033d, 0x0d15, 0x058d, 0x033d, 
+	0x0cdf, 0x058d, 0x033d, 0x0b8f, 0x058d, 0x033d, 0x0b59, 0x058d, 0x0307, 0x0b59, 0x058d, 0x0223, 0x0b59, 0x058d, 0x0223, 0x0a09, 
+	0x058d, 0x0307, 0x0a09, 0x058d, 0x033d, 0x0a09, 0x058d, 0x033d, 0x09d3, 0x058d, 0x033d, 0x0883, 0x058d, 0x033d, 0x084d, 0x058d, 
+	0x0307, 0x084d, 0x058d, 0x0223, 0x084d, 0x058d, 0x0223, 0x06fd, 0x058d, 0x0307, 0x06fd, 0x058d, 0x033d, 0x06fd, 0x058d, 0x033d, 
+	0x06c7, 0x058d, 0x033d, 0x0576, 0x0002, 0xfa73, 0x0295, 0x092b, 0x03f7, 0x0000, 0x0001, 0x0000, 0x0090, 0x0030, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0015, 0x0018, 0x0015, 0x001b, 0x0018, 
+	0x001b, 0x001e, 0x001e, 0x0021, 0x0021, 0x0024, 0x0024, 0x0027, 0x0027, 0x002a, 0x002a, 0x002d, 0x0030, 0x002d, 0x0033, 0x0030, 
+	0x0033, 0x0036, 0x0036, 0x0039, 0x0039, 0x003c, 0x003c, 0x003f, 0x003f, 0x0042, 0x0042, 0x0045, 0x0048, 0x0045, 0x004b, 0x0048, 
+	0x004b, 0x004e, 0x004e, 0x0051, 0x0051, 0x0054, 0x0054, 0x0057, 0x005a, 0x0057, 0x005d, 0x005a, 0x0060, 0x005d, 0x0063, 0x0060, 
+	0x0066, 0x0063, 0x0069, 0x0066, 0x0069, 0x006c, 0x006c, 0x006f, 0x0072, 0x006f, 0x0075, 0x0072, 0x0078, 0x0075, 0x007b, 0x0078, 
+	0x007e, 0x007b, 0x0081, 0x007e, 0x0081, 0x0084, 0x0084, 0x0087, 0x008a, 0x0087, 0x008d, 0x008a, 0x0012, 0x008d, 0xfa73, 0x01ed, 
+	0x0541, 0xfa73, 0x01ed, 0x0576, 0xfa73, 0x0223, 0x0541, 0xfa73, 0x0223, 0x0576, 0xfa73, 0x0307, 0x0541, 0xfa73, 0x0307, 0x0576, 
+	0xfa73, 0x033d, 0x0541, 0xfa73, 0x0307, 0x06c7, 0xfa73, 0x0223, 0x06c7, 0xfa73, 0x01ed, 0x06c7, 0xfa73, 0x01ed, 0x06fd, 0xfa73, 
+	0x01ed, 0x084d, 0xfa73, 0x01ed, 0x0883, 0xfa73, 0x0223, 0x0883, 0xfa73, 0x0307, 0x0883, 0xfa73, 0x0307, 0x09d3, 0xfa73, 0x0223, 
+	0x09d3, 0xfa73, 0x01ed, 0x09d3, 0xfa73, 0x01ed, 0x0a09, 0xfa73, 0x01ed, 0x0b59, 0xfa73, 0x01ed, 0x0b8f, 0xfa73, 0x0223, 0x0b8f, 
+	0xfa73, 0x0307, 0x0b8f, 0xfa73, 0x0307, 0x0cdf, 0xfa73, 0x0223, 0x0cdf, 0xfa73, 0x01ed, 0x0cdf, 0xfa73, 0x01ed, 0x0d15, 0xfa73, 
+	0x0223, 0x0d15, 0xfa73, 0x0307, 0x0d15, 0xfa73, 0x033d, 0x0d15, 0xfa73, 0x033d, 0x0cdf, 0xfa73, 0x033d, 0x0b8f, 0xfa73, 0x033d, 
+	0x0b59, 0xfa73, 0x0307, 0x0b59, 0xfa73, 0x0223, 0x0b59, 0xfa73, 0x0223, 0x0a09, 0xfa73, 0x0307, 0x0a09, 0xfa73, 0x033d, 0x0a09, 
+	0xfa73, 0x033d, 0x09d3, 0xfa73, 0x033d, 0x0883, 0xfa73, 0x033d, 0x084d, 0xfa73, 0x0307, 0x084d, 0xfa73, 0x0223, 0x084d, 0xfa73, 
+	0x0223, 0x06fd, 0xfa73, 0x0307, 0x06fd, 0xfa73, 0x033d, 0x06fd, 0xfa73, 0x033d, 0x06c7, 0xfa73, 0x033d, 0x0576, 0x0003, 0xfa2c, 
+	0x01dc, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xf93c, 0x01dc, 
+	0x087b, 0xfb1c, 0x01dc, 0x087b, 0xfb1c, 0x01dc, 0x09da, 0xf93c, 0x01dc, 0x09da, 0x0003, 0xfc0c, 0x01dc, 0x092a, 0x0129, 0x0000, 
+	0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfb1c, 0x01dc, 0x087b, 0xfcfc, 0x01dc, 0x087b, 
+	0xfcfc, 0x01dc, 0x09da, 0xfb1c, 0x01dc, 0x09da, 0x0003, 0xfdec, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 
+	0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfcfc, 0x01dc, 0x087b, 0xfedc, 0x01dc, 0x087b, 0xfedc, 0x01dc, 0x09da, 0xfcfc, 
+	0x01dc, 0x09da, 0x0003, 0x0000, 0x01ee, 0x092b, 0x019d, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 
+	0x0006, 0x0009, 0xfedc, 0x01ee, 0x0806, 0x0124, 0x01ee, 0x0806, 0x0124, 0x01ee, 0x0a50, 0xfedc, 0x01ee, 0x0a50, 0x0003, 0x0214, 
+	0x01dc, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0124, 0x01dc, 
+	0x087b, 0x0304, 0x01dc, 0x087b, 0x0124, 0x01dc, 0x09da, 0x0304, 0x01dc, 0x09da, 0x0003, 0x03f4, 0x01dc, 0x092a, 0x0129, 0x0000, 
+	0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x0304, 0x01dc, 0x087b, 0x04e4, 0x01dc, 0x087b, 
+	0x0304, 0x01dc, 0x09da, 0x04e4, 0x01dc, 0x09da, 0x0003, 0x05d4, 0x01dc, 0x092a, 0x0129, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 
+	0x0000, 0x0003, 0x0006, 0x0006, 0x0003, 0x0009, 0x04e4, 0x01dc, 0x087b, 0x06c4, 0x01dc, 0x087b, 0x04e4, 0x01dc, 0x09da, 0x06c4, 
+	0x01dc, 0x09da, 0x0002, 0x0582, 0x0435, 0xffe7, 0x085e, 0x0000, 0x0001, 0x0000, 0x006c, 0x0029, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0009, 0x0003, 0x000c, 0x0006, 0x000f, 0x0009, 0x0012, 0x0015, 0x000f, 0x0018, 0x0015, 0x0018, 0x001b, 0x0015, 0x001e, 
+	0x000f, 0x0021, 0x0012, 0x0024, 0x001b, 0x0027, 0x001e, 0x002a, 0x0021, 0x002d, 0x0024, 0x0030, 0x002d, 0x0030, 0x0027, 0x0033, 
+	0x002a, 0x0036, 0x002d, 0x0039, 0x0036, 0x0039, 0x0030, 0x003c, 0x0033, 0x003f, 0x0036, 0x0042, 0x003f, 0x0042, 0x0045, 0x003c, 
+	0x0048, 0x0045, 0x004b, 0x0048, 0x000c, 0x004b, 0x000c, 0x004e, 0x004e, 0x0051, 0x004e, 0x0054, 0x0051, 0x0057, 0x0057, 0x005a, 
+	0x005a, 0x005d, 0x005d, 0x003c, 0x005d, 0x0060, 0x0054, 0x0063, 0x0063, 0x0066, 0x0066, 0x0069, 0x0069, 0x0060, 0x04e7, 0xfecd, 
+	0x01db, 0x04e7, 0xfecd, 0x03aa, 0x04e7, 0x0000, 0x01db, 0x04e7, 0x0000, 0x03aa, 0x05aa, 0xfecd, 0x03aa, 0x04e7, 0x00f8, 0x01db, 
+	0x04e7, 0x00f8, 0x03aa, 0x04e7, 0x00f8, 0xfca1, 0x04e7, 0x00f8, 0xf98c, 0x04e7, 0x0376, 0xf98c, 0x04e7, 0x0376, 0xfca1, 0x04e7, 
+	0x0376, 0x01db, 0x04e7, 0x0376, 0x03aa, 0x04e7, 0x05f4, 0xf98c, 0x04e7, 0x05f4, 0xfca1, 0x04e7, 0x05f4, 0x01db, 0x04e7, 0x05f4, 
+	0x03aa, 0x04e7, 0x075d, 0xf98c, 0x04e7, 0x075d, 0xfca1, 0x04e7, 0x075d, 0x01db, 0x05aa, 0x05f4, 0x03aa, 0x04e7, 0x099e, 0xf98c, 
+	0x04e7, 0x099e, 0xfca1, 0x05aa, 0x0376, 0x03aa, 0x05aa, 0x00f8, 0x03aa, 0x05aa, 0x0000, 0x03aa, 0x05aa, 0xfecd, 0x0641, 0x05aa, 
+	0x0000, 0x0641, 0x061d, 0xfecd, 0x0641, 0x05aa, 0x00f8, 0x0641, 0x05aa, 0x0376, 0x0641, 0x05aa, 0x05f3, 0x0641, 0x061d, 0x05f3, 
+	0x0641, 0x061d, 0x0000, 0x0641, 0x061d, 0x00f8, 0x0641, 0x061d, 0x0376, 0x0641, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x03e6, 
+	0x0001, 0x0000, 0x0000, 0x0000, 0x0002, 0x045b, 0x01db, 0x05d6, 0x001c, 0x03e8, 0x0003, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x000f, 0x0015, 0x0006, 0x0015, 
+	0x0003, 0x0018, 0x0009, 0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0006, 0x001e, 0x0012, 0x001e, 0x0009, 0x001e, 0x0015, 0x0021, 
+	0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0450, 0x01c7, 0x05da, 0x0451, 0x01cf, 0x05e7, 0x0453, 0x01d7, 0x05ce, 0x045e, 
+	0x01c0, 0x05dd, 0x0450, 0x01e8, 0x05c7, 0x0451, 0x01f0, 0x05d4, 0x045d, 0x01ef, 0x05c2, 0x0454, 0x01e0, 0x05df, 0x045e, 0x01c8, 
+	0x05eb, 0x045e, 0x01f6, 0x05d0, 0x0465, 0x01d4, 0x05ca, 0x0466, 0x01e2, 0x05e2, 0x0960, 0x0018, 0x000e, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0009, 0x000f, 0x0006, 
+	0x0012, 0x0012, 0x0009, 0x0012, 0x0015, 0x000c, 0x0015, 0x0015, 0x000f, 0x0457, 0x01c4, 0x05dc, 0x0458, 0x01cc, 0x05e9, 0x0453, 
+	0x01d7, 0x05ce, 0x0465, 0x01d4, 0x05ca, 0x0454, 0x01e0, 0x05df, 0x0466, 0x01e2, 0x05e2, 0x0457, 0x01ec, 0x05c5, 0x0458, 0x01f3, 
+	0x05d2, 0x12c0, 0x000f, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0009, 0x000c, 0x0456, 0x01ca, 0x05d7, 0x0458, 0x01cc, 0x05e9, 0x0456, 0x01ec, 0x05cf, 0x0465, 0x01d4, 0x05ca, 
+	0x0466, 0x01e2, 0x05e2, 0x0002, 0x0448, 0x0115, 0x0480, 0x001c, 0x03e9, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x000f, 0x0015, 0x0006, 0x0015, 0x0003, 
+	0x0018, 0x0009, 0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x0012, 0x001e, 0x0015, 0x0021, 0x001b, 
+	0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x043d, 0x0101, 0x0483, 0x043e, 0x0109, 0x0491, 0x0440, 0x0111, 0x0478, 0x044b, 0x00fa, 
+	0x0486, 0x043d, 0x0122, 0x0470, 0x043e, 0x012a, 0x047e, 0x044b, 0x0129, 0x046c, 0x0441, 0x011a, 0x0489, 0x044c, 0x0102, 0x0494, 
+	0x044b, 0x0130, 0x047a, 0x0452, 0x010e, 0x0473, 0x0453, 0x011c, 0x048c, 0x12c0, 0x0012, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x0006, 0x000f, 
+	0x0009, 0x000f, 0x043e, 0x0105, 0x048a, 0x044b, 0x00fa, 0x0486, 0x0449, 0x0110, 0x0476, 0x044b, 0x0113, 0x048e, 0x043e, 0x0126, 
+	0x0477, 0x044b, 0x012d, 0x0473, 0x0002, 0x0436, 0x0060, 0x0321, 0x001c, 0x03ea, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x000f, 0x0015, 0x0006, 0x0015, 
+	0x0003, 0x0018, 0x0009, 0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x0012, 0x001e, 0x0015, 0x0021, 
+	0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x042b, 0x004c, 0x0322, 0x042c, 0x0052, 0x0330, 0x042e, 0x005d, 0x0318, 0x0439, 
+	0x0045, 0x0324, 0x042b, 0x006f, 0x0312, 0x042c, 0x0075, 0x0321, 0x0439, 0x0076, 0x030f, 0x042f, 0x0064, 0x032a, 0x043a, 0x004b, 
+	0x0333, 0x0439, 0x007c, 0x031d, 0x0440, 0x005b, 0x0314, 0x0441, 0x0066, 0x032d, 0x12c0, 0x0012, 0x000c, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 
+	0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x042e, 0x005d, 0x0318, 0x0433, 0x004c, 0x032a, 0x0434, 0x0076, 0x0315, 0x042e, 0x006d, 
+	0x0326, 0x0440, 0x005b, 0x0314, 0x0441, 0x0066, 0x032d, 0x0002, 0x0433, 0xffe6, 0x01aa, 0x001c, 0x03eb, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 
+	0x0006, 0x0012, 0x0015, 0x0015, 0x000c, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x0018, 
+	0x001e, 0x000c, 0x0021, 0x000f, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0429, 0xffd2, 0x01a6, 0x0429, 0xffd5, 0x01b5, 0x042c, 
+	0xffe4, 0x01a0, 0x0437, 0xffcb, 0x01a8, 0x042c, 0xffe8, 0x01b3, 0x0437, 0xffce, 0x01b7, 0x0429, 0xfff7, 0x019e, 0x0429, 0xfffb, 
+	0x01ad, 0x0437, 0xffff, 0x019d, 0x0437, 0x0001, 0x01ac, 0x043e, 0xffe4, 0x019d, 0x043e, 0xffe9, 0x01b8, 0x12c0, 0x000c, 0x0005, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0430, 0xffd0, 0x01af, 0x0435, 0xfff3, 0x019d, 
+	0x0430, 0xffec, 0x01ae, 0x0437, 0x0001, 0x01ac, 0x0002, 0x0455, 0xffc8, 0x0024, 0x001d, 0x03ec, 0x0002, 0x0000, 0x0024, 0x0014, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x000f, 0x0015, 
+	0x0006, 0x0015, 0x0003, 0x0018, 0x0009, 0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x0012, 0x001e, 
+	0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0449, 0xffda, 0x002a, 0x044c, 0xffdb, 0x001b, 0x044d, 0xffc7, 
+	0x002c, 0x0457, 0xffe2, 0x002d, 0x044a, 0xffb4, 0x0028, 0x044d, 0xffb5, 0x0019, 0x0458, 0xffac, 0x002a, 0x044f, 0xffc8, 0x0018, 
+	0x0459, 0xffe3, 0x001d, 0x045a, 0xffad, 0x001a, 0x045e, 0xffc7, 0x0032, 0x0462, 0xffc8, 0x0017, 0x12c0, 0x0015, 0x000b, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x000c, 0x0009, 0x0006, 0x000f, 0x000f, 
+	0x0009, 0x000c, 0x0012, 0x000f, 0x0012, 0x0454, 0xffb1, 0x001a, 0x0451, 0xffb0, 0x0029, 0x044e, 0xffd1, 0x001a, 0x0462, 0xffc8, 
+	0x0017, 0x0451, 0xffcd, 0x002d, 0x0459, 0xffe3, 0x001d, 0x0457, 0xffe2, 0x002d, 0x0002, 0x04f4, 0x009c, 0xfd41, 0x001c, 0x03f2, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 
+	0x0009, 0x000f, 0x0012, 0x0006, 0x0012, 0x0015, 0x0015, 0x000c, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 0x001b, 0x0006, 0x001e, 
+	0x0009, 0x001e, 0x0018, 0x001e, 0x000c, 0x0021, 0x000f, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x04e8, 0x00af, 0xfd40, 0x04e9, 
+	0x00aa, 0xfd4f, 0x04ed, 0x009e, 0xfd38, 0x04f5, 0x00b8, 0xfd42, 0x04ee, 0x0098, 0xfd4a, 0x04f6, 0x00b3, 0xfd51, 0x04eb, 0x008b, 
+	0xfd34, 0x04ec, 0x0086, 0xfd43, 0x04fa, 0x0085, 0xfd31, 0x04fb, 0x0080, 0xfd40, 0x04fe, 0x00a1, 0xfd33, 0x0500, 0x0098, 0xfd4e, 
+	0x12c0, 0x000f, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0009, 0x000c, 0x04f1, 0x008f, 0xfd34, 0x04f2, 0x008a, 0xfd44, 0x04fe, 0x00a1, 0xfd33, 0x04ef, 0x00b1, 0xfd48, 0x0500, 
+	0x0098, 0xfd4e, 0x0002, 0x03ce, 0x00bd, 0xfc7a, 0x001e, 0x03f3, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 0x0012, 0x0009, 0x0003, 0x0015, 0x0015, 0x000c, 
+	0x000f, 0x0018, 0x0018, 0x0015, 0x0006, 0x001b, 0x0018, 0x001b, 0x001b, 0x000c, 0x0012, 0x001e, 0x001e, 0x0015, 0x0009, 0x0021, 
+	0x001e, 0x0021, 0x0021, 0x000c, 0x03c0, 0x00bf, 0xfc6c, 0x03c2, 0x00ba, 0xfc7d, 0x03c4, 0x00d7, 0xfc7b, 0x03c7, 0x00a3, 0xfc6c, 
+	0x03dc, 0x00bf, 0xfc6f, 0x03c3, 0x00cb, 0xfc85, 0x03c5, 0x00a7, 0xfc7b, 0x03d6, 0x00ba, 0xfc7f, 0x03d2, 0x00cb, 0xfc87, 0x03d4, 
+	0x00d7, 0xfc7d, 0x03d4, 0x00a7, 0xfc7d, 0x03d6, 0x00a3, 0xfc6e, 0x12c0, 0x0009, 0x0003, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x03cd, 0x00b1, 0xfc75, 0x03cc, 0x00d7, 0xfc7c, 0x03cb, 0x00cb, 0xfc86, 0x0002, 0x0254, 0x00a8, 0xfcd3, 0x001d, 0x03f4, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 
+	0x0003, 0x0012, 0x0012, 0x000c, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 
+	0x000f, 0x001e, 0x0012, 0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x0245, 0x00aa, 0xfcd1, 0x024b, 
+	0x008e, 0xfccd, 0x0250, 0x00c2, 0xfcda, 0x0252, 0x00a5, 0xfcdd, 0x025c, 0x00ab, 0xfcc2, 0x0254, 0x0092, 0xfcda, 0x0258, 0x008f, 
+	0xfcc4, 0x0257, 0x00b7, 0xfce3, 0x025d, 0x00c3, 0xfcd1, 0x0262, 0x00a7, 0xfcd2, 0x0261, 0x0093, 0xfcd1, 0x0264, 0x00b8, 0xfcda, 
+	0x12c0, 0x0012, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0x0006, 0x000f, 0x0252, 0x0090, 0xfcce, 0x0251, 0x00a9, 0xfcd0, 0x0261, 0x0093, 0xfcd1, 0x0257, 0x00b7, 
+	0xfce3, 0x0257, 0x00c3, 0xfcd5, 0x0263, 0x00b0, 0xfcd6, 0x0002, 0x0124, 0x0095, 0xfdce, 0x001d, 0x03f5, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0012, 
+	0x000c, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x000f, 0x001e, 0x0012, 
+	0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0x0114, 0x0096, 0xfdce, 0x011a, 0x007b, 0xfdca, 0x0121, 
+	0x00af, 0xfdd5, 0x0122, 0x0092, 0xfdd9, 0x012b, 0x0097, 0xfdbd, 0x0123, 0x007f, 0xfdd6, 0x0127, 0x007b, 0xfdc1, 0x0128, 0x00a4, 
+	0xfdde, 0x012d, 0x00af, 0xfdcc, 0x0132, 0x0093, 0xfdcd, 0x0130, 0x007f, 0xfdcd, 0x0134, 0x00a4, 0xfdd5, 0x12c0, 0x0012, 0x000a, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 
+	0x0009, 0x000f, 0x000c, 0x000f, 0x011a, 0x007b, 0xfdca, 0x0114, 0x0096, 0xfdce, 0x0129, 0x007e, 0xfdcc, 0x012b, 0x0097, 0xfdbd, 
+	0x012a, 0x0093, 0xfdd3, 0x012b, 0x00aa, 0xfdd5, 0x0002, 0xffbd, 0x0095, 0xfe2c, 0x001e, 0x03f6, 0x0002, 0x0000, 0x0024, 0x0014, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0012, 0x000c, 
+	0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x0018, 0x000c, 0x0009, 0x001b, 0x000c, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 
+	0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x0021, 0x001b, 0xffaf, 0x0093, 0xfe2e, 0xffaf, 0x00a4, 0xfe36, 0xffb0, 0x0080, 
+	0xfe2d, 0xffb0, 0x0097, 0xfe1d, 0xffc1, 0x0092, 0xfe35, 0xffb3, 0x00af, 0xfe2c, 0xffbe, 0x00a4, 0xfe3b, 0xffb5, 0x007b, 0xfe1f, 
+	0xffbf, 0x007f, 0xfe32, 0xffcb, 0x0096, 0xfe25, 0xffc2, 0x00af, 0xfe30, 0xffc4, 0x007b, 0xfe24, 0x12c0, 0x0018, 0x000f, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x0003, 0x000f, 0x0006, 
+	0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x0012, 0x000f, 0x0012, 0x0015, 0x000f, 0x0015, 0xffb5, 0x007b, 0xfe1f, 
+	0xffb0, 0x0097, 0xfe1d, 0xffaf, 0x008a, 0xfe2d, 0xffc4, 0x007b, 0xfe24, 0xffbf, 0x007f, 0xfe32, 0xffc6, 0x0094, 0xfe2d, 0xffb5, 
+	0x00a8, 0xfe34, 0xffc2, 0x00af, 0xfe30, 0x0002, 0xfd1b, 0x00c6, 0xfc9e, 0x001e, 0x03fc, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x000c, 0x0006, 0x0003, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000f, 0x001b, 0x001b, 0x0012, 0x0006, 0x001e, 0x0009, 0x001e, 0x001e, 
+	0x0018, 0x0015, 0x0021, 0x001b, 0x0021, 0x0021, 0x0018, 0xfd0d, 0x00b1, 0xfc9f, 0xfd0d, 0x00c5, 0xfca1, 0xfd11, 0x00ad, 0xfc90, 
+	0xfd1d, 0x00b0, 0xfca3, 0xfd0d, 0x00c9, 0xfc8f, 0xfd0e, 0x00d6, 0xfca9, 0xfd1f, 0x00c3, 0xfca6, 0xfd12, 0x00e1, 0xfc9f, 0xfd28, 
+	0x00c7, 0xfc96, 0xfd1d, 0x00d5, 0xfcad, 0xfd20, 0x00ac, 0xfc94, 0xfd21, 0x00e0, 0xfca2, 0x12c0, 0x0018, 0x000f, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0006, 0x000f, 0x0009, 0x000f, 
+	0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0012, 0x0009, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0xfd0f, 0x00af, 0xfc97, 0xfd1d, 
+	0x00b0, 0xfca3, 0xfd0d, 0x00c9, 0xfc8f, 0xfd16, 0x00cd, 0xfca7, 0xfd20, 0x00ac, 0xfc94, 0xfd12, 0x00e1, 0xfc9f, 0xfd28, 0x00c7, 
+	0xfc96, 0xfd21, 0x00e0, 0xfca2, 0x0002, 0xfb9b, 0x00e6, 0xfcc3, 0x001c, 0x03fd, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 0x0012, 0x000c, 0x000f, 0x0015, 
+	0x0012, 0x0015, 0x0006, 0x0018, 0x0009, 0x0018, 0x0006, 0x001b, 0x000c, 0x001b, 0x0015, 0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 
+	0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0xfb8a, 0x00ea, 0xfcc2, 0xfb8c, 0x00ce, 0xfcbe, 0xfb97, 0x00e4, 0xfccd, 0xfb99, 
+	0x0100, 0xfcca, 0xfba1, 0x00e8, 0xfcb2, 0xfb95, 0x00d1, 0xfcca, 0xfb99, 0x00cd, 0xfcb5, 0xfba2, 0x00d0, 0xfcc1, 0xfb9e, 0x00f5, 
+	0xfcd3, 0xfba7, 0x00e3, 0xfcc2, 0xfba6, 0x00ff, 0xfcc1, 0xfbab, 0x00f4, 0xfcca, 0x12c0, 0x0015, 0x000c, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0006, 0x000f, 0x0006, 0x0012, 0x000f, 
+	0x0012, 0x0009, 0x0012, 0x000c, 0x0012, 0xfb92, 0x00ce, 0xfcb9, 0xfb95, 0x00d1, 0xfcca, 0xfb95, 0x00ec, 0xfccb, 0xfba2, 0x00d0, 
+	0xfcc1, 0xfba1, 0x00e8, 0xfcb2, 0xfb99, 0x0100, 0xfcca, 0xfba8, 0x00f2, 0xfcc4, 0x0002, 0xfb3d, 0x00e9, 0xfe2a, 0x001f, 0x03fe, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 
+	0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 0x000c, 0x001b, 0x0015, 0x001b, 
+	0x0012, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xfb2d, 0x00d0, 0xfe21, 0xfb2e, 
+	0x00ec, 0xfe1c, 0xfb30, 0x00d0, 0xfe30, 0xfb3c, 0x00d3, 0xfe1e, 0xfb33, 0x00eb, 0xfe37, 0xfb3f, 0x0103, 0xfe20, 0xfb40, 0x00e6, 
+	0xfe1c, 0xfb3f, 0x00d2, 0xfe2d, 0xfb42, 0x0102, 0xfe2f, 0xfb43, 0x00e5, 0xfe30, 0xfb49, 0x00f7, 0xfe1e, 0xfb4c, 0x00f6, 0xfe2d, 
+	0x12c0, 0x0018, 0x000e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0009, 0x0006, 0x0003, 0x000c, 0x0009, 0x000c, 0x0003, 
+	0x000f, 0x000c, 0x000f, 0x0006, 0x000f, 0x0009, 0x0012, 0x0012, 0x0006, 0x000c, 0x0015, 0x0012, 0x0015, 0x000f, 0x0015, 0xfb3c, 
+	0x00d3, 0xfe1e, 0xfb34, 0x00d1, 0xfe2a, 0xfb44, 0x00ef, 0xfe1d, 0xfb2e, 0x00ec, 0xfe1c, 0xfb33, 0x00eb, 0xfe37, 0xfb47, 0x00ee, 
+	0xfe2e, 0xfb3f, 0x0103, 0xfe20, 0xfb42, 0x0102, 0xfe2f, 0x0002, 0xfba2, 0x00c4, 0xffa7, 0x001f, 0x03ff, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 
+	0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0015, 0x0018, 0x000f, 0x0018, 0x000c, 0x001b, 0x0012, 0x001b, 0x000f, 
+	0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xfb91, 0x00ac, 0xff9d, 0xfb93, 0x00c8, 0xff9a, 0xfb96, 
+	0x00aa, 0xffac, 0xfba0, 0x00af, 0xff99, 0xfb9a, 0x00c5, 0xffb5, 0xfba4, 0x00c2, 0xff99, 0xfba4, 0x00de, 0xff9f, 0xfba4, 0x00ad, 
+	0xffa8, 0xfba9, 0x00bf, 0xffab, 0xfba9, 0x00dc, 0xffae, 0xfbae, 0x00d3, 0xff9a, 0xfbb2, 0x00d0, 0xffa9, 0x12c0, 0x0018, 0x000e, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0009, 0x000f, 
+	0x0006, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0xfb91, 0x00ac, 0xff9d, 0xfb96, 
+	0x00aa, 0xffac, 0xfb93, 0x00c8, 0xff9a, 0xfba0, 0x00af, 0xff99, 0xfb9a, 0x00c5, 0xffb5, 0xfba6, 0x00b6, 0xffa9, 0xfba7, 0x00d1, 
+	0xff9b, 0xfbad, 0x00d6, 0xffab, 0x0002, 0xfc05, 0x0083, 0x011f, 0x001e, 0x0400, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 
+	0x0009, 0x0015, 0x000c, 0x0018, 0x0015, 0x0018, 0x000f, 0x0018, 0x000c, 0x001b, 0x0012, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 
+	0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xfbf4, 0x006c, 0x0114, 0xfbf6, 0x0088, 0x0113, 0xfbf7, 0x0069, 0x0123, 0xfc03, 
+	0x006f, 0x0111, 0xfbfc, 0x0083, 0x012e, 0xfc07, 0x0082, 0x0112, 0xfc08, 0x009e, 0x0119, 0xfc07, 0x006c, 0x0120, 0xfc0b, 0x007e, 
+	0x0125, 0xfc0b, 0x009b, 0x0128, 0xfc11, 0x0092, 0x0115, 0xfc15, 0x008f, 0x0124, 0x12c0, 0x0018, 0x000e, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 
+	0x0012, 0x000f, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0xfbf4, 0x006c, 0x0114, 0xfbf7, 0x0069, 0x0123, 0xfbf6, 
+	0x0088, 0x0113, 0xfc03, 0x006f, 0x0111, 0xfbfc, 0x0083, 0x012e, 0xfc09, 0x0075, 0x0123, 0xfc0b, 0x0091, 0x0115, 0xfc10, 0x0095, 
+	0x0126, 0x0002, 0xfcee, 0x0000, 0x0408, 0x001d, 0x0406, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 
+	0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 
+	0x0021, 0x001e, 0x0021, 0xfcdd, 0xffe9, 0x0400, 0xfcdd, 0x0004, 0x03fd, 0xfce3, 0xffe7, 0x040e, 0xfceb, 0xffec, 0x03fa, 0xfce8, 
+	0x0000, 0x0416, 0xfcee, 0xffff, 0x03fa, 0xfcef, 0x001a, 0x03ff, 0xfcf1, 0xffea, 0x0409, 0xfcf5, 0x0018, 0x040e, 0xfcf6, 0xfffc, 
+	0x040c, 0xfcf8, 0x000e, 0x03fa, 0xfcfe, 0x000c, 0x0408, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 
+	0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0xfcdd, 0xffe9, 
+	0x0400, 0xfcdd, 0x0004, 0x03fd, 0xfcec, 0xfff5, 0x03fa, 0xfcee, 0xffef, 0x040c, 0xfcf3, 0x0014, 0x03fd, 0xfcf4, 0x000c, 0x040f, 
+	0x0002, 0xfd8e, 0xffd3, 0x056f, 0x001f, 0x0407, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 
+	0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 
+	0x001e, 0x0021, 0xfd7d, 0xffba, 0x0568, 0xfd7d, 0xffd6, 0x0565, 0xfd83, 0xffb8, 0x0576, 0xfd8b, 0xffbd, 0x0562, 0xfd88, 0xffd3, 
+	0x057e, 0xfd8e, 0xffd0, 0x0561, 0xfd8e, 0xffed, 0x0566, 0xfd91, 0xffbb, 0x0570, 0xfd95, 0xffeb, 0x0574, 0xfd96, 0xffce, 0x0572, 
+	0xfd97, 0xffe1, 0x0560, 0xfd9e, 0xffdf, 0x056f, 0x12c0, 0x000f, 0x0006, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 
+	0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 0xfd7d, 0xffba, 0x0568, 0xfd7d, 0xffd6, 0x0565, 0xfd8a, 0xffbb, 0x056d, 0xfd92, 0xffd4, 
+	0x0570, 0xfd93, 0xffe8, 0x0569, 0x0002, 0xfe36, 0xffa8, 0x06d3, 0x001f, 0x0408, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 
+	0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 
+	0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xfe25, 0xff8f, 0x06cc, 0xfe25, 0xffac, 0x06c9, 0xfe2b, 0xff8e, 0x06da, 0xfe33, 
+	0xff93, 0x06c6, 0xfe31, 0xffa9, 0x06e2, 0xfe36, 0xffa6, 0x06c5, 0xfe36, 0xffc2, 0x06ca, 0xfe39, 0xff91, 0x06d4, 0xfe3d, 0xffc0, 
+	0x06d8, 0xfe3e, 0xffa4, 0x06d6, 0xfe3f, 0xffb7, 0x06c5, 0xfe46, 0xffb5, 0x06d3, 0x12c0, 0x000f, 0x0007, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 0xfe2f, 0xff90, 0x06d0, 0xfe36, 0xffab, 
+	0x06ca, 0xfe31, 0xffa9, 0x06e2, 0xfe39, 0xffc1, 0x06d1, 0xfe46, 0xffb5, 0x06d3, 0x0002, 0xfed8, 0xff7a, 0x0839, 0x001f, 0x0409, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 
+	0x0009, 0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 
+	0x0015, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xfec7, 0xff61, 0x0832, 0xfec7, 
+	0xff7d, 0x082f, 0xfecd, 0xff5f, 0x0840, 0xfed5, 0xff64, 0x082c, 0xfed3, 0xff7a, 0x0848, 0xfed8, 0xff77, 0x082b, 0xfed9, 0xff94, 
+	0x0831, 0xfedc, 0xff62, 0x083a, 0xfedf, 0xff92, 0x083f, 0xfee0, 0xff75, 0x083d, 0xfee2, 0xff88, 0x082b, 0xfee8, 0xff86, 0x0839, 
+	0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0xfecd, 0xff5f, 0x0840, 0xfed1, 0xff6c, 0x0830, 0xfed3, 0xff7a, 0x0848, 
+	0xfedc, 0xff93, 0x0838, 0xfee0, 0xff75, 0x083d, 0xfee5, 0xff87, 0x0832, 0x0002, 0xff72, 0xff41, 0x09a1, 0x001e, 0x040a, 0x0002, 
+	0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0003, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 
+	0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0xff61, 0xff29, 0x0999, 0xff62, 0xff45, 
+	0x0997, 0xff67, 0xff26, 0x09a7, 0xff6f, 0xff2c, 0x0994, 0xff6c, 0xff41, 0x09b0, 0xff72, 0xff3f, 0x0993, 0xff73, 0xff5b, 0x099a, 
+	0xff75, 0xff2a, 0x09a2, 0xff79, 0xff59, 0x09a8, 0xff7a, 0xff3c, 0x09a5, 0xff7c, 0xff50, 0x0994, 0xff82, 0xff4d, 0x09a3, 0x12c0, 
+	0x000f, 0x0007, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 
+	0xff6b, 0xff31, 0x0995, 0xff72, 0xff2f, 0x09a5, 0xff70, 0xff50, 0x0997, 0xff72, 0xff4d, 0x09ac, 0xff82, 0xff4d, 0x09a3, 0x0002, 
+	0x0103, 0xfeac, 0x0c2d, 0x001c, 0x0410, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 
+	0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 0x0009, 
+	0x0018, 0x0006, 0x001b, 0x000c, 0x001b, 0x0015, 0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 
+	0x0021, 0x00f2, 0xfeb0, 0x0c2d, 0x00f4, 0xfe94, 0x0c2c, 0x00ff, 0xfeac, 0x0c21, 0x0102, 0xfec7, 0x0c29, 0x0109, 0xfeab, 0x0c3c, 
+	0x00fd, 0xfe98, 0x0c20, 0x0100, 0xfe91, 0x0c35, 0x010a, 0xfe95, 0x0c29, 0x0107, 0xfebd, 0x0c1e, 0x010f, 0xfea8, 0x0c2b, 0x010f, 
+	0xfec4, 0x0c31, 0x0114, 0xfeba, 0x0c27, 0x12c0, 0x0012, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0x00f9, 0xfe96, 0x0c26, 0x00f9, 0xfeae, 0x0c27, 
+	0x0105, 0xfe93, 0x0c2f, 0x0107, 0xfebd, 0x0c1e, 0x010f, 0xfeaf, 0x0c2f, 0x0109, 0xfec5, 0x0c2d, 0x0002, 0x027a, 0xfe77, 0x0c57, 
+	0x001d, 0x0411, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 
+	0x000f, 0x0006, 0x0003, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x000c, 0x0018, 0x0018, 0x0012, 0x000f, 0x001b, 
+	0x0012, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x0021, 0x001b, 0x026c, 0xfe63, 
+	0x0c53, 0x026c, 0xfe76, 0x0c54, 0x0271, 0xfe5c, 0x0c60, 0x027b, 0xfe62, 0x0c4d, 0x026e, 0xfe89, 0x0c4f, 0x026f, 0xfe78, 0x0c66, 
+	0x027f, 0xfe75, 0x0c4d, 0x0273, 0xfe92, 0x0c5b, 0x027c, 0xfe88, 0x0c49, 0x0289, 0xfe76, 0x0c5d, 0x0280, 0xfe5b, 0x0c5b, 0x0281, 
+	0xfe91, 0x0c55, 0x12c0, 0x0015, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0009, 0x000f, 0x000c, 0x0012, 0x000f, 0x0012, 0x0271, 0xfe5c, 0x0c60, 
+	0x0275, 0xfe6c, 0x0c50, 0x026f, 0xfe78, 0x0c66, 0x0280, 0xfe5b, 0x0c5b, 0x0274, 0xfe8c, 0x0c51, 0x0289, 0xfe76, 0x0c5d, 0x0281, 
+	0xfe91, 0x0c55, 0x0002, 0x039b, 0xfe72, 0x0b59, 0x001d, 0x0412, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x000c, 0x0003, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x0006, 0x0015, 0x000f, 0x0015, 0x0003, 0x0018, 
+	0x0009, 0x0018, 0x0012, 0x0018, 0x0006, 0x001b, 0x0009, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0015, 0x0021, 0x0018, 0x0021, 
+	0x001b, 0x0021, 0x001e, 0x0021, 0x038c, 0xfe84, 0x0b58, 0x038f, 0xfe71, 0x0b5b, 0x0394, 0xfe84, 0x0b4a, 0x0397, 0xfe8c, 0x0b5f, 
+	0x038f, 0xfe5e, 0x0b58, 0x0397, 0xfe5e, 0x0b4b, 0x039b, 0xfe57, 0x0b5f, 0x0399, 0xfe71, 0x0b4a, 0x039c, 0xfe72, 0x0b68, 0x039f, 
+	0xfe8d, 0x0b51, 0x03a3, 0xfe57, 0x0b52, 0x03aa, 0xfe73, 0x0b50, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x000c, 0x000f, 0x0009, 0x000f, 0x0396, 
+	0xfe5c, 0x0b56, 0x0394, 0xfe71, 0x0b53, 0x039c, 0xfe72, 0x0b68, 0x03a3, 0xfe57, 0x0b52, 0x0396, 0xfe88, 0x0b55, 0x03aa, 0xfe73, 
+	0x0b50, 0x0002, 0x041d, 0xfe85, 0x09e5, 0x001d, 0x0413, 0x0001, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x000c, 0x0006, 0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x0006, 0x0015, 0x000f, 0x0015, 0x0003, 0x0018, 0x0009, 
+	0x0018, 0x0006, 0x001b, 0x0009, 0x001b, 0x0012, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0015, 0x0021, 0x0018, 0x0021, 0x001e, 
+	0x0021, 0x001b, 0x0021, 0x0410, 0xfe96, 0x09ea, 0x0413, 0xfe97, 0x09db, 0x0414, 0xfe83, 0x09eb, 0x041c, 0xfe9f, 0x09ed, 0x0413, 
+	0xfe70, 0x09e8, 0x0416, 0xfe71, 0x09d9, 0x0421, 0xfe69, 0x09ea, 0x0418, 0xfe84, 0x09d8, 0x041f, 0xfea0, 0x09dd, 0x0425, 0xfe84, 
+	0x09f3, 0x0424, 0xfe6a, 0x09db, 0x042a, 0xfe86, 0x09d8, 0x0002, 0x0440, 0xfea2, 0x085b, 0x001c, 0x0414, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 
+	0x0006, 0x0012, 0x0015, 0x0015, 0x000c, 0x0012, 0x0018, 0x0015, 0x001b, 0x0018, 0x001b, 0x0006, 0x001e, 0x0009, 0x001e, 0x0018, 
+	0x001e, 0x000c, 0x0021, 0x000f, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0435, 0xfeb3, 0x0864, 0x0435, 0xfeb4, 0x0854, 0x043a, 
+	0xfea0, 0x0864, 0x0442, 0xfebc, 0x0865, 0x043a, 0xfea2, 0x0851, 0x0442, 0xfebd, 0x0855, 0x0439, 0xfe8d, 0x0860, 0x0439, 0xfe8e, 
+	0x0851, 0x0447, 0xfe87, 0x0860, 0x0447, 0xfe88, 0x0851, 0x044c, 0xfea1, 0x0869, 0x044c, 0xfea4, 0x084d, 0x12c0, 0x0018, 0x000c, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 
+	0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0439, 0xfe8e, 0x0851, 0x0439, 0xfe8d, 0x0860, 0x0438, 0xfeab, 
+	0x0853, 0x0447, 0xfe88, 0x0851, 0x0438, 0xfea9, 0x0864, 0x0447, 0xfe87, 0x0860, 0x0447, 0xfeb0, 0x0851, 0x0447, 0xfeae, 0x0867, 
+	0x0002, 0x0437, 0xfec9, 0x06d0, 0x001d, 0x0415, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 0x0006, 0x0012, 0x0015, 0x0015, 0x000c, 0x0012, 0x0018, 
+	0x0015, 0x001b, 0x001b, 0x0018, 0x0006, 0x001e, 0x0009, 0x001e, 0x0018, 0x001e, 0x000c, 0x0021, 0x000f, 0x0021, 0x001b, 0x0021, 
+	0x001e, 0x0021, 0x042c, 0xfedb, 0x06cb, 0x042d, 0xfed9, 0x06db, 0x0430, 0xfec9, 0x06c7, 0x0438, 0xfee4, 0x06cc, 0x0431, 0xfec7, 
+	0x06db, 0x0439, 0xfee2, 0x06db, 0x042f, 0xfeb6, 0x06c7, 0x0430, 0xfeb4, 0x06d7, 0x043e, 0xfeaf, 0x06c5, 0x043e, 0xfeae, 0x06d5, 
+	0x0442, 0xfecb, 0x06c2, 0x0443, 0xfec8, 0x06de, 0x12c0, 0x000c, 0x0005, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 
+	0x0009, 0x0009, 0x0006, 0x0437, 0xfeb2, 0x06ce, 0x042f, 0xfed1, 0x06d2, 0x0443, 0xfec9, 0x06d0, 0x0439, 0xfee3, 0x06d4, 0x0002, 
+	0x041b, 0xfefe, 0x0548, 0x001d, 0x0416, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 0x0006, 0x0012, 0x0015, 0x0015, 0x000c, 0x0012, 0x0018, 0x0006, 
+	0x001b, 0x0009, 0x001b, 0x0018, 0x001b, 0x0015, 0x001e, 0x0018, 0x001e, 0x000c, 0x0021, 0x000f, 0x0021, 0x001e, 0x0021, 0x001b, 
+	0x0021, 0x040f, 0xff10, 0x0545, 0x0410, 0xff0e, 0x0555, 0x0413, 0xfefe, 0x0540, 0x041b, 0xff19, 0x0546, 0x0415, 0xfefb, 0x0553, 
+	0x041d, 0xff17, 0x0555, 0x0412, 0xfeeb, 0x053f, 0x0414, 0xfee8, 0x054f, 0x0420, 0xfee5, 0x053d, 0x0425, 0xff01, 0x053b, 0x0422, 
+	0xfee2, 0x054c, 0x0427, 0xfefc, 0x0556, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 
+	0x0009, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x000f, 0x000c, 0x000f, 0x0412, 0xfeeb, 0x053f, 0x0414, 
+	0xfef6, 0x054b, 0x0420, 0xfee5, 0x053d, 0x0416, 0xff13, 0x054d, 0x0425, 0xfeef, 0x0551, 0x0425, 0xff01, 0x053b, 0x0002, 0x03eb, 
+	0xff4a, 0x03c7, 0x001c, 0x0417, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x000c, 0x0006, 
+	0x000c, 0x000f, 0x000c, 0x0012, 0x0003, 0x0015, 0x0006, 0x0015, 0x000f, 0x0015, 0x0003, 0x0018, 0x0009, 0x0018, 0x0006, 0x001b, 
+	0x0009, 0x001b, 0x0012, 0x001b, 0x000f, 0x001e, 0x0012, 0x001e, 0x0015, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 
+	0x03de, 0xff5c, 0x03c7, 0x03e1, 0xff58, 0x03d6, 0x03e2, 0xff4a, 0x03c0, 0x03ea, 0xff65, 0x03c7, 0x03e1, 0xff37, 0x03be, 0x03e4, 
+	0xff34, 0x03cd, 0x03ef, 0xff31, 0x03b9, 0x03e6, 0xff46, 0x03d3, 0x03ed, 0xff62, 0x03d6, 0x03f2, 0xff4e, 0x03b9, 0x03f2, 0xff2e, 
+	0x03c8, 0x03f8, 0xff47, 0x03d3, 0x12c0, 0x0012, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0009, 0x0003, 0x0009, 
+	0x000c, 0x000c, 0x0003, 0x0009, 0x000f, 0x000f, 0x0003, 0x000f, 0x0006, 0x03de, 0xff5c, 0x03c7, 0x03e8, 0xff4c, 0x03cf, 0x03ec, 
+	0xff63, 0x03cf, 0x03e8, 0xff34, 0x03bc, 0x03eb, 0xff31, 0x03cb, 0x03f2, 0xff4e, 0x03b9, 0x0002, 0x01ae, 0xffa5, 0x0210, 0x001d, 
+	0x041a, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 
+	0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x0018, 0x000c, 0x0009, 0x001b, 0x001b, 
+	0x000c, 0x000f, 0x001e, 0x0018, 0x001e, 0x001e, 0x0015, 0x0012, 0x0021, 0x001b, 0x0021, 0x0021, 0x0015, 0x01a1, 0xffa2, 0x0213, 
+	0x01a1, 0xffa7, 0x0201, 0x01a2, 0xffb3, 0x021c, 0x01a4, 0xff8f, 0x0210, 0x01b5, 0xffa2, 0x0217, 0x01a4, 0xffbf, 0x0211, 0x01a7, 
+	0xff8c, 0x0201, 0x01bc, 0xffa7, 0x0207, 0x01b1, 0xffb3, 0x021f, 0x01b3, 0xff8f, 0x0214, 0x01b3, 0xffbf, 0x0215, 0x01b6, 0xff8b, 
+	0x0205, 0x12c0, 0x0006, 0x0001, 0x0000, 0x0003, 0x01ad, 0xff8d, 0x020b, 0x01ac, 0xffaf, 0x0212, 0x0002, 0x0029, 0xffad, 0x01c8, 
+	0x001e, 0x041b, 0x0001, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 
+	0x000f, 0x0009, 0x0003, 0x0012, 0x0012, 0x0006, 0x0003, 0x0015, 0x0015, 0x000c, 0x000f, 0x0018, 0x0018, 0x0015, 0x0012, 0x001b, 
+	0x001b, 0x0015, 0x0006, 0x001e, 0x001b, 0x001e, 0x001e, 0x000c, 0x0009, 0x0021, 0x0018, 0x0021, 0x0021, 0x000c, 0x001b, 0xffaf, 
+	0x01ba, 0x001c, 0xffaa, 0x01cc, 0x001f, 0xffc6, 0x01ca, 0x0021, 0xff93, 0x01ba, 0x0037, 0xffae, 0x01be, 0x001e, 0xff97, 0x01c9, 
+	0x001e, 0xffbb, 0x01d4, 0x0030, 0xffa9, 0x01cf, 0x002e, 0xff96, 0x01cb, 0x002d, 0xffba, 0x01d7, 0x002f, 0xffc6, 0x01cc, 0x0030, 
+	0xff93, 0x01bc, 0x0002, 0xfea0, 0xffb9, 0x019c, 0x001e, 0x041c, 0x0001, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0012, 0x0009, 0x0003, 0x0015, 0x0015, 0x000c, 
+	0x0006, 0x0018, 0x0018, 0x000c, 0x000f, 0x001b, 0x001b, 0x0018, 0x001b, 0x0015, 0x0012, 0x001e, 0x001e, 0x0015, 0x0009, 0x0021, 
+	0x001e, 0x0021, 0x0021, 0x000c, 0xfe92, 0xffbb, 0x018f, 0xfe95, 0xffb5, 0x01a0, 0xfe97, 0xff9f, 0x018e, 0xfe98, 0xffd2, 0x019f, 
+	0xfead, 0xffba, 0x0191, 0xfe97, 0xffa2, 0x019e, 0xfe97, 0xffc6, 0x01a9, 0xfea8, 0xffb5, 0x01a1, 0xfea7, 0xff9f, 0x018f, 0xfea6, 
+	0xffa2, 0x019e, 0xfea6, 0xffc6, 0x01aa, 0xfea7, 0xffd2, 0x019f, 0x0002, 0xfd19, 0xffad, 0x01d0, 0x001d, 0x041d, 0x0002, 0x0000, 
+	0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 
+	0x0012, 0x000c, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x0018, 0x000c, 0x0009, 0x001b, 0x000c, 0x001b, 0x000f, 0x001e, 
+	0x0012, 0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0xfd0a, 0xffad, 0x01cc, 0xfd12, 0xff93, 0x01c7, 
+	0xfd13, 0xffc6, 0x01d8, 0xfd15, 0xffa9, 0x01d9, 0xfd23, 0xffb1, 0x01c0, 0xfd18, 0xff96, 0x01d5, 0xfd20, 0xff94, 0x01c1, 0xfd19, 
+	0xffba, 0x01e1, 0xfd21, 0xffc7, 0x01d1, 0xfd27, 0xffab, 0x01d1, 0xfd26, 0xff98, 0x01cf, 0xfd27, 0xffbc, 0x01da, 0x12c0, 0x0015, 
+	0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 
+	0x000f, 0x000c, 0x0012, 0x000f, 0x0012, 0xfd15, 0xff94, 0x01ce, 0xfd0f, 0xffab, 0x01d3, 0xfd23, 0xff96, 0x01c8, 0xfd19, 0xffba, 
+	0x01e1, 0xfd13, 0xffc6, 0x01d8, 0xfd26, 0xffb3, 0x01ce, 0xfd21, 0xffc7, 0x01d1, 0x0002, 0xfc04, 0xfeec, 0x0475, 0x001c, 0x0424, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 
+	0x0003, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x0018, 0x001b, 
+	0x0015, 0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x001e, 0x0021, 0xfbf8, 0xfee9, 0x0482, 0xfbfc, 
+	0xfef0, 0x0467, 0xfbff, 0xfed0, 0x0476, 0xfc01, 0xff04, 0x0483, 0xfc0a, 0xfee9, 0x0480, 0xfc01, 0xfed4, 0x0467, 0xfc03, 0xff08, 
+	0x0473, 0xfc0d, 0xfeee, 0x046d, 0xfc0d, 0xfed7, 0x047a, 0xfc0f, 0xfeda, 0x046b, 0xfc0e, 0xfefc, 0x0483, 0xfc10, 0xfeff, 0x0473, 
+	0x12c0, 0x0018, 0x000e, 0x0000, 0x0003, 0x0000, 0x0006, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0x0003, 0x0012, 0x0006, 0x0012, 0x000c, 0x0012, 0x0003, 0x0015, 0x0012, 0x0015, 0x000f, 0x0015, 0xfbff, 
+	0xfed0, 0x0476, 0xfbf8, 0xfee9, 0x0482, 0xfc0a, 0xfed7, 0x046f, 0xfbfc, 0xfef0, 0x0467, 0xfc0e, 0xfef6, 0x0470, 0xfc03, 0xff08, 
+	0x0473, 0xfc0c, 0xfef2, 0x0482, 0xfc01, 0xff04, 0x0483, 0x0002, 0xfbbe, 0xfea9, 0x05f3, 0x001d, 0x0425, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 
+	0x0012, 0x0003, 0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x000f, 0x001e, 0x0018, 
+	0x001e, 0x0015, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x001b, 0x0021, 0xfbb1, 0xfea7, 0x0600, 0xfbb7, 0xfeaa, 0x05e5, 0xfbb8, 
+	0xfe8d, 0x05f8, 0xfbbb, 0xfec2, 0x05ff, 0xfbc3, 0xfea6, 0x0600, 0xfbbc, 0xfe8f, 0x05e9, 0xfbbe, 0xfec4, 0x05f0, 0xfbc8, 0xfea9, 
+	0x05ed, 0xfbc6, 0xfe93, 0x05fc, 0xfbc8, 0xfeb9, 0x0601, 0xfbc9, 0xfe95, 0x05ed, 0xfbcb, 0xfebb, 0x05f2, 0x12c0, 0x0015, 0x000d, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 
+	0x0009, 0x000f, 0x0006, 0x0012, 0x000c, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0xfbba, 0xfe8e, 0x05f1, 0xfbb7, 0xfeaa, 0x05e5, 
+	0xfbb1, 0xfea7, 0x0600, 0xfbc7, 0xfe94, 0x05f5, 0xfbbc, 0xfec3, 0x05f8, 0xfbc9, 0xfeb2, 0x05f0, 0xfbc5, 0xfeaf, 0x0601, 0x0002, 
+	0xfb5e, 0xfe8f, 0x0771, 0x001d, 0x0426, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 
+	0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x000c, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x000c, 
+	0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0018, 0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 0x0015, 0x0021, 0x0018, 0x0021, 0x001e, 
+	0x0021, 0xfb51, 0xfe8f, 0x077f, 0xfb57, 0xfe74, 0x0779, 0xfb57, 0xfe90, 0x0763, 0xfb5b, 0xfea9, 0x077b, 0xfb63, 0xfe8e, 0x077e, 
+	0xfb5b, 0xfe74, 0x076a, 0xfb65, 0xfe7b, 0x077d, 0xfb5f, 0xfeaa, 0x076c, 0xfb67, 0xfe8e, 0x076b, 0xfb68, 0xfe7b, 0x076d, 0xfb68, 
+	0xfea1, 0x077e, 0xfb6b, 0xfea1, 0x076f, 0x12c0, 0x0012, 0x0007, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0xfb59, 0xfe74, 0x0772, 0xfb54, 0xfe8f, 0x0771, 0xfb66, 0xfe7b, 0x0775, 0xfb5d, 
+	0xfea9, 0x0774, 0xfb65, 0xfe8e, 0x0775, 0xfb69, 0xfea1, 0x0777, 0x0002, 0xfb62, 0xfe99, 0x08f8, 0x001c, 0x0427, 0x0002, 0x0000, 
+	0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 
+	0x000c, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x000f, 0x001e, 
+	0x0012, 0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 0x001b, 0x0021, 0xfb53, 0xfe99, 0x08ef, 0xfb5a, 0xfe7e, 0x08f3, 
+	0xfb5e, 0xfeb3, 0x08ef, 0xfb60, 0xfe9a, 0x0908, 0xfb64, 0xfe97, 0x08ea, 0xfb61, 0xfe7e, 0x0901, 0xfb67, 0xfe84, 0x08ec, 0xfb65, 
+	0xfeb4, 0x08fd, 0xfb69, 0xfeaa, 0x08e9, 0xfb6e, 0xfe98, 0x08fc, 0xfb6e, 0xfe85, 0x08fa, 0xfb71, 0xfeaa, 0x08f7, 0x12c0, 0x0015, 
+	0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 
+	0x000f, 0x0009, 0x000f, 0x000c, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0xfb5a, 0xfe7e, 0x08f3, 0xfb53, 0xfe99, 0x08ef, 0xfb61, 
+	0xfe7e, 0x0901, 0xfb6a, 0xfe8e, 0x08f3, 0xfb5e, 0xfeb3, 0x08ef, 0xfb60, 0xfe9a, 0x0908, 0xfb6a, 0xfead, 0x08f4, 0x0002, 0xfcba, 
+	0xfe91, 0x0988, 0x001c, 0x0428, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 
+	0x000f, 0x0003, 0x000f, 0x0006, 0x000f, 0x0012, 0x0003, 0x0015, 0x0015, 0x0009, 0x0003, 0x0018, 0x0012, 0x0018, 0x0018, 0x000c, 
+	0x0006, 0x001b, 0x001b, 0x0012, 0x001b, 0x000c, 0x0015, 0x001e, 0x0018, 0x001e, 0x0009, 0x0021, 0x001e, 0x0021, 0x0021, 0x000c, 
+	0xfcac, 0xfe93, 0x0994, 0xfcaf, 0xfe91, 0x0982, 0xfcb0, 0xfe77, 0x098f, 0xfcb3, 0xfeac, 0x0989, 0xfcc8, 0xfe91, 0x0992, 0xfcaf, 
+	0xfe7d, 0x0981, 0xfcbf, 0xfe7c, 0x0980, 0xfcb2, 0xfea3, 0x097d, 0xfcc2, 0xfe8f, 0x0981, 0xfcbf, 0xfe76, 0x098e, 0xfcc2, 0xfea2, 
+	0x097c, 0xfcc3, 0xfeab, 0x0989, 0x12c0, 0x0015, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 0x0009, 0x0003, 
+	0x000c, 0x0009, 0x000c, 0x0009, 0x000f, 0x0006, 0x000f, 0x000c, 0x0012, 0x0006, 0x0012, 0x000f, 0x0012, 0xfcb7, 0xfe79, 0x0988, 
+	0xfcad, 0xfe92, 0x098b, 0xfcc5, 0xfe90, 0x098a, 0xfcb2, 0xfea3, 0x097d, 0xfcb3, 0xfeac, 0x0989, 0xfcc2, 0xfea2, 0x097c, 0xfcc3, 
+	0xfeab, 0x0989, 0x0002, 0xffcc, 0xfe7b, 0x093e, 0x001d, 0x042f, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 0x0009, 0x0003, 0x0012, 0x0012, 0x0006, 0x0003, 0x0015, 0x0015, 0x000c, 
+	0x000f, 0x0018, 0x0018, 0x0015, 0x0012, 0x001b, 0x001b, 0x0015, 0x0006, 0x001e, 0x001b, 0x001e, 0x001e, 0x000c, 0x0009, 0x0021, 
+	0x0021, 0x0018, 0x0021, 0x000c, 0xffbe, 0xfe7b, 0x094a, 0xffc2, 0xfe79, 0x0938, 0xffc4, 0xfe95, 0x0940, 0xffc5, 0xfe60, 0x0945, 
+	0xffda, 0xfe7b, 0x0949, 0xffc4, 0xfe66, 0x0937, 0xffc4, 0xfe8c, 0x0933, 0xffd6, 0xfe7a, 0x0938, 0xffd4, 0xfe66, 0x0936, 0xffd4, 
+	0xfe8c, 0x0933, 0xffd4, 0xfe95, 0x0940, 0xffd4, 0xfe60, 0x0945, 0x12c0, 0x000f, 0x0007, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x000c, 0x0009, 0xffbe, 0xfe7b, 0x094a, 0xffcc, 0xfe70, 0x0937, 0xffd1, 
+	0xfe69, 0x0946, 0xffcc, 0xfe95, 0x0940, 0xffcc, 0xfe8c, 0x0933, 0x0002, 0x0155, 0xfe82, 0x094f, 0x001d, 0x0430, 0x0002, 0x0000, 
+	0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 
+	0x0006, 0x0012, 0x0003, 0x0015, 0x0015, 0x000c, 0x0006, 0x0018, 0x0018, 0x000c, 0x0009, 0x001b, 0x001b, 0x000c, 0x000f, 0x001e, 
+	0x001b, 0x001e, 0x001e, 0x0015, 0x0012, 0x0021, 0x0018, 0x0021, 0x0021, 0x0015, 0x0147, 0xfe82, 0x0959, 0x014d, 0xfe80, 0x0948, 
+	0x014e, 0xfe67, 0x0955, 0x014e, 0xfe9c, 0x0950, 0x0163, 0xfe83, 0x095c, 0x014f, 0xfe93, 0x0943, 0x0150, 0xfe6d, 0x0947, 0x0161, 
+	0xfe81, 0x094a, 0x015e, 0xfe67, 0x0957, 0x015d, 0xfe9d, 0x0952, 0x015f, 0xfe93, 0x0945, 0x015f, 0xfe6e, 0x0949, 0x12c0, 0x0009, 
+	0x0003, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0157, 0xfe6a, 0x094f, 0x0152, 0xfe90, 0x094d, 0x0162, 0xfe82, 0x0953, 
+	0x0002, 0x02d9, 0xfe8d, 0x0995, 0x001c, 0x0431, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0003, 0x0012, 0x0012, 0x000c, 0x0006, 0x0015, 0x0009, 0x0015, 0x0006, 0x0018, 
+	0x0018, 0x000c, 0x0009, 0x001b, 0x001b, 0x000c, 0x000f, 0x001e, 0x0012, 0x001e, 0x001e, 0x001b, 0x0015, 0x0021, 0x0018, 0x0021, 
+	0x0021, 0x001b, 0x02cc, 0xfe8d, 0x099c, 0x02d3, 0xfea8, 0x0994, 0x02d4, 0xfe72, 0x0999, 0x02d4, 0xfe8c, 0x098c, 0x02e7, 0xfe8f, 
+	0x09a2, 0x02d6, 0xfe9f, 0x0988, 0x02e2, 0xfea8, 0x0997, 0x02d7, 0xfe79, 0x098b, 0x02e3, 0xfe73, 0x099d, 0x02e7, 0xfe8d, 0x0990, 
+	0x02e5, 0xfe9f, 0x098b, 0x02e6, 0xfe7a, 0x098f, 0x12c0, 0x0015, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x000c, 0x000f, 0x0009, 0x0012, 0x000c, 0x0012, 0x000f, 0x0012, 0x02d6, 
+	0xfe75, 0x0992, 0x02d2, 0xfe93, 0x0990, 0x02e5, 0xfe76, 0x0996, 0x02d3, 0xfea8, 0x0994, 0x02e6, 0xfe96, 0x098e, 0x02e7, 0xfe8f, 
+	0x09a2, 0x02e2, 0xfea8, 0x0997, 0x0002, 0x0461, 0xfeb1, 0x09af, 0x001d, 0x0432, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 
+	0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 
+	0x0018, 0x0021, 0x001e, 0x0021, 0x0021, 0x001b, 0x0453, 0xfec0, 0x09a6, 0x0455, 0xfec9, 0x09b2, 0x0456, 0xfead, 0x09ab, 0x0462, 
+	0xfec2, 0x09a2, 0x0456, 0xfeaf, 0x09bd, 0x0464, 0xfecc, 0x09ae, 0x045a, 0xfe9b, 0x09aa, 0x0468, 0xfeb1, 0x09a6, 0x045f, 0xfe95, 
+	0x09b7, 0x0470, 0xfeb4, 0x09b6, 0x0469, 0xfe9d, 0x09a5, 0x046e, 0xfe98, 0x09b3, 0x12c0, 0x0012, 0x0007, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0003, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000f, 0x000c, 0x000f, 0x045d, 0xfe98, 0x09b1, 0x0456, 0xfeae, 
+	0x09b4, 0x046c, 0xfe9a, 0x09ac, 0x0454, 0xfec4, 0x09ac, 0x046c, 0xfeb2, 0x09ae, 0x0463, 0xfec7, 0x09a8, 0x0002, 0x0544, 0xff1a, 
+	0x08a1, 0x001f, 0x0433, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 
+	0x0018, 0x000f, 0x001b, 0x0018, 0x001b, 0x0018, 0x001e, 0x0012, 0x001e, 0x001b, 0x0021, 0x0015, 0x0021, 0x001e, 0x0021, 0x0533, 
+	0xff21, 0x08aa, 0x0535, 0xff26, 0x089b, 0x053b, 0xff2e, 0x08af, 0x053f, 0xff12, 0x08a8, 0x053d, 0xff33, 0x08a0, 0x0540, 0xff18, 
+	0x0895, 0x054e, 0xff18, 0x08b0, 0x0550, 0xff21, 0x0896, 0x0545, 0xff01, 0x08a1, 0x0547, 0xff06, 0x0892, 0x0555, 0xff00, 0x08a2, 
+	0x0556, 0xff06, 0x0893, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 
+	0x000c, 0x0003, 0x000c, 0x0006, 0x0003, 0x000f, 0x0006, 0x000f, 0x0009, 0x000f, 0x053f, 0xff12, 0x08a8, 0x0539, 0xff2b, 0x08a8, 
+	0x054a, 0xff0c, 0x0893, 0x054d, 0xff08, 0x08a6, 0x0535, 0xff26, 0x089b, 0x0550, 0xff21, 0x0896, 0x0002, 0x0409, 0x001e, 0x060d, 
+	0x001c, 0x0438, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 
+	0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 
+	0x000f, 0x001b, 0x0015, 0x001e, 0x000f, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x03f8, 0x0028, 
+	0x0617, 0x03ff, 0x001d, 0x0609, 0x03ff, 0x0036, 0x0618, 0x0401, 0x0022, 0x0623, 0x0405, 0x000d, 0x0600, 0x040a, 0x0029, 0x0601, 
+	0x040b, 0x0016, 0x0618, 0x0408, 0x0030, 0x0623, 0x040e, 0x0007, 0x060c, 0x0412, 0x0010, 0x05f7, 0x041a, 0x0020, 0x0616, 0x041b, 
+	0x000a, 0x0603, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x0006, 0x000f, 0x0009, 0x03ff, 0x001d, 0x0609, 0x03fc, 0x002f, 0x0618, 0x040e, 
+	0x000d, 0x060a, 0x0412, 0x0025, 0x060c, 0x0405, 0x0029, 0x0623, 0x0412, 0x0010, 0x05f7, 0x0002, 0x031f, 0x00aa, 0x04ed, 0x001d, 
+	0x0439, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 0x0003, 
+	0x000f, 0x0006, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0012, 0x0018, 0x0015, 0x0018, 0x0012, 0x001b, 0x000f, 
+	0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x0021, 0x001e, 0x030e, 0x00b3, 0x04f8, 
+	0x0315, 0x00c1, 0x04f9, 0x0316, 0x00a8, 0x04ea, 0x0317, 0x00ad, 0x0503, 0x031f, 0x00bb, 0x0504, 0x0320, 0x00b5, 0x04e1, 0x031b, 
+	0x0098, 0x04e0, 0x0321, 0x00a1, 0x04f8, 0x0324, 0x0093, 0x04eb, 0x0328, 0x009b, 0x04d7, 0x0331, 0x00aa, 0x04f6, 0x0331, 0x0095, 
+	0x04e2, 0x12c0, 0x0015, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 
+	0x000c, 0x000f, 0x0003, 0x0012, 0x000c, 0x0012, 0x000f, 0x0012, 0x0006, 0x0012, 0x0009, 0x0012, 0x031b, 0x0098, 0x04e0, 0x0312, 
+	0x00ae, 0x04f1, 0x0328, 0x009b, 0x04d7, 0x032b, 0x0094, 0x04e7, 0x031b, 0x00b4, 0x0504, 0x0315, 0x00c1, 0x04f9, 0x0326, 0x00ab, 
+	0x04f0, 0x0002, 0x0231, 0x0137, 0x03d2, 0x001d, 0x043a, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 
+	0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x000f, 0x001e, 0x0015, 0x001e, 0x0012, 0x001e, 0x0018, 0x0021, 0x001b, 
+	0x0021, 0x001e, 0x0021, 0x0220, 0x0140, 0x03de, 0x0227, 0x0135, 0x03cf, 0x0227, 0x014e, 0x03de, 0x022a, 0x013b, 0x03e9, 0x022d, 
+	0x0126, 0x03c5, 0x0231, 0x0142, 0x03c7, 0x0233, 0x012f, 0x03dd, 0x0231, 0x0149, 0x03e9, 0x0236, 0x0120, 0x03d1, 0x0239, 0x0129, 
+	0x03bc, 0x0242, 0x0138, 0x03da, 0x0243, 0x0123, 0x03c7, 0x12c0, 0x0012, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x000c, 0x0006, 0x000c, 0x000f, 0x0006, 0x000f, 0x000f, 0x0009, 
+	0x0239, 0x0129, 0x03bc, 0x022f, 0x012b, 0x03d1, 0x0228, 0x0145, 0x03d6, 0x0243, 0x012e, 0x03d1, 0x022a, 0x013b, 0x03e9, 0x0231, 
+	0x0149, 0x03e9, 0x0002, 0x0129, 0x01ab, 0x02c4, 0x001d, 0x043b, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 
+	0x0012, 0x0018, 0x0015, 0x0018, 0x0012, 0x001b, 0x000c, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 
+	0x001b, 0x0021, 0x0021, 0x001e, 0x0118, 0x01b3, 0x02d0, 0x011d, 0x01c2, 0x02d0, 0x011f, 0x01a9, 0x02c2, 0x0123, 0x01b0, 0x02db, 
+	0x0126, 0x01b6, 0x02b8, 0x0129, 0x01bf, 0x02da, 0x0125, 0x0199, 0x02b9, 0x012d, 0x01a4, 0x02cf, 0x0130, 0x0195, 0x02c3, 0x0130, 
+	0x019d, 0x02ae, 0x013b, 0x01af, 0x02ca, 0x013b, 0x0199, 0x02b8, 0x12c0, 0x0012, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0006, 0x000f, 0x000f, 
+	0x000c, 0x011c, 0x01ae, 0x02c9, 0x011d, 0x01c2, 0x02d0, 0x0130, 0x019a, 0x02b5, 0x0126, 0x01b6, 0x02b8, 0x012d, 0x01b1, 0x02d4, 
+	0x0130, 0x0195, 0x02c3, 0x0002, 0xfff3, 0x01e3, 0x01d8, 0x001d, 0x043c, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 
+	0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 
+	0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0xffe2, 0x01ea, 0x01e6, 0xffe5, 0x01f9, 0x01e3, 0xffe8, 0x01df, 0x01d8, 0xffef, 0x01e9, 
+	0x01ef, 0xffec, 0x01eb, 0x01cb, 0xfff2, 0x01f8, 0x01ec, 0xffef, 0x01cf, 0x01cf, 0xfff9, 0x01dd, 0x01e2, 0xfff8, 0x01d3, 0x01c2, 
+	0x0002, 0x01ea, 0x01da, 0xfffc, 0x01ce, 0x01d7, 0x0004, 0x01d2, 0x01cb, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 
+	0xfff3, 0x01d4, 0x01d0, 0xfff9, 0x01dd, 0x01e2, 0xffec, 0x01eb, 0x01cb, 0xffea, 0x01f1, 0x01e9, 0x0004, 0x01d2, 0x01cb, 0x0002, 
+	0x01ea, 0x01da, 0x0002, 0xfd42, 0x01bc, 0x0057, 0x001c, 0x0442, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 
+	0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 
+	0x001e, 0x0021, 0x001b, 0x0021, 0xfd30, 0x01c1, 0x0065, 0xfd30, 0x01d0, 0x0061, 0xfd37, 0x01b6, 0x0057, 0xfd3d, 0x01c2, 0x006d, 
+	0xfd39, 0x01c2, 0x004a, 0xfd3e, 0x01d1, 0x0069, 0xfd3f, 0x01a7, 0x004f, 0xfd47, 0x01b7, 0x0061, 0xfd47, 0x01ab, 0x0042, 0xfd51, 
+	0x01c4, 0x0058, 0xfd4d, 0x01a8, 0x0057, 0xfd54, 0x01ac, 0x004a, 0x12c0, 0x0012, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0009, 
+	0x000f, 0x000c, 0x000f, 0xfd3b, 0x01af, 0x0053, 0xfd39, 0x01c2, 0x004a, 0xfd37, 0x01c9, 0x0067, 0xfd4d, 0x01aa, 0x004c, 0xfd47, 
+	0x01b7, 0x0061, 0xfd51, 0x01c4, 0x0058, 0x0002, 0xfc1d, 0x01bb, 0xff57, 0x001c, 0x0443, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 
+	0x0012, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x001b, 0x0012, 0x001b, 0x0015, 0x001e, 0x000f, 
+	0x001e, 0x001b, 0x0021, 0x001e, 0x0021, 0x0018, 0x0021, 0xfc07, 0x01c2, 0xff5b, 0xfc0c, 0x01d1, 0xff5b, 0xfc0f, 0x01c0, 0xff69, 
+	0xfc13, 0x01b7, 0xff51, 0xfc14, 0x01ce, 0xff69, 0xfc1d, 0x01c4, 0xff48, 0xfc1d, 0x01b4, 0xff61, 0xfc1d, 0x01a7, 0xff4b, 0xfc2b, 
+	0x01c0, 0xff60, 0xfc24, 0x01a5, 0xff58, 0xfc2a, 0x01ab, 0xff44, 0xfc32, 0x01a9, 0xff51, 0x12c0, 0x0012, 0x000b, 0x0000, 0x0003, 
+	0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 
+	0x000c, 0x000f, 0x0009, 0x000f, 0xfc18, 0x01af, 0xff4e, 0xfc1d, 0x01b4, 0xff61, 0xfc10, 0x01c8, 0xff55, 0xfc2b, 0x01a8, 0xff4f, 
+	0xfc11, 0x01c7, 0xff69, 0xfc2b, 0x01c0, 0xff60, 0x0002, 0xfbf5, 0x021c, 0xfde5, 0x001d, 0x0444, 0x0002, 0x0000, 0x0024, 0x0014, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 
+	0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 0x000f, 0x001b, 0x0018, 0x001b, 0x0018, 0x001e, 
+	0x0012, 0x001e, 0x001b, 0x0021, 0x0015, 0x0021, 0x001e, 0x0021, 0xfbe0, 0x0223, 0xfde9, 0xfbe2, 0x0226, 0xfdda, 0xfbe6, 0x0230, 
+	0xfdee, 0xfbee, 0x0215, 0xfdea, 0xfbe8, 0x0234, 0xfddf, 0xfbf0, 0x021a, 0xfdd7, 0xfbfb, 0x021e, 0xfdf3, 0xfbff, 0x0225, 0xfdd8, 
+	0xfbf7, 0x0205, 0xfde5, 0xfbf9, 0x0209, 0xfdd6, 0xfc07, 0x0206, 0xfde8, 0xfc09, 0x020a, 0xfdd9, 0x12c0, 0x0012, 0x0009, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0xfbf4, 0x0212, 0xfdd6, 0xfbf5, 0x0213, 0xfdeb, 0xfbee, 0x022a, 0xfddb, 0xfc09, 0x020a, 0xfdd9, 0xfbe3, 0x022a, 0xfdeb, 
+	0xfc07, 0x0206, 0xfde8, 0x0002, 0xfc5b, 0x025d, 0xfc6d, 0x001d, 0x0445, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x0009, 
+	0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x001b, 0x0012, 0x001b, 0x0015, 0x001e, 0x000f, 0x001e, 0x001b, 
+	0x0021, 0x001e, 0x0021, 0x0018, 0x0021, 0xfc47, 0x0266, 0xfc6a, 0xfc4d, 0x0274, 0xfc6e, 0xfc4f, 0x0267, 0xfc5c, 0xfc52, 0x0258, 
+	0xfc71, 0xfc55, 0x0275, 0xfc61, 0xfc5c, 0x0261, 0xfc7d, 0xfc5c, 0x0259, 0xfc60, 0xfc5a, 0x0246, 0xfc73, 0xfc6a, 0x0263, 0xfc65, 
+	0xfc62, 0x0247, 0xfc65, 0xfc68, 0x0247, 0xfc7b, 0xfc6f, 0x0248, 0xfc6d, 0x12c0, 0x000f, 0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0xfc58, 0x0252, 0xfc6c, 0xfc4f, 
+	0x0267, 0xfc5c, 0xfc51, 0x026c, 0xfc6d, 0xfc68, 0x0247, 0xfc6f, 0xfc6a, 0x0263, 0xfc65, 0x0002, 0xff3e, 0x0259, 0xfbb8, 0x001d, 
+	0x044c, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 
+	0x0006, 0x0003, 0x0012, 0x0012, 0x0009, 0x0003, 0x0015, 0x0015, 0x000c, 0x000f, 0x0018, 0x0018, 0x0015, 0x0006, 0x001b, 0x0018, 
+	0x001b, 0x001b, 0x000c, 0x0012, 0x001e, 0x001e, 0x0015, 0x0009, 0x0021, 0x001e, 0x0021, 0x0021, 0x000c, 0xff30, 0x025d, 0xfbc2, 
+	0xff33, 0x0254, 0xfbb2, 0xff35, 0x0270, 0xfbad, 0xff36, 0x0243, 0xfbca, 0xff4c, 0x025d, 0xfbc1, 0xff35, 0x0262, 0xfba6, 0xff36, 
+	0x0242, 0xfbba, 0xff47, 0x0254, 0xfbb2, 0xff45, 0x0262, 0xfba5, 0xff45, 0x0270, 0xfbac, 0xff45, 0x0242, 0xfbba, 0xff46, 0x0243, 
+	0xfbc9, 0x12c0, 0x0012, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0009, 0x000c, 
+	0x0006, 0x000f, 0x0009, 0x000f, 0x000c, 0x000f, 0xff34, 0x024b, 0xfbb6, 0xff33, 0x0250, 0xfbc6, 0xff35, 0x0269, 0xfba9, 0xff46, 
+	0x024b, 0xfbb6, 0xff49, 0x0250, 0xfbc5, 0xff45, 0x0269, 0xfba8, 0x0002, 0x00c8, 0x0257, 0xfbaf, 0x001d, 0x044d, 0x0002, 0x0000, 
+	0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 
+	0x0012, 0x0009, 0x0003, 0x0015, 0x0015, 0x000c, 0x000f, 0x0018, 0x0018, 0x0015, 0x0006, 0x001b, 0x0018, 0x001b, 0x001b, 0x000c, 
+	0x0012, 0x001e, 0x001e, 0x0015, 0x0009, 0x0021, 0x001e, 0x0021, 0x0021, 0x000c, 0x00ba, 0x025c, 0xfbb8, 0x00be, 0x0252, 0xfba9, 
+	0x00c0, 0x0241, 0xfbc1, 0x00c1, 0x026e, 0xfba4, 0x00d6, 0x025c, 0xfbb8, 0x00c0, 0x0241, 0xfbb1, 0x00c0, 0x0260, 0xfb9d, 0x00d2, 
+	0x0252, 0xfba9, 0x00d0, 0x0240, 0xfbb1, 0x00d0, 0x0241, 0xfbc1, 0x00d0, 0x0260, 0xfb9c, 0x00d0, 0x026e, 0xfba4, 0x12c0, 0x000f, 
+	0x0008, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0009, 
+	0x000c, 0x00bc, 0x0257, 0xfbb0, 0x00ce, 0x024c, 0xfbb1, 0x00c8, 0x0241, 0xfbc1, 0x00c8, 0x0260, 0xfb9c, 0x00c9, 0x026e, 0xfba4, 
+	0x0002, 0x0251, 0x0246, 0xfbc7, 0x001d, 0x044e, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0000, 0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 0x0012, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015, 0x0006, 0x0018, 
+	0x0018, 0x0009, 0x0006, 0x001b, 0x0015, 0x001b, 0x001b, 0x000c, 0x0018, 0x001e, 0x001b, 0x001e, 0x0009, 0x0021, 0x000c, 0x0021, 
+	0x001e, 0x0021, 0x0243, 0x024d, 0xfbcd, 0x0244, 0x0232, 0xfbd6, 0x024a, 0x0243, 0xfbbf, 0x0250, 0x025e, 0xfbba, 0x025e, 0x024a, 
+	0xfbd3, 0x0248, 0x0231, 0xfbc7, 0x0253, 0x0230, 0xfbda, 0x0257, 0x022f, 0xfbcb, 0x0250, 0x0250, 0xfbb3, 0x025d, 0x0240, 0xfbc4, 
+	0x025f, 0x024e, 0xfbb7, 0x025f, 0x025c, 0xfbbe, 0x12c0, 0x0009, 0x0003, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x024e, 
+	0x0231, 0xfbd0, 0x0255, 0x0252, 0xfbba, 0x0255, 0x0248, 0xfbcc, 0x0002, 0x03e3, 0x015c, 0xfe1b, 0x001e, 0x0456, 0x0002, 0x0000, 
+	0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 
+	0x0006, 0x0012, 0x0009, 0x0012, 0x0009, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 0x0012, 0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 
+	0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x03cb, 0x0151, 0xfe12, 0x03cf, 0x014c, 0xfe21, 
+	0x03d9, 0x014c, 0xfe0d, 0x03db, 0x0169, 0xfe0f, 0x03dd, 0x0147, 0xfe1b, 0x03e2, 0x0160, 0xfe29, 0x03e6, 0x015b, 0xfe0c, 0x03f6, 
+	0x0172, 0xfe11, 0x03eb, 0x0155, 0xfe1e, 0x03fa, 0x016d, 0xfe20, 0x03f7, 0x0163, 0xfe0c, 0x03fb, 0x015f, 0xfe1a, 0x12c0, 0x0012, 
+	0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0006, 
+	0x000f, 0x0009, 0x000f, 0x000f, 0x000c, 0x03d6, 0x014c, 0xfe13, 0x03cf, 0x014c, 0xfe21, 0x03db, 0x0169, 0xfe0f, 0x03ef, 0x015a, 
+	0xfe17, 0x03ee, 0x0167, 0xfe24, 0x03f7, 0x016b, 0xfe0e, 0x0002, 0x043e, 0x00ee, 0xff8b, 0x001e, 0x0457, 0x0002, 0x0000, 0x0024, 
+	0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 
+	0x0012, 0x0009, 0x0012, 0x0009, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 0x0012, 0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 0x0012, 
+	0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0427, 0x00e2, 0xff82, 0x042a, 0x00de, 0xff91, 0x0435, 
+	0x00dd, 0xff7e, 0x0437, 0x00fa, 0xff7f, 0x0438, 0x00d9, 0xff8d, 0x043d, 0x00f3, 0xff99, 0x0442, 0x00eb, 0xff7d, 0x0452, 0x0103, 
+	0xff82, 0x0446, 0x00e6, 0xff8f, 0x0455, 0x00ff, 0xff91, 0x0453, 0x00f4, 0xff7d, 0x0456, 0x00f0, 0xff8c, 0x12c0, 0x0015, 0x000c, 
+	0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x000f, 0x0006, 
+	0x000f, 0x0009, 0x000f, 0x0012, 0x0009, 0x0012, 0x000c, 0x0012, 0x0435, 0x00dd, 0xff7e, 0x0431, 0x00dc, 0xff8f, 0x0432, 0x00eb, 
+	0xff8d, 0x044b, 0x00f0, 0xff7d, 0x0450, 0x00f2, 0xff8f, 0x0437, 0x00fa, 0xff7f, 0x0452, 0x0103, 0xff82, 0x0002, 0x0489, 0x009a, 
+	0x0105, 0x001e, 0x0458, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 
+	0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x0009, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 0x0012, 
+	0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0472, 
+	0x008e, 0x00fd, 0x0475, 0x008b, 0x010c, 0x0480, 0x0088, 0x00f9, 0x0482, 0x00a5, 0x00f8, 0x0483, 0x0086, 0x0109, 0x0487, 0x00a0, 
+	0x0113, 0x048d, 0x0097, 0x00f8, 0x049c, 0x00af, 0x00fb, 0x0490, 0x0093, 0x010b, 0x049f, 0x00ac, 0x010a, 0x049e, 0x00a0, 0x00f8, 
+	0x04a1, 0x009d, 0x0107, 0x12c0, 0x0015, 0x000c, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 
+	0x0006, 0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0009, 0x000f, 0x000c, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0x0472, 0x008e, 
+	0x00fd, 0x0475, 0x008b, 0x010c, 0x0487, 0x0090, 0x00f9, 0x0494, 0x00a7, 0x00f9, 0x048a, 0x008d, 0x010a, 0x0493, 0x00a6, 0x010f, 
+	0x04a1, 0x009d, 0x0107, 0x0002, 0x04f7, 0x0054, 0x040f, 0x001d, 0x0460, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 
+	0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 0x000f, 0x001b, 0x0018, 0x001b, 0x0012, 0x001e, 0x0018, 0x001e, 0x0015, 
+	0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x04e0, 0x0047, 0x0409, 0x04e2, 0x0046, 0x0419, 0x04ef, 0x0041, 0x0408, 0x04f0, 0x005d, 
+	0x0402, 0x04f0, 0x0041, 0x0417, 0x04f3, 0x005d, 0x041d, 0x04fc, 0x004f, 0x0404, 0x04fe, 0x004f, 0x0418, 0x050a, 0x0068, 0x0405, 
+	0x050c, 0x0068, 0x0415, 0x050c, 0x0058, 0x0405, 0x050e, 0x0058, 0x0414, 0x12c0, 0x0009, 0x0003, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0003, 0x0006, 0x04f0, 0x004d, 0x0410, 0x050d, 0x0058, 0x040d, 0x050b, 0x0068, 0x040d, 0x0002, 0x051a, 0x005c, 0x0599, 0x001d, 
+	0x0461, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 
+	0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 0x000f, 
+	0x001b, 0x0018, 0x001b, 0x0012, 0x001e, 0x0018, 0x001e, 0x0015, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x0504, 0x004e, 0x0593, 
+	0x0505, 0x004f, 0x05a3, 0x0512, 0x0048, 0x0592, 0x0514, 0x0064, 0x058b, 0x0513, 0x0049, 0x05a2, 0x0516, 0x0065, 0x05a7, 0x051f, 
+	0x0056, 0x058f, 0x0521, 0x0057, 0x05a2, 0x052e, 0x006f, 0x058f, 0x052f, 0x0070, 0x059e, 0x0530, 0x0060, 0x058f, 0x0531, 0x0060, 
+	0x059f, 0x12c0, 0x0012, 0x000b, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 
+	0x0009, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x000f, 0x0009, 0x000f, 0x000c, 0x0512, 0x004f, 0x0591, 0x050c, 0x004c, 0x05a3, 
+	0x0514, 0x0064, 0x058b, 0x0521, 0x0057, 0x05a2, 0x0530, 0x0068, 0x0597, 0x0516, 0x0065, 0x05a7, 0x0002, 0x0530, 0x0076, 0x0723, 
+	0x001e, 0x0462, 0x0001, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 
+	0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 
+	0x000f, 0x001b, 0x0018, 0x001b, 0x0012, 0x001e, 0x0018, 0x001e, 0x0015, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x051a, 0x0068, 
+	0x071e, 0x051b, 0x006a, 0x072d, 0x0529, 0x0062, 0x071d, 0x052a, 0x007e, 0x0715, 0x0529, 0x0064, 0x072d, 0x052b, 0x0080, 0x0731, 
+	0x0535, 0x0070, 0x071a, 0x0536, 0x0072, 0x072d, 0x0544, 0x0089, 0x0719, 0x0545, 0x008b, 0x0729, 0x0546, 0x007a, 0x071a, 0x0547, 
+	0x007b, 0x072a, 0x0002, 0x053b, 0x00a4, 0x08ab, 0x001d, 0x0463, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 
+	0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 
+	0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 0x000f, 0x001b, 0x0018, 0x001b, 0x0012, 0x001e, 0x0018, 0x001e, 0x0015, 0x0021, 
+	0x001b, 0x0021, 0x001e, 0x0021, 0x0525, 0x0096, 0x08a7, 0x0525, 0x0098, 0x08b6, 0x0534, 0x0090, 0x08a8, 0x0535, 0x00ab, 0x089d, 
+	0x0534, 0x0093, 0x08b7, 0x0536, 0x00af, 0x08b9, 0x0541, 0x009e, 0x08a3, 0x0541, 0x00a1, 0x08b7, 0x054f, 0x00b7, 0x08a1, 0x054f, 
+	0x00b9, 0x08b0, 0x0551, 0x00a7, 0x08a3, 0x0552, 0x00aa, 0x08b3, 0x12c0, 0x000f, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 
+	0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x052d, 0x0094, 0x08af, 
+	0x0535, 0x00ab, 0x089d, 0x0536, 0x00af, 0x08b9, 0x0541, 0x009e, 0x08a3, 0x054d, 0x00ad, 0x08ac, 0x0002, 0x0543, 0x0103, 0x0a2a, 
+	0x001d, 0x0464, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 
+	0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x000f, 0x0015, 0x0012, 0x0015, 0x0009, 0x0018, 
+	0x000f, 0x001b, 0x0018, 0x001b, 0x0012, 0x001e, 0x0018, 0x001e, 0x0015, 0x0021, 0x001b, 0x0021, 0x001e, 0x0021, 0x052d, 0x00f3, 
+	0x0a29, 0x052d, 0x00f9, 0x0a38, 0x053b, 0x00ee, 0x0a2b, 0x053d, 0x0106, 0x0a1b, 0x053c, 0x00f4, 0x0a3a, 0x053d, 0x0110, 0x0a36, 
+	0x0548, 0x00fb, 0x0a24, 0x0548, 0x0101, 0x0a36, 0x0556, 0x0113, 0x0a1d, 0x0557, 0x0118, 0x0a2c, 0x0559, 0x0104, 0x0a22, 0x0559, 
+	0x010a, 0x0a31, 0x12c0, 0x0012, 0x000a, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0009, 0x0000, 
+	0x000c, 0x0006, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x000f, 0x000c, 0x0534, 0x00f4, 0x0a32, 0x053d, 0x0106, 0x0a1b, 0x053d, 
+	0x0110, 0x0a36, 0x0548, 0x00fb, 0x0a24, 0x0554, 0x010a, 0x0a2d, 0x0556, 0x0113, 0x0a1d, 0x0002, 0x0528, 0x01cc, 0x0b7a, 0x001c, 
+	0x0465, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 
+	0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0009, 0x0012, 0x0009, 0x0015, 0x000c, 0x0018, 0x000f, 0x0018, 0x0012, 0x0018, 0x000f, 
+	0x001b, 0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0511, 0x01c2, 0x0b84, 
+	0x0515, 0x01b8, 0x0b79, 0x051e, 0x01c0, 0x0b8b, 0x051f, 0x01d9, 0x0b7d, 0x0523, 0x01b6, 0x0b80, 0x0527, 0x01c7, 0x0b69, 0x052b, 
+	0x01ce, 0x0b86, 0x0539, 0x01e2, 0x0b77, 0x0530, 0x01c2, 0x0b78, 0x053e, 0x01d8, 0x0b6c, 0x053b, 0x01d7, 0x0b82, 0x0540, 0x01cd, 
+	0x0b77, 0x12c0, 0x0018, 0x000f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x000c, 0x0003, 
+	0x000c, 0x0009, 0x000c, 0x000f, 0x0003, 0x000f, 0x0009, 0x000f, 0x000c, 0x0012, 0x0009, 0x0012, 0x000f, 0x0012, 0x0009, 0x0015, 
+	0x000f, 0x0015, 0x0515, 0x01b8, 0x0b79, 0x0518, 0x01c1, 0x0b88, 0x0523, 0x01b6, 0x0b80, 0x0532, 0x01cb, 0x0b6f, 0x051f, 0x01d9, 
+	0x0b7d, 0x0533, 0x01d3, 0x0b84, 0x0539, 0x01e2, 0x0b77, 0x0540, 0x01cd, 0x0b77, 0x0002, 0x02a3, 0x030f, 0x0be4, 0x001c, 0x046a, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 
+	0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 
+	0x0015, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x0021, 0x001b, 0x0294, 0x0300, 0x0bed, 0x0296, 
+	0x02f7, 0x0be0, 0x0298, 0x0312, 0x0bea, 0x02a3, 0x02fc, 0x0bf1, 0x0299, 0x0312, 0x0bd8, 0x02a4, 0x02f3, 0x0be4, 0x029e, 0x0324, 
+	0x0bee, 0x02ab, 0x030d, 0x0bef, 0x02a4, 0x032b, 0x0be0, 0x02b3, 0x030b, 0x0bdf, 0x02ad, 0x0320, 0x0bf1, 0x02b2, 0x0327, 0x0be4, 
+	0x12c0, 0x0018, 0x000f, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0003, 0x000c, 0x0009, 
+	0x000c, 0x0003, 0x000f, 0x000c, 0x000f, 0x0006, 0x0012, 0x0012, 0x000f, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0015, 0x0015, 
+	0x000f, 0x0296, 0x02f7, 0x0be0, 0x0299, 0x0312, 0x0bd8, 0x0296, 0x0309, 0x0bec, 0x02a4, 0x02f8, 0x0beb, 0x02b3, 0x030b, 0x0bdf, 
+	0x02ac, 0x0326, 0x0be7, 0x029e, 0x0324, 0x0bee, 0x02ab, 0x030d, 0x0bef, 0x0002, 0x013d, 0x0372, 0x0b5e, 0x001c, 0x046b, 0x0001, 
+	0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x000c, 0x0018, 0x0012, 0x0018, 0x000c, 0x001b, 0x000f, 0x001b, 0x0015, 
+	0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001e, 0x0021, 0x0021, 0x001b, 0x012d, 0x0363, 0x0b66, 0x0130, 0x035a, 
+	0x0b59, 0x0132, 0x0376, 0x0b62, 0x013b, 0x0360, 0x0b6c, 0x0135, 0x0375, 0x0b50, 0x013e, 0x0356, 0x0b60, 0x0137, 0x0388, 0x0b66, 
+	0x0143, 0x0371, 0x0b6a, 0x013f, 0x038e, 0x0b59, 0x014e, 0x036e, 0x0b5c, 0x0145, 0x0384, 0x0b6c, 0x014c, 0x038a, 0x0b60, 0x0002, 
+	0xfff6, 0x03cc, 0x0a95, 0x001c, 0x046c, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 
+	0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0012, 0x0018, 0x000c, 
+	0x0018, 0x0012, 0x001b, 0x0015, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x0021, 
+	0x001e, 0xffe6, 0x03be, 0x0a9a, 0xffeb, 0x03b5, 0x0a90, 0xffeb, 0x03d1, 0x0a97, 0xfff2, 0x03bb, 0x0aa4, 0xfff2, 0x03cf, 0x0a86, 
+	0xfff8, 0x03b1, 0x0a99, 0xffef, 0x03e3, 0x0a9a, 0xfffa, 0x03cd, 0x0aa2, 0xfff9, 0x03e8, 0x0a8f, 0xfffb, 0x03e0, 0x0aa3, 0x0006, 
+	0x03c9, 0x0a97, 0x0004, 0x03e5, 0x0a99, 0x12c0, 0x0018, 0x000d, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x000c, 0x000c, 0x0009, 0x0006, 0x000f, 0x000c, 0x0012, 0x000f, 0x0012, 0x000f, 0x0015, 0x0012, 0x0015, 
+	0x0009, 0x0015, 0xffee, 0x03b7, 0x0a96, 0xfff2, 0x03bb, 0x0aa4, 0xffee, 0x03d0, 0x0a8f, 0x0006, 0x03c9, 0x0a97, 0xfffa, 0x03cd, 
+	0x0aa2, 0xfff4, 0x03e6, 0x0a95, 0xfffb, 0x03e0, 0x0aa3, 0x0004, 0x03e5, 0x0a99, 0x0002, 0xfeeb, 0x03fb, 0x097a, 0x001d, 0x046d, 
+	0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 
+	0x0003, 0x0012, 0x0009, 0x0012, 0x000c, 0x0015, 0x0015, 0x000f, 0x000c, 0x0018, 0x0012, 0x0018, 0x0006, 0x001b, 0x0009, 0x001b, 
+	0x0015, 0x001e, 0x0018, 0x001e, 0x000f, 0x0021, 0x001b, 0x0021, 0x0012, 0x0021, 0x001e, 0x0021, 0xfedb, 0x03ec, 0x097d, 0xfee0, 
+	0x03fe, 0x0977, 0xfee3, 0x03ec, 0x098a, 0xfee5, 0x03e1, 0x0977, 0xfee1, 0x0411, 0x0978, 0xfeea, 0x03fe, 0x0988, 0xfeed, 0x03fa, 
+	0x096b, 0xfee9, 0x0411, 0x0986, 0xfeee, 0x0416, 0x0971, 0xfeed, 0x03e2, 0x0984, 0xfef6, 0x0416, 0x097e, 0xfefb, 0x03fb, 0x0983, 
+	0x12c0, 0x000f, 0x0007, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x0006, 0x000c, 0x0009, 
+	0x000c, 0xfedb, 0x03ec, 0x097d, 0xfee6, 0x03f3, 0x0973, 0xfeed, 0x03f2, 0x0986, 0xfeec, 0x0414, 0x0978, 0xfee9, 0x0411, 0x0986, 
+	0x0002, 0xfe8b, 0x03b7, 0x0809, 0x001c, 0x046e, 0x0002, 0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 
+	0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 0x000f, 0x0012, 0x0006, 0x0012, 0x0015, 0x000c, 0x0015, 0x0012, 0x0018, 
+	0x0006, 0x001b, 0x0009, 0x001b, 0x0018, 0x001b, 0x000c, 0x001e, 0x000f, 0x001e, 0x001b, 0x001e, 0x0015, 0x0021, 0x0018, 0x0021, 
+	0x0021, 0x001e, 0xfe7f, 0x03a4, 0x0807, 0xfe7f, 0x03a9, 0x0816, 0xfe84, 0x03b6, 0x0800, 0xfe8b, 0x039b, 0x080a, 0xfe84, 0x03bb, 
+	0x0813, 0xfe8c, 0x03a0, 0x0819, 0xfe83, 0x03c8, 0x07fd, 0xfe84, 0x03cd, 0x080c, 0xfe91, 0x03ce, 0x07fa, 0xfe95, 0x03b2, 0x07fc, 
+	0xfe96, 0x03ba, 0x0817, 0xfe92, 0x03d3, 0x080a, 0x12c0, 0x0012, 0x0009, 0x0000, 0x0003, 0x0000, 0x0006, 0x0003, 0x0006, 0x0003, 
+	0x0009, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0x000c, 0x0006, 0x000f, 0x000c, 0x000f, 0xfe7f, 0x03a7, 0x080f, 0xfe8b, 0x039b, 
+	0x080a, 0xfe8a, 0x03b3, 0x0811, 0xfe95, 0x03b2, 0x07fc, 0xfe8a, 0x03cb, 0x07fc, 0xfe8b, 0x03d0, 0x080b, 0x0002, 0x0468, 0x0299, 
+	0x0731, 0x0059, 0x0064, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 
+	0x000c, 0x0003, 0x000f, 0x000f, 0x0006, 0x0003, 0x0012, 0x000f, 0x0012, 0x0012, 0x0009, 0x0003, 0x0015, 0x000f, 0x0018, 0x0015, 
+	0x0018, 0x0006, 0x001b, 0x000c, 0x001b, 0x0012, 0x001e, 0x0015, 0x001e, 0x0018, 0x001e, 0x0009, 0x0021, 0x000c, 0x0021, 0x001b, 
+	0x0021, 0x0015, 0x0024, 0x001b, 0x0027, 0x0018, 0x002a, 0x002a, 0x0024, 0x0021, 0x002d, 0x0027, 0x002d, 0x001e, 0x0030, 0x002a, 
+	0x0030, 0x0030, 0x0024, 0x002a, 0x0033, 0x0027, 0x0036, 0x002d, 0x0036, 0x000c, 0x0036, 0x0027, 0x0039, 0x0039, 0x0033, 0x0030, 
+	0x003c, 0x0033, 0x003c, 0x002d, 0x003f, 0x0039, 0x003f, 0x003f, 0x003c, 0x0036, 0x0042, 0x0039, 0x0042, 0x003f, 0x0042, 0x0033, 
+	0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0024, 0x0045, 0x0416, 0x027d, 0x0744, 0x0416, 0x02b9, 0x0724, 0x042d, 0x027e, 0x0732, 
+	0x042e, 0x028c, 0x074c, 0x0446, 0x0252, 0x0759, 0x042c, 0x02a9, 0x071b, 0x042d, 0x02b7, 0x0735, 0x0445, 0x02e2, 0x070c, 0x044f, 
+	0x02c7, 0x070a, 0x044f, 0x025f, 0x0741, 0x0450, 0x02d5, 0x0723, 0x0450, 0x026d, 0x075b, 0x0489, 0x02e2, 0x070a, 0x0480, 0x025f, 
+	0x0740, 0x047f, 0x02c7, 0x0708, 0x0481, 0x026d, 0x0759, 0x0480, 0x02d4, 0x0722, 0x04a2, 0x02a8, 0x0717, 0x048a, 0x0251, 0x0757, 
+	0x04a2, 0x027d, 0x072e, 0x04a3, 0x02b6, 0x0731, 0x04a3, 0x028b, 0x0748, 0x04ba, 0x027b, 0x073f, 0x04ba, 0x02b7, 0x071f, 0x0002, 
+	0x04a5, 0x000f, 0xfea9, 0x0058, 0x0065, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 
+	0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x000f, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x0006, 
+	0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 0x0018, 0x001e, 0x0012, 0x0021, 0x0015, 
+	0x0021, 0x001b, 0x0021, 0x000c, 0x0024, 0x0018, 0x0027, 0x0027, 0x0024, 0x0015, 0x002a, 0x001e, 0x002d, 0x0027, 0x002d, 0x002d, 
+	0x0024, 0x001b, 0x0030, 0x0030, 0x002a, 0x0021, 0x0033, 0x0030, 0x0033, 0x0033, 0x002a, 0x0027, 0x0036, 0x002d, 0x0039, 0x0036, 
+	0x0039, 0x0030, 0x003c, 0x0036, 0x003c, 0x0033, 0x003f, 0x003c, 0x003f, 0x0039, 0x003f, 0x002a, 0x0042, 0x003c, 0x0042, 0x003f, 
+	0x0042, 0x0036, 0x0045, 0x0039, 0x0045, 0x0045, 0x0042, 0x0024, 0x0045, 0x0454, 0x0030, 0xfe9d, 0x0459, 0xfff0, 0xfe89, 0x0467, 
+	0x0022, 0xfeae, 0x046e, 0x002b, 0xfe93, 0x047e, 0x005d, 0xfeb8, 0x046b, 0xfff5, 0xfea0, 0x0472, 0xfffd, 0xfe85, 0x048b, 0xffc2, 
+	0xfe88, 0x0486, 0x0043, 0xfec1, 0x048e, 0xffd4, 0xfe9f, 0x048d, 0x004c, 0xfea6, 0x0496, 0xffdc, 0xfe84, 0x04c0, 0x005d, 0xfeca, 
+	0x04b5, 0x0042, 0xfece, 0x04cc, 0xffc2, 0xfe9a, 0x04bc, 0x004b, 0xfeb3, 0x04bd, 0xffd3, 0xfeab, 0x04c5, 0xffdc, 0xfe91, 0x04d9, 
+	0x0021, 0xfecd, 0x04e0, 0x002a, 0xfeb2, 0x04dc, 0xfff4, 0xfebe, 0x04e3, 0xfffd, 0xfea4, 0x04f7, 0xffef, 0xfeb4, 0x04f2, 0x002f, 
+	0xfec8, 0x0002, 0xfe74, 0x00a6, 0xfd50, 0x0059, 0x0066, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0012, 0x0009, 0x0006, 0x0015, 0x000f, 
+	0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x000f, 0x001b, 0x001b, 0x0018, 0x0012, 0x001e, 0x0009, 0x001e, 0x000c, 0x001e, 0x0012, 
+	0x0021, 0x001b, 0x0024, 0x0015, 0x0024, 0x0018, 0x0024, 0x001b, 0x0027, 0x0018, 0x002a, 0x0027, 0x002a, 0x001e, 0x002d, 0x0021, 
+	0x002d, 0x0021, 0x0030, 0x0030, 0x002d, 0x0009, 0x0030, 0x0021, 0x0033, 0x0024, 0x0036, 0x0027, 0x0036, 0x002a, 0x0036, 0x0027, 
+	0x0039, 0x0033, 0x0039, 0x0030, 0x003c, 0x0033, 0x003c, 0x0033, 0x003f, 0x002d, 0x003f, 0x003f, 0x003c, 0x0039, 0x0042, 0x0036, 
+	0x0042, 0x003f, 0x0042, 0x0039, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x002a, 0x0045, 0xfe40, 0x00b5, 0xfd96, 0xfe44, 0x00b2, 
+	0xfd79, 0xfe46, 0x0073, 0xfd87, 0xfe59, 0x00ef, 0xfd7b, 0xfe5b, 0x00b0, 0xfd8b, 0xfe48, 0x0083, 0xfd6f, 0xfe55, 0x00db, 0xfd66, 
+	0xfe5f, 0x0081, 0xfd80, 0xfe67, 0x004f, 0xfd58, 0xfe5f, 0x0069, 0xfd4d, 0xfe6c, 0x00d9, 0xfd78, 0xfe72, 0x00e6, 0xfd41, 0xfe76, 
+	0x0067, 0xfd5e, 0xfe7c, 0x0074, 0xfd27, 0xfe90, 0x005e, 0xfd24, 0xfe8a, 0x00e4, 0xfd52, 0xfe82, 0x00fe, 0xfd47, 0xfe8a, 0x00cc, 
+	0xfd1f, 0xfe94, 0x0072, 0xfd39, 0xfe8e, 0x009d, 0xfd14, 0xfea3, 0x00da, 0xfd18, 0xfea1, 0x00ca, 0xfd30, 0xfea5, 0x009b, 0xfd26, 
+	0xfea8, 0x0098, 0xfd09, 0x0002, 0xfc67, 0x0038, 0x0295, 0x0058, 0x0067, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 
+	0x0015, 0x000c, 0x0015, 0x000f, 0x0015, 0x0006, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x0012, 0x001b, 0x0009, 0x001e, 0x000f, 
+	0x0021, 0x0021, 0x0018, 0x0012, 0x0024, 0x0024, 0x001e, 0x001b, 0x0027, 0x0024, 0x0027, 0x001e, 0x0027, 0x0015, 0x002a, 0x0021, 
+	0x002a, 0x0018, 0x002a, 0x0021, 0x002d, 0x0024, 0x0030, 0x001e, 0x0033, 0x0030, 0x0033, 0x002a, 0x0036, 0x002d, 0x0036, 0x0027, 
+	0x0039, 0x0030, 0x0039, 0x0039, 0x0033, 0x002d, 0x003c, 0x0030, 0x003c, 0x002d, 0x003f, 0x0036, 0x003f, 0x0018, 0x003f, 0x0039, 
+	0x0042, 0x0036, 0x0042, 0x003c, 0x0042, 0x003c, 0x0045, 0x003f, 0x0045, 0x0033, 0x0045, 0x0042, 0x0045, 0xfc12, 0x0032, 0x02ae, 
+	0xfc25, 0x0036, 0x0299, 0xfc2a, 0x0071, 0x02b2, 0xfc2b, 0xfff7, 0x029c, 0xfc2e, 0x0031, 0x02b5, 0xfc37, 0x0063, 0x029c, 0xfc38, 
+	0x000b, 0x028c, 0xfc40, 0x005e, 0x02b8, 0xfc66, 0x008f, 0x02a5, 0xfc40, 0x0006, 0x02a8, 0xfc67, 0xffe1, 0x0285, 0xfc62, 0x0078, 
+	0x0293, 0xfc63, 0xfffc, 0x027c, 0xfc6b, 0xfff7, 0x0297, 0xfc6a, 0x0073, 0x02ae, 0xfc8d, 0x0069, 0x0282, 0xfc8e, 0x0010, 0x0272, 
+	0xfca3, 0xfffe, 0x0278, 0xfc96, 0x0064, 0x029e, 0xfc96, 0x000b, 0x028e, 0xfc9f, 0x003d, 0x0275, 0xfca2, 0x0079, 0x028e, 0xfca8, 
+	0x0038, 0x0291, 0xfcbc, 0x003c, 0x027c, 0x0002, 0x0012, 0xfef8, 0x0b01, 0x0059, 0x0068, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 
+	0x0012, 0x0006, 0x0015, 0x000c, 0x0015, 0x000f, 0x0015, 0x0006, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x0012, 0x001b, 0x0009, 
+	0x001e, 0x000f, 0x0021, 0x0021, 0x0018, 0x0012, 0x0024, 0x0024, 0x001e, 0x0015, 0x0027, 0x0021, 0x0027, 0x0018, 0x0027, 0x001b, 
+	0x002a, 0x0024, 0x002a, 0x001e, 0x002a, 0x0021, 0x002d, 0x0024, 0x0030, 0x001e, 0x0033, 0x0030, 0x0033, 0x0027, 0x0036, 0x002d, 
+	0x0036, 0x002a, 0x0039, 0x0030, 0x0039, 0x0039, 0x0033, 0x002d, 0x003c, 0x0030, 0x003c, 0x002d, 0x003f, 0x0036, 0x003f, 0x0018, 
+	0x003f, 0x0036, 0x0042, 0x0039, 0x0042, 0x003c, 0x0042, 0x003c, 0x0045, 0x003f, 0x0045, 0x0033, 0x0045, 0x0042, 0x0045, 0xffc4, 
+	0xfef0, 0x0b2a, 0xffd3, 0xfef5, 0x0b12, 0xffda, 0xfeb5, 0x0b10, 0xffdc, 0xff30, 0x0b2b, 0xffe1, 0xfeef, 0x0b2b, 0xffe3, 0xfecb, 
+	0x0b00, 0xffe4, 0xff23, 0x0b13, 0xfff1, 0xfec5, 0x0b19, 0x0010, 0xfea1, 0x0aee, 0xfff2, 0xff1d, 0x0b2c, 0x0013, 0xff4f, 0x0b14, 
+	0x000a, 0xfebc, 0x0ae7, 0x000b, 0xff39, 0x0b02, 0x0017, 0xfeb7, 0x0b00, 0x0019, 0xff33, 0x0b1b, 0x0032, 0xfed3, 0x0ad7, 0x0033, 
+	0xff2b, 0x0aea, 0x004a, 0xff3b, 0x0af2, 0x003f, 0xfecd, 0x0af0, 0x0041, 0xff25, 0x0b03, 0x0043, 0xff00, 0x0ad8, 0x0048, 0xfec0, 
+	0x0ad7, 0x0051, 0xfefb, 0x0af1, 0x0060, 0xff00, 0x0ad9, 0x0002, 0x0321, 0xff95, 0x028c, 0x0059, 0x0069, 0x0001, 0x0000, 0x0048, 
+	0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 
+	0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x0006, 0x0018, 0x000f, 0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 0x0009, 
+	0x001e, 0x0012, 0x001e, 0x000c, 0x001e, 0x0009, 0x0021, 0x0012, 0x0024, 0x0021, 0x0024, 0x0015, 0x0027, 0x0018, 0x0027, 0x001b, 
+	0x0027, 0x0015, 0x002a, 0x001b, 0x002d, 0x002a, 0x002d, 0x001e, 0x0030, 0x0021, 0x0030, 0x0024, 0x0030, 0x0021, 0x0033, 0x0027, 
+	0x0036, 0x002a, 0x0036, 0x002d, 0x0036, 0x002a, 0x0039, 0x0033, 0x0039, 0x0024, 0x003c, 0x0033, 0x003c, 0x0033, 0x003f, 0x0030, 
+	0x003f, 0x003c, 0x003f, 0x0039, 0x0042, 0x002d, 0x0042, 0x003c, 0x0042, 0x0039, 0x0045, 0x0036, 0x0045, 0x003f, 0x0045, 0x0042, 
+	0x0045, 0x02f5, 0xff9d, 0x02bb, 0x02f5, 0xff9e, 0x02d8, 0x02f8, 0xff6e, 0x02ad, 0x0305, 0xffc7, 0x02aa, 0x030e, 0xff9a, 0x02ca, 
+	0x02f9, 0xff5d, 0x02c4, 0x030a, 0xffd9, 0x02c0, 0x030d, 0xff57, 0x0287, 0x0311, 0xff6b, 0x02bc, 0x0315, 0xff3d, 0x0290, 0x031d, 
+	0xffc5, 0x02b9, 0x031e, 0xffd5, 0x0282, 0x032e, 0xffed, 0x0289, 0x0325, 0xff54, 0x0296, 0x0326, 0xff65, 0x0260, 0x0339, 0xff50, 
+	0x0259, 0x0337, 0xffd2, 0x0291, 0x0332, 0xffbe, 0x025c, 0x033f, 0xff62, 0x026f, 0x0335, 0xff90, 0x024e, 0x034a, 0xffcd, 0x0254, 
+	0x034b, 0xffbb, 0x026b, 0x034e, 0xff8c, 0x0240, 0x034e, 0xff8d, 0x025d, 0x0002, 0xfc43, 0xff50, 0x02fb, 0x0059, 0x006a, 0x0001, 
+	0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 
+	0x000f, 0x0003, 0x0012, 0x000f, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x0015, 
+	0x001b, 0x0009, 0x001e, 0x000c, 0x001e, 0x0018, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x001b, 0x0021, 0x000c, 0x0024, 0x0015, 
+	0x0027, 0x0018, 0x002a, 0x002a, 0x0024, 0x001b, 0x002d, 0x002d, 0x0027, 0x001e, 0x0030, 0x002a, 0x0030, 0x0030, 0x0024, 0x0021, 
+	0x0033, 0x002d, 0x0033, 0x0033, 0x0027, 0x002a, 0x0036, 0x002d, 0x0039, 0x0036, 0x0039, 0x0030, 0x003c, 0x0036, 0x003c, 0x0033, 
+	0x003f, 0x0039, 0x003f, 0x003c, 0x003f, 0x0036, 0x0042, 0x003c, 0x0042, 0x0024, 0x0042, 0x0039, 0x0045, 0x003f, 0x0045, 0x0042, 
+	0x0045, 0x0027, 0x0045, 0xfbf3, 0xff36, 0x02df, 0xfbf4, 0xff77, 0x02f3, 0xfc06, 0xff39, 0x02f5, 0xfc0d, 0xff41, 0x02da, 0xfc20, 
+	0xff04, 0x02dc, 0xfc07, 0xff68, 0x0303, 0xfc0e, 0xff70, 0x02e8, 0xfc24, 0xffa1, 0x030c, 0xfc26, 0xff15, 0x02f3, 0xfc29, 0xff86, 
+	0x0315, 0xfc2e, 0xff1d, 0x02d7, 0xfc30, 0xff8e, 0x02fa, 0xfc62, 0xfefe, 0x02eb, 0xfc66, 0xff9b, 0x031b, 0xfc56, 0xff11, 0x02fe, 
+	0xfc58, 0xff81, 0x0320, 0xfc5d, 0xff19, 0x02e3, 0xfc5f, 0xff89, 0x0305, 0xfc78, 0xff2e, 0x030f, 0xfc79, 0xff5d, 0x031e, 0xfc7f, 
+	0xff37, 0x02f4, 0xfc80, 0xff65, 0x0303, 0xfc92, 0xff27, 0x0304, 0xfc93, 0xff68, 0x0318, 0x0002, 0xfe42, 0xfe7a, 0x0958, 0x0059, 
+	0x006b, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0009, 0x000c, 0x0003, 
+	0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x0012, 0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x0006, 0x001b, 0x0009, 
+	0x001b, 0x0006, 0x001e, 0x001b, 0x001e, 0x000c, 0x001e, 0x000f, 0x0021, 0x000f, 0x0024, 0x0012, 0x0024, 0x000f, 0x0027, 0x0024, 
+	0x0027, 0x0015, 0x0027, 0x0018, 0x002a, 0x0018, 0x002d, 0x001b, 0x002d, 0x0018, 0x0030, 0x002d, 0x0030, 0x001e, 0x0030, 0x0021, 
+	0x0033, 0x002a, 0x0033, 0x0021, 0x0036, 0x0024, 0x0036, 0x0021, 0x0039, 0x0036, 0x0039, 0x0027, 0x0039, 0x002a, 0x003c, 0x002d, 
+	0x003c, 0x002a, 0x003f, 0x003c, 0x003f, 0x0030, 0x003f, 0x0033, 0x0042, 0x0036, 0x0042, 0x003c, 0x0042, 0x0033, 0x0045, 0x0042, 
+	0x0045, 0x0039, 0x0045, 0x003f, 0x0045, 0xfe2c, 0xfe5c, 0x0923, 0xfe2d, 0xfe8c, 0x091e, 0xfe2f, 0xfe3d, 0x0948, 0xfe38, 0xfe50, 
+	0x090b, 0xfe49, 0xfe5b, 0x091f, 0xfe31, 0xfeb2, 0x093d, 0xfe38, 0xfe93, 0x0904, 0xfe49, 0xfe8c, 0x091b, 0xfe35, 0xfe42, 0x0978, 
+	0xfe3c, 0xfe25, 0x093f, 0xfe4c, 0xfe3c, 0x0945, 0xfe36, 0xfeb7, 0x096d, 0xfe3f, 0xfec8, 0x092f, 0xfe4e, 0xfeb1, 0x0939, 0xfe39, 
+	0xfe67, 0x0997, 0xfe44, 0xfe2b, 0x0982, 0xfe52, 0xfe41, 0x0975, 0xfe3a, 0xfe98, 0x0992, 0xfe46, 0xfece, 0x0972, 0xfe53, 0xfeb6, 
+	0x096a, 0xfe4a, 0xfe5f, 0x09ad, 0xfe56, 0xfe66, 0x0994, 0xfe4b, 0xfea3, 0x09a7, 0xfe57, 0xfe97, 0x098f, 0x0002, 0x04e1, 0xff9a, 
+	0x073e, 0x0059, 0x006c, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0003, 
+	0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x000f, 0x0015, 0x000c, 0x0015, 0x0006, 
+	0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x0012, 0x001b, 0x0009, 0x001e, 0x000f, 0x0021, 0x0021, 0x0018, 0x0012, 0x0024, 0x0024, 
+	0x001e, 0x0015, 0x0027, 0x0021, 0x0027, 0x0018, 0x0027, 0x001b, 0x002a, 0x0024, 0x002a, 0x001e, 0x002a, 0x0021, 0x002d, 0x0018, 
+	0x0030, 0x002d, 0x0030, 0x0024, 0x0033, 0x0027, 0x0036, 0x002d, 0x0036, 0x0036, 0x0030, 0x002a, 0x0039, 0x0033, 0x0039, 0x002d, 
+	0x003c, 0x0033, 0x003c, 0x0033, 0x003f, 0x0039, 0x003f, 0x001e, 0x003f, 0x0036, 0x0042, 0x003c, 0x0042, 0x0039, 0x0042, 0x003c, 
+	0x0045, 0x003f, 0x0045, 0x0042, 0x0045, 0x0030, 0x0045, 0x0493, 0xff83, 0x0762, 0x04a2, 0xff8e, 0x074c, 0x04a5, 0xffc2, 0x0771, 
+	0x04af, 0xff50, 0x073e, 0x04b0, 0xff84, 0x0764, 0x04af, 0xffbb, 0x0757, 0x04b6, 0xff6a, 0x0732, 0x04bc, 0xffb2, 0x076f, 0x04da, 
+	0xffea, 0x0763, 0x04c4, 0xff60, 0x074a, 0x04e8, 0xff49, 0x071a, 0x04d5, 0xffd8, 0x074d, 0x04df, 0xff64, 0x0719, 0x04e3, 0xffce, 
+	0x0765, 0x04ed, 0xff5b, 0x0731, 0x04fe, 0xffd3, 0x0733, 0x0513, 0xffe3, 0x073f, 0x0505, 0xff81, 0x070e, 0x050c, 0xffc9, 0x074b, 
+	0x0513, 0xff77, 0x0726, 0x0512, 0xffae, 0x0719, 0x051d, 0xff70, 0x070c, 0x0520, 0xffa5, 0x0731, 0x052f, 0xffb0, 0x071b, 0x0002, 
+	0xfe9d, 0x01db, 0x0113, 0x0059, 0x006d, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 
+	0x000c, 0x0003, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0006, 0x0015, 0x0006, 0x0018, 0x000f, 
+	0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x0015, 0x001b, 0x0009, 0x001e, 0x0009, 0x0021, 0x0012, 0x0021, 0x000c, 0x0021, 0x0015, 
+	0x0024, 0x0015, 0x0027, 0x0018, 0x0027, 0x001b, 0x0027, 0x0012, 0x002a, 0x001e, 0x002a, 0x001b, 0x002d, 0x0024, 0x002d, 0x001e, 
+	0x0030, 0x001e, 0x0033, 0x0021, 0x0033, 0x002a, 0x0033, 0x0024, 0x0036, 0x0030, 0x0036, 0x0024, 0x0039, 0x0027, 0x0039, 0x002d, 
+	0x0039, 0x002a, 0x003c, 0x0030, 0x003c, 0x0030, 0x003f, 0x0033, 0x003f, 0x003c, 0x003f, 0x0036, 0x0042, 0x002d, 0x0042, 0x003c, 
+	0x0042, 0x0036, 0x0045, 0x0039, 0x0045, 0x003f, 0x0045, 0x0042, 0x0045, 0xfe73, 0x01f2, 0x0140, 0xfe74, 0x01fd, 0x015b, 0xfe76, 
+	0x01c2, 0x0141, 0xfe81, 0x0215, 0x0121, 0xfe8c, 0x01f4, 0x014e, 0xfe78, 0x01b9, 0x015d, 0xfe88, 0x022d, 0x0130, 0xfe88, 0x01a0, 
+	0x0124, 0xfe8f, 0x01c4, 0x014f, 0xfe92, 0x0189, 0x0133, 0xfe97, 0x0215, 0x00f6, 0xfe9a, 0x0217, 0x012e, 0xfe9f, 0x01a0, 0x00f9, 
+	0xfea2, 0x01a1, 0x0131, 0xfea7, 0x022d, 0x00f3, 0xfeb2, 0x018a, 0x00f7, 0xfeaa, 0x01f3, 0x00d8, 0xfeb1, 0x0217, 0x0103, 0xfead, 
+	0x01c3, 0x00d9, 0xfeb8, 0x01a2, 0x0106, 0xfec1, 0x01fe, 0x00ca, 0xfec3, 0x01f5, 0x00e6, 0xfec5, 0x01ba, 0x00cc, 0xfec6, 0x01c4, 
+	0x00e7, 0x0002, 0xfdb2, 0x0258, 0xfbcf, 0x0059, 0x006e, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 
+	0x0009, 0x0000, 0x000c, 0x0009, 0x000c, 0x0003, 0x000f, 0x0003, 0x0012, 0x0009, 0x0012, 0x0003, 0x0015, 0x0012, 0x0015, 0x000c, 
+	0x0015, 0x0006, 0x0018, 0x0006, 0x001b, 0x0009, 0x001b, 0x0006, 0x001e, 0x001b, 0x001e, 0x000c, 0x001e, 0x0018, 0x0021, 0x0018, 
+	0x0024, 0x001b, 0x0024, 0x0018, 0x0027, 0x0024, 0x0027, 0x001e, 0x0027, 0x0021, 0x002a, 0x0021, 0x002d, 0x0024, 0x002d, 0x0021, 
+	0x0030, 0x002d, 0x0030, 0x0027, 0x0030, 0x0033, 0x002a, 0x000f, 0x0033, 0x000f, 0x0036, 0x000f, 0x0039, 0x0036, 0x0039, 0x0033, 
+	0x003c, 0x0036, 0x003c, 0x0033, 0x003f, 0x003c, 0x003f, 0x0039, 0x003f, 0x0012, 0x0036, 0x003c, 0x0042, 0x002a, 0x0042, 0x002a, 
+	0x0045, 0x0042, 0x0045, 0x003f, 0x0045, 0x002d, 0x0042, 0x0015, 0x0039, 0x0030, 0x0045, 0xfd9d, 0x024d, 0xfb92, 0xfd9f, 0x0224, 
+	0xfbac, 0xfd9f, 0x027d, 0xfb9c, 0xfda9, 0x0248, 0xfb78, 0xfdba, 0x024d, 0xfb8f, 0xfda4, 0x021a, 0xfbdc, 0xfdac, 0x020f, 0xfb9d, 
+	0xfdbc, 0x0224, 0xfba9, 0xfda3, 0x0297, 0xfbc5, 0xfdab, 0x028b, 0xfb86, 0xfdbc, 0x027c, 0xfb99, 0xfda8, 0x028d, 0xfbf4, 0xfdb2, 
+	0x02b0, 0xfbbf, 0xfdc0, 0x0297, 0xfbc2, 0xfdaa, 0x0264, 0xfc0e, 0xfdb9, 0x02a1, 0xfc01, 0xfdc5, 0x028c, 0xfbf1, 0xfda9, 0x0234, 
+	0xfc04, 0xfdb2, 0x0201, 0xfbdf, 0xfdc1, 0x021a, 0xfbd9, 0xfdb9, 0x0226, 0xfc17, 0xfdc6, 0x0234, 0xfc01, 0xfdbc, 0x0268, 0xfc25, 
+	0xfdc7, 0x0264, 0xfc0b, 0x0002, 0x0365, 0x01db, 0xfcb7, 0x0059, 0x006f, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 0x0003, 0x0000, 
+	0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x000f, 0x0012, 0x0009, 
+	0x0012, 0x0003, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x000f, 0x001b, 0x001b, 0x0015, 0x0009, 0x001e, 0x000c, 0x001e, 0x0018, 
+	0x001e, 0x000c, 0x0021, 0x0012, 0x0024, 0x001b, 0x0024, 0x0015, 0x0024, 0x0018, 0x0027, 0x0027, 0x0021, 0x001e, 0x002a, 0x0027, 
+	0x002a, 0x0021, 0x002a, 0x001b, 0x002d, 0x0024, 0x0030, 0x002d, 0x0030, 0x0027, 0x0033, 0x0021, 0x0036, 0x0033, 0x0036, 0x002a, 
+	0x0039, 0x0033, 0x0039, 0x0039, 0x0036, 0x002d, 0x003c, 0x0030, 0x003c, 0x0015, 0x003c, 0x002d, 0x003f, 0x0033, 0x003f, 0x0030, 
+	0x0042, 0x003f, 0x0042, 0x0039, 0x0042, 0x003c, 0x0045, 0x003f, 0x0045, 0x0042, 0x0045, 0x0036, 0x0045, 0x0316, 0x01bd, 0xfcd3, 
+	0x0322, 0x01fd, 0xfce6, 0x0326, 0x01cb, 0xfcbf, 0x0332, 0x01c1, 0xfcd7, 0x0338, 0x018f, 0xfcaf, 0x032f, 0x01f9, 0xfccd, 0x033b, 
+	0x01ef, 0xfce5, 0x0355, 0x0229, 0xfcde, 0x033f, 0x01a9, 0xfca5, 0x0353, 0x0218, 0xfcc7, 0x034b, 0x01a0, 0xfcbe, 0x0375, 0x018d, 
+	0xfc90, 0x035f, 0x020e, 0xfce0, 0x036a, 0x01a8, 0xfc8f, 0x0376, 0x019f, 0xfca8, 0x037f, 0x0217, 0xfcb1, 0x038b, 0x020d, 0xfcc9, 
+	0x038f, 0x01c8, 0xfc89, 0x03a8, 0x01b9, 0xfc88, 0x039b, 0x01be, 0xfca2, 0x0391, 0x0228, 0xfcbf, 0x0397, 0x01f6, 0xfc97, 0x03a3, 
+	0x01ec, 0xfcb0, 0x03b4, 0x01f9, 0xfc9c, 0x0002, 0x04c7, 0x0065, 0x0286, 0x0058, 0x0070, 0x0001, 0x0000, 0x0048, 0x0030, 0x0000, 
+	0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 0x0012, 0x0009, 
+	0x0012, 0x000f, 0x0012, 0x0003, 0x0015, 0x0006, 0x0018, 0x000c, 0x0018, 0x0009, 0x001b, 0x000c, 0x001b, 0x0018, 0x001b, 0x000f, 
+	0x001e, 0x0015, 0x001e, 0x0012, 0x0021, 0x0015, 0x0021, 0x001e, 0x0021, 0x000c, 0x0024, 0x0018, 0x0027, 0x0027, 0x0024, 0x001b, 
+	0x002a, 0x0027, 0x002a, 0x002a, 0x0024, 0x0015, 0x002d, 0x001e, 0x0030, 0x0030, 0x002d, 0x0021, 0x0033, 0x0030, 0x0033, 0x0033, 
+	0x002d, 0x0027, 0x0036, 0x002a, 0x0039, 0x0036, 0x0039, 0x0024, 0x003c, 0x0036, 0x003c, 0x0039, 0x003c, 0x0030, 0x003f, 0x0036, 
+	0x003f, 0x0033, 0x0042, 0x0039, 0x0042, 0x003f, 0x0042, 0x002d, 0x0045, 0x003f, 0x0045, 0x0042, 0x0045, 0x003c, 0x0045, 0x0472, 
+	0x004d, 0x0290, 0x047b, 0x0090, 0x0295, 0x0488, 0x0055, 0x027f, 0x048c, 0x0052, 0x029c, 0x049b, 0x0018, 0x0286, 0x048e, 0x0085, 
+	0x0282, 0x0493, 0x0082, 0x029f, 0x04b0, 0x00ba, 0x0291, 0x04a6, 0x002f, 0x0277, 0x04aa, 0x002c, 0x0294, 0x04b5, 0x00a3, 0x0280, 
+	0x04b9, 0x00a0, 0x029c, 0x04de, 0x0010, 0x027b, 0x04d5, 0x0029, 0x0270, 0x04d9, 0x0027, 0x028d, 0x04f3, 0x00b2, 0x0287, 0x04e5, 
+	0x009d, 0x0278, 0x04e9, 0x009b, 0x0295, 0x04fc, 0x0047, 0x026d, 0x0500, 0x0045, 0x028a, 0x0513, 0x003a, 0x0278, 0x0502, 0x0077, 
+	0x0271, 0x0506, 0x0075, 0x028e, 0x051c, 0x007d, 0x027c, 0x0002, 0x0419, 0x029c, 0x0c13, 0x0059, 0x0071, 0x0001, 0x0000, 0x0048, 
+	0x0030, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0000, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0006, 0x000f, 0x0003, 
+	0x0012, 0x0003, 0x0015, 0x000f, 0x0015, 0x000c, 0x0015, 0x0006, 0x0018, 0x0009, 0x0018, 0x000f, 0x001b, 0x0012, 0x001b, 0x0009, 
+	0x001e, 0x0009, 0x0021, 0x0018, 0x0021, 0x000c, 0x0021, 0x0012, 0x0024, 0x0012, 0x0027, 0x001b, 0x0027, 0x0015, 0x0027, 0x0018, 
+	0x002a, 0x001e, 0x002a, 0x001e, 0x002d, 0x001e, 0x0030, 0x0021, 0x0030, 0x002a, 0x0030, 0x001b, 0x0033, 0x0024, 0x0033, 0x0024, 
+	0x0036, 0x002d, 0x0036, 0x0024, 0x0039, 0x0027, 0x0039, 0x0033, 0x0039, 0x002d, 0x003c, 0x002a, 0x003c, 0x002d, 0x003f, 0x0030, 
+	0x003f, 0x003c, 0x003f, 0x0036, 0x0042, 0x0033, 0x0042, 0x003c, 0x0042, 0x0036, 0x0045, 0x0039, 0x0045, 0x0042, 0x0045, 0x003f, 
+	0x0045, 0x03f5, 0x026c, 0x0bfb, 0x03f8, 0x026a, 0x0c2c, 0x03fa, 0x0251, 0x0bf0, 0x0400, 0x028d, 0x0bd9, 0x0410, 0x0261, 0x0bf9, 
+	0x03fe, 0x024f, 0x0c34, 0x0406, 0x028a, 0x0c4e, 0x0413, 0x0260, 0x0c2a, 0x0409, 0x027f, 0x0bc1, 0x0412, 0x027b, 0x0c64, 0x0411, 
+	0x02ba, 0x0bd9, 0x041b, 0x0282, 0x0bd7, 0x0418, 0x02b7, 0x0c4e, 0x0422, 0x027f, 0x0c4c, 0x0421, 0x02bf, 0x0bc1, 0x0420, 0x02d9, 
+	0x0bfc, 0x042c, 0x02b0, 0x0bd7, 0x042a, 0x02ba, 0x0c65, 0x0422, 0x02d8, 0x0c2c, 0x0433, 0x02ad, 0x0c4d, 0x0435, 0x02ea, 0x0bf1, 
+	0x043b, 0x02cf, 0x0bfa, 0x0439, 0x02e8, 0x0c35, 0x043e, 0x02ce, 0x0c2a, 0x0002, 0xfea0, 0x032f, 0x067d, 0x001d, 0x046f, 0x0001, 
+	0x0000, 0x0024, 0x0014, 0x0000, 0x0003, 0x0000, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x000c, 0x0003, 0x000f, 0x0009, 
+	0x000f, 0x0006, 0x0012, 0x0006, 0x0015, 0x0009, 0x0015, 0x0012, 0x0018, 0x000c, 0x0018, 0x0012, 0x001b, 0x001b, 0x0015, 0x000c, 
+	0x001e, 0x000f, 0x001e, 0x0015, 0x001e, 0x0018, 0x0021, 0x001b, 0x0021, 0x0021, 0x001e, 0xfe92, 0x0321, 0x0686, 0xfe95, 0x031d, 
+	0x0677, 0xfe98, 0x0334, 0x0684, 0xfe9e, 0x0318, 0x068b, 0xfe9c, 0x032e, 0x0671, 0xfea1, 0x0314, 0x067c, 0xfe99, 0x0346, 0x067d, 
+	0xfea9, 0x0333, 0x068c, 0xfe9c, 0x0341, 0x066e, 0xfea7, 0x034b, 0x067e, 0xfeae, 0x032b, 0x0671, 0xfeaa, 0x0347, 0x066f, 0x0003, 
+	0xfcb4, 0x0000, 0xfc6a, 0x01a3, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfb9a, 
+	0x0000, 0xfb34, 0xfb9a, 0x0000, 0xfc93, 0xfdcd, 0x0000, 0xfda0, 0xfdcd, 0x0000, 0xfb34, 0x0003, 0xfcb4, 0x0000, 0xfe21, 0x01e7, 
+	0x0000, 0x0001, 0x0000, 0x000f, 0x0003, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0009, 0x000c, 0x0006, 0xfb9a, 0x0000, 
+	0xfc93, 0xfbb9, 0x0000, 0xfd6a, 0xfdcd, 0x0000, 0xfda0, 0xfbf0, 0x0000, 0xfe42, 0xfce4, 0x0000, 0xffaf, 0x0003, 0x034c, 0x0000, 
+	0xfc67, 0x01a0, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0233, 0x0000, 0xfb34, 
+	0x0233, 0x0000, 0xfd9a, 0x0466, 0x0000, 0xfb34, 0x0466, 0x0000, 0xfc93, 0x0003, 0x034c, 0x0000, 0xfe21, 0x01e7, 0x0000, 0x0001, 
+	0x0000, 0x000f, 0x0003, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0000, 0x0009, 0x000c, 0x0233, 0x0000, 0xfd9a, 0x031c, 
+	0x0000, 0xffaf, 0x0410, 0x0000, 0xfe42, 0x0447, 0x0000, 0xfd6a, 0x0466, 0x0000, 0xfc93, 0x0003, 0x0113, 0x0004, 0xffab, 0x0154, 
+	0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0006, 0x0008, 0xfedb, 0x0125, 0x0000, 
+	0x00d7, 0x0221, 0x0000, 0x0060, 0x0131, 0x0000, 0xfe7f, 0x0003, 0x0226, 0x0000, 0xfefd, 0x0163, 0x0000, 0x0001, 0x0000, 0x000c, 
+	0x0002, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0131, 0x0000, 0xfe7f, 0x0221, 0x0000, 0x0060, 0x0233, 0x0000, 0xfd9a, 
+	0x031c, 0x0000, 0xffaf, 0x0003, 0x0000, 0x0004, 0xffe9, 0x0179, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 
+	0x0003, 0x0009, 0x0006, 0xfedb, 0x0000, 0x00d7, 0x0000, 0x0000, 0x00f6, 0x0006, 0x0008, 0xfedb, 0x0125, 0x0000, 0x00d7, 0x0003, 
+	0xfef3, 0x0004, 0xffb5, 0x015e, 0x0000, 0x0001, 0x0000, 0x000c, 0x0002, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0xfddf, 
+	0x0000, 0x0060, 0xfedb, 0x0000, 0x00d7, 0x0006, 0x0008, 0xfedb, 0xfecc, 0x0000, 0xfe93, };
 	
 #endif
@@ -225,33 +225,34 @@ void jumperStartGame(display_t* disp, font_t* mmFont)
     j->scene->score = 0;
     j->scene->lives = 3;
     j->scene->currentPowerup = calloc(1, sizeof(jumperPowerup_t));
-    loadWsg("livesdonut.wsg", &j->livesIcon);
-    loadWsg("sprite017.wsg", &j->powerup);
-
-
-    loadWsg("block_0a.wsg", &j->block[0]);
-    loadWsg("block_0b.wsg", &j->block[1]);
-    loadWsg("block_0c.wsg", &j->block[2]);
-    loadWsg("block_0d.wsg", &j->block[3]);
-    loadWsg("block_0e.wsg", &j->block[4]);
-    loadWsg("block_1a.wsg", &j->block[5]);
-    loadWsg("block_1b.wsg", &j->block[6]);
-    loadWsg("block_2.wsg", &j->block[7]);
-    loadWsg("block_2b.wsg", &j->block[8]);
-    loadWsg("block_2c.wsg", &j->block[9]);
-
-    loadWsg("multiplier0.wsg", &j->digit[0]);
-    loadWsg("multiplier1.wsg", &j->digit[1]);
-    loadWsg("multiplier2.wsg", &j->digit[2]);
-    loadWsg("multiplier3.wsg", &j->digit[3]);
-    loadWsg("multiplier4.wsg", &j->digit[4]);
-    loadWsg("multiplier5.wsg", &j->digit[5]);
-    loadWsg("multiplier6.wsg", &j->digit[6]);
-    loadWsg("multiplier7.wsg", &j->digit[7]);
-    loadWsg("multiplier8.wsg", &j->digit[8]);
-    loadWsg("multiplier9.wsg", &j->digit[9]);
-    loadWsg("multiplierx.wsg", &j->digit[10]);
-    loadWsg("perfect.wsg", &j->digit[11]);
+    // Blocks, digits and the lives icon are all in one sheet
+    loadWsgAtlas("jumper.atl", &j->atlas);
+    j->livesIcon = getWsgRegion(&j->atlas, "livesdonut");
+    loadWsgFromAtlas("sprites.atl", "sprite017", &j->powerup);
+
+    j->block[0] = getWsgRegion(&j->atlas, "block_0a");
+    j->block[1] = getWsgRegion(&j->atlas, "block_0b");
+    j->block[2] = getWsgRegion(&j->atlas, "block_0c");
+    j->block[3] = getWsgRegion(&j->atlas, "block_0d");
+    j->block[4] = getWsgRegion(&j->atlas, "block_0e");
+    j->block[5] = getWsgRegion(&j->atlas, "block_1a");
+    j->block[6] = getWsgRegion(&j->atlas, "block_1b");
+    j->block[7] = getWsgRegion(&j->atlas, "block_2");
+    j->block[8] = getWsgRegion(&j->atlas, "block_2b");
+    j->block[9] = getWsgRegion(&j->atlas, "block_2c");
+
+    j->digit[0] = getWsgRegion(&j->atlas, "multiplier0");
+    j->digit[1] = getWsgRegion(&j->atlas, "multiplier1");
+    j->digit[2] = getWsgRegion(&j->atlas, "multiplier2");
+    j->digit[3] = getWsgRegion(&j->atlas, "multiplier3");
+    j->digit[4] = getWsgRegion(&j->atlas, "multiplier4");
+    j->digit[5] = getWsgRegion(&j->atlas, "multiplier5");
+    j->digit[6] = getWsgRegion(&j->atlas, "multiplier6");
+    j->digit[7] = getWsgRegion(&j->atlas, "multiplier7");
+    j->digit[8] = getWsgRegion(&j->atlas, "multiplier8");
+    j->digit[9] = getWsgRegion(&j->atlas, "multiplier9");
+    j->digit[10] = getWsgRegion(&j->atlas, "multiplierx");
+    j->digit[11] = getWsgRegion(&j->atlas, "perfect");
 
     j->player = calloc(1, sizeof(jumperCharacter_t));
 
@@ -1433,8 +1434,9 @@ void drawJumperScene(display_t* d)
     for(uint8_t block = 0; block < 30; block++)
     {
         uint8_t row = block / 6;
-        drawWsg(d, &j->block[j->scene->blocks[block]], j->scene->blockOffset_x + ((block % 6) * 38) + rowOffset[row % 5],
-                20 + j->scene->blockOffset_y + (row * 28), false, false, 0);
+        drawWsgRegion(d, &j->atlas.sheet, j->block[j->scene->blocks[block]],
+                      j->scene->blockOffset_x + ((block % 6) * 38) + rowOffset[row % 5],
+                      20 + j->scene->blockOffset_y + (row * 28), false, false);
 
     }
     
@@ -1479,7 +1481,7 @@ void drawJumperEffects(display_t* d)
         //if statement to see if mutiplier is active
         if (j->multiplier[i].digits[0] == 255)
         {            
-            drawWsg(d, &j->digit[11], j->multiplier[i].x, j->multiplier[i].y, false, false, 0);            
+            drawWsgRegion(d, &j->atlas.sheet, j->digit[11], j->multiplier[i].x, j->multiplier[i].y, false, false);            
         }
 
         if (j->multiplier[i].digits[0] >= 11 || j->multiplier[i].digits[0] == 0) continue;
@@ -1492,7 +1494,8 @@ void drawJumperEffects(display_t* d)
                 break;
             }
 
-            drawWsg(d, &j->digit[j->multiplier[i].digits[digit]], j->multiplier[i].x + (digit * 8), j->multiplier[i].y, false, false, 0);
+            drawWsgRegion(d, &j->atlas.sheet, j->digit[j->multiplier[i].digits[digit]], j->multiplier[i].x + (digit * 8),
+                          j->multiplier[i].y, false, false);
         }
 
     }
@@ -1522,7 +1525,7 @@ void drawJumperHud(display_t* d, font_t* prompt, font_t* font, font_t* outline)
 
     for (int i = 0; i < j->scene->lives; i++)
     {
-        drawWsg(d, &j->livesIcon, 25 + (i * 17), 220, false, false, 0);
+        drawWsgRegion(d, &j->atlas.sheet, j->livesIcon, 25 + (i * 17), 220, false, false);
     }
 
     //Show countdown sequence
@@ -1590,36 +1593,12 @@ void jumperExitGame(void)
         //Clear all tiles
         //clear stage
 
-        freeWsg(&j->livesIcon);
         freeWsg(&j->powerup);
         freeFont(&(j->game_font));
         freeFont(&(j->outline_font));
         freeFont(&(j->fill_font));
 
-        freeWsg(&j->block[0]);
-        freeWsg(&j->block[1]);
-        freeWsg(&j->block[2]);
-        freeWsg(&j->block[3]);
-        freeWsg(&j->block[4]);
-        freeWsg(&j->block[5]);
-        freeWsg(&j->block[6]);
-        freeWsg(&j->block[7]);
-        freeWsg(&j->block[8]);
-        freeWsg(&j->block[9]);
-
-        freeWsg(&j->digit[0]);
-        freeWsg(&j->digit[1]);
-        freeWsg(&j->digit[2]);
-        freeWsg(&j->digit[3]);
-        freeWsg(&j->digit[4]);
-        freeWsg(&j->digit[5]);
-        freeWsg(&j->digit[6]);
-        freeWsg(&j->digit[7]);
-        freeWsg(&j->digit[8]);
-        freeWsg(&j->digit[9]);
-        freeWsg(&j->digit[10]);
-        freeWsg(&j->digit[11]);
-
+        freeWsgAtlas(&j->atlas);
 
         freeWsg(&j->player->frames[0]);
         freeWsg(&j->player->frames[1]);
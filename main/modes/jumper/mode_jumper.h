@@ -118,9 +118,10 @@ typedef struct
 
 typedef struct
 {
-    wsg_t block[10];
-    wsg_t digit[12];
-    wsg_t livesIcon;
+    wsgAtlas_t atlas;
+    const wsgRegion_t* block[10];
+    const wsgRegion_t* digit[12];
+    const wsgRegion_t* livesIcon;
     wsg_t powerup;
     jumperGamePhase_t currentPhase;
     int64_t frameElapsed;
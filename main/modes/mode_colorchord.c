@@ -344,14 +344,21 @@ void colorchordButtonCb(buttonEvt_t* evt)
  */
 void colorchordAudioCb(uint16_t* samples, uint32_t sampleCnt)
 {
-    // For each sample
-    for(uint32_t idx = 0; idx < sampleCnt; idx++)
+    // While there are samples left
+    while(sampleCnt > 0)
     {
-        // Push to colorchord
-        PushSample32(&colorchord->dd, samples[idx]);
+        // Push samples to colorchord, up to the next 128 sample boundary
+        uint32_t toPush = 128 - colorchord->samplesProcessed;
+        if(toPush > sampleCnt)
+        {
+            toPush = sampleCnt;
+        }
+        PushSamples32(&colorchord->dd, (const int16_t*)samples, toPush);
+        samples += toPush;
+        sampleCnt -= toPush;
 
         // If 128 samples have been pushed
-        colorchord->samplesProcessed++;
+        colorchord->samplesProcessed += toPush;
         if(colorchord->samplesProcessed >= 128)
         {
             // Update LEDs
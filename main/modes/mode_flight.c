@@ -99,15 +99,26 @@ typedef enum
     FLIGHT_PERFTEST,
 } flightModeScreen;
 
+// One level of detail of a model, see tools/objProcessor. Indices are
+// premultiplied by 3 and come first, then the vertices in the order they're
+// first used.
 typedef struct
 {
+    uint16_t mindepth; // Drawn from this depth on, 0 for the whole model
     uint16_t nrvertnums;
     uint16_t nrfaces;
+    int16_t indices_and_vertices[1];
+} tdModelLOD;
+
+// A model is followed by nrlods LODs, from the whole model to the simplest.
+typedef struct
+{
     uint16_t indices_per_face;
     int16_t center[3];
     int16_t radius;
     uint16_t label;
-    int16_t indices_and_vertices[1];
+    uint16_t nrlods;
+    tdModelLOD lods;
 } tdModel;
 
 
@@ -179,7 +190,7 @@ static void flightGameUpdate( flight_t * tflight );
 static void flightUpdateLEDs(flight_t * tflight);
 static void flightLEDAnimate( flLEDAnimation anim );
 int tdModelVisibilitycheck( const tdModel * m );
-void tdDrawModel( display_t * disp, const tdModel * m );
+void tdDrawModel( display_t * disp, const tdModel * m, int depth );
 static int flightTimeHighScorePlace( int wintime, bool is100percent );
 static void flightTimeHighScoreInsert( int insertplace, bool is100percent, char * name, int timeCentiseconds );
 
@@ -252,7 +263,13 @@ static void flightEnterMode(display_t * disp)
     for( i = 0; i < flight->enviromodels; i++ )
     {
         const tdModel * m = flight->environment[i] = (const tdModel*)data;
-        data += 8 + m->nrvertnums + m->nrfaces * m->indices_per_face;
+        data += offsetof( tdModel, lods ) / sizeof( uint16_t );
+        int l;
+        for( l = 0; l < m->nrlods; l++ )
+        {
+            const tdModelLOD * lod = (const tdModelLOD*)data;
+            data += offsetof( tdModelLOD, indices_and_vertices ) / sizeof( uint16_t ) + lod->nrvertnums + lod->nrfaces * m->indices_per_face;
+        }
     }
 
     loadFont("ibm_vga8.font", &flight->ibm);
@@ -793,19 +810,33 @@ int tdModelVisibilitycheck( const tdModel * m )
     }
 }
 
-void tdDrawModel( display_t * disp, const tdModel * m )
+/**
+ * Draw a model, as simple as it can be drawn at this depth
+ *
+ * @param disp The display to draw to
+ * @param m The model
+ * @param depth The depth tdModelVisibilitycheck() returned, which must not be negative
+ */
+void tdDrawModel( display_t * disp, const tdModel * m, int depth )
 {
     int i;
 
-    int nrv = m->nrvertnums;
-    int nri = m->nrfaces*m->indices_per_face;
-    const int16_t * verticesmark = (const int16_t*)&m->indices_and_vertices[nri];
-
-    if( tdModelVisibilitycheck( m ) < 0 )
+    //Pick the simplest LOD which may be drawn this far away.
+    const tdModelLOD * lod = &m->lods;
+    for( i = 1; i < m->nrlods; i++ )
     {
-        return;
+        const tdModelLOD * next = (const tdModelLOD*)&lod->indices_and_vertices[lod->nrfaces*m->indices_per_face + lod->nrvertnums];
+        if( depth < next->mindepth )
+        {
+            break;
+        }
+        lod = next;
     }
 
+    int nrv = lod->nrvertnums;
+    int nri = lod->nrfaces*m->indices_per_face;
+    const int16_t * verticesmark = (const int16_t*)&lod->indices_and_vertices[nri];
+
 
     //This looks a little odd, but what we're doing is caching our vertex computations
     //so we don't have to re-compute every time round.
@@ -825,8 +856,8 @@ void tdDrawModel( display_t * disp, const tdModel * m )
     {
         for( i = 0; i < nri; i+=2 )
         {
-            int i1 = m->indices_and_vertices[i];
-            int i2 = m->indices_and_vertices[i+1];
+            int i1 = lod->indices_and_vertices[i];
+            int i2 = lod->indices_and_vertices[i+1];
             int16_t * cv1 = &cached_verts[i1];
             int16_t * cv2 = &cached_verts[i2];
 
@@ -840,9 +871,9 @@ void tdDrawModel( display_t * disp, const tdModel * m )
     {
         for( i = 0; i < nri; i+=3 )
         {
-            int i1 = m->indices_and_vertices[i];
-            int i2 = m->indices_and_vertices[i+1];
-            int i3 = m->indices_and_vertices[i+2];
+            int i1 = lod->indices_and_vertices[i];
+            int i2 = lod->indices_and_vertices[i+1];
+            int i3 = lod->indices_and_vertices[i+2];
             int16_t * cv1 = &cached_verts[i1];
             int16_t * cv2 = &cached_verts[i2];
             int16_t * cv3 = &cached_verts[i3];
@@ -1048,7 +1079,7 @@ static void flightRender()
         //draw = 2 = flashing
         //draw = 3 = other flashing
         if( draw == 1 )
-            tdDrawModel( disp, m );
+            tdDrawModel( disp, m, mrp[i].mrange );
         else if( draw == 2 || draw == 3 )
         {
             if( draw == 2 )
@@ -1062,7 +1093,7 @@ static void flightRender()
                 //renderlinecolor = (tflight->frames&1)?CNDRAW_BLACK:CNDRAW_WHITE;
                 renderlinecolor = ((tflight->frames+i))&127;
             }
-            tdDrawModel( disp, m );
+            tdDrawModel( disp, m, mrp[i].mrange );
             renderlinecolor = CNDRAW_WHITE;
         }
     }
@@ -621,14 +621,21 @@ void testTouchCb(touch_event_t* evt)
  */
 void testAudioCb(uint16_t* samples, uint32_t sampleCnt)
 {
-    // For each sample
-    for(uint32_t idx = 0; idx < sampleCnt; idx++)
+    // While there are samples left
+    while(sampleCnt > 0)
     {
-        // Push to test
-        PushSample32(&test->dd, samples[idx]);
+        // Push samples to test, up to the next 128 sample boundary
+        uint32_t toPush = 128 - test->samplesProcessed;
+        if(toPush > sampleCnt)
+        {
+            toPush = sampleCnt;
+        }
+        PushSamples32(&test->dd, (const int16_t*)samples, toPush);
+        samples += toPush;
+        sampleCnt -= toPush;
 
         // If 128 samples have been pushed
-        test->samplesProcessed++;
+        test->samplesProcessed += toPush;
         if(test->samplesProcessed >= 128)
         {
             // Update LEDs
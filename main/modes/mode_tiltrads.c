@@ -21,6 +21,7 @@
 #include "linked_list.h" // custom linked list
 #include "nvs_manager.h" // saving and loading high scores and last scores
 #include "musical_buzzer.h" // music and sfx
+#include "spiffs_song.h" // title music
 #include "led_util.h" // leds
 
 //NOTES:
@@ -657,270 +658,6 @@ const song_t* landSFX[NUM_LAND_FX] =
     &lineOneSFX
 };
 
-const song_t titleMusic =
-{
-    .notes = {
-        {.note = C_6, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_6, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_6, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_6, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = E_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = C_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = A_SHARP_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = SILENCE, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = G_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = F_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_5, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-        {.note = D_4, .timeMs = 159},
-        {.note = SILENCE, .timeMs = 1},
-    },
-    .numNotes = 256,
-    .shouldLoop = true
-};
-
 const song_t gameStartSting  =
 {
     .notes = {
@@ -1120,6 +857,9 @@ typedef struct
     // fonts.
     font_t ibm_vga8;
     font_t radiostars;
+
+    // Title music, loaded from SPIFFS
+    song_t* titleMusic;
 } tiltrads_t;
 
 // Struct pointer.
@@ -1284,6 +1024,9 @@ void ttInit(display_t* disp)
     loadFont("ibm_vga8.font", &(tiltrads->ibm_vga8));
     loadFont("radiostars.font", &(tiltrads->radiostars));
 
+    // Load the title music.
+    loadSong("tiltrads_title.sng", &(tiltrads->titleMusic));
+
     // Initialize a lot of variables.
     tiltrads->randomizer = POOL;
     tiltrads->typeBag[0] = I_TETRAD;
@@ -1338,6 +1081,7 @@ void ttDeInit(void)
     freeFont(&(tiltrads->radiostars));
 
     buzzer_stop();
+    freeSong(tiltrads->titleMusic);
 
     deInitLandedTetrads();
     deInitTypeOrder();
@@ -2270,7 +2014,10 @@ void ttChangeState(tiltradsState_t newState)
             if (prevState != TT_SCORES)
             {
                 buzzer_stop();
-                buzzer_play_bgm(&titleMusic);
+                if (NULL != tiltrads->titleMusic)
+                {
+                    buzzer_play_bgm(tiltrads->titleMusic);
+                }
             }
 
             break;
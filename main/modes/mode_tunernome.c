@@ -25,6 +25,7 @@
 #include "linked_list.h"
 #include "mode_main_menu.h"
 #include "musical_buzzer.h"
+#include "pitch_tracker.h"
 #include "swadgeMode.h"
 #include "settingsManager.h"
 
@@ -44,10 +45,11 @@
 #define NUM_GUITAR_STRINGS    6
 #define NUM_VIOLIN_STRINGS    4
 #define NUM_UKULELE_STRINGS   4
-#define GUITAR_OFFSET         0
 #define CHROMATIC_OFFSET      6 // adjust start point by quartertones
 #define SENSITIVITY           5
 #define TONAL_DIFF_IN_TUNE_DEVIATION 10
+#define PT_SENSITIVITY        2 // The pitch tracker updates every 64ms, so it needs less filtering
+#define NUM_SEMITONE_OCTAVES  4 // Semitones are tracked from octave 2 through 5
 
 #define METRONOME_CENTER_X    tunernome->disp->w / 2
 #define METRONOME_CENTER_Y    tunernome->disp->h - 16 - CORNER_OFFSET
@@ -115,6 +117,7 @@ typedef struct
     embeddednf_data end;
     embeddedout_data eod;
     int audioSamplesProcessed;
+    pitchTracker_t pt;
     uint32_t intensities_filt[NUM_LEDS];
     int32_t diffs_filt[NUM_LEDS];
 
@@ -162,16 +165,14 @@ void recalcMetronome(void);
 void plotInstrumentNameAndNotes(const char* instrumentName, const char** instrumentNotes,
                                 uint16_t numNotes);
 void plotTopSemiCircle(int xm, int ym, int r, paletteColor_t col);
-void instrumentTunerMagic(const uint16_t freqBinIdxs[], uint16_t numStrings, led_t colors[],
-                          const uint16_t stringIdxToLedIdx[]);
+void instrumentTunerMagic(uint16_t numStrings, led_t colors[], const uint16_t stringIdxToLedIdx[]);
+void semitoneTunerMagic(uint8_t semitone, led_t colors[]);
+void setupPitchTracker(void);
 void tunernomeMainLoop(int64_t elapsedUs);
 void ledReset(void* timer_arg);
 void fasterBpmChange(void* timer_arg);
 
-static inline int16_t getMagnitude(uint16_t idx);
-static inline int16_t getDiffAround(uint16_t idx);
 static inline int16_t getSemiMagnitude(int16_t idx);
-static inline int16_t getSemiDiffAround(uint16_t idx);
 void tnExitTimerFn(void* arg);
 
 /*============================================================================
@@ -199,41 +200,58 @@ tunernome_t* tunernome;
  *==========================================================================*/
 
 /**
- * Indicies into fuzzed_bins[], a realtime DFT of sorts
- * fuzzed_bins[0] = A ... 1/2 steps are every 2.
+ * Frequencies of each string, for the pitch tracker
  */
-const uint16_t freqBinIdxsGuitar[NUM_GUITAR_STRINGS] =
+const uint32_t freqsGuitar[NUM_GUITAR_STRINGS] =
 {
-    38, // E string needs to skip an octave... Can't read sounds this low.
-    24, // A string is exactly at note #24
-    34, // D = A + 5 half steps = 34
-    44, // G
-    52, // B
-    62  // e
+    PT_HZ(82.407),  // E2
+    PT_HZ(110.000), // A2
+    PT_HZ(146.832), // D3
+    PT_HZ(195.998), // G3
+    PT_HZ(246.942), // B3
+    PT_HZ(329.628)  // E4
 };
 
 /**
- * Indicies into fuzzed_bins[], a realtime DFT of sorts
- * fuzzed_bins[0] = A ... 1/2 steps are every 2.
+ * Frequencies of each string, for the pitch tracker
  */
-const uint16_t freqBinIdxsViolin[NUM_VIOLIN_STRINGS] =
+const uint32_t freqsViolin[NUM_VIOLIN_STRINGS] =
 {
-    44, // G
-    58, // D
-    72, // A
-    86  // E
+    PT_HZ(195.998), // G3
+    PT_HZ(293.665), // D4
+    PT_HZ(440.000), // A4
+    PT_HZ(659.255)  // E5
 };
 
 /**
- * Indicies into fuzzed_bins[], a realtime DFT of sorts
- * fuzzed_bins[0] = A ... 1/2 steps are every 2.
+ * Frequencies of each string, for the pitch tracker
  */
-const uint16_t freqBinIdxsUkulele[NUM_UKULELE_STRINGS] =
+const uint32_t freqsUkulele[NUM_UKULELE_STRINGS] =
 {
-    68, // G
-    54, // C
-    62, // E
-    72  // A
+    PT_HZ(391.995), // G4
+    PT_HZ(261.626), // C4
+    PT_HZ(329.628), // E4
+    PT_HZ(440.000)  // A4
+};
+
+/**
+ * Frequencies of each semitone in octave 2, for the pitch tracker. Each
+ * semitone is tracked in NUM_SEMITONE_OCTAVES octaves starting here
+ */
+const uint32_t freqsSemitoneOctave2[NUM_SEMITONES] =
+{
+    PT_HZ(65.406),  // C2
+    PT_HZ(69.296),  // C#2
+    PT_HZ(73.416),  // D2
+    PT_HZ(77.782),  // D#2
+    PT_HZ(82.407),  // E2
+    PT_HZ(87.307),  // F2
+    PT_HZ(92.499),  // F#2
+    PT_HZ(97.999),  // G2
+    PT_HZ(103.826), // G#2
+    PT_HZ(110.000), // A2
+    PT_HZ(116.541), // A#2
+    PT_HZ(123.471)  // B2
 };
 
 const uint16_t fourNoteStringIdxToLedIdx[4] =
@@ -366,6 +384,7 @@ void tunernomeEnterMode(display_t* disp)
     switchToSubmode(TN_TUNER);
 
     InitColorChord(&tunernome->end, &tunernome->dd);
+    setupPitchTracker();
 
     tunernome->exitTimeStartUs = 0;
     tunernome->exitTimeAccumulatedUs = 0;
@@ -446,29 +465,6 @@ void tunernomeExitMode(void)
     free(tunernome);
 }
 
-/**
- * Inline helper function to get the magnitude of a frequency bin from fuzzed_bins[]
- *
- * @param idx The index to get a magnitude from
- * @return A signed magnitude, even though fuzzed_bins[] is unsigned
- */
-static inline int16_t getMagnitude(uint16_t idx)
-{
-    return tunernome->end.fuzzed_bins[idx];
-}
-
-/**
- * Inline helper function to get the difference in magnitudes around a given
- * frequency bin from fuzzed_bins[]
- *
- * @param idx The index to get a difference in magnitudes around
- * @return The difference in magnitudes of the bins before and after the given index
- */
-static inline int16_t getDiffAround(uint16_t idx)
-{
-    return getMagnitude(idx + 1) - getMagnitude(idx - 1);
-}
-
 /**
  * Inline helper function to get the magnitude of a frequency bin from folded_bins[]
  *
@@ -488,18 +484,6 @@ static inline int16_t getSemiMagnitude(int16_t idx)
     return tunernome->end.folded_bins[idx];
 }
 
-/**
- * Inline helper function to get the difference in magnitudes around a given
- * frequency bin from folded_bins[]
- *
- * @param idx The index to get a difference in magnitudes around
- * @return The difference in magnitudes of the bins before and after the given index
- */
-static inline int16_t getSemiDiffAround(uint16_t idx)
-{
-    return getSemiMagnitude(idx + 1) - getSemiMagnitude(idx - 1);
-}
-
 /**
  * Recalculate the per-bpm values for the metronome
  */
@@ -561,32 +545,91 @@ void plotInstrumentNameAndNotes(const char* instrumentName, const char** instrum
 }
 
 /**
- * Instrument-agnostic tuner magic. Updates LEDs
- * @param freqBinIdxs An array of the indices of notes for the instrument's strings. See freqBinIdxsGuitar for an example.
- * @param numStrings The number of strings on the instrument, also the number of elements in freqBinIdxs and stringIdxToLedIdx, if applicable
+ * Set up the pitch tracker for the current tuner mode
+ */
+void setupPitchTracker(void)
+{
+    switch(tunernome->curTunerMode)
+    {
+        case GUITAR_TUNER:
+        {
+            pitchTrackerInit(&tunernome->pt, freqsGuitar, NUM_GUITAR_STRINGS);
+            break;
+        }
+        case VIOLIN_TUNER:
+        {
+            pitchTrackerInit(&tunernome->pt, freqsViolin, NUM_VIOLIN_STRINGS);
+            break;
+        }
+        case UKULELE_TUNER:
+        {
+            pitchTrackerInit(&tunernome->pt, freqsUkulele, NUM_UKULELE_STRINGS);
+            break;
+        }
+        case SEMITONE_0:
+        case SEMITONE_1:
+        case SEMITONE_2:
+        case SEMITONE_3:
+        case SEMITONE_4:
+        case SEMITONE_5:
+        case SEMITONE_6:
+        case SEMITONE_7:
+        case SEMITONE_8:
+        case SEMITONE_9:
+        case SEMITONE_10:
+        case SEMITONE_11:
+        {
+            // Track the same semitone in a few octaves
+            uint32_t freqs[NUM_SEMITONE_OCTAVES];
+            for(uint8_t i = 0; i < NUM_SEMITONE_OCTAVES; i++)
+            {
+                freqs[i] = freqsSemitoneOctave2[tunernome->curTunerMode - SEMITONE_0] << i;
+            }
+            pitchTrackerInit(&tunernome->pt, freqs, NUM_SEMITONE_OCTAVES);
+            break;
+        }
+        case LISTENING:
+        case MAX_GUITAR_MODES:
+        default:
+        {
+            // Listening uses colorchord, not the pitch tracker
+            pitchTrackerInit(&tunernome->pt, NULL, 0);
+            break;
+        }
+    }
+
+    memset(tunernome->intensities_filt, 0, sizeof(tunernome->intensities_filt));
+    memset(tunernome->diffs_filt, 0, sizeof(tunernome->diffs_filt));
+    memset(tunernome->semitone_intensitiy_filt, 0, sizeof(tunernome->semitone_intensitiy_filt));
+    memset(tunernome->semitone_diff_filt, 0, sizeof(tunernome->semitone_diff_filt));
+}
+
+/**
+ * Instrument-agnostic tuner magic. Updates LEDs from the pitch tracker, which
+ * must have one bin per string
+ * @param numStrings The number of strings on the instrument, also the number of bins in the pitch tracker and elements in stringIdxToLedIdx, if applicable
  * @param colors The RGB colors of the LEDs to set
- * @param stringIdxToLedIdx A remapping from each index into freqBinIdxs (same index into stringIdxToLedIdx), to the index of an LED to map that string/freqBinIdx to. Set to NULL to skip remapping.
+ * @param stringIdxToLedIdx A remapping from each string index to the index of an LED to map that string to. Set to NULL to skip remapping.
  */
-void instrumentTunerMagic(const uint16_t freqBinIdxs[], uint16_t numStrings, led_t colors[],
-                          const uint16_t stringIdxToLedIdx[])
+void instrumentTunerMagic(uint16_t numStrings, led_t colors[], const uint16_t stringIdxToLedIdx[])
 {
     uint32_t i;
     for( i = 0; i < numStrings; i++ )
     {
         // Pick out the current magnitude and filter it
-        tunernome->intensities_filt[i] = (getMagnitude(freqBinIdxs[i] + GUITAR_OFFSET) + tunernome->intensities_filt[i]) -
-                                         (tunernome->intensities_filt[i] >> 5);
+        tunernome->intensities_filt[i] = (tunernome->pt.bins[i].magnitude + tunernome->intensities_filt[i]) -
+                                         (tunernome->intensities_filt[i] >> PT_SENSITIVITY);
 
-        // Pick out the difference around current magnitude and filter it too
-        tunernome->diffs_filt[i] = (getDiffAround(freqBinIdxs[i] + GUITAR_OFFSET) + tunernome->diffs_filt[i]) -
-                                   (tunernome->diffs_filt[i] >> 5);
+        // Pick out the deviation from the string's frequency and filter it too
+        tunernome->diffs_filt[i] = (tunernome->pt.bins[i].centiCents + tunernome->diffs_filt[i]) -
+                                   (tunernome->diffs_filt[i] >> PT_SENSITIVITY);
 
-        // This is the magnitude of the target frequency bin, cleaned up
-        int16_t intensity = (tunernome->intensities_filt[i] >> SENSITIVITY) - 40; // drop a baseline.
+        // This is the magnitude of the target frequency, cleaned up
+        int16_t intensity = (tunernome->intensities_filt[i] >> PT_SENSITIVITY) - 40; // drop a baseline.
         intensity = CLAMP(intensity, 0, 255);
 
-        // This is the tonal difference. You "calibrate" out the intensity.
-        int16_t tonalDiff = (tunernome->diffs_filt[i] >> SENSITIVITY) * 200 / (intensity + 1);
+        // This is the tonal difference, in cents
+        int16_t tonalDiff = CLAMP((tunernome->diffs_filt[i] >> PT_SENSITIVITY) / 100, -1200, 1200);
 
         int32_t red, grn, blu;
         // Is the note in tune, i.e. is the magnitude difference in surrounding bins small?
@@ -778,12 +821,13 @@ void tunernomeMainLoop(int64_t elapsedUs)
                 case SEMITONE_11:
                 default:
                 {
-                    // Draw tuner needle based on the value of tonalDiff, which is at most -32768 to 32767
-                    // clamp it to the range -180 -> 180
-                    int16_t clampedTonalDiff = CLAMP(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] / 2, -180, 180);
+                    // Draw tuner needle based on the value of tonalDiff, which is in cents.
+                    // Scale it so the needle crosses the dashed lines at TONAL_DIFF_IN_TUNE_DEVIATION
+                    // cents and clamp it to the range -180 -> 180, about 57 cents either way
+                    int16_t clampedTonalDiff = CLAMP((tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] * 54) / 17, -180, 180);
 
                     // If the signal isn't intense enough, don't move the needle
-                    if(tunernome->semitone_intensitiy_filt[tunernome->curTunerMode - SEMITONE_0] < 1000)
+                    if(0 == tunernome->intensity[tunernome->curTunerMode - SEMITONE_0])
                     {
                         clampedTonalDiff = -180;
                     }
@@ -1043,6 +1087,7 @@ void tunernomeButtonCallback(buttonEvt_t* evt)
                     case UP:
                     {
                         tunernome->curTunerMode = (tunernome->curTunerMode + 1) % MAX_GUITAR_MODES;
+                        setupPitchTracker();
                         break;
                     }
                     case DOWN:
@@ -1055,6 +1100,7 @@ void tunernomeButtonCallback(buttonEvt_t* evt)
                         {
                             tunernome->curTunerMode--;
                         }
+                        setupPitchTracker();
                         break;
                     }
                     case BTN_A:
@@ -1165,6 +1211,93 @@ void modifyBpm(int16_t bpmMod)
     recalcMetronome();
 }
 
+/**
+ * Single semitone tuner magic. Updates LEDs from the pitch tracker, which must
+ * have one bin per octave of the semitone
+ *
+ * @param semitone The semitone being tuned, 0 is C
+ * @param colors The RGB colors of the LEDs to set
+ */
+void semitoneTunerMagic(uint8_t semitone, led_t colors[])
+{
+    // Use whichever octave is loudest
+    pitchBin_t* loudest = &tunernome->pt.bins[0];
+    for(uint8_t i = 1; i < tunernome->pt.numBins; i++)
+    {
+        if(tunernome->pt.bins[i].magnitude > loudest->magnitude)
+        {
+            loudest = &tunernome->pt.bins[i];
+        }
+    }
+
+    // Pick out the current magnitude and filter it
+    tunernome->semitone_intensitiy_filt[semitone] = (loudest->magnitude +
+            tunernome->semitone_intensitiy_filt[semitone]) -
+            (tunernome->semitone_intensitiy_filt[semitone] >> PT_SENSITIVITY);
+
+    // Pick out the deviation from the semitone and filter it too
+    tunernome->semitone_diff_filt[semitone] = (loudest->centiCents +
+            tunernome->semitone_diff_filt[semitone]) -
+            (tunernome->semitone_diff_filt[semitone] >> PT_SENSITIVITY);
+
+    // This is the magnitude of the target frequency, cleaned up
+    tunernome->intensity[semitone] = (tunernome->semitone_intensitiy_filt[semitone] >> PT_SENSITIVITY) -
+                                     40; // drop a baseline.
+    tunernome->intensity[semitone] = CLAMP(tunernome->intensity[semitone], 0, 255);
+
+    // This is the tonal difference, in cents
+    tunernome->tonalDiff[semitone] = CLAMP((tunernome->semitone_diff_filt[semitone] >> PT_SENSITIVITY) / 100,
+                                           -1200, 1200);
+
+    // tonal diff is in cents. if its within -10 to 10 (now defined as TONAL_DIFF_IN_TUNE_DEVIATION), it's in tune.
+    // positive means too sharp, negative means too flat
+    // intensity is how 'loud' that frequency is, 0 to 255. you'll have to play around with values
+    int32_t red, grn, blu;
+    // Is the note in tune, i.e. is the deviation small?
+    if( (ABS(tunernome->tonalDiff[semitone]) < TONAL_DIFF_IN_TUNE_DEVIATION) )
+    {
+        // Note is in tune, make it white
+        red = 255;
+        grn = 255;
+        blu = 255;
+    }
+    else
+    {
+        // Check if the note is sharp or flat
+        if( tunernome->tonalDiff[semitone] > 0 )
+        {
+            // Note too sharp, make it red
+            red = 255;
+            grn = blu = 255 - (tunernome->tonalDiff[semitone] - TONAL_DIFF_IN_TUNE_DEVIATION) * 15;
+        }
+        else
+        {
+            // Note too flat, make it blue
+            blu = 255;
+            grn = red = 255 - (-(tunernome->tonalDiff[semitone] + TONAL_DIFF_IN_TUNE_DEVIATION)) * 15;
+        }
+
+        // Make sure LED output isn't more than 255
+        red = CLAMP(red, INT_MIN, 255);
+        grn = CLAMP(grn, INT_MIN, 255);
+        blu = CLAMP(blu, INT_MIN, 255);
+    }
+
+    // Scale each LED's brightness by the filtered intensity for that bin
+    red = (red >> 3 ) * ( tunernome->intensity[semitone] >> 3);
+    grn = (grn >> 3 ) * ( tunernome->intensity[semitone] >> 3);
+    blu = (blu >> 3 ) * ( tunernome->intensity[semitone] >> 3);
+
+    // Set the LED, ensure each channel is between 0 and 255
+    uint32_t i;
+    for (i = 0; i < NUM_GUITAR_STRINGS; i++)
+    {
+        colors[i].r = CLAMP(red, 0, 255);
+        colors[i].g = CLAMP(grn, 0, 255);
+        colors[i].b = CLAMP(blu, 0, 255);
+    }
+}
+
 /**
  * This function is called whenever audio samples are read from the
  * microphone (ADC) and are ready for processing. Samples are read at 8KHz.
@@ -1174,12 +1307,15 @@ void modifyBpm(int16_t bpmMod)
  */
 void tunernomeSampleHandler(uint16_t* samples, uint32_t sampleCnt)
 {
-    if(tunernome->mode == TN_TUNER)
+    if(tunernome->mode != TN_TUNER)
     {
-        for(uint32_t i = 0; i < sampleCnt; i++)
-        {
-            PushSample32( &tunernome->dd, samples[i] );
-        }
+        return;
+    }
+
+    if(LISTENING == tunernome->curTunerMode)
+    {
+        // Listening for any note needs the full colorchord DFT
+        PushSamples32( &tunernome->dd, (const int16_t*)samples, sampleCnt );
         tunernome->audioSamplesProcessed += sampleCnt;
 
         // If at least 128 samples have been processed
@@ -1188,126 +1324,73 @@ void tunernomeSampleHandler(uint16_t* samples, uint32_t sampleCnt)
             // Colorchord magic
             HandleFrameInfo(&tunernome->end, &tunernome->dd);
 
-            led_t colors[NUM_LEDS] = {{0}};
-
-            switch(tunernome->curTunerMode)
+            for(uint8_t semitone = 0; semitone < NUM_SEMITONES; semitone++)
             {
-                case GUITAR_TUNER:
-                {
-                    instrumentTunerMagic(freqBinIdxsGuitar, NUM_GUITAR_STRINGS, colors, NULL);
-                    break;
-                }
-                case VIOLIN_TUNER:
-                {
-                    instrumentTunerMagic(freqBinIdxsViolin, NUM_VIOLIN_STRINGS, colors, fourNoteStringIdxToLedIdx);
-                    break;
-                }
-                case UKULELE_TUNER:
-                {
-                    instrumentTunerMagic(freqBinIdxsUkulele, NUM_UKULELE_STRINGS, colors, fourNoteStringIdxToLedIdx);
-                    break;
-                }
-                case MAX_GUITAR_MODES:
-                    break;
-                case SEMITONE_0:
-                case SEMITONE_1:
-                case SEMITONE_2:
-                case SEMITONE_3:
-                case SEMITONE_4:
-                case SEMITONE_5:
-                case SEMITONE_6:
-                case SEMITONE_7:
-                case SEMITONE_8:
-                case SEMITONE_9:
-                case SEMITONE_10:
-                case SEMITONE_11:
-                case LISTENING:
-                default:
-                {
-                    for(uint8_t semitone = 0; semitone < NUM_SEMITONES; semitone++)
-                    {
-                        // uint8_t semitoneIdx = (tunernome->curTunerMode - SEMITONE_0) * 2;
-                        uint8_t semitoneIdx = semitone * 2;
-                        // Pick out the current magnitude and filter it
-                        tunernome->semitone_intensitiy_filt[semitone] = (getSemiMagnitude(semitoneIdx + CHROMATIC_OFFSET) +
-                                tunernome->semitone_intensitiy_filt[semitone]) -
-                                (tunernome->semitone_intensitiy_filt[semitone] >> 5);
-
-                        // Pick out the difference around current magnitude and filter it too
-                        tunernome->semitone_diff_filt[semitone] = (getSemiDiffAround(semitoneIdx + CHROMATIC_OFFSET) +
-                                tunernome->semitone_diff_filt[semitone]) -
-                                (tunernome->semitone_diff_filt[semitone] >> 5);
-
-
-                        // This is the magnitude of the target frequency bin, cleaned up
-                        tunernome->intensity[semitone] = (tunernome->semitone_intensitiy_filt[semitone] >> SENSITIVITY) -
-                                                         40; // drop a baseline.
-                        tunernome->intensity[semitone] = CLAMP(tunernome->intensity[semitone], 0, 255);
-
-                        //This is the tonal difference. You "calibrate" out the intensity.
-                        tunernome->tonalDiff[semitone] = (tunernome->semitone_diff_filt[semitone] >> SENSITIVITY) * 200 /
-                                                         (tunernome->intensity[semitone] + 1);
-                    }
-
-                    // tonal diff is -32768 to 32767. if its within -10 to 10 (now defined as TONAL_DIFF_IN_TUNE_DEVIATION), it's in tune.
-                    // positive means too sharp, negative means too flat
-                    // intensity is how 'loud' that frequency is, 0 to 255. you'll have to play around with values
-                    int32_t red, grn, blu;
-                    // Is the note in tune, i.e. is the magnitude difference in surrounding bins small?
-                    if( (ABS(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0]) < TONAL_DIFF_IN_TUNE_DEVIATION) )
-                    {
-                        // Note is in tune, make it white
-                        red = 255;
-                        grn = 255;
-                        blu = 255;
-                    }
-                    else
-                    {
-                        // Check if the note is sharp or flat
-                        if( tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] > 0 )
-                        {
-                            // Note too sharp, make it red
-                            red = 255;
-                            grn = blu = 255 - (tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] - TONAL_DIFF_IN_TUNE_DEVIATION) * 15;
-                        }
-                        else
-                        {
-                            // Note too flat, make it blue
-                            blu = 255;
-                            grn = red = 255 - (-(tunernome->tonalDiff[tunernome->curTunerMode - SEMITONE_0] + TONAL_DIFF_IN_TUNE_DEVIATION)) * 15;
-                        }
-
-                        // Make sure LED output isn't more than 255
-                        red = CLAMP(red, INT_MIN, 255);
-                        grn = CLAMP(grn, INT_MIN, 255);
-                        blu = CLAMP(blu, INT_MIN, 255);
-                    }
-
-                    // Scale each LED's brightness by the filtered intensity for that bin
-                    red = (red >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
-                    grn = (grn >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
-                    blu = (blu >> 3 ) * ( tunernome->intensity[tunernome->curTunerMode - SEMITONE_0] >> 3);
+                uint8_t semitoneIdx = semitone * 2;
+                // Pick out the current magnitude and filter it
+                tunernome->semitone_intensitiy_filt[semitone] = (getSemiMagnitude(semitoneIdx + CHROMATIC_OFFSET) +
+                        tunernome->semitone_intensitiy_filt[semitone]) -
+                        (tunernome->semitone_intensitiy_filt[semitone] >> 5);
+
+                // This is the magnitude of the target frequency bin, cleaned up
+                tunernome->intensity[semitone] = (tunernome->semitone_intensitiy_filt[semitone] >> SENSITIVITY) -
+                                                 40; // drop a baseline.
+                tunernome->intensity[semitone] = CLAMP(tunernome->intensity[semitone], 0, 255);
+            }
 
-                    // Set the LED, ensure each channel is between 0 and 255
-                    uint32_t i;
-                    for (i = 0; i < NUM_GUITAR_STRINGS; i++)
-                    {
-                        colors[i].r = CLAMP(red, 0, 255);
-                        colors[i].g = CLAMP(grn, 0, 255);
-                        colors[i].b = CLAMP(blu, 0, 255);
-                    }
+            // Reset the sample count
+            tunernome->audioSamplesProcessed = 0;
+        }
+        return;
+    }
 
-                    break;
-                } // default:
-            } // switch(tunernome->curTunerMode)
+    // Everything else only needs to track a few frequencies
+    if(pitchTrackerPushSamples(&tunernome->pt, (const int16_t*)samples, sampleCnt))
+    {
+        led_t colors[NUM_LEDS] = {{0}};
 
-            if(LISTENING != tunernome->curTunerMode)
+        switch(tunernome->curTunerMode)
+        {
+            case GUITAR_TUNER:
             {
-                // Draw the LEDs
-                setLeds( colors, sizeof(colors) );
+                instrumentTunerMagic(NUM_GUITAR_STRINGS, colors, NULL);
+                break;
             }
-            // Reset the sample count
-            tunernome->audioSamplesProcessed = 0;
-        }
-    } // if(tunernome-> mode == TN_TUNER)
+            case VIOLIN_TUNER:
+            {
+                instrumentTunerMagic(NUM_VIOLIN_STRINGS, colors, fourNoteStringIdxToLedIdx);
+                break;
+            }
+            case UKULELE_TUNER:
+            {
+                instrumentTunerMagic(NUM_UKULELE_STRINGS, colors, fourNoteStringIdxToLedIdx);
+                break;
+            }
+            case SEMITONE_0:
+            case SEMITONE_1:
+            case SEMITONE_2:
+            case SEMITONE_3:
+            case SEMITONE_4:
+            case SEMITONE_5:
+            case SEMITONE_6:
+            case SEMITONE_7:
+            case SEMITONE_8:
+            case SEMITONE_9:
+            case SEMITONE_10:
+            case SEMITONE_11:
+            {
+                semitoneTunerMagic(tunernome->curTunerMode - SEMITONE_0, colors);
+                break;
+            }
+            case LISTENING:
+            case MAX_GUITAR_MODES:
+            default:
+            {
+                break;
+            }
+        } // switch(tunernome->curTunerMode)
+
+        // Draw the LEDs
+        setLeds( colors, sizeof(colors) );
+    }
 }
@@ -262,7 +262,7 @@ void updateHitBlock(entity_t *self)
     }
     if (self->animationTimer > 4)
     {
-        uint8_t aboveTile = self->tilemap->map[(self->homeTileY - 1) * self->tilemap->mapWidth + self->homeTileX];
+        uint8_t aboveTile = getTile(self->tilemap, self->homeTileX, self->homeTileY - 1);
         entity_t *createdEntity = NULL;
 
         switch (aboveTile)
@@ -308,7 +308,7 @@ void updateHitBlock(entity_t *self)
             buzzer_play_sfx(&sndBreak);
         }
 
-        self->tilemap->map[self->homeTileY * self->tilemap->mapWidth + self->homeTileX] = self->jumpPower;
+        setTile(self->tilemap, self->homeTileX, self->homeTileY, self->jumpPower);
 
         destroyEntity(self, false);
     }
@@ -317,10 +317,10 @@ void updateHitBlock(entity_t *self)
 void moveEntityWithTileCollisions(entity_t *self)
 {
 
-    uint16_t newX = self->x;
-    uint16_t newY = self->y;
-    uint8_t tx = TO_TILE_COORDS(self->x >> SUBPIXEL_RESOLUTION);
-    uint8_t ty = TO_TILE_COORDS(self->y >> SUBPIXEL_RESOLUTION);
+    int32_t newX = self->x;
+    int32_t newY = self->y;
+    uint16_t tx = TO_TILE_COORDS(self->x >> SUBPIXEL_RESOLUTION);
+    uint16_t ty = TO_TILE_COORDS(self->y >> SUBPIXEL_RESOLUTION);
     // bool collision = false;
 
     // Are we inside a block? Push self out of block
@@ -361,7 +361,7 @@ void moveEntityWithTileCollisions(entity_t *self)
                 newX = ((tx + 1) * TILE_SIZE - HALF_TILE_SIZE) << SUBPIXEL_RESOLUTION;
             }
 
-            uint8_t newTy = TO_TILE_COORDS(((self->y + self->yspeed) >> SUBPIXEL_RESOLUTION) + SIGNOF(self->yspeed) * HALF_TILE_SIZE);
+            uint16_t newTy = TO_TILE_COORDS(((self->y + self->yspeed) >> SUBPIXEL_RESOLUTION) + SIGNOF(self->yspeed) * HALF_TILE_SIZE);
 
             if (newTy != ty)
             {
@@ -391,7 +391,7 @@ void moveEntityWithTileCollisions(entity_t *self)
             }
 
             // Handle outside of tile
-            uint8_t newTx = TO_TILE_COORDS(((self->x + self->xspeed) >> SUBPIXEL_RESOLUTION) + SIGNOF(self->xspeed) * HALF_TILE_SIZE);
+            uint16_t newTx = TO_TILE_COORDS(((self->x + self->xspeed) >> SUBPIXEL_RESOLUTION) + SIGNOF(self->xspeed) * HALF_TILE_SIZE);
 
             if (newTx != tx)
             {
@@ -502,7 +502,7 @@ void destroyEntity(entity_t *self, bool respawn)
 {
     if (respawn && !(self->homeTileX == 0 && self->homeTileY == 0))
     {
-        self->tilemap->map[self->homeTileY * self->tilemap->mapWidth + self->homeTileX] = self->type + 128;
+        setTile(self->tilemap, self->homeTileX, self->homeTileY, self->type + 128);
     }
 
     // self->entityManager->activeEntities--;
@@ -673,7 +673,7 @@ void dummyCollisionHandler(entity_t *self, entity_t *other)
     return;
 }
 
-bool playerTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction)
+bool playerTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction)
 {
     switch (tileId)
     {
@@ -802,7 +802,7 @@ bool playerTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint
     return false;
 }
 
-bool enemyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction)
+bool enemyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction)
 {
     if (isSolid(tileId))
     {
@@ -832,7 +832,7 @@ bool enemyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8
     return false;
 }
 
-bool dummyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction)
+bool dummyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction)
 {
     return false;
 }
@@ -961,7 +961,7 @@ void updateDustBunny(entity_t *self)
     detectEntityCollisions(self);
 };
 
-bool dustBunnyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction){
+bool dustBunnyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction){
     if (isSolid(tileId))
     {
         switch (direction)
@@ -1037,7 +1037,7 @@ void updateWasp(entity_t *self)
     detectEntityCollisions(self);
 };
 
-bool waspTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction){
+bool waspTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction){
     if (isSolid(tileId))
     {
         switch (direction)
@@ -37,7 +37,7 @@ typedef enum {
 
 typedef void(*updateFunction_t)(struct entity_t *self);
 typedef void(*collisionHandler_t)(struct entity_t *self, struct entity_t *other);
-typedef bool(*tileCollisionHandler_t)(struct entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
+typedef bool(*tileCollisionHandler_t)(struct entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
 
 struct entity_t
 {
@@ -47,8 +47,8 @@ struct entity_t
     uint8_t type;
     updateFunction_t updateFunction;
 
-    uint16_t x;
-    uint16_t y;
+    int32_t x;
+    int32_t y;
     
     int16_t xspeed;
     int16_t yspeed;
@@ -71,8 +71,8 @@ struct entity_t
     tilemap_t * tilemap;
     gameData_t * gameData;
 
-    uint8_t homeTileX;
-    uint8_t homeTileY;
+    uint16_t homeTileX;
+    uint16_t homeTileY;
 
     int16_t jumpPower;
 
@@ -114,9 +114,9 @@ void playerCollisionHandler(entity_t *self, entity_t* other);
 void enemyCollisionHandler(entity_t *self, entity_t *other);
 void dummyCollisionHandler(entity_t *self, entity_t *other);
 
-bool playerTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
-bool enemyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
-bool dummyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
+bool playerTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
+bool enemyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
+bool dummyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
 
 void dieWhenFallingOffScreen(entity_t *self);
 
@@ -134,10 +134,10 @@ void updatePowerUp(entity_t* self);
 void updateWarp(entity_t* self);
 
 void updateDustBunny(entity_t* self);
-bool dustBunnyTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
+bool dustBunnyTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
 
 void updateWasp(entity_t* self);
-bool waspTileCollisionHandler(entity_t *self, uint8_t tileId, uint8_t tx, uint8_t ty, uint8_t direction);
+bool waspTileCollisionHandler(entity_t *self, uint8_t tileId, uint16_t tx, uint16_t ty, uint8_t direction);
 
 void killEnemy(entity_t* target);
 
@@ -21,6 +21,7 @@
 //==============================================================================
 void initializeEntityManager(entityManager_t * entityManager, tilemap_t * tilemap, gameData_t * gameData)
 {
+    entityManager->tilemap = tilemap;
     loadSprites(entityManager);
     entityManager->entities = malloc(sizeof(entity_t) * MAX_ENTITIES);
     
@@ -39,33 +40,38 @@ void initializeEntityManager(entityManager_t * entityManager, tilemap_t * tilema
 
 void loadSprites(entityManager_t * entityManager)
 {
-    loadWsg("sprite000.wsg", &entityManager->sprites[SP_PLAYER_IDLE]);
-    loadWsg("sprite001.wsg", &entityManager->sprites[SP_PLAYER_WALK1]);
-    loadWsg("sprite002.wsg", &entityManager->sprites[SP_PLAYER_WALK2]);
-    loadWsg("sprite003.wsg", &entityManager->sprites[SP_PLAYER_WALK3]);
-    loadWsg("sprite004.wsg", &entityManager->sprites[SP_PLAYER_JUMP]);
-    loadWsg("sprite005.wsg", &entityManager->sprites[SP_PLAYER_SLIDE]);
-    loadWsg("sprite006.wsg", &entityManager->sprites[SP_PLAYER_HURT]);
-    loadWsg("sprite007.wsg", &entityManager->sprites[SP_PLAYER_CLIMB]);
-    loadWsg("sprite008.wsg", &entityManager->sprites[SP_PLAYER_WIN]);
-    loadWsg("sprite009.wsg", &entityManager->sprites[SP_ENEMY_BASIC]);
-    loadWsg("tile066.wsg", &entityManager->sprites[SP_HITBLOCK_CONTAINER]);
-    loadWsg("tile034.wsg", &entityManager->sprites[SP_HITBLOCK_BRICKS]);
-    loadWsg("sprite012.wsg", &entityManager->sprites[SP_DUSTBUNNY_IDLE]);
-    loadWsg("sprite013.wsg", &entityManager->sprites[SP_DUSTBUNNY_CHARGE]);
-    loadWsg("sprite014.wsg", &entityManager->sprites[SP_DUSTBUNNY_JUMP]);
-    loadWsg("sprite015.wsg", &entityManager->sprites[SP_GAMING_1]);
-    loadWsg("sprite016.wsg", &entityManager->sprites[SP_GAMING_2]);
-    loadWsg("sprite017.wsg", &entityManager->sprites[SP_GAMING_3]);
-    loadWsg("sprite018.wsg", &entityManager->sprites[SP_MUSIC_1]);
-    loadWsg("sprite019.wsg", &entityManager->sprites[SP_MUSIC_2]);
-    loadWsg("sprite020.wsg", &entityManager->sprites[SP_MUSIC_3]);
-    loadWsg("sprite021.wsg", &entityManager->sprites[SP_WARP_1]);
-    loadWsg("sprite022.wsg", &entityManager->sprites[SP_WARP_2]);
-    loadWsg("sprite023.wsg", &entityManager->sprites[SP_WARP_3]);
-    loadWsg("sprite024.wsg", &entityManager->sprites[SP_WASP_1]);
-    loadWsg("sprite025.wsg", &entityManager->sprites[SP_WASP_2]);
-    loadWsg("sprite026.wsg", &entityManager->sprites[SP_WASP_DIVE]);
+    // Sprites are drawn out of their sheet, the hit blocks out of the tilemap's
+    loadWsgAtlas("sprites.atl", &entityManager->spriteAtlas);
+    const wsg_t * sheet = &entityManager->spriteAtlas.sheet;
+    const wsgAtlas_t * tileAtlas = &entityManager->tilemap->tileAtlas;
+
+    entityManager->sprites[SP_PLAYER_IDLE] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite000")};
+    entityManager->sprites[SP_PLAYER_WALK1] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite001")};
+    entityManager->sprites[SP_PLAYER_WALK2] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite002")};
+    entityManager->sprites[SP_PLAYER_WALK3] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite003")};
+    entityManager->sprites[SP_PLAYER_JUMP] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite004")};
+    entityManager->sprites[SP_PLAYER_SLIDE] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite005")};
+    entityManager->sprites[SP_PLAYER_HURT] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite006")};
+    entityManager->sprites[SP_PLAYER_CLIMB] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite007")};
+    entityManager->sprites[SP_PLAYER_WIN] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite008")};
+    entityManager->sprites[SP_ENEMY_BASIC] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite009")};
+    entityManager->sprites[SP_HITBLOCK_CONTAINER] = (sprite_t){&tileAtlas->sheet, getWsgRegion(tileAtlas, "tile066")};
+    entityManager->sprites[SP_HITBLOCK_BRICKS] = (sprite_t){&tileAtlas->sheet, getWsgRegion(tileAtlas, "tile034")};
+    entityManager->sprites[SP_DUSTBUNNY_IDLE] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite012")};
+    entityManager->sprites[SP_DUSTBUNNY_CHARGE] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite013")};
+    entityManager->sprites[SP_DUSTBUNNY_JUMP] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite014")};
+    entityManager->sprites[SP_GAMING_1] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite015")};
+    entityManager->sprites[SP_GAMING_2] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite016")};
+    entityManager->sprites[SP_GAMING_3] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite017")};
+    entityManager->sprites[SP_MUSIC_1] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite018")};
+    entityManager->sprites[SP_MUSIC_2] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite019")};
+    entityManager->sprites[SP_MUSIC_3] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite020")};
+    entityManager->sprites[SP_WARP_1] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite021")};
+    entityManager->sprites[SP_WARP_2] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite022")};
+    entityManager->sprites[SP_WARP_3] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite023")};
+    entityManager->sprites[SP_WASP_1] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite024")};
+    entityManager->sprites[SP_WASP_2] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite025")};
+    entityManager->sprites[SP_WASP_DIVE] = (sprite_t){sheet, getWsgRegion(&entityManager->spriteAtlas, "sprite026")};
 };
 
 void updateEntities(entityManager_t * entityManager)
@@ -112,7 +118,8 @@ void drawEntities(display_t * disp, entityManager_t * entityManager)
 
         if(currentEntity.active && currentEntity.visible)
         {
-            drawWsg(disp, &entityManager->sprites[currentEntity.spriteIndex], (currentEntity.x >> SUBPIXEL_RESOLUTION) - 8 - entityManager->tilemap->mapOffsetX, (currentEntity.y >> SUBPIXEL_RESOLUTION)  - entityManager->tilemap->mapOffsetY - 8, currentEntity.spriteFlipHorizontal, currentEntity.spriteFlipVertical, 0);
+            sprite_t * sprite = &entityManager->sprites[currentEntity.spriteIndex];
+            drawWsgRegion(disp, sprite->sheet, sprite->region, (currentEntity.x >> SUBPIXEL_RESOLUTION) - 8 - entityManager->tilemap->mapOffsetX, (currentEntity.y >> SUBPIXEL_RESOLUTION)  - entityManager->tilemap->mapOffsetY - 8, currentEntity.spriteFlipHorizontal, currentEntity.spriteFlipVertical);
         }
     }
 };
@@ -17,9 +17,16 @@
 // Structs
 //==============================================================================
 
+typedef struct
+{
+    const wsg_t * sheet;
+    const wsgRegion_t * region;
+} sprite_t;
+
 struct entityManager_t
 {
-    wsg_t sprites[27];
+    wsgAtlas_t spriteAtlas;
+    sprite_t sprites[27];
     entity_t * entities;
     uint8_t activeEntities;
 
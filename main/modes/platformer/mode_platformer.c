@@ -133,13 +133,13 @@ swadgeMode modePlatformer =
         .fnTemperatureCallback = NULL};
 
 static leveldef_t leveldef[3] = {
-    {.filename = "level1-1.bin",
+    {.filename = "level1-1.lvl",
      .timeLimit = 180,
      .checkpointTimeLimit = 90},
-    {.filename = "level1-2.bin",
+    {.filename = "level1-2.lvl",
      .timeLimit = 120,
      .checkpointTimeLimit = 90},
-    {.filename = "level1-3.bin",
+    {.filename = "level1-3.lvl",
      .timeLimit = 180,
      .checkpointTimeLimit = 90}};
 
@@ -192,8 +192,10 @@ void platformerExitMode(void)
     freeFont(&platformer->ibm_vga8);
     freeFont(&platformer->radiostars);
 
+    freeTileMap(&platformer->tilemap);
+    freeWsgAtlas(&platformer->entityManager.spriteAtlas);
+
     // TODO
-    // freeWsg(platformer->tilemap->tiles);
     // freeWsg(platformer->tilemap->tilemap_buffer);
 
     // free(platformer->tilemap);
@@ -17,6 +17,8 @@
 //==============================================================================
 
 bool isInteractive(uint8_t tileId);
+static uint8_t * getChunk(tilemap_t * tilemap, uint16_t cx, uint16_t cy);
+static void invalidateChunks(tilemap_t * tilemap);
 
 //==============================================================================
 // Functions
@@ -34,9 +36,31 @@ void initializeTileMap(tilemap_t *tilemap)
     tilemap->animationFrame = 0;
     tilemap->animationTimer = 7;
 
+    tilemap->level = NULL;
+    tilemap->edits = NULL;
+    tilemap->numEdits = 0;
+    tilemap->editsCap = 0;
+    invalidateChunks(tilemap);
+
     loadTiles(tilemap);
 }
 
+void freeTileMap(tilemap_t *tilemap)
+{
+    if (tilemap->level != NULL)
+    {
+        spiffsUnmapFile(tilemap->level);
+        tilemap->level = NULL;
+    }
+
+    free(tilemap->edits);
+    tilemap->edits = NULL;
+    tilemap->numEdits = 0;
+    tilemap->editsCap = 0;
+
+    freeWsgAtlas(&tilemap->tileAtlas);
+}
+
 void drawTileMap(display_t *disp, tilemap_t *tilemap)
 {
     tilemap->animationTimer--;
@@ -53,6 +77,9 @@ void drawTileMap(display_t *disp, tilemap_t *tilemap)
             break;
         }
 
+        // Look the chunk up once per row of it, not once per tile. Spawning an
+        // entity can't evict this chunk, it was just used
+        const uint8_t *chunkRow = NULL;
         for (uint16_t x = (tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2); x < (tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2) + TILEMAP_DISPLAY_WIDTH_TILES; x++)
         {
             if (x >= tilemap->mapWidth)
@@ -60,7 +87,11 @@ void drawTileMap(display_t *disp, tilemap_t *tilemap)
                 break;
             }
 
-            uint8_t tile = tilemap->map[(y * tilemap->mapWidth) + x];
+            if (chunkRow == NULL || (x & TILEMAP_CHUNK_MASK) == 0)
+            {
+                chunkRow = &getChunk(tilemap, x >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2, y >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2)[(y & TILEMAP_CHUNK_MASK) << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2];
+            }
+            uint8_t tile = chunkRow[x & TILEMAP_CHUNK_MASK];
             
             if(tile < TILE_GRASS){
                 continue;
@@ -75,7 +106,7 @@ void drawTileMap(display_t *disp, tilemap_t *tilemap)
             // Draw only non-garbage tiles
             if (tile > 31 && tile < 90)
             {
-                drawWsgTile(disp, &tilemap->tiles[tile - 32], x * TILE_SIZE - tilemap->mapOffsetX, y * TILE_SIZE - tilemap->mapOffsetY);
+                drawWsgRegionTile(disp, &tilemap->tileAtlas.sheet, tilemap->tiles[tile - 32], x * TILE_SIZE - tilemap->mapOffsetX, y * TILE_SIZE - tilemap->mapOffsetY);
             }
             else if (tile > 127 && tilemap->tileSpawnEnabled && (tilemap->executeTileSpawnColumn == x || tilemap->executeTileSpawnRow == y || tilemap->executeTileSpawnAll))
             {
@@ -91,9 +122,9 @@ void scrollTileMap(tilemap_t *tilemap, int16_t x, int16_t y)
 {
     if (x != 0)
     {
-        uint8_t oldTx = tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2;
+        uint16_t oldTx = tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2;
         tilemap->mapOffsetX = CLAMP(tilemap->mapOffsetX + x, tilemap->minMapOffsetX, tilemap->maxMapOffsetX);
-        uint8_t newTx = tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2;
+        uint16_t newTx = tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2;
 
         if (newTx > oldTx)
         {
@@ -111,9 +142,9 @@ void scrollTileMap(tilemap_t *tilemap, int16_t x, int16_t y)
 
     if (y != 0)
     {
-        uint8_t oldTy = tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2;
+        uint16_t oldTy = tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2;
         tilemap->mapOffsetY = CLAMP(tilemap->mapOffsetY + y, tilemap->minMapOffsetY, tilemap->maxMapOffsetY);
-        uint8_t newTy = tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2;
+        uint16_t newTy = tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2;
 
         if (newTy > oldTy)
         {
@@ -130,29 +161,55 @@ void scrollTileMap(tilemap_t *tilemap, int16_t x, int16_t y)
     }
 }
 
-bool loadMapFromFile(tilemap_t *tilemap, char *name)
+bool loadMapFromFile(tilemap_t *tilemap, const char *name)
 {
-    if (tilemap->map != NULL)
+    // The level stays mapped while it's played, and only the chunks around the
+    // camera are decompressed
+    if (tilemap->level != NULL)
     {
-        free(tilemap->map);
+        spiffsUnmapFile(tilemap->level);
+        tilemap->level = NULL;
     }
+    tilemap->numEdits = 0;
+    invalidateChunks(tilemap);
 
-    uint8_t *buf = NULL;
+    const uint8_t *buf = NULL;
     size_t sz;
-    if (!spiffsReadFile(name, &buf, &sz))
+    if (!spiffsMapFile(name, &buf, &sz))
     {
         ESP_LOGE("MAP", "Failed to read %s", name);
         return false;
     }
 
-    uint8_t width = buf[0];
-    uint8_t height = buf[1];
-
-    tilemap->map = (uint8_t *)malloc(sizeof(uint8_t) * width * height);
-    memcpy(tilemap->map, &buf[2], width * height);
+    uint16_t width = (sz >= LEVEL_HEADER_SIZE) ? ((buf[0] << 8) | buf[1]) : 0;
+    uint16_t height = (sz >= LEVEL_HEADER_SIZE) ? ((buf[2] << 8) | buf[3]) : 0;
+    uint16_t chunksWide = (width + TILEMAP_CHUNK_MASK) >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2;
+    uint16_t chunksHigh = (height + TILEMAP_CHUNK_MASK) >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2;
+    size_t dirSize = (size_t)chunksWide * chunksHigh * LEVEL_CHUNK_ENTRY_SIZE;
+
+    // Make sure the camera's offsets can reach every tile, and every chunk is
+    // in the file
+    bool ok = (0 < width) && (0 < height) && (width <= INT16_MAX / TILE_SIZE) && (height <= INT16_MAX / TILE_SIZE) &&
+              (LEVEL_HEADER_SIZE + dirSize <= sz);
+    for (size_t i = 0; ok && i < dirSize; i += LEVEL_CHUNK_ENTRY_SIZE)
+    {
+        const uint8_t *entry = &buf[LEVEL_HEADER_SIZE + i];
+        uint16_t chunkSize = (entry[1] << 8) | entry[2];
+        uint32_t offset = ((uint32_t)entry[3] << 24) | ((uint32_t)entry[4] << 16) | (entry[5] << 8) | entry[6];
+        ok = (offset <= sz) && (chunkSize <= sz - offset);
+    }
+    if (!ok)
+    {
+        ESP_LOGE("MAP", "%s isn't a level", name);
+        spiffsUnmapFile(buf);
+        return false;
+    }
 
+    tilemap->level = buf;
     tilemap->mapWidth = width;
     tilemap->mapHeight = height;
+    tilemap->chunksWide = chunksWide;
+    tilemap->heatshrinkParams = buf[4];
 
     tilemap->minMapOffsetX = 0;
     tilemap->maxMapOffsetX = width * TILE_SIZE - TILEMAP_DISPLAY_WIDTH_PIXELS;
@@ -161,31 +218,115 @@ bool loadMapFromFile(tilemap_t *tilemap, char *name)
     tilemap->maxMapOffsetY = height * TILE_SIZE - TILEMAP_DISPLAY_HEIGHT_PIXELS;
 
     for(uint16_t i=0; i<16; i++){
-        tilemap->warps[i].x = buf[2 + width * height + i * 2];
-        tilemap->warps[i].y = buf[2 + width * height + i * 2 + 1];
+        tilemap->warps[i].x = (buf[5 + i * 4] << 8) | buf[5 + i * 4 + 1];
+        tilemap->warps[i].y = (buf[5 + i * 4 + 2] << 8) | buf[5 + i * 4 + 3];
     }
 
-    free(buf);
-
     return true;
 }
 
+/**
+ * @brief Forget every decompressed chunk, so nothing is read from the last level
+ *
+ * @param tilemap The tilemap
+ */
+static void invalidateChunks(tilemap_t *tilemap)
+{
+    for (uint8_t i = 0; i < TILEMAP_CACHED_CHUNKS; i++)
+    {
+        tilemap->chunks[i].cx = UINT16_MAX;
+        tilemap->chunks[i].cy = UINT16_MAX;
+        tilemap->chunks[i].lastUsed = 0;
+    }
+    tilemap->lastChunk = &tilemap->chunks[0];
+    tilemap->chunkClock = 0;
+}
+
+/**
+ * @brief Get a chunk's tiles, decompressing it over the least recently used
+ * chunk if it isn't already. Tiles changed while playing are applied on top.
+ * The chunk must be inside the map
+ *
+ * @param tilemap The tilemap
+ * @param cx The chunk's x, in chunks
+ * @param cy The chunk's y, in chunks
+ * @return The chunk's tiles, row by row, valid until another chunk is decompressed
+ */
+static uint8_t *getChunk(tilemap_t *tilemap, uint16_t cx, uint16_t cy)
+{
+    // Neighbouring tiles are usually in the same chunk
+    tilemapChunk_t *chunk = tilemap->lastChunk;
+    if (chunk->cx == cx && chunk->cy == cy)
+    {
+        return chunk->tiles;
+    }
+
+    tilemap->chunkClock++;
+    tilemapChunk_t *lru = &tilemap->chunks[0];
+    for (uint8_t i = 0; i < TILEMAP_CACHED_CHUNKS; i++)
+    {
+        chunk = &tilemap->chunks[i];
+        if (chunk->cx == cx && chunk->cy == cy)
+        {
+            chunk->lastUsed = tilemap->chunkClock;
+            tilemap->lastChunk = chunk;
+            return chunk->tiles;
+        }
+        if (chunk->lastUsed < lru->lastUsed)
+        {
+            lru = chunk;
+        }
+    }
+
+    // Not cached, so decompress it
+    const uint8_t *entry = &tilemap->level[LEVEL_HEADER_SIZE + (((uint32_t)cy * tilemap->chunksWide) + cx) * LEVEL_CHUNK_ENTRY_SIZE];
+    uint16_t chunkSize = (entry[1] << 8) | entry[2];
+    uint32_t offset = ((uint32_t)entry[3] << 24) | ((uint32_t)entry[4] << 16) | (entry[5] << 8) | entry[6];
+    if (!decodeWsgData(entry[0], tilemap->heatshrinkParams, &tilemap->level[offset], chunkSize, lru->tiles, sizeof(lru->tiles)))
+    {
+        ESP_LOGE("MAP", "Failed to decompress chunk %d, %d", cx, cy);
+        memset(lru->tiles, TILE_EMPTY, sizeof(lru->tiles));
+    }
+    lru->cx = cx;
+    lru->cy = cy;
+    lru->lastUsed = tilemap->chunkClock;
+    tilemap->lastChunk = lru;
+
+    uint16_t tx0 = cx << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2;
+    uint16_t ty0 = cy << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2;
+    for (uint16_t i = 0; i < tilemap->numEdits; i++)
+    {
+        const tilemapEdit_t *edit = &tilemap->edits[i];
+        if ((uint16_t)(edit->tx - tx0) < TILEMAP_CHUNK_SIZE && (uint16_t)(edit->ty - ty0) < TILEMAP_CHUNK_SIZE)
+        {
+            lru->tiles[((edit->ty - ty0) << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2) + (edit->tx - tx0)] = edit->tileId;
+        }
+    }
+    return lru->tiles;
+}
+
 bool loadTiles(tilemap_t *tilemap)
 {
+    // Every tile is in one sheet, which is decoded once
+    if(!loadWsgAtlas("tiles.atl", &tilemap->tileAtlas))
+    {
+        return false;
+    }
+
     // tiles 0-31 are invisible tiles;
     // remember to subtract 32 from tile index before drawing tile
-    loadWsg("tile032.wsg", &tilemap->tiles[0]);
-    loadWsg("tile033.wsg", &tilemap->tiles[1]);
-    loadWsg("tile034.wsg", &tilemap->tiles[2]);
-    loadWsg("tile035.wsg", &tilemap->tiles[3]);
-    loadWsg("tile036.wsg", &tilemap->tiles[4]);
-    loadWsg("tile037.wsg", &tilemap->tiles[5]);
-    loadWsg("tile038.wsg", &tilemap->tiles[6]);
+    tilemap->tiles[0] = getWsgRegion(&tilemap->tileAtlas, "tile032");
+    tilemap->tiles[1] = getWsgRegion(&tilemap->tileAtlas, "tile033");
+    tilemap->tiles[2] = getWsgRegion(&tilemap->tileAtlas, "tile034");
+    tilemap->tiles[3] = getWsgRegion(&tilemap->tileAtlas, "tile035");
+    tilemap->tiles[4] = getWsgRegion(&tilemap->tileAtlas, "tile036");
+    tilemap->tiles[5] = getWsgRegion(&tilemap->tileAtlas, "tile037");
+    tilemap->tiles[6] = getWsgRegion(&tilemap->tileAtlas, "tile038");
 
     tilemap->tiles[7] = tilemap->tiles[0];
     tilemap->tiles[8] = tilemap->tiles[0];
 
-    loadWsg("tile041.wsg", &tilemap->tiles[9]);
+    tilemap->tiles[9] = getWsgRegion(&tilemap->tileAtlas, "tile041");
 
     tilemap->tiles[10] = tilemap->tiles[0];
     tilemap->tiles[11] = tilemap->tiles[0];
@@ -205,17 +346,17 @@ bool loadTiles(tilemap_t *tilemap)
     tilemap->tiles[25] = tilemap->tiles[0];
     tilemap->tiles[26] = tilemap->tiles[0];
 
-    loadWsg("tile059.wsg", &tilemap->tiles[27]);
-    loadWsg("tile060.wsg", &tilemap->tiles[28]);
-    loadWsg("tile061.wsg", &tilemap->tiles[29]);
-    loadWsg("tile062.wsg", &tilemap->tiles[30]);
-    loadWsg("tile063.wsg", &tilemap->tiles[31]);
-    loadWsg("tile064.wsg", &tilemap->tiles[32]);
-    loadWsg("tile065.wsg", &tilemap->tiles[33]);
-    loadWsg("tile066.wsg", &tilemap->tiles[34]);
-    loadWsg("tile067.wsg", &tilemap->tiles[35]);
-    loadWsg("tile068.wsg", &tilemap->tiles[36]);
-    loadWsg("tile069.wsg", &tilemap->tiles[37]);
+    tilemap->tiles[27] = getWsgRegion(&tilemap->tileAtlas, "tile059");
+    tilemap->tiles[28] = getWsgRegion(&tilemap->tileAtlas, "tile060");
+    tilemap->tiles[29] = getWsgRegion(&tilemap->tileAtlas, "tile061");
+    tilemap->tiles[30] = getWsgRegion(&tilemap->tileAtlas, "tile062");
+    tilemap->tiles[31] = getWsgRegion(&tilemap->tileAtlas, "tile063");
+    tilemap->tiles[32] = getWsgRegion(&tilemap->tileAtlas, "tile064");
+    tilemap->tiles[33] = getWsgRegion(&tilemap->tileAtlas, "tile065");
+    tilemap->tiles[34] = getWsgRegion(&tilemap->tileAtlas, "tile066");
+    tilemap->tiles[35] = getWsgRegion(&tilemap->tileAtlas, "tile067");
+    tilemap->tiles[36] = getWsgRegion(&tilemap->tileAtlas, "tile068");
+    tilemap->tiles[37] = getWsgRegion(&tilemap->tileAtlas, "tile069");
 
     tilemap->tiles[38] = tilemap->tiles[0];
     tilemap->tiles[39] = tilemap->tiles[0];
@@ -228,20 +369,20 @@ bool loadTiles(tilemap_t *tilemap)
     tilemap->tiles[46] = tilemap->tiles[0];
     tilemap->tiles[47] = tilemap->tiles[0];
 
-    loadWsg("tile080.wsg", &tilemap->tiles[48]);
-    loadWsg("tile081.wsg", &tilemap->tiles[49]);
-    loadWsg("tile082.wsg", &tilemap->tiles[50]);
-    loadWsg("tile083.wsg", &tilemap->tiles[51]);
-    loadWsg("tile084.wsg", &tilemap->tiles[52]);
-    loadWsg("tile085.wsg", &tilemap->tiles[53]);
-    loadWsg("tile086.wsg", &tilemap->tiles[54]);
-    loadWsg("tile087.wsg", &tilemap->tiles[55]);
-    loadWsg("tile088.wsg", &tilemap->tiles[56]);
+    tilemap->tiles[48] = getWsgRegion(&tilemap->tileAtlas, "tile080");
+    tilemap->tiles[49] = getWsgRegion(&tilemap->tileAtlas, "tile081");
+    tilemap->tiles[50] = getWsgRegion(&tilemap->tileAtlas, "tile082");
+    tilemap->tiles[51] = getWsgRegion(&tilemap->tileAtlas, "tile083");
+    tilemap->tiles[52] = getWsgRegion(&tilemap->tileAtlas, "tile084");
+    tilemap->tiles[53] = getWsgRegion(&tilemap->tileAtlas, "tile085");
+    tilemap->tiles[54] = getWsgRegion(&tilemap->tileAtlas, "tile086");
+    tilemap->tiles[55] = getWsgRegion(&tilemap->tileAtlas, "tile087");
+    tilemap->tiles[56] = getWsgRegion(&tilemap->tileAtlas, "tile088");
 
     return true;
 }
 
-void tileSpawnEntity(tilemap_t *tilemap, uint8_t objectIndex, uint8_t tx, uint8_t ty)
+void tileSpawnEntity(tilemap_t *tilemap, uint8_t objectIndex, uint16_t tx, uint16_t ty)
 {
     entity_t *entityCreated = createEntity(tilemap->entityManager, objectIndex, (tx << TILE_SIZE_IN_POWERS_OF_2) + 8, (ty << TILE_SIZE_IN_POWERS_OF_2) + 8);
 
@@ -249,11 +390,11 @@ void tileSpawnEntity(tilemap_t *tilemap, uint8_t objectIndex, uint8_t tx, uint8_
     {
         entityCreated->homeTileX = tx;
         entityCreated->homeTileY = ty;
-        tilemap->map[ty * tilemap->mapWidth + tx] = 0;
+        setTile(tilemap, tx, ty, 0);
     }
 }
 
-uint8_t getTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty)
+uint8_t getTile(tilemap_t *tilemap, uint16_t tx, uint16_t ty)
 {
     // ty = CLAMP(ty, 0, tilemap->mapHeight - 1);
 
@@ -267,10 +408,10 @@ uint8_t getTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty)
         return 1;
     }
 
-    return tilemap->map[ty * tilemap->mapWidth + tx];
+    return getChunk(tilemap, tx >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2, ty >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2)[((ty & TILEMAP_CHUNK_MASK) << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2) + (tx & TILEMAP_CHUNK_MASK)];
 }
 
-void setTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty, uint8_t newTileId)
+void setTile(tilemap_t *tilemap, uint16_t tx, uint16_t ty, uint8_t newTileId)
 {
     // ty = CLAMP(ty, 0, tilemap->mapHeight - 1);
 
@@ -279,7 +420,34 @@ void setTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty, uint8_t newTileId)
         return;
     }
 
-    tilemap->map[ty * tilemap->mapWidth + tx] = newTileId;
+    getChunk(tilemap, tx >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2, ty >> TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2)[((ty & TILEMAP_CHUNK_MASK) << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2) + (tx & TILEMAP_CHUNK_MASK)] = newTileId;
+
+    // Remember the change for when this chunk is decompressed again. Only tiles
+    // which are changed while playing, like spawners and blocks, are kept
+    for (uint16_t i = 0; i < tilemap->numEdits; i++)
+    {
+        if (tilemap->edits[i].tx == tx && tilemap->edits[i].ty == ty)
+        {
+            tilemap->edits[i].tileId = newTileId;
+            return;
+        }
+    }
+    if (tilemap->numEdits == tilemap->editsCap)
+    {
+        uint16_t newCap = tilemap->editsCap ? (tilemap->editsCap * 2) : 32;
+        tilemapEdit_t *newEdits = realloc(tilemap->edits, newCap * sizeof(tilemapEdit_t));
+        if (newEdits == NULL)
+        {
+            ESP_LOGE("MAP", "Couldn't remember tile %d, %d", tx, ty);
+            return;
+        }
+        tilemap->edits = newEdits;
+        tilemap->editsCap = newCap;
+    }
+    tilemap->edits[tilemap->numEdits].tx = tx;
+    tilemap->edits[tilemap->numEdits].ty = ty;
+    tilemap->edits[tilemap->numEdits].tileId = newTileId;
+    tilemap->numEdits++;
 }
 
 bool isSolid(uint8_t tileId)
@@ -24,6 +24,20 @@
 #define TILE_SIZE 16
 #define TILE_SIZE_IN_POWERS_OF_2 4
 
+// Levels are compiled by the spiffs_file_preprocessor into square chunks of
+// tiles which are decompressed as the camera reaches them. The header is the
+// width and height, the heatshrink parameters, then the warps, all big endian.
+// A directory follows with each chunk's codec (uint8_t), size (uint16_t) and
+// offset (uint32_t). These must match spiffs_file_preprocessor/level_processor.h
+#define LEVEL_HEADER_SIZE (5 + (16 * 4))
+#define LEVEL_CHUNK_ENTRY_SIZE 7
+#define TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2 4
+#define TILEMAP_CHUNK_SIZE (1 << TILEMAP_CHUNK_SIZE_IN_POWERS_OF_2)
+#define TILEMAP_CHUNK_MASK (TILEMAP_CHUNK_SIZE - 1)
+
+// The screen spans at most 3x2 chunks, plus room for what's just off of it
+#define TILEMAP_CACHED_CHUNKS 9
+
 //==============================================================================
 // Enums
 //==============================================================================
@@ -123,17 +137,45 @@ typedef enum {
 // Structs
 //==============================================================================
 typedef struct {
-    uint8_t x;
-    uint8_t y;
+    uint16_t x;
+    uint16_t y;
 } warp_t;
+
+typedef struct {
+    uint16_t cx;
+    uint16_t cy;
+    uint32_t lastUsed;
+    uint8_t tiles[TILEMAP_CHUNK_SIZE * TILEMAP_CHUNK_SIZE];
+} tilemapChunk_t;
+
+typedef struct {
+    uint16_t tx;
+    uint16_t ty;
+    uint8_t tileId;
+} tilemapEdit_t;
+
  struct tilemap_t
 {
-    wsg_t tiles[64];
+    wsgAtlas_t tileAtlas;
+    const wsgRegion_t * tiles[64];
+
+    const uint8_t * level;
+    uint16_t mapWidth;
+    uint16_t mapHeight;
+    uint16_t chunksWide;
+    uint8_t heatshrinkParams;
+
+    // The most recently used chunks, decompressed
+    tilemapChunk_t chunks[TILEMAP_CACHED_CHUNKS];
+    tilemapChunk_t * lastChunk;
+    uint32_t chunkClock;
+
+    // Tiles changed while playing, which are applied whenever their chunk is
+    // decompressed again
+    tilemapEdit_t * edits;
+    uint16_t numEdits;
+    uint16_t editsCap;
 
-    uint8_t * map;
-    uint8_t mapWidth;
-    uint8_t mapHeight;
-    
     warp_t warps[16];
 
     int16_t mapOffsetX;
@@ -159,14 +201,15 @@ typedef struct {
 // Prototypes
 //==============================================================================
 void initializeTileMap(tilemap_t * tilemap);
+void freeTileMap(tilemap_t * tilemap);
 void drawTileMap(display_t * disp, tilemap_t * tilemap);
 void scrollTileMap(tilemap_t * tilemap, int16_t x, int16_t y);
 void drawTile(tilemap_t * tilemap, uint8_t tileId, int16_t x, int16_t y);
-bool loadMapFromFile(tilemap_t * tilemap, char * name);
+bool loadMapFromFile(tilemap_t * tilemap, const char * name);
 bool loadTiles(tilemap_t * tilemap);
-void tileSpawnEntity(tilemap_t * tilemap, uint8_t objectIndex, uint8_t tx, uint8_t ty);
-uint8_t getTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty);
-void setTile(tilemap_t *tilemap, uint8_t tx, uint8_t ty, uint8_t newTileId);
+void tileSpawnEntity(tilemap_t * tilemap, uint8_t objectIndex, uint16_t tx, uint16_t ty);
+uint8_t getTile(tilemap_t *tilemap, uint16_t tx, uint16_t ty);
+void setTile(tilemap_t *tilemap, uint16_t tx, uint16_t ty, uint8_t newTileId);
 bool isSolid(uint8_t tileId);
 void unlockScrolling(tilemap_t *tilemap);
 
@@ -9,6 +9,7 @@
 #include "settingsManager.h"
 #include "led_util.h"
 #include "hdw-tft.h"
+#include "esp_timer.h"
 
 //==============================================================================
 // Defines
@@ -18,6 +19,39 @@
 #define MAX_TFT_BRIGHTNESS 7
 #define MAX_MIC_GAIN       7
 
+// How long settings must go unchanged before they're written to NVS, so
+// holding a button down to change one only writes it once
+#define SETTINGS_SAVE_DELAY_US (2 * 1000 * 1000)
+
+//==============================================================================
+// Enums
+//==============================================================================
+
+typedef enum
+{
+    SET_MUTE,
+    SET_TFT_BRIGHT,
+    SET_MIC,
+    SET_LED_BRIGHT,
+    SET_CC_MODE,
+    SET_QJ_HS,
+    SET_TEST,
+    NUM_SETTINGS
+} settingIdx_t;
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef struct
+{
+    const char* key; ///< The NVS key
+    int32_t def;     ///< The default value, if it isn't in NVS or is out of range
+    int32_t max;     ///< The largest value, the smallest is 0
+    int32_t val;     ///< The current value
+    bool dirty;      ///< true if val hasn't been written to NVS yet
+} setting_t;
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -30,36 +64,108 @@ const char KEY_CC_MODE[]    = "ccm";
 const char KEY_QJ_HS[]      = "qj";
 const char KEY_TEST[]       = "test";
 
+static setting_t settings[NUM_SETTINGS] =
+{
+    [SET_MUTE]       = {.key = KEY_MUTE,       .def = false,         .max = true},
+    [SET_TFT_BRIGHT] = {.key = KEY_TFT_BRIGHT, .def = 5,             .max = MAX_TFT_BRIGHTNESS},
+    [SET_MIC]        = {.key = KEY_MIC,        .def = MAX_MIC_GAIN,  .max = MAX_MIC_GAIN},
+    [SET_LED_BRIGHT] = {.key = KEY_LED_BRIGHT, .def = 5,             .max = MAX_LED_BRIGHTNESS},
+    [SET_CC_MODE]    = {.key = KEY_CC_MODE,    .def = ALL_SAME_LEDS, .max = NUM_CC_MODES - 1},
+    [SET_QJ_HS]      = {.key = KEY_QJ_HS,      .def = 0,             .max = INT32_MAX},
+    [SET_TEST]       = {.key = KEY_TEST,       .def = false,         .max = true},
+};
+
+// When a setting last changed, 0 if none are waiting to be written
+static int64_t tLastChangeUs = 0;
+
 //==============================================================================
 // Functions
 //==============================================================================
 
 /**
- * @return true if the buzzer is muted, false if it is not
+ * @brief Read every setting from NVS into RAM. This must be called once, after
+ * initNvs() and before any setting is used. Settings which aren't in NVS yet
+ * keep their defaults and aren't written until they change
  */
-bool getIsMuted(void)
+void initSettings(void)
+{
+    for(settingIdx_t idx = 0; idx < NUM_SETTINGS; idx++)
+    {
+        setting_t* setting = &settings[idx];
+        if(!readNvs32(setting->key, &setting->val) || setting->val < 0 || setting->val > setting->max)
+        {
+            setting->val = setting->def;
+        }
+        setting->dirty = false;
+    }
+    tLastChangeUs = 0;
+}
+
+/**
+ * @brief Write changed settings to NVS. Call this every loop, and with force
+ * before anything that loses RAM, like exiting a mode or deep sleep
+ *
+ * @param force true to write now, false to only write once settings haven't
+ *              changed for SETTINGS_SAVE_DELAY_US
+ */
+void flushSettings(bool force)
+{
+    if(0 == tLastChangeUs || (!force && esp_timer_get_time() - tLastChangeUs < SETTINGS_SAVE_DELAY_US))
+    {
+        return;
+    }
+
+    bool allWritten = true;
+    for(settingIdx_t idx = 0; idx < NUM_SETTINGS; idx++)
+    {
+        setting_t* setting = &settings[idx];
+        if(setting->dirty)
+        {
+            // If the write fails, try again next time
+            setting->dirty = !writeNvs32(setting->key, setting->val);
+            allWritten = allWritten && !setting->dirty;
+        }
+    }
+
+    // Wait for another delay before retrying anything that failed
+    tLastChangeUs = allWritten ? 0 : esp_timer_get_time();
+}
+
+/**
+ * @brief Change a setting in RAM, it's written to NVS later by flushSettings()
+ *
+ * @param idx The setting to change
+ * @param val The new value
+ * @return true, the setting is always set
+ */
+static bool setSetting(settingIdx_t idx, int32_t val)
 {
-    int32_t muted = false;
-    // Try reading the value
-    if(false == readNvs32(KEY_MUTE, &muted))
+    if(settings[idx].val != val)
     {
-        // Value didn't exist, so write the default
-        setIsMuted(muted);
+        settings[idx].val = val;
+        settings[idx].dirty = true;
+        tLastChangeUs = esp_timer_get_time();
     }
-    // Return the read value
-    return (bool)muted;
+    return true;
+}
+
+/**
+ * @return true if the buzzer is muted, false if it is not
+ */
+bool getIsMuted(void)
+{
+    return (bool)settings[SET_MUTE].val;
 }
 
 /**
  * Set if the buzzer is muted or not
  *
  * @param isMuted true to mute the buzzer, false to turn it on
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool setIsMuted(bool isMuted)
 {
-    // Write the value
-    return writeNvs32(KEY_MUTE, isMuted);
+    return setSetting(SET_MUTE, isMuted);
 }
 
 /**
@@ -67,29 +173,21 @@ bool setIsMuted(bool isMuted)
  */
 int32_t getTftBrightness(void)
 {
-    int32_t tftBrightness = 5;
-    // Try reading the value
-    if(false == readNvs32(KEY_TFT_BRIGHT, &tftBrightness))
-    {
-        // Value didn't exist, so write the default
-        writeNvs32(KEY_TFT_BRIGHT, tftBrightness);
-    }
-    // Return the read value
-    return tftBrightness;
+    return settings[SET_TFT_BRIGHT].val;
 }
 
 /**
  * Increment the brightness level for the TFT
  *
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool incTftBrightness(void)
 {
     // Increment the value
     uint8_t brightness = (getTftBrightness() + 1) % (MAX_TFT_BRIGHTNESS + 1);
 
-    // Write the value
-    bool retVal = writeNvs32(KEY_TFT_BRIGHT, brightness);
+    // Set the value
+    bool retVal = setSetting(SET_TFT_BRIGHT, brightness);
 
     // Set the brightness
     setTFTBacklight(getTftIntensity());
@@ -100,7 +198,7 @@ bool incTftBrightness(void)
 /**
  * Decrement the brightness level for the TFT
  *
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool decTftBrightness(void)
 {
@@ -115,8 +213,8 @@ bool decTftBrightness(void)
         brightness--;
     }
 
-    // Write the value
-    bool retVal = writeNvs32(KEY_TFT_BRIGHT, brightness);
+    // Set the value
+    bool retVal = setSetting(SET_TFT_BRIGHT, brightness);
 
     // Set the brightness
     setTFTBacklight(getTftIntensity());
@@ -140,21 +238,13 @@ uint8_t getTftIntensity(void)
  */
 int32_t getLedBrightness(void)
 {
-    int32_t ledBrightness = 5;
-    // Try reading the value
-    if(false == readNvs32(KEY_LED_BRIGHT, &ledBrightness))
-    {
-        // Value didn't exist, so write the default
-        writeNvs32(KEY_LED_BRIGHT, ledBrightness);
-    }
-    // Return the read value
-    return ledBrightness;
+    return settings[SET_LED_BRIGHT].val;
 }
 
 /**
  * Increment the brightness level for the LED
  *
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool incLedBrightness(void)
 {
@@ -162,14 +252,14 @@ bool incLedBrightness(void)
     uint8_t brightness = (getLedBrightness() + 1) % (MAX_LED_BRIGHTNESS + 1);
     // Adjust the LEDs
     setLedBrightness(brightness);
-    // Write the value
-    return writeNvs32(KEY_LED_BRIGHT, brightness);
+    // Set the value
+    return setSetting(SET_LED_BRIGHT, brightness);
 }
 
 /**
  * Decrement the brightness level for the LED
  *
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool decLedBrightness(void)
 {
@@ -185,8 +275,8 @@ bool decLedBrightness(void)
     }
     // Adjust the LEDs
     setLedBrightness(brightness);
-    // Write the value
-    return writeNvs32(KEY_LED_BRIGHT, brightness);
+    // Set the value
+    return setSetting(SET_LED_BRIGHT, brightness);
 }
 
 /**
@@ -194,22 +284,14 @@ bool decLedBrightness(void)
  */
 int32_t getMicGain(void)
 {
-    int32_t micGain = MAX_MIC_GAIN;
-    // Try reading the value
-    if(false == readNvs32(KEY_MIC, &micGain))
-    {
-        // Value didn't exist, so write the default
-        writeNvs32(KEY_MIC, micGain);
-    }
-    // Return the read value
-    return micGain;
+    return settings[SET_MIC].val;
 }
 
 /**
  * Increment the microphone gain setting
  *
  * @param newGain The new gain to set, 0-7
- * @return true if the setting was written, false if it was not
+ * @return true if the setting was set
  */
 bool setMicGain(uint8_t newGain)
 {
@@ -218,27 +300,27 @@ bool setMicGain(uint8_t newGain)
     {
         newGain = MAX_MIC_GAIN;
     }
-    // Write the value
-    return writeNvs32(KEY_MIC, newGain);
+    // Set the value
+    return setSetting(SET_MIC, newGain);
 }
 
 /**
  * Increment the microphone gain setting
  *
- * @return true if the setting was written, false if it was not
+ * @return true if the setting was set
  */
 bool incMicGain(void)
 {
     // Increment the value
     uint8_t newGain = (getMicGain() + 1) % (MAX_MIC_GAIN + 1);
-    // Write the value
-    return writeNvs32(KEY_MIC, newGain);
+    // Set the value
+    return setSetting(SET_MIC, newGain);
 }
 
 /**
  * Decrement the microphone gain setting
  *
- * @return true if the setting was written, false if it was not
+ * @return true if the setting was set
  */
 bool decMicGain(void)
 {
@@ -252,8 +334,8 @@ bool decMicGain(void)
     {
         newGain--;
     }
-    // Write the value
-    return writeNvs32(KEY_MIC, newGain);
+    // Set the value
+    return setSetting(SET_MIC, newGain);
 }
 
 /**
@@ -280,22 +362,14 @@ uint16_t getMicAmplitude(void)
  */
 colorchordMode_t getColorchordMode(void)
 {
-    colorchordMode_t colorchordMode = ALL_SAME_LEDS;
-    // Try reading the value
-    if(false == readNvs32(KEY_CC_MODE, (int32_t*)&colorchordMode))
-    {
-        // Value didn't exist, so write the default
-        setColorchordMode(colorchordMode);
-    }
-    // Return the read value
-    return colorchordMode;
+    return (colorchordMode_t)settings[SET_CC_MODE].val;
 }
 
 /**
  * Set the colorchordMode
  *
  * @param colorchordMode The colorchordMode, ALL_SAME_LEDS or LINEAR_LEDS
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool setColorchordMode(colorchordMode_t colorchordMode)
 {
@@ -305,8 +379,8 @@ bool setColorchordMode(colorchordMode_t colorchordMode)
         colorchordMode = ALL_SAME_LEDS;
     }
 
-    // Write the value
-    return writeNvs32(KEY_CC_MODE, colorchordMode);
+    // Set the value
+    return setSetting(SET_CC_MODE, colorchordMode);
 }
 
 /**
@@ -314,27 +388,19 @@ bool setColorchordMode(colorchordMode_t colorchordMode)
  */
 uint32_t getQJumperHighScore(void)
 {
-    int32_t highScore = 0;
-    // Try reading the value
-    if(false == readNvs32(KEY_QJ_HS, &highScore))
-    {
-        // Value didn't exist, so write the default
-        setQJumperHighScore(highScore);
-    }
-    // Return the read value
-    return highScore;
+    return settings[SET_QJ_HS].val;
 }
 
 /**
  * Set the new QJumper high score
  *
  * @param highScore the new high score
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool setQJumperHighScore(uint32_t highScore)
 {
-    // Write the value
-    return writeNvs32(KEY_QJ_HS, highScore);
+    // Set the value
+    return setSetting(SET_QJ_HS, highScore);
 }
 
 /**
@@ -342,25 +408,17 @@ bool setQJumperHighScore(uint32_t highScore)
  */
 bool getTestModePassed(void)
 {
-    int32_t pass = false;
-    // Try reading the value
-    if(false == readNvs32(KEY_TEST, &pass))
-    {
-        // Value didn't exist, so write the default
-        setTestModePassed(false);
-    }
-    // Return the read value
-    return (bool)pass;
+    return (bool)settings[SET_TEST].val;
 }
 
 /**
  * Set the new test mode pass status
  *
  * @param status true if the test passed, false if it did not
- * @return true if the setting was saved, false if it was not
+ * @return true if the setting was set
  */
 bool setTestModePassed(bool status)
 {
-    // Write the value
-    return writeNvs32(KEY_TEST, status);
+    // Set the value
+    return setSetting(SET_TEST, status);
 }
@@ -8,6 +8,9 @@
 // Function Prototypes
 //==============================================================================
 
+void initSettings(void);
+void flushSettings(bool force);
+
 bool getIsMuted(void);
 bool setIsMuted(bool);
 
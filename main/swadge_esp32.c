@@ -68,6 +68,10 @@
 
 #if defined(EMU)
     #include "emu_esp.h"
+    #include "emu_sound.h"
+    #if defined(EMU_ALLOC_TRACE)
+        #include "emu_alloc_trace.h"
+    #endif
 #else
     #include "soc/dport_access.h"
     #include "soc/periph_defs.h"
@@ -300,6 +304,7 @@ void mainSwadgeTask(void* arg __attribute((unused)))
 {
     /* Initialize internal NVS. Do this first to get test mode status */
     initNvs(true);
+    initSettings();
 
 #if !defined(EMU)
     /* Check why this ESP woke up */
@@ -483,6 +488,9 @@ void mainSwadgeTask(void* arg __attribute((unused)))
     }
 
     /* Enter the swadge mode */
+#if defined(EMU_ALLOC_TRACE)
+    emuAllocTraceSetMode(cSwadgeMode->modeName);
+#endif
     if(NULL != cSwadgeMode->fnEnterMode)
     {
         cSwadgeMode->fnEnterMode(&tftDisp);
@@ -570,7 +578,13 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                     adcSamps[i] = (adcSamps[i] * micAmp) >> 4;
                 }
 
+#if defined(EMU)
+                int64_t tAudioStartUs = esp_timer_get_time();
+#endif
                 cSwadgeMode->fnAudioCallback(adcSamps, sampleCnt);
+#if defined(EMU)
+                emuMicFileLogAudioCb(sampleCnt, esp_timer_get_time() - tAudioStartUs);
+#endif
             }
         }
 
@@ -637,8 +651,6 @@ void mainSwadgeTask(void* arg __attribute((unused)))
 #endif
         }
 
-        buzzer_check_next_note();
-
         /* If the mode should be switched, do it now */
         if(NULL != pendingSwadgeMode)
         {
@@ -655,11 +667,17 @@ void mainSwadgeTask(void* arg __attribute((unused)))
                     cSwadgeMode->fnExitMode();
                 }
 
+                // Save any settings the mode changed
+                flushSettings(true);
+
                 // Switch the mode IDX
                 cSwadgeMode = pendingSwadgeMode;
                 pendingSwadgeMode = NULL;
 
                 // Enter the next mode
+#if defined(EMU_ALLOC_TRACE)
+                emuAllocTraceSetMode(cSwadgeMode->modeName);
+#endif
                 if(NULL != cSwadgeMode->fnEnterMode)
                 {
                     cSwadgeMode->fnEnterMode(&tftDisp);
@@ -669,6 +687,9 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             {
                 // Deep sleep, wake up, and switch to pendingSwadgeMode
 
+                // Save any changed settings, RAM is lost in deep sleep
+                flushSettings(true);
+
                 // We have to do this otherwise the backlight can glitch 
                 disableTFTBacklight();
 
@@ -687,6 +708,9 @@ void mainSwadgeTask(void* arg __attribute((unused)))
             }
         }
 
+        // Save settings once they stop changing
+        flushSettings(false);
+
         // Yield to let the rest of the RTOS run
         taskYIELD();
         // Note, the RTOS tick rate can be changed in idf.py menuconfig
@@ -704,6 +728,8 @@ void mainSwadgeTask(void* arg __attribute((unused)))
         cSwadgeMode->fnExitMode();
     }
 
+    flushSettings(true);
+
 #if defined(EMU)
     esp_timer_deinit();
 #endif
@@ -0,0 +1,334 @@
+/*
+*   pitch_tracker.c
+*
+*   An integer-only pitch tracker for a handful of target frequencies.
+*   See pitch_tracker.h for how it works.
+*/
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <string.h>
+
+#include "DFT32.h"
+#include "pitch_tracker.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// Incoming samples are shifted down by this much before mixing. The largest
+// possible sum is then 2^11 * 1500 * PT_BLOCK_SIZE, which fits in an int32_t
+#define PT_SAMPLE_SHIFT 4
+
+// The block sums are shifted down by this much to get a magnitude
+#define PT_MAG_SHIFT 16
+
+// Blocks quieter than this don't move the oscillator, it just goes home
+#define PT_MIN_MAGNITUDE 8
+
+// 2^(1/12) and 2^(-1/12), times one million
+#define SEMITONE_UP_PPM   1059463
+#define SEMITONE_DOWN_PPM 943874
+
+// 100 * 1200 / ln(2), to get from a natural log to hundredths of a cent
+#define CENTICENTS_PER_NEPER 173123
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static int32_t atan2Turns(int64_t y, int64_t x);
+static int32_t incToCentiCents(int64_t measuredInc, uint32_t targetInc);
+static void accumulateRotation(int32_t curI, int32_t curQ, int32_t lastI, int32_t lastQ, int64_t* re,
+                               int64_t* im);
+static void finishBlock(pitchBin_t* bin);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * Initialize a pitch tracker to follow a set of frequencies
+ *
+ * @param pt The pitch tracker to initialize
+ * @param freqsMilliHz The frequencies to track, in milliHertz. See PT_HZ()
+ * @param numFreqs The number of frequencies to track, at most PT_MAX_BINS
+ */
+void pitchTrackerInit(pitchTracker_t* pt, const uint32_t* freqsMilliHz, uint8_t numFreqs)
+{
+    memset(pt, 0, sizeof(pitchTracker_t));
+
+    if(numFreqs > PT_MAX_BINS)
+    {
+        numFreqs = PT_MAX_BINS;
+    }
+    pt->numBins = numFreqs;
+
+    for(uint8_t i = 0; i < numFreqs; i++)
+    {
+        pitchBin_t* bin = &pt->bins[i];
+        // One full turn of the oscillator is 2^32
+        bin->targetInc = (((uint64_t)freqsMilliHz[i]) << 32) / (DFREQ * 1000);
+        bin->minInc = ((uint64_t)bin->targetInc * SEMITONE_DOWN_PPM) / 1000000;
+        bin->maxInc = ((uint64_t)bin->targetInc * SEMITONE_UP_PPM) / 1000000;
+        bin->trackInc = bin->targetInc;
+        bin->lastInc = bin->targetInc;
+        // Block to block, the rotation is unambiguous for half a turn, or
+        // 2^31 / PT_BLOCK_SIZE in phase increment
+        bin->useCoarse = (bin->maxInc - bin->targetInc) > (1u << (31 - PT_BLOCK_SIZE_BITS));
+    }
+}
+
+/**
+ * Push audio samples into the pitch tracker. Every PT_BLOCK_SIZE samples, the
+ * magnitude and deviation of each bin is updated
+ *
+ * @param pt The pitch tracker
+ * @param samples The samples to push
+ * @param numSamples The number of samples to push
+ * @return true if at least one block was finished and the bins were updated
+ */
+bool pitchTrackerPushSamples(pitchTracker_t* pt, const int16_t* samples, uint32_t numSamples)
+{
+    bool blockFinished = false;
+
+    while(numSamples > 0)
+    {
+        // Process up to the end of the current sub-block
+        uint32_t toProcess = PT_SUB_BLOCK_SIZE - (pt->samplesInBlock % PT_SUB_BLOCK_SIZE);
+        if(toProcess > numSamples)
+        {
+            toProcess = numSamples;
+        }
+        pt->samplesInBlock += toProcess;
+
+        bool subBlockFinished = (0 == (pt->samplesInBlock % PT_SUB_BLOCK_SIZE));
+        uint8_t subIdx = (pt->samplesInBlock - 1) / PT_SUB_BLOCK_SIZE;
+
+        // Run each bin over the whole chunk, keeping its state in locals
+        for(uint8_t b = 0; b < pt->numBins; b++)
+        {
+            pitchBin_t* bin = &pt->bins[b];
+            uint32_t phase = bin->phase;
+            uint32_t inc = bin->trackInc;
+            int32_t accI = bin->accI;
+            int32_t accQ = bin->accQ;
+
+            for(uint32_t i = 0; i < toProcess; i++)
+            {
+                int32_t samp = samples[i] >> PT_SAMPLE_SHIFT;
+                uint8_t idx = phase >> 24;
+                // Cosine is a quarter turn ahead of sine
+                accI += Ssinonlytable[(uint8_t)(idx + 64)] * samp;
+                accQ += Ssinonlytable[idx] * samp;
+                phase += inc;
+            }
+
+            bin->phase = phase;
+            if(subBlockFinished)
+            {
+                bin->subI[subIdx] = accI;
+                bin->subQ[subIdx] = accQ;
+                accI = 0;
+                accQ = 0;
+            }
+            bin->accI = accI;
+            bin->accQ = accQ;
+        }
+
+        samples += toProcess;
+        numSamples -= toProcess;
+
+        // If the block is done, update all the bins
+        if(PT_BLOCK_SIZE == pt->samplesInBlock)
+        {
+            pt->samplesInBlock = 0;
+            for(uint8_t b = 0; b < pt->numBins; b++)
+            {
+                finishBlock(&pt->bins[b]);
+            }
+            blockFinished = true;
+        }
+    }
+    return blockFinished;
+}
+
+/**
+ * Find how far a signal rotated between two sums, relative to the oscillator.
+ * The signal is each sum times e^(-j*phase), so it's (I, -Q), and the rotation
+ * is the angle of the newer one times the conjugate of the older one
+ *
+ * @param curI The newer in-phase sum
+ * @param curQ The newer quadrature sum
+ * @param lastI The older in-phase sum
+ * @param lastQ The older quadrature sum
+ * @param re Accumulates the real part of the product
+ * @param im Accumulates the imaginary part of the product
+ */
+static void accumulateRotation(int32_t curI, int32_t curQ, int32_t lastI, int32_t lastQ, int64_t* re, int64_t* im)
+{
+    // Shift a little first so the products can't overflow
+    int64_t cI = curI >> 2;
+    int64_t cQ = curQ >> 2;
+    int64_t lI = lastI >> 2;
+    int64_t lQ = lastQ >> 2;
+    *re += (cI * lI) + (cQ * lQ);
+    *im += (cI * lQ) - (cQ * lI);
+}
+
+/**
+ * Update a bin's magnitude and deviation at the end of a block, then steer its
+ * oscillator towards the measured frequency
+ *
+ * @param bin The bin to update
+ */
+static void finishBlock(pitchBin_t* bin)
+{
+    // Sum the sub-blocks to get the whole block
+    int32_t blockI = 0;
+    int32_t blockQ = 0;
+    for(uint8_t i = 0; i < PT_SUB_BLOCKS; i++)
+    {
+        blockI += bin->subI[i];
+        blockQ += bin->subQ[i];
+    }
+
+    int32_t absI = blockI < 0 ? -blockI : blockI;
+    int32_t absQ = blockQ < 0 ? -blockQ : blockQ;
+
+    // Approximate norm, same as colorchord's APPROXNORM
+    uint32_t mag = absI > absQ ? absI + (absQ >> 1) : absQ + (absI >> 1);
+    mag >>= PT_MAG_SHIFT;
+    bin->magnitude = mag > UINT16_MAX ? UINT16_MAX : mag;
+
+    // The oscillator phase increment used for the block which just finished
+    uint32_t blockInc = bin->trackInc;
+
+    if(bin->magnitude < PT_MIN_MAGNITUDE)
+    {
+        // Too quiet to measure, send the oscillator back to the target
+        bin->trackInc = bin->targetInc;
+        bin->centiCents = 0;
+    }
+    else if(bin->lastValid)
+    {
+        // Rotation from the last block's center to this one's, in (-1/2, 1/2]
+        // turns, where one turn is 2^16
+        int64_t re = 0;
+        int64_t im = 0;
+        accumulateRotation(blockI, blockQ, bin->lastI, bin->lastQ, &re, &im);
+        int64_t rotation = atan2Turns(im, re);
+
+        // The rotation happened over PT_BLOCK_SIZE samples, half at the last
+        // block's oscillator frequency and half at this one's
+        int64_t baseInc = ((int64_t)bin->lastInc + blockInc) / 2;
+
+        if(bin->useCoarse)
+        {
+            // The real rotation may have been more than half a turn. Estimate
+            // it from the sub-blocks, which have a shorter hop, and add
+            // however many whole turns get closest to that estimate
+            re = 0;
+            im = 0;
+            for(uint8_t i = 1; i < PT_SUB_BLOCKS; i++)
+            {
+                accumulateRotation(bin->subI[i], bin->subQ[i], bin->subI[i - 1], bin->subQ[i - 1], &re, &im);
+            }
+            int64_t coarseInc = blockInc + (atan2Turns(im, re) * (1 << (16 + PT_SUB_BLOCK_BITS - PT_BLOCK_SIZE_BITS)));
+            int64_t predicted = (coarseInc - baseInc) / (1 << (16 - PT_BLOCK_SIZE_BITS));
+            int64_t turns = (predicted - rotation + (predicted > rotation ? 32768 : -32768)) / 65536;
+            rotation += turns * 65536;
+        }
+
+        // One turn is 2^16 in rotation and 2^32 in phase increment
+        int64_t measuredInc = baseInc + (rotation * (1 << (16 - PT_BLOCK_SIZE_BITS)));
+
+        bin->centiCents = incToCentiCents(measuredInc, bin->targetInc);
+
+        // Move the oscillator halfway towards the signal, within a semitone
+        int64_t newInc = blockInc + ((measuredInc - blockInc) / 2);
+        if(newInc < bin->minInc)
+        {
+            newInc = bin->minInc;
+        }
+        else if(newInc > bin->maxInc)
+        {
+            newInc = bin->maxInc;
+        }
+        bin->trackInc = newInc;
+    }
+
+    bin->lastValid = true;
+    bin->lastInc = blockInc;
+    bin->lastI = blockI;
+    bin->lastQ = blockQ;
+}
+
+/**
+ * Integer approximation of atan2(), good to about a thousandth of a turn
+ *
+ * @param y The imaginary part
+ * @param x The real part
+ * @return The angle, where 65536 is one full turn, from -32768 to 32768
+ */
+static int32_t atan2Turns(int64_t y, int64_t x)
+{
+    int64_t ax = x < 0 ? -x : x;
+    int64_t ay = y < 0 ? -y : y;
+
+    if(0 == ax && 0 == ay)
+    {
+        return 0;
+    }
+
+    // Scale down so the ratio below can't overflow
+    while((ax | ay) >= ((int64_t)1 << 40))
+    {
+        ax >>= 1;
+        ay >>= 1;
+    }
+
+    // Work in the first octant, with the ratio in Q15
+    bool swapped = ay > ax;
+    int32_t r = swapped ? ((ax << 15) / ay) : ((ay << 15) / ax);
+
+    // atan(r) ~= (pi/4)r + 0.273r(1-r) radians, which is
+    // r/8 + 0.04345r(1-r) turns. 0.04345 is 2848 in Q16
+    int32_t angle = (r >> 2) + ((2848 * ((r * (32768 - r)) >> 15)) >> 15);
+
+    // Then unfold the octant
+    if(swapped)
+    {
+        angle = 16384 - angle;
+    }
+    if(x < 0)
+    {
+        angle = 32768 - angle;
+    }
+    if(y < 0)
+    {
+        angle = -angle;
+    }
+    return angle;
+}
+
+/**
+ * Convert a measured phase increment to a deviation from the target in cents
+ *
+ * @param measuredInc The measured phase increment
+ * @param targetInc The target phase increment
+ * @return The deviation from the target, in hundredths of a cent
+ */
+static int32_t incToCentiCents(int64_t measuredInc, uint32_t targetInc)
+{
+    // x = (measured / target) - 1, in Q30
+    int64_t x = ((measuredInc - targetInc) * (1 << 30)) / targetInc;
+    int64_t x2 = (x * x) >> 30;
+    int64_t x3 = (x2 * x) >> 30;
+
+    // ln(1 + x) ~= x - x^2/2 + x^3/3, plenty for a semitone either way
+    int64_t ln = x - (x2 / 2) + (x3 / 3);
+    return (ln * CENTICENTS_PER_NEPER) >> 30;
+}
@@ -0,0 +1,72 @@
+/*
+*   pitch_tracker.h
+*
+*   A small, integer-only pitch tracker for tuners. Rather than running a full
+*   DFT over every octave, this only looks at the handful of frequencies the
+*   caller cares about.
+*
+*   Each tracked frequency is a single complex DFT bin: the incoming samples
+*   are mixed with a sine/cosine oscillator (a 32 bit phase accumulator and the
+*   colorchord sine table) and summed over a block of PT_BLOCK_SIZE samples.
+*   The phase difference between two consecutive blocks gives the frequency
+*   offset between the signal and the oscillator. The oscillator is then nudged
+*   towards the signal (a frequency locked loop), so once it settles, the
+*   deviation from the target frequency is read straight from the oscillator's
+*   phase increment, to well below a cent.
+*/
+
+#ifndef _PITCH_TRACKER_H
+#define _PITCH_TRACKER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// The number of samples per block. Must be a power of two. At 8KHz, 512
+// samples is 64ms, which is five cycles of the low E on a guitar
+#define PT_BLOCK_SIZE_BITS 9
+#define PT_BLOCK_SIZE      (1 << PT_BLOCK_SIZE_BITS)
+
+// Each block is split into this many sub-blocks, 2^2 = 4. The phase difference
+// between sub-blocks is a coarse frequency estimate with four times the range
+// of the block to block one, which is used to unwrap it for higher notes
+#define PT_SUB_BLOCK_BITS 2
+#define PT_SUB_BLOCKS     (1 << PT_SUB_BLOCK_BITS)
+#define PT_SUB_BLOCK_SIZE (PT_BLOCK_SIZE / PT_SUB_BLOCKS)
+
+// The most frequencies a single tracker can follow
+#define PT_MAX_BINS 6
+
+// Helper to write frequencies in milliHertz
+#define PT_HZ(f) ((uint32_t)((f) * 1000.0 + 0.5))
+
+typedef struct
+{
+    uint32_t targetInc; //!< Oscillator phase increment for the target frequency
+    uint32_t minInc;    //!< The oscillator won't go lower than a semitone below the target
+    uint32_t maxInc;    //!< The oscillator won't go higher than a semitone above the target
+    uint32_t trackInc;  //!< Oscillator phase increment currently being tracked
+    uint32_t lastInc;   //!< Oscillator phase increment used for the last block
+    uint32_t phase;     //!< Oscillator phase, 2^32 is one full turn
+    int32_t accI;       //!< In-phase sum for the current sub-block
+    int32_t accQ;       //!< Quadrature sum for the current sub-block
+    int32_t subI[PT_SUB_BLOCKS]; //!< In-phase sums for each sub-block in the current block
+    int32_t subQ[PT_SUB_BLOCKS]; //!< Quadrature sums for each sub-block in the current block
+    int32_t lastI;      //!< In-phase sum for the last block
+    int32_t lastQ;      //!< Quadrature sum for the last block
+    bool lastValid;     //!< If lastI and lastQ may be compared against
+    bool useCoarse;     //!< If a semitone is more than the block to block range
+    uint16_t magnitude; //!< Magnitude of the last block, roughly 0 to ~2047
+    int32_t centiCents; //!< Deviation from the target, in hundredths of a cent
+} pitchBin_t;
+
+typedef struct
+{
+    pitchBin_t bins[PT_MAX_BINS];
+    uint8_t numBins;
+    uint16_t samplesInBlock;
+} pitchTracker_t;
+
+void pitchTrackerInit(pitchTracker_t* pt, const uint32_t* freqsMilliHz, uint8_t numFreqs);
+bool pitchTrackerPushSamples(pitchTracker_t* pt, const int16_t* samples, uint32_t numSamples);
+
+#endif
@@ -0,0 +1,351 @@
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "atlas_processor.h"
+#include "image_processor.h"
+#include "fileUtils.h"
+
+/* The index which means transparent, see palette.h */
+#define PALETTE_TRANSPARENT (6 * 6 * 6)
+
+/**
+ * One sprite going into an atlas
+ */
+typedef struct
+{
+	char * name;      /* The PNG's name without the extension */
+	uint8_t * px;     /* Palette indices */
+	int w;
+	int h;
+	int x;            /* Where it is in the sheet */
+	int y;
+	int sameAs;       /* The sprite with the same pixels, or -1 */
+} atlasSprite_t;
+
+/**
+ * @brief Check if a file is a PNG in the same directory as an atlas
+ *
+ * @param atlasFile The NAME.atlas file
+ * @param path The file to check
+ * @return true if it goes into the atlas, false if it doesn't
+ */
+bool isAtlasMember(const char * atlasFile, const char * path)
+{
+	size_t dirLen = get_filename(atlasFile) - atlasFile;
+	size_t len = strlen(path);
+	return 0 < dirLen && 0 == strncmp(atlasFile, path, dirLen) && NULL == strchr(&path[dirLen], '/') &&
+		   len > 4 && 0 == strcmp(&path[len - 4], ".png") &&
+		   !(len > 9 && 0 == strcmp(&path[len - 9], ".font.png"));
+}
+
+/**
+ * @brief Sort member names with strcmp, which doesn't depend on the locale
+ */
+static int cmpNames(const void * a, const void * b)
+{
+	return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+/**
+ * @brief List the PNGs which go into an atlas
+ *
+ * @param atlasFile The NAME.atlas file
+ * @param numMembers Where to write the number of PNGs
+ * @return The PNGs' paths, sorted, which must all be freed
+ */
+static char ** listMembers(const char * atlasFile, uint32_t * numMembers)
+{
+	*numMembers = 0;
+	size_t dirLen = get_filename(atlasFile) - atlasFile;
+	char dirName[dirLen + 1];
+	memcpy(dirName, atlasFile, dirLen);
+	dirName[dirLen] = 0;
+
+	DIR * dir = opendir(dirName);
+	if (NULL == dir)
+	{
+		return NULL;
+	}
+	char ** members = NULL;
+	uint32_t cap = 0;
+	struct dirent * ent;
+	while (NULL != (ent = readdir(dir)))
+	{
+		char * path = malloc(dirLen + strlen(ent->d_name) + 1);
+		strcpy(path, dirName);
+		strcat(path, ent->d_name);
+		if (!isAtlasMember(atlasFile, path))
+		{
+			free(path);
+			continue;
+		}
+		if (*numMembers == cap)
+		{
+			cap = cap ? (cap * 2) : 32;
+			members = realloc(members, cap * sizeof(char *));
+		}
+		members[(*numMembers)++] = path;
+	}
+	closedir(dir);
+	qsort(members, *numMembers, sizeof(char *), cmpNames);
+	return members;
+}
+
+/**
+ * @brief Hash an atlas and every PNG which goes into it, so it's rebuilt when
+ * any of them change, or when one is added or removed
+ *
+ * @param infile The NAME.atlas file
+ * @param hash The hash so far, updated
+ * @return true if everything was read, false if it wasn't
+ */
+bool hash_atlas(const char * infile, uint64_t * hash)
+{
+	bool ok = hashFile(infile, hash);
+	uint32_t numMembers;
+	char ** members = listMembers(infile, &numMembers);
+	for (uint32_t i = 0; i < numMembers; i++)
+	{
+		hashBytes(members[i], strlen(members[i]) + 1, hash);
+		ok = hashFile(members[i], hash) && ok;
+		free(members[i]);
+	}
+	free(members);
+	return ok;
+}
+
+/**
+ * @brief Shelf pack sprites into a sheet. Sprites are placed left to right in
+ * rows as tall as their tallest sprite, tallest first
+ *
+ * @param sprites The sprites, their positions are written
+ * @param order The sprites to place, tallest first
+ * @param numOrder The number of sprites to place
+ * @param sheetW The sheet's width, at least as wide as the widest sprite
+ * @return The sheet's height
+ */
+static int shelfPack(atlasSprite_t * sprites, const uint32_t * order, uint32_t numOrder, int sheetW)
+{
+	int x = 0;
+	int y = 0;
+	int shelfH = 0;
+	for (uint32_t i = 0; i < numOrder; i++)
+	{
+		atlasSprite_t * s = &sprites[order[i]];
+		if (x + s->w > sheetW)
+		{
+			x = 0;
+			y += shelfH;
+			shelfH = 0;
+		}
+		s->x = x;
+		s->y = y;
+		x += s->w;
+		if (s->h > shelfH)
+		{
+			shelfH = s->h;
+		}
+	}
+	return y + shelfH;
+}
+
+/**
+ * @brief Sort sprites by name, which is the order of the atlas's table
+ */
+static int cmpSpriteNames(const void * a, const void * b)
+{
+	return strcmp(((const atlasSprite_t *)a)->name, ((const atlasSprite_t *)b)->name);
+}
+
+/**
+ * @brief Sort sprite indices tallest then widest first. Insertion sort keeps
+ * equal sprites in name order, and atlases are small
+ *
+ * @param sprites The sprites
+ * @param order The indices to sort
+ * @param numOrder The number of indices
+ */
+static void sortTallest(const atlasSprite_t * sprites, uint32_t * order, uint32_t numOrder)
+{
+	for (uint32_t i = 1; i < numOrder; i++)
+	{
+		uint32_t idx = order[i];
+		const atlasSprite_t * s = &sprites[idx];
+		uint32_t j = i;
+		while (j > 0 && (sprites[order[j - 1]].h < s->h ||
+						 (sprites[order[j - 1]].h == s->h && sprites[order[j - 1]].w < s->w)))
+		{
+			order[j] = order[j - 1];
+			j--;
+		}
+		order[j] = idx;
+	}
+}
+
+/**
+ * @brief Pack every PNG in a directory into one WSG with a table of where each
+ * sprite is. Sprites with identical pixels share their spot in the sheet
+ *
+ * @param infile The NAME.atlas file, the atlas is written to NAME.atl
+ * @param outdir The directory to write the atlas to
+ * @return true if the atlas was written, false if it wasn't
+ */
+bool process_atlas(const char * infile, const char * outdir)
+{
+	/* Determine the output file name */
+	char outFilePath[128] = {0};
+	strcat(outFilePath, outdir);
+	strcat(outFilePath, "/");
+	strcat(outFilePath, get_filename(infile));
+	strcpy(strrchr(outFilePath, '.'), ".atl");
+
+	uint32_t numSprites;
+	char ** members = listMembers(infile, &numSprites);
+	if (0 == numSprites || numSprites > UINT16_MAX)
+	{
+		fprintf(stderr, "%s has %u PNGs beside it, it needs 1 to %u\n", infile, numSprites, UINT16_MAX);
+		free(members);
+		return false;
+	}
+
+	/* Load and dither every sprite on its own, like process_image() does */
+	atlasSprite_t * sprites = calloc(numSprites, sizeof(atlasSprite_t));
+	uint32_t * order = malloc(numSprites * sizeof(uint32_t));
+	uint32_t numOrder = 0;
+	uint32_t namesSize = 0;
+	int maxW = 0;
+	int sumW = 0;
+	bool ok = true;
+	for (uint32_t i = 0; i < numSprites; i++)
+	{
+		atlasSprite_t * s = &sprites[i];
+		const char * fname = get_filename(members[i]);
+		s->name = strndup(fname, strlen(fname) - 4);
+		namesSize += strlen(s->name) + 1;
+		s->px = loadPaletteImage(members[i], &s->w, &s->h);
+		s->sameAs = -1;
+		ok = ok && (NULL != s->px);
+	}
+	qsort(sprites, numSprites, sizeof(atlasSprite_t), cmpSpriteNames);
+
+	/* Only pack pixels which aren't already packed */
+	for (uint32_t i = 0; ok && i < numSprites; i++)
+	{
+		atlasSprite_t * s = &sprites[i];
+		for (uint32_t j = 0; j < i; j++)
+		{
+			if (sprites[j].sameAs < 0 && sprites[j].w == s->w && sprites[j].h == s->h &&
+					0 == memcmp(sprites[j].px, s->px, s->w * s->h))
+			{
+				s->sameAs = j;
+				break;
+			}
+		}
+		if (s->sameAs < 0)
+		{
+			order[numOrder++] = i;
+			sumW += s->w;
+			if (s->w > maxW)
+			{
+				maxW = s->w;
+			}
+		}
+	}
+	ok = ok && namesSize <= UINT16_MAX;
+
+	/* Try every sheet width, and keep the one with the smallest area, then
+	 * the narrowest. Narrow sheets keep each sprite's rows close together,
+	 * which compresses better and is kinder to the cache when drawing
+	 */
+	int sheetW = 0;
+	int sheetH = 0;
+	if (ok)
+	{
+		sortTallest(sprites, order, numOrder);
+		long bestArea = -1;
+		for (int w = maxW; w <= sumW; w++)
+		{
+			int h = shelfPack(sprites, order, numOrder, w);
+			long area = (long)w * h;
+			if (bestArea < 0 || area < bestArea)
+			{
+				bestArea = area;
+				sheetW = w;
+				sheetH = h;
+			}
+		}
+		shelfPack(sprites, order, numOrder, sheetW);
+		ok = sheetW <= UINT16_MAX && sheetH <= UINT16_MAX;
+	}
+
+	FILE * atlFile = NULL;
+	if (ok && NULL == (atlFile = fopen(outFilePath, "wb")))
+	{
+		fprintf(stderr, "Couldn't open %s\n", outFilePath);
+		ok = false;
+	}
+	if (ok)
+	{
+		/* Draw the sheet, transparent where there's no sprite */
+		uint8_t * sheet = malloc(sheetW * sheetH);
+		memset(sheet, PALETTE_TRANSPARENT, sheetW * sheetH);
+		for (uint32_t i = 0; i < numOrder; i++)
+		{
+			const atlasSprite_t * s = &sprites[order[i]];
+			for (int y = 0; y < s->h; y++)
+			{
+				memcpy(&sheet[((s->y + y) * sheetW) + s->x], &s->px[y * s->w], s->w);
+			}
+		}
+
+		/* The table, in name order */
+		uint8_t hdr[] = {HI_BYTE(numSprites), LO_BYTE(numSprites), HI_BYTE(namesSize), LO_BYTE(namesSize)};
+		fwrite(hdr, sizeof(hdr), 1, atlFile);
+		uint32_t nameOffset = 0;
+		for (uint32_t i = 0; i < numSprites; i++)
+		{
+			const atlasSprite_t * s = (sprites[i].sameAs < 0) ? &sprites[i] : &sprites[sprites[i].sameAs];
+			uint8_t region[] =
+			{
+				HI_BYTE(nameOffset), LO_BYTE(nameOffset),
+				HI_BYTE(s->x), LO_BYTE(s->x),
+				HI_BYTE(s->y), LO_BYTE(s->y),
+				HI_BYTE(s->w), LO_BYTE(s->w),
+				HI_BYTE(s->h), LO_BYTE(s->h),
+			};
+			fwrite(region, sizeof(region), 1, atlFile);
+			nameOffset += strlen(sprites[i].name) + 1;
+		}
+		for (uint32_t i = 0; i < numSprites; i++)
+		{
+			fwrite(sprites[i].name, strlen(sprites[i].name) + 1, 1, atlFile);
+		}
+
+		/* Then the sheet */
+		char report[128];
+		long written = writeWsg(atlFile, infile, sheet, sheetW, sheetH, report, sizeof(report));
+		ok = (0 == fclose(atlFile)) && (0 <= written);
+		free(sheet);
+
+		/* Print results */
+		if (ok)
+		{
+			printf("%s:\n  %u sprites, %u unique, in a %dx%d sheet\n  Atlas file size: %ld\n  %s\n",
+				   infile, numSprites, numOrder, sheetW, sheetH, getFileSize(outFilePath), report);
+		}
+	}
+
+	for (uint32_t i = 0; i < numSprites; i++)
+	{
+		free(sprites[i].name);
+		free(sprites[i].px);
+		free(members[i]);
+	}
+	free(sprites);
+	free(order);
+	free(members);
+	return ok;
+}
@@ -0,0 +1,29 @@
+#ifndef _ATLAS_PROCESSOR_H_
+#define _ATLAS_PROCESSOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "image_processor.h"
+
+// Bump this whenever the output changes, so the manifest rebuilds every atlas.
+// Atlases hold a WSG, so they're rebuilt when images are too
+#define ATLAS_PROCESSOR_VERSION ((IMAGE_PROCESSOR_VERSION * 100) + 1)
+
+/*
+ * An atlas is every PNG in one directory packed into one WSG, declared by
+ * putting a NAME.atlas file in that directory. It starts with the number of
+ * sprites and the size of the name table, then each sprite's name offset, x, y,
+ * width and height, sorted by name, all big endian uint16_t. The null
+ * terminated names follow, then the sheet as a WSG.
+ *
+ * This must match display.h
+ */
+#define ATLAS_HEADER_SIZE 4
+#define ATLAS_REGION_SIZE 10
+
+bool isAtlasMember(const char * atlasFile, const char * path);
+bool hash_atlas(const char * infile, uint64_t * hash);
+bool process_atlas(const char * infile, const char * outdir);
+
+#endif /* _ATLAS_PROCESSOR_H_ */
@@ -6,22 +6,21 @@
 
 #include "bin_processor.h"
 
-void process_bin(const char * infile, const char * outdir) 
+bool process_bin(const char * infile, const char * outdir) 
 {
-    /* Determine if the output file already exists */
+    /* Determine the output file name */
     char outFilePath[128] = {0};
     strcat(outFilePath, outdir);
     strcat(outFilePath, "/");
     strcat(outFilePath, get_filename(infile));
 
-    if(doesFileExist(outFilePath))
-    {
-        printf("Output for %s already exists\n", infile);
-        return;
-    }
-
     /* Read input file */
     FILE *fp = fopen(infile, "rb");
+    if(NULL == fp)
+    {
+        fprintf(stderr, "Couldn't open %s\n", infile);
+        return false;
+    }
     fseek(fp, 0L, SEEK_END);
     long sz = ftell(fp);
     fseek(fp, 0L, SEEK_SET);
@@ -32,6 +31,12 @@ void process_bin(const char * infile, const char * outdir)
 
     /* Write input directly to output */
     FILE* outFile = fopen(outFilePath, "wb");
+    if(NULL == outFile)
+    {
+        fprintf(stderr, "Couldn't open %s\n", outFilePath);
+        return false;
+    }
     fwrite(byteString, sz, 1, outFile);
     fclose(outFile);
+    return true;
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #ifndef _BIN_PROCESSOR_H_
 #define _BIN_PROCESSOR_H_
 
-void process_bin(const char * infile, const char * outdir);
+#include <stdbool.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every binary file
+#define BIN_PROCESSOR_VERSION 1
+
+bool process_bin(const char * infile, const char * outdir);
 
 #endif /* _BIN_PROCESSOR_H_ */
\ No newline at end of file
@@ -0,0 +1,592 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fighter_processor.h"
+#include "cJSON.h"
+#include "fileUtils.h"
+
+/**
+ * What a JSON value has to be
+ */
+typedef enum
+{
+	FT_STRING,
+	FT_INT,
+	FT_BOOL,
+	FT_SPRITE, /* A string ending in .wsg */
+	FT_ARRAY,
+} fieldType_t;
+
+/**
+ * One field a JSON object may have. Integers are checked against min and max
+ * before they're converted, arrays' lengths are
+ */
+typedef struct
+{
+	const char * key;
+	fieldType_t type;
+	long min;
+	long max;
+	bool required;
+} fieldSpec_t;
+
+/* Limits for integers, before they're converted */
+#define MS_MAX     (UINT16_MAX * (long)FIGHTER_FRAME_TIME_MS)
+#define SCALED_MAX (INT32_MAX >> FIGHTER_SF)
+
+enum
+{
+	F_NAME, F_IDLE0, F_IDLE1, F_RUN0, F_RUN1, F_JUMP, F_DUCK, F_LAND_LAG_SPR, F_HITSTUN_GROUND, F_HITSTUN_AIR,
+	F_GRAVITY, F_JUMP_VELO, F_RUN_ACCEL, F_RUN_DECEL, F_RUN_MAX_VELO, F_SIZE_X, F_SIZE_Y, F_NJUMPS,
+	F_LANDING_LAG, F_ATTACKS, F_NUM_FIELDS
+};
+
+static const fieldSpec_t fighterFields[F_NUM_FIELDS] =
+{
+	[F_NAME]           = {"name",                  FT_STRING, 0,           0,           false},
+	[F_IDLE0]          = {"idle_spr_0",            FT_SPRITE, 0,           0,           true},
+	[F_IDLE1]          = {"idle_spr_1",            FT_SPRITE, 0,           0,           true},
+	[F_RUN0]           = {"run_spr_0",             FT_SPRITE, 0,           0,           true},
+	[F_RUN1]           = {"run_spr_1",             FT_SPRITE, 0,           0,           true},
+	[F_JUMP]           = {"jump_spr",              FT_SPRITE, 0,           0,           true},
+	[F_DUCK]           = {"duck_spr",              FT_SPRITE, 0,           0,           true},
+	[F_LAND_LAG_SPR]   = {"land_lag_spr",          FT_SPRITE, 0,           0,           true},
+	[F_HITSTUN_GROUND] = {"hitstun_ground_sprite", FT_SPRITE, 0,           0,           true},
+	[F_HITSTUN_AIR]    = {"hitstun_air_sprite",    FT_SPRITE, 0,           0,           true},
+	[F_GRAVITY]        = {"gravity",               FT_INT,    INT32_MIN,   INT32_MAX,   false},
+	[F_JUMP_VELO]      = {"jump_velo",             FT_INT,    INT32_MIN,   INT32_MAX,   false},
+	[F_RUN_ACCEL]      = {"run_accel",             FT_INT,    INT32_MIN,   INT32_MAX,   false},
+	[F_RUN_DECEL]      = {"run_decel",             FT_INT,    INT32_MIN,   INT32_MAX,   false},
+	[F_RUN_MAX_VELO]   = {"run_max_velo",          FT_INT,    INT32_MIN,   INT32_MAX,   false},
+	[F_SIZE_X]         = {"size_x",                FT_INT,    0,           SCALED_MAX,  true},
+	[F_SIZE_Y]         = {"size_y",                FT_INT,    0,           SCALED_MAX,  true},
+	[F_NJUMPS]         = {"nJumps",                FT_INT,    0,           UINT8_MAX,   false},
+	[F_LANDING_LAG]    = {"landing_lag",           FT_INT,    0,           UINT16_MAX,  false},
+	/* A fighter has every attack or none, like the sandbag */
+	[F_ATTACKS]        = {"attacks",               FT_ARRAY,  FIGHTER_NUM_ATTACKS, FIGHTER_NUM_ATTACKS, false},
+};
+
+enum
+{
+	A_TYPE, A_STARTUP_LAG, A_END_LAG, A_LANDING_LAG, A_STARTUP_LAG_SPR, A_END_LAG_SPR, A_ONLY_FIRST_HIT,
+	A_IFRAMES, A_FRAMES, A_NUM_FIELDS
+};
+
+static const fieldSpec_t attackFields[A_NUM_FIELDS] =
+{
+	[A_TYPE]            = {"type",          FT_STRING, 0, 0,          false},
+	[A_STARTUP_LAG]     = {"startupLag",    FT_INT,    0, MS_MAX,     false},
+	[A_END_LAG]         = {"endLag",        FT_INT,    0, MS_MAX,     false},
+	[A_LANDING_LAG]     = {"landing_lag",   FT_INT,    0, UINT16_MAX, false},
+	[A_STARTUP_LAG_SPR] = {"startupLagSpr", FT_SPRITE, 0, 0,          true},
+	[A_END_LAG_SPR]     = {"endLagSpr",     FT_SPRITE, 0, 0,          true},
+	[A_ONLY_FIRST_HIT]  = {"onlyFirstHit",  FT_BOOL,   0, 0,          false},
+	[A_IFRAMES]         = {"iframe_timer",  FT_INT,    0, MS_MAX,     false},
+	[A_FRAMES]          = {"attack_frames", FT_ARRAY,  1, UINT8_MAX,  true},
+};
+
+enum
+{
+	FR_DURATION, FR_SPRITE, FR_SPRITE_OFFSET_X, FR_SPRITE_OFFSET_Y, FR_HURTBOX_OFFSET_X, FR_HURTBOX_OFFSET_Y,
+	FR_HURTBOX_SIZE_X, FR_HURTBOX_SIZE_Y, FR_IFRAMES, FR_VELO_X, FR_VELO_Y, FR_HITBOXES, FR_NUM_FIELDS
+};
+
+static const fieldSpec_t frameFields[FR_NUM_FIELDS] =
+{
+	[FR_DURATION]         = {"duration",         FT_INT,    0,         MS_MAX,    true},
+	[FR_SPRITE]           = {"sprite",           FT_SPRITE, 0,         0,         true},
+	[FR_SPRITE_OFFSET_X]  = {"sprite_offset_x",  FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_SPRITE_OFFSET_Y]  = {"sprite_offset_y",  FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_HURTBOX_OFFSET_X] = {"hurtbox_offset_x", FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_HURTBOX_OFFSET_Y] = {"hurtbox_offset_y", FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_HURTBOX_SIZE_X]   = {"hurtbox_size_x",   FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_HURTBOX_SIZE_Y]   = {"hurtbox_size_y",   FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_IFRAMES]          = {"iframe_timer",     FT_INT,    0,         MS_MAX,    false},
+	[FR_VELO_X]           = {"velo_x",           FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_VELO_Y]           = {"velo_y",           FT_INT,    INT32_MIN, INT32_MAX, false},
+	[FR_HITBOXES]         = {"hitboxes",         FT_ARRAY,  0,         UINT8_MAX, false},
+};
+
+enum
+{
+	H_POS_X, H_POS_Y, H_SIZE_X, H_SIZE_Y, H_DAMAGE, H_KNOCKBACK_X, H_KNOCKBACK_Y, H_HITSTUN, H_IS_PROJECTILE,
+	H_PROJ_SPRITE, H_PROJ_DURATION, H_PROJ_VELO_X, H_PROJ_VELO_Y, H_PROJ_ACCEL_X, H_PROJ_ACCEL_Y, H_NUM_FIELDS
+};
+
+static const fieldSpec_t hitboxFields[H_NUM_FIELDS] =
+{
+	[H_POS_X]         = {"relativePos_x",      FT_INT,    -SCALED_MAX, SCALED_MAX, true},
+	[H_POS_Y]         = {"relativePos_y",      FT_INT,    -SCALED_MAX, SCALED_MAX, true},
+	[H_SIZE_X]        = {"size_x",             FT_INT,    0,           SCALED_MAX, true},
+	[H_SIZE_Y]        = {"size_y",             FT_INT,    0,           SCALED_MAX, true},
+	[H_DAMAGE]        = {"damage",             FT_INT,    0,           UINT16_MAX, false},
+	[H_KNOCKBACK_X]   = {"knockback_x",        FT_INT,    INT32_MIN,   INT32_MAX,  false},
+	[H_KNOCKBACK_Y]   = {"knockback_y",        FT_INT,    INT32_MIN,   INT32_MAX,  false},
+	[H_HITSTUN]       = {"hitstun",            FT_INT,    0,           UINT16_MAX, false},
+	[H_IS_PROJECTILE] = {"isProjectile",       FT_BOOL,   0,           0,          false},
+	[H_PROJ_SPRITE]   = {"projectileSprite",   FT_SPRITE, 0,           0,          false},
+	[H_PROJ_DURATION] = {"projectileDuration", FT_INT,    0,           UINT16_MAX, false},
+	[H_PROJ_VELO_X]   = {"projectileVelo_x",   FT_INT,    INT32_MIN,   INT32_MAX,  false},
+	[H_PROJ_VELO_Y]   = {"projectileVelo_y",   FT_INT,    INT32_MIN,   INT32_MAX,  false},
+	[H_PROJ_ACCEL_X]  = {"projectileAccel_x",  FT_INT,    INT32_MIN,   INT32_MAX,  false},
+	[H_PROJ_ACCEL_Y]  = {"projectileAccel_y",  FT_INT,    INT32_MIN,   INT32_MAX,  false},
+};
+
+/**
+ * A growing buffer of big endian records
+ */
+typedef struct
+{
+	uint8_t * data;
+	size_t len;
+	size_t cap;
+} outBuf_t;
+
+/**
+ * Everything compiled so far
+ */
+typedef struct
+{
+	const char * infile;
+	outBuf_t attacks;
+	outBuf_t frames;
+	outBuf_t hitboxes;
+	uint32_t numFrames;
+	uint32_t numHitboxes;
+	char * sprites[FIGHTER_NO_SPRITE];
+	uint32_t numSprites;
+	uint32_t namesSize;
+} fighterBuild_t;
+
+/**
+ * @brief Append a big endian value to a buffer
+ *
+ * @param buf The buffer to append to
+ * @param val The value, which is truncated to size bytes
+ * @param size The number of bytes to append, 1, 2 or 4
+ */
+static void put(outBuf_t * buf, uint32_t val, int size)
+{
+	if (buf->len + size > buf->cap)
+	{
+		buf->cap = buf->cap ? (buf->cap * 2) : 256;
+		buf->data = realloc(buf->data, buf->cap);
+	}
+	for (int i = size - 1; i >= 0; i--)
+	{
+		buf->data[buf->len++] = (val >> (8 * i)) & 0xFF;
+	}
+}
+
+/**
+ * @brief Check every field of a JSON object against what it may have
+ *
+ * @param fb The fighter being compiled, for error messages
+ * @param where Where the object is in the JSON, for error messages
+ * @param obj The object to check
+ * @param specs The fields it may have
+ * @param numSpecs The number of fields it may have
+ * @param vals Where to write each field's value, NULL if it's missing
+ * @return true if the object is valid, false if it isn't
+ */
+static bool checkObject(const fighterBuild_t * fb, const char * where, const cJSON * obj,
+						const fieldSpec_t * specs, int numSpecs, const cJSON ** vals)
+{
+	if (!cJSON_IsObject(obj))
+	{
+		fprintf(stderr, "%s: %s isn't an object\n", fb->infile, where);
+		return false;
+	}
+	memset(vals, 0, numSpecs * sizeof(cJSON *));
+
+	bool ok = true;
+	const cJSON * item;
+	cJSON_ArrayForEach(item, obj)
+	{
+		int s = 0;
+		while (s < numSpecs && 0 != strcmp(specs[s].key, item->string))
+		{
+			s++;
+		}
+		if (s == numSpecs)
+		{
+			fprintf(stderr, "%s: %s has an unknown field \"%s\"\n", fb->infile, where, item->string);
+			ok = false;
+			continue;
+		}
+		if (NULL != vals[s])
+		{
+			fprintf(stderr, "%s: %s has \"%s\" twice\n", fb->infile, where, item->string);
+			ok = false;
+			continue;
+		}
+		vals[s] = item;
+
+		const fieldSpec_t * spec = &specs[s];
+		bool typeOk = false;
+		switch (spec->type)
+		{
+			case FT_STRING:
+			{
+				typeOk = cJSON_IsString(item);
+				break;
+			}
+			case FT_SPRITE:
+			{
+				size_t len = cJSON_IsString(item) ? strlen(item->valuestring) : 0;
+				typeOk = len > 4 && 0 == strcmp(&item->valuestring[len - 4], ".wsg");
+				break;
+			}
+			case FT_BOOL:
+			{
+				typeOk = cJSON_IsBool(item);
+				break;
+			}
+			case FT_INT:
+			{
+				typeOk = cJSON_IsNumber(item) && item->valuedouble >= spec->min && item->valuedouble <= spec->max &&
+						 item->valuedouble == (double)(long)item->valuedouble;
+				break;
+			}
+			case FT_ARRAY:
+			{
+				int size = cJSON_IsArray(item) ? cJSON_GetArraySize(item) : -1;
+				typeOk = size >= spec->min && size <= spec->max;
+				break;
+			}
+		}
+		if (!typeOk)
+		{
+			static const char * const typeNames[] =
+			{
+				[FT_STRING] = "a string",
+				[FT_INT]    = "an integer",
+				[FT_BOOL]   = "a boolean",
+				[FT_SPRITE] = "a .wsg name",
+				[FT_ARRAY]  = "an array",
+			};
+			fprintf(stderr, "%s: %s \"%s\" must be %s", fb->infile, where, item->string, typeNames[spec->type]);
+			if (FT_INT == spec->type || FT_ARRAY == spec->type)
+			{
+				fprintf(stderr, " from %ld to %ld%s", spec->min, spec->max, (FT_ARRAY == spec->type) ? " long" : "");
+			}
+			fprintf(stderr, "\n");
+			ok = false;
+		}
+	}
+
+	for (int s = 0; s < numSpecs; s++)
+	{
+		if (specs[s].required && NULL == vals[s])
+		{
+			fprintf(stderr, "%s: %s is missing \"%s\"\n", fb->infile, where, specs[s].key);
+			ok = false;
+		}
+	}
+	return ok;
+}
+
+/**
+ * @brief Get an integer field which has been checked
+ *
+ * @param val The field, or NULL if it's missing
+ * @return The value, or 0 if it's missing
+ */
+static long intVal(const cJSON * val)
+{
+	return (NULL == val) ? 0 : (long)val->valuedouble;
+}
+
+/**
+ * @brief Get a sprite's index in the names table, adding it if it's new. Each
+ * sprite is loaded once on the Swadge, no matter how often it's used
+ *
+ * @param fb The fighter being compiled
+ * @param val The sprite field, or NULL if it's missing
+ * @return The sprite's index, FIGHTER_NO_SPRITE if it's missing, or -1 if there
+ *         are too many sprites
+ */
+static int spriteIdx(fighterBuild_t * fb, const cJSON * val)
+{
+	if (NULL == val)
+	{
+		return FIGHTER_NO_SPRITE;
+	}
+	for (uint32_t i = 0; i < fb->numSprites; i++)
+	{
+		if (0 == strcmp(fb->sprites[i], val->valuestring))
+		{
+			return i;
+		}
+	}
+	if (FIGHTER_NO_SPRITE == fb->numSprites)
+	{
+		fprintf(stderr, "%s: has more than %d sprites\n", fb->infile, FIGHTER_NO_SPRITE);
+		return -1;
+	}
+	fb->sprites[fb->numSprites] = val->valuestring;
+	fb->namesSize += strlen(val->valuestring) + 1;
+	return fb->numSprites++;
+}
+
+/**
+ * @brief Check and compile one hitbox
+ *
+ * @param fb The fighter being compiled
+ * @param where Where the hitbox is in the JSON
+ * @param obj The hitbox's JSON object
+ * @return true if the hitbox was compiled, false if it's invalid
+ */
+static bool compileHitbox(fighterBuild_t * fb, const char * where, const cJSON * obj)
+{
+	const cJSON * v[H_NUM_FIELDS];
+	if (!checkObject(fb, where, obj, hitboxFields, H_NUM_FIELDS, v))
+	{
+		return false;
+	}
+	bool isProjectile = cJSON_IsTrue(v[H_IS_PROJECTILE]);
+	if (isProjectile && NULL == v[H_PROJ_SPRITE])
+	{
+		fprintf(stderr, "%s: %s is a projectile without a \"projectileSprite\"\n", fb->infile, where);
+		return false;
+	}
+	int projSprite = spriteIdx(fb, v[H_PROJ_SPRITE]);
+	if (projSprite < 0)
+	{
+		return false;
+	}
+
+	outBuf_t * b = &fb->hitboxes;
+	put(b, intVal(v[H_POS_X]) * (1 << FIGHTER_SF), 4);
+	put(b, intVal(v[H_POS_Y]) * (1 << FIGHTER_SF), 4);
+	put(b, intVal(v[H_SIZE_X]) << FIGHTER_SF, 4);
+	put(b, intVal(v[H_SIZE_Y]) << FIGHTER_SF, 4);
+	put(b, intVal(v[H_KNOCKBACK_X]), 4);
+	put(b, intVal(v[H_KNOCKBACK_Y]), 4);
+	put(b, intVal(v[H_PROJ_VELO_X]), 4);
+	put(b, intVal(v[H_PROJ_VELO_Y]), 4);
+	put(b, intVal(v[H_PROJ_ACCEL_X]), 4);
+	put(b, intVal(v[H_PROJ_ACCEL_Y]), 4);
+	put(b, intVal(v[H_DAMAGE]), 2);
+	put(b, intVal(v[H_HITSTUN]), 2);
+	put(b, intVal(v[H_PROJ_DURATION]), 2);
+	put(b, isProjectile, 1);
+	put(b, projSprite, 1);
+	fb->numHitboxes++;
+	return true;
+}
+
+/**
+ * @brief Check and compile one attack frame and its hitboxes
+ *
+ * @param fb The fighter being compiled
+ * @param where Where the frame is in the JSON
+ * @param obj The frame's JSON object
+ * @return true if the frame was compiled, false if it's invalid
+ */
+static bool compileFrame(fighterBuild_t * fb, const char * where, const cJSON * obj)
+{
+	const cJSON * v[FR_NUM_FIELDS];
+	if (!checkObject(fb, where, obj, frameFields, FR_NUM_FIELDS, v))
+	{
+		return false;
+	}
+	int sprite = spriteIdx(fb, v[FR_SPRITE]);
+	if (sprite < 0)
+	{
+		return false;
+	}
+
+	int numHitboxes = cJSON_GetArraySize(v[FR_HITBOXES]);
+	outBuf_t * b = &fb->frames;
+	put(b, sprite, 1);
+	put(b, numHitboxes, 1);
+	put(b, intVal(v[FR_DURATION]) / FIGHTER_FRAME_TIME_MS, 2);
+	put(b, intVal(v[FR_IFRAMES]) / FIGHTER_FRAME_TIME_MS, 2);
+	put(b, intVal(v[FR_SPRITE_OFFSET_X]), 4);
+	put(b, intVal(v[FR_SPRITE_OFFSET_Y]), 4);
+	put(b, intVal(v[FR_HURTBOX_OFFSET_X]), 4);
+	put(b, intVal(v[FR_HURTBOX_OFFSET_Y]), 4);
+	put(b, intVal(v[FR_HURTBOX_SIZE_X]), 4);
+	put(b, intVal(v[FR_HURTBOX_SIZE_Y]), 4);
+	put(b, intVal(v[FR_VELO_X]), 4);
+	put(b, intVal(v[FR_VELO_Y]), 4);
+	fb->numFrames++;
+
+	bool ok = true;
+	for (int i = 0; i < numHitboxes; i++)
+	{
+		char hbWhere[256];
+		snprintf(hbWhere, sizeof(hbWhere), "%s.hitboxes[%d]", where, i);
+		ok = compileHitbox(fb, hbWhere, cJSON_GetArrayItem(v[FR_HITBOXES], i)) && ok;
+	}
+	return ok;
+}
+
+/**
+ * @brief Check and compile one attack and its frames
+ *
+ * @param fb The fighter being compiled
+ * @param where Where the attack is in the JSON
+ * @param obj The attack's JSON object
+ * @return true if the attack was compiled, false if it's invalid
+ */
+static bool compileAttack(fighterBuild_t * fb, const char * where, const cJSON * obj)
+{
+	const cJSON * v[A_NUM_FIELDS];
+	if (!checkObject(fb, where, obj, attackFields, A_NUM_FIELDS, v))
+	{
+		return false;
+	}
+	int startupLagSprite = spriteIdx(fb, v[A_STARTUP_LAG_SPR]);
+	int endLagSprite = spriteIdx(fb, v[A_END_LAG_SPR]);
+	if (startupLagSprite < 0 || endLagSprite < 0)
+	{
+		return false;
+	}
+
+	int numFrames = cJSON_GetArraySize(v[A_FRAMES]);
+	outBuf_t * b = &fb->attacks;
+	put(b, startupLagSprite, 1);
+	put(b, endLagSprite, 1);
+	put(b, intVal(v[A_STARTUP_LAG]) / FIGHTER_FRAME_TIME_MS, 2);
+	put(b, intVal(v[A_END_LAG]) / FIGHTER_FRAME_TIME_MS, 2);
+	put(b, intVal(v[A_LANDING_LAG]), 2);
+	put(b, intVal(v[A_IFRAMES]) / FIGHTER_FRAME_TIME_MS, 2);
+	put(b, numFrames, 1);
+	put(b, cJSON_IsTrue(v[A_ONLY_FIRST_HIT]), 1);
+
+	bool ok = true;
+	for (int i = 0; i < numFrames; i++)
+	{
+		char frmWhere[128];
+		snprintf(frmWhere, sizeof(frmWhere), "%s.attack_frames[%d]", where, i);
+		ok = compileFrame(fb, frmWhere, cJSON_GetArrayItem(v[A_FRAMES], i)) && ok;
+	}
+	return ok;
+}
+
+/**
+ * @brief Compile a fighter's JSON into the flat binary the fighter mode loads,
+ * see fighter_processor.h. The JSON is checked here, so a mistake fails the
+ * build rather than the Swadge
+ *
+ * @param infile The NAME.ftr.json file, the fighter is written to NAME.ftr
+ * @param outdir The directory to write the fighter to
+ * @return true if the fighter was written, false if it wasn't
+ */
+bool process_fighter(const char * infile, const char * outdir)
+{
+	/* Determine the output file name */
+	char outFilePath[128] = {0};
+	strcat(outFilePath, outdir);
+	strcat(outFilePath, "/");
+	strcat(outFilePath, get_filename(infile));
+	strrchr(outFilePath, '.')[0] = 0;
+
+	/* Read input file */
+	FILE * fp = fopen(infile, "rb");
+	if (NULL == fp)
+	{
+		fprintf(stderr, "Couldn't open %s\n", infile);
+		return false;
+	}
+	fseek(fp, 0L, SEEK_END);
+	long sz = ftell(fp);
+	fseek(fp, 0L, SEEK_SET);
+	char * jsonStr = malloc(sz + 1);
+	bool ok = (1 == fread(jsonStr, sz, 1, fp));
+	jsonStr[sz] = 0;
+	fclose(fp);
+
+	cJSON * json = ok ? cJSON_Parse(jsonStr) : NULL;
+	free(jsonStr);
+	if (NULL == json)
+	{
+		fprintf(stderr, "%s isn't valid JSON\n", infile);
+		return false;
+	}
+
+	/* Check and compile the fighter, then its attacks */
+	fighterBuild_t fb = {.infile = infile};
+	const cJSON * v[F_NUM_FIELDS];
+	ok = checkObject(&fb, "the fighter", json, fighterFields, F_NUM_FIELDS, v);
+	uint8_t sprites[F_HITSTUN_AIR - F_IDLE0 + 1];
+	for (int f = F_IDLE0; ok && f <= F_HITSTUN_AIR; f++)
+	{
+		int idx = spriteIdx(&fb, v[f]);
+		ok = (0 <= idx);
+		sprites[f - F_IDLE0] = idx;
+	}
+	/* Keep checking the attacks after a mistake, to report every mistake at once */
+	int numAttacks = (cJSON_IsArray(v[F_ATTACKS]) && FIGHTER_NUM_ATTACKS == cJSON_GetArraySize(v[F_ATTACKS])) ?
+					 FIGHTER_NUM_ATTACKS : 0;
+	for (int i = 0; i < numAttacks; i++)
+	{
+		char where[32];
+		snprintf(where, sizeof(where), "attacks[%d]", i);
+		ok = compileAttack(&fb, where, cJSON_GetArrayItem(v[F_ATTACKS], i)) && ok;
+	}
+	if (ok && (fb.numFrames > UINT16_MAX || fb.numHitboxes > UINT16_MAX || fb.namesSize > UINT16_MAX))
+	{
+		fprintf(stderr, "%s has too many frames, hitboxes or sprites\n", infile);
+		ok = false;
+	}
+
+	FILE * ftrFile = NULL;
+	if (ok && NULL == (ftrFile = fopen(outFilePath, "wb")))
+	{
+		fprintf(stderr, "Couldn't open %s\n", outFilePath);
+		ok = false;
+	}
+	if (ok)
+	{
+		/* The header and the fighter's own record */
+		outBuf_t hdr = {0};
+		put(&hdr, ('F' << 24) | ('T' << 16) | ('R' << 8) | FIGHTER_DATA_VERSION, 4);
+		put(&hdr, fb.numSprites, 1);
+		put(&hdr, numAttacks, 1);
+		put(&hdr, fb.numFrames, 2);
+		put(&hdr, fb.numHitboxes, 2);
+		put(&hdr, fb.namesSize, 2);
+		put(&hdr, intVal(v[F_GRAVITY]), 4);
+		put(&hdr, intVal(v[F_JUMP_VELO]), 4);
+		put(&hdr, intVal(v[F_RUN_ACCEL]), 4);
+		put(&hdr, intVal(v[F_RUN_DECEL]), 4);
+		put(&hdr, intVal(v[F_RUN_MAX_VELO]), 4);
+		put(&hdr, intVal(v[F_SIZE_X]) << FIGHTER_SF, 4);
+		put(&hdr, intVal(v[F_SIZE_Y]) << FIGHTER_SF, 4);
+		put(&hdr, intVal(v[F_LANDING_LAG]), 2);
+		put(&hdr, intVal(v[F_NJUMPS]), 1);
+		for (uint32_t i = 0; i < sizeof(sprites); i++)
+		{
+			put(&hdr, sprites[i], 1);
+		}
+
+		fwrite(hdr.data, hdr.len, 1, ftrFile);
+		fwrite(fb.attacks.data, fb.attacks.len, 1, ftrFile);
+		fwrite(fb.frames.data, fb.frames.len, 1, ftrFile);
+		fwrite(fb.hitboxes.data, fb.hitboxes.len, 1, ftrFile);
+		for (uint32_t i = 0; i < fb.numSprites; i++)
+		{
+			fwrite(fb.sprites[i], strlen(fb.sprites[i]) + 1, 1, ftrFile);
+		}
+		ok = (0 == fclose(ftrFile));
+		free(hdr.data);
+
+		/* Print results */
+		if (ok)
+		{
+			printf("%s:\n  %d attacks, %u frames, %u hitboxes, %u sprites\n  Source file size: %ld\n  Fighter file size: %ld\n",
+				   infile, numAttacks, fb.numFrames, fb.numHitboxes, fb.numSprites, sz, getFileSize(outFilePath));
+		}
+	}
+
+	free(fb.attacks.data);
+	free(fb.frames.data);
+	free(fb.hitboxes.data);
+	cJSON_Delete(json);
+	return ok;
+}
@@ -0,0 +1,36 @@
+#ifndef _FIGHTER_PROCESSOR_H_
+#define _FIGHTER_PROCESSOR_H_
+
+#include <stdbool.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every fighter
+#define FIGHTER_PROCESSOR_VERSION 1
+
+/*
+ * A fighter is compiled from NAME.ftr.json to NAME.ftr. It starts with "FTR"
+ * and a version byte, then the number of sprites and attacks (uint8_t) and the
+ * number of attack frames, hitboxes and bytes of sprite names (uint16_t). The
+ * fighter's record follows, then each attack's, each frame's in attack order
+ * and each hitbox's in frame order. Sprites are indices into the null
+ * terminated names which come last, FIGHTER_NO_SPRITE if there isn't one.
+ * Times are already in frames and positions already scaled by SF. All
+ * multi-byte values are big endian.
+ *
+ * This must match fighter_data.h
+ */
+#define FIGHTER_DATA_VERSION 1
+#define FIGHTER_HEADER_SIZE 12
+#define FIGHTER_RECORD_SIZE 40
+#define FIGHTER_ATTACK_SIZE 12
+#define FIGHTER_FRAME_SIZE 38
+#define FIGHTER_HITBOX_SIZE 48
+#define FIGHTER_NO_SPRITE 0xFF
+
+/* These must match mode_fighter.h */
+#define FIGHTER_NUM_ATTACKS 9
+#define FIGHTER_FRAME_TIME_MS 50
+#define FIGHTER_SF 8
+
+bool process_fighter(const char * infile, const char * outdir);
+
+#endif /* _FIGHTER_PROCESSOR_H_ */
@@ -3,6 +3,7 @@
 #include <errno.h>
 #include <sys/stat.h>
 #include <string.h>
+#include <stdint.h>
 #include <unistd.h>
 
 #include "fileUtils.h"
@@ -60,4 +61,46 @@ const char *get_filename(const char *filename) {
         return "";
     }
     return slash + 1;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Hash a file's contents with 64 bit FNV-1a
+ *
+ * @param fname The file to hash
+ * @param hash The hash so far, FNV64_OFFSET to start one, updated
+ * @return true if the file was read, false if it wasn't
+ */
+bool hashFile(const char * fname, uint64_t * hash)
+{
+	FILE * fp = fopen(fname, "rb");
+	if (NULL == fp)
+	{
+		return false;
+	}
+	uint8_t buf[16384];
+	size_t n;
+	while (0 < (n = fread(buf, 1, sizeof(buf), fp)))
+	{
+		hashBytes(buf, n, hash);
+	}
+	fclose(fp);
+	return true;
+}
+
+/**
+ * @brief Add bytes to a 64 bit FNV-1a hash
+ *
+ * @param data The bytes to hash
+ * @param len The number of bytes
+ * @param hash The hash so far, FNV64_OFFSET to start one, updated
+ */
+void hashBytes(const void * data, size_t len, uint64_t * hash)
+{
+	const uint8_t * bytes = data;
+	uint64_t h = *hash;
+	for (size_t i = 0; i < len; i++)
+	{
+		h = (h ^ bytes[i]) * 0x100000001b3ULL;
+	}
+	*hash = h;
+}
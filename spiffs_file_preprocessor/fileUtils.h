@@ -2,12 +2,18 @@
 #define _FILE_UTILS_H_
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define HI_BYTE(x) ((x >> 8) & 0xFF)
 #define LO_BYTE(x) ((x) & 0xFF)
 
+#define FNV64_OFFSET 0xcbf29ce484222325ULL
+
 long getFileSize(const char *fname);
 bool doesFileExist(const char *fname);
 const char *get_filename(const char *filename);
+bool hashFile(const char * fname, uint64_t * hash);
+void hashBytes(const void * data, size_t len, uint64_t * hash);
 
 #endif
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
@@ -25,83 +26,80 @@ uint32_t getPx(unsigned char * data, int w, int x, int y)
 }
 
 /**
- * @brief TODO
+ * @brief Append a char's width, advance and opaque runs to the glyphs
  *
- * @param fp
- * @param data
- * @param w
- * @param h
- * @param charStartX
- * @param charEndX
+ * @param out The glyphs, which must have room for 2 + ((h - 2) * (width + 2)) bytes
+ * @param len The length of the glyphs so far, the char is appended there
+ * @param data The font PNG's pixels
+ * @param w The font PNG's width
+ * @param h The font PNG's height
+ * @param charStartX The char's first column in the PNG
+ * @param charEndX The char's last column in the PNG
+ * @return true if the char was appended, false if it's too wide
  */
-void appendCharToFile(FILE * fp, unsigned char * data, int w, int h,
-                      int charStartX, int charEndX)
+static bool appendChar(uint8_t * out, size_t * len, unsigned char * data, int w, int h,
+                       int charStartX, int charEndX)
 {
-    /* Write the output width */
-    putc(charEndX - charStartX + 1, fp);
+    int charW = charEndX - charStartX + 1;
+    if(charW > UINT8_MAX - 1)
+    {
+        return false;
+    }
+
+    /* Write the width, then the advance, which includes a blank column */
+    out[(*len)++] = charW;
+    out[(*len)++] = charW + 1;
 
-    /* Write the output bitmap data */
-    unsigned char outByte = 0;
-    uint8_t bitIdx = 0;
+    /* Write each row's runs of black pixels */
     for(int chy = 0; chy < h - 2; chy++)
     {
+        size_t countIdx = (*len)++;
+        uint8_t runs = 0;
         for(int chx = charStartX; chx <= charEndX; chx++)
         {
             if(0 == (0xFFFFFF & getPx(data, w, chx, chy)))
             {
-                outByte |= (1 << bitIdx);
-            }
-
-            bitIdx++;
-            if(8 == bitIdx)
-            {
-                putc(outByte, fp);
-                outByte = 0;
-                bitIdx = 0;
+                int runStart = chx;
+                while(chx + 1 <= charEndX && 0 == (0xFFFFFF & getPx(data, w, chx + 1, chy)))
+                {
+                    chx++;
+                }
+                out[(*len)++] = runStart - charStartX;
+                out[(*len)++] = chx - runStart + 1;
+                runs++;
             }
         }
+        out[countIdx] = runs;
     }
-
-    /* Write any straggling bits */
-    if(0 != bitIdx)
-    {
-        putc(outByte, fp);
-        outByte = 0;
-        bitIdx = 0;
-    }
+    return true;
 }
 
 /**
- * @brief TODO
+ * @brief Convert a font PNG into runs of opaque pixels for each row of each
+ * char, see font_processor.h
  *
- * @param infile
- * @param outdir
+ * @param infile The font PNG to convert
+ * @param outdir The directory to write the font to
+ * @return true if the font was written, false if it wasn't or it's malformed
  */
-void process_font(const char *infile, const char *outdir)
+bool process_font(const char *infile, const char *outdir)
 {
     /* Load the font PNG */
     int w,h,n;
     unsigned char *data = stbi_load(infile, &w, &h, &n, 4);
-
-    /* Open up the output file */
-    char outFilePath[128] = {0};
-    strcat(outFilePath, outdir);
-    strcat(outFilePath, "/");
-    strcat(outFilePath, get_filename(infile));
-    /* Clip off the ".png", leaving ".font" */
-    *(strrchr(outFilePath, '.')) = 0;
-    FILE *fp = fopen(outFilePath, "wb+");
-
-    int charsWritten = 0;
-
-    /* Write the output height, excluding spacing row */
-    putc(h - 2, fp);
+    if(NULL == data)
+    {
+        fprintf(stderr, "Couldn't load %s (%s)\n", infile, stbi_failure_reason());
+        return false;
+    }
 
     /* Start scanning the PNG for charcters */
+    int charStarts[FONT_NUM_CHARS];
+    int charEnds[FONT_NUM_CHARS];
+    int charsFound = 0;
     int charStartX = 0;
     int charEndX = 0;
     bool isCountingChar = false;
-    char ch = ' ';
     for(int x = 0; x < w; x++)
     {
         switch(0xFFFFFF & getPx(data, w, x, h-1))
@@ -116,10 +114,12 @@ void process_font(const char *infile, const char *outdir)
             /* white px (not black) */
             if(isCountingChar)
             {
-                appendCharToFile(fp, data, w, h, charStartX, charEndX);
-                charsWritten++;
-                /* Increment the char (dbg) */
-                ch++;
+                if(charsFound < FONT_NUM_CHARS)
+                {
+                    charStarts[charsFound] = charStartX;
+                    charEnds[charsFound] = charEndX;
+                }
+                charsFound++;
             }
             charStartX = x + 1;
             charEndX = x + 1;
@@ -132,17 +132,62 @@ void process_font(const char *infile, const char *outdir)
     /* Check for leftovers */
     if(charStartX != charEndX)
     {
-        appendCharToFile(fp, data, w, h, charStartX, charEndX);
-        charsWritten++;
+        if(charsFound < FONT_NUM_CHARS)
+        {
+            charStarts[charsFound] = charStartX;
+            charEnds[charsFound] = charEndX;
+        }
+        charsFound++;
     }
 
     /* Error check */
-    if(95 != charsWritten)
+    if(FONT_NUM_CHARS != charsFound || h < 3 || h - 2 > UINT8_MAX)
     {
-        fprintf(stderr, "ERROR: font %s isnt 95 chars (%d chars)\n", infile, charsWritten);
+        fprintf(stderr, "ERROR: font %s isnt %d chars (%d chars)\n", infile, FONT_NUM_CHARS, charsFound);
+        stbi_image_free(data);
+        return false;
     }
 
-    /* Cleanup */
-    fclose(fp);
+    /* Build every char after the header and offsets. Each char's widest
+     * possible rows alternate opaque and blank pixels
+     */
+    size_t len = FONT_HEADER_SIZE + (FONT_NUM_CHARS * 2);
+    uint8_t * font = malloc(len + (FONT_NUM_CHARS * 2) + ((size_t)(h - 2) * (w + (FONT_NUM_CHARS * 2))));
+    font[0] = h - 2;
+    font[1] = FONT_NUM_CHARS;
+    bool ok = true;
+    for(int ch = 0; ok && ch < FONT_NUM_CHARS; ch++)
+    {
+        font[FONT_HEADER_SIZE + (ch * 2)] = (len >> 8) & 0xFF;
+        font[FONT_HEADER_SIZE + (ch * 2) + 1] = len & 0xFF;
+        ok = appendChar(font, &len, data, w, h, charStarts[ch], charEnds[ch]);
+    }
     stbi_image_free(data);
+    if(!ok || len > UINT16_MAX)
+    {
+        fprintf(stderr, "ERROR: font %s is too big\n", infile);
+        free(font);
+        return false;
+    }
+
+    /* Write the output file */
+    char outFilePath[128] = {0};
+    strcat(outFilePath, outdir);
+    strcat(outFilePath, "/");
+    strcat(outFilePath, get_filename(infile));
+    /* Clip off the ".png", leaving ".font" */
+    *(strrchr(outFilePath, '.')) = 0;
+    FILE *fp = fopen(outFilePath, "wb+");
+    if(NULL == fp)
+    {
+        fprintf(stderr, "Couldn't open %s\n", outFilePath);
+        free(font);
+        return false;
+    }
+    ok = (1 == fwrite(font, len, 1, fp));
+
+    /* Cleanup */
+    ok = (0 == fclose(fp)) && ok;
+    free(font);
+    return ok;
 }
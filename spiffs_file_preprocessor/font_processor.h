@@ -1,6 +1,23 @@
 #ifndef _FONT_PROCESSOR_H_
 #define _FONT_PROCESSOR_H_
 
-void process_font(const char *infile, const char *outdir);
+#include <stdbool.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every font
+#define FONT_PROCESSOR_VERSION 2
+
+/*
+ * A font is compiled from NAME.font.png to NAME.font. It starts with the height
+ * and the number of chars (uint8_t), then each char's offset from the start of
+ * the file (big endian uint16_t). Each char is its width and its advance, the
+ * distance to the next char, then for each row the number of opaque runs and
+ * each run's x and length (uint8_t).
+ *
+ * This must match display.h
+ */
+#define FONT_HEADER_SIZE 2
+#define FONT_NUM_CHARS ('~' - ' ' + 1)
+
+bool process_font(const char *infile, const char *outdir);
 
 #endif
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include <limits.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -15,421 +17,852 @@
 #include "image_processor.h"
 
 #include "heatshrink_encoder.h"
+#include "heatshrink_decoder.h"
 
 #include "fileUtils.h"
 
 #define CLAMP(x,l,u) ((x) < l ? l : ((x) > u ? u : (x)))
 
+/* Tiles are dithered independently, this many pixels on a side */
+#define DITHER_TILE 64
+
+/* Images with fewer pixels than this are dithered on one thread */
+#define DITHER_PARALLEL_MIN (DITHER_TILE * DITHER_TILE * 4)
+
+/* The most threads to dither one image with */
+#define DITHER_MAX_THREADS 64
+
+/* The heatshrink parameters which are tried. The decoder needs 2^window bytes
+ * of RAM, so larger windows aren't worth it on the swadge
+ */
+#define WSG_MIN_WINDOW    5
+#define WSG_MAX_WINDOW    11
+#define WSG_MIN_LOOKAHEAD 3
+#define WSG_MAX_LOOKAHEAD 7
+#define WSG_MAX_CANDIDATES 48
+
+/**
+ * One way an image's pixels could be compressed
+ */
+typedef struct
+{
+	uint8_t codec;
+	uint8_t window;
+	uint8_t lookahead;
+	uint8_t * data;
+	uint32_t size;
+} wsgCandidate_t;
+
+/**
+ * One pixel's accumulated error, in a flat buffer with a one pixel border
+ * around the image. Border pixels are marked drawn so no error spreads to them,
+ * which saves bounds checking every neighbor
+ */
+typedef struct
+{
+	int16_t eR;
+	int16_t eG;
+	int16_t eB;
+	uint8_t isDrawn;
+	uint8_t pad;
+} ditherPx_t;
+
+/**
+ * Everything the dithering threads share
+ */
 typedef struct
 {
-	uint8_t r;
-	uint8_t g;
-	uint8_t b;
-	uint8_t a;
-	int eR;
-	int eG;
-	int eB;
-	bool isDrawn;
-} pixel_t;
+	const uint8_t * rgba;      /* The source image, 4 bytes per pixel */
+	ditherPx_t * px;           /* The error buffer, (w + 2) x (h + 2) */
+	uint8_t * paletteBuf;      /* Where palette indices are written, w x h */
+	int w;
+	int h;
+	uint16_t order[DITHER_TILE * DITHER_TILE]; /* The order pixels are dithered within a tile */
+	uint32_t tilesX;
+	uint32_t * tiles;          /* The tiles in this phase */
+	uint32_t numTiles;
+	uint32_t nextTile;
+} ditherJob_t;
+
+static int ditherThreads = 1;
+
+/* 65536 / n, so error can be split between n shares without dividing */
+static const int32_t shareRecip[13] =
+{
+	0, 65536, 32768, 21845, 16384, 13107, 10923, 9362, 8192, 7282, 6554, 5958, 5461
+};
 
 /**
- * @brief TODO
+ * @brief Set how many threads large images are dithered with
  *
- * @param ar
- * @param len
+ * @param numThreads The number of threads
  */
-void shuffleArray(uint32_t *ar, uint32_t len)
+void setImageProcessorThreads(int numThreads)
 {
-	srand(time(NULL));
+	ditherThreads = CLAMP(numThreads, 1, DITHER_MAX_THREADS);
+}
+
+/**
+ * @brief Shuffle an array. This always shuffles the same way, so images are
+ * dithered the same no matter when or on which thread they're processed
+ *
+ * @param ar The array to shuffle
+ * @param len The length of the array
+ */
+static void shuffleArray(uint16_t *ar, uint32_t len)
+{
+	/* xorshift32, with a fixed seed */
+	uint32_t rng = 0x2022CAFE;
 	for (int i = len - 1; i > 0; i--)
 	{
-		int index = rand() % (i + 1);
-		int a = ar[index];
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		int index = rng % (i + 1);
+		uint16_t a = ar[index];
 		ar[index] = ar[i];
 		ar[i] = a;
 	}
 }
 
 /**
- * @brief TODO
+ * @brief Quantize one 8 bit channel plus its error to one of six levels,
+ * rounding to the nearest
  *
- * @param img
- * @param x
- * @param y
- * @param w
- * @param h
- * @return int
+ * @param source The source channel
+ * @param err The error spread to this pixel
+ * @return The level, 0 to 5
  */
-int isNeighborNotDrawn(pixel_t **img, int x, int y, int w, int h)
+static inline uint8_t quantize(int source, int err)
 {
-	if (0 <= x && x < w)
+	int level = (127 + ((source + err) * 5)) / 255;
+	return CLAMP(level, 0, 5);
+}
+
+/**
+ * @brief Add a share of a pixel's error to a neighbor, if it isn't drawn yet
+ *
+ * @param p The neighbor
+ * @param teR The red error
+ * @param teG The green error
+ * @param teB The blue error
+ * @param scale The share, as a fraction of 65536
+ */
+static inline void spreadError(ditherPx_t * p, int teR, int teG, int teB, int32_t scale)
+{
+	if (!p->isDrawn)
 	{
-		if (0 <= y && y < h)
+		p->eR += (teR * scale + 32768) >> 16;
+		p->eG += (teG * scale + 32768) >> 16;
+		p->eB += (teB * scale + 32768) >> 16;
+	}
+}
+
+/**
+ * @brief Dither one tile. Pixels are visited in a fixed shuffled order, and
+ * each pixel's error is spread to its neighbors which haven't been drawn yet,
+ * twice as much to the adjacent pixels as the diagonal ones. Error may spread
+ * one pixel into neighboring tiles
+ *
+ * @param job The image being dithered
+ * @param tile The tile's index, row major
+ */
+static void ditherTile(const ditherJob_t * job, uint32_t tile)
+{
+	const int w = job->w;
+	const int stride = w + 2;
+	const int x0 = (tile % job->tilesX) * DITHER_TILE;
+	const int y0 = (tile / job->tilesX) * DITHER_TILE;
+	const int tw = (w - x0) < DITHER_TILE ? (w - x0) : DITHER_TILE;
+	const int th = (job->h - y0) < DITHER_TILE ? (job->h - y0) : DITHER_TILE;
+
+	/* Every tile uses the same order, started at a different point */
+	const uint32_t rot = (tile * 1237) % (DITHER_TILE * DITHER_TILE);
+	for (uint32_t i = 0; i < DITHER_TILE * DITHER_TILE; i++)
+	{
+		uint32_t o = job->order[(i + rot) % (DITHER_TILE * DITHER_TILE)];
+		int tx = o % DITHER_TILE;
+		int ty = o / DITHER_TILE;
+		if (tx >= tw || ty >= th)
 		{
-			return !(img[y][x].isDrawn) ? 1 : 0;
+			continue;
+		}
+		int x = x0 + tx;
+		int y = y0 + ty;
+
+		const uint8_t * src = &job->rgba[((y * w) + x) * 4];
+		ditherPx_t * p = &job->px[((y + 1) * stride) + x + 1];
+
+		/* Find the bit-reduced value, use rounding */
+		uint8_t r = quantize(src[0], p->eR);
+		uint8_t g = quantize(src[1], p->eG);
+		uint8_t b = quantize(src[2], p->eB);
+		if (src[3])
+		{
+			/* Index math! The palette indices increase blue, then green, then red.
+			 * Each has a value 0-5 (six levels)
+			 */
+			job->paletteBuf[(y * w) + x] = b + (6 * g) + (36 * r);
 		}
+		else
+		{
+			/* This invalid value means 'transparent' */
+			job->paletteBuf[(y * w) + x] = 6 * 6 * 6;
+		}
+		p->isDrawn = true;
+
+		/* Find the total error, 8 bits per channel */
+		int teR = src[0] - ((r * 255) / 5);
+		int teG = src[1] - ((g * 255) / 5);
+		int teB = src[2] - ((b * 255) / 5);
+
+		/* Count all the neighbors that haven't been drawn yet */
+		int adjNeighbors = !p[stride].isDrawn + !p[-stride].isDrawn + !p[1].isDrawn + !p[-1].isDrawn;
+		int diagNeighbors = !p[-stride - 1].isDrawn + !p[-stride + 1].isDrawn +
+							!p[stride - 1].isDrawn + !p[stride + 1].isDrawn;
+		int shares = (2 * adjNeighbors) + diagNeighbors;
+		if (0 == shares)
+		{
+			continue;
+		}
+
+		/* Spread the error to all neighboring unquantized pixels */
+		int32_t diagScale = shareRecip[shares];
+		int32_t adjScale = 2 * diagScale;
+		spreadError(&p[-stride - 1], teR, teG, teB, diagScale);
+		spreadError(&p[-stride + 1], teR, teG, teB, diagScale);
+		spreadError(&p[stride - 1], teR, teG, teB, diagScale);
+		spreadError(&p[stride + 1], teR, teG, teB, diagScale);
+		spreadError(&p[-1], teR, teG, teB, adjScale);
+		spreadError(&p[1], teR, teG, teB, adjScale);
+		spreadError(&p[-stride], teR, teG, teB, adjScale);
+		spreadError(&p[stride], teR, teG, teB, adjScale);
 	}
-	return 0;
 }
 
 /**
- * @brief TODO
+ * @brief Dither tiles until there are none left in this phase
  *
- * @param image8b
- * @param x
- * @param y
- * @param w
- * @param h
- * @param teR
- * @param teG
- * @param teB
- * @param diagScalar
+ * @param arg The ditherJob_t
+ * @return NULL
  */
-void spreadError(pixel_t **img, int x, int y, int w, int h,
-				 int teR, int teG, int teB, float diagScalar)
+static void * ditherWorker(void * arg)
 {
-	if (0 <= x && x < w)
+	ditherJob_t * job = (ditherJob_t *)arg;
+	uint32_t i;
+	while ((i = __atomic_fetch_add(&job->nextTile, 1, __ATOMIC_RELAXED)) < job->numTiles)
 	{
-		if (0 <= y && y < h)
+		ditherTile(job, job->tiles[i]);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Dither an image to the web-safe palette.
+ *
+ * The image is split into tiles which are dithered in four phases, so that no
+ * two tiles in a phase touch. Tiles in a phase can be dithered in any order, on
+ * any number of threads, and the output is always the same
+ *
+ * @param rgba The image, 4 bytes per pixel
+ * @param w The image's width
+ * @param h The image's height
+ * @param paletteBuf Where to write w * h palette indices
+ */
+static void ditherImage(const uint8_t * rgba, int w, int h, uint8_t * paletteBuf)
+{
+	ditherJob_t job = {
+		.rgba = rgba,
+		.paletteBuf = paletteBuf,
+		.w = w,
+		.h = h,
+		.tilesX = (w + DITHER_TILE - 1) / DITHER_TILE,
+	};
+	uint32_t tilesY = (h + DITHER_TILE - 1) / DITHER_TILE;
+
+	/* Mark the border drawn */
+	job.px = calloc((w + 2) * (h + 2), sizeof(ditherPx_t));
+	for (int x = 0; x < w + 2; x++)
+	{
+		job.px[x].isDrawn = true;
+		job.px[((h + 1) * (w + 2)) + x].isDrawn = true;
+	}
+	for (int y = 0; y < h + 2; y++)
+	{
+		job.px[y * (w + 2)].isDrawn = true;
+		job.px[(y * (w + 2)) + w + 1].isDrawn = true;
+	}
+
+	for (uint32_t i = 0; i < DITHER_TILE * DITHER_TILE; i++)
+	{
+		job.order[i] = i;
+	}
+	shuffleArray(job.order, DITHER_TILE * DITHER_TILE);
+
+	int numThreads = ((w * h) < DITHER_PARALLEL_MIN) ? 1 : ditherThreads;
+	job.tiles = malloc(job.tilesX * tilesY * sizeof(uint32_t));
+	for (uint32_t phase = 0; phase < 4; phase++)
+	{
+		job.numTiles = 0;
+		job.nextTile = 0;
+		for (uint32_t ty = (phase >> 1); ty < tilesY; ty += 2)
 		{
-			if (!img[y][x].isDrawn)
+			for (uint32_t tx = (phase & 1); tx < job.tilesX; tx += 2)
 			{
-				img[y][x].eR = (int)(teR * diagScalar + 0.5);
-				img[y][x].eG = (int)(teG * diagScalar + 0.5);
-				img[y][x].eB = (int)(teB * diagScalar + 0.5);
+				job.tiles[job.numTiles++] = (ty * job.tilesX) + tx;
 			}
 		}
+
+		pthread_t threads[DITHER_MAX_THREADS];
+		int started = 0;
+		for (int t = 1; t < numThreads && (uint32_t)t < job.numTiles; t++)
+		{
+			if (0 == pthread_create(&threads[started], NULL, ditherWorker, &job))
+			{
+				started++;
+			}
+		}
+		ditherWorker(&job);
+		for (int t = 0; t < started; t++)
+		{
+			pthread_join(threads[t], NULL);
+		}
 	}
+
+	free(job.tiles);
+	free(job.px);
 }
 
 /**
- * @brief TODO
+ * @brief Poll all available output from a heatshrink encoder
  *
- * @param infile
- * @param outdir
+ * @param hse The encoder
+ * @param out The output buffer
+ * @param outCap The size of the output buffer
+ * @param outIdx The number of bytes in the output buffer, updated
+ * @return true if everything was polled, false if it didn't fit or failed
  */
-void process_image(const char *infile, const char *outdir)
+static bool pollEncoder(heatshrink_encoder * hse, uint8_t * out, uint32_t outCap, uint32_t * outIdx)
 {
-	/* Determine if the output file already exists */
-	char outFilePath[128] = {0};
-	strcat(outFilePath, outdir);
-	strcat(outFilePath, "/");
-	strcat(outFilePath, get_filename(infile));
+	while (true)
+	{
+		size_t copied = 0;
+		HSE_poll_res res = heatshrink_encoder_poll(hse, &out[*outIdx], outCap - *outIdx, &copied);
+		*outIdx += copied;
+		if (HSER_POLL_EMPTY == res)
+		{
+			return true;
+		}
+		else if (HSER_POLL_MORE != res || *outIdx == outCap)
+		{
+			return false;
+		}
+	}
+}
 
-	/* Change the file extension */
-	char * dotptr = strrchr(outFilePath, '.');
-	dotptr[1] = 'w';
-	dotptr[2] = 's';
-	dotptr[3] = 'g';
+/**
+ * @brief Compress with heatshrink
+ *
+ * @param in The data to compress
+ * @param inLen The length of the data
+ * @param window The window size, log2
+ * @param lookahead The lookahead size, log2
+ * @param out Where to write the compressed data
+ * @param outCap The size of the output buffer
+ * @return The compressed size, or 0 if it didn't fit or failed
+ */
+uint32_t heatshrinkEncode(const uint8_t * in, uint32_t inLen, uint8_t window, uint8_t lookahead,
+						  uint8_t * out, uint32_t outCap)
+{
+	heatshrink_encoder * hse = heatshrink_encoder_alloc(window, lookahead);
+	if (NULL == hse)
+	{
+		return 0;
+	}
+
+	uint32_t inIdx = 0;
+	uint32_t outIdx = 0;
+	bool ok = true;
+	while (ok && inIdx < inLen)
+	{
+		size_t copied = 0;
+		ok = (HSER_SINK_OK == heatshrink_encoder_sink(hse, (uint8_t *)&in[inIdx], inLen - inIdx, &copied)) &&
+			 pollEncoder(hse, out, outCap, &outIdx);
+		inIdx += copied;
+	}
+	while (ok)
+	{
+		HSE_finish_res res = heatshrink_encoder_finish(hse);
+		if (HSER_FINISH_DONE == res)
+		{
+			break;
+		}
+		ok = (HSER_FINISH_MORE == res) && pollEncoder(hse, out, outCap, &outIdx);
+	}
 
-	if(doesFileExist(outFilePath))
+	heatshrink_encoder_free(hse);
+	return ok ? outIdx : 0;
+}
+
+/**
+ * @brief Decompress heatshrink, the same way loadWsg() does
+ *
+ * @param in The compressed data
+ * @param inLen The length of the compressed data
+ * @param window The window size, log2
+ * @param lookahead The lookahead size, log2
+ * @param out Where to write the decompressed data
+ * @param outLen How many bytes it should decompress to
+ * @return true if it decompressed to exactly outLen bytes, false otherwise
+ */
+static bool heatshrinkDecode(const uint8_t * in, uint32_t inLen, uint8_t window, uint8_t lookahead,
+							 uint8_t * out, uint32_t outLen)
+{
+	heatshrink_decoder * hsd = heatshrink_decoder_alloc(256, window, lookahead);
+	if (NULL == hsd)
 	{
-		printf("Output for %s already exists\n", infile);
-		return;
+		return false;
 	}
 
-	/* Load the source PNG */
-	int w,h,n;
-	unsigned char *data = stbi_load(infile, &w, &h, &n, 4);
+	uint32_t inIdx = 0;
+	uint32_t outIdx = 0;
+	bool ok = true;
+	while (ok && inIdx < inLen)
+	{
+		size_t copied = 0;
+		ok = (0 <= heatshrink_decoder_sink(hsd, &in[inIdx], inLen - inIdx, &copied));
+		inIdx += copied;
+
+		HSD_poll_res res;
+		do
+		{
+			copied = 0;
+			res = heatshrink_decoder_poll(hsd, &out[outIdx], outLen - outIdx, &copied);
+			outIdx += copied;
+		} while (ok && HSDR_POLL_MORE == res && outIdx < outLen);
+		ok = ok && (0 <= res) && !(HSDR_POLL_MORE == res && outIdx == outLen && inIdx < inLen);
+	}
+	ok = ok && (HSDR_FINISH_DONE == heatshrink_decoder_finish(hsd));
 
-	if (NULL != data)
+	heatshrink_decoder_free(hsd);
+	return ok && (outIdx == outLen);
+}
+
+/**
+ * @brief Compress with run length encoding. Each packet starts with a control
+ * byte. 0x00-0x7F are followed by 1-128 literal bytes, and 0x80-0xFF are
+ * followed by one byte which repeats 2-129 times
+ *
+ * @param in The data to compress
+ * @param len The length of the data
+ * @param out Where to write the compressed data, at least len + len / 2 + 2 bytes
+ * @return The compressed size
+ */
+uint32_t rleEncode(const uint8_t * in, uint32_t len, uint8_t * out)
+{
+	uint32_t i = 0;
+	uint32_t o = 0;
+	while (i < len)
 	{
-		/* Create an array for output */
-		pixel_t **image8b;
-		image8b = (pixel_t **)calloc(h, sizeof(pixel_t *));
-		for (int y = 0; y < h; y++)
+		uint32_t run = 1;
+		while (i + run < len && run < 129 && in[i + run] == in[i])
 		{
-			image8b[y] = (pixel_t *)calloc(w, sizeof(pixel_t));
+			run++;
 		}
 
-		/* Create an array of pixel indicies, then shuffle it */
-		uint32_t * indices = (uint32_t*)malloc(sizeof(uint32_t) * w * h); //[w * h];
-		for (int i = 0; i < w * h; i++)
+		if (run >= 2)
 		{
-			indices[i] = i;
+			out[o++] = 0x80 | (run - 2);
+			out[o++] = in[i];
+			i += run;
 		}
-		shuffleArray(indices, w * h);
-
-		/* For all pixels */
-		for (int i = 0; i < w * h; i++)
+		else
 		{
-			/* Get the x, y coordinates for the random pixel */
-			int x = indices[i] % w;
-			int y = indices[i] / w;
-
-			/* Get the source pixel, 8 bits per channel */
-			unsigned char sourceR = data[(y * (w * 4)) + (x * 4) + 0];
-			unsigned char sourceG = data[(y * (w * 4)) + (x * 4) + 1];
-			unsigned char sourceB = data[(y * (w * 4)) + (x * 4) + 2];
-			unsigned char sourceA = data[(y * (w * 4)) + (x * 4) + 3];
-
-			/* Find the bit-reduced value, use rounding, 5551 for RGBA */
-			image8b[y][x].r = CLAMP((127 + ((sourceR + image8b[y][x].eR) * 5)) / 255, 0, 5);
-			image8b[y][x].g = CLAMP((127 + ((sourceG + image8b[y][x].eG) * 5)) / 255, 0, 5);
-			image8b[y][x].b = CLAMP((127 + ((sourceB + image8b[y][x].eB) * 5)) / 255, 0, 5);
-			image8b[y][x].a = sourceA ? 0xFF : 0x00;
-
-			/* Find the total error, 8 bits per channel */
-			int teR = sourceR - ((image8b[y][x].r * 255) / 5);
-			int teG = sourceG - ((image8b[y][x].g * 255) / 5);
-			int teB = sourceB - ((image8b[y][x].b * 255) / 5);
-
-			/* Count all the neighbors that haven't been drawn yet */
-			int adjNeighbors = 0;
-			adjNeighbors += isNeighborNotDrawn(image8b, x + 0, y + 1, w, h);
-			adjNeighbors += isNeighborNotDrawn(image8b, x + 0, y - 1, w, h);
-			adjNeighbors += isNeighborNotDrawn(image8b, x + 1, y + 0, w, h);
-			adjNeighbors += isNeighborNotDrawn(image8b, x - 1, y + 0, w, h);
-			int diagNeighbors = 0;
-			diagNeighbors += isNeighborNotDrawn(image8b, x - 1, y - 1, w, h);
-			diagNeighbors += isNeighborNotDrawn(image8b, x + 1, y - 1, w, h);
-			diagNeighbors += isNeighborNotDrawn(image8b, x - 1, y + 1, w, h);
-			diagNeighbors += isNeighborNotDrawn(image8b, x + 1, y + 1, w, h);
-
-			/* Spread the error to all neighboring unquantized pixels, with
-			 * twice as much error to the adjacent pixels as the diagonal ones
-			 */
-			float diagScalar = 1 / (float)((2 * adjNeighbors) + diagNeighbors);
-			float adjScalar = 2 * diagScalar;
-
-			/* Write the error */
-			spreadError(image8b, x - 1, y - 1, w, h, teR, teG, teB, diagScalar);
-			spreadError(image8b, x - 1, y + 1, w, h, teR, teG, teB, diagScalar);
-			spreadError(image8b, x + 1, y - 1, w, h, teR, teG, teB, diagScalar);
-			spreadError(image8b, x + 1, y + 1, w, h, teR, teG, teB, diagScalar);
-			spreadError(image8b, x - 1, y + 0, w, h, teR, teG, teB, adjScalar);
-			spreadError(image8b, x + 1, y + 0, w, h, teR, teG, teB, adjScalar);
-			spreadError(image8b, x + 0, y - 1, w, h, teR, teG, teB, adjScalar);
-			spreadError(image8b, x + 0, y + 1, w, h, teR, teG, teB, adjScalar);
-
-			/* Mark the random pixel as drawn */
-			image8b[y][x].isDrawn = true;
+			/* Collect literals until a run starts */
+			uint32_t start = i;
+			uint32_t n = 0;
+			do
+			{
+				i++;
+				n++;
+			} while (i < len && n < 128 && !(i + 1 < len && in[i + 1] == in[i]));
+			out[o++] = n - 1;
+			memcpy(&out[o], &in[start], n);
+			o += n;
 		}
+	}
+	return o;
+}
 
-		free(indices);
-
-		/* Free stbi memory */
-		stbi_image_free(data);
-
-// #define WRITE_DITHERED_PNG
-#ifdef WRITE_DITHERED_PNG
-		/* Convert to a pixel buffer */
-		unsigned char* pixBuf = (unsigned char*)malloc(sizeof(unsigned char) * w * h * 4);//[w*h*4];
-		int pixBufIdx = 0;
-		for (int y = 0; y < h; y++)
+/**
+ * @brief Decompress run length encoding, the same way loadWsg() does
+ *
+ * @param in The compressed data
+ * @param inLen The length of the compressed data
+ * @param out Where to write the decompressed data
+ * @param outLen How many bytes it should decompress to
+ * @return true if it decompressed to exactly outLen bytes, false otherwise
+ */
+static bool rleDecode(const uint8_t * in, uint32_t inLen, uint8_t * out, uint32_t outLen)
+{
+	uint32_t i = 0;
+	uint32_t o = 0;
+	while (i < inLen)
+	{
+		uint8_t c = in[i++];
+		if (c & 0x80)
 		{
-			for (int x = 0; x < w; x++)
+			uint32_t n = (c & 0x7F) + 2;
+			if (i >= inLen || n > outLen - o)
 			{
-				pixBuf[pixBufIdx++] = (image8b[y][x].r * 255) / 5;
-				pixBuf[pixBufIdx++] = (image8b[y][x].g * 255) / 5;
-				pixBuf[pixBufIdx++] = (image8b[y][x].b * 255) / 5;
-				pixBuf[pixBufIdx++] = image8b[y][x].a;
+				return false;
 			}
+			memset(&out[o], in[i++], n);
+			o += n;
 		}
-		/* Write a PNG */
-		char pngOutFilePath[strlen(outFilePath) + 4];
-		strcpy(pngOutFilePath, outFilePath);
-		strcat(pngOutFilePath, ".png");
-		stbi_write_png(pngOutFilePath, w, h, 4, pixBuf, 4 * w);
-		free(pixBuf);
-#endif
+		else
+		{
+			uint32_t n = c + 1;
+			if (n > inLen - i || n > outLen - o)
+			{
+				return false;
+			}
+			memcpy(&out[o], &in[i], n);
+			i += n;
+			o += n;
+		}
+	}
+	return o == outLen;
+}
 
-		/* Convert to a palette buffer */
-		uint32_t paletteBufSize = sizeof(unsigned char) * w * h;
-		unsigned char * paletteBuf = malloc(paletteBufSize);
-		int paletteBufIdx = 0;
-		for (int y = 0; y < h; y++)
+/**
+ * @brief Compress an image's pixels with every codec and set of parameters
+ *
+ * @param px The pixels to compress
+ * @param len The number of pixels
+ * @param cands Where to write the candidates, WSG_MAX_CANDIDATES long. The
+ *              caller must free each candidate's data
+ * @return The number of candidates written
+ */
+static uint32_t compressImage(const uint8_t * px, uint32_t len, wsgCandidate_t * cands)
+{
+	uint32_t numCands = 0;
+
+	/* Raw, which is the fastest to load */
+	cands[numCands].codec = WSG_CODEC_RAW;
+	cands[numCands].window = 0;
+	cands[numCands].lookahead = 0;
+	cands[numCands].data = malloc(len);
+	memcpy(cands[numCands].data, px, len);
+	cands[numCands].size = len;
+	numCands++;
+
+	/* RLE, for flat images */
+	cands[numCands].codec = WSG_CODEC_RLE;
+	cands[numCands].window = 0;
+	cands[numCands].lookahead = 0;
+	cands[numCands].data = malloc(len + (len / 2) + 2);
+	cands[numCands].size = rleEncode(px, len, cands[numCands].data);
+	numCands++;
+
+	/* Heatshrink, smallest window first */
+	uint32_t outCap = len + (len / 8) + 64;
+	for (uint8_t window = WSG_MIN_WINDOW; window <= WSG_MAX_WINDOW; window++)
+	{
+		for (uint8_t lookahead = WSG_MIN_LOOKAHEAD; lookahead < window && lookahead <= WSG_MAX_LOOKAHEAD; lookahead++)
 		{
-			for (int x = 0; x < w; x++)
+			uint8_t * out = malloc(outCap);
+			uint32_t size = heatshrinkEncode(px, len, window, lookahead, out, outCap);
+			if (0 == size)
 			{
-				if(image8b[y][x].a)
-				{
-					/* Index math! The palette indices increase blue, then green, then red.
-					 * Each has a value 0-5 (six levels)
-					 */
-					paletteBuf[paletteBufIdx++] = (image8b[y][x].b) + (6 * (image8b[y][x].g)) + (36 * (image8b[y][x].r));
-				}
-				else
-				{
-					/* This invalid value means 'transparent' */
-					paletteBuf[paletteBufIdx++] = 6 * 6 * 6;
-				}
+				free(out);
+				continue;
 			}
+			cands[numCands].codec = WSG_CODEC_HEATSHRINK;
+			cands[numCands].window = window;
+			cands[numCands].lookahead = lookahead;
+			cands[numCands].data = out;
+			cands[numCands].size = size;
+			numCands++;
 		}
+	}
+	return numCands;
+}
 
-		/* Free dithering memory */
-		for (int y = 0; y < h; y++)
+/**
+ * @brief Pick which candidate to write. The smallest wins, unless a candidate
+ * earlier in the list, which is cheaper to decode, is within 1/32 of it
+ *
+ * @param cands The candidates
+ * @param numCands The number of candidates
+ * @return The index of the chosen candidate
+ */
+static uint32_t chooseCandidate(const wsgCandidate_t * cands, uint32_t numCands)
+{
+	uint32_t smallest = 0;
+	for (uint32_t i = 1; i < numCands; i++)
+	{
+		if (cands[i].size < cands[smallest].size)
 		{
-			free(image8b[y]);
+			smallest = i;
 		}
-		free(image8b);
+	}
+	for (uint32_t i = 0; i < smallest; i++)
+	{
+		if (cands[i].size <= cands[smallest].size + (cands[smallest].size / 32))
+		{
+			return i;
+		}
+	}
+	return smallest;
+}
 
-		/* Compress the palette-ized image */
-		uint32_t outputSize = sizeof(uint8_t) * (4 + paletteBufSize);
-		uint8_t * output = malloc(outputSize);
-		uint32_t outputIdx = 0;
-		uint32_t inputIdx = 0;
-		size_t copied = 0;
+/**
+ * @brief Decode a candidate
+ *
+ * @param cand The candidate
+ * @param out Where to write the pixels
+ * @param outLen The number of pixels
+ * @return true if it decoded to exactly outLen pixels, false otherwise
+ */
+static bool decodeCandidate(const wsgCandidate_t * cand, uint8_t * out, uint32_t outLen)
+{
+	switch (cand->codec)
+	{
+		case WSG_CODEC_RAW:
+		{
+			if (cand->size != outLen)
+			{
+				return false;
+			}
+			memcpy(out, cand->data, outLen);
+			return true;
+		}
+		case WSG_CODEC_RLE:
+		{
+			return rleDecode(cand->data, cand->size, out, outLen);
+		}
+		case WSG_CODEC_HEATSHRINK:
+		{
+			return heatshrinkDecode(cand->data, cand->size, cand->window, cand->lookahead, out, outLen);
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+
+/**
+ * @brief Measure how long a candidate takes to decode on this machine
+ *
+ * @param cand The candidate
+ * @param out Scratch space for the pixels
+ * @param outLen The number of pixels
+ * @return The time for one decode, in microseconds
+ */
+static double timeDecode(const wsgCandidate_t * cand, uint8_t * out, uint32_t outLen)
+{
+	struct timespec t0, t1;
+	uint32_t reps = 0;
+	double elapsedUs = 0;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	while (reps < 3 || elapsedUs < 100)
+	{
+		decodeCandidate(cand, out, outLen);
+		reps++;
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		elapsedUs = ((t1.tv_sec - t0.tv_sec) * 1e6) + ((t1.tv_nsec - t0.tv_nsec) / 1e3);
+	}
+	return elapsedUs / reps;
+}
+
+/**
+ * @brief Load a PNG and dither it to the palette
+ *
+ * @param infile The PNG to load
+ * @param w Where to write the image's width
+ * @param h Where to write the image's height
+ * @return w * h palette indices, which must be freed, or NULL if the PNG
+ *         couldn't be loaded
+ */
+uint8_t * loadPaletteImage(const char * infile, int * w, int * h)
+{
+	/* Load the source PNG */
+	int n;
+	unsigned char *data = stbi_load(infile, w, h, &n, 4);
+
+	if (NULL == data)
+	{
+		fprintf(stderr, "Couldn't load %s (%s)\n", infile, stbi_failure_reason());
+		return NULL;
+	}
+
+	/* Dither to the palette */
+	uint8_t * paletteBuf = malloc((*w) * (*h));
+	ditherImage(data, *w, *h, paletteBuf);
+
+	/* Free stbi memory */
+	stbi_image_free(data);
+	return paletteBuf;
+}
 
-		/* Creete the encoder */
-		heatshrink_encoder *hse = heatshrink_encoder_alloc(8, 4);
-		heatshrink_encoder_reset(hse);
-		/* Encode the dimension header */
-		uint8_t imgDimHdr[] =
+/**
+ * @brief Compress palette indices whichever way is smallest and write them as
+ * a WSG, with the extended header
+ *
+ * @param fp The file to write to
+ * @param name What to call the image if it fails
+ * @param px The palette indices
+ * @param w The image's width
+ * @param h The image's height
+ * @param report Where to write which codec was chosen, and what that saved
+ * @param reportLen The size of report
+ * @return The number of bytes written, or -1 if it wasn't written
+ */
+long writeWsg(FILE * fp, const char * name, const uint8_t * px, int w, int h, char * report, size_t reportLen)
+{
+	uint32_t numPx = w * h;
+
+	/* Try every codec, and keep the one which makes the smallest file */
+	wsgCandidate_t cands[WSG_MAX_CANDIDATES];
+	uint32_t numCands = compressImage(px, numPx, cands);
+	uint32_t chosen = chooseCandidate(cands, numCands);
+
+	/* Make sure it decodes, and find out how long that takes */
+	uint32_t dflt = 0;
+	for (uint32_t i = 0; i < numCands; i++)
+	{
+		if (WSG_CODEC_HEATSHRINK == cands[i].codec && 8 == cands[i].window && 4 == cands[i].lookahead)
 		{
+			dflt = i;
+		}
+	}
+	uint8_t * check = malloc(numPx);
+	bool ok = decodeCandidate(&cands[chosen], check, numPx) && (0 == memcmp(check, px, numPx));
+	double dfltUs = ok ? timeDecode(&cands[dflt], check, numPx) : 0;
+	double chosenUs = (ok && chosen != dflt) ? timeDecode(&cands[chosen], check, numPx) : dfltUs;
+	free(check);
+
+	long written = -1;
+	if (!ok)
+	{
+		fprintf(stderr, "%s didn't decode to what was encoded\n", name);
+	}
+	else
+	{
+		/* Write the extended header, then the payload */
+		uint8_t hdr[] =
+		{
+			0,
+			0,
+			cands[chosen].codec,
+			(cands[chosen].window << 4) | cands[chosen].lookahead,
 			HI_BYTE(w),
 			LO_BYTE(w),
 			HI_BYTE(h),
-			LO_BYTE(h)
+			LO_BYTE(h),
 		};
-		switch(heatshrink_encoder_sink(hse, imgDimHdr, sizeof(imgDimHdr), &copied))
+		if (1 == fwrite(hdr, sizeof(hdr), 1, fp) && 1 == fwrite(cands[chosen].data, cands[chosen].size, 1, fp))
 		{
-			case HSER_SINK_OK:
-			{
-				// Continue
-				break;
-			}
-			case HSER_SINK_ERROR_NULL:
-			case HSER_SINK_ERROR_MISUSE:
-			{
-				free(output);
-				free(paletteBuf);
-				heatshrink_encoder_free(hse);
-				fprintf(stderr, "[%d]: Heatshrink error (%s) \n", __LINE__, infile);
-				return;
-			}
+			written = sizeof(hdr) + cands[chosen].size;
 		}
 
-		/* Stream the data in chunks */
-		while(inputIdx < paletteBufSize)
+		char codecName[32];
+		if (WSG_CODEC_HEATSHRINK == cands[chosen].codec)
 		{
-			/* Pass pixels to the encoder for compression */
-			copied = 0;
-			switch(heatshrink_encoder_sink(hse, &paletteBuf[inputIdx], paletteBufSize - inputIdx, &copied))
-			{
-				case HSER_SINK_OK:
-				{
-					// Continue
-					break;
-				}
-				case HSER_SINK_ERROR_NULL:
-				case HSER_SINK_ERROR_MISUSE:
-				{
-					free(output);
-					free(paletteBuf);
-					heatshrink_encoder_free(hse);
-					fprintf(stderr, "[%d]: Heatshrink error (%s) \n", __LINE__, infile);
-					return;
-				}
-			}
-			inputIdx += copied;
-
-			/* Save compressed data */
-			copied = 0;
-			bool stillEncoding = true;
-			while(stillEncoding)
-			{
-				switch(heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied))
-				{
-					case HSER_POLL_EMPTY:
-					{
-						stillEncoding = false;
-						break;
-					}
-					case HSER_POLL_MORE:
-					{
-						stillEncoding = true;
-						break;
-					}
-					case HSER_POLL_ERROR_NULL:
-					case HSER_POLL_ERROR_MISUSE:
-					{
-						free(output);
-						free(paletteBuf);
-						heatshrink_encoder_free(hse);
-						fprintf(stderr, "[%d]: Heatshrink error (%s) \n", __LINE__, infile);
-						return;
-					}
-				}
-				outputIdx += copied;
-			}
+			snprintf(codecName, sizeof(codecName), "heatshrink %d/%d", cands[chosen].window, cands[chosen].lookahead);
 		}
-
-		/* Mark all input as processed */
-		switch(heatshrink_encoder_finish(hse))
+		else
 		{
-			case HSER_FINISH_DONE:
-			{
-				// Continue
-				break;
-			}
-			case HSER_FINISH_MORE:
-			{
-				/* Flush the last bits of output */
-				copied = 0;
-				bool stillEncoding = true;
-				while(stillEncoding)
-				{
-					switch(heatshrink_encoder_poll(hse, &output[outputIdx], outputSize - outputIdx, &copied))
-					{
-						case HSER_POLL_EMPTY:
-						{
-							stillEncoding = false;
-							break;
-						}
-						case HSER_POLL_MORE:
-						{
-							stillEncoding = true;
-							break;
-						}
-						case HSER_POLL_ERROR_NULL:
-						case HSER_POLL_ERROR_MISUSE:
-						{
-							free(output);
-							free(paletteBuf);
-							heatshrink_encoder_free(hse);
-							fprintf(stderr, "[%d]: Heatshrink error (%s) \n", __LINE__, infile);
-							return;
-						}	
-					}
-					outputIdx += copied;
-				}
-				break;
-			}
-			case HSER_FINISH_ERROR_NULL:
-			{
-				free(output);
-				free(paletteBuf);
-				heatshrink_encoder_free(hse);
-				fprintf(stderr, "[%d]: Heatshrink error (%s) \n", __LINE__, infile);
-				return;
-			}
+			snprintf(codecName, sizeof(codecName), "%s", (WSG_CODEC_RLE == cands[chosen].codec) ? "rle" : "raw");
+		}
+		if (chosen == dflt)
+		{
+			snprintf(report, reportLen, "%s baseline kept, decodes in %.1f us", codecName, dfltUs);
 		}
+		else
+		{
+			snprintf(report, reportLen, "%s saves %ld bytes over heatshrink 8/4, decodes in %.1f us vs %.1f us",
+					 codecName, (long)cands[dflt].size - (long)cands[chosen].size, chosenUs, dfltUs);
+		}
+	}
 
-		/* Free the encoder */
-		heatshrink_encoder_free(hse);
+	for (uint32_t i = 0; i < numCands; i++)
+	{
+		free(cands[i].data);
+	}
+	return written;
+}
 
-		/* Free data after compressed */
+/**
+ * @brief Convert a PNG into a WSG, dithered to the palette and compressed
+ *
+ * @param infile The PNG to convert
+ * @param outdir The directory to write the WSG to
+ * @return true if the WSG was written, false if it wasn't
+ */
+bool process_image(const char *infile, const char *outdir)
+{
+	/* Determine the output file name */
+	char outFilePath[128] = {0};
+	strcat(outFilePath, outdir);
+	strcat(outFilePath, "/");
+	strcat(outFilePath, get_filename(infile));
+
+	/* Change the file extension */
+	char * dotptr = strrchr(outFilePath, '.');
+	dotptr[1] = 'w';
+	dotptr[2] = 's';
+	dotptr[3] = 'g';
+
+	int w,h;
+	uint8_t * paletteBuf = loadPaletteImage(infile, &w, &h);
+	if (NULL == paletteBuf)
+	{
+		return false;
+	}
+
+// #define WRITE_DITHERED_PNG
+#ifdef WRITE_DITHERED_PNG
+	/* Convert to a pixel buffer */
+	unsigned char* pixBuf = (unsigned char*)malloc(sizeof(unsigned char) * w * h * 4);//[w*h*4];
+	for (int i = 0; i < w * h; i++)
+	{
+		uint8_t idx = paletteBuf[i];
+		pixBuf[(i * 4) + 0] = (idx < 216) ? (((idx / 36) * 255) / 5) : 0;
+		pixBuf[(i * 4) + 1] = (idx < 216) ? ((((idx / 6) % 6) * 255) / 5) : 0;
+		pixBuf[(i * 4) + 2] = (idx < 216) ? (((idx % 6) * 255) / 5) : 0;
+		pixBuf[(i * 4) + 3] = (idx < 216) ? 0xFF : 0x00;
+	}
+	/* Write a PNG */
+	char pngOutFilePath[strlen(outFilePath) + 4];
+	strcpy(pngOutFilePath, outFilePath);
+	strcat(pngOutFilePath, ".png");
+	stbi_write_png(pngOutFilePath, w, h, 4, pixBuf, 4 * w);
+	free(pixBuf);
+#endif
+
+	FILE * wsgFile = fopen(outFilePath, "wb");
+	if (NULL == wsgFile)
+	{
+		fprintf(stderr, "Couldn't open %s\n", outFilePath);
 		free(paletteBuf);
+		return false;
+	}
+	char report[128];
+	long written = writeWsg(wsgFile, infile, paletteBuf, w, h, report, sizeof(report));
+	bool ok = (0 == fclose(wsgFile)) && (0 <= written);
+	free(paletteBuf);
 
-		/* Write a WSG image */
-		FILE * wsgFile = fopen(outFilePath, "wb");
-		/* First two bytes are decompresed size */
-		uint16_t decompressedSize = sizeof(imgDimHdr) + paletteBufSize;
-		putc(HI_BYTE(decompressedSize), wsgFile);
-		putc(LO_BYTE(decompressedSize), wsgFile);
-		/* Then dump the compressed bytes */
-		fwrite(output, outputIdx, 1, wsgFile);
-		/* Done writing to the file */
-		fclose(wsgFile);
-
-		/* Free the output */
-		free(output);
-
-		/* Print results */
-		printf("%s:\n  Source file size: %ld\n  WSG   file size: %ld\n",
+	/* Print results */
+	if (ok)
+	{
+		printf("%s:\n  Source file size: %ld\n  WSG   file size: %ld\n  %s\n",
 			   infile,
 			   getFileSize(infile),
-			   getFileSize(outFilePath));
+			   written,
+			   report);
 	}
+	return ok;
 }
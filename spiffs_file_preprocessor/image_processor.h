@@ -1,6 +1,33 @@
 #ifndef _IMAGE_PROCESSOR_H_
 #define _IMAGE_PROCESSOR_H_
 
-void process_image(const char * infile, const char * outdir);
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every image
+#define IMAGE_PROCESSOR_VERSION 4
+
+/*
+ * WSG files start with an eight byte header. The first two bytes are zero,
+ * which older WSGs never start with, then the codec, then the heatshrink
+ * window (high nibble) and lookahead (low nibble), then the width and height,
+ * big endian. The pixels follow, compressed with the codec.
+ *
+ * These must match display.h
+ */
+#define WSG_HEADER_SIZE      8
+#define WSG_CODEC_RAW        0
+#define WSG_CODEC_RLE        1
+#define WSG_CODEC_HEATSHRINK 2
+
+void setImageProcessorThreads(int numThreads);
+uint32_t heatshrinkEncode(const uint8_t * in, uint32_t inLen, uint8_t window, uint8_t lookahead,
+						  uint8_t * out, uint32_t outCap);
+uint32_t rleEncode(const uint8_t * in, uint32_t len, uint8_t * out);
+uint8_t * loadPaletteImage(const char * infile, int * w, int * h);
+long writeWsg(FILE * fp, const char * name, const uint8_t * px, int w, int h, char * report, size_t reportLen);
+bool process_image(const char * infile, const char * outdir);
 
 #endif /* _IMAGE_PROCESSOR_H_ */
\ No newline at end of file
@@ -8,9 +8,9 @@
 #include "heatshrink_encoder.h"
 #include "fileUtils.h"
 
-void process_json(const char *infile, const char *outdir)
+bool process_json(const char *infile, const char *outdir)
 {
-    /* Determine if the output file already exists */
+    /* Determine the output file name */
     char outFilePath[128] = {0};
     strcat(outFilePath, outdir);
     strcat(outFilePath, "/");
@@ -25,14 +25,13 @@ void process_json(const char *infile, const char *outdir)
     dotptr[4] = 0;
 #endif
 
-    // if(doesFileExist(outFilePath))
-    // {
-    //     printf("Output for %s already exists\n", infile);
-    //     return;
-    // }
-
     /* Read input file */
     FILE *fp = fopen(infile, "rb");
+    if(NULL == fp)
+    {
+        fprintf(stderr, "Couldn't open %s\n", infile);
+        return false;
+    }
     fseek(fp, 0L, SEEK_END);
     long sz = ftell(fp);
     fseek(fp, 0L, SEEK_SET);
@@ -44,6 +43,11 @@ void process_json(const char *infile, const char *outdir)
 #ifndef JSON_COMPRESSION
     /* Write input directly to output */
     FILE* outFile = fopen(outFilePath, "wb");
+    if(NULL == outFile)
+    {
+        fprintf(stderr, "Couldn't open %s\n", outFilePath);
+        return false;
+    }
     fwrite(jsonInStr, sz, 1, outFile);
     fclose(outFile);
 #else
@@ -103,4 +107,5 @@ void process_json(const char *infile, const char *outdir)
     printf("%s:\n  Source file size: %d\n  WSG   file size: %d\n",
            infile, inputIdx, outputIdx);
 #endif
+    return true;
 }
\ No newline at end of file
@@ -1,6 +1,11 @@
 #ifndef _JSON_PROCESSOR_H_
 #define _JSON_PROCESSOR_H_
 
-void process_json(const char *infile, const char *outdir);
+#include <stdbool.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every JSON file
+#define JSON_PROCESSOR_VERSION 1
+
+bool process_json(const char *infile, const char *outdir);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,262 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "level_processor.h"
+#include "fileUtils.h"
+
+/* The camera's offsets are int16_t pixels, which limits how big a level is */
+#define LEVEL_MAX_TILES (INT16_MAX / 16)
+
+/* The heatshrink parameters which are tried. A chunk is only 256 tiles, so a
+ * larger window never finds anything more
+ */
+#define LEVEL_MIN_WINDOW    5
+#define LEVEL_MAX_WINDOW    8
+#define LEVEL_MIN_LOOKAHEAD 3
+
+#define CHUNK_TILES (LEVEL_CHUNK_SIZE * LEVEL_CHUNK_SIZE)
+
+/**
+ * One chunk of a level
+ */
+typedef struct
+{
+	uint8_t tiles[CHUNK_TILES];
+	int sameAs;               /* The earlier chunk with the same tiles, or -1 */
+	uint8_t codec;
+	uint32_t size;
+	uint32_t offset;
+	uint8_t data[CHUNK_TILES * 2];
+} levelChunk_t;
+
+/**
+ * @brief Compress a chunk whichever way is smallest. Ties go to the codec
+ * which is cheapest to decode
+ *
+ * @param chunk The chunk, its codec, size and data are written
+ * @param window The heatshrink window, log2
+ * @param lookahead The heatshrink lookahead, log2
+ */
+static void compressChunk(levelChunk_t * chunk, uint8_t window, uint8_t lookahead)
+{
+	chunk->codec = WSG_CODEC_RAW;
+	chunk->size = CHUNK_TILES;
+	memcpy(chunk->data, chunk->tiles, CHUNK_TILES);
+
+	uint8_t out[sizeof(chunk->data)];
+	uint32_t size = rleEncode(chunk->tiles, CHUNK_TILES, out);
+	if (size < chunk->size)
+	{
+		chunk->codec = WSG_CODEC_RLE;
+		chunk->size = size;
+		memcpy(chunk->data, out, size);
+	}
+
+	size = heatshrinkEncode(chunk->tiles, CHUNK_TILES, window, lookahead, out, sizeof(out));
+	if (0 < size && size < chunk->size)
+	{
+		chunk->codec = WSG_CODEC_HEATSHRINK;
+		chunk->size = size;
+		memcpy(chunk->data, out, size);
+	}
+}
+
+/**
+ * @brief Compile a platformer level into chunks which are decompressed one at
+ * a time as the camera reaches them, see level_processor.h
+ *
+ * @param infile The NAME.lvl.bin file, the level is written to NAME.lvl
+ * @param outdir The directory to write the level to
+ * @return true if the level was written, false if it wasn't
+ */
+bool process_level(const char * infile, const char * outdir)
+{
+	/* Determine the output file name */
+	char outFilePath[128] = {0};
+	strcat(outFilePath, outdir);
+	strcat(outFilePath, "/");
+	strcat(outFilePath, get_filename(infile));
+	strrchr(outFilePath, '.')[0] = 0;
+
+	/* Read input file */
+	FILE * fp = fopen(infile, "rb");
+	if (NULL == fp)
+	{
+		fprintf(stderr, "Couldn't open %s\n", infile);
+		return false;
+	}
+	fseek(fp, 0L, SEEK_END);
+	long sz = ftell(fp);
+	fseek(fp, 0L, SEEK_SET);
+	uint8_t * in = malloc(sz + 1);
+	bool ok = (1 == fread(in, sz, 1, fp));
+	fclose(fp);
+
+	/* Either header, see level_processor.h */
+	bool wide = (sz >= 6) && (0 == in[0]) && (0 == in[1]);
+	int w = 0;
+	int h = 0;
+	long expectedSz = 0;
+	if (wide)
+	{
+		w = (in[2] << 8) | in[3];
+		h = (in[4] << 8) | in[5];
+		expectedSz = 6 + ((long)w * h) + (LEVEL_NUM_WARPS * 4);
+	}
+	else if (sz >= 2)
+	{
+		w = in[0];
+		h = in[1];
+		expectedSz = 2 + ((long)w * h) + (LEVEL_NUM_WARPS * 2);
+	}
+	if (ok && (0 == w || 0 == h || sz != expectedSz))
+	{
+		fprintf(stderr, "%s isn't a level, it's %ld bytes for %dx%d tiles\n", infile, sz, w, h);
+		ok = false;
+	}
+	if (ok && (w > LEVEL_MAX_TILES || h > LEVEL_MAX_TILES))
+	{
+		fprintf(stderr, "%s is %dx%d tiles, levels can be at most %dx%d\n", infile, w, h, LEVEL_MAX_TILES,
+				LEVEL_MAX_TILES);
+		ok = false;
+	}
+	if (!ok)
+	{
+		free(in);
+		return false;
+	}
+	const uint8_t * tiles = &in[wide ? 6 : 2];
+	const uint8_t * warps = &tiles[w * h];
+
+	/* Cut the map into chunks, padded with empty tiles */
+	int chunksWide = (w + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_SIZE_IN_POWERS_OF_2;
+	int chunksHigh = (h + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_SIZE_IN_POWERS_OF_2;
+	int numChunks = chunksWide * chunksHigh;
+	levelChunk_t * chunks = calloc(numChunks, sizeof(levelChunk_t));
+	int numUnique = 0;
+	for (int c = 0; c < numChunks; c++)
+	{
+		levelChunk_t * chunk = &chunks[c];
+		int x0 = (c % chunksWide) * LEVEL_CHUNK_SIZE;
+		int y0 = (c / chunksWide) * LEVEL_CHUNK_SIZE;
+		for (int y = 0; y < LEVEL_CHUNK_SIZE && y0 + y < h; y++)
+		{
+			for (int x = 0; x < LEVEL_CHUNK_SIZE && x0 + x < w; x++)
+			{
+				chunk->tiles[(y * LEVEL_CHUNK_SIZE) + x] = tiles[((y0 + y) * w) + x0 + x];
+			}
+		}
+
+		chunk->sameAs = -1;
+		for (int o = 0; o < c; o++)
+		{
+			if (chunks[o].sameAs < 0 && 0 == memcmp(chunks[o].tiles, chunk->tiles, CHUNK_TILES))
+			{
+				chunk->sameAs = o;
+				break;
+			}
+		}
+		numUnique += (chunk->sameAs < 0);
+	}
+
+	/* Try each heatshrink window and lookahead for the whole level, and keep
+	 * the smallest. Ties go to the smaller window, which needs less RAM
+	 */
+	uint8_t bestWindow = LEVEL_MIN_WINDOW;
+	uint8_t bestLookahead = LEVEL_MIN_LOOKAHEAD;
+	long bestSize = -1;
+	for (uint8_t window = LEVEL_MIN_WINDOW; window <= LEVEL_MAX_WINDOW; window++)
+	{
+		for (uint8_t lookahead = LEVEL_MIN_LOOKAHEAD; lookahead < window; lookahead++)
+		{
+			long size = 0;
+			for (int c = 0; c < numChunks; c++)
+			{
+				if (chunks[c].sameAs < 0)
+				{
+					compressChunk(&chunks[c], window, lookahead);
+					size += chunks[c].size;
+				}
+			}
+			if (bestSize < 0 || size < bestSize)
+			{
+				bestSize = size;
+				bestWindow = window;
+				bestLookahead = lookahead;
+			}
+		}
+	}
+
+	/* Lay the chunks out after the directory */
+	uint32_t offset = LEVEL_HEADER_SIZE + (numChunks * LEVEL_CHUNK_ENTRY_SIZE);
+	for (int c = 0; c < numChunks; c++)
+	{
+		levelChunk_t * chunk = &chunks[c];
+		if (chunk->sameAs < 0)
+		{
+			compressChunk(chunk, bestWindow, bestLookahead);
+			chunk->offset = offset;
+			offset += chunk->size;
+		}
+		else
+		{
+			chunk->codec = chunks[chunk->sameAs].codec;
+			chunk->size = chunks[chunk->sameAs].size;
+			chunk->offset = chunks[chunk->sameAs].offset;
+		}
+	}
+
+	FILE * lvlFile = fopen(outFilePath, "wb");
+	if (NULL == lvlFile)
+	{
+		fprintf(stderr, "Couldn't open %s\n", outFilePath);
+		ok = false;
+	}
+	if (ok)
+	{
+		/* The header, with the warps widened */
+		uint8_t hdr[] = {HI_BYTE(w), LO_BYTE(w), HI_BYTE(h), LO_BYTE(h), (bestWindow << 4) | bestLookahead};
+		fwrite(hdr, sizeof(hdr), 1, lvlFile);
+		for (int i = 0; i < LEVEL_NUM_WARPS * 2; i++)
+		{
+			uint16_t coord = wide ? ((warps[i * 2] << 8) | warps[(i * 2) + 1]) : warps[i];
+			putc(HI_BYTE(coord), lvlFile);
+			putc(LO_BYTE(coord), lvlFile);
+		}
+
+		/* The directory, then each chunk's data once */
+		for (int c = 0; c < numChunks; c++)
+		{
+			const levelChunk_t * chunk = &chunks[c];
+			uint8_t entry[] =
+			{
+				chunk->codec,
+				HI_BYTE(chunk->size), LO_BYTE(chunk->size),
+				(chunk->offset >> 24) & 0xFF, (chunk->offset >> 16) & 0xFF,
+				HI_BYTE(chunk->offset), LO_BYTE(chunk->offset),
+			};
+			fwrite(entry, sizeof(entry), 1, lvlFile);
+		}
+		for (int c = 0; c < numChunks; c++)
+		{
+			if (chunks[c].sameAs < 0)
+			{
+				fwrite(chunks[c].data, chunks[c].size, 1, lvlFile);
+			}
+		}
+		ok = (0 == fclose(lvlFile));
+
+		/* Print results */
+		if (ok)
+		{
+			printf("%s:\n  %dx%d tiles, %d chunks, %d unique, heatshrink %d/%d\n  Source file size: %ld\n  Level file size: %ld\n",
+				   infile, w, h, numChunks, numUnique, bestWindow, bestLookahead, sz, getFileSize(outFilePath));
+		}
+	}
+
+	free(chunks);
+	free(in);
+	return ok;
+}
@@ -0,0 +1,36 @@
+#ifndef _LEVEL_PROCESSOR_H_
+#define _LEVEL_PROCESSOR_H_
+
+#include <stdbool.h>
+
+#include "image_processor.h"
+
+// Bump this whenever the output changes, so the manifest rebuilds every level.
+// Levels use the WSG codecs, so they're rebuilt when images are too
+#define LEVEL_PROCESSOR_VERSION ((IMAGE_PROCESSOR_VERSION * 100) + 1)
+
+/*
+ * A platformer level is compiled from NAME.lvl.bin to NAME.lvl. The input is
+ * the level editor's output, the width and height (uint8_t), the tiles, then
+ * sixteen warps' x and y (uint8_t). Larger levels start with two zero bytes,
+ * which a level never starts with, then the width and height as big endian
+ * uint16_t, the tiles, then the warps as big endian uint16_t.
+ *
+ * The output starts with the width and height, the heatshrink window (high
+ * nibble) and lookahead (low nibble), then the warps, all big endian. The map
+ * is cut into LEVEL_CHUNK_SIZE square chunks, padded with empty tiles, and a
+ * directory follows with each chunk's codec (uint8_t), size (uint16_t) and
+ * offset from the start of the file (uint32_t), row by row. The compressed
+ * chunks follow, and identical chunks share their data.
+ *
+ * This must match tilemap.h
+ */
+#define LEVEL_HEADER_SIZE (5 + (16 * 4))
+#define LEVEL_CHUNK_ENTRY_SIZE 7
+#define LEVEL_CHUNK_SIZE_IN_POWERS_OF_2 4
+#define LEVEL_CHUNK_SIZE (1 << LEVEL_CHUNK_SIZE_IN_POWERS_OF_2)
+#define LEVEL_NUM_WARPS 16
+
+bool process_level(const char * infile, const char * outdir);
+
+#endif /* _LEVEL_PROCESSOR_H_ */
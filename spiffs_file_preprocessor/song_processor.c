@@ -0,0 +1,244 @@
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "song_processor.h"
+#include "fileUtils.h"
+
+/* The longest a single compiled note can be. Longer notes are split */
+#define MAX_NOTE_MS 0xFFFF
+
+/* Note frequencies in Hz, exactly as in musical_buzzer.h */
+static const uint16_t noteFreqs[11][12] =
+{
+    {   16,    17,    18,    19,    21,    22,    23,    25,    26,    28,    29,    31}, /* Octave 0 */
+    {   33,    35,    37,    39,    41,    44,    46,    49,    52,    55,    58,    62}, /* Octave 1 */
+    {   65,    69,    73,    78,    82,    87,    93,    98,   104,   110,   117,   123}, /* Octave 2 */
+    {  131,   139,   147,   156,   165,   175,   185,   196,   208,   220,   233,   247}, /* Octave 3 */
+    {  262,   277,   294,   311,   330,   349,   370,   392,   415,   440,   466,   494}, /* Octave 4 */
+    {  523,   554,   587,   622,   659,   698,   740,   784,   831,   880,   932,   988}, /* Octave 5 */
+    { 1047,  1109,  1175,  1245,  1319,  1397,  1480,  1568,  1661,  1760,  1865,  1976}, /* Octave 6 */
+    { 2093,  2217,  2349,  2489,  2637,  2794,  2960,  3136,  3322,  3520,  3729,  3951}, /* Octave 7 */
+    { 4186,  4435,  4699,  4978,  5274,  5588,  5920,  6272,  6645,  7040,  7459,  7902}, /* Octave 8 */
+    { 8372,  8870,  9397,  9956, 10548, 11175, 11840, 12544, 13290, 14080, 14917, 15804}, /* Octave 9 */
+    {16744, 17740, 18795, 19912, 21096, 22351, 23680, 25088, 26580, 28160, 29834, 31609}, /* Octave 10 */
+};
+
+/**
+ * @brief Parse a note into a frequency. Notes may be written like the
+ * noteFrequency_t names ("C_SHARP_4", "SILENCE"), in short form ("C#4", "Db4"),
+ * or as a frequency in Hz ("440")
+ *
+ * @param tok The note to parse
+ * @param freq The frequency of the note is returned here
+ * @return true if the note was parsed, false if it wasn't
+ */
+static bool parseNote(const char * tok, uint16_t * freq)
+{
+    /* A plain number is a frequency */
+    if(isdigit((unsigned char)tok[0]))
+    {
+        char * end;
+        long hz = strtol(tok, &end, 10);
+        if(*end || hz > UINT16_MAX)
+        {
+            return false;
+        }
+        *freq = hz;
+        return true;
+    }
+
+    if(0 == strcmp(tok, "SILENCE") || 0 == strcmp(tok, "-"))
+    {
+        *freq = 0;
+        return true;
+    }
+
+    /* Find the natural note */
+    static const int8_t naturals[] = {9, 11, 0, 2, 4, 5, 7}; /* A through G */
+    char letter = toupper((unsigned char)tok[0]);
+    if(letter < 'A' || letter > 'G')
+    {
+        return false;
+    }
+    int semitone = naturals[letter - 'A'];
+    tok++;
+
+    /* Then sharps and flats */
+    if(0 == strncmp(tok, "_SHARP_", 7))
+    {
+        semitone++;
+        tok += 7;
+    }
+    else if('#' == tok[0])
+    {
+        semitone++;
+        tok++;
+    }
+    else if('b' == tok[0])
+    {
+        semitone--;
+        tok++;
+    }
+    else if('_' == tok[0])
+    {
+        tok++;
+    }
+
+    /* Then the octave */
+    char * end;
+    long octave = strtol(tok, &end, 10);
+    if(end == tok || *end)
+    {
+        return false;
+    }
+
+    /* Cb and B# cross octaves */
+    if(semitone < 0)
+    {
+        semitone += 12;
+        octave--;
+    }
+    else if(semitone > 11)
+    {
+        semitone -= 12;
+        octave++;
+    }
+
+    if(octave < 0 || octave > 10)
+    {
+        return false;
+    }
+    *freq = noteFreqs[octave][semitone];
+    return true;
+}
+
+/**
+ * @brief Compile a text song into a .sng file, which loadSong() reads.
+ *
+ * Each line of a .song file is either a note and a duration in ms, like
+ * "C#4 150", or "loop" to make the song loop. Anything after a '#' at the
+ * start of a word is a comment.
+ *
+ * The output is a two byte note count and a one byte flags field (bit 0 for
+ * looping), then a two byte frequency and two byte duration for each note,
+ * all big endian.
+ *
+ * @param infile The .song file to compile
+ * @param outdir The directory to write the .sng file to
+ * @return true if the .sng file was written, false if it wasn't
+ */
+bool process_song(const char * infile, const char * outdir)
+{
+    /* Determine the output file name, .song becomes .sng */
+    char outFilePath[128] = {0};
+    strcat(outFilePath, outdir);
+    strcat(outFilePath, "/");
+    strcat(outFilePath, get_filename(infile));
+    char * dotptr = strrchr(outFilePath, '.');
+    strcpy(dotptr, ".sng");
+
+    FILE * fp = fopen(infile, "r");
+    if(NULL == fp)
+    {
+        fprintf(stderr, "Couldn't open %s\n", infile);
+        return false;
+    }
+
+    /* Notes are built up here, four bytes each */
+    uint8_t * notes = NULL;
+    uint32_t numNotes = 0;
+    uint32_t notesCap = 0;
+    bool shouldLoop = false;
+
+    char line[256];
+    uint32_t lineNum = 0;
+    while(fgets(line, sizeof(line), fp))
+    {
+        lineNum++;
+
+        /* Strip comments */
+        char * comment = strstr(line, " #");
+        if(line[0] == '#')
+        {
+            comment = line;
+        }
+        if(NULL != comment)
+        {
+            *comment = 0;
+        }
+
+        char * savePtr = NULL;
+        char * noteTok = strtok_r(line, " \t\r\n", &savePtr);
+        if(NULL == noteTok)
+        {
+            /* Blank line */
+            continue;
+        }
+        else if(0 == strcmp(noteTok, "loop"))
+        {
+            shouldLoop = true;
+            continue;
+        }
+
+        char * timeTok = strtok_r(NULL, " \t\r\n", &savePtr);
+        uint16_t freq;
+        char * end = NULL;
+        long timeMs = (NULL != timeTok) ? strtol(timeTok, &end, 10) : -1;
+        if(!parseNote(noteTok, &freq) || NULL == timeTok || *end || timeMs < 0)
+        {
+            fprintf(stderr, "%s:%u: expected a note and a duration in ms\n", infile, lineNum);
+            free(notes);
+            fclose(fp);
+            return false;
+        }
+
+        /* Split very long notes */
+        do
+        {
+            uint16_t chunkMs = (timeMs > MAX_NOTE_MS) ? MAX_NOTE_MS : timeMs;
+            timeMs -= chunkMs;
+
+            if(numNotes == notesCap)
+            {
+                notesCap = notesCap ? (notesCap * 2) : 64;
+                notes = realloc(notes, notesCap * 4);
+            }
+            notes[(numNotes * 4) + 0] = HI_BYTE(freq);
+            notes[(numNotes * 4) + 1] = LO_BYTE(freq);
+            notes[(numNotes * 4) + 2] = HI_BYTE(chunkMs);
+            notes[(numNotes * 4) + 3] = LO_BYTE(chunkMs);
+            numNotes++;
+        } while(timeMs > 0);
+    }
+    fclose(fp);
+
+    if(numNotes > UINT16_MAX)
+    {
+        fprintf(stderr, "%s has too many notes\n", infile);
+        free(notes);
+        return false;
+    }
+
+    /* Write the compiled song */
+    FILE * outFile = fopen(outFilePath, "wb");
+    if(NULL == outFile)
+    {
+        fprintf(stderr, "Couldn't open %s\n", outFilePath);
+        free(notes);
+        return false;
+    }
+    putc(HI_BYTE(numNotes), outFile);
+    putc(LO_BYTE(numNotes), outFile);
+    putc(shouldLoop ? 0x01 : 0x00, outFile);
+    fwrite(notes, 4, numNotes, outFile);
+    fclose(outFile);
+    free(notes);
+
+    /* Print results */
+    printf("%s:\n  Notes: %u\n  SNG   file size: %u\n", infile, numNotes, 3 + (numNotes * 4));
+    return true;
+}
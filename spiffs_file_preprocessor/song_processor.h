@@ -0,0 +1,11 @@
+#ifndef _SONG_PROCESSOR_H_
+#define _SONG_PROCESSOR_H_
+
+#include <stdbool.h>
+
+// Bump this whenever the output changes, so the manifest rebuilds every song
+#define SONG_PROCESSOR_VERSION 1
+
+bool process_song(const char * infile, const char * outdir);
+
+#endif /* _SONG_PROCESSOR_H_ */
@@ -2,10 +2,14 @@
 #include <fcntl.h>
 #include <ftw.h>
 #include <getopt.h>
+#include <inttypes.h>
+#include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -14,25 +18,105 @@
 #include "font_processor.h"
 #include "json_processor.h"
 #include "bin_processor.h"
+#include "song_processor.h"
+#include "atlas_processor.h"
+#include "fighter_processor.h"
+#include "level_processor.h"
+#include "fileUtils.h"
+#include "../components/hdw-spiffs/asset_pack.h"
+
+/* The manifest's first line */
+#define MANIFEST_HEADER "# spiffs_file_preprocessor manifest 1"
+
+/* The most worker threads to use */
+#define MAX_THREADS 64
+
+/**
+ * How to process one kind of asset
+ */
+typedef struct
+{
+    const char * suffix;  /* Input files which end with this */
+    const char * outExt;  /* Replaces the input's last extension for the output name */
+    bool (*process)(const char * infile, const char * outdir);
+    uint32_t version;
+    bool (*hash)(const char * infile, uint64_t * hash); /* NULL to hash just the input */
+} assetProcessor_t;
+
+/**
+ * One input file
+ */
+typedef struct
+{
+    char * path;                       /* As walked, including the input directory */
+    const char * relPath;              /* Within the input directory, used as the manifest key */
+    const assetProcessor_t * proc;
+    char * outName;                    /* The output file name, within the output directory */
+    uint64_t hash;                     /* The input's content hash */
+    bool hashed;
+    bool needsBuild;
+    bool built;
+} asset_t;
+
+/**
+ * One line of the manifest from the previous run
+ */
+typedef struct
+{
+    char * relPath;
+    char * outName;
+    uint64_t hash;
+    uint32_t version;
+    const char * procSuffix;
+} manifestEntry_t;
+
+/* Order matters, the first suffix which matches is used */
+static const assetProcessor_t processors[] =
+{
+    {".font.png", "",      process_font,  FONT_PROCESSOR_VERSION},
+    {".png",      ".wsg",  process_image, IMAGE_PROCESSOR_VERSION},
+    {".ftr.json", "",      process_fighter, FIGHTER_PROCESSOR_VERSION},
+#ifdef JSON_COMPRESSION
+    {".json",     ".hon",  process_json,  JSON_PROCESSOR_VERSION},
+#else
+    {".json",     ".json", process_json,  JSON_PROCESSOR_VERSION},
+#endif
+    {".lvl.bin",  "",      process_level, LEVEL_PROCESSOR_VERSION},
+    {".bin",      ".bin",  process_bin,   BIN_PROCESSOR_VERSION},
+    {".song",     ".sng",  process_song,  SONG_PROCESSOR_VERSION},
+    {".atlas",    ".atl",  process_atlas, ATLAS_PROCESSOR_VERSION, hash_atlas},
+};
 
 const char * outDirName = NULL;
+static size_t inDirLen = 0;
+
+static asset_t * assets = NULL;
+static uint32_t numAssets = 0;
+static uint32_t assetsCap = 0;
+
+/* Shared by the worker threads */
+static uint32_t nextJob = 0;
+static uint32_t numJobs = 0;
+static asset_t ** jobs = NULL;
 
 /**
- * @brief TODO
- *
+ * @brief Print how to use this
  */
 void print_usage(void)
 {
-    printf("Usage:\n  spiffs_file_preprocessor\n    -i INPUT_DIRECTORY\n    -o OUTPUT_DIRECTORY\n");
+    printf("Usage:\n  spiffs_file_preprocessor\n    -i INPUT_DIRECTORY\n    -o OUTPUT_DIRECTORY\n"
+           "    [-m MANIFEST]  Defaults to OUTPUT_DIRECTORY.manifest\n"
+           "    [-p PACK]      Defaults to OUTPUT_DIRECTORY.pack\n"
+           "    [-j THREADS]   Defaults to the number of CPUs\n"
+           "    [-f]           Rebuild everything, even if it's up to date\n");
 }
 
 /**
- * @brief TODO
- * 
- * @param filename 
- * @param suffix 
- * @return true 
- * @return false 
+ * @brief Check if a string ends with another
+ *
+ * @param filename The string to check
+ * @param suffix What it might end with
+ * @return true if filename ends with suffix, false if it doesn't
  */
 bool endsWith(const char *filename, const char *suffix)
 {
@@ -44,33 +128,58 @@ bool endsWith(const char *filename, const char *suffix)
 }
 
 /**
- * @brief TODO
+ * @brief Get the time in seconds, for reporting how long things took
  *
- * @param fpath
- * @param st
- * @param tflag
- * @return int
+ * @return The time from a monotonic clock
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1e9);
+}
+
+/**
+ * @brief Note each file which can be processed. Files are processed after the
+ * whole tree is walked
+ *
+ * @param fpath The file or directory which was walked into
+ * @param st unused
+ * @param tflag What fpath is
+ * @return 0 to keep walking, -1 to stop
  */
 static int processFile(const char * fpath, const struct stat * st __attribute__((unused)), int tflag)
 {
     switch(tflag) {
     case FTW_F: // file
         {
-            if(endsWith(fpath, ".font.png"))
-            {
-                process_font(fpath, outDirName);
-            }
-            else if(endsWith(fpath, ".png"))
-            {
-                process_image(fpath, outDirName);
-            }
-            else if(endsWith(fpath, ".json"))
+            for(uint32_t i = 0; i < sizeof(processors) / sizeof(processors[0]); i++)
             {
-                process_json(fpath, outDirName);
-            } 
-            else if(endsWith(fpath, ".bin"))
-            {
-                process_bin(fpath, outDirName);
+                if(endsWith(fpath, processors[i].suffix))
+                {
+                    if(numAssets == assetsCap)
+                    {
+                        assetsCap = assetsCap ? (assetsCap * 2) : 256;
+                        assets = realloc(assets, assetsCap * sizeof(asset_t));
+                    }
+                    asset_t * a = &assets[numAssets++];
+                    memset(a, 0, sizeof(*a));
+                    a->path = strdup(fpath);
+                    a->relPath = a->path + inDirLen;
+                    while('/' == a->relPath[0])
+                    {
+                        a->relPath++;
+                    }
+                    a->proc = &processors[i];
+
+                    /* Swap the last extension for the output's */
+                    const char * name = get_filename(fpath);
+                    size_t baseLen = strrchr(name, '.') - name;
+                    a->outName = malloc(baseLen + strlen(a->proc->outExt) + 1);
+                    memcpy(a->outName, name, baseLen);
+                    strcpy(&a->outName[baseLen], a->proc->outExt);
+                    break;
+                }
             }
             break;
         }
@@ -90,19 +199,376 @@ static int processFile(const char * fpath, const struct stat * st __attribute__(
 }
 
 /**
- * @brief TODO
+ * @brief Sort assets by their path in the input directory
+ */
+static int cmpAssets(const void * a, const void * b)
+{
+    return strcmp(((const asset_t *)a)->relPath, ((const asset_t *)b)->relPath);
+}
+
+/**
+ * @brief Sort pointers to assets by their output name
+ */
+static int cmpOutNames(const void * a, const void * b)
+{
+    return strcmp((*(const asset_t * const *)a)->outName, (*(const asset_t * const *)b)->outName);
+}
+
+/**
+ * @brief Find inputs which make the same output. Outputs are all in one
+ * directory and the pack, so they'd overwrite each other
+ *
+ * @return true if any inputs collide, each collision is printed
+ */
+static bool findCollisions(void)
+{
+    bool collided = false;
+    const asset_t ** byName = malloc((numAssets + 1) * sizeof(asset_t *));
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        byName[i] = &assets[i];
+    }
+    qsort(byName, numAssets, sizeof(asset_t *), cmpOutNames);
+    for(uint32_t i = 1; i < numAssets; i++)
+    {
+        if(0 == strcmp(byName[i - 1]->outName, byName[i]->outName))
+        {
+            fprintf(stderr, "%s and %s both make %s\n", byName[i - 1]->relPath, byName[i]->relPath,
+                    byName[i]->outName);
+            collided = true;
+        }
+    }
+    free(byName);
+    return collided;
+}
+
+/**
+ * @brief Sort manifest entries by their path in the input directory
+ */
+static int cmpEntries(const void * a, const void * b)
+{
+    return strcmp(((const manifestEntry_t *)a)->relPath, ((const manifestEntry_t *)b)->relPath);
+}
+
+/**
+ * @brief Hash assets until there are none left
+ *
+ * @param arg unused
+ * @return NULL
+ */
+static void * hashWorker(void * arg __attribute__((unused)))
+{
+    uint32_t i;
+    while((i = __atomic_fetch_add(&nextJob, 1, __ATOMIC_RELAXED)) < numAssets)
+    {
+        assets[i].hash = FNV64_OFFSET;
+        if(NULL != assets[i].proc->hash)
+        {
+            assets[i].hashed = assets[i].proc->hash(assets[i].path, &assets[i].hash);
+        }
+        else
+        {
+            assets[i].hashed = hashFile(assets[i].path, &assets[i].hash);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Build queued assets until there are none left
+ *
+ * @param arg unused
+ * @return NULL
+ */
+static void * buildWorker(void * arg __attribute__((unused)))
+{
+    uint32_t i;
+    while((i = __atomic_fetch_add(&nextJob, 1, __ATOMIC_RELAXED)) < numJobs)
+    {
+        jobs[i]->built = jobs[i]->proc->process(jobs[i]->path, outDirName);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Run a worker on a number of threads and wait for them to finish
+ *
+ * @param worker The worker to run
+ * @param numThreads How many threads to run it on
+ */
+static void runWorkers(void * (*worker)(void *), int numThreads)
+{
+    pthread_t threads[MAX_THREADS];
+    nextJob = 0;
+    for(int t = 1; t < numThreads; t++)
+    {
+        pthread_create(&threads[t], NULL, worker, NULL);
+    }
+    /* This thread works too */
+    worker(NULL);
+    for(int t = 1; t < numThreads; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+/**
+ * @brief Load the manifest from the previous run
+ *
+ * @param fname The manifest
+ * @param numEntries Where to write the number of entries
+ * @return The entries, sorted by path, or NULL if there's no usable manifest
+ */
+static manifestEntry_t * loadManifest(const char * fname, uint32_t * numEntries)
+{
+    *numEntries = 0;
+    FILE * fp = fopen(fname, "r");
+    if(NULL == fp)
+    {
+        return NULL;
+    }
+
+    manifestEntry_t * entries = NULL;
+    uint32_t cap = 0;
+    char line[1024];
+    bool valid = (NULL != fgets(line, sizeof(line), fp)) && (0 == strncmp(line, MANIFEST_HEADER, strlen(MANIFEST_HEADER)));
+    while(valid && fgets(line, sizeof(line), fp))
+    {
+        /* hash, processor, version, output name and input path, tab separated */
+        line[strcspn(line, "\r\n")] = 0;
+        char * savePtr = NULL;
+        char * hashStr = strtok_r(line, "\t", &savePtr);
+        char * procStr = strtok_r(NULL, "\t", &savePtr);
+        char * verStr = strtok_r(NULL, "\t", &savePtr);
+        char * outStr = strtok_r(NULL, "\t", &savePtr);
+        char * pathStr = strtok_r(NULL, "\t", &savePtr);
+        if(NULL == pathStr)
+        {
+            continue;
+        }
+
+        if(*numEntries == cap)
+        {
+            cap = cap ? (cap * 2) : 256;
+            entries = realloc(entries, cap * sizeof(manifestEntry_t));
+        }
+        manifestEntry_t * e = &entries[(*numEntries)++];
+        e->hash = strtoull(hashStr, NULL, 16);
+        e->version = strtoul(verStr, NULL, 10);
+        e->outName = strdup(outStr);
+        e->relPath = strdup(pathStr);
+        e->procSuffix = NULL;
+        for(uint32_t i = 0; i < sizeof(processors) / sizeof(processors[0]); i++)
+        {
+            if(0 == strcmp(procStr, processors[i].suffix))
+            {
+                e->procSuffix = processors[i].suffix;
+            }
+        }
+    }
+    fclose(fp);
+
+    qsort(entries, *numEntries, sizeof(manifestEntry_t), cmpEntries);
+    return entries;
+}
+
+/**
+ * @brief Write the manifest for this run. It's written to a temporary file
+ * first, so an interrupted run can't leave a manifest which claims outputs
+ * which weren't written
+ *
+ * @param fname The manifest
+ * @return true if it was written, false if it wasn't
+ */
+static bool writeManifest(const char * fname)
+{
+    char tmpName[strlen(fname) + 5];
+    sprintf(tmpName, "%s.tmp", fname);
+    FILE * fp = fopen(tmpName, "w");
+    if(NULL == fp)
+    {
+        fprintf(stderr, "Couldn't write %s\n", tmpName);
+        return false;
+    }
+
+    fprintf(fp, "%s\n", MANIFEST_HEADER);
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        asset_t * a = &assets[i];
+        /* Failed builds aren't recorded, so they're tried again next time */
+        if(a->hashed && (!a->needsBuild || a->built))
+        {
+            fprintf(fp, "%016" PRIx64 "\t%s\t%" PRIu32 "\t%s\t%s\n", a->hash, a->proc->suffix, a->proc->version,
+                    a->outName, a->relPath);
+        }
+    }
+    fclose(fp);
+
+#if defined(_WIN32)
+    remove(fname);
+#endif
+    return 0 == rename(tmpName, fname);
+}
+
+/**
+ * @brief Sort assets by the hash of their output name, then the name, which is
+ * the order of an asset pack's table of contents
+ */
+static int cmpPackOrder(const void * a, const void * b)
+{
+    const asset_t * aa = *(const asset_t * const *)a;
+    const asset_t * bb = *(const asset_t * const *)b;
+    uint32_t ha = assetPackHash(aa->outName);
+    uint32_t hb = assetPackHash(bb->outName);
+    if(ha != hb)
+    {
+        return (ha < hb) ? -1 : 1;
+    }
+    return strcmp(aa->outName, bb->outName);
+}
+
+/**
+ * @brief Write every processed asset into one asset pack, which is flashed to
+ * its own partition and mapped by the firmware. See asset_pack.h for the format
+ *
+ * @param fname The pack to write
+ * @return true if it was written, false if it wasn't
+ */
+static bool writePack(const char * fname)
+{
+    /* Only assets which were processed go in */
+    asset_t ** packed = malloc((numAssets + 1) * sizeof(asset_t *));
+    uint32_t numPacked = 0;
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        if(assets[i].hashed && (!assets[i].needsBuild || assets[i].built))
+        {
+            packed[numPacked++] = &assets[i];
+        }
+    }
+    qsort(packed, numPacked, sizeof(asset_t *), cmpPackOrder);
+
+    /* Lay it out, the names follow the table of contents, then the files */
+    assetPackEntry_t * toc = calloc(numPacked + 1, sizeof(assetPackEntry_t));
+    uint32_t size = sizeof(assetPackHeader_t) + (numPacked * sizeof(assetPackEntry_t));
+    for(uint32_t i = 0; i < numPacked; i++)
+    {
+        toc[i].hash = assetPackHash(packed[i]->outName);
+        toc[i].nameOffset = size;
+        size += strlen(packed[i]->outName) + 1;
+    }
+    bool ok = true;
+    for(uint32_t i = 0; i < numPacked; i++)
+    {
+        char outPath[strlen(outDirName) + strlen(packed[i]->outName) + 2];
+        sprintf(outPath, "%s/%s", outDirName, packed[i]->outName);
+        long fileSize = getFileSize(outPath);
+        if(fileSize < 0)
+        {
+            fprintf(stderr, "Couldn't pack %s\n", outPath);
+            ok = false;
+            fileSize = 0;
+        }
+        size = (size + ASSET_PACK_ALIGN - 1) & ~(ASSET_PACK_ALIGN - 1);
+        toc[i].dataOffset = size;
+        toc[i].size = fileSize;
+        size += fileSize + 1;
+    }
+
+    /* Fill it in */
+    uint8_t * pack = calloc(1, size);
+    assetPackHeader_t hdr = {
+        .magic = ASSET_PACK_MAGIC,
+        .version = ASSET_PACK_VERSION,
+        .numEntries = numPacked,
+        .size = size,
+    };
+    memcpy(pack, &hdr, sizeof(hdr));
+    memcpy(&pack[sizeof(hdr)], toc, numPacked * sizeof(assetPackEntry_t));
+    for(uint32_t i = 0; ok && i < numPacked; i++)
+    {
+        strcpy((char *)&pack[toc[i].nameOffset], packed[i]->outName);
+
+        char outPath[strlen(outDirName) + strlen(packed[i]->outName) + 2];
+        sprintf(outPath, "%s/%s", outDirName, packed[i]->outName);
+        FILE * fp = fopen(outPath, "rb");
+        ok = (NULL != fp) && (toc[i].size == fread(&pack[toc[i].dataOffset], 1, toc[i].size, fp));
+        if(NULL != fp)
+        {
+            fclose(fp);
+        }
+    }
+
+    /* Written to a temporary file first, so a failed write leaves the old pack */
+    if(ok)
+    {
+        char tmpName[strlen(fname) + 5];
+        sprintf(tmpName, "%s.tmp", fname);
+        FILE * fp = fopen(tmpName, "wb");
+        ok = (NULL != fp) && (1 == fwrite(pack, size, 1, fp));
+        if(NULL != fp)
+        {
+            ok = (0 == fclose(fp)) && ok;
+        }
+#if defined(_WIN32)
+        remove(fname);
+#endif
+        ok = ok && (0 == rename(tmpName, fname));
+    }
+    if(ok)
+    {
+        printf("Packed %" PRIu32 " assets into %s, %" PRIu32 " bytes\n", numPacked, fname, size);
+    }
+    else
+    {
+        fprintf(stderr, "Couldn't write %s\n", fname);
+    }
+
+    free(pack);
+    free(toc);
+    free(packed);
+    return ok;
+}
+
+/**
+ * @brief Make a path next to the output directory, so it isn't packed into
+ * the SPIFFS image
+ *
+ * @param suffix What to append to the output directory's name
+ * @return The path, which must be freed
+ */
+static char * besideOutDir(const char * suffix)
+{
+    char * path = malloc(strlen(outDirName) + strlen(suffix) + 1);
+    strcpy(path, outDirName);
+    size_t len = strlen(path);
+    while(len > 1 && '/' == path[len - 1])
+    {
+        path[--len] = 0;
+    }
+    strcat(path, suffix);
+    return path;
+}
+
+/**
+ * @brief Walk the input directory, then build every asset which changed since
+ * the last run on a pool of threads
  *
  * @param argc
  * @param argv
- * @return int
+ * @return 0 if everything was built, -1 if anything failed
  */
 int main(int argc, char ** argv)
 {
     int c;
     const char * inDirName = NULL;
+    const char * manifestName = NULL;
+    const char * packName = NULL;
+    int numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    bool force = false;
 
     opterr = 0;
-    while ((c = getopt (argc, argv, "i:o:")) != -1)
+    while ((c = getopt (argc, argv, "i:o:m:p:j:f")) != -1)
     {
         switch (c)
         {
@@ -114,6 +580,22 @@ int main(int argc, char ** argv)
                 outDirName = optarg;
                 break;
             }
+        case 'm': {
+                manifestName = optarg;
+                break;
+            }
+        case 'p': {
+                packName = optarg;
+                break;
+            }
+        case 'j': {
+                numThreads = atoi(optarg);
+                break;
+            }
+        case 'f': {
+                force = true;
+                break;
+            }
         default: {
                 fprintf(stderr, "Invalid argument %c\n", c);
                 print_usage();
@@ -128,6 +610,30 @@ int main(int argc, char ** argv)
         print_usage();
         return -1;
     }
+    if(numThreads < 1)
+    {
+        numThreads = 1;
+    }
+    else if(numThreads > MAX_THREADS)
+    {
+        numThreads = MAX_THREADS;
+    }
+    /* Large images are split between threads too */
+    setImageProcessorThreads(numThreads);
+
+    /* The manifest and pack go next to the output directory, not in it */
+    char * defaultManifest = besideOutDir(".manifest");
+    char * defaultPack = besideOutDir(".pack");
+    if(NULL == manifestName)
+    {
+        manifestName = defaultManifest;
+    }
+    if(NULL == packName)
+    {
+        packName = defaultPack;
+    }
+
+    double tStart = nowS();
 
     // Create output directory if it doesn't exist
     struct stat st = {0};
@@ -139,10 +645,153 @@ int main(int argc, char ** argv)
 #endif
     }
 
+    /* Find every asset, in a stable order */
+    inDirLen = strlen(inDirName);
     if(ftw(inDirName, processFile, 99) == -1) {
         fprintf(stderr, "Failed to walk file tree\n");
         return -1;
     }
+    qsort(assets, numAssets, sizeof(asset_t), cmpAssets);
 
-    return 0;
+    /* PNGs beside an atlas go into it instead of their own WSGs */
+    uint32_t numKept = 0;
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        bool inAtlas = false;
+        for(uint32_t j = 0; j < numAssets && !inAtlas; j++)
+        {
+            inAtlas = (process_atlas == assets[j].proc->process) && isAtlasMember(assets[j].path, assets[i].path);
+        }
+        if(inAtlas)
+        {
+            free(assets[i].path);
+            free(assets[i].outName);
+        }
+        else
+        {
+            assets[numKept++] = assets[i];
+        }
+    }
+    numAssets = numKept;
+
+    /* Two inputs making the same output is an error, before anything is built */
+    if(findCollisions())
+    {
+        for(uint32_t i = 0; i < numAssets; i++)
+        {
+            free(assets[i].path);
+            free(assets[i].outName);
+        }
+        free(assets);
+        free(defaultManifest);
+        free(defaultPack);
+        return -1;
+    }
+
+    /* Hash every asset */
+    runWorkers(hashWorker, numThreads);
+
+    /* Compare against the last run. Inputs which are new, changed, built by a
+     * newer processor, or whose output is missing need to be built
+     */
+    uint32_t numEntries;
+    manifestEntry_t * entries = loadManifest(manifestName, &numEntries);
+    jobs = calloc(numAssets + 1, sizeof(asset_t *));
+    numJobs = 0;
+    bool ok = true;
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        asset_t * a = &assets[i];
+        if(!a->hashed)
+        {
+            fprintf(stderr, "Couldn't read %s\n", a->path);
+            ok = false;
+            continue;
+        }
+
+        manifestEntry_t key = {.relPath = (char *)a->relPath};
+        manifestEntry_t * e = bsearch(&key, entries, numEntries, sizeof(manifestEntry_t), cmpEntries);
+
+        char outPath[strlen(outDirName) + strlen(a->outName) + 2];
+        sprintf(outPath, "%s/%s", outDirName, a->outName);
+        struct stat outSt;
+        a->needsBuild = force || NULL == e || e->hash != a->hash || e->version != a->proc->version ||
+                        e->procSuffix != a->proc->suffix || 0 != strcmp(e->outName, a->outName) ||
+                        0 != stat(outPath, &outSt);
+        if(a->needsBuild)
+        {
+            jobs[numJobs++] = a;
+        }
+    }
+
+    /* Remove outputs of inputs which are gone */
+    bool removedAny = false;
+    for(uint32_t i = 0; i < numEntries; i++)
+    {
+        bool stillMade = false;
+        for(uint32_t j = 0; j < numAssets && !stillMade; j++)
+        {
+            stillMade = (0 == strcmp(entries[i].outName, assets[j].outName));
+        }
+        if(!stillMade)
+        {
+            char outPath[strlen(outDirName) + strlen(entries[i].outName) + 2];
+            sprintf(outPath, "%s/%s", outDirName, entries[i].outName);
+            if(0 == remove(outPath))
+            {
+                printf("Removed %s, %s is gone\n", outPath, entries[i].relPath);
+                removedAny = true;
+            }
+        }
+    }
+
+    /* Build everything that needs it. Each asset writes its own output, so the
+     * results don't depend on which thread built what
+     */
+    double tBuild = nowS();
+    runWorkers(buildWorker, numThreads);
+    for(uint32_t i = 0; i < numJobs; i++)
+    {
+        if(!jobs[i]->built)
+        {
+            fprintf(stderr, "Failed to process %s\n", jobs[i]->path);
+            ok = false;
+        }
+    }
+
+    if(!writeManifest(manifestName))
+    {
+        ok = false;
+    }
+
+    /* The pack only needs writing if an asset changed */
+    struct stat packSt;
+    if((0 < numJobs || removedAny || 0 != stat(packName, &packSt)) && !writePack(packName))
+    {
+        ok = false;
+    }
+    double tEnd = nowS();
+
+    printf("Processed %" PRIu32 " of %" PRIu32 " assets (%" PRIu32 " up to date) in %.1f ms, %.1f ms building, on %d thread%s\n",
+           numJobs, numAssets, numAssets - numJobs, (tEnd - tStart) * 1000, (tEnd - tBuild) * 1000, numThreads,
+           (1 == numThreads) ? "" : "s");
+
+    /* Cleanup */
+    for(uint32_t i = 0; i < numEntries; i++)
+    {
+        free(entries[i].relPath);
+        free(entries[i].outName);
+    }
+    free(entries);
+    for(uint32_t i = 0; i < numAssets; i++)
+    {
+        free(assets[i].path);
+        free(assets[i].outName);
+    }
+    free(assets);
+    free(jobs);
+    free(defaultManifest);
+    free(defaultPack);
+
+    return ok ? 0 : -1;
 }
@@ -0,0 +1,221 @@
+/*
+ * Host benchmark for the asset pack.
+ *
+ * Runs spiffs_file_preprocessor on assets/ into a temporary folder, which
+ * writes spiffs_image and spiffs_image.pack. Every file is checked against
+ * the pack through spiffsReadFile() and spiffsMapFile(), and the pack's table
+ * of contents is checked against the folder.
+ *
+ * Then it compares three ways the emulator can serve assets: fopen()/fread()
+ * per file, the image packed from spiffs_image at startup, and the mapped
+ * asset pack. For each it reports startup time, the time to load every file
+ * once right after startup, like the first mode entering, and the time to
+ * load every file again, like entering a mode later.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+
+#include "spiffs_manager.h"
+
+#define PREPROCESSOR "spiffs_file_preprocessor/spiffs_file_preprocessor"
+#define PACK_FILE    "spiffs_image.pack"
+#define PASSES       200
+
+static char names[1024][64];
+static uint32_t numNames = 0;
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Read a file the way the emulator did before it was packed
+ */
+static bool oldReadFile(const char* fname, uint8_t** output, size_t* outsize)
+{
+    char fnameFull[128] = "./spiffs_image/";
+    strcat(fnameFull, fname);
+    FILE* f = fopen(fnameFull, "rb");
+    if(f == NULL)
+    {
+        return false;
+    }
+    fseek(f, 0L, SEEK_END);
+    *outsize = ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    *output = (uint8_t*)calloc((*outsize + 1), sizeof(uint8_t));
+    if(1 != fread(*output, *outsize, 1, f) && 0 != *outsize)
+    {
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    return true;
+}
+
+/**
+ * Load every file once, the old way or through spiffsMapFile()
+ *
+ * @param old true to use fopen()/fread(), false to use spiffsMapFile()
+ * @return How long it took, in seconds
+ */
+static double loadAll(bool old)
+{
+    double start = nowS();
+    for(uint32_t i = 0; i < numNames; i++)
+    {
+        size_t sz;
+        if(old)
+        {
+            uint8_t* buf = NULL;
+            oldReadFile(names[i], &buf, &sz);
+            free(buf);
+        }
+        else
+        {
+            const uint8_t* buf = NULL;
+            spiffsMapFile(names[i], &buf, &sz);
+            spiffsUnmapFile(buf);
+        }
+    }
+    return nowS() - start;
+}
+
+/**
+ * Time one way of serving assets
+ *
+ * @param label What to call it
+ * @param old true to use fopen()/fread(), false to use spiffsMapFile()
+ */
+static void timeWay(const char* label, bool old)
+{
+    double start = nowS();
+    if(!old)
+    {
+        initSpiffs();
+    }
+    double initS = nowS() - start;
+    double firstS = loadAll(old);
+    double againS = 0;
+    for(uint32_t p = 0; p < PASSES; p++)
+    {
+        againS += loadAll(old);
+    }
+    if(!old)
+    {
+        deinitSpiffs();
+    }
+    printf("  %-22s %10.3f %12.3f %12.3f\n", label, initS * 1000, firstS * 1000, againS * 1000 / PASSES);
+}
+
+int main(void)
+{
+    // Run the preprocessor from the repository root, into a temporary folder
+    char root[PATH_MAX];
+    char tmpDir[] = "/tmp/asset_pack_benchXXXXXX";
+    if(NULL == realpath("../..", root) || NULL == mkdtemp(tmpDir))
+    {
+        printf("Couldn't make a temporary folder\n");
+        return 1;
+    }
+    char cmd[PATH_MAX * 3];
+    snprintf(cmd, sizeof(cmd), "%s/%s -i %s/assets -o %s/spiffs_image > /dev/null", root, PREPROCESSOR, root, tmpDir);
+    if(0 != system(cmd) || 0 != chdir(tmpDir))
+    {
+        printf("Couldn't run %s\n", cmd);
+        return 1;
+    }
+
+    // Everything the preprocessor wrote
+    DIR* dir = opendir("spiffs_image");
+    struct dirent* ent;
+    while(NULL != dir && NULL != (ent = readdir(dir)) && numNames < sizeof(names) / sizeof(names[0]))
+    {
+        if('.' != ent->d_name[0])
+        {
+            snprintf(names[numNames++], sizeof(names[0]), "%.63s", ent->d_name);
+        }
+    }
+    if(NULL != dir)
+    {
+        closedir(dir);
+    }
+
+    // Check every file in the pack, both ways
+    initSpiffs();
+    bool ok = (0 < numNames);
+    size_t totalSize = 0;
+    for(uint32_t i = 0; i < numNames && ok; i++)
+    {
+        uint8_t* expect = NULL;
+        uint8_t* copy = NULL;
+        const uint8_t* view = NULL;
+        size_t expectSz, copySz, viewSz;
+        ok = oldReadFile(names[i], &expect, &expectSz) &&
+             spiffsReadFile(names[i], &copy, &copySz) &&
+             spiffsMapFile(names[i], &view, &viewSz) &&
+             expectSz == copySz && expectSz == viewSz &&
+             0 == memcmp(expect, copy, expectSz + 1) &&
+             0 == memcmp(expect, view, expectSz + 1);
+        totalSize += expectSz;
+        free(expect);
+        free(copy);
+        spiffsUnmapFile(view);
+    }
+    uint8_t* missing = NULL;
+    size_t missingSz;
+    ok = ok && !spiffsReadFile("missing.bin", &missing, &missingSz);
+    deinitSpiffs();
+
+    if(!ok)
+    {
+        printf("FAIL: the asset pack doesn't match spiffs_image\n");
+    }
+    else
+    {
+        struct stat st;
+        stat(PACK_FILE, &st);
+        printf("Verified %u files, %u bytes, packed into %u bytes\n\n", numNames, (uint32_t)totalSize,
+               (uint32_t)st.st_size);
+        printf("  %-22s %10s %12s %12s\n", "ms", "startup", "first load", "load again");
+        timeWay("fopen() and fread()", true);
+
+        // Without the pack, the emulator packs spiffs_image at startup
+        rename(PACK_FILE, PACK_FILE ".off");
+        timeWay("image built at startup", false);
+        rename(PACK_FILE ".off", PACK_FILE);
+
+        timeWay("mapped asset pack", false);
+    }
+
+    // Clean up
+    for(uint32_t i = 0; i < numNames; i++)
+    {
+        char path[128];
+        snprintf(path, sizeof(path), "spiffs_image/%.63s", names[i]);
+        unlink(path);
+    }
+    rmdir("spiffs_image");
+    unlink(PACK_FILE);
+    unlink("spiffs_image.manifest");
+    if(0 != chdir("/") || 0 != rmdir(tmpDir))
+    {
+        printf("Couldn't remove %s\n", tmpDir);
+    }
+    return ok ? 0 : 1;
+}
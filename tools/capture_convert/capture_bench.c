@@ -0,0 +1,216 @@
+/*
+ * Feeds synthetic 280x240 frames through the emulator's frame capture, then
+ * decodes the capture and checks every frame came back exactly. Reports what
+ * capturing costs the swadge task per frame, the encoder's throughput, and the
+ * capture size for a mostly static menu, sprites over a static background, and
+ * a full screen scroll
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "emu_display.h"
+#include "emu_capture.h"
+#include "capture_decode.h"
+
+#define NUM_FRAMES 1200
+#define FRAME_US   16667
+#define NUM_PX     (TFT_WIDTH * TFT_HEIGHT)
+#define CAP_FILE   "capture_bench.swcp"
+
+// Stand ins for what the emulator provides
+uint32_t paletteColorsEmu[216];
+static int64_t fakeTimeUs = 0;
+
+int64_t esp_timer_get_time(void);
+int64_t esp_timer_get_time(void)
+{
+    return fakeTimeUs;
+}
+
+typedef enum
+{
+    SCENE_MENU,
+    SCENE_SPRITES,
+    SCENE_SCROLL,
+    NUM_SCENES
+} scene_t;
+
+static const char* const sceneNames[NUM_SCENES] = {"menu", "sprites", "scroll"};
+
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Draw a frame of a scene
+ */
+static void drawScene(scene_t scene, uint32_t f, uint8_t* px)
+{
+    switch(scene)
+    {
+        case SCENE_MENU:
+        {
+            // A flat background with text rows and a blinking cursor
+            memset(px, 5, NUM_PX);
+            for(int row = 0; row < 6; row++)
+            {
+                for(int y = 40 + row * 30; y < 52 + row * 30; y++)
+                {
+                    for(int x = 40; x < 240; x++)
+                    {
+                        px[y * TFT_WIDTH + x] = ((x / 3 + y / 2 + row) % 5) ? 5 : 215;
+                    }
+                }
+            }
+            if((f / 20) % 2)
+            {
+                int cy = 40 + ((f / 90) % 6) * 30;
+                for(int y = cy; y < cy + 12; y++)
+                {
+                    memset(&px[y * TFT_WIDTH + 20], 180, 12);
+                }
+            }
+            break;
+        }
+        case SCENE_SPRITES:
+        {
+            // A tiled background with sixteen bouncing sprites
+            for(int y = 0; y < TFT_HEIGHT; y++)
+            {
+                for(int x = 0; x < TFT_WIDTH; x++)
+                {
+                    px[y * TFT_WIDTH + x] = (((x / 16) + (y / 16)) & 1) ? 43 : 86;
+                }
+            }
+            for(int s = 0; s < 16; s++)
+            {
+                int sx = (s * 37 + f * (1 + s % 3)) % (TFT_WIDTH - 16);
+                int sy = (s * 53 + f * (1 + s % 2)) % (TFT_HEIGHT - 16);
+                for(int y = 0; y < 16; y++)
+                {
+                    for(int x = 0; x < 16; x++)
+                    {
+                        if((x - 8) * (x - 8) + (y - 8) * (y - 8) < 50)
+                        {
+                            px[(sy + y) * TFT_WIDTH + sx + x] = (x + y + s) % 216;
+                        }
+                    }
+                }
+            }
+            break;
+        }
+        case SCENE_SCROLL:
+        default:
+        {
+            // Detailed terrain scrolling two pixels a frame
+            for(int y = 0; y < TFT_HEIGHT; y++)
+            {
+                for(int x = 0; x < TFT_WIDTH; x++)
+                {
+                    uint32_t wx = x + f * 2;
+                    uint32_t h = (wx * 2654435761u) >> 28;
+                    px[y * TFT_WIDTH + x] = (y > 160 + (int)h) ? (100 + ((wx / 8 + y / 8) % 6)) : (uint32_t)(y / 40);
+                }
+            }
+            break;
+        }
+    }
+}
+
+int main(void)
+{
+    for(int i = 0; i < 216; i++)
+    {
+        paletteColorsEmu[i] = ((uint32_t)((i / 36) * 51) << 24) | (((i / 6) % 6) * 51 << 16) | ((i % 6) * 51 << 8) | 0xFF;
+    }
+
+    uint8_t* frames = malloc((size_t)NUM_FRAMES * NUM_PX);
+    bool allOk = true;
+
+    printf("%-8s %14s %14s %12s %12s\n", "scene", "us/frame paced", "max frames/s", "bytes/frame", "ratio");
+    for(int scene = 0; scene < NUM_SCENES; scene++)
+    {
+        for(uint32_t f = 0; f < NUM_FRAMES; f++)
+        {
+            drawScene(scene, f, &frames[(size_t)f * NUM_PX]);
+        }
+
+        // Capture as fast as possible for the encoder's throughput, then at
+        // 1000 fps for what the swadge task pays when the encoder keeps up
+        double tTotal = 0;
+        double tPerFrame = 0;
+        for(int paced = 0; paced < 2; paced++)
+        {
+            if(!emuCaptureStart(CAP_FILE))
+            {
+                return 1;
+            }
+            led_t leds[8];
+            double tStart = nowS();
+            double tInCapture = 0;
+            for(uint32_t f = 0; f < NUM_FRAMES; f++)
+            {
+                for(int l = 0; l < 8; l++)
+                {
+                    leds[l].r = f + l;
+                    leds[l].g = f * 2;
+                    leds[l].b = l * 30;
+                }
+                fakeTimeUs = (int64_t)f * FRAME_US;
+                double t0 = nowS();
+                emuCaptureLeds(leds, 8);
+                emuCaptureFrame(&frames[(size_t)f * NUM_PX]);
+                tInCapture += nowS() - t0;
+                if(paced)
+                {
+                    struct timespec ms = {0, 1000000};
+                    nanosleep(&ms, NULL);
+                }
+            }
+            emuCaptureDeinit();
+            if(paced)
+            {
+                tPerFrame = tInCapture / NUM_FRAMES;
+            }
+            else
+            {
+                tTotal = nowS() - tStart;
+            }
+        }
+
+        // Check every frame and LED comes back
+        captureReader_t cap;
+        bool ok = capOpen(&cap, CAP_FILE);
+        uint32_t f = 0;
+        while(ok && 1 == capNextFrame(&cap))
+        {
+            ok = (f < NUM_FRAMES) && (0 == memcmp(cap.px, &frames[(size_t)f * NUM_PX], NUM_PX)) &&
+                 (8 == cap.numLeds) && (cap.leds[3][0] == (uint8_t)(f + 3)) && (cap.timeUs == (uint64_t)f * FRAME_US);
+            f++;
+        }
+        ok = ok && (NUM_FRAMES == f);
+        capClose(&cap);
+
+        FILE* fp = fopen(CAP_FILE, "rb");
+        fseek(fp, 0, SEEK_END);
+        long size = ftell(fp);
+        fclose(fp);
+
+        printf("%-8s %14.1f %14.0f %12.0f %11.1fx %s\n", sceneNames[scene], tPerFrame * 1e6,
+               NUM_FRAMES / tTotal, (double)size / NUM_FRAMES, ((double)NUM_FRAMES * NUM_PX) / size,
+               ok ? "" : "MISMATCH");
+        allOk = allOk && ok;
+    }
+
+    remove(CAP_FILE);
+    free(frames);
+    return allOk ? 0 : 1;
+}
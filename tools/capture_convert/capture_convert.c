@@ -0,0 +1,498 @@
+/*
+ * Turns a capture from the emulator's --capture option into a PNG sequence, a
+ * GIF, or both. The LEDs can be drawn as a bar above each frame like the
+ * emulator draws them
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+#include "capture_decode.h"
+
+// The LED bar's height, before scaling
+#define LED_BAR_H 16
+
+// GIF delays are in hundredths of a second, and most viewers slow down frames
+// shorter than two of those. Frames closer together than this are merged
+#define GIF_MIN_DELAY_US 20000
+
+#define LZW_MAX_CODE 4095
+#define LZW_HASH_SIZE 8192
+
+typedef struct
+{
+    FILE* f;
+    uint8_t block[255];
+    uint8_t blockLen;
+    uint32_t bits;
+    uint8_t numBits;
+} gifBits_t;
+
+typedef struct
+{
+    FILE* f;
+    uint16_t w;
+    uint16_t h;
+    uint8_t* written;      // What the GIF shows so far
+    uint8_t* pending;      // The next frame to write, once its delay is known
+    uint64_t pendingUs;
+    bool hasPending;
+    bool hasWritten;
+    uint8_t* rect;
+    int64_t delayErrUs;    // Rounding carried between frame delays
+    uint32_t numFrames;
+} gifWriter_t;
+
+static void composeFrame(const captureReader_t* cap, uint32_t scale, bool drawLeds, uint8_t* out, uint32_t outW);
+static uint8_t nearestColor(const captureReader_t* cap, const uint8_t rgb[3]);
+static bool writePng(const captureReader_t* cap, const char* prefix, const uint8_t* idx, uint32_t w, uint32_t h,
+                     uint32_t scale, bool drawLeds);
+static bool gifOpen(gifWriter_t* gif, const char* fname, const captureReader_t* cap, uint16_t w, uint16_t h);
+static void gifFrame(gifWriter_t* gif, const uint8_t* idx, uint64_t timeUs);
+static void gifWritePending(gifWriter_t* gif, uint64_t endUs);
+static void gifClose(gifWriter_t* gif);
+static void gifLzw(FILE* f, const uint8_t* px, uint32_t numPx);
+static void gifPutCode(gifBits_t* b, uint32_t code, uint8_t size);
+static void gifFlushBits(gifBits_t* b);
+
+/**
+ * @brief Draw a frame, and the LEDs if asked, as palette indices
+ *
+ * @param cap The capture, at the frame to draw
+ * @param scale How many times larger to draw it
+ * @param drawLeds true to draw the LED bar above the frame
+ * @param out The image to draw to
+ * @param outW The image's width
+ */
+static void composeFrame(const captureReader_t* cap, uint32_t scale, bool drawLeds, uint8_t* out, uint32_t outW)
+{
+    uint32_t barH = drawLeds ? LED_BAR_H * scale : 0;
+    if(drawLeds)
+    {
+        for(uint32_t x = 0; x < outW; x++)
+        {
+            uint8_t color = 0;
+            if(cap->numLeds)
+            {
+                color = nearestColor(cap, cap->leds[(x * cap->numLeds) / outW]);
+            }
+            for(uint32_t y = 0; y < barH; y++)
+            {
+                out[y * outW + x] = color;
+            }
+        }
+    }
+
+    for(uint32_t y = 0; y < cap->height; y++)
+    {
+        uint8_t* row = &out[(barH + y * scale) * outW];
+        const uint8_t* src = &cap->px[y * cap->width];
+        for(uint32_t x = 0; x < cap->width; x++)
+        {
+            // Anything outside the palette, like transparency, is drawn black
+            uint8_t c = (src[x] < cap->numColors) ? src[x] : 0;
+            memset(&row[x * scale], c, scale);
+        }
+        for(uint32_t s = 1; s < scale; s++)
+        {
+            memcpy(&row[s * outW], row, outW);
+        }
+    }
+}
+
+/**
+ * @brief Find the palette color closest to an LED's color
+ */
+static uint8_t nearestColor(const captureReader_t* cap, const uint8_t rgb[3])
+{
+    uint8_t best = 0;
+    int32_t bestDist = INT32_MAX;
+    for(uint16_t i = 0; i < cap->numColors; i++)
+    {
+        int32_t dr = rgb[0] - cap->palette[i][0];
+        int32_t dg = rgb[1] - cap->palette[i][1];
+        int32_t db = rgb[2] - cap->palette[i][2];
+        int32_t dist = dr * dr + dg * dg + db * db;
+        if(dist < bestDist)
+        {
+            bestDist = dist;
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Write a frame as an RGB PNG. The LEDs are drawn in their exact colors
+ */
+static bool writePng(const captureReader_t* cap, const char* prefix, const uint8_t* idx, uint32_t w, uint32_t h,
+                     uint32_t scale, bool drawLeds)
+{
+    static uint8_t* rgb = NULL;
+    rgb = realloc(rgb, w * h * 3);
+    for(uint32_t i = 0; i < w * h; i++)
+    {
+        memcpy(&rgb[i * 3], cap->palette[idx[i]], 3);
+    }
+    if(drawLeds && cap->numLeds)
+    {
+        for(uint32_t x = 0; x < w; x++)
+        {
+            const uint8_t* led = cap->leds[(x * cap->numLeds) / w];
+            for(uint32_t y = 0; y < LED_BAR_H * scale; y++)
+            {
+                memcpy(&rgb[(y * w + x) * 3], led, 3);
+            }
+        }
+    }
+
+    char fname[1024];
+    snprintf(fname, sizeof(fname), "%s_%05u.png", prefix, cap->frameNum - 1);
+    if(!stbi_write_png(fname, w, h, 3, rgb, w * 3))
+    {
+        fprintf(stderr, "Couldn't write %s\n", fname);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Start a looping GIF with the capture's palette
+ */
+static bool gifOpen(gifWriter_t* gif, const char* fname, const captureReader_t* cap, uint16_t w, uint16_t h)
+{
+    memset(gif, 0, sizeof(*gif));
+    gif->f = fopen(fname, "wb");
+    if(NULL == gif->f)
+    {
+        fprintf(stderr, "Couldn't open %s\n", fname);
+        return false;
+    }
+    gif->w = w;
+    gif->h = h;
+    gif->written = calloc(w * h, 1);
+    gif->pending = calloc(w * h, 1);
+    gif->rect = calloc(w * h, 1);
+
+    uint8_t hdr[13] = {'G', 'I', 'F', '8', '9', 'a', w & 0xFF, w >> 8, h & 0xFF, h >> 8, 0xF7, 0, 0};
+    fwrite(hdr, 1, sizeof(hdr), gif->f);
+    uint8_t palette[256][3] = {{0}};
+    memcpy(palette, cap->palette, cap->numColors * 3);
+    fwrite(palette, 3, 256, gif->f);
+
+    // Loop forever
+    static const uint8_t loop[19] =
+    {
+        0x21, 0xFF, 0x0B, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 0x03, 0x01, 0x00, 0x00, 0x00
+    };
+    fwrite(loop, 1, sizeof(loop), gif->f);
+    return true;
+}
+
+/**
+ * @brief Add a frame to a GIF. It's held until the next frame, since that's
+ * when its delay is known
+ */
+static void gifFrame(gifWriter_t* gif, const uint8_t* idx, uint64_t timeUs)
+{
+    if(gif->hasPending && (timeUs - gif->pendingUs) >= GIF_MIN_DELAY_US)
+    {
+        gifWritePending(gif, timeUs);
+    }
+    if(!gif->hasPending)
+    {
+        gif->pendingUs = timeUs;
+        gif->hasPending = true;
+    }
+    // A frame too soon after the pending one replaces it
+    memcpy(gif->pending, idx, gif->w * gif->h);
+}
+
+/**
+ * @brief Write the pending frame, only the part which changed
+ *
+ * @param gif The GIF
+ * @param endUs When the pending frame stops being shown
+ */
+static void gifWritePending(gifWriter_t* gif, uint64_t endUs)
+{
+    // Find what changed
+    uint16_t x0 = gif->w, y0 = gif->h, x1 = 0, y1 = 0;
+    for(uint16_t y = 0; y < gif->h; y++)
+    {
+        const uint8_t* a = &gif->pending[y * gif->w];
+        const uint8_t* b = &gif->written[y * gif->w];
+        if(gif->hasWritten && 0 == memcmp(a, b, gif->w))
+        {
+            continue;
+        }
+        uint16_t l = 0, r = gif->w - 1;
+        if(gif->hasWritten)
+        {
+            while(a[l] == b[l])
+            {
+                l++;
+            }
+            while(a[r] == b[r])
+            {
+                r--;
+            }
+        }
+        x0 = (l < x0) ? l : x0;
+        x1 = (r > x1) ? r : x1;
+        y0 = (y < y0) ? y : y0;
+        y1 = y;
+    }
+    if(x0 > x1)
+    {
+        // Nothing changed, but the time still has to pass
+        x0 = x1 = y0 = y1 = 0;
+    }
+    uint16_t rw = x1 - x0 + 1, rh = y1 - y0 + 1;
+    for(uint16_t y = 0; y < rh; y++)
+    {
+        memcpy(&gif->rect[y * rw], &gif->pending[(y0 + y) * gif->w + x0], rw);
+    }
+
+    int64_t durUs = (int64_t)(endUs - gif->pendingUs) + gif->delayErrUs;
+    uint16_t delay = (durUs + 5000) / 10000;
+    gif->delayErrUs = durUs - (int64_t)delay * 10000;
+
+    // Graphic control extension, leave the frame in place for the next one
+    uint8_t gce[8] = {0x21, 0xF9, 0x04, 0x04, delay & 0xFF, delay >> 8, 0, 0};
+    fwrite(gce, 1, sizeof(gce), gif->f);
+    uint8_t desc[10] = {0x2C, x0 & 0xFF, x0 >> 8, y0 & 0xFF, y0 >> 8, rw & 0xFF, rw >> 8, rh & 0xFF, rh >> 8, 0};
+    fwrite(desc, 1, sizeof(desc), gif->f);
+    gifLzw(gif->f, gif->rect, rw * rh);
+
+    memcpy(gif->written, gif->pending, gif->w * gif->h);
+    gif->hasWritten = true;
+    gif->hasPending = false;
+    gif->numFrames++;
+}
+
+/**
+ * @brief Write the last frame and finish a GIF
+ */
+static void gifClose(gifWriter_t* gif)
+{
+    if(gif->hasPending)
+    {
+        gifWritePending(gif, gif->pendingUs + GIF_MIN_DELAY_US);
+    }
+    fputc(0x3B, gif->f);
+    fclose(gif->f);
+    free(gif->written);
+    free(gif->pending);
+    free(gif->rect);
+}
+
+/**
+ * @brief LZW compress 8 bit pixels as GIF image data
+ *
+ * @param f The file to write to
+ * @param px The pixels
+ * @param numPx The number of pixels, at least one
+ */
+static void gifLzw(FILE* f, const uint8_t* px, uint32_t numPx)
+{
+    const uint32_t clearCode = 256;
+    static int32_t keys[LZW_HASH_SIZE];
+    static uint16_t codes[LZW_HASH_SIZE];
+    memset(keys, 0xFF, sizeof(keys));
+
+    gifBits_t b = {.f = f};
+    uint8_t codeSize = 9;
+    uint32_t nextCode = clearCode + 2;
+
+    fputc(8, f);
+    gifPutCode(&b, clearCode, codeSize);
+    uint32_t prefix = px[0];
+    for(uint32_t i = 1; i < numPx; i++)
+    {
+        int32_t key = (prefix << 8) | px[i];
+        uint32_t slot = ((uint32_t)key * 2654435761u) >> 19;
+        while(keys[slot] >= 0 && keys[slot] != key)
+        {
+            slot = (slot + 1) & (LZW_HASH_SIZE - 1);
+        }
+        if(keys[slot] == key)
+        {
+            prefix = codes[slot];
+            continue;
+        }
+
+        gifPutCode(&b, prefix, codeSize);
+        keys[slot] = key;
+        codes[slot] = nextCode;
+        if(nextCode >= (1u << codeSize))
+        {
+            codeSize++;
+        }
+        if(LZW_MAX_CODE == nextCode)
+        {
+            gifPutCode(&b, clearCode, codeSize);
+            memset(keys, 0xFF, sizeof(keys));
+            codeSize = 9;
+            nextCode = clearCode + 2;
+        }
+        else
+        {
+            nextCode++;
+        }
+        prefix = px[i];
+    }
+    gifPutCode(&b, prefix, codeSize);
+    gifPutCode(&b, clearCode + 1, codeSize);
+    gifFlushBits(&b);
+    fputc(0, f);
+}
+
+/**
+ * @brief Write a code into GIF data sub-blocks, least significant bit first
+ */
+static void gifPutCode(gifBits_t* b, uint32_t code, uint8_t size)
+{
+    b->bits |= code << b->numBits;
+    b->numBits += size;
+    while(b->numBits >= 8)
+    {
+        b->block[b->blockLen++] = b->bits & 0xFF;
+        b->bits >>= 8;
+        b->numBits -= 8;
+        if(255 == b->blockLen)
+        {
+            fputc(255, b->f);
+            fwrite(b->block, 1, 255, b->f);
+            b->blockLen = 0;
+        }
+    }
+}
+
+/**
+ * @brief Write out any partial byte and sub-block
+ */
+static void gifFlushBits(gifBits_t* b)
+{
+    if(b->numBits)
+    {
+        gifPutCode(b, 0, 8 - b->numBits);
+    }
+    if(b->blockLen)
+    {
+        fputc(b->blockLen, b->f);
+        fwrite(b->block, 1, b->blockLen, b->f);
+        b->blockLen = 0;
+    }
+}
+
+/**
+ * @brief Print how to use this
+ */
+static void printUsage(const char* progName)
+{
+    printf("Usage: %s -i <capture> [-p <png prefix>] [-g <gif>] [-l] [-s <scale>]\n"
+           "  -i  A capture from the emulator's --capture option\n"
+           "  -p  Write every frame to <png prefix>_00000.png and so on\n"
+           "  -g  Write a GIF. Frames less than %d ms apart are merged\n"
+           "  -l  Draw the LEDs as a bar above each frame\n"
+           "  -s  Draw each pixel this many times larger\n", progName, GIF_MIN_DELAY_US / 1000);
+}
+
+int main(int argc, char** argv)
+{
+    const char* inFile = NULL;
+    const char* pngPrefix = NULL;
+    const char* gifFile = NULL;
+    bool drawLeds = false;
+    uint32_t scale = 1;
+
+    int c;
+    while((c = getopt(argc, argv, "i:p:g:ls:")) != -1)
+    {
+        switch(c)
+        {
+            case 'i':
+                inFile = optarg;
+                break;
+            case 'p':
+                pngPrefix = optarg;
+                break;
+            case 'g':
+                gifFile = optarg;
+                break;
+            case 'l':
+                drawLeds = true;
+                break;
+            case 's':
+                scale = atoi(optarg);
+                break;
+            default:
+                printUsage(argv[0]);
+                return 1;
+        }
+    }
+    if(NULL == inFile || (NULL == pngPrefix && NULL == gifFile) || scale < 1 || scale > 16)
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    captureReader_t cap;
+    if(!capOpen(&cap, inFile))
+    {
+        return 1;
+    }
+
+    uint32_t w = cap.width * scale;
+    uint32_t h = cap.height * scale + (drawLeds ? LED_BAR_H * scale : 0);
+    if(w > UINT16_MAX || h > UINT16_MAX)
+    {
+        fprintf(stderr, "The output would be too big\n");
+        capClose(&cap);
+        return 1;
+    }
+    uint8_t* idx = malloc(w * h);
+
+    gifWriter_t gif;
+    bool ok = (NULL == gifFile) || gifOpen(&gif, gifFile, &cap, w, h);
+
+    int rc;
+    while(ok && 1 == (rc = capNextFrame(&cap)))
+    {
+        composeFrame(&cap, scale, drawLeds, idx, w);
+        if(NULL != pngPrefix && !writePng(&cap, pngPrefix, idx, w, h, scale, drawLeds))
+        {
+            ok = false;
+        }
+        if(NULL != gifFile)
+        {
+            gifFrame(&gif, idx, cap.timeUs);
+        }
+    }
+    if(ok && rc < 0)
+    {
+        ok = false;
+    }
+
+    if(NULL != gifFile && NULL != gif.f)
+    {
+        gifClose(&gif);
+        printf("Wrote %u of %u frames to %s\n", gif.numFrames, cap.frameNum, gifFile);
+    }
+    if(NULL != pngPrefix)
+    {
+        printf("Wrote %u frames to %s_*.png\n", cap.frameNum, pngPrefix);
+    }
+
+    free(idx);
+    capClose(&cap);
+    return ok ? 0 : 1;
+}
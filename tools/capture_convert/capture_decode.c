@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "emu_capture.h"
+#include "capture_decode.h"
+
+static bool readVarint(FILE* f, uint64_t* val);
+static bool opVarint(const uint8_t* ops, uint32_t len, uint32_t* pos, uint64_t* val);
+
+/**
+ * @brief Open a capture and read its header
+ *
+ * @param cap The reader to set up
+ * @param fname The capture to open
+ * @return true if it was opened, false if it isn't a capture this can read
+ */
+bool capOpen(captureReader_t* cap, const char* fname)
+{
+    memset(cap, 0, sizeof(*cap));
+    cap->file = fopen(fname, "rb");
+    if(NULL == cap->file)
+    {
+        fprintf(stderr, "Couldn't open %s\n", fname);
+        return false;
+    }
+
+    uint8_t hdr[11];
+    if(sizeof(hdr) != fread(hdr, 1, sizeof(hdr), cap->file) || 0 != memcmp(hdr, CAP_MAGIC, 4) ||
+            CAP_VERSION != hdr[4])
+    {
+        fprintf(stderr, "%s isn't a version %d capture\n", fname, CAP_VERSION);
+        capClose(cap);
+        return false;
+    }
+    cap->width = hdr[5] | (hdr[6] << 8);
+    cap->height = hdr[7] | (hdr[8] << 8);
+    cap->numColors = hdr[9] | (hdr[10] << 8);
+    if(0 == cap->width || 0 == cap->height || cap->numColors > CAP_MAX_COLORS ||
+            cap->numColors != fread(cap->palette, 3, cap->numColors, cap->file))
+    {
+        fprintf(stderr, "%s has a bad header\n", fname);
+        capClose(cap);
+        return false;
+    }
+
+    cap->px = calloc(cap->width * cap->height, 1);
+    return true;
+}
+
+/**
+ * @brief Read the next frame, applying it to the current one
+ *
+ * @param cap The reader
+ * @return 1 if a frame was read, 0 at the end of the capture, -1 if it's corrupt
+ */
+int capNextFrame(captureReader_t* cap)
+{
+    int type = fgetc(cap->file);
+    if(EOF == type)
+    {
+        return 0;
+    }
+
+    uint64_t dt, opsLen;
+    int numLeds;
+    if((CAP_KEY_FRAME != type && CAP_DELTA_FRAME != type) || !readVarint(cap->file, &dt) ||
+            EOF == (numLeds = fgetc(cap->file)) || numLeds > CAP_MAX_LEDS ||
+            (size_t)numLeds != fread(cap->leds, 3, numLeds, cap->file) || !readVarint(cap->file, &opsLen) ||
+            opsLen > 4 * (uint64_t)cap->width * cap->height)
+    {
+        fprintf(stderr, "Frame %u is corrupt\n", cap->frameNum);
+        return -1;
+    }
+    if(opsLen > cap->opsCap)
+    {
+        cap->opsCap = opsLen;
+        cap->ops = realloc(cap->ops, cap->opsCap);
+    }
+    if(opsLen != fread(cap->ops, 1, opsLen, cap->file))
+    {
+        fprintf(stderr, "Frame %u is cut off\n", cap->frameNum);
+        return -1;
+    }
+
+    cap->isKey = (CAP_KEY_FRAME == type);
+    cap->numLeds = numLeds;
+    cap->timeUs += (0 == cap->frameNum) ? 0 : dt;
+
+    // Apply the ops
+    uint32_t numPx = cap->width * cap->height;
+    if(cap->isKey)
+    {
+        memset(cap->px, 0, numPx);
+    }
+    uint32_t pos = 0;
+    uint32_t px = 0;
+    while(pos < opsLen)
+    {
+        uint64_t hdr;
+        if(!opVarint(cap->ops, opsLen, &pos, &hdr) || (hdr >> 2) > numPx - px)
+        {
+            fprintf(stderr, "Frame %u has a bad op\n", cap->frameNum);
+            return -1;
+        }
+        uint32_t count = hdr >> 2;
+        switch(hdr & 3)
+        {
+            case CAP_OP_SKIP:
+            {
+                break;
+            }
+            case CAP_OP_RUN:
+            {
+                if(pos >= opsLen)
+                {
+                    return -1;
+                }
+                memset(&cap->px[px], cap->ops[pos++], count);
+                break;
+            }
+            case CAP_OP_LITERAL:
+            {
+                if(count > opsLen - pos)
+                {
+                    return -1;
+                }
+                memcpy(&cap->px[px], &cap->ops[pos], count);
+                pos += count;
+                break;
+            }
+            default:
+            {
+                fprintf(stderr, "Frame %u has an unknown op\n", cap->frameNum);
+                return -1;
+            }
+        }
+        px += count;
+    }
+    if(px != numPx)
+    {
+        fprintf(stderr, "Frame %u covers %u of %u pixels\n", cap->frameNum, px, numPx);
+        return -1;
+    }
+
+    cap->frameNum++;
+    return 1;
+}
+
+/**
+ * @brief Close a capture
+ *
+ * @param cap The reader
+ */
+void capClose(captureReader_t* cap)
+{
+    if(NULL != cap->file)
+    {
+        fclose(cap->file);
+    }
+    free(cap->px);
+    free(cap->ops);
+    memset(cap, 0, sizeof(*cap));
+}
+
+/**
+ * @brief Read an unsigned LEB128 varint from a file
+ */
+static bool readVarint(FILE* f, uint64_t* val)
+{
+    *val = 0;
+    for(int shift = 0; shift < 64; shift += 7)
+    {
+        int byte = fgetc(f);
+        if(EOF == byte)
+        {
+            return false;
+        }
+        *val |= (uint64_t)(byte & 0x7F) << shift;
+        if(!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Read an unsigned LEB128 varint from a frame's ops
+ */
+static bool opVarint(const uint8_t* ops, uint32_t len, uint32_t* pos, uint64_t* val)
+{
+    *val = 0;
+    for(int shift = 0; shift < 64 && *pos < len; shift += 7)
+    {
+        uint8_t byte = ops[(*pos)++];
+        *val |= (uint64_t)(byte & 0x7F) << shift;
+        if(!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
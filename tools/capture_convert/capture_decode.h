@@ -0,0 +1,39 @@
+#ifndef _CAPTURE_DECODE_H_
+#define _CAPTURE_DECODE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define CAP_MAX_COLORS 256
+#define CAP_MAX_LEDS   64
+
+/**
+ * Reads frames from a capture made with the emulator's --capture option, one
+ * at a time. See emu_capture.h for the format
+ */
+typedef struct
+{
+    FILE* file;
+    uint16_t width;
+    uint16_t height;
+    uint16_t numColors;
+    uint8_t palette[CAP_MAX_COLORS][3]; //!< Red, green and blue for each palette index
+
+    // The current frame
+    uint8_t* px;           //!< width * height palette indices
+    uint8_t leds[CAP_MAX_LEDS][3];
+    uint8_t numLeds;
+    uint64_t timeUs;       //!< Since the first frame
+    bool isKey;
+    uint32_t frameNum;
+
+    uint8_t* ops;
+    uint32_t opsCap;
+} captureReader_t;
+
+bool capOpen(captureReader_t* cap, const char* fname);
+int capNextFrame(captureReader_t* cap);
+void capClose(captureReader_t* cap);
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * Host benchmark for the colorchord DFT32 engine.
+ *
+ * Pushes a synthetic tone through PushSample32() and PushSamples32(), checks
+ * that both leave the DFT in the same state, and reports samples per second for
+ * whatever OCTAVES and FIXBPERO this was compiled with. The Makefile builds and
+ * runs one binary per configuration.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "DFT32.h"
+
+#define BLOCK_SIZE     256
+#define NUM_SAMPLES    (DFREQ * 30)
+#define BASE_FREQ      55.0
+
+static int16_t samples[NUM_SAMPLES];
+static dft32_data ddSingle;
+static dft32_data ddBlock;
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Set up a DFT the same way embeddednf.c does
+ *
+ * @param dd The DFT to set up
+ */
+static void setupDft(dft32_data* dd)
+{
+    uint16_t fbins[FIXBPERO];
+    memset(dd, 0, sizeof(dft32_data));
+    SetupDFTProgressive32(dd);
+    for(int i = 0; i < FIXBPERO; i++)
+    {
+        double frq = pow(2, (double)i / (double)FIXBPERO) * BASE_FREQ;
+        fbins[i] = (65536.0) / (DFREQ) * frq * 16 + 0.5;
+    }
+    UpdateBins32(dd, fbins);
+}
+
+int main(void)
+{
+    // A couple of tones and a little noise, within the 13-bit input range
+    srand(1);
+    for(int i = 0; i < NUM_SAMPLES; i++)
+    {
+        double t = (double)i / DFREQ;
+        samples[i] = (int16_t)(1500 * sin(2 * M_PI * 440 * t) +
+                               1000 * sin(2 * M_PI * 659.25 * t) +
+                               (rand() % 512) - 256);
+    }
+
+    setupDft(&ddSingle);
+    setupDft(&ddBlock);
+
+    // One sample at a time
+    double tStart = nowS();
+    for(int i = 0; i < NUM_SAMPLES; i++)
+    {
+        PushSample32(&ddSingle, samples[i]);
+    }
+    double tSingle = nowS() - tStart;
+
+    // One block at a time, with an odd sized block in there to check the seams
+    tStart = nowS();
+    int pushed = 0;
+    while(pushed < NUM_SAMPLES)
+    {
+        int toPush = (0 == pushed) ? 77 : BLOCK_SIZE;
+        if(toPush > NUM_SAMPLES - pushed)
+        {
+            toPush = NUM_SAMPLES - pushed;
+        }
+        PushSamples32(&ddBlock, &samples[pushed], toPush);
+        pushed += toPush;
+    }
+    double tBlock = nowS() - tStart;
+
+    if(0 != memcmp(&ddSingle, &ddBlock, sizeof(dft32_data)))
+    {
+        fprintf(stderr, "OCTAVES=%d FIXBPERO=%d: PushSamples32() state does not match PushSample32()\n",
+                OCTAVES, FIXBPERO);
+        return 1;
+    }
+
+    printf("OCTAVES=%d FIXBPERO=%3d FIXBINS=%3d | single %10.0f samp/s | block %10.0f samp/s | %.2fx | %.1fx realtime @ %dHz\n",
+           OCTAVES, FIXBPERO, FIXBINS,
+           NUM_SAMPLES / tSingle,
+           NUM_SAMPLES / tBlock,
+           tSingle / tBlock,
+           (NUM_SAMPLES / tBlock) / DFREQ, DFREQ);
+    return 0;
+}
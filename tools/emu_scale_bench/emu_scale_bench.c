@@ -0,0 +1,156 @@
+/*
+ * Host benchmark for the emulator display scaler.
+ *
+ * Scales a random 280x240 palette indexed frame with emuScaleFrame(), checks
+ * whole multiples against the four nested loops the emulator used to have, and
+ * checks fractional sizes against a per-pixel nearest neighbor lookup. Then it
+ * reports milliseconds per frame for both the naive and new scalers at each
+ * scale factor.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "emu_scale.h"
+
+#define SRC_W 280
+#define SRC_H 240
+#define MAX_MULT 8
+
+// Scale factors in tenths, the fractional ones are what --scale-fit makes
+static const int scalesX10[] = {10, 15, 20, 25, 30, 33, 40, 60, 80};
+
+static uint8_t frame[SRC_W * SRC_H];
+static uint32_t palette[216];
+static uint32_t dstNaive[(SRC_W * MAX_MULT) * (SRC_H * MAX_MULT)];
+static uint32_t dstScaled[(SRC_W * MAX_MULT) * (SRC_H * MAX_MULT)];
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * The scaler the emulator used to have, one palette lookup per output pixel
+ * in four nested loops. Only works for whole multiples
+ *
+ * @param mult The multiplier
+ * @param dst The bitmap to scale into
+ */
+static void scaleNaiveMult(int mult, uint32_t* dst)
+{
+    for(int y = 0; y < SRC_H; y++)
+    {
+        for(int x = 0; x < SRC_W; x++)
+        {
+            for(int mY = 0; mY < mult; mY++)
+            {
+                for(int mX = 0; mX < mult; mX++)
+                {
+                    int dstX = ((x * mult) + mX);
+                    int dstY = ((y * mult) + mY);
+                    dst[(dstY * (SRC_W * mult)) + dstX] = palette[frame[(y * SRC_W) + x]];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Per-pixel nearest neighbor, for any size
+ *
+ * @param dstW The destination width
+ * @param dstH The destination height
+ * @param dst The bitmap to scale into
+ */
+static void scaleNaiveAny(int dstW, int dstH, uint32_t* dst)
+{
+    for(int dy = 0; dy < dstH; dy++)
+    {
+        for(int dx = 0; dx < dstW; dx++)
+        {
+            dst[(dy * dstW) + dx] = palette[frame[(((dy * SRC_H) / dstH) * SRC_W) + ((dx * SRC_W) / dstW)]];
+        }
+    }
+}
+
+int main(void)
+{
+    srand(1);
+    for(int i = 0; i < SRC_W * SRC_H; i++)
+    {
+        frame[i] = rand() % 216;
+    }
+    for(int i = 0; i < 216; i++)
+    {
+        palette[i] = ((uint32_t)rand() << 8) | 0xFF;
+    }
+
+    for(unsigned int s = 0; s < sizeof(scalesX10) / sizeof(scalesX10[0]); s++)
+    {
+        int dstW = (SRC_W * scalesX10[s]) / 10;
+        int dstH = (SRC_H * scalesX10[s]) / 10;
+        bool isWhole = (0 == (scalesX10[s] % 10));
+        int reps = (2000 * 10) / (scalesX10[s] * scalesX10[s] / 10 + 1);
+
+        emuScaler_t scaler;
+        emuScalerInit(&scaler, SRC_W, SRC_H, dstW, dstH);
+
+        // Check the output first
+        memset(dstNaive, 0, sizeof(dstNaive));
+        memset(dstScaled, 0, sizeof(dstScaled));
+        if(isWhole)
+        {
+            scaleNaiveMult(scalesX10[s] / 10, dstNaive);
+        }
+        else
+        {
+            scaleNaiveAny(dstW, dstH, dstNaive);
+        }
+        emuScaleFrame(&scaler, frame, palette, dstScaled);
+        if(0 != memcmp(dstNaive, dstScaled, dstW * dstH * sizeof(uint32_t)))
+        {
+            fprintf(stderr, "%d.%dx: emuScaleFrame() does not match the naive scaler\n",
+                    scalesX10[s] / 10, scalesX10[s] % 10);
+            return 1;
+        }
+
+        // Then time both
+        double tStart = nowS();
+        for(int r = 0; r < reps; r++)
+        {
+            if(isWhole)
+            {
+                scaleNaiveMult(scalesX10[s] / 10, dstNaive);
+            }
+            else
+            {
+                scaleNaiveAny(dstW, dstH, dstNaive);
+            }
+        }
+        double tNaive = (nowS() - tStart) / reps;
+
+        tStart = nowS();
+        for(int r = 0; r < reps; r++)
+        {
+            emuScaleFrame(&scaler, frame, palette, dstScaled);
+        }
+        double tScaled = (nowS() - tStart) / reps;
+
+        emuScalerDeinit(&scaler);
+
+        printf("%d.%dx %4dx%4d | naive %7.3f ms/frame | scaler %7.3f ms/frame | %.2fx\n",
+               scalesX10[s] / 10, scalesX10[s] % 10, dstW, dstH,
+               tNaive * 1000, tScaled * 1000, tNaive / tScaled);
+    }
+    return 0;
+}
@@ -0,0 +1,373 @@
+/*
+ * Host benchmark for the emulator's UDP ESP-NOW transport.
+ *
+ * Links emu/src/emu_wifi.c as-is, with the replay journal stubbed out. First
+ * it checks that packets from another MAC are delivered and that packets with
+ * a bad header, a bad length or our own MAC are dropped. Then it reports
+ * per-packet send cost, per-packet receive cost when draining bursts, and the
+ * cost of polling an empty socket, which the emulator does every loop.
+ *
+ * For comparison, the same receive measurements are made against the old
+ * transport: an ASCII header parsed with sscanf(), one recvfrom() per packet,
+ * a MAC lookup per packet, and a 10us SO_RCVTIMEO instead of a non-blocking
+ * socket.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "emu_replay.h"
+#include "esp_wifi.h"
+#include "espNowUtils.h"
+
+#define ESP_NOW_PORT    32888
+#define LEGACY_PORT     32889
+#define DATA_LEN        240
+#define BURST           64
+#define NUM_BURSTS      500
+#define NUM_SENDS       20000
+#define NUM_EMPTY_POLLS 2000
+
+static const uint8_t otherMac[6] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x55};
+
+static uint32_t rxPackets;
+static uint32_t txFailures;
+static uint32_t rxBytes;
+static uint8_t lastRxMac[6];
+static uint8_t lastRxData[256];
+
+//==============================================================================
+// Stubs for what emu_wifi.c links against
+//==============================================================================
+
+uint32_t esp_random(void)
+{
+    static uint32_t state = 0x1234567;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+bool emuIsRecording(void)
+{
+    return false;
+}
+
+bool emuIsReplaying(void)
+{
+    return false;
+}
+
+void emuRecord(emuReplayType_t type __attribute__((unused)), const void* data __attribute__((unused)),
+               uint32_t len __attribute__((unused)))
+{
+}
+
+int32_t emuReplayRead(emuReplayType_t type __attribute__((unused)), void* data __attribute__((unused)),
+                      uint32_t maxLen __attribute__((unused)))
+{
+    return -1;
+}
+
+//==============================================================================
+// Helpers
+//==============================================================================
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+static void benchRecvCb(const uint8_t* mac_addr, const char* data, uint8_t len, int8_t rssi __attribute__((unused)))
+{
+    rxPackets++;
+    rxBytes += len;
+    memcpy(lastRxMac, mac_addr, sizeof(lastRxMac));
+    memcpy(lastRxData, data, len);
+}
+
+static void benchSendCb(const uint8_t* mac_addr __attribute__((unused)), esp_now_send_status_t status)
+{
+    if(ESP_NOW_SEND_SUCCESS != status)
+    {
+        txFailures++;
+    }
+}
+
+/**
+ * Build a packet in the emulator's binary format
+ *
+ * @param packet Where to build the packet
+ * @param mac The sender's MAC
+ * @param data The data to send
+ * @param dataLen The length of the data
+ * @return The length of the packet
+ */
+static int buildBinaryPacket(uint8_t* packet, const uint8_t* mac, const uint8_t* data, uint8_t dataLen)
+{
+    memcpy(packet, "ENOW", 4);
+    packet[4] = 1;
+    memcpy(&packet[5], mac, 6);
+    packet[11] = dataLen;
+    memcpy(&packet[12], data, dataLen);
+    return 12 + dataLen;
+}
+
+/**
+ * Build a packet in the old ASCII format
+ *
+ * @param packet Where to build the packet
+ * @param mac The sender's MAC
+ * @param data The data to send
+ * @param dataLen The length of the data
+ * @return The length of the packet
+ */
+static int buildAsciiPacket(char* packet, const uint8_t* mac, const uint8_t* data, uint8_t dataLen)
+{
+    sprintf(packet, "ESP_NOW-%02X%02X%02X%02X%02X%02X-", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    int hdrLen = strlen(packet);
+    memcpy(&packet[hdrLen], data, dataLen);
+    return hdrLen + dataLen;
+}
+
+/**
+ * Make a UDP socket sending to a port on localhost
+ *
+ * @param port The port to send to
+ * @param dest Filled in with the destination address
+ * @return The socket
+ */
+static int makeSender(uint16_t port, struct sockaddr_in* dest)
+{
+    int fd = socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    memset(dest, 0, sizeof(*dest));
+    dest->sin_family = AF_INET;
+    dest->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    dest->sin_port = htons(port);
+    return fd;
+}
+
+/**
+ * Send a burst of packets which all fit in the receiver's socket buffer
+ */
+static void sendBurst(int fd, const struct sockaddr_in* dest, const void* packet, int len)
+{
+    for(int i = 0; i < BURST; i++)
+    {
+        sendto(fd, packet, len, 0, (const struct sockaddr*)dest, sizeof(*dest));
+    }
+}
+
+//==============================================================================
+// The old transport, for comparison
+//==============================================================================
+
+static int legacyFd;
+
+static void legacyInit(void)
+{
+    legacyFd = socket(PF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    int enable = 1;
+    setsockopt(legacyFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    struct timeval read_timeout = {.tv_sec = 0, .tv_usec = 10};
+    setsockopt(legacyFd, SOL_SOCKET, SO_RCVTIMEO, &read_timeout, sizeof(read_timeout));
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(LEGACY_PORT);
+    if(bind(legacyFd, (struct sockaddr*)&addr, sizeof(addr)) < 0)
+    {
+        perror("bind");
+        exit(1);
+    }
+}
+
+static void legacyCheckRxQueue(void)
+{
+    char recvString[1025];
+    int recvStringLen;
+    while((recvStringLen = recvfrom(legacyFd, recvString, 1024, 0, NULL, 0)) > 0)
+    {
+        uint8_t recvMac[6] = {0};
+        if(6 == sscanf(recvString, "ESP_NOW-%02hhX%02hhX%02hhX%02hhX%02hhX%02hhX-",
+                       &recvMac[0], &recvMac[1], &recvMac[2], &recvMac[3], &recvMac[4], &recvMac[5]))
+        {
+            uint8_t ourMac[6] = {0};
+            esp_wifi_get_mac(WIFI_IF_STA, ourMac);
+            if(0 != memcmp(recvMac, ourMac, sizeof(ourMac)))
+            {
+                benchRecvCb(recvMac, &recvString[21], recvStringLen - 21, 0);
+            }
+        }
+    }
+}
+
+//==============================================================================
+// Benchmark
+//==============================================================================
+
+/**
+ * Check that good packets get through and bad ones don't
+ *
+ * @return true if everything was delivered or dropped as expected
+ */
+static bool verify(int fd, const struct sockaddr_in* dest)
+{
+    uint8_t data[DATA_LEN];
+    uint8_t packet[300];
+    uint8_t ourMac[6];
+    esp_wifi_get_mac(WIFI_IF_STA, ourMac);
+    for(int i = 0; i < DATA_LEN; i++)
+    {
+        data[i] = i * 7;
+    }
+
+    // Drop anything left over from sending
+    checkEspNowRxQueue();
+    rxPackets = 0;
+
+    // A good packet
+    int len = buildBinaryPacket(packet, otherMac, data, DATA_LEN);
+    sendto(fd, packet, len, 0, (const struct sockaddr*)dest, sizeof(*dest));
+    // Truncated
+    sendto(fd, packet, len - 1, 0, (const struct sockaddr*)dest, sizeof(*dest));
+    // Wrong magic
+    packet[0] = 'X';
+    sendto(fd, packet, len, 0, (const struct sockaddr*)dest, sizeof(*dest));
+    // Our own MAC
+    len = buildBinaryPacket(packet, ourMac, data, DATA_LEN);
+    sendto(fd, packet, len, 0, (const struct sockaddr*)dest, sizeof(*dest));
+    // Too short for a header
+    sendto(fd, packet, 5, 0, (const struct sockaddr*)dest, sizeof(*dest));
+
+    usleep(10000);
+    checkEspNowRxQueue();
+
+    return (1 == rxPackets) && (0 == memcmp(lastRxMac, otherMac, 6)) && (0 == memcmp(lastRxData, data, DATA_LEN));
+}
+
+/**
+ * Time draining bursts of packets
+ *
+ * @param fd The socket to send from
+ * @param dest Where to send the packets
+ * @param packet The packet to send
+ * @param len The length of the packet
+ * @param checkFn The function which drains the receiver
+ * @return The time per packet, in nanoseconds, or -1 if packets went missing
+ */
+static double timeDrain(int fd, const struct sockaddr_in* dest, const void* packet, int len, void (*checkFn)(void))
+{
+    double total = 0;
+    rxPackets = 0;
+    for(int b = 0; b < NUM_BURSTS; b++)
+    {
+        sendBurst(fd, dest, packet, len);
+        double start = nowS();
+        checkFn();
+        total += nowS() - start;
+    }
+    if(NUM_BURSTS * BURST != rxPackets)
+    {
+        printf("  only received %u of %u packets\n", rxPackets, NUM_BURSTS * BURST);
+        return -1;
+    }
+    return (total * 1e9) / (NUM_BURSTS * BURST);
+}
+
+/**
+ * Time polling the receiver when nothing is there
+ *
+ * @param checkFn The function which drains the receiver
+ * @return The time per poll, in nanoseconds
+ */
+static double timeEmptyPoll(void (*checkFn)(void))
+{
+    double start = nowS();
+    for(int i = 0; i < NUM_EMPTY_POLLS; i++)
+    {
+        checkFn();
+    }
+    return ((nowS() - start) * 1e9) / NUM_EMPTY_POLLS;
+}
+
+int main(void)
+{
+    espNowInit(benchRecvCb, benchSendCb);
+    legacyInit();
+
+    struct sockaddr_in dest, legacyDest;
+    int fd = makeSender(ESP_NOW_PORT, &dest);
+    int legacyTx = makeSender(LEGACY_PORT, &legacyDest);
+
+    // Sending only works if there is a route for broadcasts
+    uint8_t data[DATA_LEN] = {0};
+    double sendNs = -1;
+    espNowSend((const char*)data, DATA_LEN);
+    if(0 == txFailures)
+    {
+        double start = nowS();
+        for(int i = 0; i < NUM_SENDS; i++)
+        {
+            espNowSend((const char*)data, DATA_LEN);
+            // Don't let our own packets fill the socket buffer
+            if(0 == (i % BURST))
+            {
+                checkEspNowRxQueue();
+            }
+        }
+        sendNs = ((nowS() - start) * 1e9) / NUM_SENDS;
+    }
+    else
+    {
+        printf("Broadcasts can't be sent here, skipping the send benchmark\n");
+    }
+
+    if(!verify(fd, &dest))
+    {
+        printf("FAIL: packets were not delivered or dropped as expected\n");
+        return 1;
+    }
+    printf("Verified delivery and header checks\n\n");
+
+    uint8_t packet[300];
+    char asciiPacket[300];
+    int len = buildBinaryPacket(packet, otherMac, data, DATA_LEN);
+    int asciiLen = buildAsciiPacket(asciiPacket, otherMac, data, DATA_LEN);
+
+    double binNs = timeDrain(fd, &dest, packet, len, checkEspNowRxQueue);
+    double asciiNs = timeDrain(legacyTx, &legacyDest, asciiPacket, asciiLen, legacyCheckRxQueue);
+    double binEmptyNs = timeEmptyPoll(checkEspNowRxQueue);
+    double asciiEmptyNs = timeEmptyPoll(legacyCheckRxQueue);
+
+    printf("%d byte packets, drained in bursts of %d\n", DATA_LEN, BURST);
+    printf("                  %12s %12s\n", "old", "new");
+    if(sendNs >= 0)
+    {
+        printf("send     ns/pkt   %12s %12.0f\n", "-", sendNs);
+    }
+    printf("receive  ns/pkt   %12.0f %12.0f\n", asciiNs, binNs);
+    printf("receive  pkt/s    %12.0f %12.0f\n", 1e9 / asciiNs, 1e9 / binNs);
+    printf("empty poll ns     %12.0f %12.0f\n", asciiEmptyNs, binEmptyNs);
+
+    espNowDeinit();
+    close(fd);
+    close(legacyTx);
+    close(legacyFd);
+    return 0;
+}
@@ -0,0 +1,412 @@
+/*
+ * Host benchmark for fonts.
+ *
+ * Runs spiffs_file_preprocessor on assets/ into a temporary folder, then loads
+ * every font out of the mapped asset pack. Each font is also rebuilt in the
+ * one bit per pixel format fonts used to be, and loaded and drawn the way they
+ * used to be. A frame of text is drawn both ways, hanging off the left, right
+ * and bottom edges, and the frames must match. The old drawChar() drew chars
+ * hanging off the top edge to the wrong rows, so those are checked against the
+ * same frame shifted up instead.
+ *
+ * Then it reports the time to load and free each font, and to draw a frame of
+ * text, each way. The old way loads from a copy of the file already in RAM, so
+ * it doesn't pay for looking the file up.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+
+#include "display.h"
+#include "spiffs_manager.h"
+
+#define PREPROCESSOR "spiffs_file_preprocessor/spiffs_file_preprocessor"
+#define PACK_FILE    "spiffs_image.pack"
+#define LOAD_PASSES  20000
+#define DRAW_PASSES  200
+#define FRAME_W      280
+#define FRAME_H      240
+
+typedef struct
+{
+    uint8_t w;
+    uint8_t* bitmap;
+} oldFontCh_t;
+
+typedef struct
+{
+    uint8_t h;
+    oldFontCh_t chars[FONT_NUM_CHARS];
+} oldFont_t;
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Rebuild a font in the old format, the height, then each char's width and
+ * one bit per pixel bitmap
+ *
+ * @param font The font to rebuild
+ * @param size Returns the size of the old font
+ * @return The old font, which must be freed
+ */
+static uint8_t* makeOldFont(const font_t* font, size_t* size)
+{
+    uint8_t* old = calloc(1 + (FONT_NUM_CHARS * (1 + ((font->h * 255) / 8) + 1)), 1);
+    size_t idx = 0;
+    old[idx++] = font->h;
+    for(int ch = 0; ch < FONT_NUM_CHARS; ch++)
+    {
+        const font_ch_t* this = &font->chars[ch];
+        old[idx++] = this->w;
+        const uint8_t* row = this->rows;
+        for(int y = 0; y < font->h; y++)
+        {
+            uint8_t runs = *(row++);
+            for(; runs; runs--, row += 2)
+            {
+                for(int x = row[0]; x < row[0] + row[1]; x++)
+                {
+                    int bit = (y * this->w) + x;
+                    old[idx + (bit / 8)] |= (1 << (bit % 8));
+                }
+            }
+        }
+        int pixels = font->h * this->w;
+        idx += (pixels / 8) + ((pixels % 8 == 0) ? 0 : 1);
+    }
+    *size = idx;
+    return old;
+}
+
+/**
+ * Load a font the way loadFont() used to, after mapping the file
+ */
+static void oldLoadFont(const uint8_t* buf, oldFont_t* font)
+{
+    size_t bufIdx = 0;
+
+    // Read the data into a font struct
+    font->h = buf[bufIdx++];
+
+    // Read each char
+    for(char ch = ' '; ch <= '~'; ch++)
+    {
+        // Get an easy refence to this character
+        oldFontCh_t* this = &font->chars[ch - ' '];
+
+        // Read the width
+        this->w = buf[bufIdx++];
+
+        // Figure out what size the char is
+        int pixels = font->h * this->w;
+        int bytes = (pixels / 8) + ((pixels % 8 == 0) ? 0 : 1);
+
+        // Allocate space for this char and copy it over. The old drawChar()
+        // reads one byte past the end of the bitmap, so pad it here
+        this->bitmap = (uint8_t*) calloc(bytes + 1, sizeof(uint8_t));
+        memcpy(this->bitmap, &buf[bufIdx], bytes);
+        bufIdx += bytes;
+    }
+}
+
+/**
+ * Free a font the way freeFont() used to
+ */
+static void oldFreeFont(oldFont_t* font)
+{
+    for(char ch = ' '; ch <= '~'; ch++)
+    {
+        free(font->chars[ch - ' '].bitmap);
+    }
+}
+
+/**
+ * Draw a char the way drawChar() used to, unpacking bits
+ */
+static void oldDrawChar(display_t* disp, paletteColor_t color, int h, oldFontCh_t* ch, int16_t xOff, int16_t yOff)
+{
+    paletteColor_t* pxOutput = disp->pxFb + yOff * disp->w;
+
+    int bitIdx = 0;
+    uint8_t* bitmap = ch->bitmap;
+    int wch = ch->w;
+
+    // Don't draw off the bottom of the screen.
+    if( yOff + h > disp->h )
+    {
+        h = disp->h - yOff;
+    }
+
+    // Check Y bounds
+    if(yOff < 0)
+    {
+        // Above the display, do wacky math with -yOff
+        bitIdx -= yOff * wch;
+        bitmap += bitIdx >> 3;
+        bitIdx &= 7;
+        h += yOff;
+        yOff = 0;
+    }
+
+    for (int y = 0; y < h; y++)
+    {
+        // Figure out where to draw
+        int truncate = 0;
+
+        int startX = xOff;
+        if( xOff < 0 )
+        {
+            // Track how many groups of pixels we are skipping over
+            // that weren't displayed on the left of the screen.
+            startX = 0;
+            bitIdx += -xOff;
+            bitmap += bitIdx >> 3;
+            bitIdx &= 7;
+        }
+        int endX = xOff + wch;
+        if( endX > disp->w )
+        {
+            // Track how many groups of pixels we are skipping over,
+            // if the letter falls off the end of the screen.
+            truncate = endX - disp->w;
+            endX = disp->w;
+        }
+
+        uint8_t thisByte = *bitmap;
+        for (int drawX = startX; drawX < endX; drawX++)
+        {
+            // Figure out where to draw
+            // Check X bounds
+            if(thisByte & (1 << bitIdx))
+            {
+                // Draw the pixel
+                pxOutput[drawX] = color;
+            }
+
+            // Iterate over the bit data
+            if( 8 == ++bitIdx )
+            {
+                bitIdx = 0;
+                thisByte = *(++bitmap);
+            }
+        }
+
+        // Handle any remaining bits if we have ended off the end of the display.
+        bitIdx += truncate;
+        bitmap += bitIdx >> 3;
+        bitIdx &= 7;
+        pxOutput += disp->w;
+    }
+}
+
+/**
+ * Draw text the way drawText() used to
+ */
+static int16_t oldDrawText(display_t* disp, oldFont_t* font, paletteColor_t color, const char* text, int16_t xOff,
+                           int16_t yOff)
+{
+    while(*text >= ' ')
+    {
+        // Only draw if the char is on the screen
+        if (xOff + font->chars[(*text) - ' '].w >= 0)
+        {
+            // Draw char
+            oldDrawChar(disp, color, font->h, &font->chars[(*text) - ' '], xOff, yOff);
+        }
+
+        // Move to the next char
+        xOff += (font->chars[(*text) - ' '].w + 1);
+        text++;
+
+        // If this char is offscreen, finish drawing
+        if(xOff >= disp->w)
+        {
+            return xOff;
+        }
+    }
+    return xOff;
+}
+
+/**
+ * Draw a frame of text, every char, starting off the left and running off the
+ * right and bottom
+ *
+ * @param disp The display to draw to
+ * @param font The font, or NULL to use oldFont
+ * @param oldFont The old font, if font is NULL
+ * @param yOff The first line's y, negative to start off the top
+ */
+static void drawFrame(display_t* disp, font_t* font, oldFont_t* oldFont, int16_t yOff)
+{
+    static char text[FONT_NUM_CHARS + 1];
+    for(int ch = 0; ch < FONT_NUM_CHARS; ch++)
+    {
+        text[ch] = ' ' + ((ch * 7) % FONT_NUM_CHARS);
+    }
+    int h = font ? font->h : oldFont->h;
+    int line = 0;
+    for(int16_t y = yOff; y < FRAME_H; y += h + 1, line++)
+    {
+        int16_t x = -((line * 5) % 13);
+        if(font)
+        {
+            drawText(disp, font, c555, &text[line % 20], x, y);
+        }
+        else
+        {
+            oldDrawText(disp, oldFont, c555, &text[line % 20], x, y);
+        }
+    }
+}
+
+int main(void)
+{
+    // Run the preprocessor from the repository root, into a temporary folder
+    char root[PATH_MAX];
+    char tmpDir[] = "/tmp/font_benchXXXXXX";
+    if(NULL == realpath("../..", root) || NULL == mkdtemp(tmpDir))
+    {
+        printf("Couldn't make a temporary folder\n");
+        return 1;
+    }
+    char cmd[PATH_MAX * 3];
+    snprintf(cmd, sizeof(cmd), "%s/%s -i %s/assets -o %s/spiffs_image > /dev/null", root, PREPROCESSOR, root, tmpDir);
+    if(0 != system(cmd) || 0 != chdir(tmpDir))
+    {
+        printf("Couldn't run %s\n", cmd);
+        return 1;
+    }
+    initSpiffs();
+
+    paletteColor_t* newPx = calloc(FRAME_W * FRAME_H, sizeof(paletteColor_t));
+    paletteColor_t* oldPx = calloc(FRAME_W * FRAME_H, sizeof(paletteColor_t));
+    display_t newDisp = {.w = FRAME_W, .h = FRAME_H, .pxFb = newPx};
+    display_t oldDisp = {.w = FRAME_W, .h = FRAME_H, .pxFb = oldPx};
+
+    printf("  %-28s %8s %8s %10s %10s %10s %10s\n", "", "old B", "new B", "old load", "new load", "old draw", "new draw");
+    bool ok = true;
+    uint32_t numFonts = 0;
+    DIR* dir = opendir("spiffs_image");
+    struct dirent* ent;
+    while(NULL != dir && NULL != (ent = readdir(dir)))
+    {
+        const char* ext = strrchr(ent->d_name, '.');
+        if(NULL == ext || 0 != strcmp(ext, ".font"))
+        {
+            continue;
+        }
+        numFonts++;
+
+        font_t font;
+        const uint8_t* file = NULL;
+        size_t newSize;
+        if(!loadFont(ent->d_name, &font) || !spiffsMapFile(ent->d_name, &file, &newSize))
+        {
+            printf("FAIL: couldn't load %s\n", ent->d_name);
+            ok = false;
+            continue;
+        }
+        spiffsUnmapFile(file);
+        size_t oldSize;
+        uint8_t* oldFile = makeOldFont(&font, &oldSize);
+        oldFont_t oldFont;
+        oldLoadFont(oldFile, &oldFont);
+
+        // Both ways must draw the same pixels
+        memset(newPx, c000, FRAME_W * FRAME_H);
+        memset(oldPx, c000, FRAME_W * FRAME_H);
+        drawFrame(&newDisp, &font, NULL, 0);
+        drawFrame(&oldDisp, NULL, &oldFont, 0);
+        if(0 != memcmp(newPx, oldPx, FRAME_W * FRAME_H))
+        {
+            printf("FAIL: %s draws differently\n", ent->d_name);
+            ok = false;
+        }
+
+        // Off the top edge, the frame must just be shifted up
+        int16_t shift = (font.h / 2) + 1;
+        memset(oldPx, c000, FRAME_W * FRAME_H);
+        drawFrame(&oldDisp, &font, NULL, -shift);
+        if(0 != memcmp(&newPx[shift * FRAME_W], oldPx, (FRAME_H - shift - font.h) * FRAME_W))
+        {
+            printf("FAIL: %s draws differently off the top\n", ent->d_name);
+            ok = false;
+        }
+        freeFont(&font);
+        oldFreeFont(&oldFont);
+
+        // Time loading and freeing
+        double start = nowS();
+        for(uint32_t p = 0; p < LOAD_PASSES; p++)
+        {
+            oldLoadFont(oldFile, &oldFont);
+            oldFreeFont(&oldFont);
+        }
+        double oldLoadS = nowS() - start;
+        start = nowS();
+        for(uint32_t p = 0; p < LOAD_PASSES; p++)
+        {
+            loadFont(ent->d_name, &font);
+            freeFont(&font);
+        }
+        double newLoadS = nowS() - start;
+
+        // Time drawing a frame of text
+        oldLoadFont(oldFile, &oldFont);
+        loadFont(ent->d_name, &font);
+        start = nowS();
+        for(uint32_t p = 0; p < DRAW_PASSES; p++)
+        {
+            drawFrame(&oldDisp, NULL, &oldFont, 0);
+        }
+        double oldDrawS = nowS() - start;
+        start = nowS();
+        for(uint32_t p = 0; p < DRAW_PASSES; p++)
+        {
+            drawFrame(&newDisp, &font, NULL, 0);
+        }
+        double newDrawS = nowS() - start;
+        oldFreeFont(&oldFont);
+        freeFont(&font);
+        free(oldFile);
+
+        printf("  %-28s %8u %8u %8.2fus %8.2fus %8.1fus %8.1fus\n", ent->d_name, (uint32_t)oldSize, (uint32_t)newSize,
+               oldLoadS * 1000000 / LOAD_PASSES, newLoadS * 1000000 / LOAD_PASSES,
+               oldDrawS * 1000000 / DRAW_PASSES, newDrawS * 1000000 / DRAW_PASSES);
+    }
+    if(NULL != dir)
+    {
+        closedir(dir);
+    }
+    deinitSpiffs();
+    free(newPx);
+    free(oldPx);
+    if(0 == numFonts)
+    {
+        printf("FAIL: no fonts were built\n");
+        ok = false;
+    }
+
+    // Clean up
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", tmpDir);
+    if(0 != chdir("/") || 0 != system(cmd))
+    {
+        printf("Couldn't remove %s\n", tmpDir);
+    }
+    return ok ? 0 : 1;
+}
@@ -120,6 +120,341 @@ void Write16s( int16_t s )
 }
 
 
+//Models are emitted with up to this many levels of detail, the first is the whole model.
+#define MAXLODS 3
+
+//A simpler LOD is only kept if it has at most this percent of the last kept LOD's vertices.
+#define LODKEEPPERCENT 70
+
+//Pixels one unit spans at a depth of one unit, see Perspective() in mode_flight.c, how far a
+//simplified vertex may be drawn from where it belongs and the far plane.
+#define LODSCREENSCALE 150
+#define LODMAXERRORPX 1
+#define LODMAXDEPTH 8192
+
+//Faces are ordered to reuse the vertices of the last few, like a FIFO vertex cache this size.
+#define VCACHESIZE 8
+
+typedef struct
+{
+    int nverts;
+    int16_t * verts; //x, y, z per vertex
+    int nfaces;
+    int * faces;     //2 or 3 vertex indices per face
+} mesh_t;
+
+int outfaces[MAXLODS];
+int outverts[MAXLODS];
+
+static const int * sortkeys;
+static int sortkeylen;
+
+int KeyCmp( const void * va, const void * vb )
+{
+    int ia = *(const int*)va;
+    int ib = *(const int*)vb;
+    const int * a = &sortkeys[ia * sortkeylen];
+    const int * b = &sortkeys[ib * sortkeylen];
+    int i;
+    for( i = 0; i < sortkeylen; i++ )
+    {
+        if( a[i] != b[i] ) return ( a[i] < b[i] ) ? -1 : 1;
+    }
+    return ia - ib;
+}
+
+//Returns 0..n-1 sorted so the ones with equal keys are next to each other.
+int * SortByKey( const int * keys, int keylen, int n )
+{
+    int * order = malloc( sizeof(int) * ( ( n > 0 ) ? n : 1 ) );
+    int i;
+    for( i = 0; i < n; i++ ) order[i] = i;
+    sortkeys = keys;
+    sortkeylen = keylen;
+    qsort( order, n, sizeof(int), KeyCmp );
+    return order;
+}
+
+int FloorDiv( int a, int b )
+{
+    return ( a >= 0 ) ? ( a / b ) : -( ( b - 1 - a ) / b );
+}
+
+void FreeMesh( mesh_t * m )
+{
+    free( m->verts );
+    free( m->faces );
+}
+
+//Welds every vertex in the same cell of a grid into one, at their average, then drops the faces
+//that collapsed or are now the same as another. A cell of 1 only welds identical vertices.
+void SimplifyMesh( const mesh_t * in, mesh_t * out, int stride, int cell )
+{
+    int n = in->nverts;
+    size_t alloc = ( n > 0 ) ? n : 1;
+    int i, j, k;
+    int * keys = malloc( sizeof(int) * 3 * alloc );
+    int * remap = malloc( sizeof(int) * alloc );
+    for( i = 0; i < n * 3; i++ )
+        keys[i] = FloorDiv( in->verts[i], cell );
+    int * order = SortByKey( keys, 3, n );
+
+    out->verts = malloc( sizeof(int16_t) * 3 * alloc );
+    out->nverts = 0;
+    for( i = 0; i < n; i = j )
+    {
+        int sum[3] = { 0, 0, 0 };
+        for( j = i; j < n && memcmp( &keys[order[j]*3], &keys[order[i]*3], sizeof(int) * 3 ) == 0; j++ )
+        {
+            for( k = 0; k < 3; k++ ) sum[k] += in->verts[order[j]*3+k];
+            remap[order[j]] = out->nverts;
+        }
+        for( k = 0; k < 3; k++ ) out->verts[out->nverts*3+k] = lround( sum[k] / (double)( j - i ) );
+        out->nverts++;
+    }
+    free( order );
+
+    //Start each face at its lowest vertex so the same face always looks the same. Triangles keep
+    //their winding, it's used for backface culling.
+    int * faces = malloc( sizeof(int) * stride * (in->nfaces ? in->nfaces : 1) );
+    int nf = 0;
+    for( i = 0; i < in->nfaces; i++ )
+    {
+        int v[3] = { 0, 0, 0 };
+        int first = 0;
+        for( k = 0; k < stride; k++ ) v[k] = remap[in->faces[i*stride+k]];
+        if( v[0] == v[1] || ( stride == 3 && ( v[1] == v[2] || v[0] == v[2] ) ) ) continue;
+        for( k = 1; k < stride; k++ )
+            if( v[k] < v[first] ) first = k;
+        for( k = 0; k < stride; k++ ) faces[nf*stride+k] = v[(first+k)%stride];
+        nf++;
+    }
+    free( remap );
+    free( keys );
+
+    order = SortByKey( faces, stride, nf );
+    out->faces = malloc( sizeof(int) * stride * (nf ? nf : 1) );
+    out->nfaces = 0;
+    for( i = 0; i < nf; i++ )
+    {
+        if( i && memcmp( &faces[order[i]*stride], &faces[order[i-1]*stride], sizeof(int) * stride ) == 0 ) continue;
+        memcpy( &out->faces[out->nfaces*stride], &faces[order[i]*stride], sizeof(int) * stride );
+        out->nfaces++;
+    }
+    free( order );
+    free( faces );
+}
+
+int InCache( const int * cache, int v )
+{
+    int c;
+    for( c = 0; c < VCACHESIZE; c++ )
+        if( cache[c] == v ) return 1;
+    return 0;
+}
+
+//Orders the faces so each reuses as many of the last few faces' vertices as it can, then numbers
+//the vertices in the order they're first used and drops unused ones. Neighboring faces then read
+//neighboring transformed vertices, and line models come out as chains.
+void CacheOrderMesh( mesh_t * m, int stride )
+{
+    int nf = m->nfaces;
+    int i, k, c;
+
+    //Which faces use each vertex
+    int * start = calloc( m->nverts + 1, sizeof(int) );
+    int * fill = malloc( sizeof(int) * (m->nverts + 1) );
+    int * adj = malloc( sizeof(int) * stride * (nf ? nf : 1) );
+    for( i = 0; i < nf * stride; i++ ) start[m->faces[i]+1]++;
+    for( i = 0; i < m->nverts; i++ ) start[i+1] += start[i];
+    memcpy( fill, start, sizeof(int) * (m->nverts + 1) );
+    for( i = 0; i < nf * stride; i++ ) adj[fill[m->faces[i]]++] = i / stride;
+
+    int * emitted = calloc( nf ? nf : 1, sizeof(int) );
+    int * ordered = malloc( sizeof(int) * stride * (nf ? nf : 1) );
+    int cache[VCACHESIZE];
+    int next = 0;
+    for( c = 0; c < VCACHESIZE; c++ ) cache[c] = -1;
+    for( i = 0; i < nf; i++ )
+    {
+        int best = -1;
+        int bestscore = 0;
+        for( c = 0; c < VCACHESIZE; c++ )
+        {
+            if( cache[c] < 0 ) continue;
+            int a;
+            for( a = start[cache[c]]; a < start[cache[c]+1]; a++ )
+            {
+                int f = adj[a];
+                if( emitted[f] ) continue;
+                int score = 0;
+                for( k = 0; k < stride; k++ ) score += InCache( cache, m->faces[f*stride+k] );
+                if( score > bestscore || ( score == bestscore && f < best ) )
+                {
+                    best = f;
+                    bestscore = score;
+                }
+            }
+        }
+        if( best < 0 )
+        {
+            //Nothing cached helps, start somewhere new
+            while( emitted[next] ) next++;
+            best = next;
+        }
+        emitted[best] = 1;
+        for( k = 0; k < stride; k++ )
+        {
+            int v = m->faces[best*stride+k];
+            ordered[i*stride+k] = v;
+            if( !InCache( cache, v ) )
+            {
+                memmove( cache + 1, cache, sizeof(int) * ( VCACHESIZE - 1 ) );
+                cache[0] = v;
+            }
+        }
+    }
+
+    int * newidx = malloc( sizeof(int) * (m->nverts ? m->nverts : 1) );
+    int16_t * verts = malloc( sizeof(int16_t) * 3 * (m->nverts ? m->nverts : 1) );
+    int nv = 0;
+    for( i = 0; i < m->nverts; i++ ) newidx[i] = -1;
+    for( i = 0; i < nf * stride; i++ )
+    {
+        int v = ordered[i];
+        if( newidx[v] < 0 )
+        {
+            memcpy( &verts[nv*3], &m->verts[v*3], sizeof(int16_t) * 3 );
+            newidx[v] = nv++;
+        }
+        ordered[i] = newidx[v];
+    }
+
+    FreeMesh( m );
+    m->verts = verts;
+    m->nverts = nv;
+    m->faces = ordered;
+    free( newidx );
+    free( emitted );
+    free( adj );
+    free( fill );
+    free( start );
+}
+
+//Emits one model: its header, then each LOD from the whole model to the simplest. Each LOD is
+//the depth it's drawn from, its number of vertex ints and faces, then its indices (premultiplied
+//by 3) and its vertices.
+void EmitGroup( int g, int stride, int label, int * absmin, int * absmax )
+{
+    const int * indexset = ( stride == 3 ) ? tindexset : lindexset;
+    const int * ispartof = ( stride == 3 ) ? tispartof : lispartof;
+    int icount = ( stride == 3 ) ? ticount : licount;
+    int i, j, k;
+
+    //Gather this group's faces and the vertices they use
+    mesh_t full = { 0, malloc( sizeof(int16_t) * 3 * (vcount ? vcount : 1) ), 0, malloc( sizeof(int) * (icount ? icount : 1) ) };
+    memset( tempv, 0, sizeof( tempv ) );
+    for( j = 0; j < icount; j += stride )
+    {
+        if( ispartof[j] != g ) continue;
+        for( k = 0; k < stride; k++ )
+        {
+            int v = indexset[j+k];
+            if( !tempv[v] )
+            {
+                tempv[v] = 1;
+                temp[v] = full.nverts;
+                memcpy( &full.verts[full.nverts*3], &vertices[v*3], sizeof(int16_t) * 3 );
+                full.nverts++;
+            }
+            full.faces[full.nfaces*stride+k] = temp[v];
+        }
+        full.nfaces++;
+    }
+
+    mesh_t lods[MAXLODS];
+    int mindepth[MAXLODS];
+    int nlods = 1;
+    SimplifyMesh( &full, &lods[0], stride, 1 );
+    CacheOrderMesh( &lods[0], stride );
+    mindepth[0] = 0;
+
+    //Each simpler LOD is drawn once its vertices are at most LODMAXERRORPX off
+    int cell;
+    for( cell = 2; nlods < MAXLODS && LODSCREENSCALE * cell / LODMAXERRORPX <= LODMAXDEPTH; cell *= 2 )
+    {
+        mesh_t lod;
+        SimplifyMesh( &full, &lod, stride, cell );
+        CacheOrderMesh( &lod, stride );
+        if( lod.nfaces == 0 )
+        {
+            FreeMesh( &lod );
+            break;
+        }
+        if( lod.nverts * 100 > lods[nlods-1].nverts * LODKEEPPERCENT )
+        {
+            FreeMesh( &lod );
+            continue;
+        }
+        mindepth[nlods] = LODSCREENSCALE * cell / LODMAXERRORPX;
+        lods[nlods++] = lod;
+    }
+    FreeMesh( &full );
+
+    int min[3] = { 32767, 32767, 32767 };
+    int max[3] = { -32768, -32768, -32768 };
+    for( i = 0; i < lods[0].nverts; i++ )
+    {
+        for( k = 0; k < 3; k++ )
+        {
+            int c = lods[0].verts[i*3+k];
+            if( c < min[k] ) min[k] = c;
+            if( c > max[k] ) max[k] = c;
+        }
+    }
+    int center[3];
+    for( k = 0; k < 3; k++ )
+    {
+        center[k] = (max[k]+min[k])/2;
+        if( min[k] < absmin[k] ) absmin[k] = min[k];
+        if( max[k] > absmax[k] ) absmax[k] = max[k];
+    }
+    int radius = 0;
+    for( i = 0; i < lods[0].nverts; i++ )
+    {
+        int dx = lods[0].verts[i*3+0] - center[0];
+        int dy = lods[0].verts[i*3+1] - center[1];
+        int dz = lods[0].verts[i*3+2] - center[2];
+        int r = sqrt( (dx * dx + dy * dy + dz * dz) );
+        if( r > radius ) radius = r;
+    }
+
+    Write16u( stride ); //3 = triangles, 2 = lines.
+    Write16s( center[0] );
+    Write16s( center[1] );
+    Write16s( center[2] );
+    Write16u( radius );
+    Write16u( label );
+    Write16u( nlods );
+
+    for( i = 0; i < nlods; i++ )
+    {
+        mesh_t * m = &lods[i];
+        Write16u( mindepth[i] );
+        Write16u( m->nverts*3 ); //# of vertx ints count
+        Write16u( m->nfaces );
+        for( j = 0; j < m->nfaces * stride; j++ )
+            Write16u( m->faces[j]*3 );
+        for( j = 0; j < m->nverts * 3; j++ )
+            Write16s( m->verts[j] );
+        fprintf( stderr, "Group %d LOD %d: %d faces, %d vertices from depth %d\n", g-1, i, m->nfaces, m->nverts, mindepth[i] );
+        outfaces[i] += m->nfaces;
+        outverts[i] += m->nverts;
+        FreeMesh( m );
+    }
+}
+
+
 int main( int argc, char ** argv )
 {
     int i;
@@ -431,236 +766,18 @@ int main( int argc, char ** argv )
         fprintf( stderr, "Wrote checkfile\n" );
     }
 
-    int absminx = 1000000;
-    int absminy = 1000000;
-    int absminz = 1000000;
-    int absmaxx = -1000000;
-    int absmaxy = -1000000;
-    int absmaxz = -1000000;
+    int absmin[3] = { 1000000, 1000000, 1000000 };
+    int absmax[3] = { -1000000, -1000000, -1000000 };
 
     Write16u( 'i' | ('m'<<8) );
     Write16u( 'd' | ('l'<<8) );
     Write16u( groupno );
 
-
-    if( lineify )
     {
-        int outverts = 0;
-        int outtris = 0;
-        int comptotal __attribute__((unused)) = 0;
         int g;
         for( g = 1; g <= groupno; g++ )
         {
             int j;
-            int lvindex = 0;
-            memset( tempv, 0, sizeof( tempv ) );
-            for( j = 0; j < licount; j += 2 )
-            {
-                if( lispartof[j] == g ) 
-                {
-                    tempv[tindexset[j+0]] = 1;
-                    tempv[tindexset[j+1]] = 1;
-                }
-            }
-            int minx = 32767;
-            int miny = 32767;
-            int minz = 32767;
-            int maxx = -32768;
-            int maxy = -32768;
-            int maxz = -32768;
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] )
-                {
-                    int x = vertices[j*3+0];
-                    int y = vertices[j*3+1];
-                    int z = vertices[j*3+2];
-                    if( x < minx ) minx = x;
-                    if( y < miny ) miny = y;
-                    if( z < minz ) minz = z;
-                    if( x > maxx ) maxx = x;
-                    if( y > maxy ) maxy = y;
-                    if( z > maxz ) maxz = z;
-                    temp[j] = lvindex++;
-                }
-            }
-            if( minx < absminx ) absminx = minx;
-            if( miny < absminy ) absminy = miny;
-            if( minz < absminz ) absminz = minz;
-            if( maxx > absmaxx ) absmaxx = maxx;
-            if( maxy > absmaxy ) absmaxy = maxy;
-            if( maxz > absmaxz ) absmaxz = maxz;
-
-            int centerx = (maxx-minx)/2;
-            int centery = (maxy-miny)/2;
-            int centerz = (maxz-minz)/2;
-            int radius = 0;
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] )
-                {
-                    int x = vertices[j*3+0]*FIXEDSCALE;
-                    int y = vertices[j*3+1]*FIXEDSCALE;
-                    int z = vertices[j*3+2]*FIXEDSCALE;
-                    int dx = x - centerx;
-                    int dy = y - centery;
-                    int dz = z - centerz;
-                    int r = sqrt( (dx * dx + dy * dy + dz * dz) / ( FIXEDSCALE * FIXEDSCALE ) );
-                    if( r > radius ) radius = r;
-                }
-            }
-
-            int faces = 0;
-            for( j = 0; j < licount; j += 2 )
-            {
-                if( lispartof[j] == g )
-                    faces++;
-            }
-
-            int stride = 2;
-            Write16u( lvindex*stride ); //# of vertx ints count
-            Write16u( faces );
-            Write16u( 2 ); //3 = triangles. NOTE: MSB is 0 or version.
-            Write16s( centerx );
-            Write16s( centery );
-            Write16s( centerz );
-            Write16u( radius );
-            Write16u( grouptags[g] );
-
-            fprintf( stderr, "Group %d: %d/%d  (%d,%d,%d) %d\n", g-1, lvindex*stride, faces, centerx, centery, centerz, radius );
-
-            uint16_t storebuffer[lvindex*3+faces*3];
-            int storebufferid = 0;
-
-
-            for( j = 0; j < ticount; j += 2 )
-            {
-                if( lispartof[j] == g )
-                {
-                    Write16u( storebuffer[storebufferid++] = temp[tindexset[j+0]]*stride );
-                    Write16u( storebuffer[storebufferid++] = temp[tindexset[j+1]]*stride );
-                    outtris ++;
-                }
-            }
-
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] )
-                {
-                    Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+0]) );
-                    Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+1]) );
-                    Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+2]) );
-                    outverts++;
-                }
-            }
-
-            //Consider: Decompress the descriptors in RAM, and then decompress the needed models, as-needed.
-            //uint8_t * compoutput = alloca(lvindex*4+faces*4+66);
-            //int comp = fastlz_compress_level( 2, storebuffer, storebufferid * 2, compoutput);
-            //comptotal += comp;
-        }
-        fprintf( stderr, "Emitted %d groups, %d indices, %d vertices\n", groupno, outtris, outverts );
-    }
-    else
-    {
-        int outverts = 0;
-        int outtris = 0;
-        int outlines = 0;
-        int comptotal __attribute__((unused)) = 0;
-        int g;
-        for( g = 1; g <= groupno; g++ )
-        {
-            int j;
-            int lvindex = 0;
-
-            memset( tempv, 0, sizeof( tempv ) );
-            for( j = 0; j < ticount; j +=3 )
-            {
-                if( tispartof[j] == g ) 
-                {
-                    tempv[tindexset[j+0]] = 1;
-                    tempv[tindexset[j+1]] = 1;
-                    tempv[tindexset[j+2]] = 1;
-                }
-            }
-
-
-            for( j = 0; j < licount; j +=2 )
-            {
-                if( lispartof[j] == g )
-                {
-                    tempv[lindexset[j+0]] = 2;
-                    tempv[lindexset[j+1]] = 2;
-                }
-            }
-
-            int minx = 32767;
-            int miny = 32767;
-            int minz = 32767;
-            int maxx = -32768;
-            int maxy = -32768;
-            int maxz = -32768;
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] == 1 )
-                {
-                    int x = vertices[j*3+0];
-                    int y = vertices[j*3+1];
-                    int z = vertices[j*3+2];
-                    if( x < minx ) minx = x;
-                    if( y < miny ) miny = y;
-                    if( z < minz ) minz = z;
-                    if( x > maxx ) maxx = x;
-                    if( y > maxy ) maxy = y;
-                    if( z > maxz ) maxz = z;
-                    //fprintf( stderr, "Triangle: %d %d\n", j, lvindex );
-                    temp[j] = lvindex++;
-                }
-            }
-
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] == 2 )
-                {
-                    int x = vertices[j*3+0];
-                    int y = vertices[j*3+1];
-                    int z = vertices[j*3+2];
-                    if( x < minx ) minx = x;
-                    if( y < miny ) miny = y;
-                    if( z < minz ) minz = z;
-                    if( x > maxx ) maxx = x;
-                    if( y > maxy ) maxy = y;
-                    if( z > maxz ) maxz = z;
-                    //fprintf( stderr, "Line: %d %d\n", j, lvindex );
-                    temp[j] = lvindex++;
-                }
-            }
-            if( minx < absminx ) absminx = minx;
-            if( miny < absminy ) absminy = miny;
-            if( minz < absminz ) absminz = minz;
-            if( maxx > absmaxx ) absmaxx = maxx;
-            if( maxy > absmaxy ) absmaxy = maxy;
-            if( maxz > absmaxz ) absmaxz = maxz;
-
-            int centerx = (maxx+minx)/2;
-            int centery = (maxy+miny)/2;
-            int centerz = (maxz+minz)/2;
-            int radius = 0;
-            for( j = 0; j < vcount; j++ )
-            {
-                if( tempv[j] )
-                {
-                    int x = vertices[j*3+0];
-                    int y = vertices[j*3+1];
-                    int z = vertices[j*3+2];
-                    int dx = x - centerx;
-                    int dy = y - centery;
-                    int dz = z - centerz;
-                    int r = sqrt( (dx * dx + dy * dy + dz * dz) );
-                    if( r > radius ) radius = r;
-                }
-            }
-
             int faces = 0;
             for( j = 0; j < ticount; j += 3 )
             {
@@ -675,105 +792,17 @@ int main( int argc, char ** argv )
                     lines++;
             }
 
-            if( faces > lines )
-            {
-//                int stride = 3;
-                Write16u( lvindex*3 ); //# of vertx ints count
-                Write16u( faces );
-                Write16u( 3 ); //3 = triangles. NOTE: MSB is 0 or version.
-                Write16s( centerx );
-                Write16s( centery );
-                Write16s( centerz );
-                Write16u( radius );
-                Write16u( grouptags[g] );
-            //    fprintf( stderr, "T--->%d -> %d -> %d\n", g, radius, grouptags[g] );
-
-
-                uint16_t storebuffer[lvindex*3+faces*3];
-                int storebufferid = 0;
-
-
-                for( j = 0; j < ticount; j += 3 )
-                {
-                    if( tispartof[j] == g )
-                    {
-                        Write16u( storebuffer[storebufferid++] = temp[tindexset[j+0]]*3 );
-                        Write16u( storebuffer[storebufferid++] = temp[tindexset[j+1]]*3 );
-                        Write16u( storebuffer[storebufferid++] = temp[tindexset[j+2]]*3 );
-                        outtris ++;
-                    }
-                }
-
-                for( j = 0; j < vcount; j++ )
-                {
-                    if( tempv[j] )
-                    {
-                        //fprintf( stderr, "%d,%d,%d\n", (int)vertices[j*3+0], (int)vertices[j*3+1], (int)vertices[j*3+2] );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+0]) );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+1]) );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+2]) );
-                        outverts++;
-                    }
-                }
-                //fprintf( stderr, "Group T %d: %d/%d  (%d,%d,%d) %d\n", g-1, lvindex*stride, faces, centerx, centery, centerz, radius );
-            }
-            else
-            {
-//                int stride = 2;
-                Write16u( lvindex*3 ); //# of vertx ints count
-                Write16u( lines );
-                Write16u( 2 ); //3 = triangles. NOTE: MSB is 0 or version.
-                Write16s( centerx );
-                Write16s( centery );
-                Write16s( centerz );
-                Write16u( radius );
-                Write16u( grouptags[g] );
-            //    fprintf( stderr, "L--->%d -> %d -> %d\n", g, radius, grouptags[g] );
-
-                uint16_t storebuffer[lvindex*3+lines*2];
-                int storebufferid = 0;
-
-                int thislines = 0;
-                int thisvs = 0;
-
-                for( j = 0; j < licount; j += 2 )
-                {
-                    if( lispartof[j] == g )
-                    {
-                        //fprintf( stderr, "%d,%d -> %d,%d\n", lindexset[j+0], lindexset[j+1], temp[lindexset[j+0]]*3, temp[lindexset[j+1]]*3 );
-                        Write16u( storebuffer[storebufferid++] = temp[lindexset[j+0]]*3 );
-                        Write16u( storebuffer[storebufferid++] = temp[lindexset[j+1]]*3 );
-                        outlines ++;
-                        thislines++;
-                    }
-                }
-
-                for( j = 0; j < vcount; j++ )
-                {
-                    if( tempv[j] )
-                    {
-                        //fprintf( stderr, "%d,%d,%d\n", (int)vertices[j*3+0], (int)vertices[j*3+1], (int)vertices[j*3+2] );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+0]) );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+1]) );
-                        Write16s( (int)(storebuffer[storebufferid++] = vertices[j*3+2]) );
-                        outverts++;
-                        thisvs++;
-                    }
-                }
-                //fprintf( stderr, "Group L %d: %d/%d  (%d,%d,%d) %d (%d-%d) (%d-%d)\n", g-1, lvindex*stride, faces, centerx, centery, centerz, radius, lines, thislines, lvindex, thisvs );
-            }
-
+            //Lineified models' faces are already lines.
+            EmitGroup( g, ( faces > lines ) ? 3 : 2, grouptags[g], absmin, absmax );
 
             //Consider: Decompress the descriptors in RAM, and then decompress the needed models, as-needed.
-            //uint8_t * compoutput = alloca(lvindex*4+faces*4+66);
-            //int comp = fastlz_compress_level( 2, storebuffer, storebufferid * 2, compoutput);
-            //comptotal += comp;
         }
-        fprintf( stderr, "Emitted %d groups, %d indices, %d lines, %d vertices\n", groupno, outtris, outlines, outverts );
+        for( i = 0; i < MAXLODS; i++ )
+            fprintf( stderr, "LOD %d: %d faces, %d vertices\n", i, outfaces[i], outverts[i] );
     }
 
     fprintf( stderr, "Overall extents: [%d-%d] [%d-%d] [%d-%d]\n",
-        absminx, absmaxx, absminy, absmaxy, absminz, absmaxz );
+        absmin[0], absmax[0], absmin[1], absmax[1], absmin[2], absmax[2] );
 
     {
         //Now, the scary stuff... Occlusion and occlusion sorting,maybe?
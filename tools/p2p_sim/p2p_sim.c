@@ -0,0 +1,454 @@
+/*
+ * Headless p2pConnection simulator and benchmark.
+ *
+ * Runs main/p2pConnection.c unmodified on a number of virtual swadges which
+ * share one simulated ESP-NOW medium (see vradio.h), with configurable
+ * latency, jitter, loss, RSSI and bitrate. Nothing waits on the wall clock,
+ * so many seconds of radio time run in milliseconds.
+ *
+ * Each run starts the nodes connecting at random times within a short spread,
+ * like people turning on swadges. Starting them all at the exact same moment
+ * (-S 0) makes both sides of a pair send START together, which p2pConnection
+ * handles by timing out and restarting. Once connected, a node (or
+ * both nodes of a pair with -d) streams acked messages of the largest size
+ * back to back. Runs are repeated with different seeds and the results
+ * summarized per loss rate: how long connecting took, how often it had to
+ * restart, and the throughput once connected.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "p2pConnection.h"
+#include "vradio.h"
+
+#define MODE_ID       'S'
+#define CONNECT_RSSI  -20
+#define PAYLOAD_LEN   (VR_MAX_PACKET_LEN - sizeof(p2pCommonHeader_t))
+
+typedef struct
+{
+    p2pInfo p2p; // Must be first, callbacks get this back
+    vrNode_t* node;
+    int64_t startUs;
+    int64_t connectedUs;
+    uint32_t restarts;
+    uint32_t acked;
+    uint32_t failed;
+    uint32_t delivered;
+    bool shouldStream;
+} simNode_t;
+
+typedef struct
+{
+    uint8_t numNodes;
+    uint32_t runs;
+    uint32_t simSeconds;
+    uint32_t seed;
+    uint32_t bitrate;
+    uint32_t startSpreadUs;
+    vrLink_t link;
+    bool duplex;
+    const char* captureFile;
+} simConfig_t;
+
+typedef struct
+{
+    uint32_t connected;
+    uint32_t notConnected;
+    int64_t* connectUs;
+    uint32_t restarts;
+    uint64_t acked;
+    uint64_t failed;
+    uint64_t delivered;
+    double streamSeconds;
+    double airtimeFrac;
+    double wallSeconds;
+} simResult_t;
+
+static void simMsgTxCb(p2pInfo* p2p, messageStatus_t status);
+
+static simNode_t simNodes[VR_MAX_NODES];
+static bool simDuplex = false;
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Send the next streamed message
+ *
+ * @param sn The node to send from
+ */
+static void sendNext(simNode_t* sn)
+{
+    uint8_t payload[PAYLOAD_LEN];
+    memset(payload, sn->acked + sn->failed, sizeof(payload));
+    p2pSendMsg(&sn->p2p, payload, sizeof(payload), true, simMsgTxCb);
+}
+
+/**
+ * p2pConnection message transmit callback, sends the next message
+ *
+ * @param p2p The node's p2pInfo
+ * @param status Whether the message was acked
+ */
+static void simMsgTxCb(p2pInfo* p2p, messageStatus_t status)
+{
+    simNode_t* sn = (simNode_t*)p2p;
+    if(MSG_ACKED == status)
+    {
+        sn->acked++;
+    }
+    else
+    {
+        sn->failed++;
+    }
+    sendNext(sn);
+}
+
+/**
+ * p2pConnection message receive callback
+ *
+ * @param p2p The node's p2pInfo
+ * @param payload unused
+ * @param len unused
+ */
+static void simMsgRxCb(p2pInfo* p2p, const uint8_t* payload __attribute__((unused)),
+                       uint8_t len __attribute__((unused)))
+{
+    ((simNode_t*)p2p)->delivered++;
+}
+
+/**
+ * Start connecting again after the connection was lost
+ *
+ * @param node The node to restart
+ */
+static void simRestartNode(vrNode_t* node)
+{
+    p2pStartConnection(&((simNode_t*)node->ctx)->p2p);
+}
+
+/**
+ * p2pConnection connection callback. Starts streaming once connected, and
+ * starts connecting again if the connection was lost, like a mode would
+ *
+ * @param p2p The node's p2pInfo
+ * @param evt The connection event
+ */
+static void simConCb(p2pInfo* p2p, connectionEvt_t evt)
+{
+    simNode_t* sn = (simNode_t*)p2p;
+    switch(evt)
+    {
+        case CON_ESTABLISHED:
+        {
+            sn->connectedUs = vrNow();
+            sn->shouldStream = simDuplex || (GOING_FIRST == p2pGetPlayOrder(p2p));
+            if(sn->shouldStream)
+            {
+                sendNext(sn);
+            }
+            break;
+        }
+        case CON_LOST:
+        {
+            // p2pConnection reinitializes itself after this returns, so start
+            // connecting again right after that
+            sn->restarts++;
+            vrRunNodeLater(sn->node, 0, simRestartNode);
+            break;
+        }
+        case CON_STARTED:
+        case RX_GAME_START_ACK:
+        case RX_GAME_START_MSG:
+        default:
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * Radio receive callback, hands the packet to p2pConnection
+ */
+static void simRecvCb(vrNode_t* node, const uint8_t* mac, const uint8_t* data, uint8_t len, int8_t rssi)
+{
+    p2pRecvCb(&((simNode_t*)node->ctx)->p2p, mac, data, len, rssi);
+}
+
+/**
+ * Radio send callback, hands the status to p2pConnection
+ */
+static void simSendCb(vrNode_t* node, const uint8_t* mac, esp_now_send_status_t status)
+{
+    p2pSendCb(&((simNode_t*)node->ctx)->p2p, mac, status);
+}
+
+/**
+ * Initialize p2pConnection on a node and start connecting
+ *
+ * @param node The node to start
+ */
+static void simStartNode(vrNode_t* node)
+{
+    simNode_t* sn = node->ctx;
+    sn->startUs = vrNow();
+    p2pInitialize(&sn->p2p, MODE_ID, simConCb, simMsgRxCb, CONNECT_RSSI);
+    p2pStartConnection(&sn->p2p);
+}
+
+/**
+ * Run one simulation and add its results
+ *
+ * @param cfg The configuration to run
+ * @param seed The seed for this run
+ * @param capture true to capture this run's packets
+ * @param res The results to add to
+ */
+static void simRun(const simConfig_t* cfg, uint32_t seed, bool capture, simResult_t* res)
+{
+    double tStart = nowS();
+
+    vrInit(cfg->numNodes, cfg->bitrate, &cfg->link, seed);
+    if(capture && !vrSetCapture(cfg->captureFile))
+    {
+        fprintf(stderr, "Couldn't open %s\n", cfg->captureFile);
+    }
+
+    simDuplex = cfg->duplex;
+    memset(simNodes, 0, sizeof(simNodes));
+    for(uint8_t i = 0; i < cfg->numNodes; i++)
+    {
+        vrNode_t* node = vrGetNode(i);
+        simNodes[i].node = node;
+        simNodes[i].connectedUs = -1;
+        node->ctx = &simNodes[i];
+        node->recvCb = simRecvCb;
+        node->sendCb = simSendCb;
+        // Players don't all start at the same moment
+        vrRunNodeLater(node, cfg->startSpreadUs ? (vrRandom() % cfg->startSpreadUs) : 0, simStartNode);
+    }
+
+    int64_t endUs = (int64_t)cfg->simSeconds * 1000000;
+    vrRunUntil(endUs);
+
+    for(uint8_t i = 0; i < cfg->numNodes; i++)
+    {
+        simNode_t* sn = &simNodes[i];
+        res->restarts += sn->restarts;
+        res->delivered += sn->delivered;
+        if(sn->connectedUs < 0)
+        {
+            res->notConnected++;
+            continue;
+        }
+        res->connectUs[res->connected++] = sn->connectedUs - sn->startUs;
+        if(sn->shouldStream)
+        {
+            res->acked += sn->acked;
+            res->failed += sn->failed;
+            res->streamSeconds += (endUs - sn->connectedUs) / 1000000.0;
+        }
+    }
+    res->airtimeFrac += (double)vrGetAirtimeUs() / endUs;
+
+    vrDeinit();
+    res->wallSeconds += nowS() - tStart;
+}
+
+/**
+ * qsort() comparator for int64_t
+ */
+static int cmpInt64(const void* a, const void* b)
+{
+    int64_t x = *(const int64_t*)a;
+    int64_t y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Run a configuration cfg->runs times and print one line of results
+ *
+ * @param cfg The configuration to run
+ */
+static void simConfig(const simConfig_t* cfg)
+{
+    simResult_t res = {0};
+    res.connectUs = calloc(cfg->runs * cfg->numNodes, sizeof(int64_t));
+
+    for(uint32_t r = 0; r < cfg->runs; r++)
+    {
+        simRun(cfg, cfg->seed + r, (0 == r) && (NULL != cfg->captureFile), &res);
+    }
+
+    qsort(res.connectUs, res.connected, sizeof(int64_t), cmpInt64);
+    double medMs = res.connected ? res.connectUs[res.connected / 2] / 1000.0 : 0;
+    double maxMs = res.connected ? res.connectUs[res.connected - 1] / 1000.0 : 0;
+    double msgsPerS = res.streamSeconds > 0 ? res.acked / res.streamSeconds : 0;
+
+    printf("loss %5.1f%% | connect med %7.1f ms max %7.1f ms, %3u never, %3u restarts | "
+           "%7.1f msg/s %6.1f KB/s, %4.1f%% failed, %4.1f%% of acked delivered | air %4.1f%% | %6.0fx realtime\n",
+           cfg->link.lossPpm / 10000.0, medMs, maxMs, res.notConnected, res.restarts,
+           msgsPerS, (msgsPerS * PAYLOAD_LEN) / 1024,
+           (res.acked + res.failed) ? (100.0 * res.failed) / (res.acked + res.failed) : 0,
+           res.acked ? (100.0 * res.delivered) / res.acked : 0,
+           (100.0 * res.airtimeFrac) / cfg->runs,
+           ((double)cfg->runs * cfg->simSeconds) / res.wallSeconds);
+
+    free(res.connectUs);
+}
+
+/**
+ * Print the command line options
+ *
+ * @param progName The name this was run as
+ */
+static void printUsage(const char* progName)
+{
+    printf("Usage: %s [options]\n"
+           "  -n <nodes>    Number of swadges on the medium, default 2\n"
+           "  -r <runs>     Runs per loss rate, each with its own seed, default 20\n"
+           "  -t <seconds>  Simulated seconds per run, default 10\n"
+           "  -s <seed>     First seed, default 1\n"
+           "  -b <kbps>     Medium bitrate, default 1000\n"
+           "  -l <ms>       Link latency, default 1\n"
+           "  -j <ms>       Link jitter, default 2\n"
+           "  -S <ms>       Nodes start at random times up to this far apart, default 1000\n"
+           "  -R <rssi>     Link RSSI, default -10\n"
+           "  -L <percent>  Only run this loss rate instead of a sweep\n"
+           "  -d            Both swadges of a pair stream, not just the one going first\n"
+           "  -c <file>     Capture the first run's packets to a pcap file\n", progName);
+}
+
+int main(int argc, char** argv)
+{
+    simConfig_t cfg =
+    {
+        .numNodes = 2,
+        .runs = 20,
+        .simSeconds = 10,
+        .seed = 1,
+        .bitrate = 1000000,
+        .startSpreadUs = 1000000,
+        .link =
+        {
+            .latencyUs = 1000,
+            .jitterUs = 2000,
+            .lossPpm = 0,
+            .rssi = -10,
+        },
+        .duplex = false,
+        .captureFile = NULL,
+    };
+    double onlyLoss = -1;
+
+    int opt;
+    while(-1 != (opt = getopt(argc, argv, "n:r:t:s:b:l:j:S:R:L:dc:h")))
+    {
+        switch(opt)
+        {
+            case 'n':
+            {
+                int n = atoi(optarg);
+                cfg.numNodes = (n < 1) ? 1 : ((n > VR_MAX_NODES) ? VR_MAX_NODES : n);
+                break;
+            }
+            case 'r':
+            {
+                cfg.runs = (atoi(optarg) < 1) ? 1 : atoi(optarg);
+                break;
+            }
+            case 't':
+            {
+                cfg.simSeconds = (atoi(optarg) < 1) ? 1 : atoi(optarg);
+                break;
+            }
+            case 's':
+            {
+                cfg.seed = strtoul(optarg, NULL, 0);
+                break;
+            }
+            case 'b':
+            {
+                cfg.bitrate = (atoi(optarg) < 1) ? 1000 : (atoi(optarg) * 1000);
+                break;
+            }
+            case 'l':
+            {
+                cfg.link.latencyUs = atof(optarg) * 1000;
+                break;
+            }
+            case 'j':
+            {
+                cfg.link.jitterUs = atof(optarg) * 1000;
+                break;
+            }
+            case 'S':
+            {
+                cfg.startSpreadUs = atof(optarg) * 1000;
+                break;
+            }
+            case 'R':
+            {
+                cfg.link.rssi = atoi(optarg);
+                break;
+            }
+            case 'L':
+            {
+                onlyLoss = atof(optarg);
+                break;
+            }
+            case 'd':
+            {
+                cfg.duplex = true;
+                break;
+            }
+            case 'c':
+            {
+                cfg.captureFile = optarg;
+                break;
+            }
+            case 'h':
+            default:
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+    }
+
+    printf("%u nodes, %u runs x %us, %u kbps, latency %.1f ms + %.1f ms jitter, RSSI %d%s\n",
+           cfg.numNodes, cfg.runs, cfg.simSeconds, cfg.bitrate / 1000,
+           cfg.link.latencyUs / 1000.0, cfg.link.jitterUs / 1000.0, cfg.link.rssi,
+           cfg.duplex ? ", duplex" : "");
+
+    if(onlyLoss >= 0)
+    {
+        cfg.link.lossPpm = onlyLoss * 10000;
+        simConfig(&cfg);
+    }
+    else
+    {
+        static const double losses[] = {0, 1, 5, 10, 20, 30};
+        for(uint32_t i = 0; i < sizeof(losses) / sizeof(losses[0]); i++)
+        {
+            cfg.link.lossPpm = losses[i] * 10000;
+            simConfig(&cfg);
+            // Only capture the first configuration
+            cfg.captureFile = NULL;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,656 @@
+/*
+ * vradio.c
+ *
+ * A virtual ESP-NOW radio, see vradio.h
+ */
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_timer.h>
+#include <esp_wifi.h>
+#include <esp_random.h>
+
+#include "espNowUtils.h"
+#include "vradio.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+// The ESP-NOW vendor action frame around the payload, plus the FCS
+#define VR_FRAME_OVERHEAD (sizeof(espNowHeader_t) + 4)
+
+// Capture files are pcap, with this link type and a four byte pseudo header
+// before each packet: source node, destination node (0xFF for the
+// transmission itself), RSSI, and flags
+#define VR_PCAP_LINKTYPE_USER0 147
+#define VR_CAP_FLAG_LOST 0x01
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+typedef enum
+{
+    VR_EVT_TX_DONE, // A transmission left the air
+    VR_EVT_RX,      // A transmission arrived at a node
+    VR_EVT_CALL,    // A function to run as a node
+} vrEventType_t;
+
+typedef struct
+{
+    int64_t timeUs;
+    uint64_t seq; // Orders events which happen at the same time
+    vrEventType_t type;
+    uint8_t src;
+    uint8_t dst;
+    uint8_t len;
+    uint8_t data[VR_MAX_PACKET_LEN];
+    void (*fn)(vrNode_t* node);
+} vrEvent_t;
+
+typedef struct
+{
+    esp_timer_handle_t handle;
+    vrNode_t* owner;
+    int64_t deadlineUs;
+    bool armed;
+} vrTimer_t;
+
+typedef struct
+{
+    vrNode_t nodes[VR_MAX_NODES];
+    uint8_t numNodes;
+    vrLink_t links[VR_MAX_NODES][VR_MAX_NODES];
+    uint32_t bitrate;
+
+    int64_t nowUs;
+    int64_t mediumFreeUs;
+    int64_t airtimeUs;
+    uint32_t rngState;
+
+    // Whichever node is running, for the ESP-IDF functions to answer for
+    vrNode_t* current;
+
+    // A binary min heap of pending events
+    vrEvent_t* events;
+    uint32_t numEvents;
+    uint32_t maxEvents;
+    uint64_t nextSeq;
+
+    vrTimer_t* timers;
+    uint32_t numTimers;
+    uint32_t maxTimers;
+
+    FILE* capture;
+} vradio_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void vrPushEvent(const vrEvent_t* evt);
+static void vrPopEvent(vrEvent_t* evt);
+static bool vrEventBefore(const vrEvent_t* a, const vrEvent_t* b);
+static vrTimer_t* vrFindTimer(esp_timer_handle_t handle);
+static void vrCapture(uint8_t src, uint8_t dst, int8_t rssi, uint8_t flags, const uint8_t* data, uint8_t len);
+static void vrTxDone(const vrEvent_t* evt);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+static vradio_t vr = {0};
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * Set up the medium and its nodes
+ *
+ * @param numNodes The number of nodes, at most VR_MAX_NODES
+ * @param bitrate The medium's bitrate, in bits per second
+ * @param defaultLink The link between every pair of nodes, change individual
+ *                    ones with vrGetLink()
+ * @param seed Seeds esp_random() and the link model, the same seed always
+ *             gives the same run
+ */
+void vrInit(uint8_t numNodes, uint32_t bitrate, const vrLink_t* defaultLink, uint32_t seed)
+{
+    vrDeinit();
+
+    vr.numNodes = (numNodes > VR_MAX_NODES) ? VR_MAX_NODES : numNodes;
+    vr.bitrate = bitrate;
+    vr.rngState = seed | 1;
+
+    for(uint8_t i = 0; i < vr.numNodes; i++)
+    {
+        vrNode_t* node = &vr.nodes[i];
+        node->idx = i;
+        // Locally administered, random per seed, unique per node
+        uint32_t r = vrRandom();
+        node->mac[0] = 0x02;
+        node->mac[1] = r >> 24;
+        node->mac[2] = r >> 16;
+        node->mac[3] = r >> 8;
+        node->mac[4] = r;
+        node->mac[5] = i;
+
+        for(uint8_t j = 0; j < vr.numNodes; j++)
+        {
+            vr.links[i][j] = *defaultLink;
+        }
+    }
+}
+
+/**
+ * Free everything the medium allocated, including every esp_timer
+ */
+void vrDeinit(void)
+{
+    for(uint32_t i = 0; i < vr.numTimers; i++)
+    {
+        free(vr.timers[i].handle);
+    }
+    free(vr.timers);
+    free(vr.events);
+    if(NULL != vr.capture)
+    {
+        fclose(vr.capture);
+    }
+    memset(&vr, 0, sizeof(vr));
+}
+
+/**
+ * @param idx The node's index
+ * @return The node
+ */
+vrNode_t* vrGetNode(uint8_t idx)
+{
+    return &vr.nodes[idx];
+}
+
+/**
+ * @param src The transmitting node
+ * @param dst The receiving node
+ * @return The link from src to dst, which may be changed at any time
+ */
+vrLink_t* vrGetLink(uint8_t src, uint8_t dst)
+{
+    return &vr.links[src][dst];
+}
+
+/**
+ * Capture every transmission and reception, including lost ones, to a file
+ *
+ * @param fname The file to write to
+ * @return true if the file was opened, false if it wasn't
+ */
+bool vrSetCapture(const char* fname)
+{
+    vr.capture = fopen(fname, "wb");
+    if(NULL == vr.capture)
+    {
+        return false;
+    }
+
+    // pcap global header
+    uint32_t hdr[6] = {0xA1B2C3D4, 2 | (4 << 16), 0, 0, 65535, VR_PCAP_LINKTYPE_USER0};
+    fwrite(hdr, sizeof(hdr), 1, vr.capture);
+    return true;
+}
+
+/**
+ * Run a function as a node, so anything it calls into p2pConnection acts for
+ * that node
+ *
+ * @param node The node to run as
+ * @param fn The function to run
+ */
+void vrRunNode(vrNode_t* node, void (*fn)(vrNode_t* node))
+{
+    vrNode_t* prev = vr.current;
+    vr.current = node;
+    fn(node);
+    vr.current = prev;
+}
+
+/**
+ * Run a function as a node, some time from now
+ *
+ * @param node The node to run as
+ * @param delayUs How long from now to run it
+ * @param fn The function to run
+ */
+void vrRunNodeLater(vrNode_t* node, int64_t delayUs, void (*fn)(vrNode_t* node))
+{
+    vrEvent_t evt = {0};
+    evt.timeUs = vr.nowUs + delayUs;
+    evt.type = VR_EVT_CALL;
+    evt.dst = node->idx;
+    evt.fn = fn;
+    vrPushEvent(&evt);
+}
+
+/**
+ * Run every event and timer due up to a time, in order
+ *
+ * @param endUs The time to run until
+ * @return true if anything is still pending after endUs, false if nothing is
+ */
+bool vrRunUntil(int64_t endUs)
+{
+    while(true)
+    {
+        // Find the earliest timer
+        vrTimer_t* tmr = NULL;
+        for(uint32_t i = 0; i < vr.numTimers; i++)
+        {
+            if(vr.timers[i].armed && (NULL == tmr || vr.timers[i].deadlineUs < tmr->deadlineUs))
+            {
+                tmr = &vr.timers[i];
+            }
+        }
+
+        bool haveEvt = (vr.numEvents > 0);
+        if(!haveEvt && NULL == tmr)
+        {
+            vr.nowUs = endUs;
+            return false;
+        }
+
+        // Events go first on a tie, they were scheduled earlier
+        if(haveEvt && (NULL == tmr || vr.events[0].timeUs <= tmr->deadlineUs))
+        {
+            if(vr.events[0].timeUs > endUs)
+            {
+                vr.nowUs = endUs;
+                return true;
+            }
+
+            vrEvent_t evt;
+            vrPopEvent(&evt);
+            vr.nowUs = evt.timeUs;
+            if(VR_EVT_TX_DONE == evt.type)
+            {
+                vrTxDone(&evt);
+            }
+            else if(VR_EVT_CALL == evt.type)
+            {
+                vrRunNode(&vr.nodes[evt.dst], evt.fn);
+            }
+            else
+            {
+                vrNode_t* dst = &vr.nodes[evt.dst];
+                dst->rxPackets++;
+                vrCapture(evt.src, evt.dst, vr.links[evt.src][evt.dst].rssi, 0, evt.data, evt.len);
+                if(NULL != dst->recvCb)
+                {
+                    vr.current = dst;
+                    dst->recvCb(dst, vr.nodes[evt.src].mac, evt.data, evt.len, vr.links[evt.src][evt.dst].rssi);
+                    vr.current = NULL;
+                }
+            }
+        }
+        else
+        {
+            if(tmr->deadlineUs > endUs)
+            {
+                vr.nowUs = endUs;
+                return true;
+            }
+
+            vr.nowUs = tmr->deadlineUs;
+            tmr->armed = false;
+            vr.current = tmr->owner;
+            tmr->handle->callback(tmr->handle->arg);
+            vr.current = NULL;
+        }
+    }
+}
+
+/**
+ * @return The simulated time, in microseconds
+ */
+int64_t vrNow(void)
+{
+    return vr.nowUs;
+}
+
+/**
+ * @return The total time the medium was busy, in microseconds
+ */
+int64_t vrGetAirtimeUs(void)
+{
+    return vr.airtimeUs;
+}
+
+/**
+ * A transmission left the air. Tell the sender, then send a copy to every
+ * other node over its link
+ *
+ * @param evt The transmission
+ */
+static void vrTxDone(const vrEvent_t* evt)
+{
+    vrNode_t* src = &vr.nodes[evt->src];
+    vrCapture(evt->src, 0xFF, 0, 0, evt->data, evt->len);
+
+    for(uint8_t i = 0; i < vr.numNodes; i++)
+    {
+        if(i == evt->src)
+        {
+            continue;
+        }
+
+        const vrLink_t* link = &vr.links[evt->src][i];
+        if(link->lossPpm > (vrRandom() % 1000000))
+        {
+            vr.nodes[i].lostPackets++;
+            vrCapture(evt->src, i, link->rssi, VR_CAP_FLAG_LOST, evt->data, evt->len);
+            continue;
+        }
+
+        vrEvent_t rx = *evt;
+        rx.type = VR_EVT_RX;
+        rx.dst = i;
+        rx.timeUs = vr.nowUs + link->latencyUs + (link->jitterUs ? (vrRandom() % (link->jitterUs + 1)) : 0);
+        vrPushEvent(&rx);
+    }
+
+    // Broadcasts aren't acked at the MAC layer, so sends always succeed
+    if(NULL != src->sendCb)
+    {
+        static const uint8_t bcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+        vr.current = src;
+        src->sendCb(src, bcastMac, ESP_NOW_SEND_SUCCESS);
+        vr.current = NULL;
+    }
+}
+
+/**
+ * Write a packet to the capture file, if there is one
+ *
+ * @param src The transmitting node
+ * @param dst The receiving node, or 0xFF for the transmission itself
+ * @param rssi The RSSI it was received with
+ * @param flags VR_CAP_FLAG_LOST if it was lost
+ * @param data The packet
+ * @param len The packet's length
+ */
+static void vrCapture(uint8_t src, uint8_t dst, int8_t rssi, uint8_t flags, const uint8_t* data, uint8_t len)
+{
+    if(NULL == vr.capture)
+    {
+        return;
+    }
+
+    uint32_t recHdr[4] = {vr.nowUs / 1000000, vr.nowUs % 1000000, 4 + len, 4 + len};
+    uint8_t pseudoHdr[4] = {src, dst, (uint8_t)rssi, flags};
+    fwrite(recHdr, sizeof(recHdr), 1, vr.capture);
+    fwrite(pseudoHdr, sizeof(pseudoHdr), 1, vr.capture);
+    fwrite(data, 1, len, vr.capture);
+}
+
+/**
+ * @return The next number from the medium's xorshift generator
+ */
+uint32_t vrRandom(void)
+{
+    vr.rngState ^= vr.rngState << 13;
+    vr.rngState ^= vr.rngState >> 17;
+    vr.rngState ^= vr.rngState << 5;
+    return vr.rngState;
+}
+
+/**
+ * @param a An event
+ * @param b Another event
+ * @return true if a happens before b
+ */
+static bool vrEventBefore(const vrEvent_t* a, const vrEvent_t* b)
+{
+    return (a->timeUs < b->timeUs) || ((a->timeUs == b->timeUs) && (a->seq < b->seq));
+}
+
+/**
+ * Add an event to the heap
+ *
+ * @param evt The event to add, copied
+ */
+static void vrPushEvent(const vrEvent_t* evt)
+{
+    if(vr.numEvents == vr.maxEvents)
+    {
+        vr.maxEvents = vr.maxEvents ? (vr.maxEvents * 2) : 64;
+        vr.events = realloc(vr.events, vr.maxEvents * sizeof(vrEvent_t));
+    }
+
+    uint32_t i = vr.numEvents++;
+    vr.events[i] = *evt;
+    vr.events[i].seq = vr.nextSeq++;
+
+    // Sift up
+    while(i > 0)
+    {
+        uint32_t parent = (i - 1) / 2;
+        if(!vrEventBefore(&vr.events[i], &vr.events[parent]))
+        {
+            break;
+        }
+        vrEvent_t tmp = vr.events[i];
+        vr.events[i] = vr.events[parent];
+        vr.events[parent] = tmp;
+        i = parent;
+    }
+}
+
+/**
+ * Remove the earliest event from the heap
+ *
+ * @param evt Where to copy the event
+ */
+static void vrPopEvent(vrEvent_t* evt)
+{
+    *evt = vr.events[0];
+    vr.events[0] = vr.events[--vr.numEvents];
+
+    // Sift down
+    uint32_t i = 0;
+    while(true)
+    {
+        uint32_t first = i;
+        uint32_t l = (2 * i) + 1;
+        uint32_t r = l + 1;
+        if(l < vr.numEvents && vrEventBefore(&vr.events[l], &vr.events[first]))
+        {
+            first = l;
+        }
+        if(r < vr.numEvents && vrEventBefore(&vr.events[r], &vr.events[first]))
+        {
+            first = r;
+        }
+        if(first == i)
+        {
+            break;
+        }
+        vrEvent_t tmp = vr.events[i];
+        vr.events[i] = vr.events[first];
+        vr.events[first] = tmp;
+        i = first;
+    }
+}
+
+/**
+ * @param handle A timer handle
+ * @return The medium's record of that timer
+ */
+static vrTimer_t* vrFindTimer(esp_timer_handle_t handle)
+{
+    for(uint32_t i = 0; i < vr.numTimers; i++)
+    {
+        if(vr.timers[i].handle == handle)
+        {
+            return &vr.timers[i];
+        }
+    }
+    return NULL;
+}
+
+//==============================================================================
+// ESP-IDF functions, answered for the current node
+//==============================================================================
+
+/**
+ * @return The simulated time, in microseconds
+ */
+int64_t esp_timer_get_time(void)
+{
+    return vr.nowUs;
+}
+
+/**
+ * Create a timer owned by the current node
+ *
+ * @param create_args The timer's callback and argument
+ * @param out_handle The timer, allocated if NULL
+ * @return ESP_OK
+ */
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+    if(NULL == *out_handle)
+    {
+        *out_handle = calloc(1, sizeof(struct esp_timer));
+    }
+    (*out_handle)->callback = create_args->callback;
+    (*out_handle)->arg = create_args->arg;
+
+    vrTimer_t* tmr = vrFindTimer(*out_handle);
+    if(NULL == tmr)
+    {
+        if(vr.numTimers == vr.maxTimers)
+        {
+            vr.maxTimers = vr.maxTimers ? (vr.maxTimers * 2) : 16;
+            vr.timers = realloc(vr.timers, vr.maxTimers * sizeof(vrTimer_t));
+        }
+        tmr = &vr.timers[vr.numTimers++];
+        tmr->handle = *out_handle;
+    }
+    tmr->owner = vr.current;
+    tmr->armed = false;
+    return ESP_OK;
+}
+
+/**
+ * Delete a timer
+ *
+ * @param timer The timer to delete
+ * @return ESP_OK
+ */
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    vrTimer_t* tmr = vrFindTimer(timer);
+    if(NULL != tmr)
+    {
+        free(tmr->handle);
+        *tmr = vr.timers[--vr.numTimers];
+    }
+    return ESP_OK;
+}
+
+/**
+ * Stop a timer
+ *
+ * @param timer The timer to stop
+ * @return ESP_OK
+ */
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    vrTimer_t* tmr = vrFindTimer(timer);
+    if(NULL != tmr)
+    {
+        tmr->armed = false;
+    }
+    return ESP_OK;
+}
+
+/**
+ * Start a one shot timer
+ *
+ * @param timer The timer to start
+ * @param timeout_us How long from now it should fire
+ * @return ESP_OK
+ */
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    vrTimer_t* tmr = vrFindTimer(timer);
+    if(NULL != tmr)
+    {
+        tmr->deadlineUs = vr.nowUs + timeout_us;
+        tmr->armed = true;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @return A random number from the medium's generator, so runs repeat exactly
+ */
+uint32_t esp_random(void)
+{
+    return vrRandom();
+}
+
+/**
+ * Get the current node's MAC
+ *
+ * @param ifx unused
+ * @param mac Where to write the MAC
+ * @return ESP_OK
+ */
+esp_err_t esp_wifi_get_mac(wifi_interface_t ifx __attribute__((unused)), uint8_t mac[6])
+{
+    if(NULL != vr.current)
+    {
+        memcpy(mac, vr.current->mac, 6);
+    }
+    else
+    {
+        memset(mac, 0, 6);
+    }
+    return ESP_OK;
+}
+
+/**
+ * Broadcast a packet from the current node. It goes on the air as soon as the
+ * medium is free
+ *
+ * @param data The packet
+ * @param len The packet's length
+ */
+void espNowSend(const char* data, uint8_t len)
+{
+    if(NULL == vr.current || len > VR_MAX_PACKET_LEN)
+    {
+        return;
+    }
+
+    int64_t startUs = (vr.mediumFreeUs > vr.nowUs) ? vr.mediumFreeUs : vr.nowUs;
+    int64_t airUs = (((int64_t)len + VR_FRAME_OVERHEAD) * 8 * 1000000) / vr.bitrate;
+    vr.mediumFreeUs = startUs + airUs;
+    vr.airtimeUs += airUs;
+    vr.current->txPackets++;
+
+    vrEvent_t evt = {0};
+    evt.timeUs = vr.mediumFreeUs;
+    evt.type = VR_EVT_TX_DONE;
+    evt.src = vr.current->idx;
+    evt.len = len;
+    memcpy(evt.data, data, len);
+    vrPushEvent(&evt);
+}
@@ -0,0 +1,77 @@
+/*
+ * vradio.h
+ *
+ * A virtual ESP-NOW radio for running any number of p2pConnection instances
+ * in one process, headless, on a simulated clock.
+ *
+ * This provides the handful of ESP-IDF functions p2pConnection.c calls:
+ * esp_timer_*, esp_timer_get_time(), esp_random(), esp_wifi_get_mac() and
+ * espNowSend(). Each is answered for whichever node is currently running, so
+ * every node gets its own MAC, its own timers and its own transmissions.
+ *
+ * All nodes share one medium. A transmission occupies it for its airtime at
+ * the configured bitrate, and transmissions queue up behind each other. When a
+ * transmission ends, the sender gets its send callback, and every other node
+ * gets a copy after the link's latency plus jitter, unless the link loses it.
+ * Each directed link has its own latency, jitter, loss and RSSI.
+ */
+
+#ifndef _VRADIO_H_
+#define _VRADIO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <esp_now.h>
+
+#define VR_MAX_NODES 16
+#define VR_MAX_PACKET_LEN 250
+
+typedef struct _vrNode vrNode_t;
+
+typedef void (*vrRecvCb_t)(vrNode_t* node, const uint8_t* mac, const uint8_t* data, uint8_t len, int8_t rssi);
+typedef void (*vrSendCb_t)(vrNode_t* node, const uint8_t* mac, esp_now_send_status_t status);
+
+/**
+ * One direction of a link between two nodes
+ */
+typedef struct
+{
+    uint32_t latencyUs; //!< Fixed delay from the end of a transmission to reception
+    uint32_t jitterUs;  //!< Up to this much more delay, uniformly random
+    uint32_t lossPpm;   //!< Chance of losing each packet, in parts per million
+    int8_t rssi;        //!< The RSSI packets are received with
+} vrLink_t;
+
+/**
+ * One emulated swadge on the medium
+ */
+struct _vrNode
+{
+    uint8_t idx;          //!< This node's index
+    uint8_t mac[6];       //!< This node's MAC
+    vrRecvCb_t recvCb;    //!< Called when a packet is received
+    vrSendCb_t sendCb;    //!< Called when a transmission is done
+    void* ctx;            //!< For the caller
+
+    uint32_t txPackets;   //!< Packets transmitted
+    uint32_t rxPackets;   //!< Packets received
+    uint32_t lostPackets; //!< Packets lost on the way to this node
+};
+
+void vrInit(uint8_t numNodes, uint32_t bitrate, const vrLink_t* defaultLink, uint32_t seed);
+void vrDeinit(void);
+
+vrNode_t* vrGetNode(uint8_t idx);
+vrLink_t* vrGetLink(uint8_t src, uint8_t dst);
+bool vrSetCapture(const char* fname);
+
+void vrRunNode(vrNode_t* node, void (*fn)(vrNode_t* node));
+void vrRunNodeLater(vrNode_t* node, int64_t delayUs, void (*fn)(vrNode_t* node));
+uint32_t vrRandom(void);
+bool vrRunUntil(int64_t endUs);
+int64_t vrNow(void);
+int64_t vrGetAirtimeUs(void);
+
+#endif
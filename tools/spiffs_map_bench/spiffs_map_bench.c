@@ -0,0 +1,230 @@
+/*
+ * Host benchmark for the emulator's packed SPIFFS image.
+ *
+ * Fills a temporary spiffs_image folder with files the same sizes as the ones
+ * in assets/, then builds the image with initSpiffs(). Every file is checked
+ * against what's on disk through both spiffsReadFile() and spiffsMapFile().
+ * Then it reports the time to load every file, as a mode entering would,
+ * using the old fopen()/fread() per file, spiffsReadFile() and
+ * spiffsMapFile().
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "spiffs_manager.h"
+
+#define ASSETS_DIR "../../assets"
+#define PASSES     200
+
+typedef struct
+{
+    char name[64];
+    size_t size;
+} benchFile_t;
+
+static benchFile_t files[1024];
+static uint32_t numFiles = 0;
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Find the size of every file under a folder
+ *
+ * @param path The folder to search
+ */
+static void findAssetSizes(const char* path)
+{
+    DIR* dir = opendir(path);
+    if(NULL == dir)
+    {
+        return;
+    }
+    struct dirent* ent;
+    while(NULL != (ent = readdir(dir)) && numFiles < sizeof(files) / sizeof(files[0]))
+    {
+        if('.' == ent->d_name[0])
+        {
+            continue;
+        }
+        char full[1024];
+        snprintf(full, sizeof(full), "%s/%s", path, ent->d_name);
+        struct stat st;
+        if(0 != stat(full, &st))
+        {
+            continue;
+        }
+        if(S_ISDIR(st.st_mode))
+        {
+            findAssetSizes(full);
+        }
+        else
+        {
+            snprintf(files[numFiles].name, sizeof(files[numFiles].name), "f%04u.bin", numFiles);
+            files[numFiles].size = st.st_size;
+            numFiles++;
+        }
+    }
+    closedir(dir);
+}
+
+/**
+ * The old way the emulator read a file
+ */
+static bool oldReadFile(const char* fname, uint8_t** output, size_t* outsize)
+{
+    char fnameFull[128] = "./spiffs_image/";
+    strcat(fnameFull, fname);
+    FILE* f = fopen(fnameFull, "rb");
+    if(f == NULL)
+    {
+        return false;
+    }
+    fseek(f, 0L, SEEK_END);
+    *outsize = ftell(f);
+    fseek(f, 0L, SEEK_SET);
+    *output = (uint8_t*)calloc((*outsize + 1), sizeof(uint8_t));
+    if(1 != fread(*output, *outsize, 1, f) && 0 != *outsize)
+    {
+        fclose(f);
+        return false;
+    }
+    fclose(f);
+    return true;
+}
+
+int main(void)
+{
+    findAssetSizes(ASSETS_DIR);
+    if(0 == numFiles)
+    {
+        printf("No assets found in %s\n", ASSETS_DIR);
+        return 1;
+    }
+
+    // Work in a temporary folder with random files of the same sizes
+    char tmpDir[] = "/tmp/spiffs_map_benchXXXXXX";
+    if(NULL == mkdtemp(tmpDir) || 0 != chdir(tmpDir) || 0 != mkdir("spiffs_image", 0755))
+    {
+        printf("Couldn't make a temporary folder\n");
+        return 1;
+    }
+    size_t totalSize = 0;
+    for(uint32_t i = 0; i < numFiles; i++)
+    {
+        char path[128];
+        snprintf(path, sizeof(path), "spiffs_image/%.63s", files[i].name);
+        FILE* f = fopen(path, "wb");
+        for(size_t b = 0; b < files[i].size; b++)
+        {
+            fputc(rand(), f);
+        }
+        fclose(f);
+        totalSize += files[i].size;
+    }
+
+    double start = nowS();
+    initSpiffs();
+    double initMs = (nowS() - start) * 1000;
+
+    // Check every file, both ways
+    bool ok = true;
+    for(uint32_t i = 0; i < numFiles && ok; i++)
+    {
+        uint8_t* expect = NULL;
+        uint8_t* copy = NULL;
+        const uint8_t* view = NULL;
+        size_t expectSz, copySz, viewSz;
+        ok = oldReadFile(files[i].name, &expect, &expectSz) &&
+             spiffsReadFile(files[i].name, &copy, &copySz) &&
+             spiffsMapFile(files[i].name, &view, &viewSz) &&
+             expectSz == copySz && expectSz == viewSz &&
+             0 == memcmp(expect, copy, expectSz + 1) &&
+             0 == memcmp(expect, view, expectSz + 1);
+        free(expect);
+        free(copy);
+        spiffsUnmapFile(view);
+    }
+    uint8_t* missing = NULL;
+    size_t missingSz;
+    ok = ok && !spiffsReadFile("missing.bin", &missing, &missingSz);
+
+    if(!ok)
+    {
+        printf("FAIL: the image doesn't match the files on disk\n");
+    }
+    else
+    {
+        printf("Verified %u files, %u bytes\n", numFiles, (uint32_t)totalSize);
+        printf("Built the image in %.2f ms\n\n", initMs);
+
+        double oldS = 0, readS = 0, mapS = 0;
+        for(uint32_t p = 0; p < PASSES; p++)
+        {
+            start = nowS();
+            for(uint32_t i = 0; i < numFiles; i++)
+            {
+                uint8_t* buf = NULL;
+                size_t sz;
+                oldReadFile(files[i].name, &buf, &sz);
+                free(buf);
+            }
+            oldS += nowS() - start;
+
+            start = nowS();
+            for(uint32_t i = 0; i < numFiles; i++)
+            {
+                uint8_t* buf = NULL;
+                size_t sz;
+                spiffsReadFile(files[i].name, &buf, &sz);
+                free(buf);
+            }
+            readS += nowS() - start;
+
+            start = nowS();
+            for(uint32_t i = 0; i < numFiles; i++)
+            {
+                const uint8_t* buf = NULL;
+                size_t sz;
+                spiffsMapFile(files[i].name, &buf, &sz);
+                spiffsUnmapFile(buf);
+            }
+            mapS += nowS() - start;
+        }
+
+        printf("Loading all %u files            ms    us/file\n", numFiles);
+        printf("  fopen() and fread()   %10.3f %10.2f\n", oldS * 1000 / PASSES, oldS * 1e6 / (PASSES * numFiles));
+        printf("  spiffsReadFile()      %10.3f %10.2f\n", readS * 1000 / PASSES, readS * 1e6 / (PASSES * numFiles));
+        printf("  spiffsMapFile()       %10.3f %10.2f\n", mapS * 1000 / PASSES, mapS * 1e6 / (PASSES * numFiles));
+    }
+
+    // Clean up
+    deinitSpiffs();
+    for(uint32_t i = 0; i < numFiles; i++)
+    {
+        char path[128];
+        snprintf(path, sizeof(path), "spiffs_image/%.63s", files[i].name);
+        unlink(path);
+    }
+    rmdir("spiffs_image");
+    if(0 != chdir("/") || 0 != rmdir(tmpDir))
+    {
+        printf("Couldn't remove %s\n", tmpDir);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+/*
+ * Host validation and benchmark for the tunernome pitch tracker.
+ *
+ * With no arguments, synthetic plucked-string tones (harmonics, decay and
+ * noise) are generated at known deviations from each guitar, violin and
+ * ukulele string. Each one is run through the pitch tracker and the measured
+ * deviation is compared to the real one. The time per sample is compared
+ * against the colorchord DFT the tuner used to run.
+ *
+ * With arguments, a recorded tone is tracked instead:
+ *     ./tuner_bench recording.wav 110.0
+ * The WAV must be 16 bit PCM. It's resampled to DFREQ if it isn't already.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#include "DFT32.h"
+#include "embeddednf.h"
+#include "pitch_tracker.h"
+
+#define TONE_SECONDS 2
+#define TONE_SAMPLES (DFREQ * TONE_SECONDS)
+#define ADC_BLOCK    256
+
+typedef struct
+{
+    const char* name;
+    double hz;
+} target_t;
+
+static const target_t targets[] =
+{
+    {"Guitar E2",  82.407},
+    {"Guitar A2",  110.000},
+    {"Guitar D3",  146.832},
+    {"Guitar G3",  196.998},
+    {"Guitar B3",  246.942},
+    {"Guitar E4",  329.628},
+    {"Violin D4",  293.665},
+    {"Violin A4",  440.000},
+    {"Violin E5",  659.255},
+    {"Ukulele C4", 261.626},
+    {"Ukulele G4", 391.995},
+};
+
+static const double deviations[] = {-45.0, -12.3, -2.5, 0.0, 0.7, 4.1, 19.0, 38.8};
+
+/**
+ * @return The current monotonic time, in seconds
+ */
+static double nowS(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + (ts.tv_nsec / 1000000000.0);
+}
+
+/**
+ * Make a decaying tone with a few harmonics and some noise
+ *
+ * @param out Where to write TONE_SAMPLES samples
+ * @param hz The fundamental frequency
+ */
+static void makeTone(int16_t* out, double hz)
+{
+    double phase = (rand() % 1000) / 1000.0;
+    for(int i = 0; i < TONE_SAMPLES; i++)
+    {
+        double t = (double)i / DFREQ;
+        double env = 0.3 + 0.7 * exp(-t * 1.5);
+        double v = sin(2 * M_PI * (hz * t + phase)) +
+                   0.5 * sin(2 * M_PI * (2 * hz * t + phase)) +
+                   0.25 * sin(2 * M_PI * (3 * hz * t + phase));
+        out[i] = (int16_t)(4000 * env * v / 1.75 + ((rand() % 401) - 200));
+    }
+}
+
+/**
+ * Track a tone and return the deviation averaged over the last half second
+ *
+ * @param samples The samples to track
+ * @param numSamples The number of samples
+ * @param hz The target frequency
+ * @param magnitude Written with the last magnitude
+ * @return The measured deviation, in cents
+ */
+static double trackTone(const int16_t* samples, uint32_t numSamples, double hz, uint16_t* magnitude)
+{
+    pitchTracker_t pt;
+    uint32_t freq = PT_HZ(hz);
+    pitchTrackerInit(&pt, &freq, 1);
+
+    double sum = 0;
+    int cnt = 0;
+    for(uint32_t i = 0; i < numSamples; i += ADC_BLOCK)
+    {
+        uint32_t n = (numSamples - i) < ADC_BLOCK ? (numSamples - i) : ADC_BLOCK;
+        if(pitchTrackerPushSamples(&pt, &samples[i], n) && (i > numSamples - (DFREQ / 2)))
+        {
+            sum += pt.bins[0].centiCents / 100.0;
+            cnt++;
+        }
+    }
+    *magnitude = pt.bins[0].magnitude;
+    return cnt ? sum / cnt : 0;
+}
+
+/**
+ * Read a 16 bit PCM WAV file, mix it to mono and resample it to DFREQ
+ *
+ * @param fname The file to read
+ * @param numSamples Written with the number of samples read
+ * @return The samples, which must be freed, or NULL on error
+ */
+static int16_t* readWav(const char* fname, uint32_t* numSamples)
+{
+    FILE* f = fopen(fname, "rb");
+    if(NULL == f)
+    {
+        return NULL;
+    }
+
+    uint8_t hdr[12];
+    if(1 != fread(hdr, sizeof(hdr), 1, f) || memcmp(hdr, "RIFF", 4) || memcmp(&hdr[8], "WAVE", 4))
+    {
+        fclose(f);
+        return NULL;
+    }
+
+    uint16_t channels = 0, bits = 0;
+    uint32_t rate = 0;
+    int16_t* out = NULL;
+    uint8_t chunk[8];
+    while(1 == fread(chunk, sizeof(chunk), 1, f))
+    {
+        uint32_t len = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+        if(0 == memcmp(chunk, "fmt ", 4))
+        {
+            uint8_t fmt[16];
+            if(len < sizeof(fmt) || 1 != fread(fmt, sizeof(fmt), 1, f))
+            {
+                break;
+            }
+            channels = fmt[2] | (fmt[3] << 8);
+            rate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+            bits = fmt[14] | (fmt[15] << 8);
+            fseek(f, len - sizeof(fmt) + (len & 1), SEEK_CUR);
+        }
+        else if(0 == memcmp(chunk, "data", 4) && 16 == bits && channels)
+        {
+            uint32_t inFrames = len / (2 * channels);
+            int16_t* in = malloc(len);
+            inFrames = fread(in, 2 * channels, inFrames, f);
+
+            *numSamples = ((uint64_t)inFrames * DFREQ) / rate;
+            out = malloc(*numSamples * sizeof(int16_t));
+            for(uint32_t i = 0; i < *numSamples; i++)
+            {
+                // Nearest neighbor resampling, first channel
+                out[i] = in[(((uint64_t)i * rate) / DFREQ) * channels];
+            }
+            free(in);
+            break;
+        }
+        else
+        {
+            fseek(f, len + (len & 1), SEEK_CUR);
+        }
+    }
+    fclose(f);
+    return out;
+}
+
+int main(int argc, char** argv)
+{
+    if(3 == argc)
+    {
+        uint32_t numSamples = 0;
+        int16_t* samples = readWav(argv[1], &numSamples);
+        if(NULL == samples)
+        {
+            fprintf(stderr, "Couldn't read %s\n", argv[1]);
+            return 1;
+        }
+        double hz = atof(argv[2]);
+        uint16_t mag;
+        double cents = trackTone(samples, numSamples, hz, &mag);
+        printf("%s vs %.3f Hz: %+.2f cents (%.3f Hz), magnitude %d\n", argv[1], hz, cents,
+               hz * pow(2, cents / 1200), mag);
+        free(samples);
+        return 0;
+    }
+
+    srand(1);
+    static int16_t samples[TONE_SAMPLES];
+    double worst = 0;
+    for(uint32_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++)
+    {
+        printf("%-11s", targets[t].name);
+        for(uint32_t d = 0; d < sizeof(deviations) / sizeof(deviations[0]); d++)
+        {
+            makeTone(samples, targets[t].hz * pow(2, deviations[d] / 1200));
+            uint16_t mag;
+            double cents = trackTone(samples, TONE_SAMPLES, targets[t].hz, &mag);
+            double err = fabs(cents - deviations[d]);
+            if(err > worst)
+            {
+                worst = err;
+            }
+            printf(" %+6.1f:%+6.2f", deviations[d], cents);
+        }
+        printf("\n");
+    }
+    printf("Worst error %.3f cents\n\n", worst);
+
+    // Compare CPU time against the DFT, for the six strings of a guitar
+    makeTone(samples, 110);
+    uint32_t freqs[6];
+    for(int i = 0; i < 6; i++)
+    {
+        freqs[i] = PT_HZ(targets[i].hz);
+    }
+    pitchTracker_t pt;
+    pitchTrackerInit(&pt, freqs, 6);
+
+    static dft32_data dd;
+    static embeddednf_data end;
+    InitColorChord(&end, &dd);
+
+    const int reps = 50;
+    double tStart = nowS();
+    for(int r = 0; r < reps; r++)
+    {
+        for(uint32_t i = 0; i < TONE_SAMPLES; i += ADC_BLOCK)
+        {
+            pitchTrackerPushSamples(&pt, &samples[i], ADC_BLOCK);
+        }
+    }
+    double tPt = (nowS() - tStart) / (reps * TONE_SAMPLES);
+
+    tStart = nowS();
+    for(int r = 0; r < reps; r++)
+    {
+        for(uint32_t i = 0; i < TONE_SAMPLES; i += 128)
+        {
+            PushSamples32(&dd, &samples[i], 128);
+            HandleFrameInfo(&end, &dd);
+        }
+    }
+    double tDft = (nowS() - tStart) / (reps * TONE_SAMPLES);
+
+    printf("Pitch tracker, 6 strings: %7.1f ns/sample\n", tPt * 1e9);
+    printf("DFT32 + HandleFrameInfo:  %7.1f ns/sample (%.1fx)\n", tDft * 1e9, tDft / tPt);
+    return 0;
+}